@@ -0,0 +1,30 @@
+//*******  VERTEX DECODE UTILITY          *******//
+// Decoding of the compact vertex layout         //
+//***********************************************//
+
+#ifndef VERTEX_DECODE_H
+#define VERTEX_DECODE_H
+
+// The compact layout (QuantizeOperator) stores:
+//  POSITION : 16 bit unorm, the input assembler gives [0,1] values
+//  NORMAL   : 16 bit snorm octahedral coordinates in [-1,1]
+//  TEXCOORD : 16 bit half floats, the input assembler gives float2, no decoding needed
+// The offset and scale come from GetMeshPositionOffset / GetMeshPositionScale in the scripts.
+
+float4 DecodePosition(float4 quantizedPos, float3 posOffset, float3 posScale)
+{
+	return float4(posOffset + quantizedPos.xyz * posScale, 1.0);
+}
+
+float3 DecodeOctahedralNormal(float2 e)
+{
+	float3 n = float3(e.xy, 1.0 - abs(e.x) - abs(e.y));
+	if (n.z < 0.0)
+	{
+		float2 signNotZero = float2(e.x >= 0.0 ? 1.0 : -1.0, e.y >= 0.0 ? 1.0 : -1.0);
+		n.xy = (1.0 - abs(e.yx)) * signNotZero;
+	}
+	return normalize(n);
+}
+
+#endif
@@ -19,6 +19,7 @@
 #include "Pegasus/AssetLib/AssetLib.h"
 #include "Pegasus/AssetLib/Asset.h"
 #include "TimelineBlocks/GeometryTestBlock.h"
+#include "TimelineBlocks/GraphBenchmarkBlock.h"
 
 #include "Pegasus/Timeline/TimelineManager.h"
 #include "Pegasus/Timeline/Timeline.h"
@@ -201,6 +202,7 @@ void TestApp1::InitializeApp()
     REGISTER_TIMELINE_BLOCK(FractalCube2Block);
     REGISTER_TIMELINE_BLOCK(TextureTestBlock);
     REGISTER_TIMELINE_BLOCK(GeometryTestBlock);
+    REGISTER_TIMELINE_BLOCK(GraphBenchmarkBlock);
 
     // load the timeline. For now gets unloaded at destruction of timeline manager.
     Pegasus::Timeline::TimelineManager * const timelineManager = GetTimelineManager();
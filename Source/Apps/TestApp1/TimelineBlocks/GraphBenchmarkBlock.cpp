@@ -0,0 +1,707 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   GraphBenchmarkBlock.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Timeline block measuring the cost of querying wide and deep texture and mesh graphs
+
+#include "TimelineBlocks/GraphBenchmarkBlock.h"
+#include "Pegasus/Texture/Generator/ConstantColorGenerator.h"
+#include "Pegasus/Texture/Operator/AddOperator.h"
+#include "Pegasus/Texture/TextureManager.h"
+#include "Pegasus/Texture/BlockCompression.h"
+#include "Pegasus/Mesh/Generator/BoxGenerator.h"
+#include "Pegasus/Mesh/Operator/CombineTransformOperator.h"
+#include "Pegasus/Mesh/MeshManager.h"
+#include "Pegasus/Mesh/MeshSimplifier.h"
+#include "Pegasus/Mesh/MeshBvh.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Memory/PoolAllocator.h"
+#include "Pegasus/Math/Color.h"
+#include "Pegasus/Math/Vector.h"
+#include "Pegasus/Math/Scalar.h"
+#include "Pegasus/Core/Time.h"
+#include "Pegasus/Core/Thread.h"
+
+//! Number of nodes of the previous layer read by a texture operator
+static const unsigned int NUM_TEXTURE_OPERATOR_INPUTS = 3;
+
+//! Number of layers of mesh operators. Each operator appends the geometry of its inputs,
+//! so the mesh graph is kept shallower than the texture graph
+static const unsigned int MESH_GRAPH_DEPTH = 6;
+
+//! Number of nodes of the previous layer read by a mesh operator
+static const unsigned int NUM_MESH_OPERATOR_INPUTS = 2;
+
+//! Offsets of the nodes of the previous layer read by an operator, relative to the operator index
+static const unsigned int sInputOffsets[NUM_TEXTURE_OPERATOR_INPUTS] = { 0, 1, 7 };
+
+//! Number of operators of the chain generated with transient node data
+static const unsigned int TRANSIENT_CHAIN_LENGTH = 16;
+
+//! Resolution of the textures of the chain generated with transient node data
+static const unsigned int TRANSIENT_TEXTURE_SIZE = 256;
+
+//! Resolution of the texture generated with mip levels
+static const unsigned int MIP_TEXTURE_SIZE = 1024;
+
+//! Number of generations measured per mip filter
+static const unsigned int NUM_MIP_GENERATIONS = 8;
+
+//! Resolution of the image compressed to the block compressed formats
+static const unsigned int COMPRESSION_IMAGE_SIZE = 512;
+
+//! Number of quads on each side of the height field of the simplification benchmark (1,002,528 triangles)
+static const unsigned int SIMPLIFICATION_TERRAIN_SIZE = 708;
+
+//! Number of quads on each side of the height field of the ray casting benchmark (131,072 triangles)
+static const unsigned int RAYCAST_TERRAIN_SIZE = 256;
+
+//! Number of rays of the ray casting benchmark
+static const unsigned int RAYCAST_RAY_COUNT = 200000;
+
+//! Jobs of the compression benchmark, run by Pegasus::Core::RunParallelJobs()
+struct CompressionBenchmarkJobs
+{
+    Pegasus::Core::Format mFormat;
+    Pegasus::Texture::CompressionQuality mQuality;
+    const unsigned char * mImage;
+    unsigned char * mCompressedImage;
+};
+
+//! Compress the COMPRESSION_BLOCK_ROWS_PER_JOB block rows of a job of the compression benchmark
+static void CompressBenchmarkBlockRows(void * userData, unsigned int jobIndex, unsigned int workerIndex)
+{
+    const CompressionBenchmarkJobs & jobs = *static_cast<const CompressionBenchmarkJobs *>(userData);
+    Pegasus::Texture::CompressBlockRows(jobs.mFormat, jobs.mQuality, jobs.mImage, COMPRESSION_IMAGE_SIZE, COMPRESSION_IMAGE_SIZE,
+                                        jobIndex * Pegasus::Texture::COMPRESSION_BLOCK_ROWS_PER_JOB, Pegasus::Texture::COMPRESSION_BLOCK_ROWS_PER_JOB,
+                                        jobs.mCompressedImage);
+}
+
+//----------------------------------------------------------------------------------------
+
+GraphBenchmarkBlock::GraphBenchmarkBlock(Pegasus::Alloc::IAllocator * allocator, Pegasus::Core::IApplicationContext* appContext)
+:   Pegasus::Timeline::Block(allocator, appContext)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+GraphBenchmarkBlock::~GraphBenchmarkBlock()
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphBenchmarkBlock::Initialize()
+{
+    CreateTextureGraph();
+    CreateMeshGraph();
+    RunBenchmark();
+    RunInterningBenchmark();
+    RunTransientBenchmark();
+    RunMipBenchmark();
+    RunCompressionBenchmark();
+    RunSimplificationBenchmark();
+    RunRaycastBenchmark();
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphBenchmarkBlock::Shutdown()
+{
+    ReleaseGraphs();
+
+    // Release the shared data of the graphs as well
+    GetTextureManager()->GetDataInterner().Purge();
+    GetMeshManager()->GetDataInterner().Purge();
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphBenchmarkBlock::ReleaseGraphs()
+{
+    for (unsigned int i = 0; i < GRAPH_WIDTH; ++i)
+    {
+        mTextures[i] = nullptr;
+        mTextureGenerators[i] = nullptr;
+        mMeshes[i] = nullptr;
+        mMeshGenerators[i] = nullptr;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphBenchmarkBlock::Update(const Pegasus::Timeline::UpdateInfo& updateInfo)
+{
+    Block::Update(updateInfo);
+
+    // Nothing changes from one frame to the next, so this should not cost more than the clean frames of the benchmark
+    QueryOutputs();
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphBenchmarkBlock::CreateTextureGraph()
+{
+    using namespace Pegasus::Texture;
+    using namespace Pegasus::Math;
+
+    TextureManager* textureManager = GetTextureManager();
+    TextureConfiguration texConfig(TextureConfiguration::TYPE_2D,
+                                   Pegasus::Core::FORMAT_RGBA_8_UNORM,
+                                   16, 16, 1, 1);
+
+    TextureOperatorRef layers[2][GRAPH_WIDTH];
+    for (unsigned int i = 0; i < GRAPH_WIDTH; ++i)
+    {
+        mTextureGenerators[i] = textureManager->CreateTextureGeneratorNode("ConstantColorGenerator", texConfig);
+        ConstantColorGenerator * generator = static_cast<ConstantColorGenerator *>(mTextureGenerators[i]);
+        generator->SetColor(Color8RGBA(static_cast<unsigned char>(i), 0, 0, 255));
+    }
+
+    // Each layer reads the previous one, the first layer reads the generators
+    for (unsigned int layer = 0; layer < GRAPH_DEPTH; ++layer)
+    {
+        TextureOperatorRef * currentLayer = layers[layer & 1];
+        const TextureOperatorRef * previousLayer = layers[(layer & 1) ^ 1];
+        for (unsigned int i = 0; i < GRAPH_WIDTH; ++i)
+        {
+            currentLayer[i] = textureManager->CreateTextureOperatorNode("AddOperator", texConfig);
+            AddOperator * addOperator = static_cast<AddOperator *>(currentLayer[i]);
+            addOperator->SetClamp(true);
+            for (unsigned int input = 0; input < NUM_TEXTURE_OPERATOR_INPUTS; ++input)
+            {
+                const unsigned int inputIndex = (i + sInputOffsets[input]) % GRAPH_WIDTH;
+                if (layer == 0)
+                {
+                    currentLayer[i]->AddGeneratorInput(mTextureGenerators[inputIndex]);
+                }
+                else
+                {
+                    currentLayer[i]->AddOperatorInput(previousLayer[inputIndex]);
+                }
+            }
+        }
+    }
+
+    const TextureOperatorRef * lastLayer = layers[(GRAPH_DEPTH - 1) & 1];
+    for (unsigned int i = 0; i < GRAPH_WIDTH; ++i)
+    {
+        mTextures[i] = textureManager->CreateTextureNode(texConfig);
+        mTextures[i]->SetOperatorInput(lastLayer[i]);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphBenchmarkBlock::CreateMeshGraph()
+{
+    using namespace Pegasus::Mesh;
+    using namespace Pegasus::Math;
+
+    MeshManager* meshManager = GetMeshManager();
+
+    MeshOperatorRef layers[2][GRAPH_WIDTH];
+    for (unsigned int i = 0; i < GRAPH_WIDTH; ++i)
+    {
+        mMeshGenerators[i] = meshManager->CreateMeshGeneratorNode("BoxGenerator");
+    }
+
+    for (unsigned int layer = 0; layer < MESH_GRAPH_DEPTH; ++layer)
+    {
+        MeshOperatorRef * currentLayer = layers[layer & 1];
+        const MeshOperatorRef * previousLayer = layers[(layer & 1) ^ 1];
+        for (unsigned int i = 0; i < GRAPH_WIDTH; ++i)
+        {
+            currentLayer[i] = meshManager->CreateMeshOperatorNode("CombineTransformOperator");
+            CombineTransformOperator * combineOperator = static_cast<CombineTransformOperator *>(currentLayer[i]);
+            combineOperator->SetTranslation1(Vec3(1.0f, 0.0f, 0.0f));
+            for (unsigned int input = 0; input < NUM_MESH_OPERATOR_INPUTS; ++input)
+            {
+                const unsigned int inputIndex = (i + sInputOffsets[input]) % GRAPH_WIDTH;
+                if (layer == 0)
+                {
+                    currentLayer[i]->AddGeneratorInput(mMeshGenerators[inputIndex]);
+                }
+                else
+                {
+                    currentLayer[i]->AddOperatorInput(previousLayer[inputIndex]);
+                }
+            }
+        }
+    }
+
+    const MeshOperatorRef * lastLayer = layers[(MESH_GRAPH_DEPTH - 1) & 1];
+    for (unsigned int i = 0; i < GRAPH_WIDTH; ++i)
+    {
+        mMeshes[i] = meshManager->CreateMeshNode();
+        mMeshes[i]->SetOperatorInput(lastLayer[i]);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool GraphBenchmarkBlock::QueryOutputs()
+{
+    bool updated = false;
+    for (unsigned int i = 0; i < GRAPH_WIDTH; ++i)
+    {
+        if (mTextures[i] != nullptr)
+        {
+            mTextures[i]->Update();
+            (void) mTextures[i]->GetUpdatedData(updated);
+        }
+        if (mMeshes[i] != nullptr)
+        {
+            mMeshes[i]->Update();
+            (void) mMeshes[i]->GetUpdatedData(updated);
+        }
+    }
+    return updated;
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphBenchmarkBlock::RunBenchmark()
+{
+    using namespace Pegasus::Math;
+
+    const double tickToMs = Pegasus::Core::GetPerformanceCounterPeriod() * 1000.0;
+
+    // First query, every node is generated
+    unsigned long long startTick = Pegasus::Core::GetPerformanceCounter();
+    QueryOutputs();
+    const double firstMs = static_cast<double>(Pegasus::Core::GetPerformanceCounter() - startTick) * tickToMs;
+
+    // Nothing changes, the query should not depend on the size of the graphs
+    startTick = Pegasus::Core::GetPerformanceCounter();
+    unsigned int numUpdatedFrames = 0;
+    for (unsigned int frame = 0; frame < NUM_BENCHMARK_FRAMES; ++frame)
+    {
+        numUpdatedFrames += QueryOutputs() ? 1 : 0;
+    }
+    const double cleanMs = static_cast<double>(Pegasus::Core::GetPerformanceCounter() - startTick) * tickToMs;
+    PG_ASSERTSTR(numUpdatedFrames == 0, "No node data should be regenerated when the graphs do not change");
+
+    // One generator changes per frame, only the nodes depending on it are regenerated.
+    // The propagation of the dirty flags is measured separately from the regeneration
+    double propagationMs = 0.0;
+    startTick = Pegasus::Core::GetPerformanceCounter();
+    for (unsigned int frame = 0; frame < NUM_BENCHMARK_FRAMES; ++frame)
+    {
+        const unsigned int generatorIndex = frame % GRAPH_WIDTH;
+        const unsigned long long propagationStartTick = Pegasus::Core::GetPerformanceCounter();
+        Pegasus::Texture::ConstantColorGenerator * textureGenerator = static_cast<Pegasus::Texture::ConstantColorGenerator *>(mTextureGenerators[generatorIndex]);
+        textureGenerator->SetColor(Color8RGBA(static_cast<unsigned char>(frame), 0, 0, 255));
+        Pegasus::Mesh::BoxGenerator * meshGenerator = static_cast<Pegasus::Mesh::BoxGenerator *>(mMeshGenerators[generatorIndex]);
+        meshGenerator->SetCubeExtends(Vec3(1.0f + static_cast<float>(frame & 1), 1.0f, 1.0f));
+        propagationMs += static_cast<double>(Pegasus::Core::GetPerformanceCounter() - propagationStartTick) * tickToMs;
+
+        QueryOutputs();
+    }
+    const double editMs = static_cast<double>(Pegasus::Core::GetPerformanceCounter() - startTick) * tickToMs;
+
+    PG_LOG('APPL', "Graph benchmark: %u texture nodes (%u layers), %u mesh nodes (%u layers), %u outputs each",
+           GRAPH_WIDTH * (GRAPH_DEPTH + 2), GRAPH_DEPTH, GRAPH_WIDTH * (MESH_GRAPH_DEPTH + 2), MESH_GRAPH_DEPTH, GRAPH_WIDTH);
+    PG_LOG('APPL', "  First generation: %.3f ms", firstMs);
+    PG_LOG('APPL', "  Clean frame: %.4f ms", cleanMs / NUM_BENCHMARK_FRAMES);
+    PG_LOG('APPL', "  One generator changed per frame: %.4f ms, including %.4f ms of dirty propagation",
+           editMs / NUM_BENCHMARK_FRAMES, propagationMs / NUM_BENCHMARK_FRAMES);
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphBenchmarkBlock::RunInterningBenchmark()
+{
+    Pegasus::Graph::NodeDataInterner & textureInterner = GetTextureManager()->GetDataInterner();
+    Pegasus::Graph::NodeDataInterner & meshInterner = GetMeshManager()->GetDataInterner();
+    const bool textureInterningEnabled = textureInterner.IsEnabled();
+    const bool meshInterningEnabled = meshInterner.IsEnabled();
+
+    // Every mesh generator has the same properties, so most of the mesh graph is shared,
+    // while the texture generators all have different colors
+    ReleaseGraphs();
+    textureInterner.SetEnabled(true);
+    meshInterner.SetEnabled(true);
+    CreateTextureGraph();
+    CreateMeshGraph();
+
+    const double tickToMs = Pegasus::Core::GetPerformanceCounterPeriod() * 1000.0;
+    const unsigned long long startTick = Pegasus::Core::GetPerformanceCounter();
+    QueryOutputs();
+    const double firstMs = static_cast<double>(Pegasus::Core::GetPerformanceCounter() - startTick) * tickToMs;
+
+    PG_LOG('APPL', "Graph benchmark with shared node data: first generation %.3f ms", firstMs);
+    textureInterner.LogStatistics('APPL', "Texture");
+    meshInterner.LogStatistics('APPL', "Mesh");
+
+    // The nodes keep their shared data, only new generations are affected
+    textureInterner.SetEnabled(textureInterningEnabled);
+    meshInterner.SetEnabled(meshInterningEnabled);
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphBenchmarkBlock::RunTransientBenchmark()
+{
+    using namespace Pegasus::Texture;
+
+    TextureManager* textureManager = GetTextureManager();
+    Pegasus::Memory::PoolAllocator* pool = Pegasus::Memory::GetTransientNodeDataAllocator();
+    const bool transientNodeData = textureManager->IsTransientNodeData();
+    const double tickToMs = Pegasus::Core::GetPerformanceCounterPeriod() * 1000.0;
+    TextureConfiguration texConfig(TextureConfiguration::TYPE_2D,
+                                   Pegasus::Core::FORMAT_RGBA_8_UNORM,
+                                   TRANSIENT_TEXTURE_SIZE, TRANSIENT_TEXTURE_SIZE, 1, 1);
+
+    // Scenario 0 keeps the data of every node, scenario 1 makes it transient
+    unsigned long long peakBytes[2] = { 0, 0 };
+    double firstMs[2] = { 0.0, 0.0 };
+    unsigned int numReleased = 0;
+    for (unsigned int transient = 0; transient < 2; ++transient)
+    {
+        textureManager->SetTransientNodeData(transient != 0);
+        pool->Trim();
+        pool->ResetPeaks();
+
+        // Every operator adds the generator to the result of the previous operator
+        TextureGeneratorRef generator = textureManager->CreateTextureGeneratorNode("ConstantColorGenerator", texConfig);
+        static_cast<ConstantColorGenerator *>(generator)->SetColor(Pegasus::Math::Color8RGBA(1, 2, 3, 4));
+        TextureOperatorRef chain[TRANSIENT_CHAIN_LENGTH];
+        for (unsigned int op = 0; op < TRANSIENT_CHAIN_LENGTH; ++op)
+        {
+            chain[op] = textureManager->CreateTextureOperatorNode("AddOperator", texConfig);
+            chain[op]->AddGeneratorInput(generator);
+            if (op == 0)
+            {
+                chain[op]->AddGeneratorInput(generator);
+            }
+            else
+            {
+                chain[op]->AddOperatorInput(chain[op - 1]);
+            }
+        }
+        TextureRef texture = textureManager->CreateTextureNode(texConfig);
+        texture->SetOperatorInput(chain[TRANSIENT_CHAIN_LENGTH - 1]);
+
+        const unsigned long long startTick = Pegasus::Core::GetPerformanceCounter();
+        bool updated = false;
+        texture->Update();
+        (void) texture->GetUpdatedData(updated);
+        firstMs[transient] = static_cast<double>(Pegasus::Core::GetPerformanceCounter() - startTick) * tickToMs;
+
+        if (transient != 0)
+        {
+            // Includes the buffers of the node data objects and the rounding to the size classes
+            peakBytes[transient] = pool->GetStats().mPeakReservedBytes;
+            for (unsigned int op = 0; op < TRANSIENT_CHAIN_LENGTH; ++op)
+            {
+                numReleased += (chain[op]->GetData() == nullptr) ? 1 : 0;
+            }
+        }
+        else
+        {
+            // Nothing is released, so the peak is reached at the end of the generation
+            peakBytes[transient] = generator->GetData()->GetMemorySize();
+            for (unsigned int op = 0; op < TRANSIENT_CHAIN_LENGTH; ++op)
+            {
+                peakBytes[transient] += chain[op]->GetData()->GetMemorySize();
+            }
+        }
+    }
+    textureManager->SetTransientNodeData(transientNodeData);
+    pool->Trim();
+
+    PG_LOG('APPL', "Graph benchmark with transient node data: chain of %u operators on %ux%u textures",
+           TRANSIENT_CHAIN_LENGTH, TRANSIENT_TEXTURE_SIZE, TRANSIENT_TEXTURE_SIZE);
+    PG_LOG('APPL', "  Kept data: peak %.1f KB, first generation %.3f ms",
+           static_cast<double>(peakBytes[0]) / 1024.0, firstMs[0]);
+    PG_LOG('APPL', "  Transient data: peak %.1f KB, first generation %.3f ms, %u of %u operator data released",
+           static_cast<double>(peakBytes[1]) / 1024.0, firstMs[1], numReleased, TRANSIENT_CHAIN_LENGTH);
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphBenchmarkBlock::RunMipBenchmark()
+{
+    using namespace Pegasus::Texture;
+
+    // Mip configurations of the benchmark
+    struct MipScenario
+    {
+        const char * mName;
+        Pegasus::Core::Format mPixelFormat;
+        unsigned int mNumMipLevels;
+        TextureConfiguration::MipFilter mMipFilter;
+    };
+    static const MipScenario sScenarios[] =
+    {
+        { "No mip levels", Pegasus::Core::FORMAT_RGBA_8_UNORM,      1, TextureConfiguration::MIPFILTER_BOX    },
+        { "Box",           Pegasus::Core::FORMAT_RGBA_8_UNORM,      0, TextureConfiguration::MIPFILTER_BOX    },
+        { "Box sRGB",      Pegasus::Core::FORMAT_RGBA_8_UNORM_SRGB, 0, TextureConfiguration::MIPFILTER_BOX    },
+        { "Kaiser",        Pegasus::Core::FORMAT_RGBA_8_UNORM,      0, TextureConfiguration::MIPFILTER_KAISER },
+        { "Kaiser sRGB",   Pegasus::Core::FORMAT_RGBA_8_UNORM_SRGB, 0, TextureConfiguration::MIPFILTER_KAISER },
+    };
+    const unsigned int numScenarios = sizeof(sScenarios) / sizeof(sScenarios[0]);
+
+    TextureManager* textureManager = GetTextureManager();
+    const double tickToMs = Pegasus::Core::GetPerformanceCounterPeriod() * 1000.0;
+    const double levelZeroMB = static_cast<double>(MIP_TEXTURE_SIZE * MIP_TEXTURE_SIZE * 4) / (1024.0 * 1024.0);
+
+    PG_LOG('APPL', "Graph benchmark with mip levels: %ux%u texture, %u generations per filter",
+           MIP_TEXTURE_SIZE, MIP_TEXTURE_SIZE, NUM_MIP_GENERATIONS);
+    for (unsigned int s = 0; s < numScenarios; ++s)
+    {
+        const MipScenario & scenario = sScenarios[s];
+        TextureConfiguration texConfig(TextureConfiguration::TYPE_2D, scenario.mPixelFormat,
+                                       MIP_TEXTURE_SIZE, MIP_TEXTURE_SIZE, 1, 1,
+                                       scenario.mNumMipLevels, scenario.mMipFilter);
+        TextureGeneratorRef generator = textureManager->CreateTextureGeneratorNode("ConstantColorGenerator", texConfig);
+        ConstantColorGenerator * colorGenerator = static_cast<ConstantColorGenerator *>(generator);
+
+        // The first generation allocates the data, only the regenerations are measured
+        bool updated = false;
+        (void) generator->GetUpdatedData(updated);
+        const unsigned long long startTick = Pegasus::Core::GetPerformanceCounter();
+        for (unsigned int g = 0; g < NUM_MIP_GENERATIONS; ++g)
+        {
+            colorGenerator->SetColor(Pegasus::Math::Color8RGBA(static_cast<unsigned char>(g), 128, 255, 255));
+            (void) generator->GetUpdatedData(updated);
+        }
+        const double generationMs = static_cast<double>(Pegasus::Core::GetPerformanceCounter() - startTick) * tickToMs / NUM_MIP_GENERATIONS;
+
+        PG_LOG('APPL', "  %s: %u levels, %.1f KB, %.3f ms per generation, %.3f ms per MB",
+               scenario.mName, texConfig.GetNumMipLevels(), static_cast<double>(texConfig.GetNumBytes()) / 1024.0,
+               generationMs, generationMs / levelZeroMB);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphBenchmarkBlock::RunCompressionBenchmark()
+{
+    using namespace Pegasus::Texture;
+
+    // Formats of the benchmark, with the number of channels compared for the PSNR
+    struct CompressionScenario
+    {
+        const char * mName;
+        Pegasus::Core::Format mFormat;
+        unsigned int mNumChannels;
+    };
+    static const CompressionScenario sScenarios[] =
+    {
+        { "BC1", Pegasus::Core::FORMAT_BC1_UNORM, 3 },
+        { "BC3", Pegasus::Core::FORMAT_BC3_UNORM, 4 },
+        { "BC5", Pegasus::Core::FORMAT_BC5_UNORM, 2 },
+        { "BC7", Pegasus::Core::FORMAT_BC7_UNORM, 4 },
+    };
+    const unsigned int numScenarios = sizeof(sScenarios) / sizeof(sScenarios[0]);
+    static const char * sQualityNames[NUM_COMPRESSIONQUALITIES] = { "fast", "normal", "high" };
+
+    // Procedural image mixing smooth gradients, sharp stripes and noise, with an alpha ramp
+    Pegasus::Alloc::IAllocator * allocator = Pegasus::Memory::GetGlobalAllocator();
+    const unsigned int numPixels = COMPRESSION_IMAGE_SIZE * COMPRESSION_IMAGE_SIZE;
+    unsigned char * image = PG_NEW_ARRAY(allocator, -1, "Compression benchmark image", Pegasus::Alloc::PG_MEM_TEMP, unsigned char, numPixels * 4);
+    unsigned char * decodedImage = PG_NEW_ARRAY(allocator, -1, "Compression benchmark decoded image", Pegasus::Alloc::PG_MEM_TEMP, unsigned char, numPixels * 4);
+    unsigned char * compressedImage = PG_NEW_ARRAY(allocator, -1, "Compression benchmark compressed image", Pegasus::Alloc::PG_MEM_TEMP, unsigned char,
+                                                   GetCompressedImageSize(Pegasus::Core::FORMAT_BC7_UNORM, COMPRESSION_IMAGE_SIZE, COMPRESSION_IMAGE_SIZE));
+    unsigned int seed = 123456789;
+    for (unsigned int y = 0; y < COMPRESSION_IMAGE_SIZE; ++y)
+    {
+        for (unsigned int x = 0; x < COMPRESSION_IMAGE_SIZE; ++x)
+        {
+            seed = seed * 1664525 + 1013904223;
+            const float u = static_cast<float>(x) / static_cast<float>(COMPRESSION_IMAGE_SIZE);
+            const float v = static_cast<float>(y) / static_cast<float>(COMPRESSION_IMAGE_SIZE);
+            const float noise = static_cast<float>((seed >> 24) & 15);
+            const float stripes = (((x / 13) + (y / 29)) & 1) ? 64.0f : 0.0f;
+            unsigned char * pixel = image + (y * COMPRESSION_IMAGE_SIZE + x) * 4;
+            pixel[0] = static_cast<unsigned char>(Pegasus::Math::Clamp(u * 190.0f + stripes + noise, 0.0f, 255.0f));
+            pixel[1] = static_cast<unsigned char>(Pegasus::Math::Clamp(127.5f + 120.0f * Pegasus::Math::Sin(u * 9.0f + v * 5.0f) + noise, 0.0f, 255.0f));
+            pixel[2] = static_cast<unsigned char>(Pegasus::Math::Clamp(v * 230.0f + noise, 0.0f, 255.0f));
+            pixel[3] = static_cast<unsigned char>(Pegasus::Math::Clamp((u + v) * 127.5f, 0.0f, 255.0f));
+        }
+    }
+
+    const double tickToMs = Pegasus::Core::GetPerformanceCounterPeriod() * 1000.0;
+    const double imageMB = static_cast<double>(numPixels * 4) / (1024.0 * 1024.0);
+    const unsigned int numBlockRows = GetNumCompressedBlocks(COMPRESSION_IMAGE_SIZE);
+    const unsigned int numJobs = (numBlockRows + COMPRESSION_BLOCK_ROWS_PER_JOB - 1) / COMPRESSION_BLOCK_ROWS_PER_JOB;
+    const unsigned int numWorkers = Pegasus::Core::GetHardwareThreadCount();
+
+    PG_LOG('APPL', "Graph benchmark with block compression: %ux%u image, 1 and %u workers",
+           COMPRESSION_IMAGE_SIZE, COMPRESSION_IMAGE_SIZE, numWorkers);
+    CompressionBenchmarkJobs jobs;
+    jobs.mImage = image;
+    jobs.mCompressedImage = compressedImage;
+    for (unsigned int s = 0; s < numScenarios; ++s)
+    {
+        const CompressionScenario & scenario = sScenarios[s];
+        jobs.mFormat = scenario.mFormat;
+        for (unsigned int q = 0; q < NUM_COMPRESSIONQUALITIES; ++q)
+        {
+            // The same jobs on the calling thread only, then on the worker threads
+            jobs.mQuality = static_cast<CompressionQuality>(q);
+            const unsigned long long startTick = Pegasus::Core::GetPerformanceCounter();
+            Pegasus::Core::RunParallelJobs(CompressBenchmarkBlockRows, &jobs, numJobs, 1);
+            const unsigned long long serialTick = Pegasus::Core::GetPerformanceCounter();
+            Pegasus::Core::RunParallelJobs(CompressBenchmarkBlockRows, &jobs, numJobs, numWorkers);
+            const double compressionMs = static_cast<double>(serialTick - startTick) * tickToMs;
+            const double parallelCompressionMs = static_cast<double>(Pegasus::Core::GetPerformanceCounter() - serialTick) * tickToMs;
+
+            DecompressBlockRows(scenario.mFormat, compressedImage, COMPRESSION_IMAGE_SIZE, COMPRESSION_IMAGE_SIZE,
+                                0, numBlockRows, decodedImage);
+            const double psnr = ComputePSNR(image, decodedImage, numPixels, scenario.mNumChannels);
+
+            PG_LOG('APPL', "  %s %s: %.2f dB, %.3f ms, %.1f MB/s, parallel %.3f ms, %.1f MB/s",
+                   scenario.mName, sQualityNames[q], psnr, compressionMs,
+                   (compressionMs > 0.0) ? (imageMB * 1000.0 / compressionMs) : 0.0,
+                   parallelCompressionMs, (parallelCompressionMs > 0.0) ? (imageMB * 1000.0 / parallelCompressionMs) : 0.0);
+        }
+    }
+
+    PG_DELETE_ARRAY(allocator, compressedImage);
+    PG_DELETE_ARRAY(allocator, decodedImage);
+    PG_DELETE_ARRAY(allocator, image);
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphBenchmarkBlock::RunSimplificationBenchmark()
+{
+    static const float sRatios[] = { 0.5f, 0.25f, 0.1f };
+    const unsigned int numRatios = sizeof(sRatios) / sizeof(sRatios[0]);
+
+    // Smooth hills with a small noise, so every vertex has a different error
+    Pegasus::Alloc::IAllocator * allocator = Pegasus::Memory::GetGlobalAllocator();
+    const unsigned int gridSize = SIMPLIFICATION_TERRAIN_SIZE + 1;
+    const unsigned int numVertices = gridSize * gridSize;
+    const unsigned int numIndices = SIMPLIFICATION_TERRAIN_SIZE * SIMPLIFICATION_TERRAIN_SIZE * 6;
+    float * positions = PG_NEW_ARRAY(allocator, -1, "Simplification benchmark positions", Pegasus::Alloc::PG_MEM_TEMP, float, numVertices * 3);
+    unsigned int * indices = PG_NEW_ARRAY(allocator, -1, "Simplification benchmark indices", Pegasus::Alloc::PG_MEM_TEMP, unsigned int, numIndices);
+    unsigned int * outIndices = PG_NEW_ARRAY(allocator, -1, "Simplification benchmark simplified indices", Pegasus::Alloc::PG_MEM_TEMP, unsigned int, numIndices);
+    unsigned int seed = 4321;
+    for (unsigned int y = 0; y < gridSize; ++y)
+    {
+        for (unsigned int x = 0; x < gridSize; ++x)
+        {
+            seed = seed * 1664525 + 1013904223;
+            float * position = positions + (y * gridSize + x) * 3;
+            position[0] = static_cast<float>(x);
+            position[1] = static_cast<float>(y);
+            position[2] = 8.0f * Pegasus::Math::Sin(static_cast<float>(x) * 0.02f) * Pegasus::Math::Cos(static_cast<float>(y) * 0.03f)
+                        + 0.05f * (static_cast<float>((seed >> 8) & 0xFFFF) * (2.0f / 65535.0f) - 1.0f);
+        }
+    }
+    unsigned int numGridIndices = 0;
+    for (unsigned int y = 0; y < SIMPLIFICATION_TERRAIN_SIZE; ++y)
+    {
+        for (unsigned int x = 0; x < SIMPLIFICATION_TERRAIN_SIZE; ++x)
+        {
+            const unsigned int v = y * gridSize + x;
+            indices[numGridIndices++] = v;
+            indices[numGridIndices++] = v + 1;
+            indices[numGridIndices++] = v + gridSize;
+            indices[numGridIndices++] = v + 1;
+            indices[numGridIndices++] = v + gridSize + 1;
+            indices[numGridIndices++] = v + gridSize;
+        }
+    }
+
+    const double tickToMs = Pegasus::Core::GetPerformanceCounterPeriod() * 1000.0;
+
+    PG_LOG('APPL', "Graph benchmark with mesh simplification: %u triangles, %u vertices", numIndices / 3, numVertices);
+    for (unsigned int r = 0; r < numRatios; ++r)
+    {
+        const unsigned int targetNumIndices = static_cast<unsigned int>(static_cast<float>(numIndices) * sRatios[r]);
+        float error = 0.0f;
+        const unsigned long long startTick = Pegasus::Core::GetPerformanceCounter();
+        const unsigned int numOutIndices = Pegasus::Mesh::SimplifyMesh(indices, numIndices, positions, 3 * sizeof(float), numVertices,
+                                                                       targetNumIndices, 0.0f, allocator, outIndices, &error);
+        const double simplificationMs = static_cast<double>(Pegasus::Core::GetPerformanceCounter() - startTick) * tickToMs;
+
+        PG_LOG('APPL', "  %.0f%%: %u triangles (target %u), error %.4f, %.1f ms, %.2fM triangles/s",
+               sRatios[r] * 100.0f, numOutIndices / 3, targetNumIndices / 3, error, simplificationMs,
+               (simplificationMs > 0.0) ? (static_cast<double>(numIndices / 3) / (simplificationMs * 1000.0)) : 0.0);
+    }
+
+    PG_DELETE_ARRAY(allocator, outIndices);
+    PG_DELETE_ARRAY(allocator, indices);
+    PG_DELETE_ARRAY(allocator, positions);
+}
+
+//----------------------------------------------------------------------------------------
+
+void GraphBenchmarkBlock::RunRaycastBenchmark()
+{
+    using namespace Pegasus::Math;
+
+    // Triangle list without indices, the hierarchy uses 16 bits indices and the terrain has more vertices
+    Pegasus::Alloc::IAllocator * allocator = Pegasus::Memory::GetGlobalAllocator();
+    const unsigned int numTriangles = RAYCAST_TERRAIN_SIZE * RAYCAST_TERRAIN_SIZE * 2;
+    Vec3 * positions = PG_NEW_ARRAY(allocator, -1, "Raycast benchmark positions", Pegasus::Alloc::PG_MEM_TEMP, Vec3, numTriangles * 3);
+    Ray * rays = PG_NEW_ARRAY(allocator, -1, "Raycast benchmark rays", Pegasus::Alloc::PG_MEM_TEMP, Ray, RAYCAST_RAY_COUNT);
+    unsigned int numPositions = 0;
+    for (unsigned int y = 0; y < RAYCAST_TERRAIN_SIZE; ++y)
+    {
+        for (unsigned int x = 0; x < RAYCAST_TERRAIN_SIZE; ++x)
+        {
+            Vec3 corners[4];
+            for (unsigned int c = 0; c < 4; ++c)
+            {
+                const float cornerX = static_cast<float>(x + (c & 1));
+                const float cornerY = static_cast<float>(y + (c >> 1));
+                corners[c] = Vec3(cornerX, cornerY, 8.0f * Sin(cornerX * 0.05f) * Cos(cornerY * 0.07f) + 0.5f * Sin(cornerX * cornerY));
+            }
+            positions[numPositions++] = corners[0];
+            positions[numPositions++] = corners[1];
+            positions[numPositions++] = corners[2];
+            positions[numPositions++] = corners[1];
+            positions[numPositions++] = corners[3];
+            positions[numPositions++] = corners[2];
+        }
+    }
+
+    // Every ray goes from above to below the terrain, within its bounds, so it hits the terrain
+    const float terrainSize = static_cast<float>(RAYCAST_TERRAIN_SIZE);
+    unsigned int seed = 7531;
+    for (unsigned int r = 0; r < RAYCAST_RAY_COUNT; ++r)
+    {
+        float coords[4];
+        for (unsigned int c = 0; c < 4; ++c)
+        {
+            seed = seed * 1664525 + 1013904223;
+            coords[c] = static_cast<float>((seed >> 8) & 0xFFFF) * (terrainSize / 65535.0f);
+        }
+        rays[r].SetFromPoints(Vec3(coords[0], coords[1], 20.0f), Vec3(coords[2], coords[3], -20.0f));
+    }
+
+    const double tickToMs = Pegasus::Core::GetPerformanceCounterPeriod() * 1000.0;
+    Pegasus::Mesh::MeshBvh bvh(allocator);
+    const unsigned long long startTick = Pegasus::Core::GetPerformanceCounter();
+    bvh.Build(positions, numTriangles * 3, nullptr, numTriangles);
+    const unsigned long long buildTick = Pegasus::Core::GetPerformanceCounter();
+    unsigned int numHits = 0;
+    for (unsigned int r = 0; r < RAYCAST_RAY_COUNT; ++r)
+    {
+        Pegasus::Mesh::MeshRayHit hit;
+        numHits += bvh.Raycast(rays[r], 1.0e30f, hit) ? 1 : 0;
+    }
+    const double buildMs = static_cast<double>(buildTick - startTick) * tickToMs;
+    const double raycastMs = static_cast<double>(Pegasus::Core::GetPerformanceCounter() - buildTick) * tickToMs;
+    PG_ASSERTSTR(numHits == RAYCAST_RAY_COUNT, "Every ray of the benchmark should hit the terrain");
+
+    PG_LOG('APPL', "Graph benchmark with ray casting: %u triangles, hierarchy of %u nodes (%.1f KB) built in %.1f ms",
+           numTriangles, bvh.GetNodeCount(), static_cast<double>(bvh.GetMemorySize()) / 1024.0, buildMs);
+    PG_LOG('APPL', "  %u rays in %.1f ms, %.2fM rays/s, %u hits",
+           RAYCAST_RAY_COUNT, raycastMs, (raycastMs > 0.0) ? (static_cast<double>(RAYCAST_RAY_COUNT) / (raycastMs * 1000.0)) : 0.0, numHits);
+
+    PG_DELETE_ARRAY(allocator, rays);
+    PG_DELETE_ARRAY(allocator, positions);
+}
@@ -31,6 +31,9 @@
 // Since we know where the launcher launches from, hard-code the asset root
 static const char* ASSET_ROOT = ".";
 
+// Compiled scripts are cached apart from the assets
+static const char* CACHE_ROOT = ".\\Cache";
+
 
 #if PEGASUS_ENABLE_LOG
 
@@ -282,6 +285,7 @@ int APIENTRY WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance,
     // Set up the app config
     appConfig.mModuleHandle = (Pegasus::Os::ModuleHandle) hInstance;
     appConfig.mBasePath = ASSET_ROOT;
+    appConfig.mCachePath = CACHE_ROOT;
     // Attach the debugging features
 #if PEGASUS_ENABLE_LOG
     appConfig.mLoghandler = LogHandler;
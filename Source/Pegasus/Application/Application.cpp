@@ -19,8 +19,12 @@
 #include "Pegasus/Application/AppWindowComponentFactory.h"
 #include "Pegasus/Application/Components/EditorComponents.h"
 #include "Pegasus/Core/Time.h"
+#include "Pegasus/Core/Profiler.h"
+#include "Pegasus/Core/Thread.h"
 #include "Pegasus/Graph/NodeManager.h"
 #include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Memory/FrameAllocator.h"
+#include "Pegasus/Utils/ByteStream.h"
 #include "Pegasus/Render/IDevice.h"
 #include "Pegasus/Render/ShaderFactory.h"
 #include "Pegasus/Render/TextureFactory.h"
@@ -89,6 +93,9 @@ Application::Application(const ApplicationConfig& config)
 
     // Set up the time system
     Core::InitializePegasusTime();
+#if PEGASUS_ENABLE_PROFILER
+    Core::InitializeProfiler(coreAlloc);
+#endif
 
 
     // Set up window manager
@@ -148,6 +155,12 @@ Application::Application(const ApplicationConfig& config)
     char rootPath[Io::IOManager::MAX_FILEPATH_LENGTH];
     sprintf_s(rootPath, Io::IOManager::MAX_FILEPATH_LENGTH - 1, "%s\\Imported\\", mConfig.mBasePath); // Hardcode imported for now
     mIoManager = PG_NEW(coreAlloc, -1, "IOManager", Pegasus::Alloc::PG_MEM_PERM) Io::IOManager(rootPath);
+    if (mConfig.mCachePath != nullptr)
+    {
+        char cachePath[Io::IOManager::MAX_FILEPATH_LENGTH];
+        sprintf_s(cachePath, Io::IOManager::MAX_FILEPATH_LENGTH - 1, "%s\\", mConfig.mCachePath);
+        mIoManager->SetCacheRoot(cachePath);
+    }
     
     mAssetLib->SetIoManager(mIoManager); //TODO: decide here if we use the pakIoManager or the standard file system IOManager
     
@@ -188,8 +201,24 @@ Application::~Application()
 #if PEGASUS_ENABLE_BS_REFLECTION_INFO
     PG_DELETE(nodeAlloc, mBsReflectionInfo);
 #endif
+
+#if PEGASUS_ENABLE_MEMORY_TRACKING
+    // Memory report of what is left once the managers are gone, readable from headless runs
+    Memory::LogMemoryReport();
+    {
+        Utils::ByteStream reportStream(Memory::GetGlobalAllocator());
+        Memory::WriteMemoryReportJson(reportStream);
+        Io::FileBuffer reportBuffer;
+        reportBuffer.OwnBuffer(Memory::GetGlobalAllocator(), static_cast<char*>(reportStream.GetBuffer()), reportStream.GetSize());
+        mIoManager->SaveFileToBuffer("MemoryReport.json", reportBuffer);
+        reportBuffer.ForgetBuffer();
+    }
+#endif
+
     PG_DELETE(coreAlloc, mIoManager);
     
+    PG_LOG('APPL', "Frame allocator high-water mark: %u KB", static_cast<unsigned int>(Memory::FrameAllocator::GetGlobalHighWaterMark() / 1024));
+
     //Kill device and context
     PG_DELETE(renderAlloc, mRenderContext);
     mRenderContext = nullptr;
@@ -197,6 +226,17 @@ Application::~Application()
     mDevice = nullptr;
     PG_LOG('APPL', "Device Destroyed");
 
+    Core::ShutdownParallelJobs();
+
+#if PEGASUS_ENABLE_PROFILER
+    Core::ShutdownProfiler();
+#endif
+
+#if PEGASUS_ENABLE_MEMORY_TRACKING
+    // Only the log and assertion managers are expected to be alive at this point
+    Memory::LogMemoryLeaks();
+#endif
+
     // Tear down debugging facilities
 #if PEGASUS_ENABLE_ASSERT
     Core::AssertionManager::GetInstance()->UnregisterHandler();
@@ -260,6 +300,14 @@ void Application::Load()
 
 void Application::Update()
 {
+    // Start a new frame for the transient allocations. Memory of two frames ago gets recycled.
+    Memory::FrameAllocator::AdvanceFrame();
+
+#if PEGASUS_ENABLE_PROFILER
+    // Close the profiler scope of the previous frame and update the rolling summary
+    Core::BeginProfileFrame();
+#endif
+
     // Needed for compute/etc
     mRenderContext->Bind();
 
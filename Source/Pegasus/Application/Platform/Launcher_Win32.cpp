@@ -20,6 +20,9 @@
 // Since this is REL mode only, hard-code the asset root
 static const char* ASSET_ROOT = ".";
 
+// Compiled scripts are cached apart from the assets
+static const char* CACHE_ROOT = ".\\Cache";
+
 // Typedefs for DLL entry point
 extern Pegasus::App::Application* CreateApplication(const Pegasus::App::ApplicationConfig& config);
 extern void DestroyApplication(Pegasus::App::Application* app);
@@ -210,6 +213,7 @@ int APIENTRY WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance,
     // Set up the app config
     appConfig.mModuleHandle = (Pegasus::Os::ModuleHandle) hInstance;
     appConfig.mBasePath = ASSET_ROOT;
+    appConfig.mCachePath = CACHE_ROOT;
 #if PEGASUS_ENABLE_LOG
     appConfig.mLoghandler = LogHandler; // Attach the debugging features
 #endif
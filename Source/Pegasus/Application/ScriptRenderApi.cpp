@@ -21,6 +21,7 @@
 #include "Pegasus/BlockScript/BlockLib.h"
 #include "Pegasus/BlockScript/FunDesc.h"
 #include "Pegasus/BlockScript/FunCallback.h"
+#include "Pegasus/BlockScript/FunBinding.h"
 #include "Pegasus/BlockScript/SymbolTable.h"
 #include "Pegasus/BlockScript/IddStrPool.h"
 #include "Pegasus/BlockScript/BLockScriptAst.h"
@@ -46,6 +47,39 @@ using namespace Pegasus::Application;
 using namespace Pegasus::BlockScript::Ast;
 using namespace Pegasus::Math;
 
+//! Script types of the resource handles
+#define RES_PROCESS(resourceType, memberName, typeName, hasProperties, canUpdate) \
+    BS_BINDING_TYPE(Pegasus::BlockScript::ObjectHandle<resourceType>, typeName)
+#include "..\Source\Pegasus\Application\RenderResources.inl"
+#undef RES_PROCESS
+
+//! Script types of the render structures and enumerations passed by value
+BS_BINDING_TYPE(Pegasus::Render::Uniform,                           "Uniform")
+BS_BINDING_TYPE(Pegasus::Render::Viewport,                          "Viewport")
+BS_BINDING_TYPE(Pegasus::Render::RenderTargetConfig,                "RenderTargetConfig")
+BS_BINDING_TYPE(Pegasus::Render::DepthStencilConfig,                "DepthStencilConfig")
+BS_BINDING_TYPE(Pegasus::Render::RasterizerConfig,                  "RasterizerConfig")
+BS_BINDING_TYPE(Pegasus::Render::BlendingConfig,                    "BlendingConfig")
+BS_BINDING_TYPE(Pegasus::Render::SamplerStateConfig,                "SamplerStateConfig")
+BS_BINDING_TYPE(Pegasus::Render::PrimitiveMode,                     "PrimitiveMode")
+BS_BINDING_TYPE(Pegasus::Render::RasterizerConfig::PegasusCullMode,   "PegasusCullMode")
+BS_BINDING_TYPE(Pegasus::Render::RasterizerConfig::PegasusRasterFunc, "PegasusRasterFunc")
+
+typedef ObjectHandle<Shader::ProgramLinkage>     ProgramLinkageHandle;
+typedef ObjectHandle<Shader::ShaderStage>        ShaderStageHandle;
+typedef ObjectHandle<Texture::Texture>           TextureHandle;
+typedef ObjectHandle<Texture::TextureGenerator>  TextureGeneratorHandle;
+typedef ObjectHandle<Texture::TextureOperator>   TextureOperatorHandle;
+typedef ObjectHandle<Mesh::Mesh>                 MeshHandle;
+typedef ObjectHandle<Mesh::MeshGenerator>        MeshGeneratorHandle;
+typedef ObjectHandle<Mesh::MeshOperator>         MeshOperatorHandle;
+typedef ObjectHandle<Render::Buffer>             BufferHandle;
+typedef ObjectHandle<Render::RenderTarget>       RenderTargetHandle;
+typedef ObjectHandle<Render::DepthStencil>       DepthStencilHandle;
+typedef ObjectHandle<Render::RasterizerState>    RasterizerStateHandle;
+typedef ObjectHandle<Render::BlendingState>      BlendingStateHandle;
+typedef ObjectHandle<Render::SamplerState>       SamplerStateHandle;
+
 //global type, used for dynamic type checking
 static void RegisterTypes        (BlockLib* lib, Core::IApplicationContext* context);
 static void RegisterFunctions    (BlockLib* lib);
@@ -57,89 +91,97 @@ static void RegisterFunctions    (BlockLib* lib);
 static Application::RenderCollection* GetContainer(BsVmState* state);
 
 ////Program Methods//////////////////////////////////////////
-void Program_SetShaderStage(FunCallbackContext& context);
+int Program_SetShaderStage(BsVmState* state, ProgramLinkageHandle programId, ShaderStageHandle stageId);
 
 ////Mesh Methods/////////////////////////////////////////////
-void MeshOperator_AddOperatorInput(FunCallbackContext& context);
-void MeshOperator_AddGeneratorInput(FunCallbackContext& context);
-void Mesh_SetGeneratorInput(FunCallbackContext& context);
-void Mesh_SetOperatorInput(FunCallbackContext& context);
+void MeshOperator_AddOperatorInput(BsVmState* state, MeshOperatorHandle meshOpHandle, MeshOperatorHandle opToAddHandle);
+void MeshOperator_AddGeneratorInput(BsVmState* state, MeshOperatorHandle meshOpHandle, MeshGeneratorHandle genToAddHandle);
+void Mesh_SetGeneratorInput(BsVmState* state, MeshHandle meshHandle, MeshGeneratorHandle genHandle);
+void Mesh_SetOperatorInput(BsVmState* state, MeshHandle meshHandle, MeshOperatorHandle opHandle);
 
 /////Texture Methods/////////////////////////////////////////
-void TextureOperator_AddOperatorInput(FunCallbackContext& context);
-void TextureOperator_AddGeneratorInput(FunCallbackContext& context);
-void Texture_SetGeneratorInput(FunCallbackContext& context);
-void Texture_SetOperatorInput(FunCallbackContext& context);
+void TextureOperator_AddOperatorInput(TextureOperatorHandle texOpHandle, TextureOperatorHandle opToAddHandle);
+void TextureOperator_AddGeneratorInput(TextureOperatorHandle texOpHandle, TextureGeneratorHandle genToAddHandle);
+void Texture_SetGeneratorInput(TextureHandle texHandle, TextureGeneratorHandle genHandle);
+void Texture_SetOperatorInput(TextureHandle texHandle, TextureOperatorHandle opHandle);
 
 /////Node Manager Methods////////////////////////////////////
-void Node_LoadProgram(FunCallbackContext& context);
-void Node_CreateTexture(FunCallbackContext& context);
-void Node_CreateTextureGenerator(FunCallbackContext& context);
-void Node_CreateTextureOperator(FunCallbackContext& context);
-void Node_CreateMesh(FunCallbackContext& context);
-void Node_CreateMeshGenerator(FunCallbackContext& context);
-void Node_CreateMeshOperator(FunCallbackContext& context);
+ProgramLinkageHandle Node_LoadProgram(BsVmState* state, const char* path);
+TextureHandle Node_CreateTexture(BsVmState* state);
+TextureGeneratorHandle Node_CreateTextureGenerator(BsVmState* state, const char* name);
+TextureOperatorHandle Node_CreateTextureOperator(BsVmState* state, const char* name);
+MeshHandle Node_CreateMesh(BsVmState* state);
+MeshGeneratorHandle Node_CreateMeshGenerator(BsVmState* state, const char* name);
+MeshOperatorHandle Node_CreateMeshOperator(BsVmState* state, const char* name);
 
 /////Render API Functions////////////////////////////////////
-void Render_CreateUniformBuffer(FunCallbackContext& context);
-void Render_SetBuffer(FunCallbackContext& context);
+BufferHandle Render_CreateUniformBuffer(BsVmState* state, int bufferSize);
+void Render_SetBuffer(BsVmState* state, BufferHandle handle, void* sourceBuffer);
 void Render_GetUniformLocation(FunCallbackContext& context);
-void Render_SetUniformBuffer(FunCallbackContext& context);
-void Render_SetUniformBufferResource(FunCallbackContext& context);
-void Render_SetUniformTexture(FunCallbackContext& context);
-void Render_SetUniformTextureRenderTarget(FunCallbackContext& context);
-void Render_SetUniformStencil(FunCallbackContext& context);
-void Render_SetUniformDepth(FunCallbackContext& context);
-void Render_SetProgram(FunCallbackContext& context);
-void Render_SetMesh(FunCallbackContext& context);
-void Render_UnbindMesh(FunCallbackContext& context);
-void Render_UnbindComputeOutputs(FunCallbackContext& context);
-void Render_UnbindRenderTargets(FunCallbackContext& context);
-void Render_UnbindComputeResources(FunCallbackContext& context);
-void Render_UnbindPixelResources(FunCallbackContext& context);
-void Render_UnbindVertexResources(FunCallbackContext& context);
-void Render_SetViewport(FunCallbackContext& context);
-void Render_SetViewport2(FunCallbackContext& context);
-void Render_SetViewport3(FunCallbackContext& context);
-void Render_SetRenderTarget(FunCallbackContext& context);
-void Render_SetRenderTarget2(FunCallbackContext& context);
-void Render_SetRenderTargets(FunCallbackContext& context);
-void Render_SetRenderTargets2(FunCallbackContext& context);
-void Render_SetDefaultRenderTarget(FunCallbackContext& context);
-void Render_SetPrimitiveMode(FunCallbackContext& context);
-void Render_Clear(FunCallbackContext& context);
-void Render_SetClearColorValue(FunCallbackContext& context);
-void Render_SetRasterizerState(FunCallbackContext& context);
-void Render_SetBlendingState(FunCallbackContext& context);
-void Render_SetComputeSampler(FunCallbackContext& context);
-void Render_SetPixelSampler(FunCallbackContext& context);
-void Render_SetVertexSampler(FunCallbackContext& context);
-void Render_SetDepthClearValue(FunCallbackContext& context);
-void Render_Draw(FunCallbackContext& context);
-void Render_Dispatch(FunCallbackContext& context);
-void Render_CreateRenderTarget(FunCallbackContext& context);
-void Render_CreateDepthStencil(FunCallbackContext& context);
-void Render_CreateRasterizerState(FunCallbackContext& context);
-void Render_CreateBlendingState(FunCallbackContext& context);
-void Render_CreateSamplerState(FunCallbackContext& context);
-void Render_BeginMarker(FunCallbackContext& context);
-void Render_EndMarker(FunCallbackContext& context);
-void Render_CreateSimpleRasterConfig(FunCallbackContext& context);
+void Render_SetUniformBuffer(BsVmState* state, Render::Uniform& uniform, BufferHandle bufferHandle);
+void Render_SetUniformBufferResource(BsVmState* state, Render::Uniform& uniform, BufferHandle bufferHandle);
+void Render_SetUniformTexture(BsVmState* state, Render::Uniform& uniform, TextureHandle texHandle);
+void Render_SetUniformTextureRenderTarget(BsVmState* state, Render::Uniform& uniform, RenderTargetHandle renderTargetId);
+void Render_SetUniformStencil(BsVmState* state, Render::Uniform& uniform, DepthStencilHandle renderTargetId);
+void Render_SetUniformDepth(BsVmState* state, Render::Uniform& uniform, DepthStencilHandle renderTargetId);
+void Render_SetProgram(BsVmState* state, ProgramLinkageHandle programId);
+void Render_SetMesh(BsVmState* state, MeshHandle meshId);
+void Render_SetMeshLod(BsVmState* state, int lod);
+int Render_SelectMeshLod(BsVmState* state, MeshHandle meshId, float distance, float projectionScale, float maxPixelError);
+Math::Vec4 Render_GetMeshPositionOffset(BsVmState* state, MeshHandle meshId);
+Math::Vec4 Render_GetMeshPositionScale(BsVmState* state, MeshHandle meshId);
+Math::Vec4 Render_GetMeshBoundingSphere(BsVmState* state, MeshHandle meshId);
+Math::Vec4 Render_RaycastMesh(BsVmState* state, MeshHandle meshId, const Math::Vec3& origin, Math::Vec3 direction, float maxDistance);
+void Render_UnbindMesh();
+void Render_UnbindComputeOutputs();
+void Render_UnbindRenderTargets();
+void Render_UnbindComputeResources();
+void Render_UnbindPixelResources();
+void Render_UnbindVertexResources();
+void Render_SetViewport(BsVmState* state, const Render::Viewport& viewport);
+void Render_SetViewport2(BsVmState* state, RenderTargetHandle handle);
+void Render_SetViewport3(DepthStencilHandle handle);
+void Render_SetRenderTarget(BsVmState* state, RenderTargetHandle rtHandle);
+void Render_SetRenderTarget2(BsVmState* state, RenderTargetHandle rtHandle, DepthStencilHandle dtHandle);
+void Render_SetRenderTargets(BsVmState* state, int targetCounts, void* targets, DepthStencilHandle depthHandle);
+void Render_SetRenderTargets2(int targetCounts, void* targets);
+void Render_SetDefaultRenderTarget(BsVmState* state);
+void Render_SetPrimitiveMode(BsVmState* state, Render::PrimitiveMode mode);
+void Render_Clear(BsVmState* state, int color, int depth, int stencil);
+void Render_SetClearColorValue(BsVmState* state, const Math::ColorRGBA& color);
+void Render_SetRasterizerState(BsVmState* state, RasterizerStateHandle handle);
+void Render_SetBlendingState(BsVmState* state, BlendingStateHandle handle);
+void Render_SetComputeSampler(BsVmState* state, SamplerStateHandle handle, int slot);
+void Render_SetPixelSampler(BsVmState* state, SamplerStateHandle handle, int slot);
+void Render_SetVertexSampler(BsVmState* state, SamplerStateHandle handle, int slot);
+void Render_SetDepthClearValue(BsVmState* state, float depthClearVal);
+void Render_Draw(BsVmState* state);
+void Render_Dispatch(BsVmState* state, int x, int y, int z);
+RenderTargetHandle Render_CreateRenderTarget(BsVmState* state, Render::RenderTargetConfig& config);
+DepthStencilHandle Render_CreateDepthStencil(BsVmState* state, const Render::DepthStencilConfig& config);
+RasterizerStateHandle Render_CreateRasterizerState(BsVmState* state, const Render::RasterizerConfig& rasterConfig);
+BlendingStateHandle Render_CreateBlendingState(BsVmState* state, const Render::BlendingConfig& blendConfig);
+SamplerStateHandle Render_CreateSamplerState(BsVmState* state, const Render::SamplerStateConfig& config);
+void Render_BeginMarker(const char* markerName);
+void Render_EndMarker();
+Render::RasterizerConfig Render_CreateSimpleRasterConfig(Render::RasterizerConfig::PegasusCullMode cullMode, Render::RasterizerConfig::PegasusRasterFunc depthFunc);
 
 template<class T>
-void Render_SetComputeOutputs(FunCallbackContext& context);
+void Render_SetComputeOutputs(BsVmState* state, ObjectHandle<T> resourceHandle, int slotId);
 
 #if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
-#define CHECK_PERMISSIONS(_renderCollection, funcall, perms) \
+#define CHECK_PERMISSIONS_RETURN(_renderCollection, funcall, perms, retVal) \
     if (!(_renderCollection->GetPermissions() & perms))\
     {\
         PG_LOG('ERR_', "Cannot call \"%s\" on this context. Invalid permissions.", funcall);\
-        return;\
+        return retVal;\
     }
 #else
-#define CHECK_PERMISSIONS(_renderCollection, funcall, perms)
+#define CHECK_PERMISSIONS_RETURN(_renderCollection, funcall, perms, retVal)
 #endif
 
+#define CHECK_PERMISSIONS(_renderCollection, funcall, perms) CHECK_PERMISSIONS_RETURN(_renderCollection, funcall, perms, )
+
 /////Global cache Functions////////////////////////////////////
 template<typename T, bool isWindowIdUsed=false> void GlobalCache_Register(FunCallbackContext& context);
 template<typename T, bool isWindowIdUsed=false> void GlobalCache_Find(FunCallbackContext& context);
@@ -362,7 +404,14 @@ static void RegisterRenderEnums(BlockLib* lib)
                 { "FORMAT_R8_SINT" , Pegasus::Core::FORMAT_R8_SINT },
                 { "FORMAT_R8_UINT" , Pegasus::Core::FORMAT_R8_UINT },
                 { "FORMAT_R8_SNORM" , Pegasus::Core::FORMAT_R8_SNORM },
-                { "FORMAT_R8_TYPELESS" , Pegasus::Core::FORMAT_R8_TYPELESS }
+                { "FORMAT_R8_TYPELESS" , Pegasus::Core::FORMAT_R8_TYPELESS },
+                { "FORMAT_BC1_UNORM" , Pegasus::Core::FORMAT_BC1_UNORM },
+                { "FORMAT_BC1_UNORM_SRGB" , Pegasus::Core::FORMAT_BC1_UNORM_SRGB },
+                { "FORMAT_BC3_UNORM" , Pegasus::Core::FORMAT_BC3_UNORM },
+                { "FORMAT_BC3_UNORM_SRGB" , Pegasus::Core::FORMAT_BC3_UNORM_SRGB },
+                { "FORMAT_BC5_UNORM" , Pegasus::Core::FORMAT_BC5_UNORM },
+                { "FORMAT_BC7_UNORM" , Pegasus::Core::FORMAT_BC7_UNORM },
+                { "FORMAT_BC7_UNORM_SRGB" , Pegasus::Core::FORMAT_BC7_UNORM_SRGB }
             },
             Pegasus::Core::FORMAT_MAX_COUNT //this includes automatic
         }
@@ -629,7 +678,7 @@ static void RegisterNodes(BlockLib* lib, Core::IApplicationContext* context)
         {
             "ProgramLinkage",
             { //method list
-                { "SetShaderStage", "int", {"ProgramLinkage", "ShaderStage", nullptr}, {"this", "stage", nullptr}, Program_SetShaderStage }
+                BS_BIND(Program_SetShaderStage)::Declare("SetShaderStage", "this", "stage")
             },
             1,
             nullptr, 0, nullptr
@@ -643,8 +692,8 @@ static void RegisterNodes(BlockLib* lib, Core::IApplicationContext* context)
         {
             "MeshOperator",
             {
-                { "AddGeneratorInput", "int", { "MeshOperator", "MeshGenerator", nullptr }, { "this", "meshGenerator", nullptr }, MeshOperator_AddGeneratorInput },
-                { "AddOperatorInput",  "int", { "MeshOperator", "MeshOperator", nullptr },  { "this", "meshOperator", nullptr },  MeshOperator_AddOperatorInput  }
+                BS_BIND(MeshOperator_AddGeneratorInput)::Declare("AddGeneratorInput", "this", "meshGenerator"),
+                BS_BIND(MeshOperator_AddOperatorInput)::Declare( "AddOperatorInput",  "this", "meshOperator")
             },
             2,
             nullptr, 0, 
@@ -653,8 +702,8 @@ static void RegisterNodes(BlockLib* lib, Core::IApplicationContext* context)
         {
             "Mesh",
             {
-                { "SetGeneratorInput", "int", {"Mesh", "MeshGenerator", nullptr}, {"this", "meshGenerator", nullptr}, Mesh_SetGeneratorInput },
-                { "SetOperatorInput", "int", {"Mesh", "MeshOperator", nullptr}, {"this", "meshOperator", nullptr}, Mesh_SetOperatorInput }
+                BS_BIND(Mesh_SetGeneratorInput)::Declare("SetGeneratorInput", "this", "meshGenerator"),
+                BS_BIND(Mesh_SetOperatorInput)::Declare( "SetOperatorInput",  "this", "meshOperator")
             },
             2,
             nullptr, 0, nullptr
@@ -668,8 +717,8 @@ static void RegisterNodes(BlockLib* lib, Core::IApplicationContext* context)
         {
             "TextureOperator",
             {
-                { "AddGeneratorInput", "int", { "TextureOperator", "TextureGenerator", nullptr }, { "this", "texGenerator", nullptr }, TextureOperator_AddGeneratorInput },
-                { "AddOperatorInput",  "int", { "TextureOperator", "TextureOperator", nullptr },  { "this", "texOperator", nullptr },  TextureOperator_AddOperatorInput  }
+                BS_BIND(TextureOperator_AddGeneratorInput)::Declare("AddGeneratorInput", "this", "texGenerator"),
+                BS_BIND(TextureOperator_AddOperatorInput)::Declare( "AddOperatorInput",  "this", "texOperator")
             },
             2,
             nullptr, 0,
@@ -678,8 +727,8 @@ static void RegisterNodes(BlockLib* lib, Core::IApplicationContext* context)
         {
             "Texture",
             {
-                { "SetGeneratorInput", "int", { "Texture", "TextureGenerator", nullptr }, { "this", "texGenerator", nullptr }, Texture_SetGeneratorInput },
-                { "SetOperatorInput", "int", { "Texture", "TextureOperator", nullptr }, { "this", "texOperator", nullptr }, Texture_SetOperatorInput },
+                BS_BIND(Texture_SetGeneratorInput)::Declare("SetGeneratorInput", "this", "texGenerator"),
+                BS_BIND(Texture_SetOperatorInput)::Declare( "SetOperatorInput",  "this", "texOperator"),
             },
             2,
             nullptr, 0, nullptr
@@ -764,70 +813,16 @@ static void RegisterTypes(BlockLib* lib, Core::IApplicationContext* context)
 static void RegisterFunctions(BlockLib* lib)
 {
     const FunctionDeclarationDesc funDeclarations[] = {
-        {
-            "LoadProgram",
-            "ProgramLinkage",
-            { "string", nullptr },
-            { "path", nullptr },
-            Node_LoadProgram
-        },
-        {
-            "CreateTexture",
-            "Texture",
-            { nullptr },
-            { nullptr },
-            Node_CreateTexture
-        },
-        {
-            "CreateTextureGenerator",
-            "TextureGenerator",
-            { "string", nullptr },
-            { "typeDesc", nullptr },
-            Node_CreateTextureGenerator
-        },
-        {
-            "CreateTextureOperator",
-            "TextureOperator",
-            { "string", nullptr },
-            { "typeId", nullptr },
-            Node_CreateTextureGenerator
-        },
-        {
-            "CreateMesh",
-            "Mesh",
-            { nullptr },
-            { nullptr },
-            Node_CreateMesh
-        },
-        {
-            "CreateMeshGenerator",
-            "MeshGenerator",
-            { "string", nullptr },
-            { "typeId", nullptr },
-            Node_CreateMeshGenerator
-        },
-        {
-            "CreateMeshOperator",
-            "MeshOperator",
-            { "string", nullptr },
-            { "typeId", nullptr },
-            Node_CreateMeshOperator
-        },
+        BS_BIND(Node_LoadProgram)::Declare("LoadProgram", "path"),
+        BS_BIND(Node_CreateTexture)::Declare("CreateTexture"),
+        BS_BIND(Node_CreateTextureGenerator)::Declare("CreateTextureGenerator", "typeDesc"),
+        BS_BIND(Node_CreateTextureOperator)::Declare("CreateTextureOperator", "typeId"),
+        BS_BIND(Node_CreateMesh)::Declare("CreateMesh"),
+        BS_BIND(Node_CreateMeshGenerator)::Declare("CreateMeshGenerator", "typeId"),
+        BS_BIND(Node_CreateMeshOperator)::Declare("CreateMeshOperator", "typeId"),
         // Render API registration
-        {
-            "CreateUniformBuffer",
-            "Buffer",
-            { "int",        nullptr },
-            { "bufferSize", nullptr },
-            Render_CreateUniformBuffer
-        },
-        {
-            "SetBuffer",
-            "int",
-            { "Buffer", "*" },
-            { "dstBuffer", "sourceBuffer" },
-            Render_SetBuffer
-        },
+        BS_BIND(Render_CreateUniformBuffer)::Declare("CreateUniformBuffer", "bufferSize"),
+        BS_BIND(Render_SetBuffer)::Declare("SetBuffer", "dstBuffer", "sourceBuffer"),
         {
             "GetUniformLocation",
             "Uniform",
@@ -835,314 +830,56 @@ static void RegisterFunctions(BlockLib* lib)
             { "program","uniformName", nullptr },
             Render_GetUniformLocation
         },
-        {
-            "SetUniformBuffer",
-            "int",
-            { "Uniform","Buffer", nullptr },
-            { "uniform","buffer", nullptr },
-            Render_SetUniformBuffer
-        },
-        {
-            "SetUniformBufferResource",
-            "int",
-            { "Uniform","Buffer", nullptr },
-            { "uniform","buffer", nullptr },
-            Render_SetUniformBufferResource
-        },
-        {
-            "SetUniformTexture",
-            "int",
-            { "Uniform","Texture", nullptr },
-            { "uniform","texture", nullptr },
-            Render_SetUniformTexture
-        },
-        {
-            "SetUniformTextureRenderTarget",
-            "int",
-            { "Uniform", "RenderTarget", nullptr },
-            { "uniform", "renderTarget", nullptr },
-            Render_SetUniformTextureRenderTarget
-        },
-        {
-            "SetUniformDepth",
-            "int",
-            { "Uniform", "DepthStencil", nullptr },
-            { "uniform", "depth", nullptr },
-            Render_SetUniformDepth
-        },
-        {
-            "SetUniformStencil",
-            "int",
-            { "Uniform", "DepthStencil", nullptr },
-            { "uniform", "stencil", nullptr },
-            Render_SetUniformStencil
-        },
-        {
-            "SetProgram",
-            "int",
-            { "ProgramLinkage", nullptr },
-            { "program", nullptr },
-            Render_SetProgram
-        },
-        {
-            "SetMesh",
-            "int",
-            { "Mesh", nullptr },
-            { "mesh", nullptr },
-            Render_SetMesh
-        },
-        {
-            "UnbindMesh",
-            "int",
-            { nullptr },
-            { nullptr },
-            Render_UnbindMesh
-        },
-        {
-            "UnbindComputeOutputs",
-            "int",
-            { nullptr },
-            { nullptr },
-            Render_UnbindComputeOutputs
-        },
-        {
-            "UnbindRenderTargets",
-            "int",
-            { nullptr },
-            { nullptr },
-            Render_UnbindRenderTargets
-        },
-        {
-            "UnbindPixelResources",
-            "int",
-            { nullptr },
-            { nullptr },
-            Render_UnbindPixelResources
-        },
-        {
-            "UnbindComputeResources",
-            "int",
-            { nullptr },
-            { nullptr },
-            Render_UnbindComputeResources
-        },
-        {
-            "UnbindVertexResources",
-            "int",
-            { nullptr },
-            { nullptr },
-            Render_UnbindVertexResources
-        },
-        {
-            "SetViewport",
-            "int",
-            { "Viewport", nullptr },
-            { "vp", nullptr },
-            Render_SetViewport
-        },
-        {
-            "SetViewport",
-            "int",
-            { "RenderTarget", nullptr },
-            { "vp", nullptr },
-            Render_SetViewport2
-        },
-        {
-            "SetViewport",
-            "int",
-            { "DepthStencil", nullptr },
-            { "vp", nullptr },
-            Render_SetViewport3
-        },
-        {
-            "SetRenderTarget",
-            "int",
-            { "RenderTarget", nullptr },
-            { "renderTarget", nullptr },
-            Render_SetRenderTarget
-        },
-        {
-            "SetRenderTarget",
-            "int",
-            { "RenderTarget", "DepthStencil", nullptr },
-            { "renderTarget", "depthStencilTarget", nullptr },
-            Render_SetRenderTarget2
-        },
-        {
-            "SetRenderTargets",
-            "int",
-            { "int"               , "*"              , "DepthStencil", nullptr },
-            { "renderTargetCounts", "renderTargets[]", "depthStencilTarget", nullptr },
-            Render_SetRenderTargets
-        },
-        {
-            "SetRenderTargets",
-            "int",
-            { "int"               , "*"              ,  nullptr },
-            { "renderTargetCounts", "renderTargets[]",  nullptr },
-            Render_SetRenderTargets2
-        },
-        {
-            "SetDefaultRenderTarget",
-            "int",
-            { nullptr },
-            { nullptr },
-            Render_SetDefaultRenderTarget
-        },
-        {
-            "SetPrimitiveMode",
-            "int",
-            { "PrimitiveMode", nullptr },
-            { "Mode",          nullptr },
-            Render_SetPrimitiveMode
-        },
-        {
-            "Clear",
-            "int",
-            { "int", "int", "int", nullptr },
-            { "color", "depth", "stencil", nullptr },
-            Render_Clear
-        },
-        {
-            "SetClearColorValue",
-            "int",
-            { "float4", nullptr },
-            { "clearCol", nullptr },
-            Render_SetClearColorValue
-        },
-        {
-            "SetRasterizerState",
-            "int",
-            { "RasterizerState", nullptr },
-            { "rasterState", nullptr },
-            Render_SetRasterizerState
-        },
-        {
-            "SetBlendingState",
-            "int",
-            { "BlendingState", nullptr },
-            { "blendingState", nullptr },
-            Render_SetBlendingState
-        },
-        {
-            "SetComputeSampler",
-            "int",
-            { "SamplerState", "int", nullptr },
-            { "state", "slot", nullptr },
-            Render_SetComputeSampler
-        },
-        {
-            "SetPixelSampler",
-            "int",
-            { "SamplerState", "int", nullptr },
-            { "state", "slot", nullptr },
-            Render_SetPixelSampler
-        },
-        {
-            "SetVertexSampler",
-            "int",
-            { "SamplerState", "int", nullptr },
-            { "state", "slot", nullptr },
-            Render_SetVertexSampler
-        },
-        {
-            "SetDepthClearValue",
-            "int",
-            { "float", nullptr },
-            { "d", nullptr },
-            Render_SetDepthClearValue
-        },
-        {
-            "Draw",
-            "int",
-            { nullptr },
-            { nullptr },
-            Render_Draw
-        },
-        {
-            "Dispatch",
-            "int",
-            { "int", "int", "int", nullptr },
-            { "x", "y", "z", nullptr },
-            Render_Dispatch
-        },
-        {
-            "CreateRenderTarget",
-            "RenderTarget",
-            { "RenderTargetConfig", nullptr },
-            { "config", nullptr },
-            Render_CreateRenderTarget
-        },
-        {
-            "CreateDepthStencil",
-            "DepthStencil",
-            { "DepthStencilConfig", nullptr },
-            { "config", nullptr },
-            Render_CreateDepthStencil
-        },
-        {
-            "CreateRasterizerState",
-            "RasterizerState",
-            { "RasterizerConfig", nullptr },
-            { "config", nullptr },
-            Render_CreateRasterizerState
-        },
-        {
-            "CreateBlendingState",
-            "BlendingState",
-            { "BlendingConfig", nullptr },
-            { "config", nullptr },
-            Render_CreateBlendingState
-        },
-        {
-            "CreateSamplerState",
-            "SamplerState",
-            { "SamplerStateConfig", nullptr },
-            { "config", nullptr },
-            Render_CreateSamplerState
-        },
-        {
-            "SetComputeOutput",
-            "int",
-            {"RenderTarget", "int", nullptr},
-            {"resource", "slot", nullptr},
-            Render_SetComputeOutputs<Render::RenderTarget>
-        },
-        {
-            "SetComputeOutput",
-            "int",
-            { "Buffer", "int", nullptr },
-            { "resource", "slot", nullptr },
-            Render_SetComputeOutputs<Render::Buffer>
-        },
-        {
-            "SetComputeOutput",
-            "int",
-            { "VolumeTexture", "int", nullptr },
-            { "resource", "slot", nullptr },
-            Render_SetComputeOutputs<Render::VolumeTexture>
-        },
-        {
-            "BeginMarker",
-            "int",
-            { "string", nullptr },
-            { "marker", nullptr },
-            Render_BeginMarker
-        },
-        {
-            "EndMarker",
-            "int",
-            { nullptr },
-            { nullptr },
-            Render_EndMarker
-        },
-        {
-            "RasterizerConfig",
-            "RasterizerConfig",
-            { "PegasusCullMode", "PegasusRasterFunc", nullptr },
-            { "CullMode", "StencilFunc", nullptr },
-            Render_CreateSimpleRasterConfig
-        }
+        BS_BIND(Render_SetUniformBuffer)::Declare("SetUniformBuffer", "uniform", "buffer"),
+        BS_BIND(Render_SetUniformBufferResource)::Declare("SetUniformBufferResource", "uniform", "buffer"),
+        BS_BIND(Render_SetUniformTexture)::Declare("SetUniformTexture", "uniform", "texture"),
+        BS_BIND(Render_SetUniformTextureRenderTarget)::Declare("SetUniformTextureRenderTarget", "uniform", "renderTarget"),
+        BS_BIND(Render_SetUniformDepth)::Declare("SetUniformDepth", "uniform", "depth"),
+        BS_BIND(Render_SetUniformStencil)::Declare("SetUniformStencil", "uniform", "stencil"),
+        BS_BIND(Render_SetProgram)::Declare("SetProgram", "program"),
+        BS_BIND(Render_SetMesh)::Declare("SetMesh", "mesh"),
+        BS_BIND(Render_SetMeshLod)::Declare("SetMeshLod", "lod"),
+        BS_BIND(Render_SelectMeshLod)::Declare("SelectMeshLod", "mesh", "distance", "projectionScale", "maxPixelError"),
+        BS_BIND(Render_GetMeshPositionOffset)::Declare("GetMeshPositionOffset", "mesh"),
+        BS_BIND(Render_GetMeshPositionScale)::Declare("GetMeshPositionScale", "mesh"),
+        BS_BIND(Render_GetMeshBoundingSphere)::Declare("GetMeshBoundingSphere", "mesh"),
+        BS_BIND(Render_RaycastMesh)::Declare("RaycastMesh", "mesh", "origin", "direction", "maxDistance"),
+        BS_BIND(Render_UnbindMesh)::Declare("UnbindMesh"),
+        BS_BIND(Render_UnbindComputeOutputs)::Declare("UnbindComputeOutputs"),
+        BS_BIND(Render_UnbindRenderTargets)::Declare("UnbindRenderTargets"),
+        BS_BIND(Render_UnbindPixelResources)::Declare("UnbindPixelResources"),
+        BS_BIND(Render_UnbindComputeResources)::Declare("UnbindComputeResources"),
+        BS_BIND(Render_UnbindVertexResources)::Declare("UnbindVertexResources"),
+        BS_BIND(Render_SetViewport)::Declare("SetViewport", "vp"),
+        BS_BIND(Render_SetViewport2)::Declare("SetViewport", "vp"),
+        BS_BIND(Render_SetViewport3)::Declare("SetViewport", "vp"),
+        BS_BIND(Render_SetRenderTarget)::Declare("SetRenderTarget", "renderTarget"),
+        BS_BIND(Render_SetRenderTarget2)::Declare("SetRenderTarget", "renderTarget", "depthStencilTarget"),
+        BS_BIND(Render_SetRenderTargets)::Declare("SetRenderTargets", "renderTargetCounts", "renderTargets[]", "depthStencilTarget"),
+        BS_BIND(Render_SetRenderTargets2)::Declare("SetRenderTargets", "renderTargetCounts", "renderTargets[]"),
+        BS_BIND(Render_SetDefaultRenderTarget)::Declare("SetDefaultRenderTarget"),
+        BS_BIND(Render_SetPrimitiveMode)::Declare("SetPrimitiveMode", "Mode"),
+        BS_BIND(Render_Clear)::Declare("Clear", "color", "depth", "stencil"),
+        BS_BIND(Render_SetClearColorValue)::Declare("SetClearColorValue", "clearCol"),
+        BS_BIND(Render_SetRasterizerState)::Declare("SetRasterizerState", "rasterState"),
+        BS_BIND(Render_SetBlendingState)::Declare("SetBlendingState", "blendingState"),
+        BS_BIND(Render_SetComputeSampler)::Declare("SetComputeSampler", "state", "slot"),
+        BS_BIND(Render_SetPixelSampler)::Declare("SetPixelSampler", "state", "slot"),
+        BS_BIND(Render_SetVertexSampler)::Declare("SetVertexSampler", "state", "slot"),
+        BS_BIND(Render_SetDepthClearValue)::Declare("SetDepthClearValue", "d"),
+        BS_BIND(Render_Draw)::Declare("Draw"),
+        BS_BIND(Render_Dispatch)::Declare("Dispatch", "x", "y", "z"),
+        BS_BIND(Render_CreateRenderTarget)::Declare("CreateRenderTarget", "config"),
+        BS_BIND(Render_CreateDepthStencil)::Declare("CreateDepthStencil", "config"),
+        BS_BIND(Render_CreateRasterizerState)::Declare("CreateRasterizerState", "config"),
+        BS_BIND(Render_CreateBlendingState)::Declare("CreateBlendingState", "config"),
+        BS_BIND(Render_CreateSamplerState)::Declare("CreateSamplerState", "config"),
+        BS_BIND(Render_SetComputeOutputs<Render::RenderTarget>)::Declare("SetComputeOutput", "resource", "slot"),
+        BS_BIND(Render_SetComputeOutputs<Render::Buffer>)::Declare("SetComputeOutput", "resource", "slot"),
+        BS_BIND(Render_SetComputeOutputs<Render::VolumeTexture>)::Declare("SetComputeOutput", "resource", "slot"),
+        BS_BIND(Render_BeginMarker)::Declare("BeginMarker", "marker"),
+        BS_BIND(Render_EndMarker)::Declare("EndMarker"),
+        BS_BIND(Render_CreateSimpleRasterConfig)::Declare("RasterizerConfig", "CullMode", "StencilFunc")
     };
 
     lib->CreateIntrinsicFunctions(funDeclarations, sizeof(funDeclarations) / sizeof(funDeclarations[0]));
@@ -1201,15 +938,10 @@ static Application::RenderCollection* GetContainer(BsVmState* state)
 /////////////////////////////////////////////////////////////
 //!> Program Node functions
 /////////////////////////////////////////////////////////////
-void Program_SetShaderStage(FunCallbackContext& context)
+int Program_SetShaderStage(BsVmState* state, ProgramLinkageHandle programId, ShaderStageHandle stageId)
 {
-    BsVmState* state = context.GetVmState();
     Application::RenderCollection* container = GetContainer(state);    
-    FunParamStream stream(context);
 
-    RenderCollection::CollectionHandle& programId = stream.NextArgument<RenderCollection::CollectionHandle>();
-    RenderCollection::CollectionHandle& stageId = stream.NextArgument<RenderCollection::CollectionHandle>();
-    
     int retVal = 0;
     if (programId != RenderCollection::INVALID_HANDLE && stageId != RenderCollection::INVALID_HANDLE)
     {
@@ -1223,20 +955,15 @@ void Program_SetShaderStage(FunCallbackContext& context)
     {
         PG_LOG('ERR_', "Failed setting shader stage.");
     }
-    stream.SubmitReturn(retVal);
+    return retVal;
 }
 
 /////////////////////////////////////////////////////////////
 //!> Mesh Node functions
 /////////////////////////////////////////////////////////////
-void MeshOperator_AddOperatorInput(FunCallbackContext& context)
+void MeshOperator_AddOperatorInput(BsVmState* state, MeshOperatorHandle meshOpHandle, MeshOperatorHandle opToAddHandle)
 {
-    BsVmState* state = context.GetVmState();    
     RenderCollection* collection = GetContainer(state);
-    FunParamStream stream(context);
-    
-    RenderCollection::CollectionHandle& meshOpHandle = stream.NextArgument<RenderCollection::CollectionHandle>();
-    RenderCollection::CollectionHandle& opToAddHandle  = stream.NextArgument<RenderCollection::CollectionHandle>();
 
     if ( meshOpHandle != RenderCollection::INVALID_HANDLE && opToAddHandle != RenderCollection::INVALID_HANDLE)
     {
@@ -1250,19 +977,14 @@ void MeshOperator_AddOperatorInput(FunCallbackContext& context)
     }
 }
 
-void MeshOperator_AddGeneratorInput(FunCallbackContext& context)
+void MeshOperator_AddGeneratorInput(BsVmState* state, MeshOperatorHandle meshOpHandle, MeshGeneratorHandle genToAddHandle)
 {
-    BsVmState* state = context.GetVmState();    
     RenderCollection* collection = GetContainer(state);
-    FunParamStream stream(context);
-    
-    RenderCollection::CollectionHandle& meshOpHandle = stream.NextArgument<RenderCollection::CollectionHandle>();
-    RenderCollection::CollectionHandle& opToAddHandle  = stream.NextArgument<RenderCollection::CollectionHandle>();
 
-    if ( meshOpHandle != RenderCollection::INVALID_HANDLE && opToAddHandle != RenderCollection::INVALID_HANDLE)
+    if ( meshOpHandle != RenderCollection::INVALID_HANDLE && genToAddHandle != RenderCollection::INVALID_HANDLE)
     {
         Mesh::MeshOperatorRef srcMesh = RenderCollection::GetResource<Mesh::MeshOperator>(collection, meshOpHandle);
-        Mesh::MeshGeneratorRef meshGeneratorRef = RenderCollection::GetResource<Mesh::MeshGenerator>(collection, opToAddHandle);
+        Mesh::MeshGeneratorRef meshGeneratorRef = RenderCollection::GetResource<Mesh::MeshGenerator>(collection, genToAddHandle);
         srcMesh->AddGeneratorInput(meshGeneratorRef);
     }
     else
@@ -1271,14 +993,9 @@ void MeshOperator_AddGeneratorInput(FunCallbackContext& context)
     }
 }
 
-void Mesh_SetOperatorInput(FunCallbackContext& context)
+void Mesh_SetOperatorInput(BsVmState* state, MeshHandle meshHandle, MeshOperatorHandle opHandle)
 {
-    BsVmState* state = context.GetVmState();    
     RenderCollection* collection = GetContainer(state);
-    FunParamStream stream(context);
-    
-    RenderCollection::CollectionHandle& meshHandle = stream.NextArgument<RenderCollection::CollectionHandle>();
-    RenderCollection::CollectionHandle& opHandle  = stream.NextArgument<RenderCollection::CollectionHandle>();
 
     if ( meshHandle != RenderCollection::INVALID_HANDLE && opHandle != RenderCollection::INVALID_HANDLE)
     {
@@ -1292,14 +1009,9 @@ void Mesh_SetOperatorInput(FunCallbackContext& context)
     }
 }
 
-void Mesh_SetGeneratorInput(FunCallbackContext& context)
+void Mesh_SetGeneratorInput(BsVmState* state, MeshHandle meshHandle, MeshGeneratorHandle genHandle)
 {
-    BsVmState* state = context.GetVmState();    
     RenderCollection* collection = GetContainer(state);
-    FunParamStream stream(context);
-    
-    RenderCollection::CollectionHandle& meshHandle = stream.NextArgument<RenderCollection::CollectionHandle>();
-    RenderCollection::CollectionHandle& genHandle  = stream.NextArgument<RenderCollection::CollectionHandle>();
     
     if ( meshHandle != RenderCollection::INVALID_HANDLE && genHandle != RenderCollection::INVALID_HANDLE)
     {
@@ -1317,19 +1029,19 @@ void Mesh_SetGeneratorInput(FunCallbackContext& context)
 //!> Texture Node functions
 /////////////////////////////////////////////////////////////
 
-void TextureOperator_AddOperatorInput(FunCallbackContext& context)
+void TextureOperator_AddOperatorInput(TextureOperatorHandle texOpHandle, TextureOperatorHandle opToAddHandle)
 {
 }
 
-void TextureOperator_AddGeneratorInput(FunCallbackContext& context)
+void TextureOperator_AddGeneratorInput(TextureOperatorHandle texOpHandle, TextureGeneratorHandle genToAddHandle)
 {
 }
 
-void Texture_SetOperatorInput(FunCallbackContext& context)
+void Texture_SetOperatorInput(TextureHandle texHandle, TextureOperatorHandle opHandle)
 {
 }
 
-void Texture_SetGeneratorInput(FunCallbackContext& context)
+void Texture_SetGeneratorInput(TextureHandle texHandle, TextureGeneratorHandle genHandle)
 {
 }
 
@@ -1337,14 +1049,10 @@ void Texture_SetGeneratorInput(FunCallbackContext& context)
 //!> Node Manager functions
 /////////////////////////////////////////////////////////////
 
-void Node_LoadProgram(FunCallbackContext& context)
+ProgramLinkageHandle Node_LoadProgram(BsVmState* state, const char* path)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     Application::RenderCollection* container = GetContainer(state);
-    CHECK_PERMISSIONS(container, "LoadProgram", PERMISSIONS_ASSET_LOAD);
-
-    const char* path = stream.NextBsStringArgument();
+    CHECK_PERMISSIONS_RETURN(container, "LoadProgram", PERMISSIONS_ASSET_LOAD, Application::RenderCollection::INVALID_HANDLE);
 
     Shader::ProgramLinkageRef program = container->GetAppContext()->GetShaderManager()->LoadProgram(path);
     if (program != nullptr)
@@ -1353,96 +1061,77 @@ void Node_LoadProgram(FunCallbackContext& context)
         bool unused = false;
         program->GetUpdatedData(unused);
 
-        stream.SubmitReturn( RenderCollection::AddResource<Shader::ProgramLinkage>(container,program));
+        return RenderCollection::AddResource<Shader::ProgramLinkage>(container,program);
     }
     else
     {
-        stream.SubmitReturn( Application::RenderCollection::INVALID_HANDLE ); //an invalid id
+        return Application::RenderCollection::INVALID_HANDLE; //an invalid id
     }
 }
 
-void Node_CreateTexture(FunCallbackContext& context)
+TextureHandle Node_CreateTexture(BsVmState* state)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);  
     Pegasus::Texture::TextureConfiguration blankConfig;
     Pegasus::Texture::TextureRef t = collection->GetAppContext()->GetTextureManager()->CreateTextureNode(blankConfig);
     if (t != nullptr)
     {
-        RenderCollection::CollectionHandle handle = RenderCollection::AddResource<Texture::Texture>(collection, t);
-        stream.SubmitReturn(handle);
+        return RenderCollection::AddResource<Texture::Texture>(collection, t);
     }
     else
     {
         PG_LOG('ERR_', "Cannot create texture. Invalid handle returned");
-        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return RenderCollection::INVALID_HANDLE;
     }
 }
 
-void Node_CreateTextureGenerator(FunCallbackContext& context)
+TextureGeneratorHandle Node_CreateTextureGenerator(BsVmState* state, const char* name)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
-    const char* name = stream.NextBsStringArgument();
     Pegasus::Texture::TextureConfiguration blankConfig;
     Pegasus::Texture::TextureGeneratorRef t = collection->GetAppContext()->GetTextureManager()->CreateTextureGeneratorNode(name, blankConfig);
     if (t != nullptr)
     {
-        RenderCollection::CollectionHandle handle = RenderCollection::AddResource<Texture::TextureGenerator>(collection, t);
-        stream.SubmitReturn(handle);
+        return RenderCollection::AddResource<Texture::TextureGenerator>(collection, t);
     }
     else
     {
         PG_LOG('ERR_', "Cannot create texture. Invalid handle returned");
-        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return RenderCollection::INVALID_HANDLE;
     }
 }
 
-void Node_CreateTextureOperator(FunCallbackContext& context)
+TextureOperatorHandle Node_CreateTextureOperator(BsVmState* state, const char* name)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
-    const char* name = stream.NextBsStringArgument();
     Pegasus::Texture::TextureConfiguration blankConfig;
     Pegasus::Texture::TextureOperatorRef t = collection->GetAppContext()->GetTextureManager()->CreateTextureOperatorNode(name, blankConfig);
     if (t != nullptr)
     {
-        RenderCollection::CollectionHandle handle = RenderCollection::AddResource<Texture::TextureOperator>(collection, t);
-        stream.SubmitReturn(handle);
+        return RenderCollection::AddResource<Texture::TextureOperator>(collection, t);
     }
     else
     {
         PG_LOG('ERR_', "Invalid handle returned.");
-        stream.SubmitReturn(RenderCollection::INVALID_HANDLE);
+        return RenderCollection::INVALID_HANDLE;
     }
 }
 
-void Node_CreateMesh(FunCallbackContext& context)
+MeshHandle Node_CreateMesh(BsVmState* state)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
     Core::IApplicationContext* appCtx = collection->GetAppContext();
     Mesh::MeshManager* meshManager = appCtx->GetMeshManager();
     Mesh::MeshRef newMesh = meshManager->CreateMeshNode();
-    RenderCollection::CollectionHandle handle = RenderCollection::AddResource<Mesh::Mesh>(collection, newMesh);
-    stream.SubmitReturn(handle);
+    return RenderCollection::AddResource<Mesh::Mesh>(collection, newMesh);
 }
 
-void Node_CreateMeshGenerator(FunCallbackContext& context)
+MeshGeneratorHandle Node_CreateMeshGenerator(BsVmState* state, const char* name)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
     Core::IApplicationContext* appCtx = collection->GetAppContext();
     Mesh::MeshManager* meshManager = appCtx->GetMeshManager();
 
-    //get the input
-    const char* name = stream.NextBsStringArgument();
-
     //create new mesh generator
     Mesh::MeshGeneratorRef meshGenerator = meshManager->CreateMeshGeneratorNode(name);
     RenderCollection::CollectionHandle handle = RenderCollection::INVALID_HANDLE;
@@ -1450,20 +1139,15 @@ void Node_CreateMeshGenerator(FunCallbackContext& context)
     {
         handle = RenderCollection::AddResource<Mesh::MeshGenerator>(collection, meshGenerator);
     }
-    stream.SubmitReturn(handle);
+    return handle;
 }
 
-void Node_CreateMeshOperator(FunCallbackContext& context)
+MeshOperatorHandle Node_CreateMeshOperator(BsVmState* state, const char* name)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
     Core::IApplicationContext* appCtx = collection->GetAppContext();
     Mesh::MeshManager* meshManager = appCtx->GetMeshManager();
 
-    //get the input
-    const char* name = stream.NextBsStringArgument();
-
     //create new mesh generator
     Mesh::MeshOperatorRef meshOperator = meshManager->CreateMeshOperatorNode(name);
     RenderCollection::CollectionHandle handle = RenderCollection::INVALID_HANDLE;
@@ -1471,53 +1155,39 @@ void Node_CreateMeshOperator(FunCallbackContext& context)
     {
         handle = RenderCollection::AddResource<Mesh::MeshOperator>(collection, meshOperator);
     }
-    stream.SubmitReturn(handle);
-    
+    return handle;
 }
 
 
 /////////////////////////////////////////////////////////////
 //!> Render functions
 /////////////////////////////////////////////////////////////
-void Render_CreateUniformBuffer(FunCallbackContext& context)
+BufferHandle Render_CreateUniformBuffer(BsVmState* state, int bufferSize)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     Application::RenderCollection* renderCollection = GetContainer(state);
-    CHECK_PERMISSIONS(renderCollection, "CreateUniformBuffer", PERMISSIONS_RENDER_API_CALL);
-
-    int& bufferSize = stream.NextArgument<int>();
+    CHECK_PERMISSIONS_RETURN(renderCollection, "CreateUniformBuffer", PERMISSIONS_RENDER_API_CALL, RenderCollection::INVALID_HANDLE);
 
     if ((bufferSize & 15) != 0)
     {
         PG_LOG('ERR_', "Error: cannot create buffer with unaligend size. Size must be 16 byte aligned.");
-        stream.SubmitReturn( RenderCollection::INVALID_HANDLE ); 
+        return RenderCollection::INVALID_HANDLE; 
     }
     else
     {
         Render::BufferRef buffer = Render::CreateUniformBuffer(bufferSize);
-        stream.SubmitReturn( RenderCollection::AddResource<Render::Buffer>(renderCollection, buffer));
-
+        return RenderCollection::AddResource<Render::Buffer>(renderCollection, buffer);
     }
 }
 
-void Render_SetBuffer(FunCallbackContext& context)
+void Render_SetBuffer(BsVmState* state, BufferHandle handle, void* sourceBuffer)
 {
-    PG_ASSERT(context.GetInputBufferSize() == (sizeof(int)/*buffer ref*/ + sizeof(int)/*raw ram ref*/));
-
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
-    
-    RenderCollection::CollectionHandle& handle = stream.NextArgument<RenderCollection::CollectionHandle>();
     Application::RenderCollection* collection = GetContainer(state);
     CHECK_PERMISSIONS(collection, "SetBuffer", PERMISSIONS_RENDER_API_CALL);
-    int& ramRef = stream.NextArgument<int>(); //since the second parameter is a *, we can just gets its pointer in memory
-    char* bufferPointer = state->Ram() + ramRef;
  
     if (handle != Application::RenderCollection::INVALID_HANDLE)
     {
         Render::BufferRef buff = RenderCollection::GetResource<Render::Buffer>(collection, handle);
-        Render::SetBuffer(buff, bufferPointer);
+        Render::SetBuffer(buff, sourceBuffer);
     }
     else
     {
@@ -1549,14 +1219,8 @@ void Render_GetUniformLocation(FunCallbackContext& context)
     }
 }
 
-void Render_SetUniformBuffer(FunCallbackContext& context)
+void Render_SetUniformBuffer(BsVmState* state, Render::Uniform& uniform, BufferHandle bufferHandle)
 {
-    PG_ASSERT(context.GetInputBufferSize() == (sizeof(Render::Uniform) + sizeof(int)));
-    
-    FunParamStream stream(context);
-    BsVmState * state = context.GetVmState();
-    Render::Uniform& uniform  = stream.NextArgument<Render::Uniform>(); 
-    int& bufferHandle = stream.NextArgument<int>();
     Application::RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "SetUniformBuffer", PERMISSIONS_RENDER_API_CALL);
 
@@ -1575,14 +1239,8 @@ void Render_SetUniformBuffer(FunCallbackContext& context)
     }
 }
 
-void Render_SetUniformBufferResource(FunCallbackContext& context)
+void Render_SetUniformBufferResource(BsVmState* state, Render::Uniform& uniform, BufferHandle bufferHandle)
 {
-    PG_ASSERT(context.GetInputBufferSize() == (sizeof(Render::Uniform) + sizeof(int)));
-    
-    FunParamStream stream(context);
-    BsVmState * state = context.GetVmState();
-    Render::Uniform& uniform  = stream.NextArgument<Render::Uniform>(); 
-    int& bufferHandle = stream.NextArgument<int>();
     Application::RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "SetUniformBufferResource", PERMISSIONS_RENDER_API_CALL);
 
@@ -1601,12 +1259,8 @@ void Render_SetUniformBufferResource(FunCallbackContext& context)
     }
 }
 
-void Render_SetUniformTexture(FunCallbackContext& context)
+void Render_SetUniformTexture(BsVmState* state, Render::Uniform& uniform, TextureHandle texHandle)
 {
-    FunParamStream stream(context);
-    BsVmState * state = context.GetVmState();
-    Render::Uniform& uniform  = stream.NextArgument<Render::Uniform>(); 
-    RenderCollection::CollectionHandle& texHandle = stream.NextArgument<RenderCollection::CollectionHandle>();
     Application::RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "SetUniformTexture", PERMISSIONS_RENDER_API_CALL);
 
@@ -1625,13 +1279,9 @@ void Render_SetUniformTexture(FunCallbackContext& context)
     }
 }
 
-void Render_SetUniformTextureRenderTarget(FunCallbackContext& context)
+void Render_SetUniformTextureRenderTarget(BsVmState* state, Render::Uniform& uniform, RenderTargetHandle renderTargetId)
 {
-    FunParamStream stream(context);
-    BsVmState * state = context.GetVmState();
     Application::RenderCollection* renderCollection = GetContainer(state);
-    Render::Uniform& uniform = stream.NextArgument<Render::Uniform>();
-    RenderCollection::CollectionHandle& renderTargetId = stream.NextArgument<RenderCollection::CollectionHandle>();
 
     CHECK_PERMISSIONS(renderCollection, "SetUniformTextureRenderTarget", PERMISSIONS_RENDER_API_CALL);
     if (renderTargetId != Application::RenderCollection::INVALID_HANDLE)
@@ -1646,13 +1296,9 @@ void Render_SetUniformTextureRenderTarget(FunCallbackContext& context)
     
 }
 
-void Render_SetUniformDepth(FunCallbackContext& context)
+void Render_SetUniformDepth(BsVmState* state, Render::Uniform& uniform, DepthStencilHandle renderTargetId)
 {
-    FunParamStream stream(context);
-    BsVmState * state = context.GetVmState();
     Application::RenderCollection* renderCollection = GetContainer(state);
-    Render::Uniform& uniform = stream.NextArgument<Render::Uniform>();
-    RenderCollection::CollectionHandle& renderTargetId = stream.NextArgument<RenderCollection::CollectionHandle>();
 
     CHECK_PERMISSIONS(renderCollection, "SetUniformDepth", PERMISSIONS_RENDER_API_CALL);
     if (renderTargetId != Application::RenderCollection::INVALID_HANDLE)
@@ -1666,13 +1312,9 @@ void Render_SetUniformDepth(FunCallbackContext& context)
     }
 }
 
-void Render_SetUniformStencil(FunCallbackContext& context)
+void Render_SetUniformStencil(BsVmState* state, Render::Uniform& uniform, DepthStencilHandle renderTargetId)
 {
-    FunParamStream stream(context);
-    BsVmState * state = context.GetVmState();
     Application::RenderCollection* renderCollection = GetContainer(state);
-    Render::Uniform& uniform = stream.NextArgument<Render::Uniform>();
-    RenderCollection::CollectionHandle& renderTargetId = stream.NextArgument<RenderCollection::CollectionHandle>();
 
     CHECK_PERMISSIONS(renderCollection, "SetUniformStencil", PERMISSIONS_RENDER_API_CALL);
     if (renderTargetId != Application::RenderCollection::INVALID_HANDLE)
@@ -1686,13 +1328,10 @@ void Render_SetUniformStencil(FunCallbackContext& context)
     }
 }
 
-void Render_SetProgram(FunCallbackContext& context)
+void Render_SetProgram(BsVmState* state, ProgramLinkageHandle programId)
 {
-    FunParamStream stream(context);
-    BsVmState * state = context.GetVmState();
     Application::RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "SetProgram", PERMISSIONS_RENDER_API_CALL);
-    RenderCollection::CollectionHandle& programId = stream.NextArgument<RenderCollection::CollectionHandle>();
     if (programId != Application::RenderCollection::INVALID_HANDLE)
     {
         Shader::ProgramLinkageRef program = RenderCollection::GetResource<Shader::ProgramLinkage>(renderCollection, programId);
@@ -1704,13 +1343,10 @@ void Render_SetProgram(FunCallbackContext& context)
     }
 }
 
-void Render_SetMesh(FunCallbackContext& context)
+void Render_SetMesh(BsVmState* state, MeshHandle meshId)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     Application::RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "SetMesh", PERMISSIONS_RENDER_API_CALL);
-    RenderCollection::CollectionHandle& meshId = stream.NextArgument<RenderCollection::CollectionHandle>();
     if (meshId != Application::RenderCollection::INVALID_HANDLE)
     {
         Mesh::MeshRef mesh = RenderCollection::GetResource<Mesh::Mesh>(renderCollection, meshId);
@@ -1722,50 +1358,149 @@ void Render_SetMesh(FunCallbackContext& context)
     }
 }
 
-void Render_UnbindMesh(FunCallbackContext& context)
+void Render_SetMeshLod(BsVmState* state, int lod)
+{
+#if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
+    RenderCollection* renderCollection = GetContainer(state);
+    CHECK_PERMISSIONS(renderCollection, "SetMeshLod", PERMISSIONS_RENDER_API_CALL);
+#endif
+    Render::SetMeshLod(static_cast<unsigned int>(lod < 0 ? 0 : lod));
+}
+
+int Render_SelectMeshLod(BsVmState* state, MeshHandle meshId, float distance, float projectionScale, float maxPixelError)
+{
+    Application::RenderCollection* renderCollection = GetContainer(state);
+    int lod = 0;
+    if (meshId != Application::RenderCollection::INVALID_HANDLE)
+    {
+        Mesh::MeshRef mesh = RenderCollection::GetResource<Mesh::Mesh>(renderCollection, meshId);
+        lod = mesh->SelectLod(distance, projectionScale, maxPixelError);
+    }
+    else
+    {
+        PG_LOG('ERR_', "Can't select the level of detail of an invalid mesh");
+    }
+    return lod;
+}
+
+//! Get the decoding of the quantized positions of a mesh, for the shaders of the compact vertex layout
+//! \param state State of the script vm
+//! \param meshId Handle of the mesh
+//! \param getScale True to return the scale of the decoding, false to return the offset
+//! \return The scale (w = 1) or offset (w = 0) of the decoding
+static Math::Vec4 GetMeshPositionDecode(BsVmState* state, MeshHandle meshId, bool getScale)
+{
+    Application::RenderCollection* renderCollection = GetContainer(state);
+    Math::Vec3 offset(0.0f, 0.0f, 0.0f);
+    Math::Vec3 scale(1.0f, 1.0f, 1.0f);
+    if (meshId != Application::RenderCollection::INVALID_HANDLE)
+    {
+        Mesh::MeshRef mesh = RenderCollection::GetResource<Mesh::Mesh>(renderCollection, meshId);
+        mesh->GetPositionDecode(offset, scale);
+    }
+    else
+    {
+        PG_LOG('ERR_', "Can't get the position decoding of an invalid mesh");
+    }
+    const Math::Vec3& decode = getScale ? scale : offset;
+    return Math::Vec4(decode.v[0], decode.v[1], decode.v[2], getScale ? 1.0f : 0.0f);
+}
+
+Math::Vec4 Render_GetMeshPositionOffset(BsVmState* state, MeshHandle meshId)
+{
+    return GetMeshPositionDecode(state, meshId, false);
+}
+
+Math::Vec4 Render_GetMeshPositionScale(BsVmState* state, MeshHandle meshId)
+{
+    return GetMeshPositionDecode(state, meshId, true);
+}
+
+Math::Vec4 Render_GetMeshBoundingSphere(BsVmState* state, MeshHandle meshId)
+{
+    Application::RenderCollection* renderCollection = GetContainer(state);
+    Math::Vec4 result(0.0f, 0.0f, 0.0f, 0.0f);
+    if (meshId != Application::RenderCollection::INVALID_HANDLE)
+    {
+        Mesh::MeshRef mesh = RenderCollection::GetResource<Mesh::Mesh>(renderCollection, meshId);
+        Math::AxisAlignedBoundingBox box;
+        Math::BoundingSphere sphere;
+        mesh->GetBounds(box, sphere);
+        const Math::Point3& center = sphere.GetCenter();
+        result = Math::Vec4(center.v[0], center.v[1], center.v[2], sphere.GetRadius());
+    }
+    else
+    {
+        PG_LOG('ERR_', "Can't get the bounding sphere of an invalid mesh");
+    }
+    return result;
+}
+
+//! Returns (distance, triangle, u, v) of the closest hit, distance being -1 when nothing is hit
+Math::Vec4 Render_RaycastMesh(BsVmState* state, MeshHandle meshId, const Math::Vec3& origin, Math::Vec3 direction, float maxDistance)
+{
+    Application::RenderCollection* renderCollection = GetContainer(state);
+    Math::Vec4 result(-1.0f, 0.0f, 0.0f, 0.0f);
+    if (meshId == Application::RenderCollection::INVALID_HANDLE)
+    {
+        PG_LOG('ERR_', "Can't raycast an invalid mesh");
+    }
+    else if (Math::Length(direction) <= RAY_EPSILON)
+    {
+        PG_LOG('ERR_', "Can't raycast a mesh with a null direction");
+    }
+    else
+    {
+        // the distances are measured along a unit direction
+        Math::Normalize(direction);
+        Mesh::MeshRef mesh = RenderCollection::GetResource<Mesh::Mesh>(renderCollection, meshId);
+        Mesh::MeshRayHit hit;
+        if (mesh->Raycast(Math::Ray(origin, direction), maxDistance, hit))
+        {
+            result = Math::Vec4(hit.mDistance, static_cast<float>(hit.mTriangle), hit.mU, hit.mV);
+        }
+    }
+    return result;
+}
+
+void Render_UnbindMesh()
 {
     Pegasus::Render::UnbindMesh();
 }
 
-void Render_UnbindComputeOutputs(FunCallbackContext& context)
+void Render_UnbindComputeOutputs()
 {
     Pegasus::Render::UnbindComputeOutputs();
 }
 
-void Render_UnbindRenderTargets(FunCallbackContext& context)
+void Render_UnbindRenderTargets()
 {
     Pegasus::Render::UnbindRenderTargets();
 }
 
-void Render_UnbindComputeResources(FunCallbackContext& context)
+void Render_UnbindComputeResources()
 {
     Pegasus::Render::UnbindComputeResources();
 }
-void Render_UnbindVertexResources(FunCallbackContext& context)
+void Render_UnbindVertexResources()
 {
     Pegasus::Render::UnbindVertexResources();
 }
-void Render_UnbindPixelResources(FunCallbackContext& context)
+void Render_UnbindPixelResources()
 {
     Pegasus::Render::UnbindPixelResources();
 }
 
-void Render_SetViewport(FunCallbackContext& context)
+void Render_SetViewport(BsVmState* state, const Render::Viewport& viewport)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     CHECK_PERMISSIONS(GetContainer(state), "SetViewport", PERMISSIONS_RENDER_API_CALL);
-    Render::Viewport& viewport = stream.NextArgument<Render::Viewport>();
     Render::SetViewport(viewport);
 }
 
-void Render_SetViewport2(FunCallbackContext& context)
+void Render_SetViewport2(BsVmState* state, RenderTargetHandle handle)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
     CHECK_PERMISSIONS(collection, "SetViewport", PERMISSIONS_RENDER_API_CALL);
-    RenderCollection::CollectionHandle& handle = stream.NextArgument<RenderCollection::CollectionHandle>();
     if (handle != RenderCollection::INVALID_HANDLE)
     {
         Render::RenderTargetRef rt = RenderCollection::GetResource<Render::RenderTarget>(collection, handle);
@@ -1777,17 +1512,14 @@ void Render_SetViewport2(FunCallbackContext& context)
     }
 }
 
-void Render_SetViewport3(FunCallbackContext& context)
+void Render_SetViewport3(DepthStencilHandle handle)
 {
 }
 
-void Render_SetRenderTarget(FunCallbackContext& context)
+void Render_SetRenderTarget(BsVmState* state, RenderTargetHandle rtHandle)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "SetRenderTarget", PERMISSIONS_RENDER_API_CALL);
-    RenderCollection::CollectionHandle& rtHandle = stream.NextArgument<RenderCollection::CollectionHandle>();
     if (rtHandle != RenderCollection::INVALID_HANDLE)
     {
         Render::RenderTargetRef rt = RenderCollection::GetResource<Render::RenderTarget>(renderCollection,rtHandle);
@@ -1798,14 +1530,10 @@ void Render_SetRenderTarget(FunCallbackContext& context)
         PG_LOG('ERR_', "Invalid render target being set");
     }
 }
-void Render_SetRenderTarget2(FunCallbackContext& context) 
+void Render_SetRenderTarget2(BsVmState* state, RenderTargetHandle rtHandle, DepthStencilHandle dtHandle) 
 { 
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "SetRenderTarget2", PERMISSIONS_RENDER_API_CALL);
-    RenderCollection::CollectionHandle& rtHandle = stream.NextArgument<RenderCollection::CollectionHandle>();
-    RenderCollection::CollectionHandle& dtHandle = stream.NextArgument<RenderCollection::CollectionHandle>();
     if (rtHandle != RenderCollection::INVALID_HANDLE && dtHandle != RenderCollection::INVALID_HANDLE)
     {
         Render::RenderTargetRef rt = RenderCollection::GetResource<Render::RenderTarget>(renderCollection,rtHandle);
@@ -1818,15 +1546,10 @@ void Render_SetRenderTarget2(FunCallbackContext& context)
     }
 }
 
-void Render_SetRenderTargets(FunCallbackContext& context)
+void Render_SetRenderTargets(BsVmState* state, int targetCounts, void* targets, DepthStencilHandle depthHandle)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "SetRenderTarget", PERMISSIONS_RENDER_API_CALL);
-    int targetCounts = stream.NextArgument<int>();
-    int targetsOffset = stream.NextArgument<int>();
-    RenderCollection::CollectionHandle depthHandle = stream.NextArgument<RenderCollection::CollectionHandle>();
     
     if (targetCounts >= Pegasus::Render::Constants::MAX_RENDER_TARGETS)
     {
@@ -1852,12 +1575,11 @@ void Render_SetRenderTargets(FunCallbackContext& context)
     */
 
     
-    PG_ASSERT(targetsOffset < state->GetRamSize());
-    char* targetsPtr = state->Ram() + targetsOffset;
-    RenderCollection::CollectionHandle* handles = reinterpret_cast<RenderCollection::CollectionHandle*>(targetsPtr);
+    PG_ASSERT(static_cast<char*>(targets) < state->Ram() + state->GetRamSize());
+    RenderCollection::CollectionHandle* handles = static_cast<RenderCollection::CollectionHandle*>(targets);
 
     //dump all into temp buffer
-    Pegasus::Render::RenderTargetRef targets[Pegasus::Render::Constants::MAX_RENDER_TARGETS];
+    Pegasus::Render::RenderTargetRef renderTargets[Pegasus::Render::Constants::MAX_RENDER_TARGETS];
     for (int i = 0; i < targetCounts; ++i)
     {
         if (handles[i] == RenderCollection::INVALID_HANDLE)
@@ -1867,9 +1589,9 @@ void Render_SetRenderTargets(FunCallbackContext& context)
         }
         else
         {
-            targets[i] = RenderCollection::GetResource<Render::RenderTarget>(renderCollection, handles[i]);
+            renderTargets[i] = RenderCollection::GetResource<Render::RenderTarget>(renderCollection, handles[i]);
             //relly on valid target for this function to work.
-            if (targets[i]==nullptr)
+            if (renderTargets[i]==nullptr)
             {
                 PG_LOG('ERR_', "Invalid target bound on * type of SetRenderTargets! Make sure you pass a static array of RenderTarget");
                 return;
@@ -1884,66 +1606,54 @@ void Render_SetRenderTargets(FunCallbackContext& context)
     }
     Render::DepthStencilRef depthStencil = RenderCollection::GetResource<Render::DepthStencil>(renderCollection,depthHandle);
     PG_ASSERT(depthStencil != nullptr);
-    Pegasus::Render::SetRenderTargets(targetCounts, targets, depthStencil);
+    Pegasus::Render::SetRenderTargets(targetCounts, renderTargets, depthStencil);
 }
 
-void Render_SetRenderTargets2(FunCallbackContext& context)
+void Render_SetRenderTargets2(int targetCounts, void* targets)
 {
     PG_LOG('ERR_', "Unimplemented");
 }
 
-void Render_SetDefaultRenderTarget(FunCallbackContext& context)
+void Render_SetDefaultRenderTarget(BsVmState* state)
 {
 #if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
-    RenderCollection* renderCollection = GetContainer(context.GetVmState());
+    RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "SetDefaultRenderTarget", PERMISSIONS_RENDER_API_CALL);
 #endif
     Pegasus::Render::DispatchDefaultRenderTarget();
 }
 
-void Render_SetPrimitiveMode(FunCallbackContext& context)
+void Render_SetPrimitiveMode(BsVmState* state, Render::PrimitiveMode mode)
 {
 #if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
-    RenderCollection* renderCollection = GetContainer(context.GetVmState());
+    RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "SetPrimitiveMode", PERMISSIONS_RENDER_API_CALL);
 #endif
-    PG_ASSERT(context.GetInputBufferSize() == sizeof(Pegasus::Render::PrimitiveMode));
-    FunParamStream stream(context);
-    Render::SetPrimitiveMode(stream.NextArgument<Pegasus::Render::PrimitiveMode>());
+    Render::SetPrimitiveMode(mode);
 }
 
-void Render_Clear(FunCallbackContext& context)
+void Render_Clear(BsVmState* state, int color, int depth, int stencil)
 {
-    PG_ASSERT(context.GetInputBufferSize() == 3 * sizeof(int));
-    FunParamStream stream(context);
 #if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
-    RenderCollection* renderCollection = GetContainer(context.GetVmState());
+    RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "SetPrimitiveMode", PERMISSIONS_RENDER_API_CALL);
 #endif
-    bool col = stream.NextArgument<int>() != 0;
-    bool depth = stream.NextArgument<int>() != 0;
-    bool stencil = stream.NextArgument<int>() != 0;
-    Render::Clear(col, depth, stencil);
+    Render::Clear(color != 0, depth != 0, stencil != 0);
 }
 
-void Render_SetClearColorValue(FunCallbackContext& context)
+void Render_SetClearColorValue(BsVmState* state, const Math::ColorRGBA& color)
 {
-    FunParamStream stream(context);
 #if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
-    RenderCollection* renderCollection = GetContainer(context.GetVmState());
+    RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "SetClearColorValue", PERMISSIONS_RENDER_API_CALL);
 #endif
-    Math::ColorRGBA& color = stream.NextArgument<Math::ColorRGBA>();
     Render::SetClearColorValue(color);
 }
 
-void Render_SetRasterizerState(FunCallbackContext& context)
+void Render_SetRasterizerState(BsVmState* state, RasterizerStateHandle handle)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
     CHECK_PERMISSIONS(collection, "SetRasterizerState", PERMISSIONS_RENDER_API_CALL);
-    RenderCollection::CollectionHandle& handle = stream.NextArgument<RenderCollection::CollectionHandle>();
     if (handle != RenderCollection::INVALID_HANDLE)
     {
         Render::RasterizerStateRef rasterState = RenderCollection::GetResource<Render::RasterizerState>(collection, handle);
@@ -1955,13 +1665,10 @@ void Render_SetRasterizerState(FunCallbackContext& context)
     }
 }
 
-void Render_SetBlendingState(FunCallbackContext& context)
+void Render_SetBlendingState(BsVmState* state, BlendingStateHandle handle)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
     CHECK_PERMISSIONS(collection, "SetBlendingState", PERMISSIONS_RENDER_API_CALL);
-    RenderCollection::CollectionHandle& handle = stream.NextArgument<RenderCollection::CollectionHandle>();
     if (handle != RenderCollection::INVALID_HANDLE)
     {
         Render::BlendingStateRef blendState = RenderCollection::GetResource<Render::BlendingState>(collection, handle);
@@ -1973,16 +1680,12 @@ void Render_SetBlendingState(FunCallbackContext& context)
     }
 }
 
-void Render_SetComputeSampler(FunCallbackContext& context)
+void Render_SetComputeSampler(BsVmState* state, SamplerStateHandle handle, int slot)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
     CHECK_PERMISSIONS(collection, "SetBlendingState", PERMISSIONS_RENDER_API_CALL);
-    RenderCollection::CollectionHandle& handle = stream.NextArgument<RenderCollection::CollectionHandle>();
     if (handle != RenderCollection::INVALID_HANDLE)
     {
-        int slot = stream.NextArgument<int>();
         Render::SamplerStateRef samplerState = RenderCollection::GetResource<Render::SamplerState>(collection, handle);
         Render::SetComputeSampler(samplerState, slot);
     }
@@ -1992,16 +1695,12 @@ void Render_SetComputeSampler(FunCallbackContext& context)
     }
 }
 
-void Render_SetPixelSampler(FunCallbackContext& context)
+void Render_SetPixelSampler(BsVmState* state, SamplerStateHandle handle, int slot)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
     CHECK_PERMISSIONS(collection, "SetBlendingState", PERMISSIONS_RENDER_API_CALL);
-    RenderCollection::CollectionHandle& handle = stream.NextArgument<RenderCollection::CollectionHandle>();
     if (handle != RenderCollection::INVALID_HANDLE)
     {
-        int slot = stream.NextArgument<int>();
         Render::SamplerStateRef samplerState = RenderCollection::GetResource<Render::SamplerState>(collection, handle);
         Render::SetPixelSampler(samplerState, slot);
     }
@@ -2011,18 +1710,14 @@ void Render_SetPixelSampler(FunCallbackContext& context)
     }
 }
 
-void Render_SetVertexSampler(FunCallbackContext& context)
+void Render_SetVertexSampler(BsVmState* state, SamplerStateHandle handle, int slot)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
     RenderCollection* collection = GetContainer(state);
     CHECK_PERMISSIONS(collection, "SetBlendingState", PERMISSIONS_RENDER_API_CALL);
-    RenderCollection::CollectionHandle& handle = stream.NextArgument<RenderCollection::CollectionHandle>();
     if (handle != RenderCollection::INVALID_HANDLE)
     {
-        int slot = stream.NextArgument<int>();
         Render::SamplerStateRef samplerState = RenderCollection::GetResource<Render::SamplerState>(collection, handle);
-        Render::SetVertexSampler(samplerState,slot);
+        Render::SetVertexSampler(samplerState, slot);
     }
     else
     {
@@ -2030,97 +1725,74 @@ void Render_SetVertexSampler(FunCallbackContext& context)
     }
 }
 
-void Render_SetDepthClearValue(FunCallbackContext& context)
+void Render_SetDepthClearValue(BsVmState* state, float depthClearVal)
 {
-    FunParamStream stream(context);
 #if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
-    RenderCollection* renderCollection = GetContainer(context.GetVmState());
+    RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "setDepthClearValue", PERMISSIONS_RENDER_API_CALL);
 #endif
-    float& depthClearVal = stream.NextArgument<float>();
     Render::SetDepthClearValue(depthClearVal);
 }
 
-void Render_Draw(FunCallbackContext& context)
+void Render_Draw(BsVmState* state)
 {
 #if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
-    RenderCollection* renderCollection = GetContainer(context.GetVmState());
+    RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "Draw", PERMISSIONS_RENDER_API_CALL);
 #endif
     Render::Draw();
 }
 
-void Render_Dispatch(FunCallbackContext& context)
+void Render_Dispatch(BsVmState* state, int x, int y, int z)
 {
 #if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
-    RenderCollection* renderCollection = GetContainer(context.GetVmState());
+    RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "Dispatch", PERMISSIONS_RENDER_API_CALL);
 #endif
-    FunParamStream stream(context);
-    int x = stream.NextArgument<int>();
-    int y = stream.NextArgument<int>();
-    int z = stream.NextArgument<int>();
     Render::Dispatch(
        static_cast<unsigned int>(x),
        static_cast<unsigned int>(y),
        static_cast<unsigned int>(z));
 }
 
-void Render_CreateRenderTarget(FunCallbackContext& context)
+RenderTargetHandle Render_CreateRenderTarget(BsVmState* state, Render::RenderTargetConfig& config)
 {
-    FunParamStream stream(context);
-    BsVmState* vmState = context.GetVmState();
-    Application::RenderCollection* renderCollection = GetContainer(vmState);
-    CHECK_PERMISSIONS(renderCollection, "CreateRenderTarget", PERMISSIONS_RENDER_API_CALL);
-    Render::RenderTargetConfig& config = stream.NextArgument<Render::RenderTargetConfig>();
-    Render::RenderTargetRef rt = Render::CreateRenderTarget(config);
-    stream.SubmitReturn( RenderCollection::AddResource<Render::RenderTarget>( renderCollection, rt));
+    Application::RenderCollection* renderCollection = GetContainer(state);
+    CHECK_PERMISSIONS_RETURN(renderCollection, "CreateRenderTarget", PERMISSIONS_RENDER_API_CALL, RenderCollection::INVALID_HANDLE);
+    Render::RenderTargetRef resource = Render::CreateRenderTarget(config);
+    return RenderCollection::AddResource<Render::RenderTarget>(renderCollection, resource);
 }
 
-void Render_CreateDepthStencil(FunCallbackContext& context)
+DepthStencilHandle Render_CreateDepthStencil(BsVmState* state, const Render::DepthStencilConfig& config)
 {
-    FunParamStream stream(context);
-    BsVmState* vmState = context.GetVmState();
-    Application::RenderCollection* renderCollection = GetContainer(vmState);
-    CHECK_PERMISSIONS(renderCollection, "CreateDepthStencil", PERMISSIONS_RENDER_API_CALL);
-    Render::DepthStencilConfig& config = stream.NextArgument<Render::DepthStencilConfig>();
-    Render::DepthStencilRef rt = Render::CreateDepthStencil(config);
-    stream.SubmitReturn( RenderCollection::AddResource<Render::DepthStencil>(renderCollection, rt));
+    Application::RenderCollection* renderCollection = GetContainer(state);
+    CHECK_PERMISSIONS_RETURN(renderCollection, "CreateDepthStencil", PERMISSIONS_RENDER_API_CALL, RenderCollection::INVALID_HANDLE);
+    Render::DepthStencilRef resource = Render::CreateDepthStencil(config);
+    return RenderCollection::AddResource<Render::DepthStencil>(renderCollection, resource);
 }
 
-void Render_CreateRasterizerState(FunCallbackContext& context)
+RasterizerStateHandle Render_CreateRasterizerState(BsVmState* state, const Render::RasterizerConfig& rasterConfig)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
-    RenderCollection* collection = GetContainer(state);
-    CHECK_PERMISSIONS(collection, "CreateRasterizerState", PERMISSIONS_RENDER_API_CALL);
-    Render::RasterizerConfig& rasterConfig = stream.NextArgument<Render::RasterizerConfig>();
-    Render::RasterizerStateRef rasterState = Render::CreateRasterizerState(rasterConfig);
-    stream.SubmitReturn( RenderCollection::AddResource<Render::RasterizerState>(collection, rasterState) );
+    Application::RenderCollection* collection = GetContainer(state);
+    CHECK_PERMISSIONS_RETURN(collection, "CreateRasterizerState", PERMISSIONS_RENDER_API_CALL, RenderCollection::INVALID_HANDLE);
+    Render::RasterizerStateRef resource = Render::CreateRasterizerState(rasterConfig);
+    return RenderCollection::AddResource<Render::RasterizerState>(collection, resource);
 }
 
-void Render_CreateBlendingState(FunCallbackContext& context)
+BlendingStateHandle Render_CreateBlendingState(BsVmState* state, const Render::BlendingConfig& blendConfig)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
-    RenderCollection* collection = GetContainer(state);
-    CHECK_PERMISSIONS(collection, "CreateBlendingState", PERMISSIONS_RENDER_API_CALL);
-    
-    Render::BlendingConfig* blendConfig = static_cast<Render::BlendingConfig*>(context.GetRawInputBuffer());
-    Render::BlendingStateRef blendState = Render::CreateBlendingState(*blendConfig);
-    stream.SubmitReturn( RenderCollection::AddResource<Render::BlendingState>(collection, blendState) );
+    Application::RenderCollection* collection = GetContainer(state);
+    CHECK_PERMISSIONS_RETURN(collection, "CreateBlendingState", PERMISSIONS_RENDER_API_CALL, RenderCollection::INVALID_HANDLE);
+    Render::BlendingStateRef resource = Render::CreateBlendingState(blendConfig);
+    return RenderCollection::AddResource<Render::BlendingState>(collection, resource);
 }
 
-void Render_CreateSamplerState(FunCallbackContext& context)
+SamplerStateHandle Render_CreateSamplerState(BsVmState* state, const Render::SamplerStateConfig& config)
 {
-    FunParamStream stream(context);
-    BsVmState* state = context.GetVmState();
-    RenderCollection* collection = GetContainer(state);
-    CHECK_PERMISSIONS(collection, "CreateSamplerState", PERMISSIONS_RENDER_API_CALL);
-    
-    Render::SamplerStateConfig* cfg = static_cast<Render::SamplerStateConfig*>(context.GetRawInputBuffer());
-    Render::SamplerStateRef samplerState = Render::CreateSamplerState(*cfg);
-    stream.SubmitReturn( RenderCollection::AddResource<Render::SamplerState>(collection, samplerState) );
+    Application::RenderCollection* collection = GetContainer(state);
+    CHECK_PERMISSIONS_RETURN(collection, "CreateSamplerState", PERMISSIONS_RENDER_API_CALL, RenderCollection::INVALID_HANDLE);
+    Render::SamplerStateRef resource = Render::CreateSamplerState(config);
+    return RenderCollection::AddResource<Render::SamplerState>(collection, resource);
 }
 
 
@@ -2242,16 +1914,11 @@ void GlobalCache_Find<T>(FunCallbackContext& context)
 }
 
 template<class T>
-void Render_SetComputeOutputs(FunCallbackContext& context)
+void Render_SetComputeOutputs(BsVmState* state, ObjectHandle<T> resourceHandle, int slotId)
 {
-    FunParamStream stream(context);
-    BsVmState* vmState = context.GetVmState();
-    Application::RenderCollection* renderCollection = GetContainer(vmState);
+    Application::RenderCollection* renderCollection = GetContainer(state);
     CHECK_PERMISSIONS(renderCollection, "SetComputeOutputs", PERMISSIONS_RENDER_API_CALL);
 
-    RenderCollection::CollectionHandle resourceHandle = stream.NextArgument<RenderCollection::CollectionHandle>();
-    int slotId = stream.NextArgument<int>();
-
     if (resourceHandle == RenderCollection::INVALID_HANDLE)
     {
         PG_LOG('ERR_', "No resource found in call of SetComputeOutputs");
@@ -2263,23 +1930,20 @@ void Render_SetComputeOutputs(FunCallbackContext& context)
     }
 }
 
-void Render_BeginMarker(FunCallbackContext& context)
+void Render_BeginMarker(const char* markerName)
 {
-    FunParamStream stream(context);
-    const char* markerName = stream.NextBsStringArgument();
     Render::BeginMarker(markerName);
 }
 
-void Render_EndMarker(FunCallbackContext& context)
+void Render_EndMarker()
 {
     Render::EndMarker();
 }
 
-void Render_CreateSimpleRasterConfig(FunCallbackContext& context)
+Render::RasterizerConfig Render_CreateSimpleRasterConfig(Render::RasterizerConfig::PegasusCullMode cullMode, Render::RasterizerConfig::PegasusRasterFunc depthFunc)
 {
-    FunParamStream stream(context);
-    PG_ASSERT(sizeof(Render::RasterizerConfig) == context.GetOutputBufferSize());
-    Render::RasterizerConfig* outputConfig = reinterpret_cast<Render::RasterizerConfig*>(context.GetRawOutputBuffer());
-    outputConfig->mCullMode = stream.NextArgument<Render::RasterizerConfig::PegasusCullMode>();
-    outputConfig->mDepthFunc = stream.NextArgument<Render::RasterizerConfig::PegasusRasterFunc>();
+    Render::RasterizerConfig config;
+    config.mCullMode = cullMode;
+    config.mDepthFunc = depthFunc;
+    return config;
 }
@@ -214,7 +214,13 @@ Io::IoError Pegasus::AssetLib::AssetLib::InternalBuildAsset(Asset** assetOut, bo
     isStructured = isPreallocated ? (*assetOut)->GetFormat() == Asset::FMT_STRUCTURED : isStructured;
 
     Io::FileBuffer fileBuffer;
+#if PEGASUS_ASSETLIB_MAP_RAW_ASSETS
+    //raw assets are never parsed, so map them instead of copying them to the heap.
+    //The view only lives until the runtime object has read the asset (see RuntimeAssetObject::Read)
+    Io::IoError err = isStructured ? mIoMgr->OpenFileToBuffer(path, fileBuffer, true, mAllocator) : mIoMgr->MapFileToBuffer(path, fileBuffer, mAllocator);
+#else
     Io::IoError err = mIoMgr->OpenFileToBuffer(path, fileBuffer, true, mAllocator); //open the raw file first
+#endif
 
     if (err == Io::ERR_NONE)
     {
@@ -347,6 +353,14 @@ Io::IoError Pegasus::AssetLib::AssetLib::SaveAsset(Asset* asset)
     }
     else
     {
+        //the raw contents are released once read by the runtime object, which writes them back
+        if (asset->GetRuntimeData() != nullptr)
+        {
+            asset->GetRuntimeData()->Write(asset);
+        }
+
+        //the file cannot be overwritten while a view of it is mapped
+        asset->Raw()->ResolveMapping();
         return mIoMgr->SaveFileToBuffer(asset->GetPath(), *asset->Raw());
     }
 }
@@ -40,6 +40,13 @@ bool RuntimeAssetObject::Read(Asset* asset)
     AssetLib* lib = asset->GetLib();
     Bind(asset);
     bool ret = OnReadAsset(lib, asset);
+
+    //objects reading raw assets keep their own copy of the contents, so the file buffer is released right away.
+    //A mapped view of the file would also stop external editors from saving it
+    if (asset->GetFormat() == Asset::FMT_RAW)
+    {
+        asset->Raw()->DestroyBuffer();
+    }
     PEGASUS_EVENT_DISPATCH(lib, RuntimeAssetObjectCreated, &mProxy);
 
     return ret;
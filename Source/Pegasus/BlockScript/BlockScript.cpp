@@ -81,6 +81,93 @@ bool BlockScript::BlockScript::ExecuteFunction(
     );
 }
 
+bool BlockScript::BlockScript::ExecuteFunctionWhileSuspended(
+    BsVmState* vmState,
+    FunBindPoint functionBindPoint,
+    const void* inputBuffer,
+    int   inputBufferSize,
+    void* outputBuffer,
+    int   outputBufferSize
+)
+{
+    return Pegasus::BlockScript::ExecuteFunctionWhileSuspended(
+        functionBindPoint,
+        &mBuilder,
+        GetAsm(),
+        *vmState,
+        mVm,
+        inputBuffer,
+        inputBufferSize,
+        outputBuffer,
+        outputBufferSize
+    );
+}
+
+bool BlockScript::BlockScript::ResumeExecution(
+    BsVmState* vmState,
+    void* outputBuffer,
+    int   outputBufferSize
+)
+{
+    return Pegasus::BlockScript::ResumeExecution(
+        GetAsm(),
+        *vmState,
+        mVm,
+        outputBuffer,
+        outputBufferSize
+    );
+}
+
+int BlockScript::BlockScript::ExecuteFunctionParallel(
+    BsVmState* const* vmStates,
+    int          stateCount,
+    FunBindPoint functionBindPoint,
+    const void* inputBuffers,
+    int   inputBufferSize,
+    void* outputBuffers,
+    int   outputBufferSize,
+    unsigned int workerCount
+)
+{
+    return Pegasus::BlockScript::ExecuteFunctionParallel(
+        functionBindPoint,
+        &mBuilder,
+        GetAsm(),
+        vmStates,
+        stateCount,
+        mVm,
+        inputBuffers,
+        inputBufferSize,
+        outputBuffers,
+        outputBufferSize,
+        workerCount
+    );
+}
+
+bool BlockScript::BlockScript::ExecuteFunctionBatch(
+    BsVmState*   vmState,
+    FunBindPoint functionBindPoint,
+    const void* inputBuffers,
+    int   inputBufferSize,
+    void* outputBuffers,
+    int   outputBufferSize,
+    int   instanceCount
+)
+{
+    return Pegasus::BlockScript::ExecuteFunctionBatch(
+        functionBindPoint,
+        &mBuilder,
+        GetAsm(),
+        *vmState,
+        mVm,
+        inputBuffers,
+        inputBufferSize,
+        outputBuffers,
+        outputBufferSize,
+        instanceCount
+    );
+}
+
 void BlockScript::BlockScript::ReadGlobalValue(
     BsVmState*   vmState,
     GlobalBindPoint bindPoint,
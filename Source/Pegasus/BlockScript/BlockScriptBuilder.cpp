@@ -219,6 +219,7 @@ StackFrameInfo* BlockScriptBuilder::StartNewFrame()
 {
     StackFrameInfo* newFrame = mSymbolTable.CreateFrame();
     newFrame->SetParentStackFrame(mCurrentFrame);
+    newFrame->SetLine(mFileStates.Size() > 0 ? GetCurrentLine() : 0);
     mCurrentFrame = newFrame;
     return newFrame;
 }
@@ -1119,7 +1120,9 @@ StmtExp* BlockScriptBuilder::BuildStmtExp(Exp* exp)
         BS_ErrorDispatcher(this, "Empty expressions not allowed! expression must be a function call, did you forget passing parameters ?");
         return nullptr;
     }
-    return BS_NEW StmtExp(exp);
+    StmtExp* stmtExp = BS_NEW StmtExp(exp);
+    stmtExp->SetLine(GetCurrentLine());
+    return stmtExp;
 }
 
 StmtReturn* BlockScriptBuilder::BuildStmtReturn(Exp* exp)
@@ -1141,7 +1144,16 @@ StmtReturn* BlockScriptBuilder::BuildStmtReturn(Exp* exp)
         BS_ErrorDispatcher(this, "return type must match that of the current function context.");
         return nullptr;
     }
-    return BS_NEW StmtReturn(exp);
+    StmtReturn* stmtReturn = BS_NEW StmtReturn(exp);
+    stmtReturn->SetLine(GetCurrentLine());
+    return stmtReturn;
+}
+
+StmtYield* BlockScriptBuilder::BuildStmtYield()
+{
+    StmtYield* stmtYield = BS_NEW StmtYield();
+    stmtYield->SetLine(GetCurrentLine());
+    return stmtYield;
 }
 
 FunDesc* BlockScriptBuilder::RegisterFunctionDeclaration(Ast::StmtFunDec* funDec)
@@ -1155,6 +1167,7 @@ StmtFunDec* BlockScriptBuilder::BuildStmtFunDec(Ast::ArgList* argList, const Typ
 
 
     StmtFunDec* funDec = BS_NEW StmtFunDec(argList, returnType, nameIdd);
+    funDec->SetLine(mCurrentFrame->GetLine());
 
     // record the frame for this function
     funDec->SetFrame(mCurrentFrame);
@@ -1202,6 +1215,7 @@ StmtWhile* BlockScriptBuilder::BuildStmtWhile(Exp* exp, StmtList* stmtList)
     StmtWhile* stmtWhile = BS_NEW StmtWhile(exp, stmtList);
 
     stmtWhile->SetFrame(mCurrentFrame);
+    stmtWhile->SetLine(mCurrentFrame->GetLine());
 
     mCurrentFrame->SetCreatorCategory(StackFrameInfo::LOOP);
 
@@ -1221,6 +1235,7 @@ StmtFor* BlockScriptBuilder::BuildStmtFor(Exp* init, Exp* cond, Exp* update, Stm
 
     StmtFor* stmtFor = BS_NEW StmtFor(init, cond, update, stmtList);
     stmtFor->SetFrame(mCurrentFrame);
+    stmtFor->SetLine(mCurrentFrame->GetLine());
 
     //pop the previous frame
     PopFrame();
@@ -1236,6 +1251,7 @@ StmtIfElse* BlockScriptBuilder::BuildStmtIfElse(Exp* exp, StmtList* ifBlock, Stm
         return nullptr;
     }
     StmtIfElse* stmtIfElse = BS_NEW StmtIfElse(exp, ifBlock, tail, frame);
+    stmtIfElse->SetLine(frame != nullptr ? frame->GetLine() : GetCurrentLine());
 
     mCurrentFrame->SetCreatorCategory(StackFrameInfo::IF_STMT);
 
@@ -1349,6 +1365,11 @@ static void StructGenericConstructor(FunCallbackContext& ctx)
     }
 }
 
+FunCallback BlockScriptBuilder::GetStructConstructorCallback()
+{
+    return StructGenericConstructor;
+}
+
 StmtEnumTypeDef* BlockScriptBuilder::BuildStmtEnumTypeDef(const TypeDesc* typeDesc)
 {
     PG_ASSERT(typeDesc != nullptr);
@@ -0,0 +1,2290 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BlockScriptCache.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Serialization of compiled scripts (abstract syntax tree, symbol table, assembly
+//!         and globals) into a binary cache, loaded instead of compiling when still valid.
+
+#include "Pegasus/BlockScript/BlockScriptCache.h"
+#include "Pegasus/BlockScript/BlockScriptAst.h"
+#include "Pegasus/BlockScript/BlockScriptCanon.h"
+#include "Pegasus/BlockScript/IFileIncluder.h"
+#include "Pegasus/BlockScript/SymbolTable.h"
+#include "Pegasus/BlockScript/FunDesc.h"
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Utils/ByteStream.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/String.h"
+#include "Pegasus/Core/Io.h"
+#include "Pegasus/Core/Assertion.h"
+
+using namespace Pegasus;
+using namespace Pegasus::BlockScript;
+using namespace Pegasus::BlockScript::Ast;
+
+namespace
+{
+
+//! Identifier of the cached content ('BSBC')
+const int CACHE_MAGIC = 0x43425342;
+
+//! Layout of the cached content:
+//!   header: magic, version, key, includes (path and hash), payload size and payload hash
+//!   payload: frame count, then object records (strings, types, frames, nodes) until R_END_OBJECTS,
+//!            then the program, the functions of the script, the blocks, the function map and the globals.
+//! Objects are referenced by id, the ids being given in the order of the records starting at 1, 0 being null.
+//! Records only reference objects written before them. Frames are referenced by index, -1 being null.
+//! Functions are referenced by table and index, table 0 being the script and the next ones the libraries.
+enum RecordType
+{
+    R_STRING,           //!< string object
+    R_TYPE,             //!< type of the script
+    R_EXTERN_TYPE,      //!< type of a library
+    R_EXTERN_PROPERTY,  //!< property node of an object type of a library
+    R_FRAME,            //!< content of a stack frame of the script
+    R_END_OBJECTS,      //!< end of the object records
+
+    //abstract syntax tree node objects, one record per node class
+    #define BS_PROCESS(N) R_NODE_##N,
+    #include "Pegasus/BlockScript/Ast.inl"
+    #undef BS_PROCESS
+
+    R_COUNT
+};
+
+//! Kinds of loaded objects
+enum ObjectKind
+{
+    OBJ_STRING,
+    OBJ_TYPE,
+    OBJ_PROPERTY,
+    OBJ_NODE
+};
+
+//! Callbacks of functions declared by the scripts
+enum CallbackKind
+{
+    CALLBACK_NONE,
+    CALLBACK_STRUCT_CONSTRUCTOR
+};
+
+//masks of node classes, to validate the references to nodes
+#define NODE_MASK(N) (1u << (R_NODE_##N - R_NODE_Program))
+
+const unsigned int EXP_NODES = NODE_MASK(Idd) | NODE_MASK(Binop) | NODE_MASK(Unop) | NODE_MASK(ArrayConstructor)
+                             | NODE_MASK(FunCall) | NODE_MASK(Imm) | NODE_MASK(StrImm);
+
+const unsigned int STMT_NODES = NODE_MASK(Stmt) | NODE_MASK(StmtExp) | NODE_MASK(StmtFunDec) | NODE_MASK(StmtIfElse)
+                              | NODE_MASK(StmtWhile) | NODE_MASK(StmtFor) | NODE_MASK(StmtReturn) | NODE_MASK(StmtYield)
+                              | NODE_MASK(StmtStructDef) | NODE_MASK(StmtEnumTypeDef);
+
+//----------------------------------------------------------------------------------------
+
+//! Hash accumulator of ints and strings
+class Hasher
+{
+public:
+    Hasher(unsigned long long seed) : mHash(seed) {}
+
+    void Int(int v) { mHash = BlockScriptCache::HashBuffer(&v, sizeof(v), mHash); }
+
+    void Str(const char* str)
+    {
+        if (str == nullptr)
+        {
+            Int(-1);
+        }
+        else
+        {
+            int len = Utils::Strlen(str);
+            Int(len);
+            mHash = BlockScriptCache::HashBuffer(str, len, mHash);
+        }
+    }
+
+    unsigned long long Get() const { return mHash; }
+
+private:
+    unsigned long long mHash;
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Map from pointers to object ids, open addressing
+class PointerMap
+{
+public:
+    explicit PointerMap(Alloc::IAllocator* alloc) : mAllocator(alloc), mKeys(nullptr), mValues(nullptr), mCapacity(0), mSize(0) {}
+
+    ~PointerMap()
+    {
+        if (mKeys != nullptr)
+        {
+            PG_DELETE_ARRAY(mAllocator, mKeys);
+            PG_DELETE_ARRAY(mAllocator, mValues);
+        }
+    }
+
+    //! \return the id of the pointer, 0 if not inserted
+    int Find(const void* key) const
+    {
+        if (mCapacity == 0)
+        {
+            return 0;
+        }
+        for (int i = Hash(key) & (mCapacity - 1); mKeys[i] != nullptr; i = (i + 1) & (mCapacity - 1))
+        {
+            if (mKeys[i] == key)
+            {
+                return mValues[i];
+            }
+        }
+        return 0;
+    }
+
+    //! inserts a pointer not inserted yet
+    void Insert(const void* key, int value)
+    {
+        if (2 * (mSize + 1) > mCapacity)
+        {
+            Grow();
+        }
+        int i = Hash(key) & (mCapacity - 1);
+        while (mKeys[i] != nullptr)
+        {
+            i = (i + 1) & (mCapacity - 1);
+        }
+        mKeys[i] = key;
+        mValues[i] = value;
+        ++mSize;
+    }
+
+private:
+    static int Hash(const void* key)
+    {
+        unsigned long long k = reinterpret_cast<unsigned long long>(key);
+        k ^= k >> 17;
+        k *= 0xed5ad4bbULL;
+        k ^= k >> 11;
+        return static_cast<int>(k & 0x7fffffff);
+    }
+
+    void Grow()
+    {
+        const void** oldKeys = mKeys;
+        int* oldValues = mValues;
+        int oldCapacity = mCapacity;
+
+        mCapacity = mCapacity == 0 ? 256 : 2 * mCapacity;
+        mKeys = PG_NEW_ARRAY(mAllocator, -1, "BlockScriptCache", Alloc::PG_MEM_TEMP, const void*, mCapacity);
+        mValues = PG_NEW_ARRAY(mAllocator, -1, "BlockScriptCache", Alloc::PG_MEM_TEMP, int, mCapacity);
+        for (int i = 0; i < mCapacity; ++i)
+        {
+            mKeys[i] = nullptr;
+        }
+        mSize = 0;
+
+        if (oldKeys != nullptr)
+        {
+            for (int i = 0; i < oldCapacity; ++i)
+            {
+                if (oldKeys[i] != nullptr)
+                {
+                    Insert(oldKeys[i], oldValues[i]);
+                }
+            }
+            PG_DELETE_ARRAY(mAllocator, oldKeys);
+            PG_DELETE_ARRAY(mAllocator, oldValues);
+        }
+    }
+
+    Alloc::IAllocator* mAllocator;
+    const void** mKeys;
+    int* mValues;
+    int mCapacity;
+    int mSize;
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Collects the symbol tables of the libraries, depth first and without duplicates
+void CollectLibraries(const SymbolTable* symbolTable, Container<const SymbolTable*>& libs)
+{
+    for (int c = 0; c < symbolTable->GetChildCount(); ++c)
+    {
+        const SymbolTable* child = symbolTable->GetChild(c);
+        bool found = false;
+        for (int l = 0; l < libs.Size() && !found; ++l)
+        {
+            found = libs[l] == child;
+        }
+        if (!found)
+        {
+            libs.PushEmpty() = child;
+            CollectLibraries(child, libs);
+        }
+    }
+}
+
+//! Gets the symbol table of a table reference
+//! \param script the symbol table of the script, table 0
+//! \param libs the libraries, tables 1 to libs.Size()
+const SymbolTable* GetTable(const SymbolTable* script, const Container<const SymbolTable*>& libs, int table)
+{
+    return table == 0 ? script : libs[table - 1];
+}
+
+//! Finds the table and index of a type
+//! \param script the symbol table of the script, nullptr to only look into the libraries
+//! \return true if found, false otherwise
+bool FindType(const SymbolTable* script, const Container<const SymbolTable*>& libs, const TypeDesc* type, int& outTable, int& outIndex)
+{
+    for (int t = (script != nullptr ? 0 : 1); t <= libs.Size(); ++t)
+    {
+        const TypeTable* typeTable = GetTable(script, libs, t)->GetTypeTable();
+        for (int i = 0; i < typeTable->GetTypeCount(); ++i)
+        {
+            if (typeTable->GetTypeByIndex(i) == type)
+            {
+                outTable = t;
+                outIndex = i;
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+//! Finds the table and index of a function description
+//! \return true if found, false otherwise
+bool FindFunDesc(const SymbolTable* script, const Container<const SymbolTable*>& libs, const FunDesc* desc, int& outTable, int& outIndex)
+{
+    const int guid = desc->GetGuid();
+    for (int t = 0; t <= libs.Size(); ++t)
+    {
+        const FunTable* funTable = GetTable(script, libs, t)->GetFunTable();
+        if (guid >= 0 && guid < funTable->GetSize() && funTable->GetDesc(guid) == desc)
+        {
+            outTable = t;
+            outIndex = guid;
+            return true;
+        }
+    }
+    return false;
+}
+
+//! Hashes a reference to a type of the libraries
+void HashTypeRef(Hasher& h, const Container<const SymbolTable*>& libs, const TypeDesc* type)
+{
+    int table = -1;
+    int index = -1;
+    if (type != nullptr)
+    {
+        FindType(nullptr, libs, type, table, index);
+    }
+    h.Int(table);
+    h.Int(index);
+}
+
+//! Hashes the argument list of a declaration of the libraries
+void HashArgList(Hasher& h, const Container<const SymbolTable*>& libs, const ArgList* argList)
+{
+    for (; argList != nullptr && argList->GetArgDec() != nullptr; argList = argList->GetTail())
+    {
+        h.Str(argList->GetArgDec()->GetVar());
+        HashTypeRef(h, libs, argList->GetArgDec()->GetType());
+    }
+    h.Int(-1);
+}
+
+//! Hashes what the scripts can reference from a library: its types and functions
+void HashLibrary(Hasher& h, const Container<const SymbolTable*>& libs, const SymbolTable* lib)
+{
+    const TypeTable* typeTable = lib->GetTypeTable();
+    h.Int(typeTable->GetTypeCount());
+    for (int i = 0; i < typeTable->GetTypeCount(); ++i)
+    {
+        const TypeDesc* type = typeTable->GetTypeByIndex(i);
+        h.Str(type->GetName());
+        h.Int(type->GetModifier());
+        h.Int(type->GetAluEngine());
+        h.Int(type->GetModifierProperty().ArraySize);
+        h.Int(type->GetByteSize());
+        h.Int(type->GetPropertyCallback() != nullptr);
+        HashTypeRef(h, libs, type->GetChild());
+        if (type->GetStructDef() != nullptr)
+        {
+            HashArgList(h, libs, type->GetStructDef()->GetArgList());
+        }
+        for (const EnumNode* e = type->GetEnumNode(); e != nullptr; e = e->mNext)
+        {
+            h.Str(e->mIdd);
+            h.Int(e->mGuid);
+        }
+        for (const PropertyNode* p = type->GetPropertyNode(); p != nullptr; p = p->mNext)
+        {
+            h.Str(p->mName);
+            h.Int(p->mGuid);
+            HashTypeRef(h, libs, p->mType);
+        }
+    }
+
+    const FunTable* funTable = lib->GetFunTable();
+    h.Int(funTable->GetSize());
+    for (int f = 0; f < funTable->GetSize(); ++f)
+    {
+        const FunDesc* desc = funTable->GetDesc(f);
+        const StmtFunDec* dec = desc->GetDec();
+        h.Str(dec->GetName());
+        HashArgList(h, libs, dec->GetArgList());
+        HashTypeRef(h, libs, dec->GetReturnType());
+        h.Int(desc->IsMethod());
+        h.Int(desc->IsCallback());
+        h.Int(desc->GetInputArgumentsByteSize());
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Sequential reader of cached content, failing on any read past the end
+class CacheStream
+{
+public:
+    CacheStream(const char* buffer, int bufferSize) : mBuffer(buffer), mSize(bufferSize), mPos(0), mFailed(false) {}
+
+    const char* ReadBytes(int size)
+    {
+        if (mFailed || size < 0 || size > mSize - mPos)
+        {
+            mFailed = true;
+            return nullptr;
+        }
+        const char* bytes = mBuffer + mPos;
+        mPos += size;
+        return bytes;
+    }
+
+    int ReadInt()
+    {
+        int v = 0;
+        const char* bytes = ReadBytes(sizeof(v));
+        if (bytes != nullptr)
+        {
+            Utils::Memcpy(&v, bytes, sizeof(v));
+        }
+        return v;
+    }
+
+    unsigned long long ReadU64()
+    {
+        unsigned long long v = 0;
+        const char* bytes = ReadBytes(sizeof(v));
+        if (bytes != nullptr)
+        {
+            Utils::Memcpy(&v, bytes, sizeof(v));
+        }
+        return v;
+    }
+
+    //! reads a string written with WriteInlineString, not null terminated
+    const char* ReadInlineString(int& outLength)
+    {
+        outLength = ReadInt();
+        return ReadBytes(outLength);
+    }
+
+    void Fail() { mFailed = true; }
+    bool HasFailed() const { return mFailed; }
+    bool IsAtEnd() const { return mPos == mSize; }
+    int GetPosition() const { return mPos; }
+
+private:
+    const char* mBuffer;
+    int mSize;
+    int mPos;
+    bool mFailed;
+};
+
+void WriteInt(Utils::ByteStream& stream, int v)
+{
+    stream.Append(&v, sizeof(v));
+}
+
+void WriteU64(Utils::ByteStream& stream, unsigned long long v)
+{
+    stream.Append(&v, sizeof(v));
+}
+
+void WriteInlineString(Utils::ByteStream& stream, const char* str)
+{
+    int len = Utils::Strlen(str);
+    WriteInt(stream, len);
+    stream.Append(str, len);
+}
+
+//! Header of the cached content
+struct CacheHeader
+{
+    BlockScriptCache::Key mKey;
+    int mIncludeCount;
+    int mIncludesPosition;  //!< position of the includes in the content
+    int mPayloadPosition;   //!< position of the payload in the content
+    int mPayloadSize;
+    unsigned long long mPayloadHash;
+};
+
+//! Reads the header of cached content
+//! \return true if the content has been written by this version, false otherwise
+bool ReadHeader(const char* buffer, int bufferSize, CacheHeader& outHeader)
+{
+    CacheStream stream(buffer, bufferSize);
+    if (stream.ReadInt() != CACHE_MAGIC || stream.ReadInt() != BlockScriptCache::VERSION)
+    {
+        return false;
+    }
+    outHeader.mKey.mSourceHash = stream.ReadU64();
+    outHeader.mKey.mDefinitionsHash = stream.ReadU64();
+    outHeader.mKey.mLibSignature = stream.ReadU64();
+    outHeader.mIncludeCount = stream.ReadInt();
+    outHeader.mIncludesPosition = stream.GetPosition();
+    for (int i = 0; i < outHeader.mIncludeCount && !stream.HasFailed(); ++i)
+    {
+        int len = 0;
+        stream.ReadInlineString(len);
+        stream.ReadU64();
+    }
+    outHeader.mPayloadSize = stream.ReadInt();
+    outHeader.mPayloadHash = stream.ReadU64();
+    outHeader.mPayloadPosition = stream.GetPosition();
+    return !stream.HasFailed() && outHeader.mIncludeCount >= 0 && outHeader.mPayloadSize == bufferSize - outHeader.mPayloadPosition;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Writer of the payload, visiting the nodes to write them after the objects they reference
+class CacheWriter : private IVisitor
+{
+public:
+    CacheWriter(Alloc::IAllocator* alloc, SymbolTable* symbolTable, const Container<const SymbolTable*>& libs, Utils::ByteStream& stream)
+    : mSymbolTable(symbolTable), mLibs(libs), mStream(stream), mStringIds(alloc), mObjectIds(alloc),
+      mObjectCount(0), mNodeId(0), mFailed(false), mListStackTop(0)
+    {
+        mForwardDecs.Initialize(alloc);
+        mListStack.Initialize(alloc);
+    }
+
+    virtual ~CacheWriter() {}
+
+    //! writes the payload of a compilation
+    //! \return true if successful, false if the script uses something that cannot be cached
+    bool Write(const BlockScriptBuilder::CompilationResult& result);
+
+private:
+    // visitor functions, writing the node and the objects it references
+    #define BS_PROCESS(N) virtual void Visit(N* n);
+    #include "Pegasus/BlockScript/Ast.inl"
+    #undef BS_PROCESS
+
+    void WriteInt(int v) { ::WriteInt(mStream, v); }
+
+    //! starts the record of a new object
+    //! \return the id of the object
+    int BeginObject(RecordType record, const void* key)
+    {
+        WriteInt(record);
+        ++mObjectCount;
+        mObjectIds.Insert(key, mObjectCount);
+        return mObjectCount;
+    }
+
+    //! each Emit function writes the object if not written yet, and returns its id
+    int EmitString(const char* str);
+    int EmitType(const TypeDesc* type);
+    int EmitProperty(const PropertyNode* prop);
+    int EmitNode(Node* node);
+
+    //! writes a type of the script, after the types it references. The parser patches the children
+    //! of the array types after creating them, so the order of the type table cannot be used
+    //! \return the id of the type
+    int EmitScriptType(const TypeDesc* type);
+
+    //! writes the content of a frame of the script
+    void EmitFrame(StackFrameInfo* frame);
+
+    //! writes the objects referenced by a canonical node
+    void EmitCanonReferences(const Canon::CanonNode* node);
+
+    //! writes a canonical node, once its references are written
+    void WriteCanon(const Canon::CanonNode* node);
+
+    //! writes a reference to a stack frame of the script
+    void WriteFrameRef(const StackFrameInfo* frame);
+
+    //! writes a reference to a function
+    void WriteFunRef(const FunDesc* desc);
+
+    SymbolTable* mSymbolTable;
+    const Container<const SymbolTable*>& mLibs;
+    Utils::ByteStream& mStream;
+    PointerMap mStringIds;
+    PointerMap mObjectIds;
+    int mObjectCount;
+    int mNodeId;        //!< id of the node written by the last visit
+    bool mFailed;
+    Container<StmtFunDec*> mForwardDecs;    //!< declarations of functions which are not the declaration of their description
+    Container<StmtList*> mListStack;        //!< statement lists waiting for their tail to be written
+    int mListStackTop;                      //!< number of statement lists in mListStack
+};
+
+bool CacheWriter::Write(const BlockScriptBuilder::CompilationResult& result)
+{
+    //frames are created first, so all the records can reference them
+    const int frameCount = mSymbolTable->GetFrameCount();
+    WriteInt(frameCount);
+
+    //types of the script, including the ones only referenced by other types
+    const TypeTable* typeTable = mSymbolTable->GetTypeTable();
+    for (int i = 0; i < typeTable->GetTypeCount() && !mFailed; ++i)
+    {
+        EmitType(typeTable->GetTypeByIndex(i));
+    }
+
+    for (int f = 0; f < frameCount && !mFailed; ++f)
+    {
+        EmitFrame(mSymbolTable->GetFrameByIndex(f));
+    }
+
+    //nodes of the program, then the ones only referenced by the function table, the assembly and the globals
+    const int programId = EmitNode(result.mAst);
+
+    FunTable* funTable = mSymbolTable->GetRootFunTable();
+    for (int f = 0; f < funTable->GetSize(); ++f)
+    {
+        EmitNode(const_cast<StmtFunDec*>(funTable->GetDesc(f)->GetDec()));
+    }
+
+    const Container<Canon::Block>& blocks = *result.mAsm.mBlocks;
+    for (int b = 0; b < blocks.Size(); ++b)
+    {
+        const Container<Canon::CanonNode*>& stmts = blocks[b].GetStmts();
+        for (int s = 0; s < stmts.Size(); ++s)
+        {
+            EmitCanonReferences(stmts[s]);
+        }
+    }
+
+    const Container<GlobalMapEntry>& globals = *result.mAsm.mGlobalsMap;
+    for (int g = 0; g < globals.Size(); ++g)
+    {
+        EmitNode(const_cast<Idd*>(globals[g].mVar));
+        EmitNode(const_cast<Imm*>(globals[g].mDefaultVal));
+    }
+
+    if (mFailed)
+    {
+        return false;
+    }
+    WriteInt(R_END_OBJECTS);
+
+    WriteInt(programId);
+
+    //functions of the script, recreated from their declarations
+    WriteInt(funTable->GetSize());
+    for (int f = 0; f < funTable->GetSize(); ++f)
+    {
+        const FunDesc* desc = funTable->GetDesc(f);
+        int forwardCount = 0;
+        for (int d = 0; d < mForwardDecs.Size(); ++d)
+        {
+            forwardCount += mForwardDecs[d]->GetDesc() == desc;
+        }
+
+        //the forward declarations are inserted first, as when compiling
+        WriteInt(forwardCount + 1);
+        for (int d = 0; d < mForwardDecs.Size(); ++d)
+        {
+            if (mForwardDecs[d]->GetDesc() == desc)
+            {
+                WriteInt(EmitNode(mForwardDecs[d]));
+            }
+        }
+        WriteInt(EmitNode(const_cast<StmtFunDec*>(desc->GetDec())));
+        WriteInt(desc->IsMethod());
+
+        if (desc->GetCallback() == nullptr)
+        {
+            WriteInt(CALLBACK_NONE);
+        }
+        else if (desc->GetCallback() == BlockScriptBuilder::GetStructConstructorCallback())
+        {
+            WriteInt(CALLBACK_STRUCT_CONSTRUCTOR);
+        }
+        else
+        {
+            return false;
+        }
+        WriteInt(desc->GetInputArgumentsByteSize());
+    }
+
+    WriteInt(blocks.Size());
+    for (int b = 0; b < blocks.Size(); ++b)
+    {
+        const Canon::Block& block = blocks[b];
+        if (block.GetLabel() != b)
+        {
+            return false;
+        }
+        WriteInt(block.NextBlock());
+        const Container<Canon::CanonNode*>& stmts = block.GetStmts();
+        WriteInt(stmts.Size());
+        for (int s = 0; s < stmts.Size(); ++s)
+        {
+            WriteInt(block.GetLine(s));
+            WriteCanon(stmts[s]);
+        }
+    }
+
+    const Container<FunMapEntry>& funMap = *result.mAsm.mFunBlockMap;
+    WriteInt(funMap.Size());
+    for (int f = 0; f < funMap.Size(); ++f)
+    {
+        WriteFunRef(funMap[f].mFunDesc);
+        WriteInt(funMap[f].mAssemblyBlock);
+    }
+
+    WriteInt(globals.Size());
+    for (int g = 0; g < globals.Size(); ++g)
+    {
+        WriteInt(EmitNode(const_cast<Idd*>(globals[g].mVar)));
+        WriteInt(EmitNode(const_cast<Imm*>(globals[g].mDefaultVal)));
+    }
+
+    return !mFailed;
+}
+
+int CacheWriter::EmitString(const char* str)
+{
+    if (str == nullptr)
+    {
+        return 0;
+    }
+    int id = mStringIds.Find(str);
+    if (id == 0)
+    {
+        WriteInt(R_STRING);
+        WriteInlineString(mStream, str);
+        id = ++mObjectCount;
+        mStringIds.Insert(str, id);
+    }
+    return id;
+}
+
+int CacheWriter::EmitType(const TypeDesc* type)
+{
+    if (type == nullptr)
+    {
+        return 0;
+    }
+    int id = mObjectIds.Find(type);
+    if (id == 0)
+    {
+        int table = 0;
+        int index = 0;
+        if (!FindType(mSymbolTable, mLibs, type, table, index))
+        {
+            mFailed = true;
+            return 0;
+        }
+        if (table == 0)
+        {
+            return EmitScriptType(type);
+        }
+        id = BeginObject(R_EXTERN_TYPE, type);
+        WriteInt(table);
+        WriteInt(index);
+    }
+    return id;
+}
+
+int CacheWriter::EmitScriptType(const TypeDesc* type)
+{
+    switch (type->GetModifier())
+    {
+    case TypeDesc::M_SCALAR:
+    case TypeDesc::M_VECTOR:
+    case TypeDesc::M_ARRAY:
+    case TypeDesc::M_STRUCT:
+    case TypeDesc::M_ENUM:
+    case TypeDesc::M_STAR:
+        break;
+    default:
+        //object types are only declared by the libraries
+        mFailed = true;
+        return 0;
+    }
+    if (type->GetPropertyNode() != nullptr || type->GetPropertyCallback() != nullptr)
+    {
+        mFailed = true;
+        return 0;
+    }
+
+    const int childId = EmitType(type->GetChild());
+    const int structDefId = EmitNode(const_cast<StmtStructDef*>(type->GetStructDef()));
+    int enumCount = 0;
+    for (const EnumNode* e = type->GetEnumNode(); e != nullptr; e = e->mNext)
+    {
+        EmitString(e->mIdd);
+        ++enumCount;
+    }
+    if (mFailed)
+    {
+        return 0;
+    }
+
+    const int id = BeginObject(R_TYPE, type);
+    WriteInt(type->GetModifier());
+    WriteInlineString(mStream, type->GetName());
+    WriteInt(type->GetAluEngine());
+    WriteInt(childId);
+    WriteInt(type->GetModifierProperty().ArraySize);
+    WriteInt(structDefId);
+    WriteInt(type->GetByteSize());
+    WriteInt(enumCount);
+    for (const EnumNode* e = type->GetEnumNode(); e != nullptr; e = e->mNext)
+    {
+        WriteInt(EmitString(e->mIdd));
+        WriteInt(e->mGuid);
+    }
+    return id;
+}
+
+int CacheWriter::EmitProperty(const PropertyNode* prop)
+{
+    if (prop == nullptr)
+    {
+        return 0;
+    }
+    int id = mObjectIds.Find(prop);
+    if (id == 0)
+    {
+        for (int t = 1; t <= mLibs.Size(); ++t)
+        {
+            const TypeTable* typeTable = mLibs[t - 1]->GetTypeTable();
+            for (int i = 0; i < typeTable->GetTypeCount(); ++i)
+            {
+                const TypeDesc* type = typeTable->GetTypeByIndex(i);
+                int chainIndex = 0;
+                for (const PropertyNode* p = type->GetPropertyNode(); p != nullptr; p = p->mNext, ++chainIndex)
+                {
+                    if (p == prop)
+                    {
+                        const int typeId = EmitType(type);
+                        id = BeginObject(R_EXTERN_PROPERTY, prop);
+                        WriteInt(typeId);
+                        WriteInt(chainIndex);
+                        return id;
+                    }
+                }
+            }
+        }
+        mFailed = true;
+    }
+    return id;
+}
+
+int CacheWriter::EmitNode(Node* node)
+{
+    if (node == nullptr || mFailed)
+    {
+        return 0;
+    }
+    int id = mObjectIds.Find(node);
+    if (id == 0)
+    {
+        mNodeId = 0;
+        node->Access(this);
+        id = mNodeId;
+    }
+    return id;
+}
+
+void CacheWriter::EmitFrame(StackFrameInfo* frame)
+{
+    for (int e = 0; e < frame->GetEntryCount(); ++e)
+    {
+        EmitType(frame->GetEntry(e).mType);
+    }
+    if (mFailed)
+    {
+        return;
+    }
+
+    //not an object, the frames being created before the records
+    WriteInt(R_FRAME);
+    WriteFrameRef(frame);
+    WriteInt(frame->GetCreatorCategory());
+    WriteFrameRef(frame->GetParentStackFrame());
+    WriteInt(frame->GetLine());
+    WriteInt(frame->GetEntryCount());
+    for (int e = 0; e < frame->GetEntryCount(); ++e)
+    {
+        const StackFrameInfo::Entry& entry = frame->GetEntry(e);
+        WriteInlineString(mStream, entry.mName);
+        WriteInt(EmitType(entry.mType));
+        WriteInt(entry.mIsArg);
+    }
+    WriteInt(frame->GetTempSize());
+    WriteInt(frame->GetSize());
+}
+
+void CacheWriter::WriteFrameRef(const StackFrameInfo* frame)
+{
+    int index = -1;
+    if (frame != nullptr)
+    {
+        for (int f = 0; f < mSymbolTable->GetFrameCount() && index == -1; ++f)
+        {
+            if (mSymbolTable->GetFrameByIndex(f) == frame)
+            {
+                index = f;
+            }
+        }
+        mFailed = mFailed || index == -1;
+    }
+    WriteInt(index);
+}
+
+void CacheWriter::WriteFunRef(const FunDesc* desc)
+{
+    int table = -1;
+    int index = -1;
+    if (desc != nullptr && !FindFunDesc(mSymbolTable, mLibs, desc, table, index))
+    {
+        mFailed = true;
+    }
+    WriteInt(table);
+    WriteInt(index);
+}
+
+void CacheWriter::EmitCanonReferences(const Canon::CanonNode* node)
+{
+    switch (node->GetType())
+    {
+    case Canon::T_JMPCOND:
+        EmitNode(static_cast<const Canon::JmpCond*>(node)->GetExp());
+        break;
+    case Canon::T_FUNGO:
+        EmitNode(static_cast<const Canon::FunGo*>(node)->GetFunCall());
+        break;
+    case Canon::T_SAVE:
+        EmitNode(static_cast<const Canon::Save*>(node)->GetTmp());
+        break;
+    case Canon::T_LOAD:
+        EmitNode(static_cast<const Canon::Load*>(node)->GetExp());
+        break;
+    case Canon::T_LOAD_ADDR:
+        EmitNode(static_cast<const Canon::LoadAddr*>(node)->GetExp());
+        break;
+    case Canon::T_COPY_TO_ADDR:
+        EmitNode(static_cast<const Canon::CopyToAddr*>(node)->GetExp());
+        break;
+    case Canon::T_MOVE:
+        EmitNode(static_cast<const Canon::Move*>(node)->GetLhs());
+        EmitNode(static_cast<const Canon::Move*>(node)->GetRhs());
+        break;
+    case Canon::T_INSERT_DATA_TO_HEAP:
+        EmitNode(static_cast<const Canon::InsertDataToHeap*>(node)->GetTmp());
+        EmitString(static_cast<const char*>(static_cast<const Canon::InsertDataToHeap*>(node)->GetPointer()));
+        break;
+    case Canon::T_READ_OBJ_PROP:
+        EmitNode(static_cast<const Canon::ReadObjProp*>(node)->GetLoc());
+        EmitNode(static_cast<const Canon::ReadObjProp*>(node)->GetObj());
+        EmitProperty(static_cast<const Canon::ReadObjProp*>(node)->GetProp());
+        break;
+    case Canon::T_WRITE_OBJ_PROP:
+        EmitNode(static_cast<const Canon::WriteObjProp*>(node)->GetLoc());
+        EmitNode(static_cast<const Canon::WriteObjProp*>(node)->GetObj());
+        EmitProperty(static_cast<const Canon::WriteObjProp*>(node)->GetProp());
+        break;
+    case Canon::T_JMP:
+    case Canon::T_RET:
+    case Canon::T_SAVE_TO_ADDR:
+    case Canon::T_PUSHFRAME:
+    case Canon::T_POPFRAME:
+    case Canon::T_CAST:
+    case Canon::T_EXIT:
+    case Canon::T_YIELD:
+        break;
+    default:
+        mFailed = true;
+    }
+}
+
+void CacheWriter::WriteCanon(const Canon::CanonNode* node)
+{
+    WriteInt(node->GetType());
+    switch (node->GetType())
+    {
+    case Canon::T_JMP:
+        WriteInt(static_cast<const Canon::Jmp*>(node)->GetLabel());
+        break;
+    case Canon::T_JMPCOND:
+        {
+            const Canon::JmpCond* n = static_cast<const Canon::JmpCond*>(node);
+            WriteInt(EmitNode(n->GetExp()));
+            WriteInt(n->GetComparison());
+            WriteInt(n->GetLabel());
+        }
+        break;
+    case Canon::T_FUNGO:
+        {
+            const Canon::FunGo* n = static_cast<const Canon::FunGo*>(node);
+            WriteInt(EmitNode(n->GetFunCall()));
+            WriteInt(n->GetLabel());
+        }
+        break;
+    case Canon::T_SAVE:
+        {
+            const Canon::Save* n = static_cast<const Canon::Save*>(node);
+            WriteInt(EmitNode(n->GetTmp()));
+            WriteInt(n->GetRegister());
+        }
+        break;
+    case Canon::T_SAVE_TO_ADDR:
+        {
+            const Canon::SaveToAddr* n = static_cast<const Canon::SaveToAddr*>(node);
+            WriteInt(n->GetLhs());
+            WriteInt(n->GetRhs());
+        }
+        break;
+    case Canon::T_LOAD:
+        {
+            const Canon::Load* n = static_cast<const Canon::Load*>(node);
+            WriteInt(n->GetRegister());
+            WriteInt(EmitNode(n->GetExp()));
+        }
+        break;
+    case Canon::T_LOAD_ADDR:
+        {
+            const Canon::LoadAddr* n = static_cast<const Canon::LoadAddr*>(node);
+            WriteInt(n->GetRegister());
+            WriteInt(EmitNode(n->GetExp()));
+        }
+        break;
+    case Canon::T_COPY_TO_ADDR:
+        {
+            const Canon::CopyToAddr* n = static_cast<const Canon::CopyToAddr*>(node);
+            WriteInt(n->GetRegister());
+            WriteInt(EmitNode(n->GetExp()));
+            WriteInt(n->GetByteSize());
+        }
+        break;
+    case Canon::T_MOVE:
+        {
+            const Canon::Move* n = static_cast<const Canon::Move*>(node);
+            WriteInt(EmitNode(n->GetLhs()));
+            WriteInt(EmitNode(n->GetRhs()));
+        }
+        break;
+    case Canon::T_INSERT_DATA_TO_HEAP:
+        {
+            const Canon::InsertDataToHeap* n = static_cast<const Canon::InsertDataToHeap*>(node);
+            WriteInt(EmitNode(n->GetTmp()));
+            WriteInt(EmitString(static_cast<const char*>(n->GetPointer())));
+        }
+        break;
+    case Canon::T_PUSHFRAME:
+        WriteFrameRef(static_cast<const Canon::PushFrame*>(node)->GetInfo());
+        break;
+    case Canon::T_CAST:
+        {
+            const Canon::Cast* n = static_cast<const Canon::Cast*>(node);
+            WriteInt(n->IsIntToFloat());
+            WriteInt(n->GetRegister());
+        }
+        break;
+    case Canon::T_READ_OBJ_PROP:
+        {
+            const Canon::ReadObjProp* n = static_cast<const Canon::ReadObjProp*>(node);
+            WriteInt(EmitNode(n->GetLoc()));
+            WriteInt(EmitNode(n->GetObj()));
+            WriteInt(EmitProperty(n->GetProp()));
+        }
+        break;
+    case Canon::T_WRITE_OBJ_PROP:
+        {
+            const Canon::WriteObjProp* n = static_cast<const Canon::WriteObjProp*>(node);
+            WriteInt(EmitNode(n->GetObj()));
+            WriteInt(EmitProperty(n->GetProp()));
+            WriteInt(EmitNode(n->GetLoc()));
+        }
+        break;
+    default:
+        break;
+    }
+}
+
+void CacheWriter::Visit(Program* n)
+{
+    const int stmtListId = EmitNode(n->GetStmtList());
+    mNodeId = BeginObject(R_NODE_Program, static_cast<Node*>(n));
+    WriteInt(stmtListId);
+}
+
+void CacheWriter::Visit(Exp* n)
+{
+    //expressions are always of a concrete class
+    mFailed = true;
+}
+
+void CacheWriter::Visit(ExpList* n)
+{
+    const int expId = EmitNode(n->GetExp());
+    const int tailId = EmitNode(n->GetTail());
+    mNodeId = BeginObject(R_NODE_ExpList, static_cast<Node*>(n));
+    WriteInt(expId);
+    WriteInt(tailId);
+}
+
+void CacheWriter::Visit(Stmt* n)
+{
+    mNodeId = BeginObject(R_NODE_Stmt, static_cast<Node*>(n));
+    WriteInt(n->GetLine());
+}
+
+void CacheWriter::Visit(StmtList* n)
+{
+    //statement lists can be as long as a script, so their tails are written without recursion
+    const int base = mListStackTop;
+    for (StmtList* l = n; l != nullptr && mObjectIds.Find(static_cast<Node*>(l)) == 0; l = l->GetTail())
+    {
+        //the container does not reuse popped entries, so the stack only grows
+        if (mListStackTop == mListStack.Size())
+        {
+            mListStack.PushEmpty();
+        }
+        mListStack[mListStackTop++] = l;
+    }
+
+    int id = 0;
+    while (mListStackTop > base)
+    {
+        StmtList* l = mListStack[--mListStackTop];
+        const int stmtId = EmitNode(l->GetStmt());
+        const int tailId = EmitNode(l->GetTail());
+        id = BeginObject(R_NODE_StmtList, static_cast<Node*>(l));
+        WriteInt(stmtId);
+        WriteInt(tailId);
+    }
+    mNodeId = id;
+}
+
+void CacheWriter::Visit(ArgDec* n)
+{
+    const int varId = EmitString(n->GetVar());
+    const int typeId = EmitType(n->GetType());
+    mNodeId = BeginObject(R_NODE_ArgDec, static_cast<Node*>(n));
+    WriteInt(varId);
+    WriteInt(typeId);
+    WriteInt(n->GetOffset());
+}
+
+void CacheWriter::Visit(ArgList* n)
+{
+    const int argDecId = EmitNode(n->GetArgDec());
+    const int tailId = EmitNode(n->GetTail());
+    mNodeId = BeginObject(R_NODE_ArgList, static_cast<Node*>(n));
+    WriteInt(argDecId);
+    WriteInt(tailId);
+}
+
+void CacheWriter::Visit(Idd* n)
+{
+    const int typeId = EmitType(n->GetTypeDesc());
+    const int nameId = EmitString(n->GetName());
+    const int annotationsId = EmitNode(n->GetAnnotations());
+    mNodeId = BeginObject(R_NODE_Idd, static_cast<Node*>(n));
+    WriteInt(typeId);
+    WriteInt(nameId);
+    WriteInt(n->GetOffset());
+    WriteInt(n->GetFrameOffset());
+    WriteInt(annotationsId);
+    WriteInt(n->GetMetaData().isGlobal);
+    WriteInt(n->GetMetaData().isExtern);
+    WriteInt(n->GetMetaData().isUsedInGlobalScope);
+}
+
+void CacheWriter::Visit(Binop* n)
+{
+    const int typeId = EmitType(n->GetTypeDesc());
+    const int lhsId = EmitNode(n->GetLhs());
+    const int rhsId = EmitNode(n->GetRhs());
+    mNodeId = BeginObject(R_NODE_Binop, static_cast<Node*>(n));
+    WriteInt(typeId);
+    WriteInt(lhsId);
+    WriteInt(n->GetOp());
+    WriteInt(rhsId);
+}
+
+void CacheWriter::Visit(Unop* n)
+{
+    const int typeId = EmitType(n->GetTypeDesc());
+    const int expId = EmitNode(n->GetExp());
+    mNodeId = BeginObject(R_NODE_Unop, static_cast<Node*>(n));
+    WriteInt(typeId);
+    WriteInt(n->GetOp());
+    WriteInt(expId);
+    WriteInt(n->IsPost());
+}
+
+void CacheWriter::Visit(ArrayConstructor* n)
+{
+    const int typeId = EmitType(n->GetTypeDesc());
+    mNodeId = BeginObject(R_NODE_ArrayConstructor, static_cast<Node*>(n));
+    WriteInt(typeId);
+}
+
+void CacheWriter::Visit(FunCall* n)
+{
+    const int typeId = EmitType(n->GetTypeDesc());
+    const int argsId = EmitNode(n->GetArgs());
+    const int nameId = EmitString(n->GetName());
+    mNodeId = BeginObject(R_NODE_FunCall, static_cast<Node*>(n));
+    WriteInt(typeId);
+    WriteInt(argsId);
+    WriteInt(nameId);
+    WriteInt(n->IsMethod());
+    WriteFunRef(n->GetDesc());
+}
+
+void CacheWriter::Visit(Imm* n)
+{
+    const int typeId = EmitType(n->GetTypeDesc());
+    mNodeId = BeginObject(R_NODE_Imm, static_cast<Node*>(n));
+    WriteInt(typeId);
+    mStream.Append(&n->GetVariant(), sizeof(Variant));
+}
+
+void CacheWriter::Visit(StrImm* n)
+{
+    const int typeId = EmitType(n->GetTypeDesc());
+    const int strId = EmitString(n->GetStr());
+    mNodeId = BeginObject(R_NODE_StrImm, static_cast<Node*>(n));
+    WriteInt(typeId);
+    WriteInt(strId);
+}
+
+void CacheWriter::Visit(StmtExp* n)
+{
+    const int expId = EmitNode(n->GetExp());
+    mNodeId = BeginObject(R_NODE_StmtExp, static_cast<Node*>(n));
+    WriteInt(n->GetLine());
+    WriteInt(expId);
+}
+
+void CacheWriter::Visit(StmtFunDec* n)
+{
+    if (n->GetDesc() != nullptr && n->GetDesc()->GetDec() != n)
+    {
+        mForwardDecs.PushEmpty() = n;
+    }
+    const int argListId = EmitNode(n->GetArgList());
+    const int returnTypeId = EmitType(n->GetReturnType());
+    const int nameId = EmitString(n->GetName());
+    const int stmtListId = EmitNode(n->GetStmtList());
+    mNodeId = BeginObject(R_NODE_StmtFunDec, static_cast<Node*>(n));
+    WriteInt(n->GetLine());
+    WriteInt(argListId);
+    WriteInt(returnTypeId);
+    WriteInt(nameId);
+    WriteInt(stmtListId);
+    WriteFrameRef(n->GetFrame());
+    WriteFunRef(n->GetDesc());
+}
+
+void CacheWriter::Visit(StmtIfElse* n)
+{
+    const int expId = EmitNode(n->GetExp());
+    const int stmtListId = EmitNode(n->GetStmtList());
+    const int tailId = EmitNode(n->GetTail());
+    mNodeId = BeginObject(R_NODE_StmtIfElse, static_cast<Node*>(n));
+    WriteInt(n->GetLine());
+    WriteInt(expId);
+    WriteInt(stmtListId);
+    WriteInt(tailId);
+    WriteFrameRef(n->GetFrame());
+}
+
+void CacheWriter::Visit(StmtWhile* n)
+{
+    const int expId = EmitNode(n->GetExp());
+    const int stmtListId = EmitNode(n->GetStmtList());
+    mNodeId = BeginObject(R_NODE_StmtWhile, static_cast<Node*>(n));
+    WriteInt(n->GetLine());
+    WriteInt(expId);
+    WriteInt(stmtListId);
+    WriteFrameRef(n->GetFrame());
+}
+
+void CacheWriter::Visit(StmtFor* n)
+{
+    const int initId = EmitNode(n->GetInit());
+    const int condId = EmitNode(n->GetCond());
+    const int updateId = EmitNode(n->GetUpdate());
+    const int stmtListId = EmitNode(n->GetStmtList());
+    mNodeId = BeginObject(R_NODE_StmtFor, static_cast<Node*>(n));
+    WriteInt(n->GetLine());
+    WriteInt(initId);
+    WriteInt(condId);
+    WriteInt(updateId);
+    WriteInt(stmtListId);
+    WriteFrameRef(n->GetFrame());
+}
+
+void CacheWriter::Visit(StmtReturn* n)
+{
+    const int expId = EmitNode(n->GetExp());
+    mNodeId = BeginObject(R_NODE_StmtReturn, static_cast<Node*>(n));
+    WriteInt(n->GetLine());
+    WriteInt(expId);
+}
+
+void CacheWriter::Visit(StmtYield* n)
+{
+    mNodeId = BeginObject(R_NODE_StmtYield, static_cast<Node*>(n));
+    WriteInt(n->GetLine());
+}
+
+void CacheWriter::Visit(StmtStructDef* n)
+{
+    const int nameId = EmitString(n->GetName());
+    const int argListId = EmitNode(n->GetArgList());
+    mNodeId = BeginObject(R_NODE_StmtStructDef, static_cast<Node*>(n));
+    WriteInt(n->GetLine());
+    WriteInt(nameId);
+    WriteInt(argListId);
+    WriteFrameRef(n->GetFrameInfo());
+}
+
+void CacheWriter::Visit(StmtEnumTypeDef* n)
+{
+    const int typeId = EmitType(n->GetEnumType());
+    mNodeId = BeginObject(R_NODE_StmtEnumTypeDef, static_cast<Node*>(n));
+    WriteInt(n->GetLine());
+    WriteInt(typeId);
+}
+
+void CacheWriter::Visit(Annotations* n)
+{
+    const int expListId = EmitNode(n->GetExpList());
+    mNodeId = BeginObject(R_NODE_Annotations, static_cast<Node*>(n));
+    WriteInt(expListId);
+}
+
+//----------------------------------------------------------------------------------------
+
+#define CACHE_NEW PG_NEW(mNodeAllocator, -1, "BlockScript::Ast", Pegasus::Alloc::PG_MEM_TEMP)
+#define CACHE_CANON_NEW PG_NEW(mNodeAllocator, -1, "Canon", Pegasus::Alloc::PG_MEM_TEMP)
+
+//! Reader of the payload, recreating the objects in the builder memory
+class CacheReader
+{
+public:
+    CacheReader(
+        Alloc::IAllocator* alloc,
+        Memory::BlockAllocator* nodeAllocator,
+        SymbolTable* symbolTable,
+        const Container<const SymbolTable*>& libs,
+        const char* payload,
+        int payloadSize
+    )
+    : mAllocator(alloc), mNodeAllocator(nodeAllocator), mSymbolTable(symbolTable), mLibs(libs), mStream(payload, payloadSize), mBlockCount(0)
+    {
+        mObjects.Initialize(alloc);
+        mFixups.Initialize(alloc);
+    }
+
+    //! reads the payload
+    //! \return true if successful, false if the content does not match the libraries
+    bool Read(Container<Canon::Block>& blocks, Container<FunMapEntry>& funMap, Container<GlobalMapEntry>& globals, Program*& outProgram);
+
+private:
+    //! object loaded from a record
+    struct Object
+    {
+        int   mKind;
+        int   mNodeClass; //!< bit of the node class, for nodes
+        void* mPtr;
+    };
+
+    //! function reference to resolve once the functions of the script are created
+    struct FunFixup
+    {
+        FunCall* mFunCall;
+        StmtFunDec* mFunDec;
+        int mTable;
+        int mIndex;
+    };
+
+    int ReadInt() { return mStream.ReadInt(); }
+
+    void AddObject(ObjectKind kind, int nodeClass, void* ptr)
+    {
+        Object& o = mObjects.PushEmpty();
+        o.mKind = kind;
+        o.mNodeClass = nodeClass;
+        o.mPtr = ptr;
+    }
+
+    void AddNode(RecordType record, Node* node) { AddObject(OBJ_NODE, 1 << (record - R_NODE_Program), node); }
+
+    //! reads a reference to an object of a kind, failing if it is not
+    const Object* ReadObject(ObjectKind kind)
+    {
+        const int id = ReadInt();
+        if (id == 0)
+        {
+            return nullptr;
+        }
+        if (id < 0 || id > mObjects.Size() || mObjects[id - 1].mKind != kind)
+        {
+            mStream.Fail();
+            return nullptr;
+        }
+        return &mObjects[id - 1];
+    }
+
+    char* ReadString()
+    {
+        const Object* o = ReadObject(OBJ_STRING);
+        return o != nullptr ? static_cast<char*>(o->mPtr) : nullptr;
+    }
+
+    const TypeDesc* ReadType()
+    {
+        const Object* o = ReadObject(OBJ_TYPE);
+        return o != nullptr ? static_cast<const TypeDesc*>(o->mPtr) : nullptr;
+    }
+
+    //! reads a reference to a node of one of the classes of a mask
+    template<class T>
+    T* ReadNode(unsigned int classMask)
+    {
+        const Object* o = ReadObject(OBJ_NODE);
+        if (o == nullptr)
+        {
+            return nullptr;
+        }
+        if ((o->mNodeClass & classMask) == 0)
+        {
+            mStream.Fail();
+            return nullptr;
+        }
+        return static_cast<T*>(static_cast<Node*>(o->mPtr));
+    }
+
+    StackFrameInfo* ReadFrame()
+    {
+        const int index = ReadInt();
+        if (index < -1 || index >= mSymbolTable->GetFrameCount())
+        {
+            mStream.Fail();
+            return nullptr;
+        }
+        return index == -1 ? nullptr : mSymbolTable->GetFrameByIndex(index);
+    }
+
+    Canon::Register ReadRegister()
+    {
+        const int r = ReadInt();
+        if (r < 0 || r >= Canon::R_COUNT)
+        {
+            mStream.Fail();
+            return Canon::R_RET;
+        }
+        return static_cast<Canon::Register>(r);
+    }
+
+    //! reads a block label, -1 for the functions without a block (callbacks)
+    int ReadLabel()
+    {
+        const int label = ReadInt();
+        if (label < -1 || label >= mBlockCount)
+        {
+            mStream.Fail();
+        }
+        return label;
+    }
+
+    const FunDesc* GetFunDesc(int table, int index);
+
+    void ReadFunFixup(FunCall* funCall, StmtFunDec* funDec)
+    {
+        FunFixup& fixup = mFixups.PushEmpty();
+        fixup.mFunCall = funCall;
+        fixup.mFunDec = funDec;
+        fixup.mTable = ReadInt();
+        fixup.mIndex = ReadInt();
+    }
+
+    bool ReadObjects();
+    void ReadScriptType();
+    void ReadFrameContent();
+    void ReadNodeRecord(RecordType record);
+    bool ReadFunctions();
+    Canon::CanonNode* ReadCanon();
+
+    Alloc::IAllocator* mAllocator;
+    Memory::BlockAllocator* mNodeAllocator;
+    SymbolTable* mSymbolTable;
+    const Container<const SymbolTable*>& mLibs;
+    CacheStream mStream;
+    int mBlockCount;
+    Container<Object> mObjects;
+    Container<FunFixup> mFixups;
+};
+
+bool CacheReader::Read(Container<Canon::Block>& blocks, Container<FunMapEntry>& funMap, Container<GlobalMapEntry>& globals, Program*& outProgram)
+{
+    //the root global frame is created by the reset of the builder
+    const int frameCount = ReadInt();
+    if (mSymbolTable->GetFrameCount() != 1 || frameCount < 1)
+    {
+        return false;
+    }
+    for (int f = 1; f < frameCount; ++f)
+    {
+        mSymbolTable->CreateFrame();
+    }
+
+    if (!ReadObjects())
+    {
+        return false;
+    }
+
+    outProgram = ReadNode<Program>(NODE_MASK(Program));
+    if (outProgram == nullptr || !ReadFunctions())
+    {
+        return false;
+    }
+
+    mBlockCount = ReadInt();
+    for (int b = 0; b < mBlockCount && !mStream.HasFailed(); ++b)
+    {
+        Canon::Block& block = blocks.PushEmpty();
+        block.Initialize(mAllocator, b);
+        const int nextBlock = ReadInt();
+        if (nextBlock < -1 || nextBlock >= mBlockCount)
+        {
+            return false;
+        }
+        block.SetNextBlock(nextBlock);
+
+        const int stmtCount = ReadInt();
+        for (int s = 0; s < stmtCount && !mStream.HasFailed(); ++s)
+        {
+            const int line = ReadInt();
+            Canon::CanonNode* node = ReadCanon();
+            if (node != nullptr)
+            {
+                block.PushStmt(node, line);
+            }
+        }
+    }
+
+    const int funMapCount = ReadInt();
+    for (int f = 0; f < funMapCount && !mStream.HasFailed(); ++f)
+    {
+        FunMapEntry& entry = funMap.PushEmpty();
+        const int table = ReadInt();
+        const int index = ReadInt();
+        entry.mFunDesc = GetFunDesc(table, index);
+        entry.mAssemblyBlock = ReadInt();
+        if (entry.mFunDesc == nullptr || entry.mAssemblyBlock < 0 || entry.mAssemblyBlock >= mBlockCount)
+        {
+            return false;
+        }
+    }
+
+    const int globalCount = ReadInt();
+    for (int g = 0; g < globalCount && !mStream.HasFailed(); ++g)
+    {
+        GlobalMapEntry& entry = globals.PushEmpty();
+        entry.mVar = ReadNode<Idd>(NODE_MASK(Idd));
+        entry.mDefaultVal = ReadNode<Imm>(NODE_MASK(Imm));
+        if (entry.mVar == nullptr)
+        {
+            return false;
+        }
+    }
+
+    return !mStream.HasFailed() && mStream.IsAtEnd();
+}
+
+bool CacheReader::ReadObjects()
+{
+    for (;;)
+    {
+        const int record = ReadInt();
+        if (mStream.HasFailed())
+        {
+            return false;
+        }
+
+        switch (record)
+        {
+        case R_STRING:
+            {
+                int len = 0;
+                const char* str = mStream.ReadInlineString(len);
+                if (str == nullptr || len + 1 >= mNodeAllocator->GetPageSize())
+                {
+                    return false;
+                }
+                char* copy = static_cast<char*>(mNodeAllocator->Alloc(len + 1, Alloc::PG_MEM_PERM));
+                Utils::Memcpy(copy, str, len);
+                copy[len] = '\0';
+                AddObject(OBJ_STRING, 0, copy);
+            }
+            break;
+        case R_TYPE:
+            ReadScriptType();
+            break;
+        case R_EXTERN_TYPE:
+            {
+                const int table = ReadInt();
+                const int index = ReadInt();
+                if (table < 1 || table > mLibs.Size() || index < 0 || index >= mLibs[table - 1]->GetTypeTable()->GetTypeCount())
+                {
+                    return false;
+                }
+                AddObject(OBJ_TYPE, 0, const_cast<TypeDesc*>(mLibs[table - 1]->GetTypeTable()->GetTypeByIndex(index)));
+            }
+            break;
+        case R_EXTERN_PROPERTY:
+            {
+                const TypeDesc* type = ReadType();
+                int chainIndex = ReadInt();
+                const PropertyNode* prop = type != nullptr ? type->GetPropertyNode() : nullptr;
+                for (; prop != nullptr && chainIndex > 0; --chainIndex)
+                {
+                    prop = prop->mNext;
+                }
+                if (prop == nullptr)
+                {
+                    return false;
+                }
+                AddObject(OBJ_PROPERTY, 0, const_cast<PropertyNode*>(prop));
+            }
+            break;
+        case R_FRAME:
+            ReadFrameContent();
+            break;
+        case R_END_OBJECTS:
+            return true;
+        default:
+            if (record > R_END_OBJECTS && record < R_COUNT)
+            {
+                ReadNodeRecord(static_cast<RecordType>(record));
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        if (mStream.HasFailed())
+        {
+            return false;
+        }
+    }
+}
+
+void CacheReader::ReadScriptType()
+{
+    const TypeDesc::Modifier modifier = static_cast<TypeDesc::Modifier>(ReadInt());
+    int nameLen = 0;
+    const char* nameData = mStream.ReadInlineString(nameLen);
+    const TypeDesc::AluEngine aluEngine = static_cast<TypeDesc::AluEngine>(ReadInt());
+    const TypeDesc* child = ReadType();
+    const int modifierProperty = ReadInt();
+    StmtStructDef* structDef = ReadNode<StmtStructDef>(NODE_MASK(StmtStructDef));
+    const int byteSize = ReadInt();
+    const int enumCount = ReadInt();
+    if (mStream.HasFailed() || nameLen >= TypeDesc::sMaxTypeName || aluEngine < TypeDesc::E_NONE || aluEngine >= TypeDesc::E_COUNT)
+    {
+        mStream.Fail();
+        return;
+    }
+
+    char name[TypeDesc::sMaxTypeName];
+    Utils::Memcpy(name, nameData, nameLen);
+    name[nameLen] = '\0';
+
+    EnumNode* enumHead = nullptr;
+    EnumNode* enumTail = nullptr;
+    for (int e = 0; e < enumCount && !mStream.HasFailed(); ++e)
+    {
+        EnumNode* node = mSymbolTable->NewEnumNode();
+        node->mIdd = ReadString();
+        node->mGuid = ReadInt();
+        if (enumTail == nullptr)
+        {
+            enumHead = node;
+        }
+        else
+        {
+            enumTail->mNext = node;
+        }
+        enumTail = node;
+    }
+
+    //the children are only modified by the parser, when patching the array types it creates
+    TypeDesc* mutableChild = const_cast<TypeDesc*>(child);
+    const int expectedCount = mSymbolTable->GetTypeTable()->GetTypeCount() + 1;
+    TypeDesc* type = nullptr;
+    switch (modifier)
+    {
+    case TypeDesc::M_SCALAR:
+        type = mSymbolTable->CreateScalarType(name, aluEngine);
+        break;
+    case TypeDesc::M_VECTOR:
+        type = child != nullptr ? mSymbolTable->CreateVectorType(name, mutableChild, modifierProperty, aluEngine) : nullptr;
+        break;
+    case TypeDesc::M_ARRAY:
+        type = child != nullptr ? mSymbolTable->CreateArrayType(name, mutableChild, modifierProperty) : nullptr;
+        break;
+    case TypeDesc::M_STRUCT:
+        type = structDef != nullptr ? mSymbolTable->CreateStructType(name, structDef) : nullptr;
+        break;
+    case TypeDesc::M_ENUM:
+        type = mSymbolTable->CreateEnumType(name, enumHead);
+        break;
+    case TypeDesc::M_STAR:
+        type = mSymbolTable->CreateStarType();
+        break;
+    default:
+        break;
+    }
+
+    //the new type must be a new entry of the table, identical to the compiled one
+    if (
+           mStream.HasFailed()
+        || type == nullptr
+        || mSymbolTable->GetTypeTable()->GetTypeCount() != expectedCount
+        || type->GetByteSize() != byteSize
+        || type->GetModifierProperty().ArraySize != modifierProperty
+       )
+    {
+        mStream.Fail();
+        return;
+    }
+    type->SetAluEngine(aluEngine);
+    AddObject(OBJ_TYPE, 0, type);
+}
+
+void CacheReader::ReadFrameContent()
+{
+    StackFrameInfo* frame = ReadFrame();
+    const StackFrameInfo::CreatorCategory category = static_cast<StackFrameInfo::CreatorCategory>(ReadInt());
+    StackFrameInfo* parent = ReadFrame();
+    const int line = ReadInt();
+    const int entryCount = ReadInt();
+    if (frame == nullptr || frame->GetEntryCount() != 0)
+    {
+        mStream.Fail();
+        return;
+    }
+
+    frame->SetCreatorCategory(category);
+    frame->UnlinkParentStackFrame();
+    frame->SetParentStackFrame(parent);
+    frame->SetLine(line);
+    for (int e = 0; e < entryCount && !mStream.HasFailed(); ++e)
+    {
+        int nameLen = 0;
+        const char* nameData = mStream.ReadInlineString(nameLen);
+        const TypeDesc* type = ReadType();
+        const int isArg = ReadInt();
+        if (mStream.HasFailed() || type == nullptr || nameLen + 1 >= IddStrPool::sCharsPerString)
+        {
+            mStream.Fail();
+            return;
+        }
+        char name[IddStrPool::sCharsPerString];
+        Utils::Memcpy(name, nameData, nameLen);
+        name[nameLen] = '\0';
+        frame->Allocate(name, type, isArg != 0);
+    }
+
+    const int tempSize = ReadInt();
+    const int size = ReadInt();
+    frame->AllocateTemporal(tempSize - frame->GetTempSize());
+    if (frame->GetSize() != size)
+    {
+        mStream.Fail();
+    }
+}
+
+void CacheReader::ReadNodeRecord(RecordType record)
+{
+    Node* node = nullptr;
+    switch (record)
+    {
+    case R_NODE_Program:
+        {
+            Program* n = CACHE_NEW Program();
+            n->SetStmtList(ReadNode<StmtList>(NODE_MASK(StmtList)));
+            node = n;
+        }
+        break;
+    case R_NODE_ExpList:
+        {
+            ExpList* n = CACHE_NEW ExpList();
+            n->SetExp(ReadNode<Exp>(EXP_NODES));
+            n->SetTail(ReadNode<ExpList>(NODE_MASK(ExpList)));
+            node = n;
+        }
+        break;
+    case R_NODE_Stmt:
+        {
+            Stmt* n = CACHE_NEW Stmt();
+            n->SetLine(ReadInt());
+            node = n;
+        }
+        break;
+    case R_NODE_StmtList:
+        {
+            StmtList* n = CACHE_NEW StmtList();
+            n->SetStmt(ReadNode<Stmt>(STMT_NODES));
+            n->SetTail(ReadNode<StmtList>(NODE_MASK(StmtList)));
+            node = n;
+        }
+        break;
+    case R_NODE_ArgDec:
+        {
+            const char* var = ReadString();
+            const TypeDesc* type = ReadType();
+            ArgDec* n = CACHE_NEW ArgDec(var, type);
+            n->SetOffset(ReadInt());
+            node = n;
+        }
+        break;
+    case R_NODE_ArgList:
+        {
+            ArgList* n = CACHE_NEW ArgList();
+            n->SetArgDec(ReadNode<ArgDec>(NODE_MASK(ArgDec)));
+            n->SetTail(ReadNode<ArgList>(NODE_MASK(ArgList)));
+            node = n;
+        }
+        break;
+    case R_NODE_Idd:
+        {
+            const TypeDesc* type = ReadType();
+            Idd* n = CACHE_NEW Idd(ReadString());
+            n->SetTypeDesc(type);
+            n->SetOffset(ReadInt());
+            n->SetFrameOffset(ReadInt());
+            n->SetAnnotations(ReadNode<Annotations>(NODE_MASK(Annotations)));
+            n->GetMetaData().isGlobal = ReadInt() != 0;
+            n->GetMetaData().isExtern = ReadInt() != 0;
+            n->GetMetaData().isUsedInGlobalScope = ReadInt() != 0;
+            node = n;
+        }
+        break;
+    case R_NODE_Binop:
+        {
+            const TypeDesc* type = ReadType();
+            Exp* lhs = ReadNode<Exp>(EXP_NODES);
+            const int op = ReadInt();
+            Exp* rhs = ReadNode<Exp>(EXP_NODES);
+            Binop* n = CACHE_NEW Binop(lhs, op, rhs);
+            n->SetTypeDesc(type);
+            node = n;
+        }
+        break;
+    case R_NODE_Unop:
+        {
+            const TypeDesc* type = ReadType();
+            const int op = ReadInt();
+            Exp* exp = ReadNode<Exp>(EXP_NODES);
+            Unop* n = CACHE_NEW Unop(op, exp);
+            n->SetTypeDesc(type);
+            n->SetIsPost(ReadInt() != 0);
+            node = n;
+        }
+        break;
+    case R_NODE_ArrayConstructor:
+        {
+            ArrayConstructor* n = CACHE_NEW ArrayConstructor();
+            n->SetTypeDesc(ReadType());
+            node = n;
+        }
+        break;
+    case R_NODE_FunCall:
+        {
+            const TypeDesc* type = ReadType();
+            ExpList* args = ReadNode<ExpList>(NODE_MASK(ExpList));
+            FunCall* n = CACHE_NEW FunCall(args, ReadString());
+            n->SetTypeDesc(type);
+            n->SetIsMethod(ReadInt() != 0);
+            ReadFunFixup(n, nullptr);
+            node = n;
+        }
+        break;
+    case R_NODE_Imm:
+        {
+            const TypeDesc* type = ReadType();
+            Variant v;
+            const char* data = mStream.ReadBytes(sizeof(Variant));
+            if (data != nullptr)
+            {
+                Utils::Memcpy(&v, data, sizeof(Variant));
+            }
+            Imm* n = CACHE_NEW Imm(v);
+            n->SetTypeDesc(type);
+            node = n;
+        }
+        break;
+    case R_NODE_StrImm:
+        {
+            const TypeDesc* type = ReadType();
+            StrImm* n = CACHE_NEW StrImm(ReadString());
+            n->SetTypeDesc(type);
+            node = n;
+        }
+        break;
+    case R_NODE_StmtExp:
+        {
+            const int line = ReadInt();
+            StmtExp* n = CACHE_NEW StmtExp(ReadNode<Exp>(EXP_NODES));
+            n->SetLine(line);
+            node = n;
+        }
+        break;
+    case R_NODE_StmtFunDec:
+        {
+            const int line = ReadInt();
+            ArgList* argList = ReadNode<ArgList>(NODE_MASK(ArgList));
+            const TypeDesc* returnType = ReadType();
+            const char* name = ReadString();
+            StmtFunDec* n = CACHE_NEW StmtFunDec(argList, returnType, name);
+            n->SetLine(line);
+            n->SetStmtList(ReadNode<StmtList>(NODE_MASK(StmtList)));
+            n->SetFrame(ReadFrame());
+            ReadFunFixup(nullptr, n);
+            node = n;
+        }
+        break;
+    case R_NODE_StmtIfElse:
+        {
+            const int line = ReadInt();
+            Exp* exp = ReadNode<Exp>(EXP_NODES);
+            StmtList* stmtList = ReadNode<StmtList>(NODE_MASK(StmtList));
+            StmtIfElse* tail = ReadNode<StmtIfElse>(NODE_MASK(StmtIfElse));
+            StackFrameInfo* frame = ReadFrame();
+            StmtIfElse* n = CACHE_NEW StmtIfElse(exp, stmtList, tail, frame);
+            n->SetLine(line);
+            node = n;
+        }
+        break;
+    case R_NODE_StmtWhile:
+        {
+            const int line = ReadInt();
+            Exp* exp = ReadNode<Exp>(EXP_NODES);
+            StmtList* stmtList = ReadNode<StmtList>(NODE_MASK(StmtList));
+            StmtWhile* n = CACHE_NEW StmtWhile(exp, stmtList);
+            n->SetLine(line);
+            n->SetFrame(ReadFrame());
+            node = n;
+        }
+        break;
+    case R_NODE_StmtFor:
+        {
+            const int line = ReadInt();
+            Exp* init = ReadNode<Exp>(EXP_NODES);
+            Exp* cond = ReadNode<Exp>(EXP_NODES);
+            Exp* update = ReadNode<Exp>(EXP_NODES);
+            StmtList* stmtList = ReadNode<StmtList>(NODE_MASK(StmtList));
+            StmtFor* n = CACHE_NEW StmtFor(init, cond, update, stmtList);
+            n->SetLine(line);
+            n->SetFrame(ReadFrame());
+            node = n;
+        }
+        break;
+    case R_NODE_StmtReturn:
+        {
+            const int line = ReadInt();
+            StmtReturn* n = CACHE_NEW StmtReturn(ReadNode<Exp>(EXP_NODES));
+            n->SetLine(line);
+            node = n;
+        }
+        break;
+    case R_NODE_StmtYield:
+        {
+            StmtYield* n = CACHE_NEW StmtYield();
+            n->SetLine(ReadInt());
+            node = n;
+        }
+        break;
+    case R_NODE_StmtStructDef:
+        {
+            const int line = ReadInt();
+            const char* name = ReadString();
+            ArgList* argList = ReadNode<ArgList>(NODE_MASK(ArgList));
+            StmtStructDef* n = CACHE_NEW StmtStructDef(name, argList);
+            n->SetLine(line);
+            n->SetFrameInfo(ReadFrame());
+            node = n;
+        }
+        break;
+    case R_NODE_StmtEnumTypeDef:
+        {
+            const int line = ReadInt();
+            StmtEnumTypeDef* n = CACHE_NEW StmtEnumTypeDef(ReadType());
+            n->SetLine(line);
+            node = n;
+        }
+        break;
+    case R_NODE_Annotations:
+        {
+            Annotations* n = CACHE_NEW Annotations();
+            n->SetExpList(ReadNode<ExpList>(NODE_MASK(ExpList)));
+            node = n;
+        }
+        break;
+    default:
+        //expressions are always of a concrete class
+        mStream.Fail();
+        return;
+    }
+    AddNode(record, node);
+}
+
+const FunDesc* CacheReader::GetFunDesc(int table, int index)
+{
+    if (table < 0 || table > mLibs.Size())
+    {
+        return nullptr;
+    }
+    const FunTable* funTable = GetTable(mSymbolTable, mLibs, table)->GetFunTable();
+    return index >= 0 && index < funTable->GetSize() ? funTable->GetDesc(index) : nullptr;
+}
+
+bool CacheReader::ReadFunctions()
+{
+    //functions are recreated from their declarations, in the order of the function table
+    FunTable* funTable = mSymbolTable->GetRootFunTable();
+    const int funCount = ReadInt();
+    for (int f = 0; f < funCount && !mStream.HasFailed(); ++f)
+    {
+        const int decCount = ReadInt();
+        FunDesc* desc = nullptr;
+        for (int d = 0; d < decCount && !mStream.HasFailed(); ++d)
+        {
+            StmtFunDec* dec = ReadNode<StmtFunDec>(NODE_MASK(StmtFunDec));
+            desc = dec != nullptr ? mSymbolTable->CreateFunctionDescription(dec) : nullptr;
+            if (desc == nullptr || desc->GetGuid() != f)
+            {
+                return false;
+            }
+        }
+        if (desc == nullptr)
+        {
+            return false;
+        }
+        desc->SetIsMethod(ReadInt() != 0);
+        const int callbackKind = ReadInt();
+        if (callbackKind == CALLBACK_STRUCT_CONSTRUCTOR)
+        {
+            desc->SetCallback(BlockScriptBuilder::GetStructConstructorCallback());
+        }
+        else if (callbackKind != CALLBACK_NONE)
+        {
+            return false;
+        }
+        if (desc->GetInputArgumentsByteSize() != ReadInt())
+        {
+            return false;
+        }
+    }
+    if (mStream.HasFailed() || funTable->GetSize() != funCount)
+    {
+        return false;
+    }
+
+    for (int i = 0; i < mFixups.Size(); ++i)
+    {
+        const FunFixup& fixup = mFixups[i];
+        if (fixup.mTable == -1)
+        {
+            continue;
+        }
+        const FunDesc* desc = GetFunDesc(fixup.mTable, fixup.mIndex);
+        if (desc == nullptr)
+        {
+            return false;
+        }
+        if (fixup.mFunCall != nullptr)
+        {
+            fixup.mFunCall->SetDesc(desc);
+        }
+        else if (fixup.mTable == 0)
+        {
+            fixup.mFunDec->SetDesc(funTable->GetDesc(fixup.mIndex));
+        }
+        else
+        {
+            //declarations of the libraries are not part of the scripts
+            return false;
+        }
+    }
+    return true;
+}
+
+Canon::CanonNode* CacheReader::ReadCanon()
+{
+    const int type = ReadInt();
+    switch (type)
+    {
+    case Canon::T_JMP:
+        return CACHE_CANON_NEW Canon::Jmp(ReadLabel());
+    case Canon::T_JMPCOND:
+        {
+            Exp* exp = ReadNode<Exp>(EXP_NODES);
+            const int comparison = ReadInt();
+            Canon::JmpCond* n = CACHE_CANON_NEW Canon::JmpCond(exp, comparison);
+            n->SetLabel(ReadLabel());
+            return n;
+        }
+    case Canon::T_RET:
+        return CACHE_CANON_NEW Canon::Ret();
+    case Canon::T_FUNGO:
+        {
+            FunCall* funCall = ReadNode<FunCall>(NODE_MASK(FunCall));
+            return CACHE_CANON_NEW Canon::FunGo(funCall, ReadLabel());
+        }
+    case Canon::T_SAVE:
+        {
+            Idd* tmp = ReadNode<Idd>(NODE_MASK(Idd));
+            return CACHE_CANON_NEW Canon::Save(tmp, ReadRegister());
+        }
+    case Canon::T_SAVE_TO_ADDR:
+        {
+            const Canon::Register lhs = ReadRegister();
+            return CACHE_CANON_NEW Canon::SaveToAddr(lhs, ReadRegister());
+        }
+    case Canon::T_LOAD:
+        {
+            const Canon::Register r = ReadRegister();
+            return CACHE_CANON_NEW Canon::Load(r, ReadNode<Exp>(EXP_NODES));
+        }
+    case Canon::T_LOAD_ADDR:
+        {
+            const Canon::Register r = ReadRegister();
+            return CACHE_CANON_NEW Canon::LoadAddr(r, ReadNode<Exp>(EXP_NODES));
+        }
+    case Canon::T_COPY_TO_ADDR:
+        {
+            const Canon::Register r = ReadRegister();
+            Exp* exp = ReadNode<Exp>(EXP_NODES);
+            return CACHE_CANON_NEW Canon::CopyToAddr(r, exp, ReadInt());
+        }
+    case Canon::T_MOVE:
+        {
+            Idd* lhs = ReadNode<Idd>(NODE_MASK(Idd));
+            return CACHE_CANON_NEW Canon::Move(lhs, ReadNode<Exp>(EXP_NODES));
+        }
+    case Canon::T_INSERT_DATA_TO_HEAP:
+        {
+            Idd* tmp = ReadNode<Idd>(NODE_MASK(Idd));
+            return CACHE_CANON_NEW Canon::InsertDataToHeap(tmp, ReadString());
+        }
+    case Canon::T_PUSHFRAME:
+        return CACHE_CANON_NEW Canon::PushFrame(ReadFrame());
+    case Canon::T_POPFRAME:
+        return CACHE_CANON_NEW Canon::PopFrame();
+    case Canon::T_CAST:
+        {
+            const bool isIntToFloat = ReadInt() != 0;
+            return CACHE_CANON_NEW Canon::Cast(isIntToFloat, ReadRegister());
+        }
+    case Canon::T_READ_OBJ_PROP:
+        {
+            Exp* loc = ReadNode<Exp>(EXP_NODES);
+            Exp* obj = ReadNode<Exp>(EXP_NODES);
+            const Object* prop = ReadObject(OBJ_PROPERTY);
+            return CACHE_CANON_NEW Canon::ReadObjProp(loc, obj, prop != nullptr ? static_cast<const PropertyNode*>(prop->mPtr) : nullptr);
+        }
+    case Canon::T_WRITE_OBJ_PROP:
+        {
+            Exp* obj = ReadNode<Exp>(EXP_NODES);
+            const Object* prop = ReadObject(OBJ_PROPERTY);
+            Exp* loc = ReadNode<Exp>(EXP_NODES);
+            return CACHE_CANON_NEW Canon::WriteObjProp(obj, prop != nullptr ? static_cast<const PropertyNode*>(prop->mPtr) : nullptr, loc);
+        }
+    case Canon::T_EXIT:
+        return CACHE_CANON_NEW Canon::Exit();
+    case Canon::T_YIELD:
+        return CACHE_CANON_NEW Canon::Yield();
+    default:
+        mStream.Fail();
+        return nullptr;
+    }
+}
+
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned long long BlockScriptCache::HashBuffer(const void* buffer, int bufferSize, unsigned long long hash)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(buffer);
+    for (int i = 0; i < bufferSize; ++i)
+    {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+void BlockScriptCache::ComputeKey(const BlockScriptBuilder* builder, const Io::FileBuffer* fb, const Container<Preprocessor::Definition>& definitions, Key& outKey)
+{
+    outKey.mSourceHash = HashBuffer(fb->GetBuffer(), fb->GetFileSize());
+
+    Hasher defHash(HASH_SEED);
+    for (int i = 0; i < definitions.Size(); ++i)
+    {
+        defHash.Str(definitions[i].mName);
+        defHash.Str(definitions[i].mValue);
+    }
+    outKey.mDefinitionsHash = defHash.Get();
+
+    Container<const SymbolTable*> libs;
+    libs.Initialize(builder->GetAllocator());
+    CollectLibraries(builder->GetSymbolTable(), libs);
+    Hasher libHash(HASH_SEED);
+    libHash.Int(libs.Size());
+    for (int l = 0; l < libs.Size(); ++l)
+    {
+        HashLibrary(libHash, libs, libs[l]);
+    }
+    outKey.mLibSignature = libHash.Get();
+}
+
+bool BlockScriptCache::Save(BlockScriptBuilder* builder, const BlockScriptBuilder::CompilationResult& result, const Key& key, const Container<Include>& includes, Utils::ByteStream& outStream)
+{
+    if (result.mAst == nullptr || result.mAsm.mBlocks == nullptr)
+    {
+        return false;
+    }
+
+    Alloc::IAllocator* alloc = builder->GetAllocator();
+    Container<const SymbolTable*> libs;
+    libs.Initialize(alloc);
+    CollectLibraries(builder->GetSymbolTable(), libs);
+
+    Utils::ByteStream payload(alloc);
+    CacheWriter writer(alloc, builder->GetSymbolTable(), libs, payload);
+    if (!writer.Write(result))
+    {
+        return false;
+    }
+
+    WriteInt(outStream, CACHE_MAGIC);
+    WriteInt(outStream, VERSION);
+    WriteU64(outStream, key.mSourceHash);
+    WriteU64(outStream, key.mDefinitionsHash);
+    WriteU64(outStream, key.mLibSignature);
+    WriteInt(outStream, includes.Size());
+    for (int i = 0; i < includes.Size(); ++i)
+    {
+        WriteInlineString(outStream, includes[i].mPath);
+        WriteU64(outStream, includes[i].mHash);
+    }
+    WriteInt(outStream, payload.GetSize());
+    WriteU64(outStream, HashBuffer(payload.GetBuffer(), payload.GetSize()));
+    outStream.Append(&payload);
+    return true;
+}
+
+bool BlockScriptCache::IsValid(const char* buffer, int bufferSize, const Key& key, IFileIncluder* includer)
+{
+    CacheHeader header;
+    if (
+           !ReadHeader(buffer, bufferSize, header)
+        || header.mKey.mSourceHash != key.mSourceHash
+        || header.mKey.mDefinitionsHash != key.mDefinitionsHash
+        || header.mKey.mLibSignature != key.mLibSignature
+        || header.mPayloadHash != HashBuffer(buffer + header.mPayloadPosition, header.mPayloadSize)
+       )
+    {
+        return false;
+    }
+
+    //open the includes again, as the compilation would, to compare their content
+    CacheStream stream(buffer + header.mIncludesPosition, header.mPayloadPosition - header.mIncludesPosition);
+    for (int i = 0; i < header.mIncludeCount; ++i)
+    {
+        int pathLen = 0;
+        const char* pathData = stream.ReadInlineString(pathLen);
+        const unsigned long long hash = stream.ReadU64();
+        if (includer == nullptr || pathLen >= Io::IOManager::MAX_FILEPATH_LENGTH)
+        {
+            return false;
+        }
+
+        char path[Io::IOManager::MAX_FILEPATH_LENGTH];
+        Utils::Memcpy(path, pathData, pathLen);
+        path[pathLen] = '\0';
+
+        const char* includeBuffer = nullptr;
+        int includeBufferSize = 0;
+        const bool opened = includer->Open(path, &includeBuffer, includeBufferSize);
+        const bool isSame = opened && HashBuffer(includeBuffer, includeBufferSize) == hash;
+        if (opened)
+        {
+            includer->Close(includeBuffer);
+        }
+        if (!isSame)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BlockScriptCache::Load(BlockScriptBuilder* builder, const char* buffer, int bufferSize, BlockScriptBuilder::CompilationResult& outResult)
+{
+    CacheHeader header;
+    if (!ReadHeader(buffer, bufferSize, header))
+    {
+        return false;
+    }
+
+    Alloc::IAllocator* alloc = builder->GetAllocator();
+    Container<const SymbolTable*> libs;
+    libs.Initialize(alloc);
+    CollectLibraries(builder->GetSymbolTable(), libs);
+
+    Assembly assembly = builder->mCanonizer.GetAssembly();
+    assembly.mGlobalsMap = &builder->mGlobalsMap;
+
+    Program* program = nullptr;
+    CacheReader reader(alloc, &builder->mAllocator, builder->GetSymbolTable(), libs, buffer + header.mPayloadPosition, header.mPayloadSize);
+    if (!reader.Read(*assembly.mBlocks, *assembly.mFunBlockMap, *assembly.mGlobalsMap, program))
+    {
+        return false;
+    }
+
+    builder->mActiveResult.mAst = program;
+    builder->mActiveResult.mAsm = assembly;
+    outResult = builder->mActiveResult;
+    return true;
+}
@@ -13,9 +13,12 @@
 #include "Pegasus/BlockScript/BlockScriptAst.h"
 #include "Pegasus/BlockScript/EventListeners.h"
 #include "Pegasus/BlockScript/IFileIncluder.h"
+#include "Pegasus/BlockScript/IBytecodeCache.h"
 #include "Pegasus/Utils/String.h"
 #include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/ByteStream.h"
 #include "Pegasus/Core/Io.h"
+#include "Pegasus/Core/Time.h"
 
 using namespace Pegasus;
 using namespace Pegasus::BlockScript;
@@ -24,8 +27,49 @@ using namespace Pegasus::BlockScript;
 
 extern void Bison_BlockScriptParse(const Io::FileBuffer* fileBuffer, BlockScript::BlockScriptBuilder* builder, BlockScript::IFileIncluder* fileIncluder, BlockScript::Container<BlockScript::Preprocessor::Definition>* definitionList);
 
+namespace
+{
+
+//! File includer forwarding to the includer of the compiler, and recording the includes with the hash of their content
+class RecordingFileIncluder : public IFileIncluder
+{
+public:
+    RecordingFileIncluder(IFileIncluder* includer, Container<BlockScriptCache::Include>& includes)
+    : mIncluder(includer), mIncludes(includes)
+    {
+    }
+
+    virtual ~RecordingFileIncluder() {}
+
+    virtual bool Open(const char* filePath, const char** outBuffer, int& outBufferSize)
+    {
+        //the paths are allocated by the builder, so they are valid until the cache is written
+        BlockScriptCache::Include& include = mIncludes.PushEmpty();
+        include.mPath = filePath;
+        if (mIncluder != nullptr && mIncluder->Open(filePath, outBuffer, outBufferSize))
+        {
+            include.mHash = BlockScriptCache::HashBuffer(*outBuffer, outBufferSize);
+            return true;
+        }
+
+        //an include that failed to open fails the compilation, which is never cached
+        return false;
+    }
+
+    virtual void Close(const char* buffer)
+    {
+        mIncluder->Close(buffer);
+    }
+
+private:
+    IFileIncluder* mIncluder;
+    Container<BlockScriptCache::Include>& mIncludes;
+};
+
+}
+
 BlockScriptCompiler::BlockScriptCompiler(Alloc::IAllocator* allocator)
-: mAllocator(allocator), mAst(nullptr), mFileIncluder(nullptr), mTitle("<No-Title>")
+: mAllocator(allocator), mAst(nullptr), mFileIncluder(nullptr), mBytecodeCache(nullptr), mIsLoadedFromCache(false), mCompilationTime(0.0), mTitle("<No-Title>")
 {
     mDefinitionList.Initialize(allocator);
     mBuilder.Initialize(mAllocator);
@@ -38,13 +82,92 @@ BlockScriptCompiler::~BlockScriptCompiler()
 
 bool BlockScriptCompiler::Compile(const Io::FileBuffer* fb)
 {
+    const unsigned long long startTick = Core::GetPerformanceCounter();
+    mIsLoadedFromCache = false;
+
+    BlockScriptCache::Key key;
+    if (mBytecodeCache != nullptr)
+    {
+        BlockScriptCache::ComputeKey(&mBuilder, fb, mDefinitionList, key);
+        mIsLoadedFromCache = LoadFromCache(key);
+    }
+
+    const bool success = mIsLoadedFromCache || CompileSource(fb, key);
+    mCompilationTime = static_cast<double>(Core::GetPerformanceCounter() - startTick) * Core::GetPerformanceCounterPeriod() * 1000.0;
+    return success;
+}
+
+bool BlockScriptCompiler::CompileSource(const Io::FileBuffer* fb, const BlockScriptCache::Key& key)
+{
+    Container<BlockScriptCache::Include> includes;
+    includes.Initialize(mAllocator);
+    RecordingFileIncluder recordingIncluder(mFileIncluder, includes);
+
     mBuilder.BeginBuild(mTitle); 
-    Bison_BlockScriptParse(fb, &mBuilder, mFileIncluder, &mDefinitionList);
+    Bison_BlockScriptParse(fb, &mBuilder, mBytecodeCache != nullptr ? &recordingIncluder : mFileIncluder, &mDefinitionList);
     BlockScriptBuilder::CompilationResult cr;
 	mBuilder.EndBuild(cr);
     mAst = cr.mAst;
     mAsm = cr.mAsm;
-    return mAst != nullptr && mBuilder.GetErrorCount() == 0;
+    const bool success = mAst != nullptr && mBuilder.GetErrorCount() == 0;
+
+    if (success && mBytecodeCache != nullptr)
+    {
+        Utils::ByteStream stream(mAllocator);
+        if (BlockScriptCache::Save(&mBuilder, cr, key, includes, stream))
+        {
+            mBytecodeCache->Write(stream.GetBuffer(), stream.GetSize());
+        }
+    }
+    return success;
+}
+
+bool BlockScriptCompiler::LoadFromCache(const BlockScriptCache::Key& key)
+{
+    const char* buffer = nullptr;
+    int bufferSize = 0;
+    if (!mBytecodeCache->Read(&buffer, bufferSize))
+    {
+        return false;
+    }
+
+    BlockScriptBuilder::CompilationResult cr;
+    const bool isLoaded = BlockScriptCache::IsValid(buffer, bufferSize, key, mFileIncluder)
+                       && BlockScriptCache::Load(&mBuilder, buffer, bufferSize, cr);
+    mBytecodeCache->ReleaseRead(buffer);
+
+    if (!isLoaded)
+    {
+        //a failed load leaves partial state in the builder, start over keeping the libraries
+        SymbolTable* symbolTable = mBuilder.GetSymbolTable();
+        Container<SymbolTable*> libs;
+        libs.Initialize(mAllocator);
+        for (int i = 0; i < symbolTable->GetChildCount(); ++i)
+        {
+            libs.PushEmpty() = symbolTable->GetChild(i);
+        }
+        mBuilder.Reset();
+        for (int i = 0; i < libs.Size(); ++i)
+        {
+            symbolTable->RegisterChild(libs[i]);
+        }
+        return false;
+    }
+
+    //the listeners see a compilation without errors
+    Container<IBlockScriptCompilerListener*>& listeners = mBuilder.GetEventListeners();
+    for (int i = 0; i < listeners.Size(); ++i)
+    {
+        listeners[i]->OnCompilationBegin();
+    }
+    for (int i = 0; i < listeners.Size(); ++i)
+    {
+        listeners[i]->OnCompilationEnd(true);
+    }
+
+    mAst = cr.mAst;
+    mAsm = cr.mAsm;
+    return true;
 }
 
 void BlockScriptCompiler::RegisterDefinitions(const char* definitionNames[], const char* definitionValues[], int definitionCounts)
@@ -14,8 +14,10 @@
 #include "Pegasus/BlockScript/BlockScriptAst.h"
 #include "Pegasus/BlockScript/FunDesc.h"
 #include "Pegasus/BlockScript/FunCallback.h"
+#include "Pegasus/BlockScript/FunBinding.h"
 #include "Pegasus/BlockScript/BlockLib.h"
 #include "Pegasus/BlockScript/BsVm.h"
+#include "Pegasus/BlockScript/Canonizer.h"
 #include "Pegasus/BlockScript/EventListeners.h"
 #include "Pegasus/Utils/String.h"
 #include "Pegasus/Utils/Memcpy.h"
@@ -24,6 +26,8 @@
 #include "Pegasus/Math/Quaternion.h"
 #include "Pegasus/Core/Log.h"
 #include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Memory/FrameAllocator.h"
 
 using namespace Pegasus;
 using namespace Pegasus::BlockScript;
@@ -33,195 +37,122 @@ using namespace Pegasus::BlockScript::Ast;
 namespace Private_VectorConstructors
 {
 
-template<int sz>
-void ConstructMatrixN_by_N(FunCallbackContext& context)
+Math::Vec4 ConstructFloat4_float_float_float_float(float x, float y, float z, float w)
 {
-    PG_ASSERTSTR(context.GetInputBufferSize() == sizeof(float)*sz, "Size of input buffer: %d", context.GetInputBufferSize());
-    PG_ASSERTSTR(context.GetOutputBufferSize() == sizeof(float)*sz, "Size of output buffer: %d", context.GetOutputBufferSize());
-    void* argin = context.GetRawInputBuffer();
-    void* argout = context.GetRawOutputBuffer();
-    Utils::Memcpy(argout, argin, context.GetInputBufferSize());
+    return Math::Vec4(x, y, z, w);
 }
 
-void ConstructFloat4_float_float_float_float(FunCallbackContext& context)
+Math::Vec4 ConstructFloat4_float3_float(const Math::Vec3& xyz, float w)
 {
-    PG_ASSERT(context.GetInputBufferSize() == sizeof(float)*4);
-    PG_ASSERT(context.GetOutputBufferSize() == sizeof(float)*4);
-
-    void* argin = context.GetRawInputBuffer();
-    void* argout = context.GetRawOutputBuffer();
-
-    Math::Vec4* v4 = static_cast<Math::Vec4*>(argout);
-    v4->x = ((float*)(argin))[0];
-    v4->y = ((float*)(argin))[1];
-    v4->z = ((float*)(argin))[2];
-    v4->w = ((float*)(argin))[3];
-    
+    return Math::Vec4(xyz.x, xyz.y, xyz.z, w);
 }
 
-void ConstructFloat4_int_int_int_int(FunCallbackContext& context)
+Math::Vec4 ConstructFloat4_int_int_int_int(int x, int y, int z, int w)
 {
-    PG_ASSERT(context.GetInputBufferSize() == sizeof(float)*4);
-    PG_ASSERT(context.GetOutputBufferSize() == sizeof(float)*4);
-
-    void* argin = context.GetRawInputBuffer();
-    void* argout = context.GetRawOutputBuffer();
-
-    Math::Vec4* v4 = static_cast<Math::Vec4*>(argout);
-    v4->x = static_cast<float>(((int*)(argin))[0]);
-    v4->y = static_cast<float>(((int*)(argin))[1]);
-    v4->z = static_cast<float>(((int*)(argin))[2]);
-    v4->w = static_cast<float>(((int*)(argin))[3]);
-    
+    return Math::Vec4(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z), static_cast<float>(w));
 }
 
-void ConstructFloat4_float(FunCallbackContext& context)
+Math::Vec4 ConstructFloat4_float(float v)
 {
-    PG_ASSERT(context.GetInputBufferSize() == sizeof(float));
-    PG_ASSERT(context.GetOutputBufferSize() == sizeof(float)*4);
-
-    void* argin = context.GetRawInputBuffer();
-    void* argout = context.GetRawOutputBuffer();
-
-    float v = *((float*)argin);
-
-    Math::Vec4* v4 = static_cast<Math::Vec4*>(argout);
-    v4->x = v; 
-    v4->y = v;
-    v4->z = v;
-    v4->w = v;
-    
+    return Math::Vec4(v, v, v, v);
 }
 
-void ConstructFloat4_int(FunCallbackContext& context)
+Math::Vec4 ConstructFloat4_int(int v)
 {
-    PG_ASSERT(context.GetInputBufferSize() == sizeof(float));
-    PG_ASSERT(context.GetOutputBufferSize() == sizeof(float)*4);
-
-    void* argin = context.GetRawInputBuffer();
-    void* argout = context.GetRawOutputBuffer();
-    float v = static_cast<float>(*((int*)argin));
-
-    Math::Vec4* v4 = static_cast<Math::Vec4*>(argout);
-    v4->x = v; 
-    v4->y = v;
-    v4->z = v;
-    v4->w = v;
-    
+    return ConstructFloat4_float(static_cast<float>(v));
 }
 
-void ConstructFloat3_float_float_float(FunCallbackContext& context)
+Math::Vec3 ConstructFloat3_float_float_float(float x, float y, float z)
 {
-    PG_ASSERT(context.GetInputBufferSize() == sizeof(float)*3);
-    PG_ASSERT(context.GetOutputBufferSize() == sizeof(float)*3);
-
-    void* argin = context.GetRawInputBuffer();
-    void* argout = context.GetRawOutputBuffer();
-
-    Math::Vec3* v3 = static_cast<Math::Vec3*>(argout);
-    v3->x = ((float*)(argin))[0];
-    v3->y = ((float*)(argin))[1];
-    v3->z = ((float*)(argin))[2];
-    
+    return Math::Vec3(x, y, z);
 }
 
-void ConstructFloat3_int_int_int(FunCallbackContext& context)
+Math::Vec3 ConstructFloat3_float2_float(const Math::Vec2& xy, float z)
 {
-    PG_ASSERT(context.GetInputBufferSize() == sizeof(float)*3);
-    PG_ASSERT(context.GetOutputBufferSize() == sizeof(float)*3);
-
-    void* argin = context.GetRawInputBuffer();
-    void* argout = context.GetRawOutputBuffer();
+    return Math::Vec3(xy.x, xy.y, z);
+}
 
-    Math::Vec3* v3 = static_cast<Math::Vec3*>(argout);
-    v3->x = static_cast<float>(((int*)(argin))[0]);
-    v3->y = static_cast<float>(((int*)(argin))[1]);
-    v3->z = static_cast<float>(((int*)(argin))[2]);
-    
+Math::Vec3 ConstructFloat3_int_int_int(int x, int y, int z)
+{
+    return Math::Vec3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
 }
 
-void ConstructFloat3_float(FunCallbackContext& context)
+Math::Vec3 ConstructFloat3_float(float v)
 {
-    PG_ASSERT(context.GetInputBufferSize() == sizeof(float));
-    PG_ASSERT(context.GetOutputBufferSize() == sizeof(float)*3);
-    void* argin = context.GetRawInputBuffer();
-    void* argout = context.GetRawOutputBuffer();
-    float v = *((float*)argin);
+    return Math::Vec3(v, v, v);
+}
 
-    Math::Vec3* v3 = static_cast<Math::Vec3*>(argout);
-    v3->x = v; 
-    v3->y = v;
-    v3->z = v;
-    
+Math::Vec3 ConstructFloat3_int(int v)
+{
+    return ConstructFloat3_float(static_cast<float>(v));
 }
 
-void ConstructFloat3_int(FunCallbackContext& context)
+Math::Vec2 ConstructFloat2_float_float(float x, float y)
 {
-    PG_ASSERT(context.GetInputBufferSize() == sizeof(float));
-    PG_ASSERT(context.GetOutputBufferSize() == sizeof(float)*3);
-    void* argin = context.GetRawInputBuffer();
-    void* argout = context.GetRawOutputBuffer();
-    float v = static_cast<float>(*((int*)argin));
+    return Math::Vec2(x, y);
+}
 
-    Math::Vec3* v3 = static_cast<Math::Vec3*>(argout);
-    v3->x = v; 
-    v3->y = v;
-    v3->z = v;
-    
+Math::Vec2 ConstructFloat2_int_int(int x, int y)
+{
+    return Math::Vec2(static_cast<float>(x), static_cast<float>(y));
 }
 
-void ConstructFloat2_float_float(FunCallbackContext& context)
+Math::Vec2 ConstructFloat2_float(float v)
 {
-    PG_ASSERT(context.GetInputBufferSize() == sizeof(float)*2);
-    PG_ASSERT(context.GetOutputBufferSize() == sizeof(float)*2);
-    void* argin = context.GetRawInputBuffer();
-    void* argout = context.GetRawOutputBuffer();
+    return Math::Vec2(v, v);
+}
 
-    Math::Vec2* v2 = static_cast<Math::Vec2*>(argout);
-    v2->x = ((float*)(argin))[0];
-    v2->y = ((float*)(argin))[1];
-    
+Math::Vec2 ConstructFloat2_int(int v)
+{
+    return ConstructFloat2_float(static_cast<float>(v));
 }
 
-void ConstructFloat2_int_int(FunCallbackContext& context)
+// matrices are filled in the order of the arguments (the vectors are the rows of the storage)
+Math::Mat44 ConstructFloat4x4_float4(const Math::Vec4& x, const Math::Vec4& y, const Math::Vec4& z, const Math::Vec4& w)
 {
-    PG_ASSERT(context.GetInputBufferSize() == sizeof(float)*2);
-    PG_ASSERT(context.GetOutputBufferSize() == sizeof(float)*2);
-    void* argin = context.GetRawInputBuffer();
-    void* argout = context.GetRawOutputBuffer();
+    return Math::Mat44(x.x, x.y, x.z, x.w,
+                       y.x, y.y, y.z, y.w,
+                       z.x, z.y, z.z, z.w,
+                       w.x, w.y, w.z, w.w);
+}
 
-    Math::Vec2* v2 = static_cast<Math::Vec2*>(argout);
-    v2->x = static_cast<float>(((int*)(argin))[0]);
-    v2->y = static_cast<float>(((int*)(argin))[1]);
-    
+Math::Mat44 ConstructFloat4x4_float(float m11, float m12, float m13, float m14,
+                                    float m21, float m22, float m23, float m24,
+                                    float m31, float m32, float m33, float m34,
+                                    float m41, float m42, float m43, float m44)
+{
+    return Math::Mat44(m11, m12, m13, m14,
+                       m21, m22, m23, m24,
+                       m31, m32, m33, m34,
+                       m41, m42, m43, m44);
 }
 
-void ConstructFloat2_float(FunCallbackContext& context)
+Math::Mat33 ConstructFloat3x3_float3(const Math::Vec3& x, const Math::Vec3& y, const Math::Vec3& z)
 {
-    PG_ASSERT(context.GetInputBufferSize() == sizeof(float));
-    PG_ASSERT(context.GetOutputBufferSize() == sizeof(float)*2);
-    void* argin = context.GetRawInputBuffer();
-    void* argout = context.GetRawOutputBuffer();
-    float v = *((float*)argin);
+    return Math::Mat33(x.x, x.y, x.z,
+                       y.x, y.y, y.z,
+                       z.x, z.y, z.z);
+}
 
-    Math::Vec2* v2 = static_cast<Math::Vec2*>(argout);
-    v2->x = v; 
-    v2->y = v;
-    
+Math::Mat33 ConstructFloat3x3_float(float m11, float m12, float m13,
+                                    float m21, float m22, float m23,
+                                    float m31, float m32, float m33)
+{
+    return Math::Mat33(m11, m12, m13,
+                       m21, m22, m23,
+                       m31, m32, m33);
 }
 
-void ConstructFloat2_int(FunCallbackContext& context)
+Math::Mat22 ConstructFloat2x2_float2(const Math::Vec2& x, const Math::Vec2& y)
 {
-    PG_ASSERT(context.GetInputBufferSize() == sizeof(float));
-    PG_ASSERT(context.GetOutputBufferSize() == sizeof(float)*2);
-    void* argin = context.GetRawInputBuffer();
-    void* argout = context.GetRawOutputBuffer();
-    float v = static_cast<float>(*((int*)argin));
+    return Math::Mat22(x.x, x.y,
+                       y.x, y.y);
+}
 
-    Math::Vec2* v2 = static_cast<Math::Vec2*>(argout);
-    v2->x = v; 
-    v2->y = v;
-    
+Math::Mat22 ConstructFloat2x2_float(float m11, float m12, float m21, float m22)
+{
+    return Math::Mat22(m11, m12,
+                       m21, m22);
 }
 
 }
@@ -229,154 +160,198 @@ void ConstructFloat2_int(FunCallbackContext& context)
 // Intrinsic functions for misc utilities
 namespace Private_Utilities
 {
-void Echo_String(FunCallbackContext& context)
+void Echo_String(const char* str)
 {
-    int* heapPtr = static_cast<int*>(context.GetRawInputBuffer());
-    PG_ASSERT(context.GetInputBufferSize() == sizeof(int));
-
-    BsVmState::HeapElement& str = context.GetVmState()->GetHeapElement(*heapPtr);
     if (Pegasus::BlockScript::SystemCallbacks::gPrintStrCallback != nullptr)
     {
-        Pegasus::BlockScript::SystemCallbacks::gPrintStrCallback(static_cast<char*>(str.mObject));
+        Pegasus::BlockScript::SystemCallbacks::gPrintStrCallback(str);
     }
 }
 
-void Echo_Int(FunCallbackContext& context)
+void Echo_Int(int v)
 {
-    int* intPtr = static_cast<int*>(context.GetRawInputBuffer());
-    PG_ASSERT(context.GetInputBufferSize() == sizeof(int));
-
-    int v = *intPtr;
     if (Pegasus::BlockScript::SystemCallbacks::gPrintIntCallback != nullptr)
     {
         Pegasus::BlockScript::SystemCallbacks::gPrintIntCallback(v);
     } 
 }
 
-void Echo_Float(FunCallbackContext& context)
+void Echo_Float(float v)
 {
-    int* floatPtr = static_cast<int*>(context.GetRawInputBuffer());
-    PG_ASSERT(context.GetInputBufferSize() == sizeof(float));
-
-    float v = *reinterpret_cast<float*>(floatPtr);
     if (Pegasus::BlockScript::SystemCallbacks::gPrintFloatCallback != nullptr)
     {
         Pegasus::BlockScript::SystemCallbacks::gPrintFloatCallback(v);
     } 
 }
 
+//! Checks that an array of count elements starting at a pointer is inside the memory of a state
+static bool IsArrayInRam(BsVmState* state, const void* array, int elementSize, int count, int& outOffset)
+{
+    const char* ram = state->Ram();
+    const char* ptr = static_cast<const char*>(array);
+    const int ramSize = state->GetRamSize();
+    if (ptr < ram || ptr > ram + ramSize)
+    {
+        return false;
+    }
+
+    //compared by division, count * elementSize can overflow
+    outOffset = static_cast<int>(ptr - ram);
+    return elementSize == 0 || count <= (ramSize - outOffset) / elementSize;
+}
+
+//! Executes a script function on each element of an array, writing its return values in another array (see ExecuteFunctionBatch).
+//! The arrays are passed with the star type, so the function is selected by its name: it must take one argument.
+//! Only functions running in lanes are accepted, so the batch can be executed at any stack level: running the instances
+//! one at a time would need the vm state, which is busy executing the calling script.
+int BatchExecute(BsVmState* state, const char* functionName, void* inputs, void* outputs, int count)
+{
+    const Assembly* assembly = state->GetAssembly();
+    PG_ASSERT(assembly != nullptr);
+
+    FunBindPoint bindPoint = FUN_INVALID_BIND_POINT;
+    for (int i = 0; i < assembly->mFunBlockMap->Size(); ++i)
+    {
+        const StmtFunDec* funDec = (*assembly->mFunBlockMap)[i].mFunDesc->GetDec();
+        if (!Utils::Strcmp(funDec->GetName(), functionName) &&
+            funDec->GetArgList() != nullptr && funDec->GetArgList()->GetArgDec() != nullptr &&
+            (funDec->GetArgList()->GetTail() == nullptr || funDec->GetArgList()->GetTail()->GetArgDec() == nullptr))
+        {
+            if (bindPoint != FUN_INVALID_BIND_POINT)
+            {
+                PG_LOG('ERR_', "BatchExecute cannot select between the overloads of \"%s\".", functionName);
+                return 0;
+            }
+            bindPoint = i;
+        }
+    }
+
+    if (bindPoint == FUN_INVALID_BIND_POINT)
+    {
+        PG_LOG('ERR_', "BatchExecute cannot find a function \"%s\" with one argument.", functionName);
+        return 0;
+    }
+
+    const StmtFunDec* funDec = (*assembly->mFunBlockMap)[bindPoint].mFunDesc->GetDec();
+    const int inputSize = funDec->GetArgList()->GetArgDec()->GetType()->GetByteSize();
+    const int outputSize = funDec->GetReturnType()->GetByteSize();
+    int inputOffset = 0;
+    int outputOffset = 0;
+    if (count < 0 ||
+        !IsArrayInRam(state, inputs, inputSize, count, inputOffset) ||
+        !IsArrayInRam(state, outputs, outputSize, count, outputOffset))
+    {
+        PG_LOG('ERR_', "BatchExecute of \"%s\" on %d instances, out of the bounds of the arrays.", functionName, count);
+        return 0;
+    }
+
+    if (!CanExecuteFunctionInLanes(bindPoint, *assembly, *state))
+    {
+        PG_LOG('ERR_', "BatchExecute cannot run \"%s\" in lanes. It must not write globals, access object properties, create strings or pass the star type to a callback.", functionName);
+        return 0;
+    }
+
+    if (count == 0)
+    {
+        return 1;
+    }
+
+    //the memory of the state can be reallocated by the callbacks of the batch, so the arrays are copied
+    //and the outputs are written back at their offset once the batch is done.
+    //The copies do not outlive the call, they are transient data of the frame
+    Alloc::IAllocator* allocator = Memory::GetFrameAllocator();
+    char* inputCopy = PG_NEW_ARRAY(allocator, -1, "BatchExecute inputs", Alloc::PG_MEM_TEMP, char, count * inputSize + 1);
+    char* outputCopy = PG_NEW_ARRAY(allocator, -1, "BatchExecute outputs", Alloc::PG_MEM_TEMP, char, count * outputSize + 1);
+    Utils::Memcpy(inputCopy, state->Ram() + inputOffset, count * inputSize);
+
+    BsVm vm;
+    const bool success = ExecuteFunctionBatch(bindPoint, nullptr, *assembly, *state, vm, inputCopy, inputSize, outputCopy, outputSize, count);
+    if (success)
+    {
+        Utils::Memcpy(state->Ram() + outputOffset, outputCopy, count * outputSize);
+    }
+    else
+    {
+        PG_LOG('ERR_', "BatchExecute of \"%s\" failed.", functionName);
+    }
+
+    PG_DELETE_ARRAY(allocator, inputCopy);
+    PG_DELETE_ARRAY(allocator, outputCopy);
+    return success ? 1 : 0;
+}
+
 }
 
 namespace Private_Math
 {
     template<class T>
-    void Lerp(FunCallbackContext& context)
+    T Lerp(const T& a, const T& b, float t)
     {
-        FunParamStream stream(context);
-        T& a = stream.NextArgument<T>();
-        T& b = stream.NextArgument<T>();
-        float t = stream.NextArgument<float>();
-        stream.SubmitReturn<T>(Math::Lerp(a,b,t));
+        return Math::Lerp(a, b, t);
     }
 
     template<class V, class M, void MULF(V&, const M&, const V&)>
-    void Mul(FunCallbackContext& context)   
+    V Mul(const M& m, const V& v)
     {
-        FunParamStream stream(context);
-        M& m = stream.NextArgument<M>();
-        V& t = stream.NextArgument<V>();
-        PG_ASSERT(sizeof(V) == context.GetOutputBufferSize());
-        V* r = static_cast<V*>(context.GetRawOutputBuffer());
-        MULF(*r, m, t);
+        V r;
+        MULF(r, m, v);
+        return r;
     }
 
     template<class T>
-    void Dot(FunCallbackContext& context)
+    float Dot(const T& v1, const T& v2)
     {
-        FunParamStream stream(context);
-        T& v1 = stream.NextArgument<T>();
-        T& v2 = stream.NextArgument<T>();
-        stream.SubmitReturn<float>(Math::Dot(v1,v2));
+        return Math::Dot(v1, v2);
     }
 
     template<class T>
-    void Cross(FunCallbackContext& context)
+    T Cross(const T& v1, const T& v2)
     {
-        FunParamStream stream(context); 
-        T& v1 = stream.NextArgument<T>();
-        T& v2 = stream.NextArgument<T>(); 
-        stream.SubmitReturn<T>(Math::Cross(v1, v2));
+        return Math::Cross(v1, v2);
     }
 
-    void Sin(FunCallbackContext& context)
+    float Sin(float v)
     {
-        FunParamStream stream(context); 
-        float v1 = stream.NextArgument<float>();
-        stream.SubmitReturn<float>(Math::Sin(v1));
+        return Math::Sin(v);
     }
 
-    void Cos(FunCallbackContext& context)
+    float Cos(float v)
     {
-        FunParamStream stream(context); 
-        float v1 = stream.NextArgument<float>();
-        stream.SubmitReturn<float>(Math::Cos(v1));
+        return Math::Cos(v);
     }
 
-    void Mat44_Rotation(FunCallbackContext& context)
+    Math::Mat44 Mat44_Rotation(const Math::Vec3& axis, float amount)
     {
-        FunParamStream stream(context); 
-        Math::Vec3 axis = stream.NextArgument<Math::Vec3>();
-        float amount = stream.NextArgument<float>();
-        PG_ASSERT(context.GetOutputBufferSize() == sizeof(Math::Mat44));
-        Math::Mat44& res = *static_cast<Math::Mat44*>(context.GetRawOutputBuffer());
-        Math::SetRotation(res, axis, amount );
+        Math::Mat44 res;
+        Math::SetRotation(res, axis, amount);
+        return res;
     }
     
-    void Mat44_Proj1(FunCallbackContext& context)
+    Math::Mat44 Mat44_Proj1(float l, float r, float t, float b, float n, float f)
     {
-        FunParamStream stream(context);
-        PG_ASSERT(context.GetOutputBufferSize() == sizeof(Math::Mat44));
-        Math::Mat44& res = *static_cast<Math::Mat44*>(context.GetRawOutputBuffer());
-        float l = stream.NextArgument<float>();
-        float r = stream.NextArgument<float>();
-        float t = stream.NextArgument<float>();
-        float b = stream.NextArgument<float>();
-        float n = stream.NextArgument<float>();
-        float f = stream.NextArgument<float>();
+        Math::Mat44 res;
         Math::SetProjection(
             res,
             l,r,t,b,n,f
         );
+        return res;
     }
 
-    void Mat44_Proj2(FunCallbackContext& context)
+    Math::Mat44 Mat44_Proj2(float fov, float aspect, float n, float f)
     {
-        FunParamStream stream(context);
-        PG_ASSERT(context.GetOutputBufferSize() == sizeof(Math::Mat44));
-        Math::Mat44& res = *static_cast<Math::Mat44*>(context.GetRawOutputBuffer());
-        float fov = stream.NextArgument<float>();
-        float aspect = stream.NextArgument<float>();
-        float n = stream.NextArgument<float>();
-        float f = stream.NextArgument<float>();
+        Math::Mat44 res;
         Math::SetProjection(
             res,
             fov,aspect,n,f
         );
-        
+        return res;
     }
 
-    void DivUp(FunCallbackContext& context)
+    int DivUp(int a, int b)
     {
-        FunParamStream stream(context);
-        PG_ASSERT(context.GetInputBufferSize() == 2*sizeof(int));
-        PG_ASSERT(context.GetOutputBufferSize() == sizeof(int));
-
-        int a = stream.NextArgument<int>();
-        int b = stream.NextArgument<int>();
         int m = a % b;
         int d = a / b;
-        int r = d + (m > 0 ? 1 : 0);
-        stream.SubmitReturn<int>(r);
+        return d + (m > 0 ? 1 : 0);
     }
 
 }
@@ -441,52 +416,48 @@ void Pegasus::BlockScript::RegisterIntrinsics(BlockLib* lib)
 
     const Pegasus::BlockScript::FunctionDeclarationDesc funConstructors[] =
     {
-        //*funName | retType | argsTypes                                   |  argNames                    | callback
+        //*binding                                                                       | funName | argNames
         ///////////////////////////////////////////float4///////////////////////////////////////////////////////////////
-        { "float4", "float4", {"float", "float", "float", "float", nullptr}, {"x", "y", "z", "w", nullptr}, Private_VectorConstructors::ConstructFloat4_float_float_float_float },
-        { "float4", "float4", {"float3", "float", nullptr},                  {"xyz", "w", nullptr},         Private_VectorConstructors::ConstructFloat4_float_float_float_float },
-        { "float4", "float4", {"int", "int", "int", "int", nullptr},         {"x", "y", "z", "w", nullptr}, Private_VectorConstructors::ConstructFloat4_int_int_int_int },
-        { "float4", "float4", {"float", nullptr},                            {"xyzw", nullptr},             Private_VectorConstructors::ConstructFloat4_float },
-        { "float4", "float4", {"int", nullptr},                              {"xyzw", nullptr},             Private_VectorConstructors::ConstructFloat4_int },
+        BS_BIND(Private_VectorConstructors::ConstructFloat4_float_float_float_float)::Declare("float4", "x", "y", "z", "w"),
+        BS_BIND(Private_VectorConstructors::ConstructFloat4_float3_float)::Declare(           "float4", "xyz", "w"),
+        BS_BIND(Private_VectorConstructors::ConstructFloat4_int_int_int_int)::Declare(        "float4", "x", "y", "z", "w"),
+        BS_BIND(Private_VectorConstructors::ConstructFloat4_float)::Declare(                  "float4", "xyzw"),
+        BS_BIND(Private_VectorConstructors::ConstructFloat4_int)::Declare(                    "float4", "xyzw"),
         ///////////////////////////////////////////float3///////////////////////////////////////////////////////////////
-        { "float3", "float3", {"float" , "float", "float", nullptr},         {"x", "y", "z", nullptr},      Private_VectorConstructors::ConstructFloat3_float_float_float },
-        { "float3", "float3", {"float2", "float", nullptr},                  {"x", "y", "z", nullptr},      Private_VectorConstructors::ConstructFloat3_float_float_float },
-        { "float3", "float3", {"int", "int", "int", nullptr},                {"x", "y", "z", nullptr},      Private_VectorConstructors::ConstructFloat3_int_int_int },
-        { "float3", "float3", {"float", nullptr},                            {"xyz", nullptr},              Private_VectorConstructors::ConstructFloat3_float },
-        { "float3", "float3", {"int", nullptr},                              {"xyz", nullptr},              Private_VectorConstructors::ConstructFloat3_int },
+        BS_BIND(Private_VectorConstructors::ConstructFloat3_float_float_float)::Declare(      "float3", "x", "y", "z"),
+        BS_BIND(Private_VectorConstructors::ConstructFloat3_float2_float)::Declare(           "float3", "x", "y"),
+        BS_BIND(Private_VectorConstructors::ConstructFloat3_int_int_int)::Declare(            "float3", "x", "y", "z"),
+        BS_BIND(Private_VectorConstructors::ConstructFloat3_float)::Declare(                  "float3", "xyz"),
+        BS_BIND(Private_VectorConstructors::ConstructFloat3_int)::Declare(                    "float3", "xyz"),
         ///////////////////////////////////////////float2///////////////////////////////////////////////////////////////
-        {"float2", "float2",  {"float", "float", nullptr},                   {"x", "y", nullptr},           Private_VectorConstructors::ConstructFloat2_float_float },
-        {"float2", "float2",  {"int", "int", nullptr},                       {"x", "y", nullptr},           Private_VectorConstructors::ConstructFloat2_int_int },
-        {"float2", "float2",  {"float", nullptr},                            {"xy", nullptr},               Private_VectorConstructors::ConstructFloat2_float },
-        {"float2", "float2",  {"int", nullptr},                              {"xy", nullptr},               Private_VectorConstructors::ConstructFloat2_int },
+        BS_BIND(Private_VectorConstructors::ConstructFloat2_float_float)::Declare(            "float2", "x", "y"),
+        BS_BIND(Private_VectorConstructors::ConstructFloat2_int_int)::Declare(                "float2", "x", "y"),
+        BS_BIND(Private_VectorConstructors::ConstructFloat2_float)::Declare(                  "float2", "xy"),
+        BS_BIND(Private_VectorConstructors::ConstructFloat2_int)::Declare(                    "float2", "xy"),
         ///////////////////////////////////////////echo///////////////////////////////////////////////////////////////
-        {"echo",   "int",     {"string", nullptr},                           {"input", nullptr},            Private_Utilities::Echo_String },
-        {"echo",   "int",     {"int", nullptr},                              {"input", nullptr},            Private_Utilities::Echo_Int },
-        {"echo",   "int",     {"float", nullptr},                            {"input", nullptr},            Private_Utilities::Echo_Float },
+        BS_BIND(Private_Utilities::Echo_String)::Declare("echo", "input"),
+        BS_BIND(Private_Utilities::Echo_Int)::Declare(   "echo", "input"),
+        BS_BIND(Private_Utilities::Echo_Float)::Declare( "echo", "input"),
+        ///////////////////////////////////////////batch///////////////////////////////////////////////////////////////
+        BS_BIND(Private_Utilities::BatchExecute)::Declare("BatchExecute", "functionName", "inputs[]", "outputs[]", "count"),
         ///////////////////////////////////////////float4x4///////////////////////////////////////////////////////////////
-        { "float4x4", "float4x4", {"float4", "float4", "float4", "float4", nullptr}, {"col_x", "col_y", "col_z", "col_w", nullptr}, Private_VectorConstructors::ConstructMatrixN_by_N<16>},
-        { "float4x4", "float4x4", {"float", "float", "float", "float", 
-                               "float", "float", "float", "float", 
-                               "float", "float", "float", "float", 
-                               "float", "float", "float", "float", nullptr}, 
-                              {"m11", "m12", "m13", "m14",
-                               "m21", "m22", "m23", "m24",
-                               "m31", "m32", "m33", "m34",
-                               "m41", "m42", "m43", "m44",  nullptr}, Private_VectorConstructors::ConstructMatrixN_by_N<16> },
+        BS_BIND(Private_VectorConstructors::ConstructFloat4x4_float4)::Declare("float4x4", "col_x", "col_y", "col_z", "col_w"),
+        BS_BIND(Private_VectorConstructors::ConstructFloat4x4_float)::Declare("float4x4",
+                                                                                "m11", "m12", "m13", "m14",
+                                                                                "m21", "m22", "m23", "m24",
+                                                                                "m31", "m32", "m33", "m34",
+                                                                                "m41", "m42", "m43", "m44"),
         ///////////////////////////////////////////float3x3///////////////////////////////////////////////////////////////
-        { "float3x3", "float3x3", {"float3", "float3", "float3", nullptr}, {"col_x", "col_y", "col_z", nullptr}, Private_VectorConstructors::ConstructMatrixN_by_N<9> },
-        { "float3x3", "float3x3", {"float", "float", "float", 
-                               "float", "float", "float", 
-                               "float", "float", "float", nullptr}, 
-                              {"m11", "m12", "m13",
-                               "m21", "m22", "m23",
-                               "m41", "m42", "m43", nullptr}, Private_VectorConstructors::ConstructMatrixN_by_N<9> },
+        BS_BIND(Private_VectorConstructors::ConstructFloat3x3_float3)::Declare("float3x3", "col_x", "col_y", "col_z"),
+        BS_BIND(Private_VectorConstructors::ConstructFloat3x3_float)::Declare("float3x3",
+                                                                                "m11", "m12", "m13",
+                                                                                "m21", "m22", "m23",
+                                                                                "m41", "m42", "m43"),
         ///////////////////////////////////////////float2x2///////////////////////////////////////////////////////////////
-        { "float2x2", "float2x2", {"float2", "float2", nullptr}, {"x", "y", nullptr}, Private_VectorConstructors::ConstructMatrixN_by_N<4> },
-        { "float2x2", "float2x2", {"float", "float", 
-                               "float", "float", nullptr}, 
-                              {"m11", "m12",
-                               "m41", "m42", nullptr}, Private_VectorConstructors::ConstructMatrixN_by_N<4> },
+        BS_BIND(Private_VectorConstructors::ConstructFloat2x2_float2)::Declare("float2x2", "x", "y"),
+        BS_BIND(Private_VectorConstructors::ConstructFloat2x2_float)::Declare("float2x2",
+                                                                                "m11", "m12",
+                                                                                "m41", "m42"),
     };
 
     lib->CreateIntrinsicFunctions(funConstructors, sizeof(funConstructors) / sizeof(funConstructors[0])); 
@@ -494,30 +465,30 @@ void Pegasus::BlockScript::RegisterIntrinsics(BlockLib* lib)
     //Register Math intrinsics
     const Pegasus::BlockScript::FunctionDeclarationDesc mathFuncs[] =
     {
-        //*funName | retType | argsTypes                                   |  argNames                    | callback
+        //*binding                                                                       | funName | argNames
         ///////////////////////////////////////////DOT///////////////////////////////////////////////////////////////
-        { "dot", "float",  { "float4",  "float4", nullptr}, {"x", "y", nullptr}, Private_Math::Dot<Math::Vec4>},
-        { "dot", "float",  { "float3",  "float3", nullptr}, {"x", "y", nullptr}, Private_Math::Dot<Math::Vec3>},
-        { "dot", "float",  { "float2",  "float2", nullptr}, {"x", "y", nullptr}, Private_Math::Dot<Math::Vec2>},
+        BS_BIND(Private_Math::Dot<Math::Vec4>)::Declare("dot", "x", "y"),
+        BS_BIND(Private_Math::Dot<Math::Vec3>)::Declare("dot", "x", "y"),
+        BS_BIND(Private_Math::Dot<Math::Vec2>)::Declare("dot", "x", "y"),
         ///////////////////////////////////////////LERP///////////////////////////////////////////////////////////////
-        { "lerp", "float",  { "float",  "float",  "float",  nullptr}, {"x", "y", "t", nullptr}, Private_Math::Lerp<float>},
-        { "lerp", "float4", { "float4", "float4", "float",  nullptr}, {"x", "y", "t", nullptr}, Private_Math::Lerp<Math::Vec4>},
-        { "lerp", "float3", { "float3", "float3", "float",  nullptr}, {"x", "y", "t", nullptr}, Private_Math::Lerp<Math::Vec3>},
-        { "lerp", "float2", { "float2", "float2", "float",  nullptr}, {"x", "y", "t", nullptr}, Private_Math::Lerp<Math::Vec2>},
+        BS_BIND(Private_Math::Lerp<float>)::Declare(     "lerp", "x", "y", "t"),
+        BS_BIND(Private_Math::Lerp<Math::Vec4>)::Declare("lerp", "x", "y", "t"),
+        BS_BIND(Private_Math::Lerp<Math::Vec3>)::Declare("lerp", "x", "y", "t"),
+        BS_BIND(Private_Math::Lerp<Math::Vec2>)::Declare("lerp", "x", "y", "t"),
         ///////////////////////////////////////////MUL///////////////////////////////////////////////////////////////
-        { "mul", "float4x4", { "float4x4", "float4x4", nullptr}, {"x", "y", nullptr}, Private_Math::Mul<Math::Mat44, Math::Mat44, Math::Mult44_44>},
-        { "mul", "float4", { "float4x4", "float4", nullptr}, {"x", "y", nullptr},   Private_Math::Mul<Math::Vec4, Math::Mat44, Math::Mult44_41>},
-        { "mul", "float3", { "float3x3", "float3", nullptr}, {"x", "y", nullptr},   Private_Math::Mul<Math::Vec3, Math::Mat33, Math::Mult33_31>},
-        { "mul", "float2", { "float2x2", "float2", nullptr}, {"x", "y", nullptr},   Private_Math::Mul<Math::Vec2, Math::Mat22, Math::Mult22_21>},
+        BS_BIND(Private_Math::Mul<Math::Mat44, Math::Mat44, Math::Mult44_44>)::Declare("mul", "x", "y"),
+        BS_BIND(Private_Math::Mul<Math::Vec4, Math::Mat44, Math::Mult44_41>)::Declare( "mul", "x", "y"),
+        BS_BIND(Private_Math::Mul<Math::Vec3, Math::Mat33, Math::Mult33_31>)::Declare( "mul", "x", "y"),
+        BS_BIND(Private_Math::Mul<Math::Vec2, Math::Mat22, Math::Mult22_21>)::Declare( "mul", "x", "y"),
         ///////////////////////////////////////////CROSS///////////////////////////////////////////////////////////////
-        { "cross", "float3", { "float3", "float3", nullptr}, {"x", "y", nullptr}, Private_Math::Cross<Math::Vec3>},
+        BS_BIND(Private_Math::Cross<Math::Vec3>)::Declare("cross", "x", "y"),
         ///////////////////////////////////////////TRIG///////////////////////////////////////////////////////////////
-        { "sin", "float", { "float", nullptr}, {"v", nullptr}, Private_Math::Sin},
-        { "cos", "float", { "float", nullptr}, {"v", nullptr}, Private_Math::Cos},
-        { "divUp", "int", { "int", "int", nullptr}, {"a", "b", nullptr}, Private_Math::DivUp},
-        { "GetRotation",   "float4x4", { "float3", "float", nullptr}, {"axis", "amount", nullptr}, Private_Math::Mat44_Rotation},
-        { "GetProjection", "float4x4", { "float", "float", "float", "float", "float", "float", nullptr}, { "l", "r", "t", "b", "n", "f", nullptr}, Private_Math::Mat44_Proj1},
-        { "GetProjection", "float4x4", { "float", "float", "float", "float", nullptr }, { "fov", "aspect", "n", "f", nullptr },  Private_Math::Mat44_Proj2},
+        BS_BIND(Private_Math::Sin)::Declare("sin", "v"),
+        BS_BIND(Private_Math::Cos)::Declare("cos", "v"),
+        BS_BIND(Private_Math::DivUp)::Declare("divUp", "a", "b"),
+        BS_BIND(Private_Math::Mat44_Rotation)::Declare("GetRotation", "axis", "amount"),
+        BS_BIND(Private_Math::Mat44_Proj1)::Declare("GetProjection", "l", "r", "t", "b", "n", "f"),
+        BS_BIND(Private_Math::Mat44_Proj2)::Declare("GetProjection", "fov", "aspect", "n", "f"),
     };
         
     lib->CreateIntrinsicFunctions(mathFuncs, sizeof(mathFuncs) / sizeof(mathFuncs[0])); 
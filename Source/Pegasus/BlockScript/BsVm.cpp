@@ -16,11 +16,13 @@
 #include "Pegasus/BlockScript/Canonizer.h"
 #include "Pegasus/BlockScript/BlockScriptAst.h"
 #include "Pegasus/BlockScript/EventListeners.h"
+#include "Pegasus/BlockScript/BsVmProfiler.h"
 #include "Pegasus/Memory/MemoryManager.h"
 #include "Pegasus/Core/Assertion.h"
 #include "Pegasus/Allocator/Alloc.h"
 #include "Pegasus/Allocator/IAllocator.h"
 #include "Pegasus/Core/Log.h"
+#include "Pegasus/Core/Time.h"
 #include "Pegasus/Utils/Memcpy.h"
 #include "Pegasus/Utils/Memset.h"
 #include "Pegasus/BlockScript/ExpressionEngine.h"
@@ -89,7 +91,7 @@ int GetMemoryOffset(Ast::Exp* mem, BsVmState& state)
         );
 
         Ast::Binop* binop = static_cast<Ast::Binop*>(mem);
-        offset = gIntExpEngine.Eval(binop->GetRhs(), state);
+        offset = ExpressionEngine_Int::Eval(binop->GetRhs(), state);
 #if BLOCKSCRIPT_SAFEMODE
         //in safe mode, check if we are trying to access an array out of bounds
         if (offset >= binop->GetLhs()->GetTypeDesc()->GetByteSize())
@@ -123,10 +125,10 @@ void SaveExpression(void* location, Ast::Exp* exp, BsVmState& state)
         switch(expType->GetAluEngine())
         {
         case TypeDesc::E_INT:
-            *mem = gIntExpEngine.Eval(exp, state);
+            *mem = ExpressionEngine_Int::Eval(exp, state);
             break;
         case TypeDesc::E_FLOAT:
-            *mem = reinterpret_cast<int&>(gFloatExpEngine.Eval(exp, state));
+            *reinterpret_cast<float*>(mem) = ExpressionEngine_Float::Eval(exp, state);
             break;
         default:
             PG_FAILSTR("unknown ALU engine for expression.");
@@ -137,22 +139,22 @@ void SaveExpression(void* location, Ast::Exp* exp, BsVmState& state)
         switch(expType->GetAluEngine())
         {
         case TypeDesc::E_MATRIX4x4:
-            *reinterpret_cast<Math::Mat44*>(location) = gMat44ExpEngine.Eval(exp, state);
+            *reinterpret_cast<Math::Mat44*>(location) = ExpressionEngine_Mat44::Eval(exp, state);
             break;
         case TypeDesc::E_MATRIX3x3:
-            *reinterpret_cast<Math::Mat33*>(location) = gMat33ExpEngine.Eval(exp, state);
+            *reinterpret_cast<Math::Mat33*>(location) = ExpressionEngine_Mat33::Eval(exp, state);
             break;
         case TypeDesc::E_MATRIX2x2:
-            *reinterpret_cast<Math::Mat22*>(location) = gMat22ExpEngine.Eval(exp, state);
+            *reinterpret_cast<Math::Mat22*>(location) = ExpressionEngine_Mat22::Eval(exp, state);
             break;
         case TypeDesc::E_FLOAT4:
-            *reinterpret_cast<Math::Vec4*>(location) = gFloat4ExpEngine.Eval(exp, state);
+            *reinterpret_cast<Math::Vec4*>(location) = ExpressionEngine_Float4::Eval(exp, state);
             break;
         case TypeDesc::E_FLOAT3:
-            *reinterpret_cast<Math::Vec3*>(location) = gFloat3ExpEngine.Eval(exp, state);
+            *reinterpret_cast<Math::Vec3*>(location) = ExpressionEngine_Float3::Eval(exp, state);
             break;
         case TypeDesc::E_FLOAT2:
-            *reinterpret_cast<Math::Vec2*>(location) = gFloat2ExpEngine.Eval(exp, state);
+            *reinterpret_cast<Math::Vec2*>(location) = ExpressionEngine_Float2::Eval(exp, state);
             break;
         default:
             PG_FAILSTR("unknown ALU engine for expression.");
@@ -178,14 +180,14 @@ void SaveExpression(void* location, Ast::Exp* exp, BsVmState& state)
 
             Ast::Binop* rhs = static_cast<Ast::Binop*>(exp);
             Ast::Idd* arrayIdd = static_cast<Ast::Idd*>(rhs->GetLhs());
-            int offset = gIntExpEngine.Eval(rhs->GetRhs(), state);
+            int offset = ExpressionEngine_Int::Eval(rhs->GetRhs(), state);
             target = reinterpret_cast<int*>(reinterpret_cast<char*>(GetIddMem(arrayIdd, state)) + offset);
         }
         Pegasus::Utils::Memcpy(location, target, exp->GetTypeDesc()->GetByteSize());
     }
     else if (expType->GetModifier() == TypeDesc::M_REFERECE || expType->GetModifier() == TypeDesc::M_ENUM || expType->GetModifier() == TypeDesc::M_STAR)
     {
-        int val = gIntExpEngine.Eval(exp, state);
+        int val = ExpressionEngine_Int::Eval(exp, state);
         *(reinterpret_cast<int*>(location)) = val;
     }
     else
@@ -200,13 +202,13 @@ int EvalJmpCond(Ast::Exp* exp, BsVmState& state)
     {
     case TypeDesc::E_INT:
         {
-            int v = gIntExpEngine.Eval(exp, state);
+            int v = ExpressionEngine_Int::Eval(exp, state);
             return v;
         }
         break;
     case TypeDesc::E_FLOAT:
         {
-            float f = gFloatExpEngine.Eval(exp, state);
+            float f = ExpressionEngine_Float::Eval(exp, state);
             return f != 0.0 ? 1 : 0;
         }
     }
@@ -400,13 +402,31 @@ void FunGoCommand(Canon::FunGo* fungo, BsVmState& state)
             outputBuffer,
             outputBufferSize
         );
-        funDesc->GetCallback()(ctx);
+#if PEGASUS_ENABLE_BS_PROFILER
+        BsVmProfiler* profiler = state.GetProfiler();
+        if (profiler != nullptr)
+        {
+            profiler->OnFunctionEnter(funDesc);
+            funDesc->GetCallback()(ctx);
+            profiler->OnFunctionExit();
+        }
+        else
+#endif
+        {
+            funDesc->GetCallback()(ctx);
+        }
         FunRetCommand(state);
     }
     else
     {
         state.SetReg(R_IP, 0);
         state.SetReg(R_B, fungo->GetLabel());
+#if PEGASUS_ENABLE_BS_PROFILER
+        if (state.GetProfiler() != nullptr)
+        {
+            state.GetProfiler()->OnFunctionEnter(funDesc);
+        }
+#endif
     }
     
 }
@@ -467,6 +487,9 @@ BsVmState::BsVmState()
     mStackLevels(-1),
     mUserContext(nullptr),
     mRuntimeListener(nullptr),
+    mProfiler(nullptr),
+    mAssembly(nullptr),
+    mYieldDeadline(BsVmState::NO_YIELD_DEADLINE),
     mExecutionState(BsVmState::Alive)
 {
     Reset();
@@ -485,6 +508,7 @@ void BsVmState::Initialize(Alloc::IAllocator* allocator)
 void BsVmState::Reset()
 {
     mExecutionState = BsVmState::Alive;
+    mSuspendedCall = SuspendedCall();
     mRamSize = 0;
     mStackLevels = -1; //-1 means no stack has been set
     for (int i = 0; i < static_cast<int>(Canon::R_COUNT); ++i)
@@ -534,7 +558,15 @@ void BsVm::Run(const Assembly& assembly, BsVmState& state) const
     {
         state.GetRuntimeListener()->OnRuntimeBegin(state);
     }
+#if PEGASUS_ENABLE_BS_PROFILER
+    if (state.GetProfiler() != nullptr)
+    {
+        state.GetProfiler()->OnRunBegin();
+    }
+#endif
+    state.SetAssembly(&assembly);
     while (StepExecution(assembly, state) && state.GetExecutionState() == BsVmState::Alive);
+    state.SetAssembly(nullptr);
 }
 
 bool BsVm::StepExecution(const Assembly& assembly, BsVmState& state) const
@@ -564,6 +596,13 @@ bool BsVm::StepExecution(const Assembly& assembly, BsVmState& state) const
         return true;
     }
     Canon::CanonNode* n = (*nodes)[state.mR[R_IP]];
+
+#if PEGASUS_ENABLE_BS_PROFILER
+    if (state.mProfiler != nullptr)
+    {
+        state.mProfiler->OnInstruction(block->GetLine(state.mR[R_IP]));
+    }
+#endif
     
     int nodeType = n->GetType();
     
@@ -603,9 +642,24 @@ bool BsVm::StepExecution(const Assembly& assembly, BsVmState& state) const
         {
             state.GetRuntimeListener()->OnRuntimeExit(state);
         }
+#if PEGASUS_ENABLE_BS_PROFILER
+        if (state.mProfiler != nullptr)
+        {
+            state.mProfiler->OnRunEnd();
+        }
+#endif
         active = false;
     }
     break;
+    case Canon::T_YIELD:
+    {
+        ++state.mR[R_IP];
+        if (state.mYieldDeadline != BsVmState::NO_YIELD_DEADLINE && Core::GetPerformanceCounter() >= state.mYieldDeadline)
+        {
+            state.mExecutionState = BsVmState::Suspended;
+        }
+    }
+    break;
     case Canon::T_FUNGO:
     {
         Canon::FunGo* fungo = static_cast<Canon::FunGo*>(n);
@@ -634,6 +688,12 @@ bool BsVm::StepExecution(const Assembly& assembly, BsVmState& state) const
     break;
     case Canon::T_RET:
     {
+#if PEGASUS_ENABLE_BS_PROFILER
+        if (state.mProfiler != nullptr)
+        {
+            state.mProfiler->OnFunctionExit();
+        }
+#endif
         FunRetCommand(state);
     }
     break;
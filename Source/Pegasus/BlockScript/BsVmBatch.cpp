@@ -0,0 +1,1457 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BsVmBatch.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Batch execution of a blockscript function over many instances (see ExecuteFunctionBatch).
+//!         The instances run in lanes: the memory of the lanes is a structure of arrays, one row of
+//!         LANE_COUNT words per word of memory, and each instruction executes once for all the lanes.
+
+#include "Pegasus/BlockScript/FunCallback.h"
+#include "Pegasus/BlockScript/BsVm.h"
+#include "Pegasus/BlockScript/Canonizer.h"
+#include "Pegasus/BlockScript/BlockScriptAst.h"
+#include "Pegasus/BlockScript/StackFrameInfo.h"
+#include "Pegasus/BlockScript/FunDesc.h"
+#include "Pegasus/BlockScript/TypeDesc.h"
+#include "Pegasus/BlockScript/bs.parser.hpp"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Memory/FrameAllocator.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Core/Time.h"
+
+using namespace Pegasus;
+using namespace Pegasus::BlockScript;
+using namespace Pegasus::BlockScript::Canon;
+
+namespace
+{
+
+//! Count of instances executed together, one per lane
+const int LANE_COUNT = 16;
+
+//! Frame of a lane group. Frames are only tracked by the groups, nothing is written in the lane memory
+struct BatchFrame
+{
+    int mSbp;   //!< Byte address of the frame
+    int mRetB;  //!< Block to return to if this is the frame of a called function, -1 for scopes and the executed function
+    int mRetIp; //!< Instruction to return to
+};
+
+//! Lanes executing the same instruction with the same frames.
+//! The lanes of a group split on a conditional jump they do not agree on, and groups merge when they meet
+struct LaneGroup
+{
+    int           mLaneCount;
+    unsigned char mLanes[LANE_COUNT]; //!< Indices of the lanes, sorted
+    int           mB;                 //!< Current block
+    int           mIp;                //!< Current instruction in the block
+    int           mEsp;               //!< Byte address of the top of the stack
+    int           mFrameCount;
+    BatchFrame*   mFrames;            //!< Frames, owned by the slot of the group
+
+    bool IsFull() const { return mLaneCount == LANE_COUNT; }
+};
+
+//! Value of an expression in every lane, component by component so operations run over contiguous lanes
+template <class T, int N>
+struct LaneValue
+{
+    T mC[N][LANE_COUNT];
+};
+
+//! Location of a value in the lane memory, as the row of its first word for each lane
+struct LaneAddress
+{
+    bool mUniform;              //!< True if all the lanes use mRow, mRows is not set
+    int  mRow;
+    int  mRows[LANE_COUNT];
+};
+
+//! Source of a value read by the lanes: the lane memory, or the memory of the state for globals
+struct LaneSource
+{
+    bool        mGlobal;
+    LaneAddress mAddress;                  //!< Rows in the lane memory, if not global
+    const int*  mPointers[LANE_COUNT];     //!< Location in the memory of the state for each lane, if global
+};
+
+// operations, applied to each component of each lane
+struct AddOp  { template <class T> T operator()(T a, T b) const { return a + b; } };
+struct SubOp  { template <class T> T operator()(T a, T b) const { return a - b; } };
+struct MulOp  { template <class T> T operator()(T a, T b) const { return a * b; } };
+struct DivOp  { template <class T> T operator()(T a, T b) const { return a / b; } };
+struct EqOp   { template <class T> T operator()(T a, T b) const { return static_cast<T>(a == b); } };
+struct NeqOp  { template <class T> T operator()(T a, T b) const { return static_cast<T>(a != b); } };
+struct GtOp   { template <class T> T operator()(T a, T b) const { return static_cast<T>(a > b); } };
+struct LtOp   { template <class T> T operator()(T a, T b) const { return static_cast<T>(a < b); } };
+struct GteOp  { template <class T> T operator()(T a, T b) const { return static_cast<T>(a >= b); } };
+struct LteOp  { template <class T> T operator()(T a, T b) const { return static_cast<T>(a <= b); } };
+struct LandOp { template <class T> T operator()(T a, T b) const { return static_cast<T>(a && b); } };
+struct LorOp  { template <class T> T operator()(T a, T b) const { return static_cast<T>(a || b); } };
+
+template <class T, int N, class Op>
+void ApplyToLanes(LaneValue<T, N>& a, const LaneValue<T, N>& b, Op op)
+{
+    T* r = &a.mC[0][0];
+    const T* rhs = &b.mC[0][0];
+    for (int i = 0; i < N * LANE_COUNT; ++i)
+    {
+        r[i] = op(r[i], rhs[i]);
+    }
+}
+
+//! Float divisions run on all the lanes, the inactive lanes cannot trap
+template <int N>
+void DivideLanes(LaneValue<float, N>& a, const LaneValue<float, N>& b, const LaneGroup& group)
+{
+    ApplyToLanes(a, b, DivOp());
+}
+
+//! Integer divisions only run on the active lanes, the inactive lanes can hold a 0
+inline void DivideLanes(LaneValue<int, 1>& a, const LaneValue<int, 1>& b, const LaneGroup& group)
+{
+    for (int i = 0; i < group.mLaneCount; ++i)
+    {
+        const int l = group.mLanes[i];
+        a.mC[0][l] = a.mC[0][l] / b.mC[0][l];
+    }
+}
+
+template <int N>
+void ModuloLanes(LaneValue<float, N>& a, const LaneValue<float, N>& b, const LaneGroup& group)
+{
+    PG_FAILSTR("Unsupported expression!");
+}
+
+inline void ModuloLanes(LaneValue<int, 1>& a, const LaneValue<int, 1>& b, const LaneGroup& group)
+{
+    for (int i = 0; i < group.mLaneCount; ++i)
+    {
+        const int l = group.mLanes[i];
+        a.mC[0][l] = a.mC[0][l] % b.mC[0][l];
+    }
+}
+
+//! Kind of arithmetic an expression is evaluated with, as chosen by SaveExpression in the vm
+enum AluKind
+{
+    ALU_INT,    //!< int engine, all the operators
+    ALU_FLOAT,  //!< float engine, all the operators but the modulo
+    ALU_VECTOR, //!< float2, float3 and float4 engines, arithmetic operators only
+    ALU_NONE    //!< not executable in lanes
+};
+
+//! Runs a function on up to LANE_COUNT instances at a time
+class BatchExecutor
+{
+public:
+    BatchExecutor(const Assembly& assembly, BsVmState& state);
+    ~BatchExecutor();
+
+    //! Checks that a function and the functions it calls can run in lanes, and allocates the memory they need
+    //! \param entry the function to run
+    //! \return true if the function can run in lanes, false if it must run one instance at a time
+    bool Prepare(const FunMapEntry& entry);
+
+    //! Executes the prepared function
+    //! \param inputs the arguments of the instances, packed one after the other
+    //! \param inputSize the byte size of the arguments of one instance
+    //! \param outputs the return values of the instances, packed one after the other
+    //! \param outputSize the byte size of the return value of one instance
+    //! \param instanceCount the count of instances, up to LANE_COUNT
+    //! \return true if successful, false if the execution has been stopped
+    bool Execute(const char* inputs, int inputSize, char* outputs, int outputSize, int instanceCount);
+
+private:
+    // analysis
+    bool AnalyzeFunction(int entryBlock, int& outFrameCount);
+    bool CheckStmt(const CanonNode* n, int& pushFrameCount, int& calleeFrameCount);
+    bool CheckSave(Ast::Exp* exp) const;
+    bool CheckCopy(Ast::Exp* exp) const;
+    bool CheckAlu(Ast::Exp* exp, AluKind kind) const;
+    static AluKind GetAluKind(const TypeDesc* type);
+    void PushBlock(int block);
+
+    // memory
+    int* Row(int row) { return mMem + row * LANE_COUNT; }
+    static int AddressToRow(int address) { PG_ASSERT((address & 3) == 0); return R_COUNT + address / 4; }
+    void Reserve(int address);
+
+    // lane groups
+    bool RunGroup(LaneGroup& group);
+    void CopyGroup(LaneGroup& dst, const LaneGroup& src) const;
+    void RemoveGroup(int groupIndex);
+    bool IsSamePosition(const LaneGroup& a, const LaneGroup& b) const;
+    bool RunsBefore(const LaneGroup& a, const LaneGroup& b) const;
+    void WriteOutputs(const LaneGroup& group);
+
+    // instructions
+    void GetIddAddress(Ast::Idd* idd, const LaneGroup& group, LaneAddress& outAddress) const;
+    void GetMemoryAddresses(Ast::Exp* mem, const LaneGroup& group, int* outAddresses);
+    void GetSource(Ast::Exp* exp, const LaneGroup& group, LaneSource& outSource);
+    void SaveExpression(Ast::Exp* exp, const LaneAddress& dest, const LaneGroup& group);
+    void CopyWords(const LaneSource& src, const LaneAddress& dest, int wordCount, const LaneGroup& group);
+    void MoveCommand(Ast::Idd* lhs, Ast::Exp* rhs, const LaneGroup& group);
+    void CallCallback(Ast::FunCall* fc, int argAddress, int argSize, const LaneGroup& group);
+    bool JmpCondCommand(Canon::JmpCond* jmpCond, LaneGroup& group);
+
+    template <class T, int N> void Eval(Ast::Exp* exp, const LaneGroup& group, LaneValue<T, N>& outValue);
+    template <class T, int N> void LoadValue(const LaneSource& src, const LaneGroup& group, LaneValue<T, N>& outValue);
+    template <class T, int N> void StoreValue(const LaneValue<T, N>& value, const LaneAddress& dest, const LaneGroup& group);
+    template <class T, int N> void EvalAndStore(Ast::Exp* exp, const LaneAddress& dest, const LaneGroup& group);
+
+    const Assembly& mAssembly;
+    BsVmState& mState;
+    Alloc::IAllocator* mAllocator;
+
+    // analysis
+    int mBlockCount;
+    int* mBlockPosition;     //!< Position of each block in the layout of the assembly, orders the lane groups
+    int* mBlockState;        //!< 1 if visited, for the entry blocks of functions 2 while analyzed, 3 if valid and 4 if not
+    int* mFunctionFrames;    //!< Maximum count of frames pushed by the function starting at each entry block
+    int* mWorklist;
+    int  mWorklistSize;
+    int  mMaxFrameCount;
+    int  mCallBufferSize;
+
+    // execution
+    const FunMapEntry* mEntry;
+    int*  mMem;
+    int   mRowCount;
+    int*  mCallBuffer;
+    BatchFrame* mFramePool;
+    LaneGroup mGroups[LANE_COUNT];
+    int   mGroupCount;
+    char* mOutputs;
+    int   mOutputSize;
+};
+
+BatchExecutor::BatchExecutor(const Assembly& assembly, BsVmState& state)
+:
+    mAssembly(assembly),
+    mState(state),
+    mAllocator(Memory::GetFrameAllocator()), //the executor only lives for the duration of a batch, run every frame by the scripts
+    mBlockCount(assembly.mBlocks->Size()),
+    mBlockPosition(nullptr),
+    mBlockState(nullptr),
+    mFunctionFrames(nullptr),
+    mWorklist(nullptr),
+    mWorklistSize(0),
+    mMaxFrameCount(0),
+    mCallBufferSize(0),
+    mEntry(nullptr),
+    mMem(nullptr),
+    mRowCount(0),
+    mCallBuffer(nullptr),
+    mFramePool(nullptr),
+    mGroupCount(0),
+    mOutputs(nullptr),
+    mOutputSize(0)
+{
+}
+
+BatchExecutor::~BatchExecutor()
+{
+    if (mBlockPosition != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mBlockPosition);
+        PG_DELETE_ARRAY(mAllocator, mBlockState);
+        PG_DELETE_ARRAY(mAllocator, mFunctionFrames);
+        PG_DELETE_ARRAY(mAllocator, mWorklist);
+    }
+    if (mMem != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mMem);
+    }
+    if (mCallBuffer != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mCallBuffer);
+    }
+    if (mFramePool != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mFramePool);
+    }
+}
+
+//******************************************************//
+// **************       analysis        ****************//
+//******************************************************//
+
+bool BatchExecutor::Prepare(const FunMapEntry& entry)
+{
+    mEntry = &entry;
+    mBlockPosition  = PG_NEW_ARRAY(mAllocator, -1, "BS batch blocks", Alloc::PG_MEM_TEMP, int, mBlockCount);
+    mBlockState     = PG_NEW_ARRAY(mAllocator, -1, "BS batch blocks", Alloc::PG_MEM_TEMP, int, mBlockCount);
+    mFunctionFrames = PG_NEW_ARRAY(mAllocator, -1, "BS batch blocks", Alloc::PG_MEM_TEMP, int, mBlockCount);
+    mWorklist       = PG_NEW_ARRAY(mAllocator, -1, "BS batch blocks", Alloc::PG_MEM_TEMP, int, mBlockCount);
+
+    const Container<Block>& blocks = *mAssembly.mBlocks;
+    for (int b = 0; b < mBlockCount; ++b)
+    {
+        mBlockPosition[b] = mBlockCount + b;
+        mBlockState[b] = 0;
+        mFunctionFrames[b] = 0;
+    }
+
+    //blocks are laid out in the order of the source, following the chain of next blocks
+    int position = 0;
+    for (int b = 0; b >= 0 && b < mBlockCount && mBlockPosition[b] >= mBlockCount; b = blocks[b].NextBlock())
+    {
+        mBlockPosition[b] = position++;
+    }
+
+    if (!AnalyzeFunction(entry.mAssemblyBlock, mMaxFrameCount))
+    {
+        return false;
+    }
+
+    mFramePool = PG_NEW_ARRAY(mAllocator, -1, "BS batch frames", Alloc::PG_MEM_TEMP, BatchFrame, LANE_COUNT * mMaxFrameCount);
+    for (int i = 0; i < LANE_COUNT; ++i)
+    {
+        mGroups[i].mFrames = mFramePool + i * mMaxFrameCount;
+    }
+
+    if (mCallBufferSize > 0)
+    {
+        mCallBuffer = PG_NEW_ARRAY(mAllocator, -1, "BS batch call", Alloc::PG_MEM_TEMP, int, mCallBufferSize / static_cast<int>(sizeof(int)));
+    }
+    return true;
+}
+
+void BatchExecutor::PushBlock(int block)
+{
+    PG_ASSERT(block >= 0 && block < mBlockCount);
+    if (mBlockState[block] == 0)
+    {
+        mBlockState[block] = 1;
+        mWorklist[mWorklistSize++] = block;
+    }
+}
+
+bool BatchExecutor::AnalyzeFunction(int entryBlock, int& outFrameCount)
+{
+    switch (mBlockState[entryBlock])
+    {
+    case 2: //recursive function, the depth of its frames is not known
+    case 4:
+        return false;
+    case 3:
+        outFrameCount = mFunctionFrames[entryBlock];
+        return true;
+    }
+
+    const Container<Block>& blocks = *mAssembly.mBlocks;
+    const int worklistBase = mWorklistSize;
+    int pushFrameCount = 0;
+    int calleeFrameCount = 0;
+    mBlockState[entryBlock] = 2;
+    mWorklist[mWorklistSize++] = entryBlock;
+
+    while (mWorklistSize > worklistBase)
+    {
+        const Block& block = blocks[mWorklist[--mWorklistSize]];
+        const Container<CanonNode*>& stmts = block.GetStmts();
+        bool fallsThrough = true;
+        for (int i = 0; i < stmts.Size() && fallsThrough; ++i)
+        {
+            const CanonNode* n = stmts[i];
+            if (!CheckStmt(n, pushFrameCount, calleeFrameCount))
+            {
+                mWorklistSize = worklistBase;
+                mBlockState[entryBlock] = 4;
+                return false;
+            }
+
+            //the instructions after a jump or a return are never executed
+            fallsThrough = n->GetType() != T_JMP && n->GetType() != T_RET;
+        }
+
+        if (fallsThrough)
+        {
+            PushBlock(block.NextBlock());
+        }
+    }
+
+    //frames are pushed and popped in scopes, so each push can only be once in the stack
+    outFrameCount = 1 + pushFrameCount + calleeFrameCount;
+    mFunctionFrames[entryBlock] = outFrameCount;
+    mBlockState[entryBlock] = 3;
+    return true;
+}
+
+bool BatchExecutor::CheckStmt(const CanonNode* n, int& pushFrameCount, int& calleeFrameCount)
+{
+    switch (n->GetType())
+    {
+    case T_MOVE:
+        {
+            const Move* mov = static_cast<const Move*>(n);
+            Ast::Exp* rhs = mov->GetRhs();
+            const int byteSize = mov->GetLhs()->GetTypeDesc()->GetByteSize();
+            return !mov->GetLhs()->GetMetaData().isGlobal &&
+                (rhs->GetExpType() == Ast::Idd::sType ||
+                (rhs->GetExpType() == Ast::Imm::sType && byteSize <= static_cast<int>(sizeof(Ast::Variant))) ||
+                CheckSave(rhs));
+        }
+    case T_SAVE:
+        return !static_cast<const Save*>(n)->GetTmp()->GetMetaData().isGlobal;
+    case T_LOAD:
+        return CheckSave(static_cast<const Load*>(n)->GetExp());
+    case T_LOAD_ADDR:
+        {
+            //an address is only meaningful in the lane memory, globals are read only
+            Ast::Exp* mem = static_cast<const LoadAddr*>(n)->GetExp();
+            return CheckCopy(mem) &&
+                !static_cast<Ast::Idd*>(mem->GetExpType() == Ast::Idd::sType ? mem : static_cast<Ast::Binop*>(mem)->GetLhs())->GetMetaData().isGlobal;
+        }
+    case T_COPY_TO_ADDR:
+        return CheckSave(static_cast<const CopyToAddr*>(n)->GetExp());
+    case T_JMP:
+        PushBlock(static_cast<const Jmp*>(n)->GetLabel());
+        return true;
+    case T_JMPCOND:
+        {
+            const JmpCond* jmpCond = static_cast<const JmpCond*>(n);
+            PushBlock(jmpCond->GetLabel());
+            AluKind kind = GetAluKind(jmpCond->GetExp()->GetTypeDesc());
+            return (kind == ALU_INT || kind == ALU_FLOAT) && CheckAlu(jmpCond->GetExp(), kind);
+        }
+    case T_FUNGO:
+        {
+            const FunGo* fungo = static_cast<const FunGo*>(n);
+            Ast::FunCall* fc = fungo->GetFunCall();
+            const FunDesc* funDesc = fc->GetDesc();
+            for (const Ast::ExpList* args = fc->GetArgs(); args != nullptr && args->GetExp() != nullptr; args = args->GetTail())
+            {
+                if (!CheckSave(args->GetExp()))
+                {
+                    return false;
+                }
+            }
+
+            if (funDesc->IsCallback())
+            {
+                //the star type passes an address in the memory of the state
+                for (const Ast::ArgList* argList = funDesc->GetDec()->GetArgList(); argList != nullptr && argList->GetArgDec() != nullptr; argList = argList->GetTail())
+                {
+                    if (argList->GetArgDec()->GetType()->GetModifier() == TypeDesc::M_STAR)
+                    {
+                        return false;
+                    }
+                }
+
+                const int callSize = funDesc->GetInputArgumentsByteSize() + fc->GetTypeDesc()->GetByteSize() + sizeof(int);
+                mCallBufferSize = callSize > mCallBufferSize ? callSize : mCallBufferSize;
+                return true;
+            }
+            else
+            {
+                int frameCount = 0;
+                if (!AnalyzeFunction(fungo->GetLabel(), frameCount))
+                {
+                    return false;
+                }
+                calleeFrameCount = frameCount > calleeFrameCount ? frameCount : calleeFrameCount;
+                return true;
+            }
+        }
+    case T_PUSHFRAME:
+        ++pushFrameCount;
+        return true;
+    case T_SAVE_TO_ADDR:
+    case T_POPFRAME:
+    case T_CAST:
+    case T_RET:
+    case T_YIELD:
+        return true;
+    default:
+        //heap, object properties and exit are not executed per instance
+        return false;
+    }
+}
+
+AluKind BatchExecutor::GetAluKind(const TypeDesc* type)
+{
+    switch (type->GetModifier())
+    {
+    case TypeDesc::M_SCALAR:
+        return type->GetAluEngine() == TypeDesc::E_INT ? ALU_INT : (type->GetAluEngine() == TypeDesc::E_FLOAT ? ALU_FLOAT : ALU_NONE);
+    case TypeDesc::M_VECTOR:
+        return type->GetAluEngine() >= TypeDesc::E_FLOAT2 && type->GetAluEngine() <= TypeDesc::E_FLOAT4 ? ALU_VECTOR : ALU_NONE;
+    case TypeDesc::M_REFERECE:
+    case TypeDesc::M_ENUM:
+    case TypeDesc::M_STAR:
+        return ALU_INT;
+    default:
+        return ALU_NONE;
+    }
+}
+
+bool BatchExecutor::CheckSave(Ast::Exp* exp) const
+{
+    AluKind kind = GetAluKind(exp->GetTypeDesc());
+    if (kind != ALU_NONE)
+    {
+        return CheckAlu(exp, kind);
+    }
+
+    //structures, arrays and matrices are copied
+    const TypeDesc::Modifier modifier = exp->GetTypeDesc()->GetModifier();
+    return (modifier == TypeDesc::M_STRUCT || modifier == TypeDesc::M_ARRAY || modifier == TypeDesc::M_VECTOR) && CheckCopy(exp);
+}
+
+bool BatchExecutor::CheckCopy(Ast::Exp* exp) const
+{
+    if (exp->GetExpType() == Ast::Idd::sType)
+    {
+        return true;
+    }
+
+    if (exp->GetExpType() == Ast::Binop::sType)
+    {
+        Ast::Binop* binop = static_cast<Ast::Binop*>(exp);
+        return binop->GetOp() == O_ACCESS && binop->GetLhs()->GetExpType() == Ast::Idd::sType && CheckAlu(binop->GetRhs(), ALU_INT);
+    }
+    return false;
+}
+
+bool BatchExecutor::CheckAlu(Ast::Exp* exp, AluKind kind) const
+{
+    if (exp->GetExpType() == Ast::Idd::sType || exp->GetExpType() == Ast::Imm::sType)
+    {
+        return true;
+    }
+    else if (exp->GetExpType() == Ast::Binop::sType)
+    {
+        Ast::Binop* binop = static_cast<Ast::Binop*>(exp);
+        switch (binop->GetOp())
+        {
+        case O_ACCESS:
+            return CheckCopy(exp);
+        case O_PLUS:
+        case O_MINUS:
+        case O_MUL:
+        case O_DIV:
+            break;
+        case O_MOD:
+            if (kind != ALU_INT)
+            {
+                return false;
+            }
+            break;
+        case O_EQ:
+        case O_NEQ:
+        case O_GT:
+        case O_LT:
+        case O_GTE:
+        case O_LTE:
+        case O_LAND:
+        case O_LOR:
+            if (kind == ALU_VECTOR)
+            {
+                return false;
+            }
+            break;
+        default:
+            return false;
+        }
+        return CheckAlu(binop->GetLhs(), kind) && CheckAlu(binop->GetRhs(), kind);
+    }
+    else if (exp->GetExpType() == Ast::Unop::sType)
+    {
+        Ast::Unop* unop = static_cast<Ast::Unop*>(exp);
+        return unop->GetOp() == O_MINUS && CheckAlu(unop->GetExp(), kind);
+    }
+    return false;
+}
+
+//******************************************************//
+// **************        memory         ****************//
+//******************************************************//
+
+void BatchExecutor::Reserve(int address)
+{
+    const int rowCount = R_COUNT + (address + 3) / 4;
+    if (rowCount > mRowCount)
+    {
+        int newRowCount = mRowCount * 2 > rowCount ? mRowCount * 2 : rowCount;
+        int* newMem = PG_NEW_ARRAY(mAllocator, -1, "BS batch lanes", Alloc::PG_MEM_TEMP, int, newRowCount * LANE_COUNT);
+        Utils::Memset32(newMem, 0, newRowCount * LANE_COUNT * sizeof(int));
+        if (mMem != nullptr)
+        {
+            Utils::Memcpy(newMem, mMem, mRowCount * LANE_COUNT * sizeof(int));
+            PG_DELETE_ARRAY(mAllocator, mMem);
+        }
+        mMem = newMem;
+        mRowCount = newRowCount;
+    }
+}
+
+void BatchExecutor::GetIddAddress(Ast::Idd* idd, const LaneGroup& group, LaneAddress& outAddress) const
+{
+    PG_ASSERT(!idd->GetMetaData().isGlobal);
+    PG_ASSERT(idd->GetFrameOffset() < group.mFrameCount);
+    outAddress.mUniform = true;
+    outAddress.mRow = AddressToRow(group.mFrames[group.mFrameCount - 1 - idd->GetFrameOffset()].mSbp + idd->GetOffset());
+}
+
+void BatchExecutor::GetMemoryAddresses(Ast::Exp* mem, const LaneGroup& group, int* outAddresses)
+{
+    LaneAddress base;
+    if (mem->GetExpType() == Ast::Idd::sType)
+    {
+        GetIddAddress(static_cast<Ast::Idd*>(mem), group, base);
+        for (int i = 0; i < group.mLaneCount; ++i)
+        {
+            outAddresses[group.mLanes[i]] = (base.mRow - R_COUNT) * 4;
+        }
+    }
+    else
+    {
+        Ast::Binop* binop = static_cast<Ast::Binop*>(mem);
+        LaneValue<int, 1> offsets;
+        Eval(binop->GetRhs(), group, offsets);
+        GetIddAddress(static_cast<Ast::Idd*>(binop->GetLhs()), group, base);
+        for (int i = 0; i < group.mLaneCount; ++i)
+        {
+            const int l = group.mLanes[i];
+            outAddresses[l] = (base.mRow - R_COUNT) * 4 + offsets.mC[0][l];
+        }
+    }
+}
+
+void BatchExecutor::GetSource(Ast::Exp* exp, const LaneGroup& group, LaneSource& outSource)
+{
+    Ast::Idd* idd = nullptr;
+    LaneValue<int, 1> offsets;
+    if (exp->GetExpType() == Ast::Idd::sType)
+    {
+        idd = static_cast<Ast::Idd*>(exp);
+    }
+    else
+    {
+        PG_ASSERT(exp->GetExpType() == Ast::Binop::sType && static_cast<Ast::Binop*>(exp)->GetOp() == O_ACCESS);
+        Ast::Binop* binop = static_cast<Ast::Binop*>(exp);
+        idd = static_cast<Ast::Idd*>(binop->GetLhs());
+        Eval(binop->GetRhs(), group, offsets);
+    }
+
+    outSource.mGlobal = idd->GetMetaData().isGlobal;
+    if (outSource.mGlobal)
+    {
+        //globals are not written by the lanes, they are read from the memory of the state
+        const char* globalMem = mState.Ram() + mState.GetReg(R_G) + idd->GetOffset();
+        for (int i = 0; i < group.mLaneCount; ++i)
+        {
+            const int l = group.mLanes[i];
+            outSource.mPointers[l] = reinterpret_cast<const int*>(globalMem + (idd == exp ? 0 : offsets.mC[0][l]));
+        }
+    }
+    else
+    {
+        GetIddAddress(idd, group, outSource.mAddress);
+        if (idd != exp)
+        {
+            const int row = outSource.mAddress.mRow;
+            outSource.mAddress.mUniform = false;
+            for (int i = 0; i < group.mLaneCount; ++i)
+            {
+                const int l = group.mLanes[i];
+                PG_ASSERT((offsets.mC[0][l] & 3) == 0);
+                outSource.mAddress.mRows[l] = row + offsets.mC[0][l] / 4;
+            }
+        }
+    }
+}
+
+void BatchExecutor::CopyWords(const LaneSource& src, const LaneAddress& dest, int wordCount, const LaneGroup& group)
+{
+    if (!src.mGlobal && src.mAddress.mUniform && dest.mUniform && group.IsFull())
+    {
+        Utils::Memcpy(Row(dest.mRow), Row(src.mAddress.mRow), wordCount * LANE_COUNT * sizeof(int));
+        return;
+    }
+
+    for (int i = 0; i < group.mLaneCount; ++i)
+    {
+        const int l = group.mLanes[i];
+        const int destRow = dest.mUniform ? dest.mRow : dest.mRows[l];
+        if (src.mGlobal)
+        {
+            for (int w = 0; w < wordCount; ++w)
+            {
+                Row(destRow + w)[l] = src.mPointers[l][w];
+            }
+        }
+        else
+        {
+            const int srcRow = src.mAddress.mUniform ? src.mAddress.mRow : src.mAddress.mRows[l];
+            for (int w = 0; w < wordCount; ++w)
+            {
+                Row(destRow + w)[l] = Row(srcRow + w)[l];
+            }
+        }
+    }
+}
+
+//******************************************************//
+// **************      expressions      ****************//
+//******************************************************//
+
+template <class T, int N>
+void BatchExecutor::LoadValue(const LaneSource& src, const LaneGroup& group, LaneValue<T, N>& outValue)
+{
+    if (!src.mGlobal && src.mAddress.mUniform)
+    {
+        Utils::Memcpy(outValue.mC, Row(src.mAddress.mRow), sizeof(outValue.mC));
+        return;
+    }
+
+    if (!group.IsFull())
+    {
+        Utils::Memset32(outValue.mC, 0, sizeof(outValue.mC));
+    }
+
+    for (int i = 0; i < group.mLaneCount; ++i)
+    {
+        const int l = group.mLanes[i];
+        const T* value = src.mGlobal ? reinterpret_cast<const T*>(src.mPointers[l]) : nullptr;
+        for (int c = 0; c < N; ++c)
+        {
+            outValue.mC[c][l] = value != nullptr ? value[c] : reinterpret_cast<const T*>(Row(src.mAddress.mRows[l] + c))[l];
+        }
+    }
+}
+
+template <class T, int N>
+void BatchExecutor::StoreValue(const LaneValue<T, N>& value, const LaneAddress& dest, const LaneGroup& group)
+{
+    if (dest.mUniform && group.IsFull())
+    {
+        Utils::Memcpy(Row(dest.mRow), value.mC, sizeof(value.mC));
+        return;
+    }
+
+    for (int i = 0; i < group.mLaneCount; ++i)
+    {
+        const int l = group.mLanes[i];
+        const int row = dest.mUniform ? dest.mRow : dest.mRows[l];
+        for (int c = 0; c < N; ++c)
+        {
+            reinterpret_cast<T*>(Row(row + c))[l] = value.mC[c][l];
+        }
+    }
+}
+
+template <class T, int N>
+void BatchExecutor::Eval(Ast::Exp* exp, const LaneGroup& group, LaneValue<T, N>& outValue)
+{
+    const int expType = exp->GetExpType();
+    if (expType == Ast::Idd::sType || (expType == Ast::Binop::sType && static_cast<Ast::Binop*>(exp)->GetOp() == O_ACCESS))
+    {
+        LaneSource src;
+        GetSource(exp, group, src);
+        LoadValue(src, group, outValue);
+    }
+    else if (expType == Ast::Imm::sType)
+    {
+        const T* variant = reinterpret_cast<const T*>(&static_cast<Ast::Imm*>(exp)->GetVariant());
+        for (int c = 0; c < N; ++c)
+        {
+            for (int l = 0; l < LANE_COUNT; ++l)
+            {
+                outValue.mC[c][l] = variant[c];
+            }
+        }
+    }
+    else if (expType == Ast::Binop::sType)
+    {
+        Ast::Binop* binop = static_cast<Ast::Binop*>(exp);
+        LaneValue<T, N> rhs;
+        Eval(binop->GetLhs(), group, outValue);
+        Eval(binop->GetRhs(), group, rhs);
+        switch (binop->GetOp())
+        {
+        case O_PLUS:  ApplyToLanes(outValue, rhs, AddOp()); break;
+        case O_MINUS: ApplyToLanes(outValue, rhs, SubOp()); break;
+        case O_MUL:   ApplyToLanes(outValue, rhs, MulOp()); break;
+        case O_DIV:   DivideLanes(outValue, rhs, group); break;
+        case O_MOD:   ModuloLanes(outValue, rhs, group); break;
+        case O_EQ:    ApplyToLanes(outValue, rhs, EqOp()); break;
+        case O_NEQ:   ApplyToLanes(outValue, rhs, NeqOp()); break;
+        case O_GT:    ApplyToLanes(outValue, rhs, GtOp()); break;
+        case O_LT:    ApplyToLanes(outValue, rhs, LtOp()); break;
+        case O_GTE:   ApplyToLanes(outValue, rhs, GteOp()); break;
+        case O_LTE:   ApplyToLanes(outValue, rhs, LteOp()); break;
+        case O_LAND:  ApplyToLanes(outValue, rhs, LandOp()); break;
+        case O_LOR:   ApplyToLanes(outValue, rhs, LorOp()); break;
+        default:
+            PG_FAILSTR("Unsupported expression!");
+        }
+    }
+    else
+    {
+        PG_ASSERT(expType == Ast::Unop::sType && static_cast<Ast::Unop*>(exp)->GetOp() == O_MINUS);
+        Eval(static_cast<Ast::Unop*>(exp)->GetExp(), group, outValue);
+        T* r = &outValue.mC[0][0];
+        for (int i = 0; i < N * LANE_COUNT; ++i)
+        {
+            r[i] = -r[i];
+        }
+    }
+}
+
+template <class T, int N>
+void BatchExecutor::EvalAndStore(Ast::Exp* exp, const LaneAddress& dest, const LaneGroup& group)
+{
+    LaneValue<T, N> value;
+    Eval(exp, group, value);
+    StoreValue(value, dest, group);
+}
+
+void BatchExecutor::SaveExpression(Ast::Exp* exp, const LaneAddress& dest, const LaneGroup& group)
+{
+    const TypeDesc* expType = exp->GetTypeDesc();
+    switch (expType->GetAluEngine())
+    {
+    case TypeDesc::E_INT:
+        EvalAndStore<int, 1>(exp, dest, group);
+        return;
+    case TypeDesc::E_FLOAT:
+        EvalAndStore<float, 1>(exp, dest, group);
+        return;
+    case TypeDesc::E_FLOAT2:
+        EvalAndStore<float, 2>(exp, dest, group);
+        return;
+    case TypeDesc::E_FLOAT3:
+        EvalAndStore<float, 3>(exp, dest, group);
+        return;
+    case TypeDesc::E_FLOAT4:
+        EvalAndStore<float, 4>(exp, dest, group);
+        return;
+    default:
+        break;
+    }
+
+    if (GetAluKind(expType) == ALU_INT)
+    {
+        EvalAndStore<int, 1>(exp, dest, group);
+    }
+    else
+    {
+        //structures, arrays and matrices
+        LaneSource src;
+        GetSource(exp, group, src);
+        CopyWords(src, dest, expType->GetByteSize() / sizeof(int), group);
+    }
+}
+
+//******************************************************//
+// **************     instructions      ****************//
+//******************************************************//
+
+void BatchExecutor::MoveCommand(Ast::Idd* lhs, Ast::Exp* rhs, const LaneGroup& group)
+{
+    LaneAddress dest;
+    GetIddAddress(lhs, group, dest);
+    const int wordCount = lhs->GetTypeDesc()->GetByteSize() / sizeof(int);
+
+    if (rhs->GetExpType() == Ast::Idd::sType)
+    {
+        LaneSource src;
+        GetSource(rhs, group, src);
+        CopyWords(src, dest, wordCount, group);
+    }
+    else if (rhs->GetExpType() == Ast::Imm::sType)
+    {
+        const int* variant = static_cast<Ast::Imm*>(rhs)->GetVariant().i;
+        PG_ASSERT(wordCount <= static_cast<int>(sizeof(Ast::Variant) / sizeof(int)));
+        for (int w = 0; w < wordCount; ++w)
+        {
+            int* row = Row(dest.mRow + w);
+            for (int i = 0; i < group.mLaneCount; ++i)
+            {
+                row[group.mLanes[i]] = variant[w];
+            }
+        }
+    }
+    else
+    {
+        SaveExpression(rhs, dest, group);
+    }
+}
+
+void BatchExecutor::CallCallback(Ast::FunCall* fc, int argAddress, int argSize, const LaneGroup& group)
+{
+    const FunDesc* funDesc = fc->GetDesc();
+    const int outputSize = fc->GetTypeDesc()->GetByteSize();
+    const int argRow = AddressToRow(argAddress);
+    int* input = mCallBuffer;
+    int* output = mCallBuffer + argSize / sizeof(int);
+    int* retRow = Row(R_RET);
+
+    for (int i = 0; i < group.mLaneCount; ++i)
+    {
+        const int l = group.mLanes[i];
+        for (int w = 0; w < argSize / static_cast<int>(sizeof(int)); ++w)
+        {
+            input[w] = Row(argRow + w)[l];
+        }
+
+        FunCallbackContext ctx(
+            &mState,
+            funDesc,
+            fc->GetArgs(),
+            input,
+            argSize,
+            output,
+            outputSize
+        );
+        funDesc->GetCallback()(ctx);
+
+        if (outputSize > CANON_REGISTER_BYTESIZE)
+        {
+            const int outRow = AddressToRow(retRow[l]);
+            for (int w = 0; w < outputSize / static_cast<int>(sizeof(int)); ++w)
+            {
+                Row(outRow + w)[l] = output[w];
+            }
+        }
+        else
+        {
+            retRow[l] = output[0];
+        }
+    }
+}
+
+bool BatchExecutor::JmpCondCommand(Canon::JmpCond* jmpCond, LaneGroup& group)
+{
+    LaneValue<int, 1> cond;
+    Ast::Exp* exp = jmpCond->GetExp();
+    if (exp->GetTypeDesc()->GetAluEngine() == TypeDesc::E_INT)
+    {
+        Eval(exp, group, cond);
+    }
+    else
+    {
+        PG_ASSERT(exp->GetTypeDesc()->GetAluEngine() == TypeDesc::E_FLOAT);
+        LaneValue<float, 1> value;
+        Eval(exp, group, value);
+        for (int l = 0; l < LANE_COUNT; ++l)
+        {
+            cond.mC[0][l] = value.mC[0][l] != 0.0f ? 1 : 0;
+        }
+    }
+
+    LaneGroup taken;
+    taken.mLaneCount = 0;
+    int notTakenCount = 0;
+    for (int i = 0; i < group.mLaneCount; ++i)
+    {
+        const int l = group.mLanes[i];
+        if (cond.mC[0][l] == jmpCond->GetComparison())
+        {
+            taken.mLanes[taken.mLaneCount++] = static_cast<unsigned char>(l);
+        }
+        else
+        {
+            group.mLanes[notTakenCount++] = static_cast<unsigned char>(l);
+        }
+    }
+
+    if (taken.mLaneCount == 0)
+    {
+        ++group.mIp;
+        return false;
+    }
+    else if (notTakenCount == 0)
+    {
+        Utils::Memcpy(group.mLanes, taken.mLanes, taken.mLaneCount);
+        group.mB = jmpCond->GetLabel();
+        group.mIp = 0;
+        return true;
+    }
+    else
+    {
+        //the lanes diverge, the lanes jumping wait in a new group while the others continue
+        PG_ASSERT(mGroupCount < LANE_COUNT);
+        LaneGroup& newGroup = mGroups[mGroupCount++];
+        CopyGroup(newGroup, group);
+        Utils::Memcpy(newGroup.mLanes, taken.mLanes, taken.mLaneCount);
+        newGroup.mLaneCount = taken.mLaneCount;
+        newGroup.mB = jmpCond->GetLabel();
+        newGroup.mIp = 0;
+        group.mLaneCount = notTakenCount;
+        ++group.mIp;
+        return false;
+    }
+}
+
+bool BatchExecutor::RunGroup(LaneGroup& group)
+{
+    const Container<Block>& blocks = *mAssembly.mBlocks;
+    for (;;)
+    {
+        const Block& block = blocks[group.mB];
+        const Container<CanonNode*>& nodes = block.GetStmts();
+        if (group.mIp == nodes.Size())
+        {
+            group.mB = block.NextBlock();
+            group.mIp = 0;
+            return true;
+        }
+
+        CanonNode* n = nodes[group.mIp];
+        switch (n->GetType())
+        {
+        case T_MOVE:
+            {
+                Canon::Move* mov = static_cast<Canon::Move*>(n);
+                MoveCommand(mov->GetLhs(), mov->GetRhs(), group);
+                ++group.mIp;
+            }
+            break;
+        case T_SAVE:
+            {
+                Canon::Save* sav = static_cast<Canon::Save*>(n);
+                LaneAddress dest;
+                GetIddAddress(sav->GetTmp(), group, dest);
+                LaneSource src;
+                src.mGlobal = false;
+                src.mAddress.mUniform = true;
+                src.mAddress.mRow = sav->GetRegister();
+                CopyWords(src, dest, 1, group);
+                ++group.mIp;
+            }
+            break;
+        case T_LOAD:
+            {
+                Canon::Load* load = static_cast<Canon::Load*>(n);
+                PG_ASSERT(load->GetExp()->GetTypeDesc()->GetByteSize() <= CANON_REGISTER_BYTESIZE);
+                LaneAddress dest;
+                dest.mUniform = true;
+                dest.mRow = load->GetRegister();
+                SaveExpression(load->GetExp(), dest, group);
+                ++group.mIp;
+            }
+            break;
+        case T_FUNGO:
+            {
+                Ast::FunCall* fc = static_cast<Canon::FunGo*>(n)->GetFunCall();
+                const FunDesc* funDesc = fc->GetDesc();
+                const int frameSize = funDesc->GetDec()->GetFrame()->GetTotalFrameSize();
+
+                //the arguments are evaluated in the frames of the caller, and saved where the frame of the callee starts
+                const int argAddress = group.mEsp;
+                Reserve(argAddress + frameSize);
+                int argSize = 0;
+                for (const Ast::ExpList* args = fc->GetArgs(); args != nullptr && args->GetExp() != nullptr; args = args->GetTail())
+                {
+                    LaneAddress dest;
+                    dest.mUniform = true;
+                    dest.mRow = AddressToRow(argAddress + argSize);
+                    SaveExpression(args->GetExp(), dest, group);
+                    argSize += args->GetExp()->GetTypeDesc()->GetByteSize();
+                }
+
+                if (funDesc->IsCallback())
+                {
+                    CallCallback(fc, argAddress, argSize, group);
+                    ++group.mIp;
+                }
+                else
+                {
+                    PG_ASSERT(group.mFrameCount < mMaxFrameCount);
+                    BatchFrame& frame = group.mFrames[group.mFrameCount++];
+                    frame.mSbp = argAddress;
+                    frame.mRetB = group.mB;
+                    frame.mRetIp = group.mIp + 1;
+                    group.mEsp = argAddress + frameSize;
+                    group.mB = static_cast<Canon::FunGo*>(n)->GetLabel();
+                    group.mIp = 0;
+                    return true;
+                }
+            }
+            break;
+        case T_JMP:
+            group.mB = static_cast<Canon::Jmp*>(n)->GetLabel();
+            group.mIp = 0;
+            return true;
+        case T_JMPCOND:
+            if (JmpCondCommand(static_cast<Canon::JmpCond*>(n), group))
+            {
+                return true;
+            }
+            break;
+        case T_RET:
+            {
+                const BatchFrame& frame = group.mFrames[--group.mFrameCount];
+                group.mEsp = frame.mSbp;
+                if (group.mFrameCount == 0)
+                {
+                    WriteOutputs(group);
+                    return false;
+                }
+
+                PG_ASSERT(frame.mRetB >= 0);
+                group.mB = frame.mRetB;
+                group.mIp = frame.mRetIp;
+                return true;
+            }
+        case T_PUSHFRAME:
+            {
+                PG_ASSERT(group.mFrameCount < mMaxFrameCount);
+                BatchFrame& frame = group.mFrames[group.mFrameCount++];
+                frame.mSbp = group.mEsp;
+                frame.mRetB = -1;
+                frame.mRetIp = 0;
+                group.mEsp += static_cast<Canon::PushFrame*>(n)->GetInfo()->GetTotalFrameSize();
+                Reserve(group.mEsp);
+                ++group.mIp;
+            }
+            break;
+        case T_POPFRAME:
+            group.mEsp = group.mFrames[--group.mFrameCount].mSbp;
+            ++group.mIp;
+            break;
+        case T_LOAD_ADDR:
+            {
+                Canon::LoadAddr* ladr = static_cast<Canon::LoadAddr*>(n);
+                GetMemoryAddresses(ladr->GetExp(), group, Row(ladr->GetRegister()));
+                ++group.mIp;
+            }
+            break;
+        case T_SAVE_TO_ADDR:
+            {
+                Canon::SaveToAddr* savdr = static_cast<Canon::SaveToAddr*>(n);
+                const int* addresses = Row(savdr->GetLhs());
+                const int* values = Row(savdr->GetRhs());
+                for (int i = 0; i < group.mLaneCount; ++i)
+                {
+                    const int l = group.mLanes[i];
+                    Row(AddressToRow(addresses[l]))[l] = values[l];
+                }
+                ++group.mIp;
+            }
+            break;
+        case T_COPY_TO_ADDR:
+            {
+                Canon::CopyToAddr* cadr = static_cast<Canon::CopyToAddr*>(n);
+                const int* addresses = Row(cadr->GetRegister());
+                LaneAddress dest;
+                dest.mUniform = false;
+                for (int i = 0; i < group.mLaneCount; ++i)
+                {
+                    const int l = group.mLanes[i];
+                    dest.mRows[l] = AddressToRow(addresses[l]);
+                }
+                SaveExpression(cadr->GetExp(), dest, group);
+                ++group.mIp;
+            }
+            break;
+        case T_CAST:
+            {
+                Canon::Cast* cast = static_cast<Canon::Cast*>(n);
+                int* row = Row(cast->GetRegister());
+                float* floatRow = reinterpret_cast<float*>(row);
+                if (cast->IsIntToFloat())
+                {
+                    for (int l = 0; l < LANE_COUNT; ++l)
+                    {
+                        floatRow[l] = static_cast<float>(row[l]);
+                    }
+                }
+                else
+                {
+                    for (int i = 0; i < group.mLaneCount; ++i)
+                    {
+                        const int l = group.mLanes[i];
+                        row[l] = static_cast<int>(floatRow[l]);
+                    }
+                }
+                ++group.mIp;
+            }
+            break;
+        case T_YIELD:
+            //the instances of a batch run to completion
+            ++group.mIp;
+            break;
+        default:
+            PG_FAILSTR("Unhandled assembly node in batch execution!");
+            return false;
+        }
+    }
+}
+
+//******************************************************//
+// **************      lane groups      ****************//
+//******************************************************//
+
+void BatchExecutor::CopyGroup(LaneGroup& dst, const LaneGroup& src) const
+{
+    BatchFrame* frames = dst.mFrames;
+    dst = src;
+    dst.mFrames = frames;
+    Utils::Memcpy(dst.mFrames, src.mFrames, src.mFrameCount * sizeof(BatchFrame));
+}
+
+void BatchExecutor::RemoveGroup(int groupIndex)
+{
+    --mGroupCount;
+    if (groupIndex != mGroupCount)
+    {
+        CopyGroup(mGroups[groupIndex], mGroups[mGroupCount]);
+    }
+}
+
+bool BatchExecutor::IsSamePosition(const LaneGroup& a, const LaneGroup& b) const
+{
+    if (a.mB != b.mB || a.mIp != b.mIp || a.mEsp != b.mEsp || a.mFrameCount != b.mFrameCount)
+    {
+        return false;
+    }
+
+    for (int f = 0; f < a.mFrameCount; ++f)
+    {
+        if (a.mFrames[f].mSbp != b.mFrames[f].mSbp || a.mFrames[f].mRetB != b.mFrames[f].mRetB || a.mFrames[f].mRetIp != b.mFrames[f].mRetIp)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool BatchExecutor::RunsBefore(const LaneGroup& a, const LaneGroup& b) const
+{
+    //the deepest group runs first, then the earliest in the layout, so the others can wait where it is going
+    if (a.mFrameCount != b.mFrameCount)
+    {
+        return a.mFrameCount > b.mFrameCount;
+    }
+    if (mBlockPosition[a.mB] != mBlockPosition[b.mB])
+    {
+        return mBlockPosition[a.mB] < mBlockPosition[b.mB];
+    }
+    return a.mIp < b.mIp;
+}
+
+void BatchExecutor::WriteOutputs(const LaneGroup& group)
+{
+    const int* retRow = Row(R_RET);
+    for (int i = 0; i < group.mLaneCount; ++i)
+    {
+        const int l = group.mLanes[i];
+        int* output = reinterpret_cast<int*>(mOutputs + l * mOutputSize);
+        if (mOutputSize <= CANON_REGISTER_BYTESIZE)
+        {
+            Utils::Memcpy(output, retRow + l, mOutputSize);
+        }
+        else
+        {
+            const int outRow = AddressToRow(retRow[l]);
+            for (int w = 0; w < mOutputSize / static_cast<int>(sizeof(int)); ++w)
+            {
+                output[w] = Row(outRow + w)[l];
+            }
+        }
+    }
+}
+
+bool BatchExecutor::Execute(const char* inputs, int inputSize, char* outputs, int outputSize, int instanceCount)
+{
+    PG_ASSERT(instanceCount > 0 && instanceCount <= LANE_COUNT);
+    PG_ASSERT((inputSize & 3) == 0 && (outputSize & 3) == 0);
+    mOutputs = outputs;
+    mOutputSize = outputSize;
+
+    //the return value is written at the start of the memory, the frame of the function follows
+    const int retSize = outputSize > CANON_REGISTER_BYTESIZE ? outputSize : 0;
+    const int frameSize = mEntry->mFunDesc->GetDec()->GetFrame()->GetTotalFrameSize();
+    Reserve(retSize + frameSize);
+
+    LaneGroup& group = mGroups[0];
+    group.mLaneCount = instanceCount;
+    for (int l = 0; l < instanceCount; ++l)
+    {
+        group.mLanes[l] = static_cast<unsigned char>(l);
+    }
+    group.mB = mEntry->mAssemblyBlock;
+    group.mIp = 0;
+    group.mFrameCount = 1;
+    group.mFrames[0].mSbp = retSize;
+    group.mFrames[0].mRetB = -1;
+    group.mFrames[0].mRetIp = 0;
+    group.mEsp = retSize + frameSize;
+    mGroupCount = 1;
+
+    Utils::Memset32(Row(R_RET), 0, LANE_COUNT * sizeof(int));
+
+    //copy the inputs to the stack, transposed
+    const int argRow = AddressToRow(retSize);
+    for (int l = 0; l < instanceCount; ++l)
+    {
+        const int* input = reinterpret_cast<const int*>(inputs + l * inputSize);
+        for (int w = 0; w < inputSize / static_cast<int>(sizeof(int)); ++w)
+        {
+            Row(argRow + w)[l] = input[w];
+        }
+    }
+
+#if PEGASUS_ENABLE_PROXIES
+    int loopCount = 0;
+    const int CheckTimeLoopCount = 100;
+    const unsigned long long maxTicks = static_cast<unsigned long long>(4.0 / Pegasus::Core::GetPerformanceCounterPeriod());
+    unsigned long long capturedTicks = Pegasus::Core::GetPerformanceCounter();
+#endif
+
+    int current = 0;
+    while (mGroupCount > 0)
+    {
+        if (RunGroup(mGroups[current]))
+        {
+            //join the groups waiting at the same place
+            for (int g = mGroupCount - 1; g >= 0; --g)
+            {
+                LaneGroup& a = mGroups[current];
+                const LaneGroup& b = mGroups[g];
+                if (g != current && IsSamePosition(a, b))
+                {
+                    unsigned char lanes[LANE_COUNT];
+                    int i = 0, j = 0, count = 0;
+                    while (i < a.mLaneCount || j < b.mLaneCount)
+                    {
+                        lanes[count++] = (j == b.mLaneCount || (i < a.mLaneCount && a.mLanes[i] < b.mLanes[j])) ? a.mLanes[i++] : b.mLanes[j++];
+                    }
+                    Utils::Memcpy(a.mLanes, lanes, count);
+                    a.mLaneCount = count;
+
+                    //the last group moves into the removed one
+                    RemoveGroup(g);
+                    if (current == mGroupCount)
+                    {
+                        current = g;
+                    }
+                }
+            }
+        }
+        else
+        {
+            RemoveGroup(current);
+        }
+
+        current = 0;
+        for (int g = 1; g < mGroupCount; ++g)
+        {
+            if (RunsBefore(mGroups[g], mGroups[current]))
+            {
+                current = g;
+            }
+        }
+
+#if PEGASUS_ENABLE_PROXIES
+        if (++loopCount == CheckTimeLoopCount)
+        {
+            loopCount = 0;
+            if (Pegasus::Core::GetPerformanceCounter() - capturedTicks > maxTicks)
+            {
+                PG_FAILSTR("Blockscript is taking too long to execute. Infinite loop? breaking execution.");
+                return false;
+            }
+        }
+#endif
+    }
+
+    return true;
+}
+
+}
+
+bool Pegasus::BlockScript::ExecuteFunctionBatch(
+    FunBindPoint bindPoint,
+    BlockScriptBuilder* builder,
+    const Assembly& assembly,
+    BsVmState& state,
+    BsVm& vm,
+    const void* inputBuffers,
+    int   inputBufferSize,
+    void* outputBuffers,
+    int   outputBufferSize,
+    int   instanceCount
+)
+{
+    if (bindPoint == FUN_INVALID_BIND_POINT || instanceCount < 0 || state.GetExecutionState() != BsVmState::Alive || state.GetStackLevels() < 0)
+    {
+        return false;
+    }
+
+    PG_ASSERT(bindPoint >= 0 && bindPoint < assembly.mFunBlockMap->Size());
+    const FunMapEntry& funMapEntry = (*assembly.mFunBlockMap)[bindPoint];
+    const FunDesc* funDesc = funMapEntry.mFunDesc;
+    if (funDesc == nullptr ||
+        funDesc->GetDec()->GetReturnType()->GetByteSize() != outputBufferSize ||
+        funDesc->GetInputArgumentsByteSize() != inputBufferSize)
+    {
+        return false;
+    }
+
+    const char* inputs = static_cast<const char*>(inputBuffers);
+    char* outputs = static_cast<char*>(outputBuffers);
+
+    BatchExecutor executor(assembly, state);
+    if (executor.Prepare(funMapEntry))
+    {
+        //callbacks can execute other functions through the assembly of the state
+        const Assembly* savedAssembly = state.GetAssembly();
+        state.SetAssembly(&assembly);
+        bool success = true;
+        for (int i = 0; i < instanceCount && success; i += LANE_COUNT)
+        {
+            const int laneCount = instanceCount - i < LANE_COUNT ? instanceCount - i : LANE_COUNT;
+            success = executor.Execute(inputs + i * inputBufferSize, inputBufferSize, outputs + i * outputBufferSize, outputBufferSize, laneCount);
+        }
+        state.SetAssembly(savedAssembly);
+        return success;
+    }
+
+    //the instances of a batch run to completion
+    const unsigned long long yieldDeadline = state.GetYieldDeadline();
+    state.SetYieldDeadline(BsVmState::NO_YIELD_DEADLINE);
+    bool success = true;
+    for (int i = 0; i < instanceCount && success; ++i)
+    {
+        success = ExecuteFunction(bindPoint, builder, assembly, state, vm, inputs + i * inputBufferSize, inputBufferSize, outputs + i * outputBufferSize, outputBufferSize);
+    }
+    state.SetYieldDeadline(yieldDeadline);
+    return success;
+}
+
+bool Pegasus::BlockScript::CanExecuteFunctionInLanes(
+    FunBindPoint bindPoint,
+    const Assembly& assembly,
+    BsVmState& state
+)
+{
+    if (bindPoint == FUN_INVALID_BIND_POINT)
+    {
+        return false;
+    }
+
+    PG_ASSERT(bindPoint >= 0 && bindPoint < assembly.mFunBlockMap->Size());
+    const FunMapEntry& funMapEntry = (*assembly.mFunBlockMap)[bindPoint];
+    if (funMapEntry.mFunDesc == nullptr)
+    {
+        return false;
+    }
+
+    BatchExecutor executor(assembly, state);
+    return executor.Prepare(funMapEntry);
+}
@@ -0,0 +1,340 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BsVmProfiler.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Profiler of the blockscript virtual machine, instruction counts and time per function and per line
+
+#include "Pegasus/BlockScript/BsVmProfiler.h"
+#include "Pegasus/BlockScript/FunDesc.h"
+#include "Pegasus/BlockScript/BlockScriptAst.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Core/Time.h"
+#include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+using namespace Pegasus;
+using namespace Pegasus::BlockScript;
+
+//! Number of slots of the function hash table, power of 2 bigger than MAX_FUNCTIONS
+static const int FUNCTION_SLOT_COUNT = 2 * BsVmProfiler::MAX_FUNCTIONS;
+
+//! Initial number of lines of the line table
+static const int INITIAL_LINE_CAPACITY = 256;
+
+BsVmProfiler::BsVmProfiler()
+:
+    mAllocator(nullptr),
+    mFunctions(nullptr),
+    mFunctionSlots(nullptr),
+    mFunctionCount(0),
+    mLines(nullptr),
+    mLineCount(0),
+    mLineCapacity(0),
+    mCallStack(nullptr),
+    mCallDepth(0),
+    mIgnoredDepth(0),
+    mCurrentLine(-1),
+    mSampleInterval(1),
+    mSampleCounter(0),
+    mLastTick(0),
+    mTotalInstructions(0)
+{
+}
+
+BsVmProfiler::~BsVmProfiler()
+{
+    if (mAllocator != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mFunctions);
+        PG_DELETE_ARRAY(mAllocator, mFunctionSlots);
+        PG_DELETE_ARRAY(mAllocator, mLines);
+        PG_DELETE_ARRAY(mAllocator, mCallStack);
+    }
+}
+
+void BsVmProfiler::Initialize(Alloc::IAllocator* allocator)
+{
+    PG_ASSERTSTR(mAllocator == nullptr, "The profiler is already initialized");
+    mAllocator = allocator;
+    mFunctions = PG_NEW_ARRAY(mAllocator, -1, "BsVmProfiler functions", Alloc::PG_MEM_PERM, FunctionStats, MAX_FUNCTIONS);
+    mFunctionSlots = PG_NEW_ARRAY(mAllocator, -1, "BsVmProfiler function slots", Alloc::PG_MEM_PERM, int, FUNCTION_SLOT_COUNT);
+    mLines = PG_NEW_ARRAY(mAllocator, -1, "BsVmProfiler lines", Alloc::PG_MEM_PERM, LineStats, INITIAL_LINE_CAPACITY);
+    mLineCapacity = INITIAL_LINE_CAPACITY;
+    mCallStack = PG_NEW_ARRAY(mAllocator, -1, "BsVmProfiler call stack", Alloc::PG_MEM_PERM, CallStackEntry, MAX_CALL_DEPTH);
+    Reset();
+}
+
+void BsVmProfiler::Reset()
+{
+    PG_ASSERTSTR(mAllocator != nullptr, "The profiler must be initialized");
+    for (int i = 0; i < FUNCTION_SLOT_COUNT; ++i)
+    {
+        mFunctionSlots[i] = -1;
+    }
+    Utils::Memset8(mLines, 0, static_cast<unsigned>(sizeof(LineStats) * mLineCapacity));
+    mFunctionCount = 0;
+    mLineCount = 0;
+    mCallDepth = 0;
+    mIgnoredDepth = 0;
+    mCurrentLine = -1;
+    mSampleCounter = 0;
+    mLastTick = Core::GetPerformanceCounter();
+    mTotalInstructions = 0;
+}
+
+const BsVmProfiler::FunctionStats& BsVmProfiler::GetFunctionStats(int index) const
+{
+    PG_ASSERT(index >= 0 && index < mFunctionCount);
+    return mFunctions[index];
+}
+
+const BsVmProfiler::LineStats& BsVmProfiler::GetLineStats(int line) const
+{
+    PG_ASSERT(line >= 0 && line < mLineCount);
+    return mLines[line];
+}
+
+double BsVmProfiler::TicksToMs(unsigned long long ticks) const
+{
+    return static_cast<double>(ticks) * Core::GetPerformanceCounterPeriod() * 1000.0;
+}
+
+const char* BsVmProfiler::GetFunctionName(const FunDesc* funDesc)
+{
+    return funDesc != nullptr ? funDesc->GetDec()->GetName() : "<global>";
+}
+
+void BsVmProfiler::OnRunBegin()
+{
+    UnwindCallStack();
+    mLastTick = Core::GetPerformanceCounter();
+    OnFunctionEnter(nullptr);
+}
+
+void BsVmProfiler::OnRunEnd()
+{
+    UnwindCallStack();
+}
+
+void BsVmProfiler::OnExternalCall(const FunDesc* funDesc)
+{
+    UnwindCallStack();
+    mLastTick = Core::GetPerformanceCounter();
+    OnFunctionEnter(funDesc);
+}
+
+void BsVmProfiler::OnFunctionEnter(const FunDesc* funDesc)
+{
+    const unsigned long long tick = Flush();
+    const int function = mIgnoredDepth == 0 ? FindFunction(funDesc) : -1;
+    if (function == -1 || mCallDepth == MAX_CALL_DEPTH)
+    {
+        // keep attributing the time to the caller, but remember the call to match the return
+        ++mIgnoredDepth;
+        return;
+    }
+
+    FunctionStats& stats = mFunctions[function];
+    ++stats.mCalls;
+    ++stats.mActiveDepth;
+
+    CallStackEntry& entry = mCallStack[mCallDepth++];
+    entry.mFunction = function;
+    entry.mStartTick = tick;
+}
+
+void BsVmProfiler::OnFunctionExit()
+{
+    const unsigned long long tick = Flush();
+    if (mIgnoredDepth > 0)
+    {
+        --mIgnoredDepth;
+        return;
+    }
+    if (mCallDepth == 0)
+    {
+        return;
+    }
+
+    const CallStackEntry& entry = mCallStack[--mCallDepth];
+    FunctionStats& stats = mFunctions[entry.mFunction];
+    // recursive calls are already covered by the outermost one
+    if (--stats.mActiveDepth == 0)
+    {
+        stats.mInclusiveTicks += tick - entry.mStartTick;
+    }
+}
+
+unsigned long long BsVmProfiler::Flush()
+{
+    const unsigned long long tick = Core::GetPerformanceCounter();
+    const unsigned long long elapsed = tick - mLastTick;
+    mLastTick = tick;
+    if (mCallDepth > 0)
+    {
+        mFunctions[mCallStack[mCallDepth - 1].mFunction].mSelfTicks += elapsed;
+    }
+    if (mCurrentLine >= 0 && mCurrentLine < mLineCount)
+    {
+        mLines[mCurrentLine].mTicks += elapsed;
+    }
+    return tick;
+}
+
+int BsVmProfiler::FindFunction(const FunDesc* funDesc)
+{
+    const size_t key = reinterpret_cast<size_t>(funDesc);
+    int slot = static_cast<int>((key >> 4) ^ (key >> 12)) & (FUNCTION_SLOT_COUNT - 1);
+    for (;;)
+    {
+        const int function = mFunctionSlots[slot];
+        if (function == -1)
+        {
+            break;
+        }
+        if (mFunctions[function].mFunDesc == funDesc)
+        {
+            return function;
+        }
+        slot = (slot + 1) & (FUNCTION_SLOT_COUNT - 1);
+    }
+
+    if (mFunctionCount == MAX_FUNCTIONS)
+    {
+        return -1;
+    }
+
+    const int function = mFunctionCount++;
+    mFunctionSlots[slot] = function;
+    FunctionStats& stats = mFunctions[function];
+    stats.mFunDesc = funDesc;
+    stats.mIsNative = funDesc != nullptr && funDesc->IsCallback();
+    stats.mCalls = 0;
+    stats.mInstructions = 0;
+    stats.mSelfTicks = 0;
+    stats.mInclusiveTicks = 0;
+    stats.mActiveDepth = 0;
+    return function;
+}
+
+void BsVmProfiler::UnwindCallStack()
+{
+    if (mCallDepth > 0 || mIgnoredDepth > 0)
+    {
+        mIgnoredDepth = 0;
+        while (mCallDepth > 0)
+        {
+            OnFunctionExit();
+        }
+    }
+    mCurrentLine = -1;
+}
+
+void BsVmProfiler::GrowLines(int lineCount)
+{
+    if (lineCount > mLineCapacity)
+    {
+        int newCapacity = mLineCapacity * 2;
+        while (newCapacity < lineCount)
+        {
+            newCapacity *= 2;
+        }
+        LineStats* newLines = PG_NEW_ARRAY(mAllocator, -1, "BsVmProfiler lines", Alloc::PG_MEM_PERM, LineStats, newCapacity);
+        Utils::Memcpy(newLines, mLines, static_cast<unsigned>(sizeof(LineStats) * mLineCount));
+        Utils::Memset8(newLines + mLineCount, 0, static_cast<unsigned>(sizeof(LineStats) * (newCapacity - mLineCount)));
+        PG_DELETE_ARRAY(mAllocator, mLines);
+        mLines = newLines;
+        mLineCapacity = newCapacity;
+    }
+    mLineCount = lineCount;
+}
+
+//! Sorts indices by decreasing value (insertion sort, the report is not performance critical)
+static void SortByDecreasingValue(int* indices, const unsigned long long* values, int count)
+{
+    for (int i = 1; i < count; ++i)
+    {
+        const int index = indices[i];
+        int j = i;
+        while (j > 0 && values[indices[j - 1]] < values[index])
+        {
+            indices[j] = indices[j - 1];
+            --j;
+        }
+        indices[j] = index;
+    }
+}
+
+void BsVmProfiler::PrintReport(PrintStringCallbackType str, PrintIntCallbackType pint, PrintFloatCallbackType pfloat, int maxEntries) const
+{
+    const int tableSize = mFunctionCount > mLineCount ? mFunctionCount : mLineCount;
+    if (tableSize == 0)
+    {
+        str("No blockscript profile data.\n");
+        return;
+    }
+
+    int* indices = PG_NEW_ARRAY(mAllocator, -1, "BsVmProfiler report", Alloc::PG_MEM_TEMP, int, tableSize);
+    unsigned long long* values = PG_NEW_ARRAY(mAllocator, -1, "BsVmProfiler report", Alloc::PG_MEM_TEMP, unsigned long long, tableSize);
+
+    str("---------------- PROFILE ----------------\n");
+    str("instructions: ");
+    pint(static_cast<int>(mTotalInstructions));
+    str(", sample interval: ");
+    pint(static_cast<int>(mSampleInterval));
+    str("\nfunctions (calls, instructions, self ms, inclusive ms):\n");
+    for (int i = 0; i < mFunctionCount; ++i)
+    {
+        indices[i] = i;
+        values[i] = mFunctions[i].mSelfTicks;
+    }
+    SortByDecreasingValue(indices, values, mFunctionCount);
+    for (int i = 0; i < mFunctionCount && i < maxEntries; ++i)
+    {
+        const FunctionStats& stats = mFunctions[indices[i]];
+        str("  ");
+        str(GetFunctionName(stats.mFunDesc));
+        str(stats.mIsNative ? " [native]: " : ": ");
+        pint(static_cast<int>(stats.mCalls));
+        str(", ");
+        pint(static_cast<int>(stats.mInstructions));
+        str(", ");
+        pfloat(static_cast<float>(TicksToMs(stats.mSelfTicks)));
+        str(", ");
+        pfloat(static_cast<float>(TicksToMs(stats.mInclusiveTicks)));
+        str("\n");
+    }
+
+    str("lines (instructions, ms):\n");
+    int executedLines = 0;
+    for (int l = 0; l < mLineCount; ++l)
+    {
+        if (mLines[l].mInstructions != 0)
+        {
+            indices[executedLines++] = l;
+        }
+        values[l] = mLines[l].mTicks;
+    }
+    SortByDecreasingValue(indices, values, executedLines);
+    for (int i = 0; i < executedLines && i < maxEntries; ++i)
+    {
+        const LineStats& stats = mLines[indices[i]];
+        str("  line ");
+        pint(indices[i] + 1);
+        str(": ");
+        pint(static_cast<int>(stats.mInstructions));
+        str(", ");
+        pfloat(static_cast<float>(TicksToMs(stats.mTicks)));
+        str("\n");
+    }
+
+    PG_DELETE_ARRAY(mAllocator, values);
+    PG_DELETE_ARRAY(mAllocator, indices);
+}
@@ -64,6 +64,7 @@ void Canonizer::Reset()
     mSymbolTable = nullptr;
     mCurrentTempAllocationSize = 0;
     mNextLabel = 0;
+    mCurrentLine = 0;
 }
 
 int Canonizer::CreateBlock()
@@ -86,8 +87,7 @@ void Canonizer::AddBlock(int id)
 void Canonizer::PushCanon(CanonNode* n)
 {
     Block& currBlock = mBlocks[mCurrentBlock];
-    CanonNode*& newCanon = currBlock.GetStmts().PushEmpty();
-    newCanon = n;
+    currBlock.PushStmt(n, mCurrentLine);
 }
 
 Idd* Canonizer::AllocateTemporal(const TypeDesc* typeDesc)
@@ -169,6 +169,7 @@ void Canonizer::BuildFunctionAsm()
         mCurrentBlock = label;
         mCurrentStackFrame = fd->GetDec()->GetFrame();
         mCurrentFunDesc = fd;
+        mCurrentLine = fd->GetDec()->GetLine();
         fd->GetDec()->GetStmtList()->Access(this);
         mCurrentFunDesc = nullptr;
         PushCanon( CANON_NEW Ret );
@@ -976,6 +977,7 @@ void Canonizer::Visit(StrImm* n)
 void Canonizer::Visit(StmtExp* n)
 {
     //process the expression, that is remove all fun calls embedded
+    mCurrentLine = n->GetLine();
     n->GetExp()->Access(this);
 }
 
@@ -993,6 +995,7 @@ void Canonizer::Visit(StmtFunDec* n)
 
 void Canonizer::Visit(StmtIfElse* n)
 {
+    mCurrentLine = n->GetLine();
     n->GetExp()->Access(this);
     JmpCond* lastJmp = CANON_NEW JmpCond(mRebuiltExpression, 0);
     PushCanon(lastJmp);
@@ -1018,6 +1021,7 @@ void Canonizer::Visit(StmtIfElse* n)
             int currentBlock = CreateBlock();
             lastJmp->SetLabel(currentBlock);
             AddBlock( currentBlock );
+            mCurrentLine = tail->GetLine();
             if (tail->GetExp() != nullptr)
             {
                 tail->GetExp()->Access(this);
@@ -1052,6 +1056,7 @@ void Canonizer::Visit(StmtWhile* n)
     int topLabel = CreateBlock();
     int endLabel = CreateBlock();
 
+    mCurrentLine = n->GetLine();
     StackFrameInfo* prevFrame = mCurrentStackFrame;
     mCurrentStackFrame = n->GetFrame();
     PushCanon( CANON_NEW PushFrame( n->GetFrame() ) );
@@ -1060,6 +1065,7 @@ void Canonizer::Visit(StmtWhile* n)
     JmpCond* jmp = CANON_NEW JmpCond(mRebuiltExpression, 0);
     PushCanon( jmp );
     n->GetStmtList()->Access(this);
+    mCurrentLine = n->GetLine();
     PushCanon( CANON_NEW Jmp( topLabel ) );
     jmp->SetLabel(endLabel);
     AddBlock(endLabel);
@@ -1071,6 +1077,7 @@ void Canonizer::Visit(StmtFor* forLoop)
 {
     int topLabel = CreateBlock();
     int endLabel = CreateBlock();
+    mCurrentLine = forLoop->GetLine();
     StackFrameInfo* prevFrame = mCurrentStackFrame;
     mCurrentStackFrame = forLoop->GetFrame();
     PushCanon( CANON_NEW PushFrame( forLoop->GetFrame() ) );
@@ -1089,6 +1096,7 @@ void Canonizer::Visit(StmtFor* forLoop)
     }
 
     forLoop->GetStmtList()->Access(this);
+    mCurrentLine = forLoop->GetLine();
 
     if (forLoop->GetUpdate() != nullptr)
     {
@@ -1113,6 +1121,7 @@ void Canonizer::Visit(StmtEnumTypeDef* n)
 
 void Canonizer::Visit(StmtReturn* n)
 {
+    mCurrentLine = n->GetLine();
     n->GetExp()->Access(this);
     const TypeDesc* typeDesc = mRebuiltExpression->GetTypeDesc();
     if (typeDesc->GetByteSize() <= CANON_REGISTER_BYTESIZE)
@@ -1133,3 +1142,9 @@ void Canonizer::Visit(StmtReturn* n)
     }
     PushCanon( CANON_NEW Ret );
 }
+
+void Canonizer::Visit(StmtYield* n)
+{
+    mCurrentLine = n->GetLine();
+    PushCanon( CANON_NEW Yield );
+}
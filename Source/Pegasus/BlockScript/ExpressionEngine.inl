@@ -15,11 +15,11 @@ namespace Pegasus
 namespace BlockScript
 {
 
-template<class IntrinsicType> IntrinsicType& ExpressionEngine<IntrinsicType>::Eval(Ast::Exp* exp, BsVmState& state)
+template<class IntrinsicType> IntrinsicType ExpressionEngine<IntrinsicType>::Eval(Ast::Exp* exp, BsVmState& state)
 {
-    mState = &state;
-    exp->Access(this);
-    return mResult;
+    ExpressionEngine<IntrinsicType> engine(state);
+    exp->Access(&engine);
+    return engine.mResult;
 }
 
 template<class IntrinsicType> void ExpressionEngine<IntrinsicType>::Visit(Ast::Program* n)          {PG_FAILSTR("function not supported");}
@@ -37,6 +37,7 @@ template<class IntrinsicType> void ExpressionEngine<IntrinsicType>::Visit(Ast::S
 template<class IntrinsicType> void ExpressionEngine<IntrinsicType>::Visit(Ast::StmtWhile* n)        {PG_FAILSTR("function not supported");}
 template<class IntrinsicType> void ExpressionEngine<IntrinsicType>::Visit(Ast::StmtFor* n)          {PG_FAILSTR("function not supported");}
 template<class IntrinsicType> void ExpressionEngine<IntrinsicType>::Visit(Ast::StmtReturn* n)       {PG_FAILSTR("function not supported");}
+template<class IntrinsicType> void ExpressionEngine<IntrinsicType>::Visit(Ast::StmtYield* n)        {PG_FAILSTR("function not supported");}
 template<class IntrinsicType> void ExpressionEngine<IntrinsicType>::Visit(Ast::StmtStructDef* n)    {PG_FAILSTR("function not supported");}
 template<class IntrinsicType> void ExpressionEngine<IntrinsicType>::Visit(Ast::StmtEnumTypeDef* n)  {PG_FAILSTR("function not supported");}
 template<class IntrinsicType> void ExpressionEngine<IntrinsicType>::Visit(Ast::ArrayConstructor* n) {PG_FAILSTR("function not supported");}
@@ -50,7 +51,7 @@ template<class IntrinsicType> IntrinsicType* ExpressionEngine<IntrinsicType>::Ge
     PG_ASSERT(lhs->GetTypeDesc()->GetModifier() == TypeDesc::M_ARRAY || lhs->GetTypeDesc()->GetModifier() == TypeDesc::M_VECTOR);
 
     Ast::Idd* lhsIdd = static_cast<Ast::Idd*>(lhs);
-    int rhsOffset = gIntExpEngine.Eval(rhs, *mState);
+    int rhsOffset = ExpressionEngine_Int::Eval(rhs, *mState);
 
     char* memLoc = reinterpret_cast<char*>(GetIddMem(lhsIdd, *mState)) + rhsOffset; 
 
@@ -15,6 +15,7 @@
 #include "Pegasus/BlockScript/TypeTable.h"
 #include "Pegasus/BlockScript/TypeDesc.h"
 #include "Pegasus/BlockScript/BsVm.h"
+#include "Pegasus/BlockScript/BsVmProfiler.h"
 #include "Pegasus/BlockScript/BlockScriptAst.h"
 #include "Pegasus/BlockScript/Canonizer.h"
 #include "Pegasus/BlockScript/FunTable.h"
@@ -24,6 +25,8 @@
 #include "Pegasus/Core/Log.h"
 #include "Pegasus/Core/Assertion.h"
 #include "Pegasus/Core/Time.h"
+#include "Pegasus/Core/Thread.h"
+#include "Pegasus/Core/Atomic.h"
 
 using namespace Pegasus;
 using namespace Pegasus::BlockScript;
@@ -57,6 +60,31 @@ FunBindPoint Pegasus::BlockScript::GetFunctionBindPoint(
     const char*const* argTypes,
     int argumentListCount
 )
+{
+    const TypeDesc* argTypeDescs[MAX_FUN_ARG_LIST];
+    if (argumentListCount > MAX_FUN_ARG_LIST)
+    {
+        return FUN_INVALID_BIND_POINT;
+    }
+
+    for (int i = 0; i < argumentListCount; ++i)
+    {
+        argTypeDescs[i] = builder->GetTypeByName(argTypes[i]);
+        if (argTypeDescs[i] == nullptr)
+        {
+            return FUN_INVALID_BIND_POINT;
+        }
+    }
+
+    return GetFunctionBindPoint(assembly, funName, argTypeDescs, argumentListCount);
+}
+
+FunBindPoint Pegasus::BlockScript::GetFunctionBindPoint(
+    const Assembly& assembly,
+    const char* funName,
+    const TypeDesc*const* argTypes,
+    int argumentListCount
+)
 {
     const Container<FunMapEntry>* funEntries = assembly.mFunBlockMap;
     int funEntriesSize = funEntries->Size();
@@ -87,16 +115,8 @@ FunBindPoint Pegasus::BlockScript::GetFunctionBindPoint(
             }
         
             Ast::ArgDec* argDec = argList->GetArgDec();
-            
-            const char* argTypeName = argTypes[i];
-            const TypeDesc* type = builder->GetTypeByName(argTypeName);
 
-            if (type == nullptr)
-            {
-                return FUN_INVALID_BIND_POINT;
-            }
-
-            if (!type->Equals(argDec->GetType()))
+            if (!argTypes[i]->Equals(argDec->GetType()))
             {
                 foundFun = false;
                 break;
@@ -118,40 +138,100 @@ FunBindPoint Pegasus::BlockScript::GetFunctionBindPoint(
 extern void PushFrameCommand(const StackFrameInfo* info, BsVmState& state, const Container<GlobalMapEntry>* globalsInitData);
 extern void PopFrameCommand(BsVmState& state);
 
-bool Pegasus::BlockScript::ExecuteFunction(
+namespace
+{
+    //! Steps the function called by ExecuteFunction until it returns, or until it is suspended by a yield statement
+    //! \param callerStackLevels - the stack levels once the function has returned
+    //! \return false if the function is taking too long to execute
+    bool StepFunction(const Assembly& assembly, BsVmState& state, BsVm& vm, int callerStackLevels)
+    {
+#if PEGASUS_ENABLE_PROXIES
+        //read the counter directly, the pegasus time is shared by all the threads executing functions
+        int loopCount = 0;
+        const int CheckTimeLoopCount = 100;
+        const unsigned long long maxTicks = static_cast<unsigned long long>(4.0 / Pegasus::Core::GetPerformanceCounterPeriod());
+        unsigned long long capturedTicks = Pegasus::Core::GetPerformanceCounter();
+#endif
+        while (state.GetStackLevels() != callerStackLevels && state.GetExecutionState() != BsVmState::Suspended)
+        {
+            vm.StepExecution(assembly, state);
+#if PEGASUS_ENABLE_PROXIES
+            bool checkTime = loopCount == CheckTimeLoopCount;
+            if (checkTime)
+            {
+                loopCount = 0;
+                if (Pegasus::Core::GetPerformanceCounter() - capturedTicks > maxTicks)
+                {
+                    PG_FAILSTR("Blockscript is taking too long to execute. Infinite loop? breaking execution. Warning: this can leave the VM in a devastated state.");
+                    return false;
+                }
+            }
+            ++loopCount;
+            
+#endif
+        }
+        return true;
+    }
+
+    //! Copies the result of the function that returned to the output buffer (if not null), and restores the registers of the caller
+    void EndFunction(BsVmState& state, void* outputBuffer, int outputBufferSize, int savedIp, const Assembly* savedAssembly)
+    {
+        if (outputBufferSize <= CANON_REGISTER_BYTESIZE)
+        {
+            int* retPtr = state.GetRegBuffer() + Canon::R_RET;
+            if (outputBuffer != nullptr)
+            {
+                Utils::Memcpy(outputBuffer, retPtr, outputBufferSize);
+            }
+        }
+        else
+        {
+            char* retPtr = state.Ram() + state.GetReg(Canon::R_RET);
+            if (outputBuffer != nullptr)
+            {
+                Utils::Memcpy(outputBuffer, retPtr, outputBufferSize);
+            }
+            state.Shrink(outputBufferSize);
+            state.SetReg(Canon::R_ESP, state.GetReg(Canon::R_ESP) - outputBufferSize);
+        }
+
+        //save ip
+        state.SetReg(Canon::R_IP, savedIp);
+        state.SetAssembly(savedAssembly);
+    }
+}
+
+//! Executes a function on top of the stack levels of its caller, see ExecuteFunction
+//! \param callerStackLevels - the stack levels of the state when called, 0 for the global scope
+static bool ExecuteFunctionAt(
     FunBindPoint bindPoint,
-    BlockScriptBuilder* builder, 
     const Assembly& assembly,
     BsVmState& state,
     BsVm& vm,
     const void* inputBuffer,
     int   inputBufferSize,
     void* outputBuffer,
-    int   outputBufferSize
+    int   outputBufferSize,
+    int   callerStackLevels
 )
 {
-    if (bindPoint == FUN_INVALID_BIND_POINT || state.GetExecutionState() != BsVmState::Alive)
-    {
-        return false;
-    }
-
     PG_ASSERT(bindPoint >= 0 && bindPoint < assembly.mFunBlockMap->Size());
 
     const FunMapEntry funMapEntry = (*assembly.mFunBlockMap)[bindPoint];
 
     const FunDesc* funDesc = funMapEntry.mFunDesc;
 
-    //if there is a function description and the current state is in the global pointer
-    if (funDesc != nullptr && state.GetStackLevels() == 0)
+    //if there is a function description and the current state is in the expected stack
+    if (funDesc != nullptr && state.GetStackLevels() == callerStackLevels)
     {
-        const Ast::StmtFunDec* funDec = funDesc->GetDec();
+        const StmtFunDec* funDec = funDesc->GetDec();
         if (funDec->GetReturnType()->GetByteSize() == outputBufferSize &&
             funDesc->GetInputArgumentsByteSize() == inputBufferSize)
         {
             //we allocte a temporal buffer if the result is big.
             if (outputBufferSize > CANON_REGISTER_BYTESIZE)
             {
-                state.SetReg(Canon::R_RET, Canon::R_ESP); //our pointer to the area to have the returned value
+                state.SetReg(Canon::R_RET, state.GetReg(Canon::R_ESP)); //our pointer to the area to have the returned value
                 state.Grow(outputBufferSize);
                 state.SetReg(Canon::R_ESP, state.GetReg(Canon::R_ESP) + outputBufferSize);
             }
@@ -162,6 +242,10 @@ bool Pegasus::BlockScript::ExecuteFunction(
             //save ip
             int savedIp = state.GetReg(Canon::R_IP);
 
+            //callbacks can execute other functions through the assembly of the state
+            const Assembly* savedAssembly = state.GetAssembly();
+            state.SetAssembly(&assembly);
+
             //registers have been saved, lets now set the address of this function
             state.SetReg(Canon::R_B,  funMapEntry.mAssemblyBlock);
             state.SetReg(Canon::R_IP, 0);
@@ -172,52 +256,43 @@ bool Pegasus::BlockScript::ExecuteFunction(
             //copy the inputs to the stack
             Utils::Memcpy(stackBase, inputBuffer, inputBufferSize);
 
-            //run until we are done
-#if PEGASUS_ENABLE_PROXIES
-            int loopCount = 0;
-            const int CheckTimeLoopCount = 100;
-            Pegasus::Core::UpdatePegasusTime();
-            double capturedTime = Pegasus::Core::GetPegasusTime();
-#endif
-            while (state.GetStackLevels() != 0)
+#if PEGASUS_ENABLE_BS_PROFILER
+            if (state.GetProfiler() != nullptr)
             {
-                vm.StepExecution(assembly, state);
-#if PEGASUS_ENABLE_PROXIES
-                bool checkTime = loopCount == CheckTimeLoopCount;
-                if (checkTime)
-                {
-                    loopCount = 0;
-                    Pegasus::Core::UpdatePegasusTime();
-                    double newTime = Pegasus::Core::GetPegasusTime();
-                    if (newTime - capturedTime > 4.0)
-                    {
-                        state.SetReg(Canon::R_IP, savedIp);
-                        PG_FAILSTR("Blockscript is taking too long to execute. Infinite loop? breaking execution. Warning: this can leave the VM in a devastated state.");
-                        return false;
-                    }
-                }
-                ++loopCount;
-                
-#endif
+                state.GetProfiler()->OnExternalCall(funDesc);
             }
+#endif
 
-            //copy the result to the output buffer
-            if (outputBufferSize <= CANON_REGISTER_BYTESIZE)
+            //nested executions run to completion, the callback that started them cannot be suspended
+            const unsigned long long yieldDeadline = state.GetYieldDeadline();
+            if (savedAssembly != nullptr)
             {
-                int* retPtr = state.GetRegBuffer() + Canon::R_RET;
-                Utils::Memcpy(outputBuffer, retPtr, outputBufferSize);
+                state.SetYieldDeadline(BsVmState::NO_YIELD_DEADLINE);
             }
-            else
+
+            //run until we are done
+            const bool completed = StepFunction(assembly, state, vm, callerStackLevels);
+            state.SetYieldDeadline(yieldDeadline);
+            if (!completed)
             {
-                char* retPtr = state.Ram() + state.GetReg(Canon::R_RET);
-                Utils::Memcpy(outputBuffer, retPtr, outputBufferSize);
-                state.Shrink(outputBufferSize);
-                state.SetReg(Canon::R_ESP, state.GetReg(Canon::R_ESP) - outputBufferSize);
+                state.SetReg(Canon::R_IP, savedIp);
+                state.SetAssembly(savedAssembly);
+                return false;
             }
 
-            //save ip
-            state.SetReg(Canon::R_IP, savedIp);
+            if (state.GetExecutionState() == BsVmState::Suspended)
+            {
+                //the registers of the caller are restored by ResumeExecution, once the function returns
+                BsVmState::SuspendedCall& suspendedCall = state.GetSuspendedCall();
+                suspendedCall.mIsFunction = true;
+                suspendedCall.mSavedIp = savedIp;
+                suspendedCall.mSavedAssembly = savedAssembly;
+                suspendedCall.mOutputBufferSize = outputBufferSize;
+                state.SetAssembly(savedAssembly);
+                return true;
+            }
 
+            EndFunction(state, outputBuffer, outputBufferSize, savedIp, savedAssembly);
             return true;
             
         }
@@ -233,6 +308,204 @@ bool Pegasus::BlockScript::ExecuteFunction(
     }
 }
 
+bool Pegasus::BlockScript::ExecuteFunction(
+    FunBindPoint bindPoint,
+    BlockScriptBuilder* builder, 
+    const Assembly& assembly,
+    BsVmState& state,
+    BsVm& vm,
+    const void* inputBuffer,
+    int   inputBufferSize,
+    void* outputBuffer,
+    int   outputBufferSize
+)
+{
+    if (bindPoint == FUN_INVALID_BIND_POINT || state.GetExecutionState() != BsVmState::Alive)
+    {
+        return false;
+    }
+
+    return ExecuteFunctionAt(bindPoint, assembly, state, vm, inputBuffer, inputBufferSize, outputBuffer, outputBufferSize, 0);
+}
+
+bool Pegasus::BlockScript::ExecuteFunctionWhileSuspended(
+    FunBindPoint bindPoint,
+    BlockScriptBuilder* builder, 
+    const Assembly& assembly,
+    BsVmState& state,
+    BsVm& vm,
+    const void* inputBuffer,
+    int   inputBufferSize,
+    void* outputBuffer,
+    int   outputBufferSize
+)
+{
+    //the global scope must be complete, the function may read any global
+    if (bindPoint == FUN_INVALID_BIND_POINT || state.GetExecutionState() != BsVmState::Suspended || !state.GetSuspendedCall().mIsFunction)
+    {
+        return false;
+    }
+
+    //the function runs on top of the frames of the suspended one, which are left untouched.
+    //Only the registers and the suspended call need to be restored afterwards.
+    int savedRegisters[Canon::R_COUNT];
+    Utils::Memcpy(savedRegisters, state.GetRegBuffer(), sizeof(savedRegisters));
+    const BsVmState::SuspendedCall suspendedCall = state.GetSuspendedCall();
+    const unsigned long long yieldDeadline = state.GetYieldDeadline();
+
+    //the function runs to completion, it cannot be suspended on top of another suspended execution
+    state.SetExecutionState(BsVmState::Alive);
+    state.SetYieldDeadline(BsVmState::NO_YIELD_DEADLINE);
+    const bool success = ExecuteFunctionAt(bindPoint, assembly, state, vm, inputBuffer, inputBufferSize, outputBuffer, outputBufferSize, state.GetStackLevels());
+    state.SetYieldDeadline(yieldDeadline);
+
+    if (state.GetExecutionState() == BsVmState::Crashed)
+    {
+        return false;
+    }
+
+    Utils::Memcpy(state.GetRegBuffer(), savedRegisters, sizeof(savedRegisters));
+    state.GetSuspendedCall() = suspendedCall;
+    state.SetExecutionState(BsVmState::Suspended);
+    return success;
+}
+
+bool Pegasus::BlockScript::ResumeExecution(
+    const Assembly& assembly,
+    BsVmState& state,
+    BsVm& vm,
+    void* outputBuffer,
+    int   outputBufferSize
+)
+{
+    if (state.GetExecutionState() != BsVmState::Suspended)
+    {
+        return false;
+    }
+
+    const BsVmState::SuspendedCall suspendedCall = state.GetSuspendedCall();
+    if (suspendedCall.mIsFunction && outputBuffer != nullptr && outputBufferSize != suspendedCall.mOutputBufferSize)
+    {
+        return false;
+    }
+
+    state.SetExecutionState(BsVmState::Alive);
+    state.SetAssembly(&assembly);
+
+    if (!suspendedCall.mIsFunction)
+    {
+        //continue the global scope as BsVm::Run does
+        while (vm.StepExecution(assembly, state) && state.GetExecutionState() == BsVmState::Alive);
+        state.SetAssembly(nullptr);
+        return true;
+    }
+
+    if (!StepFunction(assembly, state, vm, 0))
+    {
+        state.SetReg(Canon::R_IP, suspendedCall.mSavedIp);
+        state.SetAssembly(suspendedCall.mSavedAssembly);
+        return false;
+    }
+
+    if (state.GetExecutionState() == BsVmState::Suspended)
+    {
+        state.SetAssembly(suspendedCall.mSavedAssembly);
+    }
+    else
+    {
+        EndFunction(state, outputBuffer, suspendedCall.mOutputBufferSize, suspendedCall.mSavedIp, suspendedCall.mSavedAssembly);
+    }
+    return true;
+}
+
+namespace
+{
+    //! Arguments of ExecuteFunctionParallel, shared by its jobs (one job per state)
+    struct ParallelExecution
+    {
+        FunBindPoint mBindPoint;
+        BlockScriptBuilder* mBuilder;
+        const Assembly* mAssembly;
+        BsVmState* const* mStates;
+        BsVm* mVm;
+        const char* mInputBuffers;
+        int mInputBufferSize;
+        char* mOutputBuffers;
+        int mOutputBufferSize;
+        Pegasus::Core::AtomicInt mSuccessCount;
+    };
+
+    //! Executes the function on one state
+    void ExecuteFunctionJob(void* userData, unsigned int jobIndex, unsigned int workerIndex)
+    {
+        ParallelExecution* execution = static_cast<ParallelExecution*>(userData);
+        const int i = static_cast<int>(jobIndex);
+        bool success = Pegasus::BlockScript::ExecuteFunction(
+            execution->mBindPoint,
+            execution->mBuilder,
+            *execution->mAssembly,
+            *execution->mStates[i],
+            *execution->mVm,
+            execution->mInputBuffers + i * execution->mInputBufferSize,
+            execution->mInputBufferSize,
+            execution->mOutputBuffers + i * execution->mOutputBufferSize,
+            execution->mOutputBufferSize
+        );
+
+        if (success)
+        {
+            Pegasus::Core::AtomicIncrement(&execution->mSuccessCount);
+        }
+    }
+}
+
+int Pegasus::BlockScript::ExecuteFunctionParallel(
+    FunBindPoint bindPoint,
+    BlockScriptBuilder* builder, 
+    const Assembly& assembly,
+    BsVmState* const* states,
+    int   stateCount,
+    BsVm& vm,
+    const void* inputBuffers,
+    int   inputBufferSize,
+    void* outputBuffers,
+    int   outputBufferSize,
+    unsigned int workerCount
+)
+{
+    if (bindPoint == FUN_INVALID_BIND_POINT || stateCount <= 0)
+    {
+        return 0;
+    }
+
+#if PEGASUS_ENABLE_ASSERT
+    //a state executed by two jobs at the same time would corrupt its memory
+    for (int i = 0; i < stateCount; ++i)
+    {
+        for (int j = i + 1; j < stateCount; ++j)
+        {
+            PG_ASSERTSTR(states[i] != states[j], "The same vm state (%d and %d) cannot execute in parallel.", i, j);
+        }
+    }
+#endif
+
+    ParallelExecution execution;
+    execution.mBindPoint = bindPoint;
+    execution.mBuilder = builder;
+    execution.mAssembly = &assembly;
+    execution.mStates = states;
+    execution.mVm = &vm;
+    execution.mInputBuffers = static_cast<const char*>(inputBuffers);
+    execution.mInputBufferSize = inputBufferSize;
+    execution.mOutputBuffers = static_cast<char*>(outputBuffers);
+    execution.mOutputBufferSize = outputBufferSize;
+    execution.mSuccessCount = 0;
+
+    Pegasus::Core::RunParallelJobs(ExecuteFunctionJob, &execution, static_cast<unsigned int>(stateCount), workerCount);
+
+    return static_cast<int>(Pegasus::Core::AtomicLoad(&execution.mSuccessCount));
+}
+
 int Pegasus::BlockScript::ReadGlobalValue(
     GlobalBindPoint bindPoint,
     const Assembly& assembly,
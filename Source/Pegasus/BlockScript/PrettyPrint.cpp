@@ -242,6 +242,11 @@ void PrettyPrint::PrintBlock(Canon::Block& b)
                 Indent();mStr("EXIT\n");
             }
             break;
+        case Canon::T_YIELD:
+            {
+                Indent();mStr("YIELD\n");
+            }
+            break;
         default:
             PG_FAILSTR("Invalid assembly node");
         }
@@ -574,6 +579,12 @@ void PrettyPrint::Visit(StmtReturn* n)
     mStr(";\n");
 }
 
+void PrettyPrint::Visit(StmtYield* n)
+{
+    Indent();
+    mStr("yield;\n");
+}
+
 
 void PrettyPrint::Visit(StmtEnumTypeDef* enumDef)
 {
@@ -23,7 +23,8 @@ StackFrameInfo::StackFrameInfo()
 mSize(0),
 mTempSize(0),
 mCreatorCategory(StackFrameInfo::NONE),
-mParent(nullptr)
+mParent(nullptr),
+mLine(0)
 {
 }
 
@@ -40,6 +41,7 @@ void StackFrameInfo::Initialize(Alloc::IAllocator* allocator)
 void StackFrameInfo::Reset()
 {
     mParent = nullptr;
+    mLine = 0;
     mEntries.Reset();
 }
 
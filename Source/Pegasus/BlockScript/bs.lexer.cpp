@@ -1515,6 +1515,7 @@ case 48:
 YY_RULE_SETUP
 #line 452 "bs.l"
 { 
+                    if (!Pegasus::Utils::Strcmp(yytext, "yield")) { return K_YIELD; }
                     bool isTypeString = false;
                     int strLen = Pegasus::Utils::Strlen(yytext) + 1;
                     if (strLen >=  Pegasus::BlockScript::IddStrPool::sCharsPerString){
@@ -1543,132 +1544,132 @@ YY_RULE_SETUP
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
-#line 478 "bs.l"
+#line 479 "bs.l"
 { BS_TOKEN(O_PLUS);  }
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
-#line 479 "bs.l"
+#line 480 "bs.l"
 { BS_TOKEN(O_MINUS); }
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
-#line 480 "bs.l"
+#line 481 "bs.l"
 { BS_TOKEN(O_MUL);   }
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
-#line 481 "bs.l"
+#line 482 "bs.l"
 { BS_TOKEN(O_DIV);   }
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
-#line 482 "bs.l"
+#line 483 "bs.l"
 { BS_TOKEN(O_MOD);   }
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
-#line 483 "bs.l"
+#line 484 "bs.l"
 { BS_TOKEN(O_EQ);    }
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
-#line 484 "bs.l"
+#line 485 "bs.l"
 { BS_TOKEN(O_NEQ);    }
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
-#line 485 "bs.l"
+#line 486 "bs.l"
 { BS_TOKEN(O_GT);    }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
-#line 486 "bs.l"
+#line 487 "bs.l"
 { BS_TOKEN(O_LT);    }
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
-#line 487 "bs.l"
+#line 488 "bs.l"
 { BS_TOKEN(O_GTE);   }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
-#line 488 "bs.l"
+#line 489 "bs.l"
 { BS_TOKEN(O_LTE);   }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
-#line 489 "bs.l"
+#line 490 "bs.l"
 { BS_TOKEN(O_LAND); }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
-#line 490 "bs.l"
+#line 491 "bs.l"
 { BS_TOKEN(O_LOR);  }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
-#line 491 "bs.l"
+#line 492 "bs.l"
 { BS_TOKEN(O_SET);  }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
-#line 492 "bs.l"
+#line 493 "bs.l"
 { BS_TOKEN(O_METHOD_CALL); }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
-#line 493 "bs.l"
+#line 494 "bs.l"
 { BS_TOKEN(O_DOT); }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
-#line 494 "bs.l"
+#line 495 "bs.l"
 { return K_A_PAREN;  }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
-#line 495 "bs.l"
+#line 496 "bs.l"
 { return K_L_PAREN; }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
-#line 496 "bs.l"
+#line 497 "bs.l"
 { return K_R_PAREN; }
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
-#line 497 "bs.l"
+#line 498 "bs.l"
 { return K_L_BRAC;  }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
-#line 498 "bs.l"
+#line 499 "bs.l"
 { return K_R_BRAC;  }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
-#line 499 "bs.l"
+#line 500 "bs.l"
 { return K_L_LACE;  }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
-#line 500 "bs.l"
+#line 501 "bs.l"
 { return K_R_LACE;  }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
-#line 501 "bs.l"
+#line 502 "bs.l"
 { return K_COMMA;   }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
-#line 502 "bs.l"
+#line 503 "bs.l"
 { return K_COL;     }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
-#line 503 "bs.l"
+#line 504 "bs.l"
 ;
 	YY_BREAK
 
@@ -1679,7 +1680,7 @@ case YY_STATE_EOF(STRING_BLOCK):
 case YY_STATE_EOF(PREPROCESSOR):
 case YY_STATE_EOF(PREPROCESSOR_DEFINE_CAPTURE):
 case YY_STATE_EOF(PREPROCESSOR_IGNORE_CODE):
-#line 506 "bs.l"
+#line 507 "bs.l"
 {
                     if (yyextra->GetDefineStackCount() > 0)
                     {
@@ -1699,10 +1700,10 @@ case YY_STATE_EOF(PREPROCESSOR_IGNORE_CODE):
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
-#line 522 "bs.l"
+#line 523 "bs.l"
 ECHO;
 	YY_BREAK
-#line 1706 "bs.lexer.cpp"
+#line 1707 "bs.lexer.cpp"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -2864,7 +2865,7 @@ void BS_free (void * ptr , yyscan_t yyscanner)
 
 #define YYTABLES_NAME "yytables"
 
-#line 521 "bs.l"
+#line 522 "bs.l"
 
 
 
@@ -221,9 +221,10 @@ extern int BS_debug;
      O_METHOD_CALL = 302,
      O_IMPLICIT_CAST = 303,
      O_EXPLICIT_CAST = 304,
-     ACCESS_PREC = 305,
-     CAST = 306,
-     NEG = 307
+     K_YIELD = 305,
+     ACCESS_PREC = 306,
+     CAST = 307,
+     NEG = 308
    };
 #endif
 
@@ -247,7 +248,7 @@ typedef union YYSTYPE
 
 
 /* Line 387 of yacc.c  */
-#line 251 "bs.parser.cpp"
+#line 252 "bs.parser.cpp"
 } YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define yystype YYSTYPE /* obsolescent; will be withdrawn */
@@ -274,7 +275,7 @@ int BS_parse ();
 /* Copy the second part of user declarations.  */
 
 /* Line 390 of yacc.c  */
-#line 278 "bs.parser.cpp"
+#line 279 "bs.parser.cpp"
 
 #ifdef short
 # undef short
@@ -492,22 +493,22 @@ union yyalloc
 #endif /* !YYCOPY_NEEDED */
 
 /* YYFINAL -- State number of the termination state.  */
-#define YYFINAL  49
+#define YYFINAL  51
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   835
+#define YYLAST   902
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  53
+#define YYNTOKENS  54
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  27
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  84
+#define YYNRULES  85
 /* YYNRULES -- Number of states.  */
-#define YYNSTATES  201
+#define YYNSTATES  203
 
 /* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
 #define YYUNDEFTOK  2
-#define YYMAXUTOK   307
+#define YYMAXUTOK   308
 
 #define YYTRANSLATE(YYX)						\
   ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
@@ -545,7 +546,7 @@ static const yytype_uint8 yytranslate[] =
       15,    16,    17,    18,    19,    20,    21,    22,    23,    24,
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
-      45,    46,    47,    48,    49,    50,    51,    52
+      45,    46,    47,    48,    49,    50,    51,    52,    53
 };
 
 #if YYDEBUG
@@ -554,65 +555,65 @@ static const yytype_uint8 yytranslate[] =
 static const yytype_uint16 yyprhs[] =
 {
        0,     0,     3,     5,     8,    10,    11,    14,    20,    24,
-      31,    35,    38,    46,    58,    65,    72,    81,    83,    87,
-      89,    92,    94,    96,    98,   106,   113,   114,   116,   122,
-     127,   128,   130,   134,   136,   140,   142,   144,   146,   151,
-     155,   157,   158,   160,   162,   167,   172,   177,   179,   181,
-     184,   187,   194,   201,   205,   209,   213,   217,   221,   225,
-     229,   233,   237,   241,   245,   249,   253,   257,   261,   266,
-     269,   274,   278,   281,   284,   285,   287,   291,   293,   294,
-     299,   301,   305,   308,   309
+      31,    35,    38,    41,    49,    61,    68,    75,    84,    86,
+      90,    92,    95,    97,    99,   101,   109,   116,   117,   119,
+     125,   130,   131,   133,   137,   139,   143,   145,   147,   149,
+     154,   158,   160,   161,   163,   165,   170,   175,   180,   182,
+     184,   187,   190,   197,   204,   208,   212,   216,   220,   224,
+     228,   232,   236,   240,   244,   248,   252,   256,   260,   264,
+     269,   272,   277,   281,   284,   287,   288,   290,   294,   296,
+     297,   302,   304,   308,   311,   312
 };
 
 /* YYRHS -- A `-1'-separated list of the rules' RHS.  */
 static const yytype_int8 yyrhs[] =
 {
-      54,     0,    -1,    55,    -1,    55,    56,    -1,    56,    -1,
-      -1,    74,    11,    -1,    27,    73,    42,    74,    11,    -1,
-      58,    74,    11,    -1,    58,    27,    73,    42,    74,    11,
-      -1,    20,    74,    11,    -1,    66,    70,    -1,    62,    12,
-      74,    13,    14,    55,    15,    -1,    63,    12,    75,    11,
-      75,    11,    75,    13,    14,    55,    15,    -1,    57,     5,
-      14,    78,    15,    11,    -1,    24,     5,    14,    69,    15,
-      11,    -1,     8,    12,    74,    60,    55,    15,    64,    67,
-      -1,    23,    -1,    59,    72,    13,    -1,    28,    -1,    13,
-      14,    -1,    77,    -1,    21,    -1,    22,    -1,    64,    65,
-      12,    74,    60,    55,    15,    -1,    65,    12,    74,    60,
-      55,    15,    -1,    -1,     9,    -1,    61,     5,    12,    76,
-      13,    -1,    68,    14,    55,    15,    -1,    -1,    10,    -1,
-      69,    18,     5,    -1,     5,    -1,    14,    55,    15,    -1,
-      11,    -1,     4,    -1,     3,    -1,    26,    12,    77,    13,
-      -1,    72,    18,    74,    -1,    74,    -1,    -1,     5,    -1,
-      73,    -1,     5,    12,    72,    13,    -1,     6,    12,    72,
-      13,    -1,    25,    37,    77,    36,    -1,     7,    -1,    71,
-      -1,    45,    74,    -1,    46,    74,    -1,    74,    47,     5,
-      12,    72,    13,    -1,    74,    47,     6,    12,    72,    13,
-      -1,    74,    42,    74,    -1,    74,    29,    74,    -1,    74,
-      30,    74,    -1,    74,    31,    74,    -1,    74,    32,    74,
-      -1,    74,    33,    74,    -1,    74,    34,    74,    -1,    74,
-      35,    74,    -1,    74,    40,    74,    -1,    74,    41,    74,
-      -1,    74,    37,    74,    -1,    74,    36,    74,    -1,    74,
-      39,    74,    -1,    74,    38,    74,    -1,    74,    43,    73,
-      -1,    74,    16,    74,    17,    -1,    30,    74,    -1,    12,
-      77,    13,    74,    -1,    12,    74,    13,    -1,    74,    45,
-      -1,    74,    46,    -1,    -1,    74,    -1,    76,    18,    79,
-      -1,    79,    -1,    -1,    77,    16,     4,    17,    -1,     6,
-      -1,    78,    79,    11,    -1,    79,    11,    -1,    -1,     5,
-      19,    77,    -1
+      55,     0,    -1,    56,    -1,    56,    57,    -1,    57,    -1,
+      -1,    75,    11,    -1,    27,    74,    42,    75,    11,    -1,
+      59,    75,    11,    -1,    59,    27,    74,    42,    75,    11,
+      -1,    20,    75,    11,    -1,    50,    11,    -1,    67,    71,
+      -1,    63,    12,    75,    13,    14,    56,    15,    -1,    64,
+      12,    76,    11,    76,    11,    76,    13,    14,    56,    15,
+      -1,    58,     5,    14,    79,    15,    11,    -1,    24,     5,
+      14,    70,    15,    11,    -1,     8,    12,    75,    61,    56,
+      15,    65,    68,    -1,    23,    -1,    60,    73,    13,    -1,
+      28,    -1,    13,    14,    -1,    78,    -1,    21,    -1,    22,
+      -1,    65,    66,    12,    75,    61,    56,    15,    -1,    66,
+      12,    75,    61,    56,    15,    -1,    -1,     9,    -1,    62,
+       5,    12,    77,    13,    -1,    69,    14,    56,    15,    -1,
+      -1,    10,    -1,    70,    18,     5,    -1,     5,    -1,    14,
+      56,    15,    -1,    11,    -1,     4,    -1,     3,    -1,    26,
+      12,    78,    13,    -1,    73,    18,    75,    -1,    75,    -1,
+      -1,     5,    -1,    74,    -1,     5,    12,    73,    13,    -1,
+       6,    12,    73,    13,    -1,    25,    37,    78,    36,    -1,
+       7,    -1,    72,    -1,    45,    75,    -1,    46,    75,    -1,
+      75,    47,     5,    12,    73,    13,    -1,    75,    47,     6,
+      12,    73,    13,    -1,    75,    42,    75,    -1,    75,    29,
+      75,    -1,    75,    30,    75,    -1,    75,    31,    75,    -1,
+      75,    32,    75,    -1,    75,    33,    75,    -1,    75,    34,
+      75,    -1,    75,    35,    75,    -1,    75,    40,    75,    -1,
+      75,    41,    75,    -1,    75,    37,    75,    -1,    75,    36,
+      75,    -1,    75,    39,    75,    -1,    75,    38,    75,    -1,
+      75,    43,    74,    -1,    75,    16,    75,    17,    -1,    30,
+      75,    -1,    12,    78,    13,    75,    -1,    12,    75,    13,
+      -1,    75,    45,    -1,    75,    46,    -1,    -1,    75,    -1,
+      77,    18,    80,    -1,    80,    -1,    -1,    78,    16,     4,
+      17,    -1,     6,    -1,    79,    80,    11,    -1,    80,    11,
+      -1,    -1,     5,    19,    78,    -1
 };
 
 /* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
 static const yytype_uint16 yyrline[] =
 {
-       0,   189,   189,   192,   201,   202,   205,   206,   207,   208,
-     223,   224,   225,   229,   233,   234,   251,   272,   275,   278,
-     282,   285,   288,   291,   294,   308,   312,   315,   320,   323,
-     324,   327,   330,   339,   346,   347,   350,   351,   352,   359,
-     368,   369,   372,   375,   376,   377,   378,   379,   380,   381,
-     382,   383,   384,   385,   386,   387,   388,   389,   390,   391,
-     392,   393,   394,   395,   396,   397,   398,   399,   400,   401,
-     402,   403,   404,   405,   408,   409,   412,   421,   422,   425,
-     464,   479,   488,   489,   492
+       0,   190,   190,   193,   202,   203,   206,   207,   208,   209,
+     224,   225,   226,   227,   231,   235,   236,   253,   274,   277,
+     280,   284,   287,   290,   293,   296,   310,   314,   317,   322,
+     325,   326,   329,   332,   341,   348,   349,   352,   353,   354,
+     361,   370,   371,   374,   377,   378,   379,   380,   381,   382,
+     383,   384,   385,   386,   387,   388,   389,   390,   391,   392,
+     393,   394,   395,   396,   397,   398,   399,   400,   401,   402,
+     403,   404,   405,   406,   407,   410,   411,   414,   423,   424,
+     427,   466,   481,   490,   491,   494
 };
 #endif
 
@@ -629,8 +630,8 @@ static const char *const yytname[] =
   "K_A_PAREN", "O_PLUS", "O_MINUS", "O_MUL", "O_DIV", "O_MOD", "O_EQ",
   "O_NEQ", "O_GT", "O_LT", "O_GTE", "O_LTE", "O_LAND", "O_LOR", "O_SET",
   "O_DOT", "O_ACCESS", "O_INC", "O_DEC", "O_METHOD_CALL",
-  "O_IMPLICIT_CAST", "O_EXPLICIT_CAST", "ACCESS_PREC", "CAST", "NEG",
-  "$accept", "program", "stmt_list", "stmt", "struct_keyword",
+  "O_IMPLICIT_CAST", "O_EXPLICIT_CAST", "K_YIELD", "ACCESS_PREC", "CAST",
+  "NEG", "$accept", "program", "stmt_list", "stmt", "struct_keyword",
   "annotation_list", "annotation_begin", "if_begin_scope", "fun_type",
   "while_keyword", "for_keyword", "stmt_else_if_tail", "else_if_keyword",
   "fun_declaration", "stmt_else_tail", "else_keyword", "enum_list",
@@ -649,36 +650,36 @@ static const yytype_uint16 yytoknum[] =
      275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
      285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
      295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307
+     305,   306,   307,   308
 };
 # endif
 
 /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
 static const yytype_uint8 yyr1[] =
 {
-       0,    53,    54,    55,    55,    55,    56,    56,    56,    56,
-      56,    56,    56,    56,    56,    56,    56,    57,    58,    59,
-      60,    61,    62,    63,    64,    64,    64,    65,    66,    67,
-      67,    68,    69,    69,    70,    70,    71,    71,    71,    72,
-      72,    72,    73,    74,    74,    74,    74,    74,    74,    74,
-      74,    74,    74,    74,    74,    74,    74,    74,    74,    74,
-      74,    74,    74,    74,    74,    74,    74,    74,    74,    74,
-      74,    74,    74,    74,    75,    75,    76,    76,    76,    77,
-      77,    78,    78,    78,    79
+       0,    54,    55,    56,    56,    56,    57,    57,    57,    57,
+      57,    57,    57,    57,    57,    57,    57,    57,    58,    59,
+      60,    61,    62,    63,    64,    65,    65,    65,    66,    67,
+      68,    68,    69,    70,    70,    71,    71,    72,    72,    72,
+      73,    73,    73,    74,    75,    75,    75,    75,    75,    75,
+      75,    75,    75,    75,    75,    75,    75,    75,    75,    75,
+      75,    75,    75,    75,    75,    75,    75,    75,    75,    75,
+      75,    75,    75,    75,    75,    76,    76,    77,    77,    77,
+      78,    78,    79,    79,    79,    80
 };
 
 /* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
 static const yytype_uint8 yyr2[] =
 {
        0,     2,     1,     2,     1,     0,     2,     5,     3,     6,
-       3,     2,     7,    11,     6,     6,     8,     1,     3,     1,
-       2,     1,     1,     1,     7,     6,     0,     1,     5,     4,
-       0,     1,     3,     1,     3,     1,     1,     1,     4,     3,
-       1,     0,     1,     1,     4,     4,     4,     1,     1,     2,
-       2,     6,     6,     3,     3,     3,     3,     3,     3,     3,
-       3,     3,     3,     3,     3,     3,     3,     3,     4,     2,
-       4,     3,     2,     2,     0,     1,     3,     1,     0,     4,
-       1,     3,     2,     0,     3
+       3,     2,     2,     7,    11,     6,     6,     8,     1,     3,
+       1,     2,     1,     1,     1,     7,     6,     0,     1,     5,
+       4,     0,     1,     3,     1,     3,     1,     1,     1,     4,
+       3,     1,     0,     1,     1,     4,     4,     4,     1,     1,
+       2,     2,     6,     6,     3,     3,     3,     3,     3,     3,
+       3,     3,     3,     3,     3,     3,     3,     3,     3,     4,
+       2,     4,     3,     2,     2,     0,     1,     3,     1,     0,
+       4,     1,     3,     2,     0,     3
 };
 
 /* YYDEFACT[STATE-NAME] -- Default reduction number in state STATE-NUM.
@@ -686,35 +687,35 @@ static const yytype_uint8 yyr2[] =
    means the default is an error.  */
 static const yytype_uint8 yydefact[] =
 {
-       5,    37,    36,    42,    80,    47,     0,     0,     0,    22,
-      23,    17,     0,     0,     0,     0,    19,     0,     0,     0,
-       0,     2,     4,     0,     0,    41,     0,     0,     0,     0,
-      48,    43,     0,    21,    41,    41,     0,     0,     0,     0,
-       0,     0,     0,     0,    42,     0,    69,    49,    50,     1,
-       3,     0,     0,     0,     0,    40,     0,     0,    74,    35,
-       5,    11,     6,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,    72,
-      73,     0,     0,     0,     0,     0,    71,     0,    10,     0,
-      80,     0,     0,     0,    83,     0,     8,    18,     0,    78,
-       0,    75,     0,     0,     0,    54,    55,    56,    57,    58,
-      59,    60,    64,    63,    66,    65,    61,    62,    53,    67,
-       0,     0,     0,    44,    45,     0,     5,    70,    33,     0,
-      46,    38,     0,     0,     0,     0,     0,    39,     0,    77,
-       0,    74,    34,    68,    41,    41,    79,    20,     0,     0,
-       0,     7,     0,     0,     0,    82,     0,    28,     0,     5,
-       0,     0,     0,    26,    15,    32,    84,    14,    81,     9,
-      76,     0,    74,    51,    52,    27,    30,     0,    12,     0,
-      31,     0,    16,     0,     0,     0,     0,     5,     0,     5,
-       0,     0,     5,     0,     5,    29,     0,    13,     0,    25,
-      24
+       5,    38,    37,    43,    81,    48,     0,     0,     0,    23,
+      24,    18,     0,     0,     0,     0,    20,     0,     0,     0,
+       0,     0,     2,     4,     0,     0,    42,     0,     0,     0,
+       0,    49,    44,     0,    22,    42,    42,     0,     0,     0,
+       0,     0,     0,     0,     0,    43,     0,    70,    50,    51,
+      11,     1,     3,     0,     0,     0,     0,    41,     0,     0,
+      75,    36,     5,    12,     6,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    73,    74,     0,     0,     0,     0,     0,    72,     0,
+      10,     0,    81,     0,     0,     0,    84,     0,     8,    19,
+       0,    79,     0,    76,     0,     0,     0,    55,    56,    57,
+      58,    59,    60,    61,    65,    64,    67,    66,    62,    63,
+      54,    68,     0,     0,     0,    45,    46,     0,     5,    71,
+      34,     0,    47,    39,     0,     0,     0,     0,     0,    40,
+       0,    78,     0,    75,    35,    69,    42,    42,    80,    21,
+       0,     0,     0,     7,     0,     0,     0,    83,     0,    29,
+       0,     5,     0,     0,     0,    27,    16,    33,    85,    15,
+      82,     9,    77,     0,    75,    52,    53,    28,    31,     0,
+      13,     0,    32,     0,    17,     0,     0,     0,     0,     5,
+       0,     5,     0,     0,     5,     0,     5,    30,     0,    14,
+       0,    26,    25
 };
 
 /* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,    20,    21,    22,    23,    24,    25,   126,    26,    27,
-      28,   176,   177,    29,   182,   183,   129,    61,    30,    54,
-      31,    32,   102,   138,    33,   134,   135
+      -1,    21,    22,    23,    24,    25,    26,   128,    27,    28,
+      29,   178,   179,    30,   184,   185,   131,    63,    31,    56,
+      32,    33,   104,   140,    34,   136,   137
 };
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
@@ -722,35 +723,35 @@ static const yytype_int16 yydefgoto[] =
 #define YYPACT_NINF -150
 static const yytype_int16 yypact[] =
 {
-     374,  -150,  -150,    -4,     3,  -150,    18,   106,   402,  -150,
-    -150,  -150,    19,    38,    43,    72,  -150,   402,   402,   402,
-      81,   374,  -150,    83,    94,   402,    91,    92,    95,    12,
-    -150,  -150,   420,    87,   402,   402,   402,   587,    77,     3,
-     453,   100,   102,   102,  -150,    84,     5,     5,     5,  -150,
-    -150,   109,    72,   486,    34,   717,   115,   402,   402,  -150,
-     374,  -150,  -150,   402,   402,   402,   402,   402,   402,   402,
-     402,   402,   402,   402,   402,   402,   402,   402,    72,  -150,
-    -150,    48,   124,    58,    61,   622,  -150,   402,  -150,   128,
-    -150,     9,    89,   402,   130,   104,  -150,  -150,   402,   130,
-     657,   717,   131,   178,   689,   -12,   -12,   564,    -3,   394,
-     769,   769,   788,   788,   788,   788,   125,   125,   745,  -150,
-     132,   137,   149,  -150,  -150,   155,   374,     5,  -150,   107,
-    -150,  -150,   519,   157,    17,   163,   402,   717,    65,  -150,
-     173,   402,  -150,  -150,   402,   402,  -150,  -150,   206,   177,
-     184,  -150,   102,   180,   181,  -150,   552,  -150,   130,   374,
-     183,    71,    74,   186,  -150,  -150,    87,  -150,  -150,  -150,
-    -150,   234,   402,  -150,  -150,  -150,    85,   185,  -150,   194,
-    -150,   203,  -150,   182,   402,   202,   402,   374,   622,   374,
-     622,   262,   374,   290,   374,  -150,   318,  -150,   346,  -150,
-    -150
+     370,  -150,  -150,     5,    14,  -150,    45,   426,   443,  -150,
+    -150,  -150,    93,    62,    88,    96,  -150,   443,   443,   443,
+      97,   109,   370,  -150,   105,   398,   443,   107,   106,   120,
+      21,  -150,  -150,   463,   101,   443,   443,   443,   630,    74,
+      14,   496,   119,   128,   128,  -150,    95,   -10,   -10,   -10,
+    -150,  -150,  -150,   121,    96,   529,    -5,   760,   126,   443,
+     443,  -150,   370,  -150,  -150,   443,   443,   443,   443,   443,
+     443,   443,   443,   443,   443,   443,   443,   443,   443,   443,
+      96,  -150,  -150,    72,   138,    36,    37,   665,  -150,   443,
+    -150,   142,  -150,    11,    76,   443,   146,   110,  -150,  -150,
+     443,   146,   700,   760,   143,    99,   732,   845,   845,    -1,
+     112,   855,   836,   836,    -9,    -9,    -9,    -9,   788,   788,
+     812,  -150,   144,   148,   145,  -150,  -150,   147,   370,   -10,
+    -150,    79,  -150,  -150,   562,   149,    68,   152,   443,   760,
+      63,  -150,   150,   443,  -150,  -150,   443,   443,  -150,  -150,
+     179,   154,   161,  -150,   128,   158,   159,  -150,   595,  -150,
+     146,   370,   160,    66,    73,   163,  -150,  -150,   101,  -150,
+    -150,  -150,  -150,   211,   443,  -150,  -150,  -150,    86,   162,
+    -150,   164,  -150,   176,  -150,   175,   443,   178,   443,   370,
+     665,   370,   665,   243,   370,   275,   370,  -150,   307,  -150,
+     339,  -150,  -150
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -150,  -150,   -44,   -18,  -150,  -150,  -150,  -149,  -150,  -150,
-    -150,  -150,    41,  -150,  -150,  -150,  -150,  -150,  -150,   -28,
-      -6,    -7,  -136,  -150,    -5,  -150,   -85
+    -150,  -150,   -48,   -20,  -150,  -150,  -150,  -149,  -150,  -150,
+    -150,  -150,    -2,  -150,  -150,  -150,  -150,  -150,  -150,   -31,
+      -6,    -7,  -118,  -150,    -4,  -150,   -85
 };
 
 /* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
@@ -759,90 +760,97 @@ static const yytype_int16 yypgoto[] =
 #define YYTABLE_NINF -1
 static const yytype_uint8 yytable[] =
 {
-      37,    40,    38,    50,    63,   160,    83,    84,    34,    45,
-      46,    47,    48,    63,   139,    35,   103,    53,    55,    66,
-      67,    63,   133,    59,    41,    82,    60,    55,    55,    85,
-      36,    78,   153,    79,    80,    81,   179,    91,    92,   192,
-      78,   194,    79,    80,    81,   130,    95,    97,    78,   154,
-     100,   101,    98,   120,   121,    43,   104,   105,   106,   107,
+      38,    41,    52,    39,    85,    86,    65,    65,    99,    46,
+      47,    48,    49,   100,   105,    65,   141,    35,    55,    57,
+      66,    67,    68,    69,    70,   162,    36,    84,    57,    57,
+      87,    69,    61,    80,    80,    62,    81,    82,    83,    93,
+      94,   194,    80,   196,    81,    82,    83,   132,    97,   125,
+     126,   156,   102,   103,   100,   100,   181,    37,   106,   107,
      108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
-     118,   123,   119,   170,   124,    42,    98,    44,   157,    98,
-     127,    49,   148,   158,   173,    50,   132,   174,    51,    98,
-      87,   137,    98,    82,   175,   180,    56,     1,     2,     3,
-      39,     5,   131,    82,    57,    82,     7,    58,    90,     1,
-       2,     3,     4,     5,    89,   171,   161,   162,     7,    13,
-      14,    52,   149,    94,    17,   150,    93,    99,   122,   156,
-      50,    13,    14,   128,   101,   133,    17,    55,    55,    18,
-      19,    63,   141,   191,   144,   193,   136,   166,   196,   145,
-     198,    18,    19,    50,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,    73,    74,   101,   146,    77,    78,   147,
-      79,    80,    81,    50,   155,    50,   152,   188,    50,   190,
-      50,     1,     2,     3,     4,     5,     6,   159,   164,   165,
-       7,   167,   168,   142,   172,   175,   187,   184,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,   185,    17,     1,
-       2,     3,     4,     5,     6,   186,   189,   181,     7,     0,
-       0,   163,     0,    18,    19,     0,     8,     9,    10,    11,
-      12,    13,    14,    15,    16,     0,    17,     1,     2,     3,
-       4,     5,     6,     0,     0,     0,     7,     0,     0,   178,
-       0,    18,    19,     0,     8,     9,    10,    11,    12,    13,
-      14,    15,    16,     0,    17,     1,     2,     3,     4,     5,
-       6,     0,     0,     0,     7,     0,     0,   195,     0,    18,
-      19,     0,     8,     9,    10,    11,    12,    13,    14,    15,
-      16,     0,    17,     1,     2,     3,     4,     5,     6,     0,
-       0,     0,     7,     0,     0,   197,     0,    18,    19,     0,
+     118,   119,   120,   135,   121,   172,   159,   122,   123,   175,
+     150,   160,   129,   155,   100,    52,   176,    89,   134,   133,
+      84,   100,    84,   139,   151,   177,   182,   152,    42,    43,
+      44,    45,     1,     2,     3,     4,     5,     6,    50,    51,
+      53,     7,    58,   173,   144,   163,   164,    84,    59,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,    65,    17,
+      52,   158,    60,    91,    92,    96,   103,    95,   101,    57,
+      57,   193,   124,   195,    18,    19,   198,   130,   200,    20,
+     168,   135,   138,    52,   143,    80,   146,    81,    82,    83,
+     147,   149,   148,   157,   161,   166,   167,   103,   154,   169,
+     170,   174,   177,    52,   186,    52,   183,   187,    52,   190,
+      52,   192,     1,     2,     3,     4,     5,     6,   188,   189,
+       0,     7,   191,     0,   165,     0,     0,     0,     0,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,     0,    17,
+       0,     0,     0,     0,     1,     2,     3,     4,     5,     6,
+       0,     0,     0,     7,    18,    19,   180,     0,     0,    20,
+       0,     8,     9,    10,    11,    12,    13,    14,    15,    16,
+       0,    17,     0,     0,     0,     0,     1,     2,     3,     4,
+       5,     6,     0,     0,     0,     7,    18,    19,   197,     0,
+       0,    20,     0,     8,     9,    10,    11,    12,    13,    14,
+      15,    16,     0,    17,     0,     0,     0,     0,     1,     2,
+       3,     4,     5,     6,     0,     0,     0,     7,    18,    19,
+     199,     0,     0,    20,     0,     8,     9,    10,    11,    12,
+      13,    14,    15,    16,     0,    17,     0,     0,     0,     0,
+       1,     2,     3,     4,     5,     6,     0,     0,     0,     7,
+      18,    19,   201,     0,     0,    20,     0,     8,     9,    10,
+      11,    12,    13,    14,    15,    16,     0,    17,     0,     0,
+       0,     0,     1,     2,     3,     4,     5,     6,     0,     0,
+       0,     7,    18,    19,   202,     0,     0,    20,     0,     8,
+       9,    10,    11,    12,    13,    14,    15,    16,     0,    17,
+       0,     0,     0,     1,     2,     3,     4,     5,     6,     0,
+       0,     0,     7,     0,    18,    19,     0,     0,     0,    20,
        8,     9,    10,    11,    12,    13,    14,    15,    16,     0,
-      17,     1,     2,     3,     4,     5,     6,     0,     0,     0,
-       7,     0,     0,   199,     0,    18,    19,     0,     8,     9,
-      10,    11,    12,    13,    14,    15,    16,     0,    17,     1,
-       2,     3,     4,     5,     6,     0,     0,     0,     7,     0,
-       0,   200,     0,    18,    19,     0,     8,     9,    10,    11,
-      12,    13,    14,    15,    16,     0,    17,     1,     2,     3,
-       4,     5,     6,     0,     0,     0,     7,     0,     0,     0,
-       0,    18,    19,     0,     8,     9,    10,    11,    12,    13,
-      14,    15,    16,     0,    17,     1,     2,     3,    39,     5,
-      63,     0,     0,     0,     7,     0,     0,     0,     0,    18,
-      19,     0,     0,    64,    65,    66,    67,    13,    14,     0,
-       0,    62,    17,     0,     0,     0,    63,    78,     0,    79,
-      80,    81,     0,     0,     0,     0,     0,    18,    19,    64,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    88,    79,    80,    81,     0,    63,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    64,    65,    66,    67,    68,    69,    70,    71,
-      72,    73,    74,    75,    76,    77,    78,    96,    79,    80,
-      81,     0,    63,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    64,    65,    66,    67,    68,
-      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
-     151,    79,    80,    81,     0,    63,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-      76,    77,    78,   169,    79,    80,    81,     0,    63,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      63,    64,    65,    66,    67,    68,    69,    70,    71,    72,
-      73,    74,    75,    76,    77,    78,    67,    79,    80,    81,
-      86,     0,     0,    63,     0,     0,     0,    78,     0,    79,
-      80,    81,     0,     0,     0,     0,    64,    65,    66,    67,
+      17,     1,     2,     3,    40,     5,     0,     0,     0,     0,
+       7,     0,     0,     0,     0,    18,    19,     0,     0,     0,
+      20,     0,     0,    13,    14,    54,     0,     0,    17,     1,
+       2,     3,     4,     5,     0,     0,     0,     0,     7,     0,
+       0,     0,     0,    18,    19,     0,     1,     2,     3,    40,
+       5,    13,    14,     0,     0,     7,    17,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    13,    14,
+       0,    18,    19,    17,    64,     0,     0,     0,     0,    65,
+       0,     0,     0,     0,     0,     0,     0,     0,    18,    19,
+       0,     0,    66,    67,    68,    69,    70,    71,    72,    73,
+      74,    75,    76,    77,    78,    79,    80,    90,    81,    82,
+      83,     0,    65,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    66,    67,    68,    69,    70,
+      71,    72,    73,    74,    75,    76,    77,    78,    79,    80,
+      98,    81,    82,    83,     0,    65,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,    66,    67,
       68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
-      78,     0,    79,    80,    81,   125,     0,     0,    63,     0,
+      78,    79,    80,   153,    81,    82,    83,     0,    65,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    64,    65,    66,    67,    68,    69,    70,    71,    72,
-      73,    74,    75,    76,    77,    78,     0,    79,    80,    81,
-     140,     0,     0,    63,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    64,    65,    66,    67,
-      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
-      78,     0,    79,    80,    81,    63,   143,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    64,    65,
-      66,    67,    68,    69,    70,    71,    72,    73,    74,    75,
-      76,    77,    78,    63,    79,    80,    81,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    64,    65,    66,    67,
-      68,    69,    70,    71,    72,    73,    74,    75,    76,    77,
-      78,    63,    79,    80,    81,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,    73,    74,    63,     0,     0,    78,     0,
-      79,    80,    81,     0,     0,     0,     0,     0,    64,    65,
-      66,    67,    68,     0,    63,    71,    72,    73,    74,     0,
-       0,     0,    78,     0,    79,    80,    81,    64,    65,    66,
-      67,    68,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    78,     0,    79,    80,    81
+       0,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,   171,    81,    82,    83,
+       0,    65,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,     0,
+      81,    82,    83,    88,     0,     0,    65,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,     0,    81,    82,    83,   127,     0,
+       0,    65,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,     0,
+      81,    82,    83,   142,     0,     0,    65,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,     0,    81,    82,    83,    65,   145,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    77,    78,    79,    80,    65,    81,    82,    83,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    65,    81,    82,    83,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    66,    67,    68,
+      69,    70,    71,    72,    73,    74,    75,    76,    65,     0,
+      79,    80,     0,    81,    82,    83,     0,     0,     0,     0,
+       0,    66,    67,    68,    69,    70,    71,    72,    73,    74,
+      75,    76,    65,     0,     0,    80,     0,    81,    82,    83,
+       0,    65,     0,     0,     0,    66,    67,    68,    69,    70,
+       0,    65,    73,    74,    75,    76,    68,    69,     0,    80,
+       0,    81,    82,    83,    66,    67,    68,    69,    80,     0,
+      81,    82,    83,     0,     0,     0,     0,     0,    80,     0,
+      81,    82,    83
 };
 
 #define yypact_value_is_default(Yystate) \
@@ -853,54 +861,55 @@ static const yytype_uint8 yytable[] =
 
 static const yytype_int16 yycheck[] =
 {
-       7,     8,     7,    21,    16,   141,    34,    35,    12,    15,
-      17,    18,    19,    16,    99,    12,    60,    24,    25,    31,
-      32,    16,     5,    11,     5,    16,    14,    34,    35,    36,
-      12,    43,    15,    45,    46,    47,   172,    42,    43,   188,
-      43,   190,    45,    46,    47,    36,    52,    13,    43,   134,
-      57,    58,    18,     5,     6,    12,    63,    64,    65,    66,
+       7,     8,    22,     7,    35,    36,    16,    16,    13,    15,
+      17,    18,    19,    18,    62,    16,   101,    12,    25,    26,
+      29,    30,    31,    32,    33,   143,    12,    16,    35,    36,
+      37,    32,    11,    43,    43,    14,    45,    46,    47,    43,
+      44,   190,    43,   192,    45,    46,    47,    36,    54,    13,
+      13,   136,    59,    60,    18,    18,   174,    12,    65,    66,
       67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
-      77,    13,    78,   158,    13,    37,    18,     5,    13,    18,
-      87,     0,   126,    18,    13,   103,    93,    13,     5,    18,
-      13,    98,    18,    16,     9,    10,     5,     3,     4,     5,
-       6,     7,    13,    16,    12,    16,    12,    12,     6,     3,
-       4,     5,     6,     7,    14,   159,   144,   145,    12,    25,
-      26,    27,    15,    14,    30,    18,    42,    12,     4,   136,
-     148,    25,    26,     5,   141,     5,    30,   144,   145,    45,
-      46,    16,    11,   187,    12,   189,    42,   152,   192,    12,
-     194,    45,    46,   171,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,   172,    17,    42,    43,    14,
-      45,    46,    47,   191,    11,   193,    19,   184,   196,   186,
-     198,     3,     4,     5,     6,     7,     8,    14,    11,     5,
-      12,    11,    11,    15,    11,     9,    14,    12,    20,    21,
-      22,    23,    24,    25,    26,    27,    28,    13,    30,     3,
-       4,     5,     6,     7,     8,    12,    14,   176,    12,    -1,
-      -1,    15,    -1,    45,    46,    -1,    20,    21,    22,    23,
-      24,    25,    26,    27,    28,    -1,    30,     3,     4,     5,
-       6,     7,     8,    -1,    -1,    -1,    12,    -1,    -1,    15,
-      -1,    45,    46,    -1,    20,    21,    22,    23,    24,    25,
-      26,    27,    28,    -1,    30,     3,     4,     5,     6,     7,
-       8,    -1,    -1,    -1,    12,    -1,    -1,    15,    -1,    45,
-      46,    -1,    20,    21,    22,    23,    24,    25,    26,    27,
-      28,    -1,    30,     3,     4,     5,     6,     7,     8,    -1,
-      -1,    -1,    12,    -1,    -1,    15,    -1,    45,    46,    -1,
+      77,    78,    79,     5,    80,   160,    13,     5,     6,    13,
+     128,    18,    89,    15,    18,   105,    13,    13,    95,    13,
+      16,    18,    16,   100,    15,     9,    10,    18,     5,    37,
+      12,     5,     3,     4,     5,     6,     7,     8,    11,     0,
+       5,    12,     5,   161,    15,   146,   147,    16,    12,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    16,    30,
+     150,   138,    12,    14,     6,    14,   143,    42,    12,   146,
+     147,   189,     4,   191,    45,    46,   194,     5,   196,    50,
+     154,     5,    42,   173,    11,    43,    12,    45,    46,    47,
+      12,    14,    17,    11,    14,    11,     5,   174,    19,    11,
+      11,    11,     9,   193,    12,   195,   178,    13,   198,   186,
+     200,   188,     3,     4,     5,     6,     7,     8,    12,    14,
+      -1,    12,    14,    -1,    15,    -1,    -1,    -1,    -1,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    -1,    30,
+      -1,    -1,    -1,    -1,     3,     4,     5,     6,     7,     8,
+      -1,    -1,    -1,    12,    45,    46,    15,    -1,    -1,    50,
+      -1,    20,    21,    22,    23,    24,    25,    26,    27,    28,
+      -1,    30,    -1,    -1,    -1,    -1,     3,     4,     5,     6,
+       7,     8,    -1,    -1,    -1,    12,    45,    46,    15,    -1,
+      -1,    50,    -1,    20,    21,    22,    23,    24,    25,    26,
+      27,    28,    -1,    30,    -1,    -1,    -1,    -1,     3,     4,
+       5,     6,     7,     8,    -1,    -1,    -1,    12,    45,    46,
+      15,    -1,    -1,    50,    -1,    20,    21,    22,    23,    24,
+      25,    26,    27,    28,    -1,    30,    -1,    -1,    -1,    -1,
+       3,     4,     5,     6,     7,     8,    -1,    -1,    -1,    12,
+      45,    46,    15,    -1,    -1,    50,    -1,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    -1,    30,    -1,    -1,
+      -1,    -1,     3,     4,     5,     6,     7,     8,    -1,    -1,
+      -1,    12,    45,    46,    15,    -1,    -1,    50,    -1,    20,
+      21,    22,    23,    24,    25,    26,    27,    28,    -1,    30,
+      -1,    -1,    -1,     3,     4,     5,     6,     7,     8,    -1,
+      -1,    -1,    12,    -1,    45,    46,    -1,    -1,    -1,    50,
       20,    21,    22,    23,    24,    25,    26,    27,    28,    -1,
-      30,     3,     4,     5,     6,     7,     8,    -1,    -1,    -1,
-      12,    -1,    -1,    15,    -1,    45,    46,    -1,    20,    21,
-      22,    23,    24,    25,    26,    27,    28,    -1,    30,     3,
-       4,     5,     6,     7,     8,    -1,    -1,    -1,    12,    -1,
-      -1,    15,    -1,    45,    46,    -1,    20,    21,    22,    23,
-      24,    25,    26,    27,    28,    -1,    30,     3,     4,     5,
-       6,     7,     8,    -1,    -1,    -1,    12,    -1,    -1,    -1,
-      -1,    45,    46,    -1,    20,    21,    22,    23,    24,    25,
-      26,    27,    28,    -1,    30,     3,     4,     5,     6,     7,
-      16,    -1,    -1,    -1,    12,    -1,    -1,    -1,    -1,    45,
-      46,    -1,    -1,    29,    30,    31,    32,    25,    26,    -1,
-      -1,    11,    30,    -1,    -1,    -1,    16,    43,    -1,    45,
-      46,    47,    -1,    -1,    -1,    -1,    -1,    45,    46,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      40,    41,    42,    43,    11,    45,    46,    47,    -1,    16,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      30,     3,     4,     5,     6,     7,    -1,    -1,    -1,    -1,
+      12,    -1,    -1,    -1,    -1,    45,    46,    -1,    -1,    -1,
+      50,    -1,    -1,    25,    26,    27,    -1,    -1,    30,     3,
+       4,     5,     6,     7,    -1,    -1,    -1,    -1,    12,    -1,
+      -1,    -1,    -1,    45,    46,    -1,     3,     4,     5,     6,
+       7,    25,    26,    -1,    -1,    12,    30,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    25,    26,
+      -1,    45,    46,    30,    11,    -1,    -1,    -1,    -1,    16,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    45,    46,
       -1,    -1,    29,    30,    31,    32,    33,    34,    35,    36,
       37,    38,    39,    40,    41,    42,    43,    11,    45,    46,
       47,    -1,    16,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
@@ -911,32 +920,38 @@ static const yytype_int16 yycheck[] =
       31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
       41,    42,    43,    11,    45,    46,    47,    -1,    16,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      16,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    32,    45,    46,    47,
-      13,    -1,    -1,    16,    -1,    -1,    -1,    43,    -1,    45,
-      46,    47,    -1,    -1,    -1,    -1,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    -1,    45,    46,    47,    13,    -1,    -1,    16,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    29,    30,    31,    32,    33,    34,    35,    36,    37,
-      38,    39,    40,    41,    42,    43,    -1,    45,    46,    47,
-      13,    -1,    -1,    16,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    -1,    45,    46,    47,    16,    17,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    30,
-      31,    32,    33,    34,    35,    36,    37,    38,    39,    40,
-      41,    42,    43,    16,    45,    46,    47,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    31,    32,
-      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
-      43,    16,    45,    46,    47,    -1,    -1,    -1,    -1,    -1,
+      38,    39,    40,    41,    42,    43,    11,    45,    46,    47,
+      -1,    16,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    16,    -1,    -1,    43,    -1,
-      45,    46,    47,    -1,    -1,    -1,    -1,    -1,    29,    30,
-      31,    32,    33,    -1,    16,    36,    37,    38,    39,    -1,
-      -1,    -1,    43,    -1,    45,    46,    47,    29,    30,    31,
-      32,    33,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    43,    -1,    45,    46,    47
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    -1,
+      45,    46,    47,    13,    -1,    -1,    16,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    -1,    45,    46,    47,    13,    -1,
+      -1,    16,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    29,    30,    31,    32,    33,    34,
+      35,    36,    37,    38,    39,    40,    41,    42,    43,    -1,
+      45,    46,    47,    13,    -1,    -1,    16,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    -1,    45,    46,    47,    16,    17,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    40,    41,    42,    43,    16,    45,    46,    47,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,
+      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
+      40,    41,    42,    43,    16,    45,    46,    47,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,    16,    -1,
+      42,    43,    -1,    45,    46,    47,    -1,    -1,    -1,    -1,
+      -1,    29,    30,    31,    32,    33,    34,    35,    36,    37,
+      38,    39,    16,    -1,    -1,    43,    -1,    45,    46,    47,
+      -1,    16,    -1,    -1,    -1,    29,    30,    31,    32,    33,
+      -1,    16,    36,    37,    38,    39,    31,    32,    -1,    43,
+      -1,    45,    46,    47,    29,    30,    31,    32,    43,    -1,
+      45,    46,    47,    -1,    -1,    -1,    -1,    -1,    43,    -1,
+      45,    46,    47
 };
 
 /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
@@ -945,25 +960,25 @@ static const yytype_uint8 yystos[] =
 {
        0,     3,     4,     5,     6,     7,     8,    12,    20,    21,
       22,    23,    24,    25,    26,    27,    28,    30,    45,    46,
-      54,    55,    56,    57,    58,    59,    61,    62,    63,    66,
-      71,    73,    74,    77,    12,    12,    12,    74,    77,     6,
-      74,     5,    37,    12,     5,    73,    74,    74,    74,     0,
-      56,     5,    27,    74,    72,    74,     5,    12,    12,    11,
-      14,    70,    11,    16,    29,    30,    31,    32,    33,    34,
-      35,    36,    37,    38,    39,    40,    41,    42,    43,    45,
-      46,    47,    16,    72,    72,    74,    13,    13,    11,    14,
-       6,    77,    77,    42,    14,    73,    11,    13,    18,    12,
-      74,    74,    75,    55,    74,    74,    74,    74,    74,    74,
-      74,    74,    74,    74,    74,    74,    74,    74,    74,    73,
-       5,     6,     4,    13,    13,    13,    60,    74,     5,    69,
-      36,    13,    74,     5,    78,    79,    42,    74,    76,    79,
-      13,    11,    15,    17,    12,    12,    17,    14,    55,    15,
-      18,    11,    19,    15,    79,    11,    74,    13,    18,    14,
-      75,    72,    72,    15,    11,     5,    77,    11,    11,    11,
-      79,    55,    11,    13,    13,     9,    64,    65,    15,    75,
-      10,    65,    67,    68,    12,    13,    12,    14,    74,    14,
-      74,    55,    60,    55,    60,    15,    55,    15,    55,    15,
-      15
+      50,    55,    56,    57,    58,    59,    60,    62,    63,    64,
+      67,    72,    74,    75,    78,    12,    12,    12,    75,    78,
+       6,    75,     5,    37,    12,     5,    74,    75,    75,    75,
+      11,     0,    57,     5,    27,    75,    73,    75,     5,    12,
+      12,    11,    14,    71,    11,    16,    29,    30,    31,    32,
+      33,    34,    35,    36,    37,    38,    39,    40,    41,    42,
+      43,    45,    46,    47,    16,    73,    73,    75,    13,    13,
+      11,    14,     6,    78,    78,    42,    14,    74,    11,    13,
+      18,    12,    75,    75,    76,    56,    75,    75,    75,    75,
+      75,    75,    75,    75,    75,    75,    75,    75,    75,    75,
+      75,    74,     5,     6,     4,    13,    13,    13,    61,    75,
+       5,    70,    36,    13,    75,     5,    79,    80,    42,    75,
+      77,    80,    13,    11,    15,    17,    12,    12,    17,    14,
+      56,    15,    18,    11,    19,    15,    80,    11,    75,    13,
+      18,    14,    76,    73,    73,    15,    11,     5,    78,    11,
+      11,    11,    80,    56,    11,    13,    13,     9,    65,    66,
+      15,    76,    10,    66,    68,    69,    12,    13,    12,    14,
+      75,    14,    75,    56,    61,    56,    61,    15,    56,    15,
+      56,    15,    15
 };
 
 #define yyerrok		(yyerrstatus = 0)
@@ -1784,13 +1799,13 @@ yyreduce:
     {
         case 2:
 /* Line 1792 of yacc.c  */
-#line 189 "bs.y"
+#line 190 "bs.y"
     { BS_BUILD((yyval.vProgram), CreateProgram()); (yyval.vProgram)->SetStmtList((yyvsp[(1) - (1)].vStmtList)); }
     break;
 
   case 3:
 /* Line 1792 of yacc.c  */
-#line 192 "bs.y"
+#line 193 "bs.y"
     { 
                     (yyval.vStmtList) = (yyvsp[(1) - (2)].vStmtList);
                     BS_CHECKLIST((yyvsp[(1) - (2)].vStmtList));
@@ -1804,37 +1819,37 @@ yyreduce:
 
   case 4:
 /* Line 1792 of yacc.c  */
-#line 201 "bs.y"
+#line 202 "bs.y"
     { (yyval.vStmtList) = BS_GlobalBuilder->CreateStmtList(); (yyval.vStmtList)->SetStmt((yyvsp[(1) - (1)].vStmt)); }
     break;
 
   case 5:
 /* Line 1792 of yacc.c  */
-#line 202 "bs.y"
+#line 203 "bs.y"
     { (yyval.vStmtList) = BS_GlobalBuilder->CreateStmtList(); }
     break;
 
   case 6:
 /* Line 1792 of yacc.c  */
-#line 205 "bs.y"
+#line 206 "bs.y"
     { BS_BUILD((yyval.vStmt), BuildStmtExp((yyvsp[(1) - (2)].vExp))); }
     break;
 
   case 7:
 /* Line 1792 of yacc.c  */
-#line 206 "bs.y"
+#line 207 "bs.y"
     { BS_BUILD((yyval.vStmt), BuildExternVariable((yyvsp[(2) - (5)].vExp),(yyvsp[(4) - (5)].vExp))); }
     break;
 
   case 8:
 /* Line 1792 of yacc.c  */
-#line 207 "bs.y"
+#line 208 "bs.y"
     { BS_BUILD((yyval.vStmt), BuildDeclarationWithAnnotation((yyvsp[(1) - (3)].vAnnotations), (yyvsp[(2) - (3)].vExp))); }
     break;
 
   case 9:
 /* Line 1792 of yacc.c  */
-#line 209 "bs.y"
+#line 210 "bs.y"
     {
                 StmtExp* declaration = nullptr;
                 BS_BUILD(declaration, BuildExternVariable((yyvsp[(3) - (6)].vExp), (yyvsp[(5) - (6)].vExp)));
@@ -1853,41 +1868,47 @@ yyreduce:
 
   case 10:
 /* Line 1792 of yacc.c  */
-#line 223 "bs.y"
+#line 224 "bs.y"
     { BS_BUILD((yyval.vStmt), BuildStmtReturn((yyvsp[(2) - (3)].vExp))); }
     break;
 
   case 11:
 /* Line 1792 of yacc.c  */
-#line 224 "bs.y"
-    {BS_BUILD((yyval.vStmt), BindFunImplementation((yyvsp[(1) - (2)].vStmtFunDec), (yyvsp[(2) - (2)].vStmtList)));}
+#line 225 "bs.y"
+    { BS_BUILD((yyval.vStmt), BuildStmtYield()); }
     break;
 
   case 12:
 /* Line 1792 of yacc.c  */
 #line 226 "bs.y"
+    {BS_BUILD((yyval.vStmt), BindFunImplementation((yyvsp[(1) - (2)].vStmtFunDec), (yyvsp[(2) - (2)].vStmtList)));}
+    break;
+
+  case 13:
+/* Line 1792 of yacc.c  */
+#line 228 "bs.y"
     { 
                BS_BUILD((yyval.vStmt), BuildStmtWhile((yyvsp[(3) - (7)].vExp), (yyvsp[(6) - (7)].vStmtList)));
         }
     break;
 
-  case 13:
+  case 14:
 /* Line 1792 of yacc.c  */
-#line 230 "bs.y"
+#line 232 "bs.y"
     {
                BS_BUILD((yyval.vStmt), BuildStmtFor((yyvsp[(3) - (11)].vExp),(yyvsp[(5) - (11)].vExp),(yyvsp[(7) - (11)].vExp),(yyvsp[(10) - (11)].vStmtList)));
         }
     break;
 
-  case 14:
+  case 15:
 /* Line 1792 of yacc.c  */
-#line 233 "bs.y"
+#line 235 "bs.y"
     { BS_BUILD((yyval.vStmt), BuildStmtStructDef((yyvsp[(2) - (6)].identifierText), (yyvsp[(4) - (6)].vArgList))); }
     break;
 
-  case 15:
+  case 16:
 /* Line 1792 of yacc.c  */
-#line 235 "bs.y"
+#line 237 "bs.y"
     { 
             if (BS_GlobalBuilder->GetSymbolTable()->GetTypeByName((yyvsp[(2) - (6)].identifierText)) == nullptr)
             {
@@ -1906,9 +1927,9 @@ yyreduce:
         }
     break;
 
-  case 16:
+  case 17:
 /* Line 1792 of yacc.c  */
-#line 252 "bs.y"
+#line 254 "bs.y"
     { 
                     if ((yyvsp[(8) - (8)].vStmtIfElse) != nullptr && (yyvsp[(7) - (8)].vStmtIfElse) != nullptr)
                     {
@@ -1929,51 +1950,51 @@ yyreduce:
                  }
     break;
 
-  case 17:
+  case 18:
 /* Line 1792 of yacc.c  */
-#line 272 "bs.y"
+#line 274 "bs.y"
     { BS_BUILD((yyval.vFrameInfo), StartNewFrame()); }
     break;
 
-  case 18:
+  case 19:
 /* Line 1792 of yacc.c  */
-#line 275 "bs.y"
+#line 277 "bs.y"
     {  BS_BUILD((yyval.vAnnotations), EndAnnotations((yyvsp[(1) - (3)].vAnnotations), (yyvsp[(2) - (3)].vExpList))); }
     break;
 
-  case 19:
+  case 20:
 /* Line 1792 of yacc.c  */
-#line 278 "bs.y"
+#line 280 "bs.y"
     { BS_BUILD((yyval.vAnnotations), BeginAnnotations()); }
     break;
 
-  case 20:
+  case 21:
 /* Line 1792 of yacc.c  */
-#line 282 "bs.y"
+#line 284 "bs.y"
     { BS_BUILD((yyval.vFrameInfo), StartNewFrame()); }
     break;
 
-  case 21:
+  case 22:
 /* Line 1792 of yacc.c  */
-#line 285 "bs.y"
+#line 287 "bs.y"
     { (yyval.vTypeDesc) = (yyvsp[(1) - (1)].vTypeDesc); if ((yyval.vTypeDesc) == nullptr) { BS_parseerror("Syntax error. Invalid function type.");YYERROR; }; if (!BS_GlobalBuilder->StartNewFunction((yyval.vTypeDesc))) {BS_parseerror("cannot declare function within a function"); YYERROR;} }
     break;
 
-  case 22:
+  case 23:
 /* Line 1792 of yacc.c  */
-#line 288 "bs.y"
+#line 290 "bs.y"
     { BS_GlobalBuilder->StartNewFrame(); }
     break;
 
-  case 23:
+  case 24:
 /* Line 1792 of yacc.c  */
-#line 291 "bs.y"
+#line 293 "bs.y"
     { BS_GlobalBuilder->StartNewFrame(); }
     break;
 
-  case 24:
+  case 25:
 /* Line 1792 of yacc.c  */
-#line 295 "bs.y"
+#line 297 "bs.y"
     {
                         (yyval.vStmtIfElse) = (yyvsp[(1) - (7)].vStmtIfElse);
                         BS_CHECKLIST((yyvsp[(1) - (7)].vStmtIfElse));
@@ -1989,55 +2010,55 @@ yyreduce:
                     }
     break;
 
-  case 25:
+  case 26:
 /* Line 1792 of yacc.c  */
-#line 309 "bs.y"
+#line 311 "bs.y"
     {
                         (yyval.vStmtIfElse) = BS_GlobalBuilder->BuildStmtIfElse((yyvsp[(3) - (6)].vExp), (yyvsp[(5) - (6)].vStmtList), nullptr, (yyvsp[(4) - (6)].vFrameInfo));
                    }
     break;
 
-  case 26:
+  case 27:
 /* Line 1792 of yacc.c  */
-#line 312 "bs.y"
+#line 314 "bs.y"
     { (yyval.vStmtIfElse) = nullptr; }
     break;
 
-  case 27:
+  case 28:
 /* Line 1792 of yacc.c  */
-#line 315 "bs.y"
+#line 317 "bs.y"
     { //pop previous frame
                               BS_GlobalBuilder->PopFrame();  
                             }
     break;
 
-  case 28:
+  case 29:
 /* Line 1792 of yacc.c  */
-#line 320 "bs.y"
+#line 322 "bs.y"
     {BS_BUILD((yyval.vStmtFunDec), BuildStmtFunDec((yyvsp[(4) - (5)].vArgList), (yyvsp[(1) - (5)].vTypeDesc), (yyvsp[(2) - (5)].identifierText)));}
     break;
 
-  case 29:
+  case 30:
 /* Line 1792 of yacc.c  */
-#line 323 "bs.y"
+#line 325 "bs.y"
     { BS_BUILD((yyval.vStmtIfElse), BuildStmtIfElse(nullptr, (yyvsp[(3) - (4)].vStmtList), nullptr, (yyvsp[(1) - (4)].vFrameInfo))); }
     break;
 
-  case 30:
+  case 31:
 /* Line 1792 of yacc.c  */
-#line 324 "bs.y"
+#line 326 "bs.y"
     { (yyval.vStmtIfElse) = nullptr; }
     break;
 
-  case 31:
+  case 32:
 /* Line 1792 of yacc.c  */
-#line 327 "bs.y"
+#line 329 "bs.y"
     { BS_GlobalBuilder->PopFrame(); BS_BUILD((yyval.vFrameInfo), StartNewFrame()); }
     break;
 
-  case 32:
+  case 33:
 /* Line 1792 of yacc.c  */
-#line 330 "bs.y"
+#line 332 "bs.y"
     {
                 Pegasus::BlockScript::EnumNode* enumNode = BS_GlobalBuilder->GetSymbolTable()->NewEnumNode(); 
                 enumNode->mIdd = (yyvsp[(3) - (3)].identifierText);
@@ -2049,9 +2070,9 @@ yyreduce:
           }
     break;
 
-  case 33:
+  case 34:
 /* Line 1792 of yacc.c  */
-#line 339 "bs.y"
+#line 341 "bs.y"
     {
                 Pegasus::BlockScript::EnumNode* enumNode = BS_GlobalBuilder->GetSymbolTable()->NewEnumNode(); 
                 enumNode->mIdd = (yyvsp[(1) - (1)].identifierText);
@@ -2059,42 +2080,42 @@ yyreduce:
           }
     break;
 
-  case 34:
+  case 35:
 /* Line 1792 of yacc.c  */
-#line 346 "bs.y"
+#line 348 "bs.y"
     { (yyval.vStmtList) = (yyvsp[(2) - (3)].vStmtList); }
     break;
 
-  case 35:
+  case 36:
 /* Line 1792 of yacc.c  */
-#line 347 "bs.y"
+#line 349 "bs.y"
     { (yyval.vStmtList) = nullptr; }
     break;
 
-  case 36:
+  case 37:
 /* Line 1792 of yacc.c  */
-#line 350 "bs.y"
+#line 352 "bs.y"
     { BS_BUILD((yyval.vExp), BuildImmInt((yyvsp[(1) - (1)].integerValue))); }
     break;
 
-  case 37:
+  case 38:
 /* Line 1792 of yacc.c  */
-#line 351 "bs.y"
+#line 353 "bs.y"
     { BS_BUILD((yyval.vExp), BuildImmFloat((yyvsp[(1) - (1)].floatValue))); }
     break;
 
-  case 38:
+  case 39:
 /* Line 1792 of yacc.c  */
-#line 353 "bs.y"
+#line 355 "bs.y"
     {
             //figure out size at compile time!
             BS_BUILD((yyval.vExp), BuildImmInt((yyvsp[(3) - (4)].vTypeDesc)->GetByteSize()));
           }
     break;
 
-  case 39:
+  case 40:
 /* Line 1792 of yacc.c  */
-#line 359 "bs.y"
+#line 361 "bs.y"
     {
                 (yyval.vExpList) = (yyvsp[(1) - (3)].vExpList);
                 BS_CHECKLIST((yyvsp[(1) - (3)].vExpList));
@@ -2106,225 +2127,225 @@ yyreduce:
          }
     break;
 
-  case 40:
-/* Line 1792 of yacc.c  */
-#line 368 "bs.y"
-    { (yyval.vExpList) = BS_GlobalBuilder->CreateExpList(); (yyval.vExpList)->SetExp((yyvsp[(1) - (1)].vExp)); }
-    break;
-
   case 41:
 /* Line 1792 of yacc.c  */
-#line 369 "bs.y"
-    { (yyval.vExpList) = BS_GlobalBuilder->CreateExpList(); }
+#line 370 "bs.y"
+    { (yyval.vExpList) = BS_GlobalBuilder->CreateExpList(); (yyval.vExpList)->SetExp((yyvsp[(1) - (1)].vExp)); }
     break;
 
   case 42:
 /* Line 1792 of yacc.c  */
-#line 372 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildIdd((yyvsp[(1) - (1)].identifierText))); }
+#line 371 "bs.y"
+    { (yyval.vExpList) = BS_GlobalBuilder->CreateExpList(); }
     break;
 
   case 43:
 /* Line 1792 of yacc.c  */
-#line 375 "bs.y"
-    { (yyval.vExp) = (yyvsp[(1) - (1)].vExp); }
+#line 374 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildIdd((yyvsp[(1) - (1)].identifierText))); }
     break;
 
   case 44:
 /* Line 1792 of yacc.c  */
-#line 376 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildFunCall((yyvsp[(3) - (4)].vExpList), (yyvsp[(1) - (4)].identifierText))); }
+#line 377 "bs.y"
+    { (yyval.vExp) = (yyvsp[(1) - (1)].vExp); }
     break;
 
   case 45:
 /* Line 1792 of yacc.c  */
-#line 377 "bs.y"
+#line 378 "bs.y"
     { BS_BUILD((yyval.vExp), BuildFunCall((yyvsp[(3) - (4)].vExpList), (yyvsp[(1) - (4)].identifierText))); }
     break;
 
   case 46:
 /* Line 1792 of yacc.c  */
-#line 378 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildStaticArrayDec((yyvsp[(3) - (4)].vTypeDesc))); }
+#line 379 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildFunCall((yyvsp[(3) - (4)].vExpList), (yyvsp[(1) - (4)].identifierText))); }
     break;
 
   case 47:
 /* Line 1792 of yacc.c  */
-#line 379 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildStrImm((yyvsp[(1) - (1)].identifierText))); }
+#line 380 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildStaticArrayDec((yyvsp[(3) - (4)].vTypeDesc))); }
     break;
 
   case 48:
 /* Line 1792 of yacc.c  */
-#line 380 "bs.y"
-    { (yyval.vExp) = (yyvsp[(1) - (1)].vExp); }
+#line 381 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildStrImm((yyvsp[(1) - (1)].identifierText))); }
     break;
 
   case 49:
 /* Line 1792 of yacc.c  */
-#line 381 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildUnop((yyvsp[(1) - (2)].token), (yyvsp[(2) - (2)].vExp))); }
+#line 382 "bs.y"
+    { (yyval.vExp) = (yyvsp[(1) - (1)].vExp); }
     break;
 
   case 50:
 /* Line 1792 of yacc.c  */
-#line 382 "bs.y"
+#line 383 "bs.y"
     { BS_BUILD((yyval.vExp), BuildUnop((yyvsp[(1) - (2)].token), (yyvsp[(2) - (2)].vExp))); }
     break;
 
   case 51:
 /* Line 1792 of yacc.c  */
-#line 383 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildMethodCall((yyvsp[(1) - (6)].vExp), (yyvsp[(3) - (6)].identifierText), (yyvsp[(5) - (6)].vExpList))); }
+#line 384 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildUnop((yyvsp[(1) - (2)].token), (yyvsp[(2) - (2)].vExp))); }
     break;
 
   case 52:
 /* Line 1792 of yacc.c  */
-#line 384 "bs.y"
+#line 385 "bs.y"
     { BS_BUILD((yyval.vExp), BuildMethodCall((yyvsp[(1) - (6)].vExp), (yyvsp[(3) - (6)].identifierText), (yyvsp[(5) - (6)].vExpList))); }
     break;
 
   case 53:
 /* Line 1792 of yacc.c  */
-#line 385 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
+#line 386 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildMethodCall((yyvsp[(1) - (6)].vExp), (yyvsp[(3) - (6)].identifierText), (yyvsp[(5) - (6)].vExpList))); }
     break;
 
   case 54:
 /* Line 1792 of yacc.c  */
-#line 386 "bs.y"
+#line 387 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 55:
 /* Line 1792 of yacc.c  */
-#line 387 "bs.y"
+#line 388 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 56:
 /* Line 1792 of yacc.c  */
-#line 388 "bs.y"
+#line 389 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 57:
 /* Line 1792 of yacc.c  */
-#line 389 "bs.y"
+#line 390 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 58:
 /* Line 1792 of yacc.c  */
-#line 390 "bs.y"
+#line 391 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 59:
 /* Line 1792 of yacc.c  */
-#line 391 "bs.y"
+#line 392 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 60:
 /* Line 1792 of yacc.c  */
-#line 392 "bs.y"
+#line 393 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 61:
 /* Line 1792 of yacc.c  */
-#line 393 "bs.y"
+#line 394 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 62:
 /* Line 1792 of yacc.c  */
-#line 394 "bs.y"
+#line 395 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 63:
 /* Line 1792 of yacc.c  */
-#line 395 "bs.y"
+#line 396 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 64:
 /* Line 1792 of yacc.c  */
-#line 396 "bs.y"
+#line 397 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 65:
 /* Line 1792 of yacc.c  */
-#line 397 "bs.y"
+#line 398 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 66:
 /* Line 1792 of yacc.c  */
-#line 398 "bs.y"
+#line 399 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 67:
 /* Line 1792 of yacc.c  */
-#line 399 "bs.y"
+#line 400 "bs.y"
     { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 68:
 /* Line 1792 of yacc.c  */
-#line 400 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (4)].vExp), O_ACCESS, (yyvsp[(3) - (4)].vExp))); }
+#line 401 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (3)].vExp), (yyvsp[(2) - (3)].token), (yyvsp[(3) - (3)].vExp))); }
     break;
 
   case 69:
 /* Line 1792 of yacc.c  */
-#line 401 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildUnop((yyvsp[(1) - (2)].token), (yyvsp[(2) - (2)].vExp))); }
+#line 402 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildBinop((yyvsp[(1) - (4)].vExp), O_ACCESS, (yyvsp[(3) - (4)].vExp))); }
     break;
 
   case 70:
 /* Line 1792 of yacc.c  */
-#line 402 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildExplicitCast((yyvsp[(4) - (4)].vExp), (yyvsp[(2) - (4)].vTypeDesc))); }
+#line 403 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildUnop((yyvsp[(1) - (2)].token), (yyvsp[(2) - (2)].vExp))); }
     break;
 
   case 71:
 /* Line 1792 of yacc.c  */
-#line 403 "bs.y"
-    { (yyval.vExp) = (yyvsp[(2) - (3)].vExp); }
+#line 404 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildExplicitCast((yyvsp[(4) - (4)].vExp), (yyvsp[(2) - (4)].vTypeDesc))); }
     break;
 
   case 72:
 /* Line 1792 of yacc.c  */
-#line 404 "bs.y"
-    { BS_BUILD((yyval.vExp), BuildUnopPost((yyvsp[(1) - (2)].vExp), (yyvsp[(2) - (2)].token))); }
+#line 405 "bs.y"
+    { (yyval.vExp) = (yyvsp[(2) - (3)].vExp); }
     break;
 
   case 73:
 /* Line 1792 of yacc.c  */
-#line 405 "bs.y"
+#line 406 "bs.y"
     { BS_BUILD((yyval.vExp), BuildUnopPost((yyvsp[(1) - (2)].vExp), (yyvsp[(2) - (2)].token))); }
     break;
 
   case 74:
 /* Line 1792 of yacc.c  */
-#line 408 "bs.y"
-    { (yyval.vExp) = nullptr; }
+#line 407 "bs.y"
+    { BS_BUILD((yyval.vExp), BuildUnopPost((yyvsp[(1) - (2)].vExp), (yyvsp[(2) - (2)].token))); }
     break;
 
   case 75:
 /* Line 1792 of yacc.c  */
-#line 409 "bs.y"
-    { (yyval.vExp) = (yyvsp[(1) - (1)].vExp); }
+#line 410 "bs.y"
+    { (yyval.vExp) = nullptr; }
     break;
 
   case 76:
 /* Line 1792 of yacc.c  */
-#line 412 "bs.y"
+#line 411 "bs.y"
+    { (yyval.vExp) = (yyvsp[(1) - (1)].vExp); }
+    break;
+
+  case 77:
+/* Line 1792 of yacc.c  */
+#line 414 "bs.y"
     {
                 (yyval.vArgList) = (yyvsp[(1) - (3)].vArgList);
                 BS_CHECKLIST((yyvsp[(1) - (3)].vArgList));
@@ -2336,21 +2357,21 @@ yyreduce:
          }
     break;
 
-  case 77:
+  case 78:
 /* Line 1792 of yacc.c  */
-#line 421 "bs.y"
+#line 423 "bs.y"
     { (yyval.vArgList) = BS_GlobalBuilder->CreateArgList(); (yyval.vArgList)->SetArgDec((yyvsp[(1) - (1)].vArgDec)); }
     break;
 
-  case 78:
+  case 79:
 /* Line 1792 of yacc.c  */
-#line 422 "bs.y"
+#line 424 "bs.y"
     { (yyval.vArgList) = BS_GlobalBuilder->CreateArgList(); }
     break;
 
-  case 79:
+  case 80:
 /* Line 1792 of yacc.c  */
-#line 425 "bs.y"
+#line 427 "bs.y"
     { 
 				Pegasus::BlockScript::TypeDesc* resultType = nullptr;
 				if ((yyvsp[(1) - (4)].vTypeDesc)->GetModifier() != Pegasus::BlockScript::TypeDesc::M_ARRAY)
@@ -2392,9 +2413,9 @@ yyreduce:
               }
     break;
 
-  case 80:
+  case 81:
 /* Line 1792 of yacc.c  */
-#line 464 "bs.y"
+#line 466 "bs.y"
     {                
                 TypeDesc* typeDesc = BS_GlobalBuilder->GetTypeByName((yyvsp[(1) - (1)].identifierText));
                 if (typeDesc != nullptr)
@@ -2410,9 +2431,9 @@ yyreduce:
             }
     break;
 
-  case 81:
+  case 82:
 /* Line 1792 of yacc.c  */
-#line 479 "bs.y"
+#line 481 "bs.y"
     {
                 (yyval.vArgList) = (yyvsp[(1) - (3)].vArgList);
                 BS_CHECKLIST((yyvsp[(1) - (3)].vArgList));
@@ -2424,27 +2445,27 @@ yyreduce:
          }
     break;
 
-  case 82:
+  case 83:
 /* Line 1792 of yacc.c  */
-#line 488 "bs.y"
+#line 490 "bs.y"
     { (yyval.vArgList) = BS_GlobalBuilder->CreateArgList(); (yyval.vArgList)->SetArgDec((yyvsp[(1) - (2)].vArgDec)); }
     break;
 
-  case 83:
+  case 84:
 /* Line 1792 of yacc.c  */
-#line 489 "bs.y"
+#line 491 "bs.y"
     { (yyval.vArgList) = BS_GlobalBuilder->CreateArgList(); }
     break;
 
-  case 84:
+  case 85:
 /* Line 1792 of yacc.c  */
-#line 492 "bs.y"
+#line 494 "bs.y"
     { BS_BUILD((yyval.vArgDec), BuildArgDec((yyvsp[(1) - (3)].identifierText), (yyvsp[(3) - (3)].vTypeDesc))); }
     break;
 
 
 /* Line 1792 of yacc.c  */
-#line 2448 "bs.parser.cpp"
+#line 2469 "bs.parser.cpp"
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -2676,7 +2697,7 @@ yyreturn:
 
 
 /* Line 2055 of yacc.c  */
-#line 495 "bs.y"
+#line 497 "bs.y"
          
 
 //***************************************************//
@@ -80,8 +80,8 @@
     //***************************************************//
 %}
 
-// expect 172 reduce/shift warnings due to grammar ambiguity
-%expect 172
+// expect 180 reduce/shift warnings due to grammar ambiguity
+%expect 180
 
 %union {
     int    token;
@@ -143,6 +143,7 @@
 %token <token> O_METHOD_CALL
 %token <token> O_IMPLICIT_CAST
 %token <token> O_EXPLICIT_CAST
+%token <token> K_YIELD
 %type <vFrameInfo> if_begin_scope
 %type <vFrameInfo> else_keyword
 %type <vFrameInfo> struct_keyword 
@@ -221,6 +222,7 @@ stmt    : exp K_SEMICOLON { BS_BUILD($$, BuildStmtExp($1)); }
                 }
           }
         | K_RETURN exp K_SEMICOLON { BS_BUILD($$, BuildStmtReturn($2)); }
+        | K_YIELD K_SEMICOLON { BS_BUILD($$, BuildStmtYield()); }
         | fun_declaration fun_stmt_list  {BS_BUILD($$, BindFunImplementation($1, $2));}
         | while_keyword K_L_PAREN exp K_R_PAREN K_L_BRAC stmt_list K_R_BRAC 
         { 
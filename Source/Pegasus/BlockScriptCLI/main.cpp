@@ -19,6 +19,9 @@
 #include "Pegasus/BlockScript/Container.h"
 #include "Pegasus/BlockScript/BlockScriptManager.h"
 #include "Pegasus/BlockScript/EventListeners.h"
+#include "Pegasus/BlockScript/BsVmProfiler.h"
+#include "Pegasus/BlockScript/IBytecodeCache.h"
+#include "Pegasus/Utils/String.h"
 #include <stdio.h>
 
 using namespace Pegasus::Io;
@@ -75,6 +78,53 @@ int printfloat(float f)
     return printf("%f",f);
 }
 
+//! Cache of the compiled script, stored next to it with a 'c' appended to its path
+class FileBytecodeCache : public Pegasus::BlockScript::IBytecodeCache
+{
+public:
+    FileBytecodeCache(IOManager* ioManager, const char* scriptPath) : mIoManager(ioManager)
+    {
+        mPath[0] = '\0';
+        if (Pegasus::Utils::Strlen(scriptPath) + 1 < IOManager::MAX_FILEPATH_LENGTH)
+        {
+            Pegasus::Utils::Strcat(mPath, scriptPath);
+            Pegasus::Utils::Strcat(mPath, "c");
+        }
+    }
+
+    virtual bool Read(const char** outBuffer, int& outBufferSize)
+    {
+        if (mPath[0] == '\0' || mIoManager->MapFileToBuffer(mPath, mFileBuffer, GetGlobalAllocator()) != ERR_NONE)
+        {
+            return false;
+        }
+        *outBuffer = mFileBuffer.GetBuffer();
+        outBufferSize = mFileBuffer.GetFileSize();
+        return true;
+    }
+
+    virtual void ReleaseRead(const char* buffer)
+    {
+        mFileBuffer.DestroyBuffer();
+    }
+
+    virtual void Write(const void* buffer, int bufferSize)
+    {
+        if (mPath[0] != '\0')
+        {
+            FileBuffer fb;
+            fb.OwnBuffer(GetGlobalAllocator(), static_cast<char*>(const_cast<void*>(buffer)), bufferSize);
+            mIoManager->SaveFileToBuffer(mPath, fb);
+            fb.ForgetBuffer();
+        }
+    }
+
+private:
+    IOManager* mIoManager;
+    FileBuffer mFileBuffer;
+    char mPath[IOManager::MAX_FILEPATH_LENGTH];
+};
+
 struct Options
 {
 public:
@@ -82,12 +132,16 @@ public:
     bool printAst;
     bool runScript;
     bool requestHelp;
+    bool profile;
+    bool useCache;
     char* fileToParse;
     Options() : 
         printAssembly(false),
         printAst(false),
         runScript(true),
         requestHelp(false),
+        profile(false),
+        useCache(false),
         fileToParse(nullptr)
     {
     }
@@ -105,7 +159,11 @@ bool ParseCommandLineOptions(char** argv, int argc, Options& output)
         char* candidate = argv[i];
         if (candidate[0] == '-')
         {
-            if (candidate[1] == 'a')
+            if (Pegasus::Utils::Strcmp(candidate, "--profile") == 0 || Pegasus::Utils::Strcmp(candidate, "-p") == 0)
+            {
+                output.profile = true;
+            }
+            else if (candidate[1] == 'a')
             {
                 output.printAssembly = true;
             }
@@ -121,6 +179,10 @@ bool ParseCommandLineOptions(char** argv, int argc, Options& output)
             {
                 output.requestHelp = true;
             }
+            else if (candidate[1] == 'c')
+            {
+                output.useCache = true;
+            }
             else
             {
                 return false;
@@ -151,6 +213,8 @@ void printHelp()
     printf("-a print assembly.\n");
     printf("-t print the abstract syntax tree.\n");
     printf("-n Do not attempt to run the program.\n");
+    printf("-p, --profile print the instructions and time spent per function and per line.\n");
+    printf("-c load the compiled script from <bs_script>c when still valid, store it there otherwise, and print the compilation time.\n");
 }
 
 
@@ -189,11 +253,27 @@ int main(int argc, char* argv[])
             );
             Pegasus::BlockScript::BsVmState vmState;
             vmState.Initialize(GetGlobalAllocator());
+            Pegasus::BlockScript::BsVmProfiler profiler;
+            if (opts.profile)
+            {
+                profiler.Initialize(GetGlobalAllocator());
+                vmState.SetProfiler(&profiler);
+            }
 		    if (err == ERR_NONE)
             {
                 Pegasus::BlockScript::BlockScript* bs = bsManager.CreateBlockScript();
                 bs->AddCompilerEventListener(&gCompilerEventListener);
+                FileBytecodeCache bytecodeCache(&mgr, argv[1]);
+                if (opts.useCache)
+                {
+                    bs->SetBytecodeCache(&bytecodeCache);
+                }
                 bool res = bs->Compile(&fb);
+                bs->SetBytecodeCache(nullptr);
+                if (opts.useCache)
+                {
+                    printf("%s in %f ms\n", bs->IsLoadedFromCache() ? "loaded from cache" : "compiled", bs->GetCompilationTime());
+                }
 	
                 if (!res)
                 {
@@ -225,6 +305,15 @@ int main(int argc, char* argv[])
                     if (opts.runScript)
                     {
                         bs->Run(&vmState);
+                        if (opts.profile)
+                        {
+#if PEGASUS_ENABLE_BS_PROFILER
+                            printf("\n");
+                            profiler.PrintReport(printstr, printint, printfloat);
+#else
+                            printf("\nThe blockscript profiler is disabled in this build (PEGASUS_ENABLE_BS_PROFILER).\n");
+#endif
+                        }
                     }
                 }
 		    	
@@ -15,15 +15,19 @@
 #include "Pegasus/Utils/String.h"
 #include "Pegasus/Core/Io.h"
 #include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Memory/FrameAllocator.h"
 #include "Pegasus/Core/Shared/LogChannel.h"
 #include "Pegasus/Core/Log.h"
 #include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Core/Thread.h"
+#include "Pegasus/Core/Time.h"
 #include "Pegasus/BlockScript/Container.h"
 #include "Pegasus/BlockScript/BlockScriptManager.h"
 
 #include <sstream>
 #include <string>
 #include <iostream>
+#include <string.h>
 
 using namespace std;
 using namespace Pegasus::Io;
@@ -112,7 +116,8 @@ const struct TestScript { const char* script; const char* output; } gTestScripts
     { "Branching.bs",      "OutputBranching.txt" },    
     { "Loops.bs",          "OutputLoops.txt" },
     { "2dArray.bs",        "Output2dArray.txt" },
-    { "Math.bs",           "OutputMath.txt" }
+    { "Math.bs",           "OutputMath.txt" },
+    { "BatchExecute.bs",   "OutputBatchExecute.txt" }
 };
 //
 
@@ -128,6 +133,38 @@ const struct TestScript { const char* script; const char* output; } gTestScripts
 // **** **** ****
 /////
 
+// **** Parallel execution test ****
+// Calls Simulate(seed : int, steps : int) on many vm states at once, one thread per state.
+// Every result must match the same call executed on a single thread, on a separate state.
+// **** **** ****
+const char* gParallelTestScript = "Parallel.bs";
+#define PARALLEL_TEST_STATES 32
+#define PARALLEL_TEST_ROUNDS 8
+/////
+
+// **** Batch execution test ****
+// Calls Update(p : Particle) and Score(p : Particle) on many instances with one vm state.
+// Every result must match the same call executed one instance at a time, on a separate state.
+// Each round is a frame: the lanes work in memory of the frame allocator, recycled as the frames advance.
+// **** **** ****
+const char* gBatchTestScript = "Batch.bs";
+#define BATCH_TEST_INSTANCES 100
+#define BATCH_TEST_ROUNDS 4
+/////
+
+// **** Yield test ****
+// Runs the script and calls Simulate(n : int), resuming the execution at each frame until it completes.
+// With frames of 0 ticks every yield statement suspends the execution, so the work must be spread across one frame
+// per yield plus the last one. With long frames it must complete in the frame that started it.
+// Every result must match the same call executed without yield deadline, on a separate state.
+// While Simulate is suspended, Peek(k : int) executed on top of it must complete and match the same call on the separate state.
+// **** **** ****
+const char* gYieldTestScript = "Yield.bs";
+#define YIELD_TEST_GLOBAL_YIELDS 16
+#define YIELD_TEST_LONG_FRAME_SECONDS 10.0
+#define YIELD_TEST_ROUNDS 4
+/////
+
 
 void LogHandler(LogChannel channel, const char * msg)
 {
@@ -251,6 +288,243 @@ bool RunTest(IOManager& ioMgr, const char* script, const char* outputFile, bool
 }
 
 
+//! Test executing the functions of a compiled script from c++
+//! \return true if the test passes
+typedef bool (*ScriptTestFunc)(Pegasus::BlockScript::BlockScript* bs);
+
+//! Compiles a script and runs a test on it
+bool RunScriptTest(IOManager& ioMgr, const char* script, ScriptTestFunc testFunc)
+{
+    Pegasus::BlockScript::BlockScriptManager bsManager(GetGlobalAllocator());
+    Pegasus::BlockScript::BlockScript* bs = bsManager.CreateBlockScript();
+    FileBuffer filebuffer;
+    IoError err = ioMgr.OpenFileToBuffer(script, filebuffer, true, GetGlobalAllocator());
+    bool result = false;
+    if (err == Pegasus::Io::ERR_NONE)
+    {
+        if (bs->Compile(&filebuffer))
+        {
+            result = testFunc(bs);
+        }
+        else
+        {
+            cout << "Compilation Error." << std::endl;
+        }
+    }
+    else
+    {
+        cout << "Unable to open script file: " << script << std::endl;
+    }
+
+    gSs->Reset();
+    bsManager.DestroyBlockScript(bs);
+    return result;
+}
+
+
+bool ParallelTest(Pegasus::BlockScript::BlockScript* bs)
+{
+    const char* argTypes[] = { "int", "int" };
+    FunBindPoint bindPoint = bs->GetFunctionBindPoint("Simulate", argTypes, 2);
+    bool result = bindPoint != FUN_INVALID_BIND_POINT;
+
+    Pegasus::BlockScript::BsVmState parallelStates[PARALLEL_TEST_STATES];
+    Pegasus::BlockScript::BsVmState referenceStates[PARALLEL_TEST_STATES];
+    Pegasus::BlockScript::BsVmState* parallelStatePtrs[PARALLEL_TEST_STATES];
+    for (int i = 0; i < PARALLEL_TEST_STATES; ++i)
+    {
+        parallelStates[i].Initialize(GetGlobalAllocator());
+        referenceStates[i].Initialize(GetGlobalAllocator());
+        bs->Run(&parallelStates[i]);
+        bs->Run(&referenceStates[i]);
+        parallelStatePtrs[i] = &parallelStates[i];
+    }
+
+    //the globals of each state accumulate between rounds, so a state executed twice or mixed with another one changes the results
+    struct SimulateArgs { int seed; int steps; } args[PARALLEL_TEST_STATES];
+    float parallelResults[PARALLEL_TEST_STATES];
+    for (int round = 0; result && round < PARALLEL_TEST_ROUNDS; ++round)
+    {
+        for (int i = 0; i < PARALLEL_TEST_STATES; ++i)
+        {
+            args[i].seed = i + round * PARALLEL_TEST_STATES;
+            args[i].steps = 16 + (i * 7 + round) % 48;
+        }
+
+        int executed = bs->ExecuteFunctionParallel(
+            parallelStatePtrs, PARALLEL_TEST_STATES, bindPoint,
+            args, sizeof(args[0]),
+            parallelResults, sizeof(parallelResults[0]),
+            PARALLEL_TEST_STATES
+        );
+        result = executed == PARALLEL_TEST_STATES;
+
+        for (int i = 0; result && i < PARALLEL_TEST_STATES; ++i)
+        {
+            float referenceResult = 0.0f;
+            result = bs->ExecuteFunction(&referenceStates[i], bindPoint, &args[i], sizeof(args[i]), &referenceResult, sizeof(referenceResult))
+                  && referenceResult == parallelResults[i];
+        }
+    }
+    return result;
+}
+
+
+bool BatchTest(Pegasus::BlockScript::BlockScript* bs)
+{
+    const char* argTypes[] = { "Particle" };
+    FunBindPoint updateBindPoint = bs->GetFunctionBindPoint("Update", argTypes, 1);
+    FunBindPoint scoreBindPoint = bs->GetFunctionBindPoint("Score", argTypes, 1);
+    bool result = updateBindPoint != FUN_INVALID_BIND_POINT && scoreBindPoint != FUN_INVALID_BIND_POINT;
+
+    Pegasus::BlockScript::BsVmState batchState;
+    Pegasus::BlockScript::BsVmState referenceState;
+    batchState.Initialize(GetGlobalAllocator());
+    referenceState.Initialize(GetGlobalAllocator());
+    bs->Run(&batchState);
+    bs->Run(&referenceState);
+
+    struct Particle { float pos[4]; float vel[4]; float life; int id; };
+    Particle particles[BATCH_TEST_INSTANCES];
+    Particle referenceParticles[BATCH_TEST_INSTANCES];
+    int scores[BATCH_TEST_INSTANCES];
+    for (int i = 0; i < BATCH_TEST_INSTANCES; ++i)
+    {
+        Particle& p = particles[i];
+        for (int c = 0; c < 4; ++c)
+        {
+            p.pos[c] = static_cast<float>((i * 7 + c * 3) % 11) * 0.1f - 0.5f;
+            p.vel[c] = static_cast<float>((i * 5 + c) % 9) * 0.5f - 2.0f;
+        }
+        p.life = static_cast<float>(i % 13) * 0.1f;
+        p.id = i;
+        referenceParticles[i] = p;
+    }
+
+    //update in place, the particles of a round are the inputs of the next one
+    for (int round = 0; result && round < BATCH_TEST_ROUNDS; ++round)
+    {
+        Pegasus::Memory::FrameAllocator::AdvanceFrame();
+        result = bs->ExecuteFunctionBatch(&batchState, updateBindPoint, particles, sizeof(Particle), particles, sizeof(Particle), BATCH_TEST_INSTANCES)
+              && bs->ExecuteFunctionBatch(&batchState, scoreBindPoint, particles, sizeof(Particle), scores, sizeof(int), BATCH_TEST_INSTANCES)
+              && Pegasus::Memory::GetFrameAllocator()->GetFrameUsage() > 0;
+
+        for (int i = 0; result && i < BATCH_TEST_INSTANCES; ++i)
+        {
+            Particle referenceResult;
+            result = bs->ExecuteFunction(&referenceState, updateBindPoint, &referenceParticles[i], sizeof(Particle), &referenceResult, sizeof(Particle));
+            referenceParticles[i] = referenceResult;
+            result = result && memcmp(&referenceParticles[i], &particles[i], sizeof(Particle)) == 0;
+        }
+
+        for (int i = 0; result && i < BATCH_TEST_INSTANCES; ++i)
+        {
+            int referenceScore = 0;
+            result = bs->ExecuteFunction(&referenceState, scoreBindPoint, &referenceParticles[i], sizeof(Particle), &referenceScore, sizeof(int))
+                  && referenceScore == scores[i];
+        }
+    }
+    return result;
+}
+
+
+//! Starts a frame of a yield test: the yield statements reached after frameTicks suspend the execution
+static void BeginYieldFrame(Pegasus::BlockScript::BsVmState& state, unsigned long long frameTicks)
+{
+    state.SetYieldDeadline(Pegasus::Core::GetPerformanceCounter() + frameTicks);
+}
+
+//! Resumes a suspended execution at each frame until it completes
+//! \return the count of frames the execution is spread across, including the one that started it. 0 if it fails
+static int CompleteOverFrames(Pegasus::BlockScript::BlockScript* bs, Pegasus::BlockScript::BsVmState& state, unsigned long long frameTicks, void* output, int outputSize)
+{
+    int frameCount = 1;
+    while (state.GetExecutionState() == Pegasus::BlockScript::BsVmState::Suspended)
+    {
+        BeginYieldFrame(state, frameTicks);
+        if (!bs->ResumeExecution(&state, output, outputSize))
+        {
+            return 0;
+        }
+        ++frameCount;
+    }
+    return frameCount;
+}
+
+bool YieldTest(Pegasus::BlockScript::BlockScript* bs)
+{
+    const char* argTypes[] = { "int" };
+    FunBindPoint bindPoint = bs->GetFunctionBindPoint("Simulate", argTypes, 1);
+    FunBindPoint peekBindPoint = bs->GetFunctionBindPoint("Peek", argTypes, 1);
+    bool result = bindPoint != FUN_INVALID_BIND_POINT && peekBindPoint != FUN_INVALID_BIND_POINT;
+
+    //a frame of 0 ticks suspends at every yield statement, a long frame completes without suspending
+    const unsigned long long longFrameTicks = static_cast<unsigned long long>(YIELD_TEST_LONG_FRAME_SECONDS / Pegasus::Core::GetPerformanceCounterPeriod());
+    Pegasus::BlockScript::BsVmState yieldState;
+    Pegasus::BlockScript::BsVmState longFrameState;
+    Pegasus::BlockScript::BsVmState referenceState;
+    yieldState.Initialize(GetGlobalAllocator());
+    longFrameState.Initialize(GetGlobalAllocator());
+    referenceState.Initialize(GetGlobalAllocator());
+
+    //the global scope suspends at each iteration of its loop
+    BeginYieldFrame(yieldState, 0);
+    BeginYieldFrame(longFrameState, longFrameTicks);
+    bs->Run(&yieldState);
+    bs->Run(&longFrameState);
+    bs->Run(&referenceState);
+
+    //functions cannot run while the global scope is suspended, the globals are not complete
+    int peekArg = 0;
+    float peekResult = 0.0f;
+    result = result && !bs->ExecuteFunctionWhileSuspended(&yieldState, peekBindPoint, &peekArg, sizeof(peekArg), &peekResult, sizeof(peekResult));
+
+    result = result
+          && CompleteOverFrames(bs, yieldState, 0, nullptr, 0) == YIELD_TEST_GLOBAL_YIELDS + 1
+          && CompleteOverFrames(bs, longFrameState, longFrameTicks, nullptr, 0) == 1;
+
+    //the total global accumulates between rounds, so a resumed call that runs twice or not at all changes the results
+    for (int round = 0; result && round < YIELD_TEST_ROUNDS; ++round)
+    {
+        int n = 3 + round * 5;
+        float yieldResult[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float longFrameResult[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        float referenceResult[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        BeginYieldFrame(yieldState, 0);
+        result = bs->ExecuteFunction(&yieldState, bindPoint, &n, sizeof(n), yieldResult, sizeof(yieldResult))
+              && yieldState.GetExecutionState() == Pegasus::BlockScript::BsVmState::Suspended;
+
+        //other executions fail until the suspended one completes
+        result = result && !bs->ExecuteFunction(&yieldState, bindPoint, &n, sizeof(n), referenceResult, sizeof(referenceResult));
+
+        //except the ones executed on top of it, which complete and leave it suspended
+        float referencePeekResult = -1.0f;
+        peekArg = round;
+        peekResult = 0.0f;
+        result = result
+              && bs->ExecuteFunctionWhileSuspended(&yieldState, peekBindPoint, &peekArg, sizeof(peekArg), &peekResult, sizeof(peekResult))
+              && yieldState.GetExecutionState() == Pegasus::BlockScript::BsVmState::Suspended
+              && bs->ExecuteFunction(&referenceState, peekBindPoint, &peekArg, sizeof(peekArg), &referencePeekResult, sizeof(referencePeekResult))
+              && peekResult == referencePeekResult;
+
+        //each iteration of Simulate yields twice, the last frame returns from the call
+        result = result && CompleteOverFrames(bs, yieldState, 0, yieldResult, sizeof(yieldResult)) == 2 * n + 1;
+
+        BeginYieldFrame(longFrameState, longFrameTicks);
+        result = result
+              && bs->ExecuteFunction(&longFrameState, bindPoint, &n, sizeof(n), longFrameResult, sizeof(longFrameResult))
+              && CompleteOverFrames(bs, longFrameState, longFrameTicks, longFrameResult, sizeof(longFrameResult)) == 1;
+
+        result = result
+              && bs->ExecuteFunction(&referenceState, bindPoint, &n, sizeof(n), referenceResult, sizeof(referenceResult))
+              && memcmp(yieldResult, referenceResult, sizeof(yieldResult)) == 0
+              && memcmp(longFrameResult, referenceResult, sizeof(longFrameResult)) == 0;
+    }
+
+    return result;
+}
+
+
 int main(int argc, const char** argv)
 {
 #if PEGASUS_ENABLE_ASSERT
@@ -307,6 +581,27 @@ int main(int argc, const char** argv)
             cout << " Result: " << ( res ? "Pass" : "Fail")  <<  std::endl;
             cout << std::endl;
         }
+
+        cout << " Testing: " << gParallelTestScript << " (" << PARALLEL_TEST_STATES << " states in parallel)" << std::endl;
+        bool parallelRes = RunScriptTest(mgr, gParallelTestScript, ParallelTest);
+        passTests += parallelRes ? 1 : 0;
+        ++total;
+        cout << " Result: " << ( parallelRes ? "Pass" : "Fail")  <<  std::endl;
+        cout << std::endl;
+
+        cout << " Testing: " << gBatchTestScript << " (" << BATCH_TEST_INSTANCES << " instances in batch)" << std::endl;
+        bool batchRes = RunScriptTest(mgr, gBatchTestScript, BatchTest);
+        passTests += batchRes ? 1 : 0;
+        ++total;
+        cout << " Result: " << ( batchRes ? "Pass" : "Fail")  <<  std::endl;
+        cout << std::endl;
+
+        cout << " Testing: " << gYieldTestScript << " (resumed at every yield)" << std::endl;
+        bool yieldRes = RunScriptTest(mgr, gYieldTestScript, YieldTest);
+        passTests += yieldRes ? 1 : 0;
+        ++total;
+        cout << " Result: " << ( yieldRes ? "Pass" : "Fail")  <<  std::endl;
+        cout << std::endl;
     }
 
     if (gCmdLineOpts.mSingleScript == nullptr)
@@ -314,5 +609,6 @@ int main(int argc, const char** argv)
         cout <<  "Passed " <<  passTests << " out of " << total << std::endl;
     }
 
+    Pegasus::Core::ShutdownParallelJobs();
     return 0;
 }
@@ -16,128 +16,93 @@
 #include "Pegasus/Core/Log.h"
 #include "Pegasus/Allocator/Alloc.h"
 #include "Pegasus/Utils/String.h"
+#include "Pegasus/Utils/Memcpy.h"
 #include "stdio.h" //using the windows libraries to produce file IO
 #if PEGASUS_USE_NATIVE_IO_CALLS
-#if PEGASUS_PLATFORM_WINDOWS
-#include <windows.h>
-#endif
+#include "../Source/Pegasus/Core/Platform/NativeIo.h"
 #endif
 
 namespace Pegasus {
 namespace Io {
 
-//implementation using native windows api calls
+//implementation using the native platform layer (see Platform/Io_*.cpp)
 #if PEGASUS_USE_NATIVE_IO_CALLS
 namespace internal
 {
-#if PEGASUS_PLATFORM_WINDOWS
 
-Pegasus::Io::IoError NativeOpenFileToBuffer(const char* path, Pegasus::Io::FileBuffer& outputBuffer, bool allocateBuffer, Alloc::IAllocator* alloc)
+//! Size of the chunks used to read a whole file, so single reads never exceed the 32 bit limits of the native APIs
+static const int READ_CHUNK_SIZE = 64 * 1024 * 1024;
+
+//! Reads a whole file opened with NativeOpenFileForRead into a buffer, then closes it
+Pegasus::Io::IoError NativeReadOpenedFileToBuffer(const char* path, NativeFileHandle fileHandle, unsigned long long fullSize,
+                                                  Pegasus::Io::FileBuffer& outputBuffer, bool allocateBuffer, Alloc::IAllocator* alloc)
 {
-    // Load the file
-    HANDLE fileHandle = CreateFile(
-        path,
-        GENERIC_READ,
-        FILE_SHARE_READ,
-        NULL, //win32 security attributes
-        OPEN_EXISTING,
-        FILE_ATTRIBUTE_NORMAL,
-        NULL //offset structures
-    );
-    if (fileHandle != INVALID_HANDLE_VALUE)
+    IoError err = ERR_NONE;
+    if (fullSize > 0x7FFFFFFF)
     {
-        LARGE_INTEGER fileSize;
-        fileSize.LowPart = 0;
-        fileSize.HighPart = 0;
-        GetFileSizeEx(fileHandle, &fileSize);
-        if (fileSize.HighPart != 0)
+        //file buffers are addressed with 32 bit sizes, use a FileStream or MapFileToBuffer for bigger files
+        PG_LOG('FILE', "File too big to be loaded in a buffer, use a file stream instead \"%s\"", path);
+        NativeCloseFile(fileHandle);
+        return Pegasus::Io::ERR_FILE_SIZE_TOO_BIG;
+    }
+
+    int fileSize = static_cast<int>(fullSize);
+    if (allocateBuffer)
+    {
+        outputBuffer.OwnBuffer(
+            alloc,
+            PG_NEW_ARRAY(alloc, -1, "file buffer", Pegasus::Alloc::PG_MEM_PERM, char, fileSize),
+            fileSize
+        );
+    }
+    else if (fileSize > outputBuffer.GetBufferSize())
+    {
+        NativeCloseFile(fileHandle);
+        return Pegasus::Io::ERR_BUFFER_TOO_SMALL;
+    }
+
+    outputBuffer.SetFileSize(fileSize);
+    int totalBytesRead = 0;
+    while (err == ERR_NONE && totalBytesRead < fileSize)
+    {
+        const int bytesLeft = fileSize - totalBytesRead;
+        int bytesRead = 0;
+        err = NativeReadFile(fileHandle, outputBuffer.GetBuffer() + totalBytesRead, bytesLeft < READ_CHUNK_SIZE ? bytesLeft : READ_CHUNK_SIZE, bytesRead);
+        if (bytesRead == 0)
         {
-            //pegasus does not support files that are bigger than 4 gb!
-            PG_FAILSTR("Pegasus does not support files bigger than 4 gb!");
-            CloseHandle(fileHandle);
-            return Pegasus::Io::ERR_FILE_SIZE_TOO_BIG;
+            break;
         }
-        else
+        totalBytesRead += bytesRead;
+    }
+    NativeCloseFile(fileHandle);
+
+    PG_ASSERTSTR(err != ERR_NONE || totalBytesRead == fileSize, "bytes read do not match bytes requested, file %s", path);
+    if (err != ERR_NONE || totalBytesRead != fileSize)
+    {
+        if (allocateBuffer)
         {
-            if (allocateBuffer)
-            {
-                outputBuffer.OwnBuffer(
-                    alloc,
-                    PG_NEW_ARRAY(alloc, -1, "file buffer", Pegasus::Alloc::PG_MEM_PERM, char, fileSize.LowPart),
-                    fileSize.LowPart
-                );
-            }
-            else if (outputBuffer.GetFileSize() > outputBuffer.GetBufferSize())
-            {
-                CloseHandle(fileHandle);
-                return Pegasus::Io::ERR_BUFFER_TOO_SMALL;
-            }
-
-            outputBuffer.SetFileSize(fileSize.LowPart);
-            DWORD bytesRead = 0;
-            ReadFile(fileHandle, outputBuffer.GetBuffer(), outputBuffer.GetFileSize(), &bytesRead, NULL); 
-            
-            PG_ASSERTSTR(bytesRead == outputBuffer.GetFileSize(), "bytes read do not match bytes requested, file %s", path);
-            CloseHandle(fileHandle);
-            if (allocateBuffer && GetLastError() != 0)
-            {
-                outputBuffer.DestroyBuffer();
-                return Pegasus::Io::ERR_READING_FILE;
-            }
+            outputBuffer.DestroyBuffer();
         }
+        return Pegasus::Io::ERR_READING_FILE;
     }
-    else
-    {
-        PG_LOG('FILE', "File not found \"%s\"", path);
 
-        return Pegasus::Io::ERR_FILE_NOT_FOUND;
-    }
     PG_LOG('FILE', "Successfully opened file \"%s\"", path);
 
     return Pegasus::Io::ERR_NONE;
 }
 
-Pegasus::Io::IoError NativeSaveBufferToFile(const char* path, const Pegasus::Io::FileBuffer& outputBuffer)
+Pegasus::Io::IoError NativeOpenFileToBuffer(const char* path, Pegasus::Io::FileBuffer& outputBuffer, bool allocateBuffer, Alloc::IAllocator* alloc)
 {
-    HANDLE fileHandle = CreateFile(
-                            path,
-                            GENERIC_WRITE,
-                            0,
-                            NULL,
-                            CREATE_ALWAYS,
-                            FILE_ATTRIBUTE_NORMAL,
-                            NULL
-                        );
-
-    if (fileHandle == INVALID_HANDLE_VALUE)
-    {
-        PG_LOG('FILE', "IO Error (CreateFile): %s", path);
-        return Pegasus::Io::ERR_OPENING_FILE;
-    }
-    
-    DWORD bytesWritten = 0;
-    BOOL res = WriteFile (
-        fileHandle,
-        outputBuffer.GetBuffer(),
-        outputBuffer.GetFileSize(),
-        &bytesWritten,
-        NULL
-    );
-    SetEndOfFile(fileHandle);
-    CloseHandle(fileHandle);
-    DWORD lastErr = GetLastError();
-    if (!res || (GetLastError() != 0 && GetLastError() != ERROR_ALREADY_EXISTS))
+    NativeFileHandle fileHandle = nullptr;
+    unsigned long long fullSize = 0;
+    IoError err = NativeOpenFileForRead(path, fileHandle, fullSize);
+    if (err != ERR_NONE)
     {
-        PG_LOG('FILE', "IO Error (WriteFile): %s", path);
-        return Pegasus::Io::ERR_WRITING_FILE;
+        return err;
     }
-    PG_LOG('FILE', "Saved: %s", path);
-    return Pegasus::Io::ERR_NONE;
+    return NativeReadOpenedFileToBuffer(path, fileHandle, fullSize, outputBuffer, allocateBuffer, alloc);
 }
 
-#else
-    #error No native implementation for IO functions in current platform!
-#endif //platform selection
 }// namespace internal
 #endif //PEGASUS_USE_NATIVE_CALLS
 
@@ -148,27 +113,63 @@ IOManager::IOManager(const char* rootPath)
     // Configure the path
     sprintf_s(mRootDirectory, MAX_FILEPATH_LENGTH, "%s", rootPath); // Hardcode imported for now
     PG_LOG('FILE', "Asset root set to \"%s\"", mRootDirectory);
+    mCacheDirectory[0] = '\0';
 }
 
 //----------------------------------------------------------------------------------------
 
-IOManager::~IOManager()
+void IOManager::SetCacheRoot(const char* cachePath)
 {
+    mCacheDirectory[0] = '\0';
+    if (cachePath == nullptr || cachePath[0] == '\0')
+    {
+        return;
+    }
+
+#if PEGASUS_USE_NATIVE_IO_CALLS
+    if (internal::NativeCreateDirectory(cachePath) != ERR_NONE)
+    {
+        return;
+    }
+#endif
+    sprintf_s(mCacheDirectory, MAX_FILEPATH_LENGTH, "%s", cachePath);
+    PG_LOG('FILE', "Cache root set to \"%s\"", mCacheDirectory);
 }
 
 //----------------------------------------------------------------------------------------
 
-IoError IOManager::OpenFileToBuffer(const char* relativePath, FileBuffer& outputBuffer, bool allocateBuffer, Alloc::IAllocator* alloc)
+IOManager::~IOManager()
 {
-    char pathBuffer[MAX_FILEPATH_LENGTH];
+}
+
+//----------------------------------------------------------------------------------------
 
+bool IOManager::BuildFullPath(const char* relativePath, char* outPath, FileRoot root) const
+{
     // Configure the path
-    pathBuffer[0] = '\0';
+    outPath[0] = '\0';
+    const char* rootDirectory = root == ROOT_CACHE ? mCacheDirectory : mRootDirectory;
+    if (rootDirectory[0] == '\0')
+    {
+        return false;
+    }
     PG_ASSERTSTR(Pegasus::Utils::Strlen(relativePath) < MAX_FILEPATH_LENGTH, "Path str is too little! be prepared for some mem stomps!");
-    Pegasus::Utils::Strcat(pathBuffer, mRootDirectory);
-    pathBuffer[MAX_FILEPATH_LENGTH - 1] = '\0';
-    Pegasus::Utils::Strcat(pathBuffer, relativePath);
-    pathBuffer[MAX_FILEPATH_LENGTH - 1] = '\0';
+    Pegasus::Utils::Strcat(outPath, rootDirectory);
+    outPath[MAX_FILEPATH_LENGTH - 1] = '\0';
+    Pegasus::Utils::Strcat(outPath, relativePath);
+    outPath[MAX_FILEPATH_LENGTH - 1] = '\0';
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError IOManager::OpenFileToBuffer(const char* relativePath, FileBuffer& outputBuffer, bool allocateBuffer, Alloc::IAllocator* alloc, FileRoot root)
+{
+    char pathBuffer[MAX_FILEPATH_LENGTH];
+    if (!BuildFullPath(relativePath, pathBuffer, root))
+    {
+        return ERR_FILE_NOT_FOUND;
+    }
 
     // Load the file
 #if PEGASUS_USE_NATIVE_IO_CALLS
@@ -231,21 +232,17 @@ IoError IOManager::OpenFileToBuffer(const char* relativePath, FileBuffer& output
 //----------------------------------------------------------------------------------------
 
 
-Pegasus::Io::IoError Pegasus::Io::IOManager::SaveFileToBuffer(const char* relativePath, const Pegasus::Io::FileBuffer& inputBuffer)
+Pegasus::Io::IoError Pegasus::Io::IOManager::SaveFileToBuffer(const char* relativePath, const Pegasus::Io::FileBuffer& inputBuffer, FileRoot root)
 {
     //todo - implement saving to a file :)
     char pathBuffer[MAX_FILEPATH_LENGTH];
-
-    // Configure the path
-    pathBuffer[0] = '\0';
-    PG_ASSERTSTR(Pegasus::Utils::Strlen(relativePath) < MAX_FILEPATH_LENGTH, "Path str is too little! be prepared for some mem stomps!");
-    Pegasus::Utils::Strcat(pathBuffer, mRootDirectory);
-    pathBuffer[MAX_FILEPATH_LENGTH - 1] = '\0';
-    Pegasus::Utils::Strcat(pathBuffer, relativePath);
-    pathBuffer[MAX_FILEPATH_LENGTH - 1] = '\0';
+    if (!BuildFullPath(relativePath, pathBuffer, root))
+    {
+        return ERR_OPENING_FILE;
+    }
 
 #if PEGASUS_USE_NATIVE_IO_CALLS
-    return internal::NativeSaveBufferToFile(pathBuffer, inputBuffer);
+    return internal::NativeSaveBufferToFile(pathBuffer, inputBuffer.GetBuffer(), inputBuffer.GetFileSize());
 #else
     FILE * fileHandle = nullptr;
     fopen_s(&fileHandle, pathBuffer, "wb");
@@ -270,11 +267,168 @@ Pegasus::Io::IoError Pegasus::Io::IOManager::SaveFileToBuffer(const char* relati
 
 //----------------------------------------------------------------------------------------
 
+IoError IOManager::MapFileToBuffer(const char* relativePath, FileBuffer& outputBuffer, Alloc::IAllocator* alloc, FileRoot root)
+{
+#if PEGASUS_USE_NATIVE_IO_CALLS
+    char pathBuffer[MAX_FILEPATH_LENGTH];
+    if (!BuildFullPath(relativePath, pathBuffer, root))
+    {
+        return ERR_FILE_NOT_FOUND;
+    }
+
+    internal::NativeFileHandle fileHandle = nullptr;
+    unsigned long long fileSize = 0;
+    IoError err = internal::NativeOpenFileForRead(pathBuffer, fileHandle, fileSize);
+    if (err != ERR_NONE)
+    {
+        return err;
+    }
+
+    if (fileSize >= static_cast<unsigned long long>(MIN_MAPPED_FILE_SIZE) && fileSize <= 0x7FFFFFFF)
+    {
+        internal::NativeCloseFile(fileHandle);
+        const char* view = nullptr;
+        err = internal::NativeMapFile(pathBuffer, view, fileSize);
+        if (err == ERR_NONE)
+        {
+            outputBuffer.OwnMapping(alloc, view, static_cast<int>(fileSize));
+            PG_LOG('FILE', "Successfully mapped file \"%s\" (%u KB)", pathBuffer, static_cast<unsigned int>(fileSize / 1024));
+            return ERR_NONE;
+        }
+
+        // The mapping failed: regular read
+        return internal::NativeOpenFileToBuffer(pathBuffer, outputBuffer, true, alloc);
+    }
+
+    // Small file: regular read, from the handle already open
+    return internal::NativeReadOpenedFileToBuffer(pathBuffer, fileHandle, fileSize, outputBuffer, true, alloc);
+#else
+    return OpenFileToBuffer(relativePath, outputBuffer, true, alloc, root);
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError IOManager::OpenFileStream(const char* relativePath, FileStream& outputStream)
+{
+    char pathBuffer[MAX_FILEPATH_LENGTH];
+    BuildFullPath(relativePath, pathBuffer);
+
+    outputStream.Close();
+
+#if PEGASUS_USE_NATIVE_IO_CALLS
+    internal::NativeFileHandle fileHandle = nullptr;
+    unsigned long long fileSize = 0;
+    IoError err = internal::NativeOpenFileForRead(pathBuffer, fileHandle, fileSize);
+    if (err != ERR_NONE)
+    {
+        return err;
+    }
+    outputStream.mHandle = fileHandle;
+    outputStream.mFileSize = fileSize;
+#else
+    FILE * fileHandle = nullptr;
+    fopen_s(&fileHandle, pathBuffer, "rb");
+    if (fileHandle == nullptr)
+    {
+        PG_LOG('FILE', "File not found \"%s\"", pathBuffer);
+        return ERR_FILE_NOT_FOUND;
+    }
+    _fseeki64(fileHandle, 0LL, SEEK_END);
+    outputStream.mFileSize = static_cast<unsigned long long>(_ftelli64(fileHandle));
+    _fseeki64(fileHandle, 0LL, SEEK_SET);
+    outputStream.mHandle = fileHandle;
+#endif
+
+    outputStream.mPosition = 0;
+    PG_LOG('FILE', "Successfully opened file stream \"%s\"", pathBuffer);
+    return ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+Pegasus::Io::FileStream::FileStream()
+:   mHandle(nullptr),
+    mFileSize(0),
+    mPosition(0)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+Pegasus::Io::FileStream::~FileStream()
+{
+    Close();
+}
+
+//----------------------------------------------------------------------------------------
+
+void Pegasus::Io::FileStream::Close()
+{
+    if (mHandle != nullptr)
+    {
+#if PEGASUS_USE_NATIVE_IO_CALLS
+        internal::NativeCloseFile(mHandle);
+#else
+        fclose(static_cast<FILE*>(mHandle));
+#endif
+    }
+    mHandle = nullptr;
+    mFileSize = 0;
+    mPosition = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError Pegasus::Io::FileStream::Read(char* buffer, int bufferSize, int& outBytesRead)
+{
+    PG_ASSERTSTR(mHandle != nullptr, "Reading from a closed file stream!");
+    outBytesRead = 0;
+    if (mHandle == nullptr)
+    {
+        return ERR_READING_FILE;
+    }
+
+#if PEGASUS_USE_NATIVE_IO_CALLS
+    IoError err = internal::NativeReadFile(mHandle, buffer, bufferSize, outBytesRead);
+#else
+    outBytesRead = static_cast<int>(fread(buffer, 1/*byte*/, bufferSize, static_cast<FILE*>(mHandle)));
+    IoError err = ferror(static_cast<FILE*>(mHandle)) ? ERR_READING_FILE : ERR_NONE;
+#endif
+    mPosition += static_cast<unsigned long long>(outBytesRead);
+    return err;
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError Pegasus::Io::FileStream::Seek(unsigned long long position)
+{
+    PG_ASSERTSTR(mHandle != nullptr, "Seeking a closed file stream!");
+    if (mHandle == nullptr)
+    {
+        return ERR_READING_FILE;
+    }
+
+#if PEGASUS_USE_NATIVE_IO_CALLS
+    IoError err = internal::NativeSeekFile(mHandle, position);
+#else
+    IoError err = _fseeki64(static_cast<FILE*>(mHandle), static_cast<long long>(position), SEEK_SET) == 0 ? ERR_NONE : ERR_READING_FILE;
+#endif
+    if (err == ERR_NONE)
+    {
+        mPosition = position;
+    }
+    return err;
+}
+
+//----------------------------------------------------------------------------------------
+
 Pegasus::Io::FileBuffer::FileBuffer()
 :   mAllocator(nullptr),
     mBuffer(nullptr), 
     mFileSize(0), 
-    mBufferSize(0)
+    mBufferSize(0),
+    mIsMapped(false)
 {
 }
 
@@ -298,24 +452,65 @@ void Pegasus::Io::FileBuffer::OwnBuffer(Alloc::IAllocator* bufferAlloc, char * b
 
 //----------------------------------------------------------------------------------------
 
+void Pegasus::Io::FileBuffer::OwnMapping(Alloc::IAllocator* bufferAlloc, const char * view, int viewSize)
+{
+    OwnBuffer(bufferAlloc, const_cast<char*>(view), viewSize);
+    mIsMapped = true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Pegasus::Io::FileBuffer::ResolveMapping()
+{
+    if (mIsMapped)
+    {
+        PG_ASSERTSTR(mAllocator != nullptr, "A mapped buffer needs an allocator to be resolved");
+        char* mappedView = mBuffer;
+        const int mappedSize = mBufferSize;
+        const int fileSize = mFileSize;
+
+        char* buffer = PG_NEW_ARRAY(mAllocator, -1, "file buffer", Pegasus::Alloc::PG_MEM_PERM, char, mappedSize);
+        Utils::Memcpy(buffer, mappedView, mappedSize);
+#if PEGASUS_USE_NATIVE_IO_CALLS
+        internal::NativeUnmapFile(mappedView, static_cast<unsigned long long>(mappedSize));
+#endif
+        mBuffer = buffer;
+        mFileSize = fileSize;
+        mIsMapped = false;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
 void Pegasus::Io::FileBuffer::ForgetBuffer()
 {
     mAllocator = nullptr;
     mBuffer = nullptr;
     mBufferSize = 0;
     mFileSize = 0;
+    mIsMapped = false;
 }
 
 //----------------------------------------------------------------------------------------
 
 void Pegasus::Io::FileBuffer::DestroyBuffer()
 {
-    PG_DELETE_ARRAY(mAllocator, mBuffer);
+    if (mIsMapped)
+    {
+#if PEGASUS_USE_NATIVE_IO_CALLS
+        internal::NativeUnmapFile(mBuffer, static_cast<unsigned long long>(mBufferSize));
+#endif
+    }
+    else
+    {
+        PG_DELETE_ARRAY(mAllocator, mBuffer);
+    }
 
     mAllocator = nullptr;
     mBuffer = nullptr;
     mBufferSize = 0;
     mFileSize = 0;
+    mIsMapped = false;
 }
 
 //----------------------------------------------------------------------------------------
@@ -0,0 +1,224 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Io_Posix.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Platform layer for file IO (POSIX implementation, Linux and MacOS)
+
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+
+#if PEGASUS_PLATFORM_LINUX || PEGASUS_PLATFORM_MACOS
+
+#include "../Source/Pegasus/Core/Platform/NativeIo.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Core/Log.h"
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+#include <stdint.h>
+
+namespace Pegasus {
+namespace Io {
+namespace internal {
+
+//! File descriptors are stored with an offset of 1 so the descriptor 0 is not mistaken for an invalid handle
+static inline NativeFileHandle FdToHandle(int fd)
+{
+    return reinterpret_cast<NativeFileHandle>(static_cast<intptr_t>(fd) + 1);
+}
+
+//! Inverse of FdToHandle
+static inline int HandleToFd(NativeFileHandle handle)
+{
+    return static_cast<int>(reinterpret_cast<intptr_t>(handle) - 1);
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError NativeOpenFileForRead(const char* path, NativeFileHandle& outHandle, unsigned long long& outFileSize)
+{
+    outHandle = nullptr;
+    outFileSize = 0;
+
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+    {
+        PG_LOG('FILE', "File not found \"%s\"", path);
+        return ERR_FILE_NOT_FOUND;
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0)
+    {
+        close(fd);
+        return ERR_READING_FILE;
+    }
+
+#if PEGASUS_PLATFORM_LINUX
+    posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+    outHandle = FdToHandle(fd);
+    outFileSize = static_cast<unsigned long long>(fileStat.st_size);
+    return ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError NativeReadFile(NativeFileHandle handle, void* buffer, int size, int& outBytesRead)
+{
+    PG_ASSERTSTR(handle != nullptr, "Reading from an invalid file handle!");
+    PG_ASSERTSTR(size >= 0, "Invalid read size");
+
+    outBytesRead = 0;
+    char* dst = static_cast<char*>(buffer);
+
+    //read() is allowed to return less than requested, loop until the request is fulfilled or EOF
+    while (outBytesRead < size)
+    {
+        ssize_t res = read(HandleToFd(handle), dst + outBytesRead, static_cast<size_t>(size - outBytesRead));
+        if (res < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return ERR_READING_FILE;
+        }
+        else if (res == 0)
+        {
+            break;
+        }
+        outBytesRead += static_cast<int>(res);
+    }
+    return ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError NativeSeekFile(NativeFileHandle handle, unsigned long long offset)
+{
+    PG_ASSERTSTR(handle != nullptr, "Seeking an invalid file handle!");
+    return lseek(HandleToFd(handle), static_cast<off_t>(offset), SEEK_SET) == static_cast<off_t>(-1) ? ERR_READING_FILE : ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NativeCloseFile(NativeFileHandle handle)
+{
+    if (handle != nullptr)
+    {
+        close(HandleToFd(handle));
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError NativeMapFile(const char* path, const char*& outView, unsigned long long& outFileSize)
+{
+    outView = nullptr;
+
+    NativeFileHandle fileHandle = nullptr;
+    IoError err = NativeOpenFileForRead(path, fileHandle, outFileSize);
+    if (err != ERR_NONE)
+    {
+        return err;
+    }
+
+    if (outFileSize == 0)
+    {
+        //mmap refuses zero length mappings
+        NativeCloseFile(fileHandle);
+        return ERR_READING_FILE;
+    }
+
+    if (outFileSize > static_cast<unsigned long long>(SIZE_MAX))
+    {
+        NativeCloseFile(fileHandle);
+        return ERR_FILE_SIZE_TOO_BIG;
+    }
+
+    void* view = mmap(nullptr, static_cast<size_t>(outFileSize), PROT_READ, MAP_PRIVATE, HandleToFd(fileHandle), 0);
+
+    //the mapping keeps its own reference on the file
+    NativeCloseFile(fileHandle);
+    if (view == MAP_FAILED)
+    {
+        PG_LOG('FILE', "IO Error (mmap): %s", path);
+        return ERR_FILE_SIZE_TOO_BIG;
+    }
+
+    madvise(view, static_cast<size_t>(outFileSize), MADV_SEQUENTIAL);
+    outView = static_cast<const char*>(view);
+    return ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NativeUnmapFile(const char* view, unsigned long long fileSize)
+{
+    if (view != nullptr)
+    {
+        munmap(const_cast<char*>(view), static_cast<size_t>(fileSize));
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError NativeSaveBufferToFile(const char* path, const char* buffer, int size)
+{
+    int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd == -1)
+    {
+        PG_LOG('FILE', "IO Error (open): %s", path);
+        return ERR_OPENING_FILE;
+    }
+
+    int bytesWritten = 0;
+    while (bytesWritten < size)
+    {
+        ssize_t res = write(fd, buffer + bytesWritten, static_cast<size_t>(size - bytesWritten));
+        if (res < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        else if (res <= 0)
+        {
+            close(fd);
+            PG_LOG('FILE', "IO Error (write): %s", path);
+            return ERR_WRITING_FILE;
+        }
+        bytesWritten += static_cast<int>(res);
+    }
+
+    close(fd);
+    PG_LOG('FILE', "Saved: %s", path);
+    return ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError NativeCreateDirectory(const char* path)
+{
+    if (mkdir(path, 0755) == -1 && errno != EEXIST)
+    {
+        PG_LOG('FILE', "IO Error (mkdir): %s", path);
+        return ERR_WRITING_FILE;
+    }
+    return ERR_NONE;
+}
+
+
+}   // namespace internal
+}   // namespace Io
+}   // namespace Pegasus
+
+#endif  // PEGASUS_PLATFORM_LINUX || PEGASUS_PLATFORM_MACOS
@@ -0,0 +1,211 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Io_Win32.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Platform layer for file IO (Win32 implementation)
+
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+
+#if PEGASUS_PLATFORM_WINDOWS
+
+#include "../Source/Pegasus/Core/Platform/NativeIo.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Core/Log.h"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+namespace Pegasus {
+namespace Io {
+namespace internal {
+
+IoError NativeOpenFileForRead(const char* path, NativeFileHandle& outHandle, unsigned long long& outFileSize)
+{
+    outHandle = nullptr;
+    outFileSize = 0;
+
+    HANDLE fileHandle = CreateFile(
+        path,
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        NULL, //win32 security attributes
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+        NULL //template file
+    );
+
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        PG_LOG('FILE', "File not found \"%s\"", path);
+        return ERR_FILE_NOT_FOUND;
+    }
+
+    LARGE_INTEGER fileSize;
+    fileSize.QuadPart = 0;
+    if (!GetFileSizeEx(fileHandle, &fileSize))
+    {
+        CloseHandle(fileHandle);
+        return ERR_READING_FILE;
+    }
+
+    outHandle = static_cast<NativeFileHandle>(fileHandle);
+    outFileSize = static_cast<unsigned long long>(fileSize.QuadPart);
+    return ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError NativeReadFile(NativeFileHandle handle, void* buffer, int size, int& outBytesRead)
+{
+    PG_ASSERTSTR(handle != nullptr, "Reading from an invalid file handle!");
+    PG_ASSERTSTR(size >= 0, "Invalid read size");
+
+    DWORD bytesRead = 0;
+    BOOL res = ReadFile(static_cast<HANDLE>(handle), buffer, static_cast<DWORD>(size), &bytesRead, NULL);
+    outBytesRead = static_cast<int>(bytesRead);
+    return res ? ERR_NONE : ERR_READING_FILE;
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError NativeSeekFile(NativeFileHandle handle, unsigned long long offset)
+{
+    PG_ASSERTSTR(handle != nullptr, "Seeking an invalid file handle!");
+
+    LARGE_INTEGER distance;
+    distance.QuadPart = static_cast<LONGLONG>(offset);
+    return SetFilePointerEx(static_cast<HANDLE>(handle), distance, NULL, FILE_BEGIN) ? ERR_NONE : ERR_READING_FILE;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NativeCloseFile(NativeFileHandle handle)
+{
+    if (handle != nullptr)
+    {
+        CloseHandle(static_cast<HANDLE>(handle));
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError NativeMapFile(const char* path, const char*& outView, unsigned long long& outFileSize)
+{
+    outView = nullptr;
+
+    NativeFileHandle fileHandle = nullptr;
+    IoError err = NativeOpenFileForRead(path, fileHandle, outFileSize);
+    if (err != ERR_NONE)
+    {
+        return err;
+    }
+
+    if (outFileSize == 0)
+    {
+        //Win32 refuses to map empty files
+        NativeCloseFile(fileHandle);
+        return ERR_READING_FILE;
+    }
+
+#if PEGASUS_POINTERSIZE_32BIT
+    if ((outFileSize >> 32) != 0)
+    {
+        NativeCloseFile(fileHandle);
+        return ERR_FILE_SIZE_TOO_BIG;
+    }
+#endif
+
+    HANDLE mappingHandle = CreateFileMapping(static_cast<HANDLE>(fileHandle), NULL, PAGE_READONLY, 0, 0, NULL);
+
+    //the view keeps a reference on the mapping object and on the file, both handles can be closed right away
+    NativeCloseFile(fileHandle);
+    if (mappingHandle == NULL)
+    {
+        PG_LOG('FILE', "IO Error (CreateFileMapping): %s", path);
+        return ERR_OPENING_FILE;
+    }
+
+    void* view = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mappingHandle);
+    if (view == NULL)
+    {
+        PG_LOG('FILE', "IO Error (MapViewOfFile): %s", path);
+        return ERR_FILE_SIZE_TOO_BIG;
+    }
+
+    outView = static_cast<const char*>(view);
+    return ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NativeUnmapFile(const char* view, unsigned long long fileSize)
+{
+    if (view != nullptr)
+    {
+        UnmapViewOfFile(view);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError NativeSaveBufferToFile(const char* path, const char* buffer, int size)
+{
+    HANDLE fileHandle = CreateFile(
+                            path,
+                            GENERIC_WRITE,
+                            0,
+                            NULL,
+                            CREATE_ALWAYS,
+                            FILE_ATTRIBUTE_NORMAL,
+                            NULL
+                        );
+
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        PG_LOG('FILE', "IO Error (CreateFile): %s", path);
+        return ERR_OPENING_FILE;
+    }
+
+    DWORD bytesWritten = 0;
+    BOOL res = WriteFile (
+        fileHandle,
+        buffer,
+        static_cast<DWORD>(size),
+        &bytesWritten,
+        NULL
+    );
+    SetEndOfFile(fileHandle);
+    CloseHandle(fileHandle);
+    if (!res || bytesWritten != static_cast<DWORD>(size))
+    {
+        PG_LOG('FILE', "IO Error (WriteFile): %s", path);
+        return ERR_WRITING_FILE;
+    }
+    PG_LOG('FILE', "Saved: %s", path);
+    return ERR_NONE;
+}
+
+//----------------------------------------------------------------------------------------
+
+IoError NativeCreateDirectory(const char* path)
+{
+    if (!CreateDirectory(path, NULL) && GetLastError() != ERROR_ALREADY_EXISTS)
+    {
+        PG_LOG('FILE', "IO Error (CreateDirectory): %s", path);
+        return ERR_WRITING_FILE;
+    }
+    return ERR_NONE;
+}
+
+
+}   // namespace internal
+}   // namespace Io
+}   // namespace Pegasus
+
+#endif  // PEGASUS_PLATFORM_WINDOWS
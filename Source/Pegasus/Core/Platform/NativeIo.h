@@ -0,0 +1,79 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NativeIo.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Platform layer for file IO (native handles, streaming and memory mapping)
+
+#ifndef PEGASUS_CORE_NATIVEIO_H
+#define PEGASUS_CORE_NATIVEIO_H
+
+#include "Pegasus/Core/Shared/IoErrors.h"
+
+namespace Pegasus {
+namespace Io {
+namespace internal {
+
+//! Opaque native file handle. nullptr is the invalid handle on every platform.
+typedef void* NativeFileHandle;
+
+//! Opens an existing file for sequential or random read access
+//! \param path Full path of the file to open.
+//! \param outHandle Handle of the opened file, nullptr on failure.
+//! \param outFileSize Size of the file in bytes (64 bits, files bigger than 4 GB are supported).
+//! \return Error code.
+IoError NativeOpenFileForRead(const char* path, NativeFileHandle& outHandle, unsigned long long& outFileSize);
+
+//! Reads bytes from the current position of a file into a caller provided buffer
+//! \param handle Handle opened with NativeOpenFileForRead.
+//! \param buffer Destination buffer.
+//! \param size Number of bytes to read. Can be less than the number of bytes left in the file.
+//! \param outBytesRead Number of bytes actually read, 0 when the end of the file is reached.
+//! \return Error code.
+IoError NativeReadFile(NativeFileHandle handle, void* buffer, int size, int& outBytesRead);
+
+//! Moves the read position of a file
+//! \param handle Handle opened with NativeOpenFileForRead.
+//! \param offset Absolute offset in bytes from the beginning of the file.
+//! \return Error code.
+IoError NativeSeekFile(NativeFileHandle handle, unsigned long long offset);
+
+//! Closes a file opened with NativeOpenFileForRead
+//! \param handle Handle to close, nullptr is ignored.
+void NativeCloseFile(NativeFileHandle handle);
+
+//! Maps an entire file as a read-only view in the address space of the process
+//! \param path Full path of the file to map.
+//! \param outView Address of the first byte of the view, nullptr on failure.
+//! \param outFileSize Size of the mapped file in bytes.
+//! \return Error code. ERR_FILE_SIZE_TOO_BIG if the file cannot fit in the address space.
+//! \note Empty files cannot be mapped and return ERR_READING_FILE
+IoError NativeMapFile(const char* path, const char*& outView, unsigned long long& outFileSize);
+
+//! Releases a view created with NativeMapFile
+//! \param view Address returned by NativeMapFile.
+//! \param fileSize Size returned by NativeMapFile.
+void NativeUnmapFile(const char* view, unsigned long long fileSize);
+
+//! Writes a buffer to a file, creating or truncating it
+//! \param path Full path of the file to write.
+//! \param buffer Data to write.
+//! \param size Number of bytes to write.
+//! \return Error code.
+IoError NativeSaveBufferToFile(const char* path, const char* buffer, int size);
+
+//! Creates a directory, the parent directory must exist
+//! \param path Full path of the directory, with or without a trailing separator.
+//! \return Error code. ERR_NONE if the directory already exists.
+IoError NativeCreateDirectory(const char* path);
+
+
+}   // namespace internal
+}   // namespace Io
+}   // namespace Pegasus
+
+#endif  // PEGASUS_CORE_NATIVEIO_H
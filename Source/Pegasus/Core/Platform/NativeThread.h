@@ -0,0 +1,84 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NativeThread.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Platform layer for threads (creation, join, semaphores and processor count)
+
+#ifndef PEGASUS_CORE_NATIVETHREAD_H
+#define PEGASUS_CORE_NATIVETHREAD_H
+
+namespace Pegasus {
+namespace Core {
+namespace internal {
+
+//! Entry point of a native thread
+//! \param arg Argument given to NativeStartThread.
+typedef void (*NativeThreadFunc)(void* arg);
+
+//! Native thread, owned by the caller from NativeStartThread to NativeJoinThread
+struct NativeThread
+{
+    NativeThreadFunc mFunc;     //!< Entry point
+    void* mArg;                 //!< Argument of the entry point
+    void* mHandle;              //!< Platform handle
+    bool mStarted;              //!< True from a successful NativeStartThread to NativeJoinThread
+};
+
+//! Starts a thread running a function
+//! \param thread Thread to start, must stay at the same address until NativeJoinThread returns.
+//! \param func Entry point of the thread.
+//! \param arg Argument of the entry point.
+//! \return True if the thread is running, false if the system could not create it.
+bool NativeStartThread(NativeThread& thread, NativeThreadFunc func, void* arg);
+
+//! Waits for a thread to return from its entry point and releases it
+//! \param thread Thread started with NativeStartThread. Ignored if the start failed.
+void NativeJoinThread(NativeThread& thread);
+
+//! Size in bytes of the platform objects of a semaphore
+static const unsigned int NATIVE_SEMAPHORE_STORAGE_SIZE = 192;
+
+//! Counting semaphore, to put threads to sleep until another one signals them
+struct NativeSemaphore
+{
+    union
+    {
+        void* mHandle;                                          //!< Platform handle (Win32)
+        long long mAlignment;                                   //!< Alignment of the platform objects
+        unsigned char mStorage[NATIVE_SEMAPHORE_STORAGE_SIZE];  //!< Platform objects stored in place (POSIX)
+    };
+};
+
+//! Creates a semaphore with a count of 0
+//! \param semaphore Semaphore to create, must stay at the same address until NativeDestroySemaphore.
+//! \return True if the semaphore is usable, false if the system could not create it.
+bool NativeCreateSemaphore(NativeSemaphore& semaphore);
+
+//! Releases a semaphore no thread waits on anymore
+//! \param semaphore Semaphore created with NativeCreateSemaphore.
+void NativeDestroySemaphore(NativeSemaphore& semaphore);
+
+//! Adds to the count of a semaphore, waking up as many waiting threads
+//! \param semaphore Semaphore created with NativeCreateSemaphore.
+//! \param count Number to add to the count, > 0.
+void NativeSignalSemaphore(NativeSemaphore& semaphore, unsigned int count);
+
+//! Sleeps until the count of a semaphore is positive, then decrements it
+//! \param semaphore Semaphore created with NativeCreateSemaphore.
+void NativeWaitSemaphore(NativeSemaphore& semaphore);
+
+//! Gets the number of logical processors
+//! \return Number of logical processors, at least 1.
+unsigned int NativeGetHardwareThreadCount();
+
+
+}   // namespace internal
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_CORE_NATIVETHREAD_H
@@ -0,0 +1,165 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Thread_Posix.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Platform layer for threads (POSIX implementation, Linux and MacOS)
+
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+
+#if PEGASUS_PLATFORM_LINUX || PEGASUS_PLATFORM_MACOS
+
+#include "../Source/Pegasus/Core/Platform/NativeThread.h"
+#include "Pegasus/Core/Log.h"
+
+#include <pthread.h>
+#include <unistd.h>
+#include <string.h>
+
+namespace Pegasus {
+namespace Core {
+namespace internal {
+
+//! POSIX entry point of the threads, calling the function of the NativeThread
+static void* NativeThreadProc(void* param)
+{
+    NativeThread* thread = static_cast<NativeThread*>(param);
+    thread->mFunc(thread->mArg);
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool NativeStartThread(NativeThread& thread, NativeThreadFunc func, void* arg)
+{
+    thread.mFunc = func;
+    thread.mArg = arg;
+    thread.mHandle = nullptr;
+    thread.mStarted = false;
+
+    //pthread_t is an integer on Linux and a pointer on MacOS, both stored in the bytes of the handle
+    static_assert(sizeof(pthread_t) <= sizeof(void*), "pthread_t does not fit in a native thread handle");
+    pthread_t handle;
+    const int error = pthread_create(&handle, nullptr, NativeThreadProc, &thread);
+    if (error != 0)
+    {
+        PG_LOG('ERR_', "Unable to create a thread (error %d)", error);
+        return false;
+    }
+    memcpy(&thread.mHandle, &handle, sizeof(handle));
+    thread.mStarted = true;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NativeJoinThread(NativeThread& thread)
+{
+    if (thread.mStarted)
+    {
+        pthread_t handle;
+        memcpy(&handle, &thread.mHandle, sizeof(handle));
+        pthread_join(handle, nullptr);
+        thread.mStarted = false;
+    }
+}
+
+//! Objects of a POSIX semaphore, stored in place in NativeSemaphore.
+//! Unnamed sem_t is not supported on MacOS, so the count is protected by a mutex and a condition
+struct PosixSemaphore
+{
+    pthread_mutex_t mMutex;
+    pthread_cond_t mCondition;
+    unsigned int mCount;
+};
+
+static_assert(sizeof(PosixSemaphore) <= NATIVE_SEMAPHORE_STORAGE_SIZE, "POSIX semaphore does not fit in a native semaphore");
+
+//! Gets the POSIX objects of a semaphore
+static PosixSemaphore& GetPosixSemaphore(NativeSemaphore& semaphore)
+{
+    return *reinterpret_cast<PosixSemaphore*>(semaphore.mStorage);
+}
+
+//----------------------------------------------------------------------------------------
+
+bool NativeCreateSemaphore(NativeSemaphore& semaphore)
+{
+    PosixSemaphore& posixSemaphore = GetPosixSemaphore(semaphore);
+    posixSemaphore.mCount = 0;
+    int error = pthread_mutex_init(&posixSemaphore.mMutex, nullptr);
+    if (error == 0)
+    {
+        error = pthread_cond_init(&posixSemaphore.mCondition, nullptr);
+        if (error != 0)
+        {
+            pthread_mutex_destroy(&posixSemaphore.mMutex);
+        }
+    }
+    if (error != 0)
+    {
+        PG_LOG('ERR_', "Unable to create a semaphore (error %d)", error);
+        return false;
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NativeDestroySemaphore(NativeSemaphore& semaphore)
+{
+    PosixSemaphore& posixSemaphore = GetPosixSemaphore(semaphore);
+    pthread_cond_destroy(&posixSemaphore.mCondition);
+    pthread_mutex_destroy(&posixSemaphore.mMutex);
+}
+
+//----------------------------------------------------------------------------------------
+
+void NativeSignalSemaphore(NativeSemaphore& semaphore, unsigned int count)
+{
+    PosixSemaphore& posixSemaphore = GetPosixSemaphore(semaphore);
+    pthread_mutex_lock(&posixSemaphore.mMutex);
+    posixSemaphore.mCount += count;
+    if (count == 1)
+    {
+        pthread_cond_signal(&posixSemaphore.mCondition);
+    }
+    else
+    {
+        pthread_cond_broadcast(&posixSemaphore.mCondition);
+    }
+    pthread_mutex_unlock(&posixSemaphore.mMutex);
+}
+
+//----------------------------------------------------------------------------------------
+
+void NativeWaitSemaphore(NativeSemaphore& semaphore)
+{
+    PosixSemaphore& posixSemaphore = GetPosixSemaphore(semaphore);
+    pthread_mutex_lock(&posixSemaphore.mMutex);
+    while (posixSemaphore.mCount == 0)
+    {
+        pthread_cond_wait(&posixSemaphore.mCondition, &posixSemaphore.mMutex);
+    }
+    --posixSemaphore.mCount;
+    pthread_mutex_unlock(&posixSemaphore.mMutex);
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int NativeGetHardwareThreadCount()
+{
+    const long count = sysconf(_SC_NPROCESSORS_ONLN);
+    return (count > 0) ? static_cast<unsigned int>(count) : 1;
+}
+
+
+}   // namespace internal
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_PLATFORM_LINUX || PEGASUS_PLATFORM_MACOS
@@ -0,0 +1,111 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Thread_Win32.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Platform layer for threads (Win32 implementation)
+
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+
+#if PEGASUS_PLATFORM_WINDOWS
+
+#include "../Source/Pegasus/Core/Platform/NativeThread.h"
+#include "Pegasus/Core/Log.h"
+
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+
+namespace Pegasus {
+namespace Core {
+namespace internal {
+
+//! Win32 entry point of the threads, calling the function of the NativeThread
+static DWORD WINAPI NativeThreadProc(LPVOID param)
+{
+    NativeThread* thread = static_cast<NativeThread*>(param);
+    thread->mFunc(thread->mArg);
+    return 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool NativeStartThread(NativeThread& thread, NativeThreadFunc func, void* arg)
+{
+    thread.mFunc = func;
+    thread.mArg = arg;
+    thread.mHandle = CreateThread(nullptr, 0, NativeThreadProc, &thread, 0, nullptr);
+    thread.mStarted = (thread.mHandle != nullptr);
+    if (!thread.mStarted)
+    {
+        PG_LOG('ERR_', "Unable to create a thread (error %u)", static_cast<unsigned int>(GetLastError()));
+    }
+    return thread.mStarted;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NativeJoinThread(NativeThread& thread)
+{
+    if (thread.mStarted)
+    {
+        WaitForSingleObject(static_cast<HANDLE>(thread.mHandle), INFINITE);
+        CloseHandle(static_cast<HANDLE>(thread.mHandle));
+        thread.mHandle = nullptr;
+        thread.mStarted = false;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool NativeCreateSemaphore(NativeSemaphore& semaphore)
+{
+    semaphore.mHandle = CreateSemaphore(nullptr, 0, LONG_MAX, nullptr);
+    if (semaphore.mHandle == nullptr)
+    {
+        PG_LOG('ERR_', "Unable to create a semaphore (error %u)", static_cast<unsigned int>(GetLastError()));
+        return false;
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NativeDestroySemaphore(NativeSemaphore& semaphore)
+{
+    CloseHandle(static_cast<HANDLE>(semaphore.mHandle));
+    semaphore.mHandle = nullptr;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NativeSignalSemaphore(NativeSemaphore& semaphore, unsigned int count)
+{
+    ReleaseSemaphore(static_cast<HANDLE>(semaphore.mHandle), static_cast<LONG>(count), nullptr);
+}
+
+//----------------------------------------------------------------------------------------
+
+void NativeWaitSemaphore(NativeSemaphore& semaphore)
+{
+    WaitForSingleObject(static_cast<HANDLE>(semaphore.mHandle), INFINITE);
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int NativeGetHardwareThreadCount()
+{
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo(&systemInfo);
+    return (systemInfo.dwNumberOfProcessors > 0) ? static_cast<unsigned int>(systemInfo.dwNumberOfProcessors) : 1;
+}
+
+
+}   // namespace internal
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_PLATFORM_WINDOWS
@@ -80,6 +80,29 @@ double GetPegasusTime()
     return gCurrentPegasusTime;
 }
 
+//----------------------------------------------------------------------------------------
+
+unsigned long long GetPerformanceCounter()
+{
+    if (gPerfCounterSupported)
+    {
+        LARGE_INTEGER counter;
+        QueryPerformanceCounter(&counter);
+        return static_cast<unsigned long long>(counter.QuadPart);
+    }
+    else
+    {
+        return static_cast<unsigned long long>(GetTickCount64());
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+double GetPerformanceCounterPeriod()
+{
+    return gPerfCounterSupported ? gPerfCounterPrecision : 0.001;
+}
+
 
 }   // namespace Core
 }   // namespace Pegasus
@@ -0,0 +1,486 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Profiler.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  CPU frame profiler, hierarchical scopes recorded into per-thread ring buffers
+
+#include "Pegasus/Core/Profiler.h"
+#include "Pegasus/Core/Atomic.h"
+#include "Pegasus/Core/Time.h"
+#include "Pegasus/Core/Log.h"
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Utils/ByteStream.h"
+
+#include <stdio.h>
+#include <string.h>
+
+namespace Pegasus {
+namespace Core {
+
+//! Number of events kept per thread, power of 2. Older events get overwritten.
+static const unsigned int PROFILER_EVENT_CAPACITY = 16384;
+
+//! Maximum depth of the scopes of a thread. Deeper scopes are not recorded.
+static const unsigned int PROFILER_MAX_DEPTH = 64;
+
+//! Maximum number of distinct scope names in the summary
+static const unsigned int PROFILER_MAX_SUMMARY_ENTRIES = 256;
+
+//! Weight of the last frame in the moving averages
+static const float PROFILER_AVERAGE_WEIGHT = 0.05f;
+
+//! Name of the scope covering a whole frame of the main thread
+static const char* const PROFILER_FRAME_SCOPE_NAME = "Frame";
+
+//! Closed scope
+struct ProfileEvent
+{
+    const char* mName;
+    unsigned long long mStart;
+    unsigned long long mEnd;
+    unsigned int mDepth;
+};
+
+//! Events of one thread. Written by its thread only, read by the main thread.
+//! Events are published by incrementing mWriteCount after they are written, so no lock is needed.
+struct ProfileThreadBuffer
+{
+    ProfileThreadBuffer* mNext;             //!< Next buffer in the list of all the threads
+    unsigned int mThreadIndex;              //!< Index of the thread, in order of first use of the profiler
+    AtomicInt mWriteCount;                  //!< Number of events written since the creation of the buffer
+    unsigned int mSummaryCursor;            //!< Number of events processed by the summary (main thread only)
+    unsigned int mDepth;                    //!< Number of scopes currently open
+    const char* mStackNames[PROFILER_MAX_DEPTH];
+    unsigned long long mStackStarts[PROFILER_MAX_DEPTH];
+    ProfileEvent mEvents[PROFILER_EVENT_CAPACITY];
+};
+
+//! Summary entry with the accumulators of the current frame and window
+struct ProfileSummaryRecord
+{
+    ProfileSummaryEntry mEntry;
+    unsigned long long mFrameTicks;
+    unsigned int mFrameCalls;
+    float mWindowMaxMs;
+};
+
+bool gProfilerEnabled = false;
+
+//! Value of gProfilerEnabled for the next frame
+static bool gProfilerEnableRequested = false;
+
+//! Allocator of the thread buffers, nullptr when the profiler is not initialized
+static Alloc::IAllocator* gProfilerAllocator = nullptr;
+
+//! List of the buffers of all the threads, only grows until the profiler is shut down
+static void* volatile gProfilerThreadBuffers = nullptr;
+
+//! Number of threads registered so far
+static AtomicInt gProfilerThreadCount = 0;
+
+//! Incremented on each initialization, so threads detect their buffer belongs to a previous session
+static AtomicInt gProfilerSession = 0;
+
+//! Counter value when the profiler was initialized, origin of the Chrome trace timestamps
+static unsigned long long gProfilerStartTicks = 0;
+
+//! Duration of a counter tick, in milliseconds
+static double gProfilerTickMs = 0.0;
+
+//! Counter value at the start of the current frame
+static unsigned long long gProfilerFrameStartTicks = 0;
+
+static float gProfilerAverageFrameMs = 0.0f;
+static unsigned int gProfilerFrameInWindow = 0;
+
+static ProfileSummaryRecord gProfilerSummary[PROFILER_MAX_SUMMARY_ENTRIES];
+static unsigned int gProfilerSummaryCount = 0;
+
+//! Buffer of the calling thread, with the session it was created in
+static thread_local ProfileThreadBuffer* tProfilerThreadBuffer = nullptr;
+static thread_local long tProfilerThreadSession = -1;
+
+//----------------------------------------------------------------------------------------
+
+//! Get the buffer of the calling thread, creating it on first use
+//! \return Buffer of the thread, nullptr if the profiler is not initialized
+static ProfileThreadBuffer* GetThreadBuffer()
+{
+    const long session = AtomicLoad(&gProfilerSession);
+    if (tProfilerThreadSession == session)
+    {
+        return tProfilerThreadBuffer;
+    }
+
+    tProfilerThreadBuffer = nullptr;
+    tProfilerThreadSession = session;
+    if (gProfilerAllocator == nullptr)
+    {
+        return nullptr;
+    }
+
+    ProfileThreadBuffer* buffer = PG_NEW(gProfilerAllocator, -1, "Profiler thread buffer", Alloc::PG_MEM_PERM) ProfileThreadBuffer;
+    buffer->mThreadIndex = static_cast<unsigned int>(AtomicIncrement(&gProfilerThreadCount) - 1);
+    buffer->mWriteCount = 0;
+    buffer->mSummaryCursor = 0;
+    buffer->mDepth = 0;
+
+    // Lock-free push at the head of the list
+    void* head;
+    do
+    {
+        head = gProfilerThreadBuffers;
+        buffer->mNext = static_cast<ProfileThreadBuffer*>(head);
+    }
+    while (AtomicCompareExchangePointer(&gProfilerThreadBuffers, buffer, head) != head);
+
+    tProfilerThreadBuffer = buffer;
+    return buffer;
+}
+
+//----------------------------------------------------------------------------------------
+
+void InitializeProfiler(Alloc::IAllocator* allocator)
+{
+    PG_ASSERTSTR(gProfilerAllocator == nullptr, "The profiler is already initialized");
+    gProfilerAllocator = allocator;
+    gProfilerTickMs = GetPerformanceCounterPeriod() * 1000.0;
+    gProfilerStartTicks = GetPerformanceCounter();
+    gProfilerFrameStartTicks = gProfilerStartTicks;
+    gProfilerAverageFrameMs = 0.0f;
+    gProfilerFrameInWindow = 0;
+    gProfilerSummaryCount = 0;
+    AtomicIncrement(&gProfilerSession);
+}
+
+//----------------------------------------------------------------------------------------
+
+void ShutdownProfiler()
+{
+    gProfilerEnabled = false;
+    gProfilerEnableRequested = false;
+    if (gProfilerAllocator == nullptr)
+    {
+        return;
+    }
+
+    // Invalidate the thread local pointers before releasing the buffers
+    AtomicIncrement(&gProfilerSession);
+    ProfileThreadBuffer* buffer = static_cast<ProfileThreadBuffer*>(gProfilerThreadBuffers);
+    gProfilerThreadBuffers = nullptr;
+    while (buffer != nullptr)
+    {
+        ProfileThreadBuffer* next = buffer->mNext;
+        PG_DELETE(gProfilerAllocator, buffer);
+        buffer = next;
+    }
+    AtomicStore(&gProfilerThreadCount, 0);
+    gProfilerSummaryCount = 0;
+    gProfilerAllocator = nullptr;
+}
+
+//----------------------------------------------------------------------------------------
+
+void SetProfilerEnabled(bool enabled)
+{
+    gProfilerEnableRequested = enabled;
+}
+
+//----------------------------------------------------------------------------------------
+
+void BeginProfileScope(const char* name)
+{
+    ProfileThreadBuffer* buffer = GetThreadBuffer();
+    if (buffer != nullptr)
+    {
+        if (buffer->mDepth < PROFILER_MAX_DEPTH)
+        {
+            buffer->mStackNames[buffer->mDepth] = name;
+            buffer->mStackStarts[buffer->mDepth] = GetPerformanceCounter();
+        }
+        ++buffer->mDepth;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void EndProfileScope()
+{
+    ProfileThreadBuffer* buffer = GetThreadBuffer();
+    if (buffer != nullptr && buffer->mDepth > 0)
+    {
+        const unsigned int depth = --buffer->mDepth;
+        if (depth < PROFILER_MAX_DEPTH)
+        {
+            const unsigned int writeCount = static_cast<unsigned int>(buffer->mWriteCount);
+            ProfileEvent& evt = buffer->mEvents[writeCount & (PROFILER_EVENT_CAPACITY - 1)];
+            evt.mName = buffer->mStackNames[depth];
+            evt.mStart = buffer->mStackStarts[depth];
+            evt.mEnd = GetPerformanceCounter();
+            evt.mDepth = depth;
+
+            // Publish the event, the increment is a full barrier
+            AtomicIncrement(&buffer->mWriteCount);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Find the summary record of a scope name, creating it if needed
+//! \return Record of the scope, nullptr if the summary is full
+static ProfileSummaryRecord* FindOrAddSummaryRecord(const char* name)
+{
+    for (unsigned int i = 0; i < gProfilerSummaryCount; ++i)
+    {
+        const char* recordName = gProfilerSummary[i].mEntry.mName;
+        if (recordName == name || strcmp(recordName, name) == 0)
+        {
+            return &gProfilerSummary[i];
+        }
+    }
+
+    if (gProfilerSummaryCount < PROFILER_MAX_SUMMARY_ENTRIES)
+    {
+        ProfileSummaryRecord& record = gProfilerSummary[gProfilerSummaryCount++];
+        memset(&record, 0, sizeof(record));
+        record.mEntry.mName = name;
+        return &record;
+    }
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Accumulate the events published since the last frame into the summary, then roll the statistics
+static void UpdateProfileSummary()
+{
+    for (ProfileThreadBuffer* buffer = static_cast<ProfileThreadBuffer*>(gProfilerThreadBuffers); buffer != nullptr; buffer = buffer->mNext)
+    {
+        const unsigned int writeCount = static_cast<unsigned int>(AtomicLoad(&buffer->mWriteCount));
+        unsigned int cursor = buffer->mSummaryCursor;
+        if (writeCount - cursor > PROFILER_EVENT_CAPACITY)
+        {
+            // The summary fell behind, the oldest events are lost
+            cursor = writeCount - PROFILER_EVENT_CAPACITY;
+        }
+
+        for (; cursor != writeCount; ++cursor)
+        {
+            const ProfileEvent& evt = buffer->mEvents[cursor & (PROFILER_EVENT_CAPACITY - 1)];
+            ProfileSummaryRecord* record = FindOrAddSummaryRecord(evt.mName);
+            if (record != nullptr)
+            {
+                record->mFrameTicks += evt.mEnd - evt.mStart;
+                ++record->mFrameCalls;
+            }
+        }
+        buffer->mSummaryCursor = writeCount;
+    }
+
+    const bool windowEnd = ++gProfilerFrameInWindow >= PROFILER_SUMMARY_WINDOW;
+    for (unsigned int i = 0; i < gProfilerSummaryCount; ++i)
+    {
+        ProfileSummaryRecord& record = gProfilerSummary[i];
+        const float frameMs = static_cast<float>(static_cast<double>(record.mFrameTicks) * gProfilerTickMs);
+        record.mEntry.mLastMs = frameMs;
+        record.mEntry.mCalls = record.mFrameCalls;
+        record.mEntry.mAverageMs += (frameMs - record.mEntry.mAverageMs) * PROFILER_AVERAGE_WEIGHT;
+        if (frameMs > record.mWindowMaxMs)
+        {
+            record.mWindowMaxMs = frameMs;
+        }
+        if (record.mWindowMaxMs > record.mEntry.mMaxMs || windowEnd)
+        {
+            record.mEntry.mMaxMs = record.mWindowMaxMs;
+        }
+        if (windowEnd)
+        {
+            record.mWindowMaxMs = 0.0f;
+        }
+        record.mFrameTicks = 0;
+        record.mFrameCalls = 0;
+    }
+    if (windowEnd)
+    {
+        gProfilerFrameInWindow = 0;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void BeginProfileFrame()
+{
+    if (gProfilerEnabled)
+    {
+        EndProfileScope();
+    }
+
+    const unsigned long long now = GetPerformanceCounter();
+    const float frameMs = static_cast<float>(static_cast<double>(now - gProfilerFrameStartTicks) * gProfilerTickMs);
+    gProfilerFrameStartTicks = now;
+
+    if (gProfilerEnabled)
+    {
+        gProfilerAverageFrameMs += (frameMs - gProfilerAverageFrameMs) * PROFILER_AVERAGE_WEIGHT;
+        UpdateProfileSummary();
+    }
+
+    gProfilerEnabled = gProfilerEnableRequested && gProfilerAllocator != nullptr;
+    if (gProfilerEnabled)
+    {
+        BeginProfileScope(PROFILER_FRAME_SCOPE_NAME);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int GetProfileSummaryEntryCount()
+{
+    return gProfilerSummaryCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+const ProfileSummaryEntry& GetProfileSummaryEntry(unsigned int index)
+{
+    PG_ASSERTSTR(index < gProfilerSummaryCount, "Invalid profiler summary entry index (%u)", index);
+    return gProfilerSummary[index].mEntry;
+}
+
+//----------------------------------------------------------------------------------------
+
+const ProfileSummaryEntry* FindProfileSummaryEntry(const char* name)
+{
+    for (unsigned int i = 0; i < gProfilerSummaryCount; ++i)
+    {
+        if (strcmp(gProfilerSummary[i].mEntry.mName, name) == 0)
+        {
+            return &gProfilerSummary[i].mEntry;
+        }
+    }
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------------------
+
+float GetProfileAverageFrameTime()
+{
+    return gProfilerAverageFrameMs;
+}
+
+//----------------------------------------------------------------------------------------
+
+void LogProfileSummary()
+{
+    PG_LOG('APPL', "Profiler summary: average frame %.3f ms, %u scopes", gProfilerAverageFrameMs, gProfilerSummaryCount);
+
+    // Selection sort on the average time, printed entries are flagged
+    bool printed[PROFILER_MAX_SUMMARY_ENTRIES];
+    memset(printed, 0, sizeof(printed));
+    for (unsigned int n = 0; n < gProfilerSummaryCount; ++n)
+    {
+        int best = -1;
+        for (unsigned int i = 0; i < gProfilerSummaryCount; ++i)
+        {
+            if (!printed[i] && (best < 0 || gProfilerSummary[i].mEntry.mAverageMs > gProfilerSummary[best].mEntry.mAverageMs))
+            {
+                best = static_cast<int>(i);
+            }
+        }
+        printed[best] = true;
+
+        const ProfileSummaryEntry& entry = gProfilerSummary[best].mEntry;
+        PG_LOG('APPL', "  %-32s avg %8.3f ms  max %8.3f ms  last %8.3f ms  calls %u",
+               entry.mName, entry.mAverageMs, entry.mMaxMs, entry.mLastMs, entry.mCalls);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Append a null terminated string to a stream
+static void AppendTraceText(Utils::ByteStream& stream, const char* text)
+{
+    stream.Append(text, static_cast<int>(strlen(text)));
+}
+
+//! Append a string to a stream as a JSON string
+static void AppendTraceString(Utils::ByteStream& stream, const char* str)
+{
+    stream.Append("\"", 1);
+    for (const char* c = str; *c != '\0'; ++c)
+    {
+        if (*c == '\\' || *c == '"')
+        {
+            stream.Append("\\", 1);
+            stream.Append(c, 1);
+        }
+        else if (static_cast<unsigned char>(*c) >= 0x20)
+        {
+            stream.Append(c, 1);
+        }
+    }
+    stream.Append("\"", 1);
+}
+
+//----------------------------------------------------------------------------------------
+
+void WriteChromeTrace(Utils::ByteStream& stream)
+{
+    char buffer[256];
+    bool first = true;
+    AppendTraceText(stream, "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+    for (ProfileThreadBuffer* threadBuffer = static_cast<ProfileThreadBuffer*>(gProfilerThreadBuffers); threadBuffer != nullptr; threadBuffer = threadBuffer->mNext)
+    {
+        sprintf_s(buffer, sizeof(buffer), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s %u\"}}",
+                  first ? "" : ",", threadBuffer->mThreadIndex, threadBuffer->mThreadIndex == 0 ? "Main thread" : "Thread", threadBuffer->mThreadIndex);
+        AppendTraceText(stream, buffer);
+        first = false;
+
+        const unsigned int writeCount = static_cast<unsigned int>(AtomicLoad(&threadBuffer->mWriteCount));
+        const unsigned int eventCount = writeCount < PROFILER_EVENT_CAPACITY ? writeCount : PROFILER_EVENT_CAPACITY;
+        for (unsigned int e = writeCount - eventCount; e != writeCount; ++e)
+        {
+            const ProfileEvent& evt = threadBuffer->mEvents[e & (PROFILER_EVENT_CAPACITY - 1)];
+            AppendTraceText(stream, ",{\"name\":");
+            AppendTraceString(stream, evt.mName);
+            sprintf_s(buffer, sizeof(buffer), ",\"cat\":\"cpu\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":1,\"tid\":%u}",
+                      static_cast<double>(evt.mStart - gProfilerStartTicks) * gProfilerTickMs * 1000.0,
+                      static_cast<double>(evt.mEnd - evt.mStart) * gProfilerTickMs * 1000.0,
+                      threadBuffer->mThreadIndex);
+            AppendTraceText(stream, buffer);
+        }
+    }
+
+    AppendTraceText(stream, "]}");
+}
+
+//----------------------------------------------------------------------------------------
+
+Io::IoError SaveChromeTrace(Io::IOManager* ioManager, const char* relativePath)
+{
+    if (gProfilerAllocator == nullptr)
+    {
+        return Io::ERR_WRITING_FILE;
+    }
+
+    Utils::ByteStream stream(gProfilerAllocator);
+    WriteChromeTrace(stream);
+
+    Io::FileBuffer fileBuffer;
+    fileBuffer.OwnBuffer(gProfilerAllocator, static_cast<char*>(stream.GetBuffer()), stream.GetSize());
+    const Io::IoError result = ioManager->SaveFileToBuffer(relativePath, fileBuffer);
+    fileBuffer.ForgetBuffer();
+    return result;
+}
+
+
+}   // namespace Core
+}   // namespace Pegasus
@@ -128,11 +128,11 @@ void SourceCode::OnWriteAsset(Pegasus::AssetLib::AssetLib* lib, Pegasus::AssetLi
     int srcLen = 0;
     GetSource(&src, srcLen);
     Io::FileBuffer* fb = asset->Raw();
-    if (srcLen > fb->GetBufferSize())
+    if (srcLen > fb->GetBufferSize() || fb->IsMapped())
     {
-        Pegasus::Alloc::IAllocator* alloc = fb->GetAllocator();
+        //the buffer of the asset is released once read, so it has no allocator anymore
         fb->DestroyBuffer();
-        fb->OwnBuffer(alloc, PG_NEW_ARRAY(alloc, -1, "", Alloc::PG_MEM_TEMP, char, srcLen), srcLen);
+        fb->OwnBuffer(mAllocator, PG_NEW_ARRAY(mAllocator, -1, "", Alloc::PG_MEM_TEMP, char, srcLen), srcLen);
     }
     fb->SetFileSize(srcLen);
     Utils::Memcpy(fb->GetBuffer(), src, srcLen);
@@ -0,0 +1,218 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Thread.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Parallel execution of independent jobs on worker threads
+
+#include "Pegasus/Core/Thread.h"
+#include "Pegasus/Core/Atomic.h"
+#include "Pegasus/Core/Assertion.h"
+#include "../Source/Pegasus/Core/Platform/NativeThread.h"
+
+namespace Pegasus {
+namespace Core {
+
+
+namespace internal {
+
+//! Jobs of a RunParallelJobs() call, shared by its workers
+struct ParallelJobs
+{
+    ParallelJobFunc mJobFunc;
+    void* mUserData;
+    long mJobCount;
+    AtomicInt mNextJob;             //!< Index of the next job to run, can exceed mJobCount once all are taken
+    AtomicInt mNextWorkerIndex;     //!< Last worker index given to a pool thread joining the call
+    AtomicInt mRunningPoolThreads;  //!< Number of pool threads that did not finish their jobs yet
+};
+
+//! Worker threads kept alive between RunParallelJobs() calls, sleeping on a semaphore while they have no job.
+//! Lives in static storage without constructor, so it is usable before and after static initialization
+struct WorkerPool
+{
+    AtomicInt mBusy;                                    //!< 1 while a call owns the pool, calls finding it busy run their jobs inline
+    bool mInitialized;                                  //!< True once the semaphores are created
+    unsigned int mThreadCount;                          //!< Number of running pool threads
+    NativeThread mThreads[MAX_PARALLEL_WORKERS - 1];    //!< Pool threads, the calling thread being the remaining worker
+    NativeSemaphore mWakeSemaphore;                     //!< Signaled once per pool thread joining a call
+    NativeSemaphore mDoneSemaphore;                     //!< Signaled by the last pool thread finishing the jobs of a call
+    ParallelJobs* volatile mJobs;                       //!< Jobs of the current call, nullptr to stop the woken threads
+};
+
+static WorkerPool sWorkerPool;
+
+//! Run jobs until all of them are taken
+//! \param jobs Jobs of the call
+//! \param workerIndex Index of the running worker
+static void RunJobs(ParallelJobs& jobs, unsigned int workerIndex)
+{
+    for (;;)
+    {
+        const long jobIndex = AtomicIncrement(&jobs.mNextJob) - 1;
+        if (jobIndex >= jobs.mJobCount)
+        {
+            break;
+        }
+        jobs.mJobFunc(jobs.mUserData, static_cast<unsigned int>(jobIndex), workerIndex);
+    }
+}
+
+//! Entry point of the pool threads, running the jobs of each call they are woken up for
+//! \param arg Unused
+static void PoolThreadEntry(void* arg)
+{
+    for (;;)
+    {
+        NativeWaitSemaphore(sWorkerPool.mWakeSemaphore);
+        ParallelJobs* jobs = sWorkerPool.mJobs;
+        if (jobs == nullptr)
+        {
+            break;
+        }
+
+        const unsigned int workerIndex = static_cast<unsigned int>(AtomicIncrement(&jobs->mNextWorkerIndex));
+        RunJobs(*jobs, workerIndex);
+        if (AtomicDecrement(&jobs->mRunningPoolThreads) == 0)
+        {
+            NativeSignalSemaphore(sWorkerPool.mDoneSemaphore, 1);
+        }
+    }
+}
+
+//! Start pool threads until the pool has enough of them for a call. The caller owns the pool
+//! \param threadCount Number of pool threads wanted, < MAX_PARALLEL_WORKERS
+//! \return Number of pool threads usable by the call, lower than threadCount if the system cannot create more
+static unsigned int ReservePoolThreads(unsigned int threadCount)
+{
+    if (!sWorkerPool.mInitialized)
+    {
+        if (!NativeCreateSemaphore(sWorkerPool.mWakeSemaphore))
+        {
+            return 0;
+        }
+        if (!NativeCreateSemaphore(sWorkerPool.mDoneSemaphore))
+        {
+            NativeDestroySemaphore(sWorkerPool.mWakeSemaphore);
+            return 0;
+        }
+        sWorkerPool.mInitialized = true;
+    }
+
+    while (sWorkerPool.mThreadCount < threadCount)
+    {
+        if (!NativeStartThread(sWorkerPool.mThreads[sWorkerPool.mThreadCount], PoolThreadEntry, nullptr))
+        {
+            return sWorkerPool.mThreadCount;
+        }
+        ++sWorkerPool.mThreadCount;
+    }
+    return threadCount;
+}
+
+}   // namespace internal
+
+//----------------------------------------------------------------------------------------
+
+unsigned int GetHardwareThreadCount()
+{
+    return internal::NativeGetHardwareThreadCount();
+}
+
+//----------------------------------------------------------------------------------------
+
+void RunParallelJobs(ParallelJobFunc jobFunc, void* userData, unsigned int jobCount, unsigned int workerCount)
+{
+    PG_ASSERTSTR(jobFunc != nullptr, "Invalid job function for parallel jobs");
+    if (jobCount == 0)
+    {
+        return;
+    }
+
+    if (workerCount == 0)
+    {
+        workerCount = GetHardwareThreadCount();
+    }
+    if (workerCount > jobCount)
+    {
+        workerCount = jobCount;
+    }
+    if (workerCount > MAX_PARALLEL_WORKERS)
+    {
+        workerCount = MAX_PARALLEL_WORKERS;
+    }
+
+    internal::ParallelJobs jobs;
+    jobs.mJobFunc = jobFunc;
+    jobs.mUserData = userData;
+    jobs.mJobCount = static_cast<long>(jobCount);
+    jobs.mNextJob = 0;
+    jobs.mNextWorkerIndex = 0;
+    jobs.mRunningPoolThreads = 0;
+
+    //a single worker, or a pool owned by another call (nested or from another thread), runs every job on the calling thread
+    internal::WorkerPool& pool = internal::sWorkerPool;
+    if (workerCount == 1 || AtomicCompareExchange(&pool.mBusy, 1, 0) != 0)
+    {
+        internal::RunJobs(jobs, 0);
+        return;
+    }
+
+    //the calling thread is worker 0, pool threads take the next indices as they wake up
+    const unsigned int poolThreadCount = internal::ReservePoolThreads(workerCount - 1);
+    if (poolThreadCount > 0)
+    {
+        jobs.mRunningPoolThreads = static_cast<long>(poolThreadCount);
+        pool.mJobs = &jobs;
+        internal::NativeSignalSemaphore(pool.mWakeSemaphore, poolThreadCount);
+    }
+
+    internal::RunJobs(jobs, 0);
+
+    if (poolThreadCount > 0)
+    {
+        internal::NativeWaitSemaphore(pool.mDoneSemaphore);
+        pool.mJobs = nullptr;
+    }
+    AtomicStore(&pool.mBusy, 0);
+}
+
+//----------------------------------------------------------------------------------------
+
+void ShutdownParallelJobs()
+{
+    internal::WorkerPool& pool = internal::sWorkerPool;
+    if (AtomicCompareExchange(&pool.mBusy, 1, 0) != 0)
+    {
+        PG_FAILSTR("Parallel jobs are shut down while running");
+        return;
+    }
+
+    if (pool.mInitialized)
+    {
+        //woken up with no jobs, the pool threads return from their entry point
+        pool.mJobs = nullptr;
+        if (pool.mThreadCount > 0)
+        {
+            internal::NativeSignalSemaphore(pool.mWakeSemaphore, pool.mThreadCount);
+        }
+        for (unsigned int t = 0; t < pool.mThreadCount; ++t)
+        {
+            internal::NativeJoinThread(pool.mThreads[t]);
+        }
+        pool.mThreadCount = 0;
+
+        internal::NativeDestroySemaphore(pool.mDoneSemaphore);
+        internal::NativeDestroySemaphore(pool.mWakeSemaphore);
+        pool.mInitialized = false;
+    }
+    AtomicStore(&pool.mBusy, 0);
+}
+
+
+}   // namespace Core
+}   // namespace Pegasus
@@ -10,6 +10,7 @@
 //! \brief	Base generator node class, for all data generators with no input node
 
 #include "Pegasus/Graph/GeneratorNode.h"
+#include "Pegasus/Graph/NodeDataInterner.h"
 
 namespace Pegasus {
 namespace Graph {
@@ -35,44 +36,66 @@ GeneratorNode::GeneratorNode(Alloc::IAllocator* nodeAllocator, Alloc::IAllocator
 
 bool GeneratorNode::Update()
 {
-    if (IsDataAllocated() && IsPropertyGridDirty())
-    {
-        // If the property grid has members that are updated, invalidate the data
-        GetData()->Invalidate();
-    }
-
-    // Validate the property grid to track any subsequent changes
-    ValidatePropertyGrid();
-
-    // Since the node is a generator, there is no input node to check.
-    // We directly return the state of the node data.
-    return IsDataDirty();
+    // Property changes invalidate the node as soon as they happen,
+    // and since the node is a generator, there is no input node to check.
+    // We directly return the state of the node.
+    return IsNodeDirty();
 }
 
 //----------------------------------------------------------------------------------------
 
 NodeDataReturn GeneratorNode::GetUpdatedData(bool & updated)
 {
-    // If the data has not been allocated, allocate it now
-    if (!IsDataAllocated())
+    // Fast path, nothing has changed since the last generation
+    if (IsDataAllocated() && !IsNodeDirty())
     {
-        CreateData();
+        return GetData();
     }
-    PG_ASSERTSTR(IsDataAllocated(), "Node data has to be allocated when being updated");
 
-    // If the data is dirty, re-generate it
+    // If the data is dirty, re-generate it, unless an identical node shares its data
     if (IsDataDirty())
     {
-        // No need to re-invalidate the GPU data, it is automatically invalidated
-        // when the node data is invalidated
-
-        // Generate the node data using the generator-specific code
-        GenerateData();
-
-        // Validate the node data, the GPU node data is still dirty
-        GetData()->Validate();
-
-        updated = true;
+        NodeDataKey key;
+        const bool shareable = BuildDataKey(key);
+        if (shareable && AdoptInternedData(key))
+        {
+            ValidateNode(true);
+            updated = true;
+        }
+        else
+        {
+            // If the data has not been allocated, allocate it now
+            if (!IsDataAllocated())
+            {
+                CreateData();
+            }
+            else
+            {
+                // The CPU copy may have been discarded after the last upload
+                GetData()->RestoreCPUData();
+            }
+            PG_ASSERTSTR(IsDataAllocated(), "Node data has to be allocated when being updated");
+
+            // No need to re-invalidate the GPU data, it is automatically invalidated
+            // when the node data is invalidated
+
+            // Generate the node data using the generator-specific code
+            GenerateAndCompleteData();
+
+            // Validate the node data, the GPU node data is still dirty
+            GetData()->Validate();
+            ValidateNode(true);
+            if (shareable)
+            {
+                InternData(key);
+            }
+
+            updated = true;
+        }
+    }
+    else
+    {
+        ValidateNode(false);
     }
     PG_ASSERTSTR(!IsDataDirty(), "Node data is supposed to be up-to-date at this point");
 
@@ -11,9 +11,13 @@
 
 #include "Pegasus/Graph/Node.h"
 #include "Pegasus/Graph/NodeManager.h"
+#include "Pegasus/Graph/NodeDataInterner.h"
+#include "Pegasus/Graph/NodeDataResidency.h"
+#include "Pegasus/Core/Profiler.h"
 #include "Pegasus/AssetLib/Asset.h"
 #include "Pegasus/AssetLib/ASTree.h"
 #include "Pegasus/Utils/String.h"
+#include "Pegasus/Utils/Memcpy.h"
 
 using namespace Pegasus::AssetLib;
 
@@ -31,6 +35,13 @@ Node::Node(Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocato
 ,   mNodeAllocator(nodeAllocator)
 ,   mNodeDataAllocator(nodeDataAllocator)
 ,   mNumInputs(0)
+,   mDependents(nullptr)
+,   mNumDependents(0)
+,   mDependentsCapacity(0)
+,   mGeneration(0)
+,   mNodeDirty(true)
+,   mDataInterner(nullptr)
+,   mTransientDataAllocator(nullptr)
 #if PEGASUS_ENABLE_PROXIES
 ,   mProxy(this)
 #endif
@@ -41,6 +52,11 @@ Node::Node(Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocato
     PG_ASSERTSTR(nodeAllocator != nullptr, "Invalid node allocator given to a Node");
     PG_ASSERTSTR(nodeDataAllocator != nullptr, "Invalid node data allocator given to a Node");
 
+    for (unsigned int i = 0; i < MAX_NUM_INPUTS; ++i)
+    {
+        mInputGenerations[i] = 0;
+    }
+
 #if PEGASUS_ENABLE_PROXIES
     mNodeType = NODETYPE_UNKNOWN;
 #endif  // PEGASUS_ENABLE_PROXIES
@@ -58,6 +74,13 @@ Node::~Node()
 
     // Destroy the node data if present
     ReleaseData();
+
+    // The dependent nodes hold references to the current node, so none can be left
+    PG_ASSERTSTR(mNumDependents == 0, "Destroying a node still used as an input by %d nodes", mNumDependents);
+    if (mDependents != nullptr)
+    {
+        PG_DELETE_ARRAY(mNodeAllocator, mDependents);
+    }
 }
 
 //----------------------------------------------------------------------------------------
@@ -101,7 +124,7 @@ bool Node::IsInput(const Pegasus::Core::Ref<Node> & inputNode) const
 NodeDataReturn Node::GetUpdatedData(bool & updated)
 {
     // If the data is allocated and not dirty, it can be returned directly
-    if (IsDataAllocated() && !mData->IsDirty())
+    if (IsDataAllocated() && !IsNodeDirty())
     {
         return mData;
     }
@@ -157,14 +180,322 @@ void Node::CreateData()
 
 void Node::InvalidateData()
 {
+    DetachOrInvalidateData();
+
+    // Always reach the direct dependent nodes, even if the current node is already dirty,
+    // in case one of them has been validated on its own since. Each path of the propagation
+    // stops at its first dirty node
+    mNodeDirty = false;
+    PropagateDirty();
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::ValidateNode(bool generated)
+{
+    if (generated)
+    {
+        ++mGeneration;
+    }
+    mNodeDirty = false;
+
+    // Validate the property grid to track any subsequent changes
+    ValidatePropertyGrid();
+}
+
+//----------------------------------------------------------------------------------------
+
+bool Node::UpdateInputGenerations()
+{
+    bool inputChanged = false;
+    for (unsigned int i = 0; i < mNumInputs; ++i)
+    {
+        const unsigned int inputGeneration = mInputs[i]->GetGeneration();
+        if (inputGeneration != mInputGenerations[i])
+        {
+            mInputGenerations[i] = inputGeneration;
+            inputChanged = true;
+        }
+    }
+    return inputChanged;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::OnPropertyGridInvalidated()
+{
+    // The content of the data depends on the properties, so the data is invalidated
+    // even if not allocated, to regenerate it when the data is recreated
+    InvalidateData();
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::SetDataInterner(NodeDataInterner * interner)
+{
+    PG_ASSERTSTR(mData == nullptr || !mData->IsInterned(), "Cannot change the data interner of a node using shared data");
+    mDataInterner = interner;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::SetTransientDataAllocator(Alloc::IAllocator * transientAllocator)
+{
+    mTransientDataAllocator = transientAllocator;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool Node::WriteDataKey(NodeDataKey & key) const
+{
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool Node::BuildDataKey(NodeDataKey & key) const
+{
+    if ((mDataInterner == nullptr) || !mDataInterner->IsEnabled() || (GetNumObjectProperties() > 0))
+    {
+        return false;
+    }
+
+    // The class defines the generation code
+    const PropertyGrid::PropertyGridClassInfo * classInfo = GetClassInfo();
+    key.WriteValue(classInfo);
+
+    // Property values, skipping the properties shared by every object, such as the name
+    const unsigned int numClassProperties = GetNumClassProperties();
+    for (unsigned int p = PropertyGridObject::GetStaticClassInfo()->GetNumClassProperties(); p < numClassProperties; ++p)
+    {
+        const PropertyGrid::PropertyRecord & record = GetClassPropertyRecord(p);
+        unsigned char value[64];
+        if (record.size > sizeof(value))
+        {
+            return false;
+        }
+        GetClassReadPropertyAccessor(p).Read(value, record.size);
+        if (record.type == PropertyGrid::PROPERTYTYPE_STRING64)
+        {
+            value[sizeof(value) - 1] = '\0';
+            key.WriteString(reinterpret_cast<const char *>(value));
+        }
+        else
+        {
+            key.Write(value, record.size);
+        }
+    }
+
+    // Inputs are identified by their data, which has to be interned to be unique
+    key.WriteValue(mNumInputs);
+    for (unsigned int i = 0; i < mNumInputs; ++i)
+    {
+        const NodeData * inputData = &(*mInputs[i]->mData);
+        if ((inputData == nullptr) || !inputData->IsInterned())
+        {
+            return false;
+        }
+        key.WriteInput(inputData);
+    }
+
+    return WriteDataKey(key) && key.IsValid();
+}
+
+//----------------------------------------------------------------------------------------
+
+bool Node::AdoptInternedData(const NodeDataKey & key)
+{
+    NodeDataRef sharedData = mDataInterner->Find(key);
+    if (sharedData == nullptr)
+    {
+        return false;
+    }
+
+    // The previous data has been detached when the node became dirty, so it can be dropped
     if (mData != nullptr)
     {
-        mData->Invalidate();
+        PG_ASSERTSTR(!mData->IsInterned(), "A node cannot adopt shared data while using other shared data");
+        mDataInterner->ReleaseNodeData(mData);
+    }
+    mData = sharedData;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::InternData(const NodeDataKey & key)
+{
+    mDataInterner->Insert(key, mData);
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::DetachOrInvalidateData()
+{
+    if (mData != nullptr)
+    {
+        if (mData->IsInterned() && (mDataInterner != nullptr) && mDataInterner->Detach(mData))
+        {
+            // Other nodes use the data, keep it intact for them
+            mData = nullptr;
+        }
+        else
+        {
+            mData->Invalidate();
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::PropagateDirty()
+{
+    if (mNodeDirty)
+    {
+        // The dependent nodes have been marked when the flag was set
+        return;
+    }
+
+    mNodeDirty = true;
+    DetachOrInvalidateData();
+
+    for (unsigned int d = 0; d < mNumDependents; ++d)
+    {
+        mDependents[d]->PropagateDirty();
     }
 }
 
 //----------------------------------------------------------------------------------------
 
+bool Node::RestoreCPUData()
+{
+    if (IsNodeDirty())
+    {
+        // The data needs a new generation anyway, which allocates the CPU copy
+        bool updated = false;
+        (void) GetUpdatedData(updated);
+        return updated;
+    }
+
+    if (mData->IsCPUDataResident())
+    {
+        if (mData->mResidency != nullptr)
+        {
+            mData->mResidency->Touch(mData);
+        }
+        return false;
+    }
+
+    // Same content as the uploaded one, so the GPU data and the generation stay valid
+    NodeDataResidency * residency = mData->mResidency;
+    mData->RestoreCPUData();
+    RestoreInputCPUData();
+    GenerateAndCompleteData();
+    if (residency != nullptr)
+    {
+        residency->OnCPUDataRestored(mData);
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::RestoreInputCPUData()
+{
+    for (unsigned int i = 0; i < mNumInputs; ++i)
+    {
+        // Inputs without data are regenerated when the generation asks for their data
+        if (mInputs[i]->mData != nullptr)
+        {
+            (void) mInputs[i]->RestoreCPUData();
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::GenerateAndCompleteData()
+{
+    PG_ASSERTSTR(mData != nullptr, "Node data has to be allocated when being generated");
+    PG_PROFILE_SCOPE(GetClassInfo()->GetClassName());
+    GenerateData();
+    mData->CompleteGeneration();
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::ReleaseTransientInputData()
+{
+    for (unsigned int i = 0; i < mNumInputs; ++i)
+    {
+        mInputs[i]->ReleaseTransientData();
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::ReleaseTransientData()
+{
+    // Shared data, data with GPU data and data referenced outside of the node are kept
+    if ((mTransientDataAllocator == nullptr) || (mData == nullptr) || mData->IsInterned()
+        || (mData->GetNodeGPUData() != nullptr) || (mData->GetRefCount() > 1))
+    {
+        return;
+    }
+
+    // A dependent node that still has to be generated will read the data soon
+    for (unsigned int d = 0; d < mNumDependents; ++d)
+    {
+        if (mDependents[d]->mNodeDirty || mDependents[d]->RetainsInputData())
+        {
+            return;
+        }
+    }
+
+    // The node stays clean, the missing data makes it regenerate when asked for it.
+    // The buffers go back to the pool for the next transient data of the same size
+    ReleaseData();
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::AddDependent(Node * dependent)
+{
+    if (mNumDependents >= mDependentsCapacity)
+    {
+        const unsigned int newCapacity = (mDependentsCapacity == 0) ? 4 : mDependentsCapacity * 2;
+        Node ** newDependents = PG_NEW_ARRAY(mNodeAllocator, -1, "Node dependents", Alloc::PG_MEM_PERM, Node *, newCapacity);
+        if (mDependents != nullptr)
+        {
+            Utils::Memcpy(newDependents, mDependents, mNumDependents * sizeof(Node *));
+            PG_DELETE_ARRAY(mNodeAllocator, mDependents);
+        }
+        mDependents = newDependents;
+        mDependentsCapacity = newCapacity;
+    }
+
+    mDependents[mNumDependents++] = dependent;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Node::RemoveDependent(Node * dependent)
+{
+    for (unsigned int d = 0; d < mNumDependents; ++d)
+    {
+        if (mDependents[d] == dependent)
+        {
+            // The order of the dependent nodes does not matter, move the last one in the hole
+            mDependents[d] = mDependents[--mNumDependents];
+            return;
+        }
+    }
+
+    PG_FAILSTR("Trying to unregister a dependent node that has not been registered");
+}
+
+//----------------------------------------------------------------------------------------
+
 void Node::AddInput(const Pegasus::Core::Ref<Node> & inputNode)
 {
     if (inputNode == nullptr)
@@ -186,13 +517,12 @@ void Node::AddInput(const Pegasus::Core::Ref<Node> & inputNode)
     }
 
     mInputs[mNumInputs] = inputNode;
+    mInputGenerations[mNumInputs] = 0;
     ++mNumInputs;
+    inputNode->AddDependent(this);
 
     // Since an input node has been added, that means the node data is dirty
-    if (mData != nullptr)
-    {
-        mData->Invalidate();
-    }
+    InvalidateData();
 }
 
 //----------------------------------------------------------------------------------------
@@ -225,13 +555,16 @@ void Node::ReplaceInput(unsigned int index, const Pegasus::Core::Ref<Node> & inp
     if (inputNode != mInputs[index])
     {
         // Replace the node (releases the previous node)
+        if (mInputs[index] != nullptr)
+        {
+            mInputs[index]->RemoveDependent(this);
+        }
+        inputNode->AddDependent(this);
         mInputs[index] = inputNode;
+        mInputGenerations[index] = 0;
 
         // Since an input node has been changed, that means the node data is dirty
-        if (mData != nullptr)
-        {
-            mData->Invalidate();
-        }
+        InvalidateData();
     }
 }
 
@@ -258,6 +591,7 @@ void Node::RemoveInput(const Pegasus::Core::Ref<Node> & inputNode)
                 OnRemoveInput((unsigned int)i);
 
                 // Remove the input node
+                mInputs[i]->RemoveDependent(this);
                 mInputs[i] = nullptr;
                 --mNumInputs;
 
@@ -265,6 +599,7 @@ void Node::RemoveInput(const Pegasus::Core::Ref<Node> & inputNode)
                 for (int j = i; j < (int)mNumInputs; ++j)
                 {
                     mInputs[j] = mInputs[j + 1];
+                    mInputGenerations[j] = mInputGenerations[j + 1];
                 }
 
                 // Remove the duplicated reference at the end of the array
@@ -274,9 +609,9 @@ void Node::RemoveInput(const Pegasus::Core::Ref<Node> & inputNode)
     }
 
     // If an input node has been removed, that means the node data is dirty
-    if (nodeFound && (mData != nullptr))
+    if (nodeFound)
     {
-        mData->Invalidate();
+        InvalidateData();
     }
 
     PG_ASSERTSTR(nodeFound, "Trying to remove an input node from the current node, but the input node has not been found");
@@ -295,6 +630,7 @@ void Node::RemoveAllInputs()
             OnRemoveInput((unsigned int)i);
 
             // Remove the input node
+            mInputs[i]->RemoveDependent(this);
             mInputs[i] = nullptr;
         }
         else
@@ -304,6 +640,9 @@ void Node::RemoveAllInputs()
 
         --mNumInputs;
     }
+
+    // Since the inputs have been removed, that means the node data is dirty
+    InvalidateData();
 }
 
 //----------------------------------------------------------------------------------------
@@ -384,6 +723,7 @@ bool Node::ReadFromObject(NodeManager* nodeManager, const AssetLib::Asset* paren
         }
 
         NodeRef inputNode = nodeManager->CreateNode(e.o->GetString(nodeClassId));
+        inputNode->SetDataInterner(mDataInterner);
         if (!inputNode->ReadFromObject(nodeManager, parentAsset, e.o))
         {
             return false;
@@ -10,6 +10,7 @@
 //! \brief	Base node data class for all graph-based systems (textures, meshes, etc.)
 
 #include "Pegasus/Graph/NodeData.h"
+#include "Pegasus/Graph/NodeDataResidency.h"
 
 namespace Pegasus {
 namespace Graph {
@@ -20,7 +21,14 @@ NodeData::NodeData(Alloc::IAllocator * allocator)
     mRefCount(0),
     mNodeGPUData(nullptr),
     mDirty(true),
-    mGPUDataDirty(true)
+    mGPUDataDirty(true),
+    mInterned(false),
+    mNumInternedDependents(0),
+    mCPUDataResident(true),
+    mResidency(nullptr),
+    mResidencyPrev(nullptr),
+    mResidencyNext(nullptr),
+    mResidencyBytes(0)
 {
 }
 
@@ -29,6 +37,48 @@ NodeData::NodeData(Alloc::IAllocator * allocator)
 NodeData::~NodeData()
 {
     PG_ASSERTSTR(mNodeGPUData == nullptr, "GPU data not freed! this means there is a memory leak.");
+    if (mResidency != nullptr)
+    {
+        mResidency->Remove(this);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int NodeData::DiscardCPUData()
+{
+    if (!mCPUDataResident)
+    {
+        return 0;
+    }
+
+    // The residency lists depend on the state of the CPU copy
+    if (mResidency != nullptr)
+    {
+        mResidency->Remove(this);
+    }
+
+    const unsigned int releasedBytes = ReleaseCPUBuffers();
+    if (releasedBytes > 0)
+    {
+        mCPUDataResident = false;
+    }
+    return releasedBytes;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeData::RestoreCPUData()
+{
+    if (!mCPUDataResident)
+    {
+        if (mResidency != nullptr)
+        {
+            mResidency->Remove(this);
+        }
+        AllocateCPUBuffers();
+        mCPUDataResident = true;
+    }
 }
 
 //----------------------------------------------------------------------------------------
@@ -0,0 +1,406 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NodeDataInterner.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Table sharing one node data between structurally identical nodes (hash consing)
+
+#include "Pegasus/Graph/NodeDataInterner.h"
+#include "Pegasus/Allocator/Alloc.h"
+#include "Pegasus/Core/Log.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+namespace Pegasus {
+namespace Graph {
+
+
+//! Number of slots of the hash table, power of 2 twice as big as the number of entries
+static const unsigned int SLOT_COUNT = 2 * NodeDataInterner::MAX_ENTRIES;
+
+//! FNV-1a constants
+static const unsigned int FNV_OFFSET_BASIS = 2166136261u;
+static const unsigned int FNV_PRIME = 16777619u;
+
+//----------------------------------------------------------------------------------------
+
+NodeDataKey::NodeDataKey()
+:   mSize(0)
+,   mHash(FNV_OFFSET_BASIS)
+,   mNumInputs(0)
+,   mValid(true)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataKey::Write(const void * data, unsigned int size)
+{
+    if (!mValid)
+    {
+        return;
+    }
+    if (mSize + size > MAX_SIZE)
+    {
+        mValid = false;
+        return;
+    }
+
+    const unsigned char * bytes = static_cast<const unsigned char *>(data);
+    unsigned int hash = mHash;
+    for (unsigned int b = 0; b < size; ++b)
+    {
+        mBytes[mSize + b] = bytes[b];
+        hash = (hash ^ bytes[b]) * FNV_PRIME;
+    }
+    mHash = hash;
+    mSize += size;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataKey::WriteString(const char * str)
+{
+    unsigned int length = 0;
+    while (str[length] != '\0')
+    {
+        ++length;
+    }
+    Write(str, length + 1);
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataKey::WriteInput(const NodeData * data)
+{
+    if (mNumInputs == MAX_INPUTS)
+    {
+        mValid = false;
+        return;
+    }
+    mInputs[mNumInputs++] = data;
+    WriteValue(data);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Compare the content of two keys
+//! \return True if the bytes are identical
+static bool AreKeyBytesEqual(const unsigned char * key1, const unsigned char * key2, unsigned int size)
+{
+    for (unsigned int b = 0; b < size; ++b)
+    {
+        if (key1[b] != key2[b])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+NodeDataInterner::NodeDataInterner(Alloc::IAllocator * allocator, ReleaseDataCallback releaseCallback, void * userData)
+:   mAllocator(allocator)
+,   mReleaseCallback(releaseCallback)
+,   mReleaseUserData(userData)
+,   mEntries(nullptr)
+,   mSlots(nullptr)
+,   mNumEntries(0)
+,   mNumHits(0)
+,   mNumMisses(0)
+,   mEnabled(true)
+{
+    mEntries = PG_NEW_ARRAY(mAllocator, -1, "NodeDataInterner entries", Alloc::PG_MEM_PERM, Entry, MAX_ENTRIES);
+    mSlots = PG_NEW_ARRAY(mAllocator, -1, "NodeDataInterner slots", Alloc::PG_MEM_PERM, int, SLOT_COUNT);
+    for (unsigned int s = 0; s < SLOT_COUNT; ++s)
+    {
+        mSlots[s] = -1;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+NodeDataInterner::~NodeDataInterner()
+{
+    Clear();
+    PG_DELETE_ARRAY(mAllocator, mSlots);
+    PG_DELETE_ARRAY(mAllocator, mEntries);
+}
+
+//----------------------------------------------------------------------------------------
+
+NodeDataReturn NodeDataInterner::Find(const NodeDataKey & key)
+{
+    PG_ASSERTSTR(key.IsValid(), "Invalid key used to look up node data");
+
+    const unsigned int hash = key.GetHash();
+    for (unsigned int slot = hash & (SLOT_COUNT - 1); mSlots[slot] != -1; slot = (slot + 1) & (SLOT_COUNT - 1))
+    {
+        const Entry & entry = mEntries[mSlots[slot]];
+        if (   (entry.mHash == hash)
+            && (entry.mKeySize == key.GetSize())
+            && AreKeyBytesEqual(entry.mKey, key.GetBytes(), key.GetSize()))
+        {
+            PG_ASSERTSTR(!entry.mData->IsDirty(), "Interned node data is not supposed to be modified");
+            ++mNumHits;
+            return entry.mData;
+        }
+    }
+
+    ++mNumMisses;
+    return nullptr;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataInterner::Insert(const NodeDataKey & key, NodeData * data)
+{
+    PG_ASSERTSTR(key.IsValid(), "Invalid key used to insert node data");
+    PG_ASSERTSTR(data != nullptr && !data->IsDirty(), "Only up-to-date node data can be interned");
+    PG_ASSERTSTR(!data->mInterned, "The node data is already interned");
+
+    if (mNumEntries == MAX_ENTRIES)
+    {
+        Purge();
+        if (mNumEntries == MAX_ENTRIES)
+        {
+            // Every entry is in use, the node keeps its own data
+            return;
+        }
+    }
+
+    const unsigned int hash = key.GetHash();
+    unsigned int slot = hash & (SLOT_COUNT - 1);
+    while (mSlots[slot] != -1)
+    {
+        slot = (slot + 1) & (SLOT_COUNT - 1);
+    }
+
+    Entry & entry = mEntries[mNumEntries];
+    entry.mHash = hash;
+    entry.mKeySize = key.GetSize();
+    entry.mKey = PG_NEW_ARRAY(mAllocator, -1, "NodeDataInterner key", Alloc::PG_MEM_PERM, unsigned char, key.GetSize());
+    Utils::Memcpy(entry.mKey, key.GetBytes(), key.GetSize());
+    entry.mData = data;
+    data->mInterned = true;
+    entry.mNumInputs = key.GetNumInputs();
+    for (unsigned int i = 0; i < entry.mNumInputs; ++i)
+    {
+        // The table only holds the reference, the input data is never modified through it
+        NodeData * inputData = const_cast<NodeData *>(key.GetInput(i));
+        entry.mInputs[i] = inputData;
+        ++inputData->mNumInternedDependents;
+    }
+
+    mSlots[slot] = static_cast<int>(mNumEntries);
+    ++mNumEntries;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool NodeDataInterner::Detach(NodeData * data)
+{
+    PG_ASSERTSTR(data->mInterned, "Trying to detach node data that is not interned");
+
+    // One reference for the table, one for the node. The keys of other entries
+    // identify the data by its address, so it cannot be modified while they use it
+    if ((data->GetRefCount() > 2) || (data->mNumInternedDependents > 0))
+    {
+        return true;
+    }
+
+    for (unsigned int e = 0; e < mNumEntries; ++e)
+    {
+        if (mEntries[e].mData == data)
+        {
+            // The node keeps its reference, no need to release the GPU data
+            data->mInterned = false;
+            RemoveEntry(e);
+            return false;
+        }
+    }
+
+    PG_FAILSTR("Interned node data not found in the table");
+    data->mInterned = false;
+    return false;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataInterner::ReleaseNodeData(NodeData * data)
+{
+    PG_ASSERTSTR(!data->mInterned, "Interned node data is released by the table");
+    if ((data->GetRefCount() == 1) && (mReleaseCallback != nullptr))
+    {
+        mReleaseCallback(data, mReleaseUserData);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataInterner::Purge()
+{
+    // Releasing an entry releases its input data, which can make other entries unused,
+    // so repeat until nothing is released
+    bool released = true;
+    while (released)
+    {
+        released = false;
+
+        // Backwards, since removing an entry moves the last one into its place
+        for (int e = static_cast<int>(mNumEntries) - 1; e >= 0; --e)
+        {
+            NodeData * data = &(*mEntries[e].mData);
+            if (data->GetRefCount() == 1)
+            {
+                if (mReleaseCallback != nullptr)
+                {
+                    mReleaseCallback(data, mReleaseUserData);
+                }
+                data->mInterned = false;
+                RemoveEntry(static_cast<unsigned int>(e));
+                released = true;
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataInterner::Clear()
+{
+    // Removing an entry in use can leave its input data only referenced by the table,
+    // so purge after each removal to release them with the callback
+    Purge();
+    while (mNumEntries > 0)
+    {
+        mEntries[mNumEntries - 1].mData->mInterned = false;
+        RemoveEntry(mNumEntries - 1);
+        Purge();
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataInterner::GetStatistics(Statistics & stats) const
+{
+    stats.mNumEntries = mNumEntries;
+    stats.mNumSharedEntries = 0;
+    stats.mNumUnusedEntries = 0;
+    stats.mNumUsers = 0;
+    stats.mNumHits = mNumHits;
+    stats.mNumMisses = mNumMisses;
+    stats.mUsedBytes = 0;
+    stats.mSavedBytes = 0;
+
+    for (unsigned int e = 0; e < mNumEntries; ++e)
+    {
+        const NodeData * data = &(*mEntries[e].mData);
+        const unsigned int numUsers = static_cast<unsigned int>(data->GetRefCount() - 1) - data->mNumInternedDependents;
+        const unsigned long long size = data->GetMemorySize();
+        stats.mNumUsers += numUsers;
+        stats.mUsedBytes += size;
+        if (numUsers == 0)
+        {
+            ++stats.mNumUnusedEntries;
+        }
+        else if (numUsers > 1)
+        {
+            ++stats.mNumSharedEntries;
+            stats.mSavedBytes += (numUsers - 1) * size;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataInterner::LogStatistics(Core::LogChannel channel, const char * name) const
+{
+#if PEGASUS_ENABLE_LOG
+    Statistics stats;
+    GetStatistics(stats);
+    PG_LOG(channel, "%s node data interning: %u entries (%u shared, %u unused) for %u users, %u hits, %u misses",
+           name, stats.mNumEntries, stats.mNumSharedEntries, stats.mNumUnusedEntries, stats.mNumUsers, stats.mNumHits, stats.mNumMisses);
+    PG_LOG(channel, "%s node data interning: %.1f KB used, %.1f KB saved",
+           name, static_cast<double>(stats.mUsedBytes) / 1024.0, static_cast<double>(stats.mSavedBytes) / 1024.0);
+#endif  // PEGASUS_ENABLE_LOG
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int NodeDataInterner::FindSlot(unsigned int entry) const
+{
+    unsigned int slot = mEntries[entry].mHash & (SLOT_COUNT - 1);
+    while (mSlots[slot] != static_cast<int>(entry))
+    {
+        PG_ASSERTSTR(mSlots[slot] != -1, "Corrupted node data interning table");
+        slot = (slot + 1) & (SLOT_COUNT - 1);
+    }
+    return slot;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataInterner::RemoveEntry(unsigned int entry)
+{
+    // Remove the slot with backward shift deletion, so the probe sequences stay contiguous
+    unsigned int hole = FindSlot(entry);
+    unsigned int slot = hole;
+    for (;;)
+    {
+        slot = (slot + 1) & (SLOT_COUNT - 1);
+        if (mSlots[slot] == -1)
+        {
+            break;
+        }
+
+        // An entry can fill the hole only if its home slot is not between the hole and its slot
+        const unsigned int home = mEntries[mSlots[slot]].mHash & (SLOT_COUNT - 1);
+        const bool homeBetween = (hole <= slot) ? ((home > hole) && (home <= slot))
+                                                : ((home > hole) || (home <= slot));
+        if (!homeBetween)
+        {
+            mSlots[hole] = mSlots[slot];
+            hole = slot;
+        }
+    }
+    mSlots[hole] = -1;
+
+    PG_DELETE_ARRAY(mAllocator, mEntries[entry].mKey);
+    mEntries[entry].mKey = nullptr;
+    mEntries[entry].mData = nullptr;
+    for (unsigned int i = 0; i < mEntries[entry].mNumInputs; ++i)
+    {
+        // Input data only referenced by the table stays in its own entry until the next purge
+        --mEntries[entry].mInputs[i]->mNumInternedDependents;
+        mEntries[entry].mInputs[i] = nullptr;
+    }
+
+    // Keep the entries contiguous
+    const unsigned int last = mNumEntries - 1;
+    if (entry != last)
+    {
+        mSlots[FindSlot(last)] = static_cast<int>(entry);
+        mEntries[entry].mHash = mEntries[last].mHash;
+        mEntries[entry].mKeySize = mEntries[last].mKeySize;
+        mEntries[entry].mKey = mEntries[last].mKey;
+        mEntries[entry].mData = mEntries[last].mData;
+        mEntries[entry].mNumInputs = mEntries[last].mNumInputs;
+        for (unsigned int i = 0; i < mEntries[last].mNumInputs; ++i)
+        {
+            mEntries[entry].mInputs[i] = mEntries[last].mInputs[i];
+            mEntries[last].mInputs[i] = nullptr;
+        }
+        mEntries[last].mKey = nullptr;
+        mEntries[last].mData = nullptr;
+    }
+    --mNumEntries;
+}
+
+
+}   // namespace Graph
+}   // namespace Pegasus
@@ -0,0 +1,240 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NodeDataResidency.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Policy discarding the CPU copy of node data once uploaded to the GPU, within a memory budget
+
+#include "Pegasus/Graph/NodeDataResidency.h"
+#include "Pegasus/Core/Log.h"
+
+namespace Pegasus {
+namespace Graph {
+
+
+//! Empty a list
+//! \param list List to reset
+template <typename ListType>
+static void ResetList(ListType & list)
+{
+    list.mHead = nullptr;
+    list.mTail = nullptr;
+    list.mCount = 0;
+    list.mBytes = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+NodeDataResidency::NodeDataResidency()
+:   mBudgetBytes(0)
+,   mNumDiscards(0)
+,   mDiscardedBytes(0)
+,   mNumRegenerations(0)
+,   mEnabled(false)
+{
+    ResetList(mResident);
+    ResetList(mDiscarded);
+}
+
+//----------------------------------------------------------------------------------------
+
+NodeDataResidency::~NodeDataResidency()
+{
+    SetEnabled(false);
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataResidency::SetEnabled(bool enabled)
+{
+    mEnabled = enabled;
+    if (!enabled)
+    {
+        while (mResident.mHead != nullptr)
+        {
+            Unlink(mResident.mHead);
+        }
+        while (mDiscarded.mHead != nullptr)
+        {
+            Unlink(mDiscarded.mHead);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataResidency::SetBudget(unsigned long long budgetBytes)
+{
+    mBudgetBytes = budgetBytes;
+    ApplyBudget();
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataResidency::OnGPUDataValidated(NodeData * data)
+{
+    PG_ASSERTSTR(data != nullptr, "Invalid node data given to the residency policy");
+    if (!mEnabled || data->IsInterned() || !data->IsCPUDataResident())
+    {
+        return;
+    }
+    PG_ASSERTSTR((data->mResidency == nullptr) || (data->mResidency == this), "The node data is registered in another residency policy");
+
+    if (data->mResidency == this)
+    {
+        Unlink(data);
+    }
+    Link(mResident, data);
+    ApplyBudget();
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataResidency::Touch(NodeData * data)
+{
+    if ((data->mResidency == this) && data->IsCPUDataResident() && (data != mResident.mHead))
+    {
+        Unlink(data);
+        Link(mResident, data);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataResidency::OnCPUDataRestored(NodeData * data)
+{
+    PG_ASSERTSTR(data->mResidency == nullptr, "The node data must be unregistered before its CPU copy is reallocated");
+    ++mNumRegenerations;
+
+    // Data regenerated with new content is registered again after its next upload
+    if (mEnabled && !data->IsGPUDataDirty() && (data->GetNodeGPUData() != nullptr))
+    {
+        Link(mResident, data);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataResidency::Remove(NodeData * data)
+{
+    if (data->mResidency == this)
+    {
+        Unlink(data);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataResidency::GetStatistics(Statistics & stats) const
+{
+    stats.mNumResident = mResident.mCount;
+    stats.mResidentBytes = mResident.mBytes;
+    stats.mBudgetBytes = mBudgetBytes;
+    stats.mNumDiscards = mNumDiscards;
+    stats.mDiscardedBytes = mDiscardedBytes;
+    stats.mNumRegenerations = mNumRegenerations;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataResidency::LogStatistics(Core::LogChannel channel, const char * name) const
+{
+#if PEGASUS_ENABLE_LOG
+    Statistics stats;
+    GetStatistics(stats);
+    PG_LOG(channel, "%s node data residency: %u CPU copies resident, %.1f KB of %.1f KB budget",
+           name, stats.mNumResident, static_cast<double>(stats.mResidentBytes) / 1024.0, static_cast<double>(stats.mBudgetBytes) / 1024.0);
+    PG_LOG(channel, "%s node data residency: %u discards (%.1f KB), %u regenerations",
+           name, stats.mNumDiscards, static_cast<double>(stats.mDiscardedBytes) / 1024.0, stats.mNumRegenerations);
+#endif  // PEGASUS_ENABLE_LOG
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataResidency::Link(List & list, NodeData * data)
+{
+    PG_ASSERTSTR(data->mResidency == nullptr, "The node data is already registered");
+    data->mResidency = this;
+    data->mResidencyPrev = nullptr;
+    data->mResidencyNext = list.mHead;
+    if (list.mHead != nullptr)
+    {
+        list.mHead->mResidencyPrev = data;
+    }
+    else
+    {
+        list.mTail = data;
+    }
+    list.mHead = data;
+
+    // The size is recorded so the data can be unlinked after its content changed
+    data->mResidencyBytes = data->GetMemorySize();
+    list.mBytes += data->mResidencyBytes;
+    ++list.mCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataResidency::Unlink(NodeData * data)
+{
+    PG_ASSERTSTR(data->mResidency == this, "The node data is not registered");
+
+    // The CPU copy of a registered node data only changes while unregistered
+    List & list = data->IsCPUDataResident() ? mResident : mDiscarded;
+    if (data->mResidencyPrev != nullptr)
+    {
+        data->mResidencyPrev->mResidencyNext = data->mResidencyNext;
+    }
+    else
+    {
+        list.mHead = data->mResidencyNext;
+    }
+    if (data->mResidencyNext != nullptr)
+    {
+        data->mResidencyNext->mResidencyPrev = data->mResidencyPrev;
+    }
+    else
+    {
+        list.mTail = data->mResidencyPrev;
+    }
+    data->mResidency = nullptr;
+    data->mResidencyPrev = nullptr;
+    data->mResidencyNext = nullptr;
+
+    list.mBytes -= data->mResidencyBytes;
+    --list.mCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+void NodeDataResidency::ApplyBudget()
+{
+    while ((mResident.mBytes > mBudgetBytes) && (mResident.mTail != nullptr))
+    {
+        NodeData * data = mResident.mTail;
+        Unlink(data);
+
+        // Data regenerated since its upload is registered again after the next upload,
+        // shared data keeps its CPU copy for the other users
+        if (data->IsDirty() || data->IsGPUDataDirty() || (data->GetNodeGPUData() == nullptr) || data->IsInterned())
+        {
+            continue;
+        }
+
+        const unsigned int discardedBytes = data->DiscardCPUData();
+        if (discardedBytes > 0)
+        {
+            ++mNumDiscards;
+            mDiscardedBytes += discardedBytes;
+            Link(mDiscarded, data);
+        }
+    }
+}
+
+
+}   // namespace Graph
+}   // namespace Pegasus
@@ -10,6 +10,7 @@
 //! \brief	Base operator node class, for all operators with at least one input
 
 #include "Pegasus/Graph/OperatorNode.h"
+#include "Pegasus/Graph/NodeDataInterner.h"
 
 namespace Pegasus {
 namespace Graph {
@@ -47,40 +48,22 @@ bool OperatorNode::Update()
         return IsDataDirty();
     }
     
-    // Update every input node and check if any has the dirty flag set
-    bool dirtyFlagSet = false;
-    for (unsigned i = 0; i < numInputs; ++i)
-    {
-        dirtyFlagSet |= GetInput(i)->Update();
-    }
-
-    if (IsDataAllocated() && IsPropertyGridDirty())
-    {
-        // If the property grid has members that are updated, invalidate the data
-        dirtyFlagSet = true;
-    }
-
-    // Validate the property grid to track any subsequent changes
-    ValidatePropertyGrid();
-
-    if (dirtyFlagSet)
-    {
-        // If any input is dirty or if the property grid has changes,
-        // invalidate the node data if allocated
-        InvalidateData();
-        return true;
-    }
-    else
-    {
-        // If no input is dirty, return the state of the node data
-        return IsDataDirty();
-    }
+    // Property and input changes are pushed to the node when they happen,
+    // so there is no need to update the input nodes
+    return IsNodeDirty();
 }
 
 //----------------------------------------------------------------------------------------
     
 NodeDataReturn OperatorNode::GetUpdatedData(bool & updated)
 {
+    // Fast path, nothing has changed in the node or in any node of its input graph
+    // since the last generation, so the input graph does not need to be visited
+    if (IsDataAllocated() && !IsNodeDirty())
+    {
+        return GetData();
+    }
+
     // Check the number of inputs
     const unsigned int minNumInputs = GetMinNumInputNodes();
     const unsigned int maxNumInputs = GetMaxNumInputNodes();
@@ -93,13 +76,6 @@ NodeDataReturn OperatorNode::GetUpdatedData(bool & updated)
         return GetData();
     }
 
-    // If the data has not been allocated, allocate it now
-    if (!IsDataAllocated())
-    {
-        CreateData();
-    }
-    PG_ASSERTSTR(IsDataAllocated(), "Node data has to be allocated when being updated");
-
     // Get the updated data for every input
     bool inputUpdated = false;
     for (unsigned int i = 0; i < numInputs; ++i)
@@ -107,23 +83,63 @@ NodeDataReturn OperatorNode::GetUpdatedData(bool & updated)
         (void) GetInput(i)->GetUpdatedData(inputUpdated);
     }
 
-    // If any input has been updated or if the data is dirty, re-generate them
-    if (inputUpdated || IsDataDirty())
+    // If any input has a new generation of data or if the data is dirty, re-generate them.
+    // The generations also catch inputs regenerated by another dependent node
+    const bool inputChanged = UpdateInputGenerations();
+    if (inputChanged || IsDataDirty())
     {
         // If an input has been updated but the current data is not dirty,
-        // re-invalidate the operator data so the GPU data dirty flag is set
-        GetData()->Invalidate();
-
-        // Generate the node data using the operator-specific code
-        GenerateData();
-
-        // Validate the node data, the GPU node data is still dirty
-        GetData()->Validate();
-
-        updated = true;
+        // re-invalidate the operator data so the GPU data dirty flag is set.
+        // Shared data is left intact for the other nodes using it
+        DetachOrInvalidateData();
+
+        NodeDataKey key;
+        const bool shareable = BuildDataKey(key);
+        if (shareable && AdoptInternedData(key))
+        {
+            ValidateNode(true);
+            updated = true;
+        }
+        else
+        {
+            // If the data has not been allocated, allocate it now
+            if (!IsDataAllocated())
+            {
+                CreateData();
+            }
+            else
+            {
+                // The CPU copy may have been discarded after the last upload
+                GetData()->RestoreCPUData();
+            }
+            PG_ASSERTSTR(IsDataAllocated(), "Node data has to be allocated when being updated");
+
+            // The generation reads the CPU copy of the input data
+            RestoreInputCPUData();
+
+            // Generate the node data using the operator-specific code
+            GenerateAndCompleteData();
+
+            // Validate the node data, the GPU node data is still dirty
+            GetData()->Validate();
+            ValidateNode(true);
+            if (shareable)
+            {
+                InternData(key);
+            }
+
+            updated = true;
+        }
+    }
+    else
+    {
+        ValidateNode(false);
     }
     PG_ASSERTSTR(!IsDataDirty(), "Node data is supposed to be up-to-date at this point");
 
+    // Inputs with transient data that no other node is waiting for give their buffers back to the pool
+    ReleaseTransientInputData();
+
     return GetData();
 }
 
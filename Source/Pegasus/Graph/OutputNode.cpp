@@ -42,8 +42,9 @@ bool OutputNode::Update()
     // Check that the input node is defined
     if (GetNumInputs() == 1)
     {
-        // Update the input node and return its dirty state
-        return GetInput(0)->Update();
+        // Changes of the input graph are pushed to the input node when they happen,
+        // so its dirty state can be returned without updating it
+        return GetInput(0)->IsNodeDirty();
     }
     else
     {
@@ -64,7 +65,9 @@ NodeDataReturn OutputNode::GetUpdatedData(bool & updated)
     if (GetNumInputs() == 1)
     {
         // Redirect the updated data from the input node
-        return GetInput(0)->GetUpdatedData(updated);
+        NodeDataReturn data = GetInput(0)->GetUpdatedData(updated);
+        ValidateNode(UpdateInputGenerations());
+        return data;
     }
     else
     {
@@ -81,6 +84,21 @@ NodeDataReturn OutputNode::GetUpdatedData()
     return GetUpdatedData(updated);
 }
 
+//----------------------------------------------------------------------------------------
+
+bool OutputNode::RestoreCPUData()
+{
+    if (GetNumInputs() == 1)
+    {
+        return GetInput(0)->RestoreCPUData();
+    }
+    else
+    {
+        PG_FAILSTR("Invalid output node, it does not have an input defined");
+        return false;
+    }
+}
+
 //----------------------------------------------------------------------------------------
     
 OutputNode::~OutputNode()
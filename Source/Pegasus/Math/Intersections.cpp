@@ -32,6 +32,94 @@ Point3Return GetIntersection(RayIn ray, PlaneIn plane)
     return ray.GetPointFromDistance(t);
 }
 
+//----------------------------------------------------------------------------------------
+
+bool AreIntersecting(RayIn ray, const AxisAlignedBoundingBox & box)
+{
+    PFloat32 distance;
+    return GetIntersectionDistance(ray, box, distance);
+}
+
+//----------------------------------------------------------------------------------------
+
+bool GetIntersectionDistance(RayIn ray, const AxisAlignedBoundingBox & box, PFloat32 & distance)
+{
+    const Point3 & origin = ray.GetOrigin();
+    const Vec3 & direction = ray.GetDirection();
+    const Point3 & boxMin = box.GetMin();
+    const Point3 & boxMax = box.GetMax();
+
+    PFloat32 tNear = 0.0f;
+    PFloat32 tFar = PFLOAT_MAX;
+    for (int c = 0; c < 3; ++c)
+    {
+        if (Abs(direction.v[c]) < PEG_INTERSECTIONS_EPSILON)
+        {
+            // Parallel to the slab, the origin has to be between the planes
+            if ((origin.v[c] < boxMin.v[c]) || (origin.v[c] > boxMax.v[c]))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            const PFloat32 invDirection = 1.0f / direction.v[c];
+            PFloat32 t0 = (boxMin.v[c] - origin.v[c]) * invDirection;
+            PFloat32 t1 = (boxMax.v[c] - origin.v[c]) * invDirection;
+            if (t0 > t1)
+            {
+                const PFloat32 t = t0;
+                t0 = t1;
+                t1 = t;
+            }
+            tNear = Max(tNear, t0);
+            tFar = Min(tFar, t1);
+            if (tNear > tFar)
+            {
+                return false;
+            }
+        }
+    }
+
+    distance = tNear;
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool GetIntersectionDistance(RayIn ray, Point3In p0, Point3In p1, Point3In p2,
+                             PFloat32 & distance, PFloat32 & u, PFloat32 & v)
+{
+    const Vec3 & direction = ray.GetDirection();
+    const Vec3 edge1 = p1 - p0;
+    const Vec3 edge2 = p2 - p0;
+    const Vec3 pVec = Cross(direction, edge2);
+    const PFloat32 det = Dot(edge1, pVec);
+    if (Abs(det) < PEG_INTERSECTIONS_EPSILON)
+    {
+        // Ray parallel to the triangle plane
+        return false;
+    }
+
+    const PFloat32 invDet = 1.0f / det;
+    const Vec3 tVec = ray.GetOrigin() - p0;
+    u = Dot(tVec, pVec) * invDet;
+    if ((u < 0.0f) || (u > 1.0f))
+    {
+        return false;
+    }
+
+    const Vec3 qVec = Cross(tVec, edge1);
+    v = Dot(direction, qVec) * invDet;
+    if ((v < 0.0f) || (u + v > 1.0f))
+    {
+        return false;
+    }
+
+    distance = Dot(edge2, qVec) * invDet;
+    return distance >= 0.0f;
+}
+
 
 }   // namespace Math
 }   // namespace Pegasus
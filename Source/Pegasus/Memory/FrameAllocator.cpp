@@ -0,0 +1,251 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   FrameAllocator.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  FrameAllocator, linear allocator for transient data, reset every frame.
+
+#include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Memory/FrameAllocator.h"
+
+using namespace Pegasus;
+using namespace Pegasus::Memory;
+
+#if PEGASUS_ENABLE_FRAME_ALLOCATOR_CHECKS
+
+//! Header stored in front of each allocation, to detect the use of expired memory
+struct FrameAllocationHeader
+{
+    unsigned int mFrameIndex;
+    unsigned int mMagic;
+};
+
+static const unsigned int FRAME_ALLOCATION_MAGIC = 0xF4A3E0A1;
+
+//! Pattern written over recycled memory
+static const char FRAME_ALLOCATOR_POISON = static_cast<char>(0xFD);
+
+static const size_t FRAME_ALLOCATION_HEADER_SIZE = sizeof(FrameAllocationHeader);
+
+#else
+
+static const size_t FRAME_ALLOCATION_HEADER_SIZE = 0;
+
+#endif
+
+//! Default alignment of Alloc(), large enough for the SIMD math types
+static const Alloc::Alignment FRAME_ALLOCATOR_DEFAULT_ALIGNMENT = 16;
+
+Core::AtomicInt FrameAllocator::sFrameIndex = 0;
+Core::AtomicInt FrameAllocator::sGlobalHighWaterMark = 0;
+
+FrameAllocator::FrameAllocator(Alloc::IAllocator* pageAllocator, int pageSize) :
+    mPageAllocator(pageAllocator),
+    mPageSize(pageSize),
+    mCurrentArena(0),
+    mFrameIndex(GetFrameIndex()),
+    mHighWaterMark(0),
+    mReservedSize(0)
+{
+    for (int i = 0; i < 2; ++i)
+    {
+        mArenas[i].mFirstPage = nullptr;
+        mArenas[i].mCurrentPage = nullptr;
+        mArenas[i].mUsage = 0;
+        mArenas[i].mFrameIndex = mFrameIndex;
+    }
+}
+
+FrameAllocator::~FrameAllocator()
+{
+    for (int i = 0; i < 2; ++i)
+    {
+        Page* page = mArenas[i].mFirstPage;
+        while (page != nullptr)
+        {
+            Page* next = page->mNext;
+            mPageAllocator->Delete(page);
+            page = next;
+        }
+        mArenas[i].mFirstPage = nullptr;
+        mArenas[i].mCurrentPage = nullptr;
+    }
+    mReservedSize = 0;
+}
+
+void* FrameAllocator::Alloc(
+        size_t size,
+        Alloc::Flags flags,
+        Alloc::Category category,
+        const char* debugText,
+        const char* file,
+        unsigned int line
+)
+{
+    return AllocAlign(size, FRAME_ALLOCATOR_DEFAULT_ALIGNMENT, flags, category, debugText, file, line);
+}
+
+void* FrameAllocator::AllocAlign(
+    size_t size,
+    Alloc::Alignment align,
+    Alloc::Flags flags,
+    Alloc::Category category,
+    const char* debugText,
+    const char* file,
+    unsigned int line
+)
+{
+    PG_ASSERTSTR(align != 0 && (align & (align - 1)) == 0, "Alignment must be a power of 2");
+    SyncFrame();
+
+    Arena& arena = mArenas[mCurrentArena];
+    Page* page = arena.mCurrentPage;
+    Page* lastPage = nullptr;
+    for (;;)
+    {
+        if (page == nullptr)
+        {
+            // no recycled page can hold this allocation, grow the arena
+            const size_t requiredSize = size + FRAME_ALLOCATION_HEADER_SIZE + align;
+            const size_t pageSize = requiredSize > static_cast<size_t>(mPageSize) ? requiredSize : static_cast<size_t>(mPageSize);
+            page = static_cast<Page*>(mPageAllocator->Alloc(sizeof(Page) + pageSize, Alloc::PG_MEM_PERM, -1, "Frame Allocator Page", __FILE__, __LINE__));
+            page->mNext = nullptr;
+            page->mSize = pageSize;
+            page->mUsed = 0;
+            mReservedSize += pageSize;
+            if (lastPage != nullptr)
+            {
+                lastPage->mNext = page;
+            }
+            else if (arena.mFirstPage == nullptr)
+            {
+                arena.mFirstPage = page;
+            }
+            else
+            {
+                Page* tail = arena.mFirstPage;
+                while (tail->mNext != nullptr) tail = tail->mNext;
+                tail->mNext = page;
+            }
+        }
+
+        char* pageData = reinterpret_cast<char*>(page + 1);
+        const size_t start = reinterpret_cast<size_t>(pageData + page->mUsed + FRAME_ALLOCATION_HEADER_SIZE);
+        const size_t alignedStart = (start + align - 1) & ~(align - 1);
+        const size_t end = (alignedStart - reinterpret_cast<size_t>(pageData)) + size;
+        if (end <= page->mSize)
+        {
+            arena.mUsage += end - page->mUsed;
+            arena.mCurrentPage = page;
+            page->mUsed = end;
+
+            if (arena.mUsage > mHighWaterMark)
+            {
+                mHighWaterMark = arena.mUsage;
+                Core::AtomicMax(&sGlobalHighWaterMark, static_cast<long>(mHighWaterMark > 0x7FFFFFFF ? 0x7FFFFFFF : mHighWaterMark));
+            }
+
+            void* result = reinterpret_cast<void*>(alignedStart);
+#if PEGASUS_ENABLE_FRAME_ALLOCATOR_CHECKS
+            FrameAllocationHeader* header = reinterpret_cast<FrameAllocationHeader*>(alignedStart - FRAME_ALLOCATION_HEADER_SIZE);
+            header->mFrameIndex = arena.mFrameIndex;
+            header->mMagic = FRAME_ALLOCATION_MAGIC;
+#endif
+            return result;
+        }
+
+        lastPage = page;
+        page = page->mNext;
+    }
+}
+
+void FrameAllocator::Delete(void* ptr)
+{
+    // memory gets recycled with the frame
+    if (ptr != nullptr)
+    {
+        ValidatePointer(ptr);
+    }
+}
+
+void FrameAllocator::ValidatePointer(const void* ptr) const
+{
+#if PEGASUS_ENABLE_FRAME_ALLOCATOR_CHECKS
+    const FrameAllocationHeader* header = reinterpret_cast<const FrameAllocationHeader*>(static_cast<const char*>(ptr) - FRAME_ALLOCATION_HEADER_SIZE);
+    PG_ASSERTSTR(header->mMagic == FRAME_ALLOCATION_MAGIC, "Frame allocation has expired or was not created by a frame allocator! Use after frame detected.");
+    PG_ASSERTSTR(header->mFrameIndex + 1 >= GetFrameIndex(), "Frame allocation from frame %u used during frame %u! Use after frame detected.", header->mFrameIndex, GetFrameIndex());
+#endif
+}
+
+size_t FrameAllocator::GetFrameUsage() const
+{
+    const Arena& arena = mArenas[mCurrentArena];
+    return arena.mFrameIndex == GetFrameIndex() ? arena.mUsage : 0;
+}
+
+void FrameAllocator::AdvanceFrame()
+{
+    Core::AtomicIncrement(&sFrameIndex);
+}
+
+void FrameAllocator::SyncFrame()
+{
+    const unsigned int frameIndex = GetFrameIndex();
+    if (frameIndex == mFrameIndex)
+    {
+        return;
+    }
+
+    // The other arena is at least 2 frames old, it expired.
+    // The current arena stays alive for one more frame, unless this thread skipped frames.
+    const int nextArena = 1 - mCurrentArena;
+    RecycleArena(mArenas[nextArena]);
+    if (mArenas[mCurrentArena].mFrameIndex + 1 < frameIndex)
+    {
+        RecycleArena(mArenas[mCurrentArena]);
+    }
+
+    mCurrentArena = nextArena;
+    mArenas[nextArena].mFrameIndex = frameIndex;
+    mFrameIndex = frameIndex;
+}
+
+void FrameAllocator::RecycleArena(Arena& arena)
+{
+    Page* page = arena.mFirstPage;
+    Page* prevPage = nullptr;
+    while (page != nullptr)
+    {
+        Page* nextPage = page->mNext;
+        if (page->mSize > static_cast<size_t>(mPageSize))
+        {
+            // dedicated page of a big allocation, do not hold on to it
+            mReservedSize -= page->mSize;
+            mPageAllocator->Delete(page);
+            if (prevPage != nullptr)
+            {
+                prevPage->mNext = nextPage;
+            }
+            else
+            {
+                arena.mFirstPage = nextPage;
+            }
+        }
+        else
+        {
+#if PEGASUS_ENABLE_FRAME_ALLOCATOR_CHECKS
+            Utils::Memset8(page + 1, FRAME_ALLOCATOR_POISON, static_cast<unsigned>(page->mUsed));
+#endif
+            page->mUsed = 0;
+            prevPage = page;
+        }
+        page = nextPage;
+    }
+    arena.mCurrentPage = arena.mFirstPage;
+    arena.mUsage = 0;
+}
@@ -11,6 +11,10 @@
 
 #include "Pegasus/Memory/MemoryManager.h"
 #include "Pegasus/Memory/MallocFreeAllocator.h"
+#include "Pegasus/Memory/FrameAllocator.h"
+#include "Pegasus/Memory/TrackingAllocator.h"
+#include "Pegasus/Memory/PoolAllocator.h"
+#include "Pegasus/Utils/ByteStream.h"
 
 namespace Pegasus {
 namespace Memory {
@@ -26,60 +30,167 @@ static MallocFreeAllocator sPropertyPointerAllocator(5);
 static MallocFreeAllocator sTimelineAllocator(6);
 static MallocFreeAllocator sWindowAllocator(7);
 
+#if PEGASUS_ENABLE_MEMORY_TRACKING
+
+//! One out of TRACKING_SAMPLE_RATE allocations gets its call site recorded.
+//! Totals and categories are always exact. 1 keeps the leak report exact.
+static const unsigned int TRACKING_SAMPLE_RATE = 1;
+
+// Tracking decorators, handed out instead of the heaps
+static TrackingAllocator sGlobalTracker("Global", &sGlobalAllocator, TRACKING_SAMPLE_RATE);
+static TrackingAllocator sCoreTracker("Core", &sCoreAllocator, TRACKING_SAMPLE_RATE);
+static TrackingAllocator sRenderTracker("Render", &sRenderAllocator, TRACKING_SAMPLE_RATE);
+static TrackingAllocator sNodeTracker("Node", &sNodeAllocator, TRACKING_SAMPLE_RATE);
+static TrackingAllocator sNodeDataTracker("NodeData", &sNodeDataAllocator, TRACKING_SAMPLE_RATE);
+static TrackingAllocator sPropertyPointerTracker("PropertyPointer", &sPropertyPointerAllocator, TRACKING_SAMPLE_RATE);
+static TrackingAllocator sTimelineTracker("Timeline", &sTimelineAllocator, TRACKING_SAMPLE_RATE);
+static TrackingAllocator sWindowTracker("Window", &sWindowAllocator, TRACKING_SAMPLE_RATE);
+
+//! All the trackers, for the reports
+static TrackingAllocator* const sTrackers[] = {
+    &sGlobalTracker,
+    &sCoreTracker,
+    &sRenderTracker,
+    &sNodeTracker,
+    &sNodeDataTracker,
+    &sPropertyPointerTracker,
+    &sTimelineTracker,
+    &sWindowTracker,
+};
+
+static const unsigned int NUM_TRACKERS = sizeof(sTrackers) / sizeof(sTrackers[0]);
+
+//! Exposed heap, the tracker of a heap when tracking is enabled
+#define PEGASUS_MEMORY_HEAP(name) s##name##Tracker
+
+#else
+
+#define PEGASUS_MEMORY_HEAP(name) s##name##Allocator
+
+#endif  // PEGASUS_ENABLE_MEMORY_TRACKING
+
+//! Pool of the transient node data, on top of the node data heap so the trackers see its buffers
+static PoolAllocator sTransientNodeDataPool(&PEGASUS_MEMORY_HEAP(NodeData));
+
 //----------------------------------------------------------------------------------------
 
 Alloc::IAllocator* GetGlobalAllocator()
 {
-    return &sGlobalAllocator;
+    return &PEGASUS_MEMORY_HEAP(Global);
 }
 
 //----------------------------------------------------------------------------------------
 
 Alloc::IAllocator* GetCoreAllocator()
 {
-    return &sCoreAllocator;
+    return &PEGASUS_MEMORY_HEAP(Core);
 }
 
 //----------------------------------------------------------------------------------------
 
 Alloc::IAllocator* GetRenderAllocator()
 {
-    return &sRenderAllocator;
+    return &PEGASUS_MEMORY_HEAP(Render);
 }
 
 //----------------------------------------------------------------------------------------
 
 Alloc::IAllocator* GetNodeAllocator()
 {
-    return &sNodeAllocator;
+    return &PEGASUS_MEMORY_HEAP(Node);
 }
 
 //----------------------------------------------------------------------------------------
 
 Alloc::IAllocator* GetNodeDataAllocator()
 {
-    return &sNodeDataAllocator;
+    return &PEGASUS_MEMORY_HEAP(NodeData);
+}
+
+//----------------------------------------------------------------------------------------
+
+PoolAllocator* GetTransientNodeDataAllocator()
+{
+    return &sTransientNodeDataPool;
 }
 
 //----------------------------------------------------------------------------------------
 
 Alloc::IAllocator* GetPropertyPointerAllocator()
 {
-    return &sPropertyPointerAllocator;
+    return &PEGASUS_MEMORY_HEAP(PropertyPointer);
 }
 
 //----------------------------------------------------------------------------------------
 
 Alloc::IAllocator* GetTimelineAllocator()
 {
-    return &sTimelineAllocator;
+    return &PEGASUS_MEMORY_HEAP(Timeline);
 }
 
 //----------------------------------------------------------------------------------------
 
 Alloc::IAllocator* GetWindowAllocator()
 {
-    return &sWindowAllocator;
+    return &PEGASUS_MEMORY_HEAP(Window);
+}
+
+//----------------------------------------------------------------------------------------
+
+FrameAllocator* GetFrameAllocator()
+{
+    // One instance per thread, created on first use, so allocating does not require any lock
+    static thread_local FrameAllocator sFrameAllocator(&PEGASUS_MEMORY_HEAP(Global));
+    return &sFrameAllocator;
+}
+
+//----------------------------------------------------------------------------------------
+
+void LogMemoryReport()
+{
+#if PEGASUS_ENABLE_MEMORY_TRACKING
+    for (unsigned int t = 0; t < NUM_TRACKERS; ++t)
+    {
+        sTrackers[t]->LogReport();
+    }
+#endif
+}
+
+//----------------------------------------------------------------------------------------
+
+long long LogMemoryLeaks()
+{
+    long long leakCount = 0;
+#if PEGASUS_ENABLE_MEMORY_TRACKING
+    for (unsigned int t = 0; t < NUM_TRACKERS; ++t)
+    {
+        leakCount += sTrackers[t]->LogLeaks();
+    }
+#endif
+    return leakCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+void WriteMemoryReportJson(Utils::ByteStream& stream)
+{
+    stream.Append("{\"allocators\":[", 15);
+#if PEGASUS_ENABLE_MEMORY_TRACKING
+    // The snapshot is too large for the stack
+    TrackingAllocator::Snapshot* snapshot = static_cast<TrackingAllocator::Snapshot*>(
+        sGlobalAllocator.Alloc(sizeof(TrackingAllocator::Snapshot), Alloc::PG_MEM_TEMP, -1, "Memory report snapshot", __FILE__, __LINE__));
+    for (unsigned int t = 0; t < NUM_TRACKERS; ++t)
+    {
+        if (t > 0)
+        {
+            stream.Append(",", 1);
+        }
+        sTrackers[t]->TakeSnapshot(*snapshot);
+        sTrackers[t]->WriteJson(*snapshot, stream);
+    }
+    sGlobalAllocator.Delete(snapshot);
+#endif
+    stream.Append("]}", 2);
 }
 
 
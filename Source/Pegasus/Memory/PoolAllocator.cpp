@@ -0,0 +1,245 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   PoolAllocator.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Allocator keeping freed buffers in size buckets to reuse them for later allocations.
+
+#include "Pegasus/Memory/PoolAllocator.h"
+#include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+using namespace Pegasus;
+using namespace Pegasus::Memory;
+
+//! Header stored in front of each allocation
+struct PoolAllocationHeader
+{
+    size_t mCapacity;           //!< Capacity of the buffer, size of the request for unpooled allocations
+    unsigned int mSizeClass;    //!< Size class of the buffer, NUM_CLASSES for unpooled allocations
+    unsigned int mPadding;      //!< Unused, keeps the user pointer aligned
+};
+
+//! Size reserved in front of each allocation for the header
+static const size_t POOL_HEADER_SIZE = 16;
+
+//----------------------------------------------------------------------------------------
+
+PoolAllocator::PoolAllocator(Alloc::IAllocator* allocator)
+    : mAllocator(allocator),
+      mLock(0)
+{
+    PG_ASSERTSTR(allocator != nullptr, "A pool allocator requires an allocator to decorate");
+    Utils::Memset8(mFreeLists, 0, sizeof(mFreeLists));
+    Utils::Memset8(&mStats, 0, sizeof(mStats));
+}
+
+//----------------------------------------------------------------------------------------
+
+PoolAllocator::~PoolAllocator()
+{
+    Trim();
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int PoolAllocator::GetSizeClass(size_t size, size_t& outCapacity)
+{
+    const size_t minCapacity = static_cast<size_t>(1) << MIN_CLASS_SHIFT;
+    if (size <= minCapacity)
+    {
+        outCapacity = minCapacity;
+        return 0;
+    }
+
+    // Highest power of 2 strictly below the size, the size class is between it and its double
+    unsigned int shift = MIN_CLASS_SHIFT;
+    while ((shift < MAX_CLASS_SHIFT + 1) && ((static_cast<size_t>(2) << shift) < size))
+    {
+        ++shift;
+    }
+    if (shift > MAX_CLASS_SHIFT)
+    {
+        outCapacity = size;
+        return NUM_CLASSES;
+    }
+
+    const size_t base = static_cast<size_t>(1) << shift;
+    const size_t step = base / CLASSES_PER_POWER;
+    const size_t stepIndex = (size - base + step - 1) / step;
+    outCapacity = base + stepIndex * step;
+    return 1 + (shift - MIN_CLASS_SHIFT) * CLASSES_PER_POWER + static_cast<unsigned int>(stepIndex - 1);
+}
+
+//----------------------------------------------------------------------------------------
+
+void* PoolAllocator::Alloc(size_t size, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line)
+{
+    size_t capacity = 0;
+    const unsigned int sizeClass = GetSizeClass(size, capacity);
+
+    // Reuse a freed buffer of the same size class if there is one
+    char* chunk = nullptr;
+    Lock();
+    ++mStats.mNumAllocs;
+    if ((sizeClass < NUM_CLASSES) && (mFreeLists[sizeClass] != nullptr))
+    {
+        FreeBuffer* buffer = mFreeLists[sizeClass];
+        mFreeLists[sizeClass] = buffer->mNext;
+        mStats.mCachedBytes -= capacity;
+        ++mStats.mNumReuses;
+        chunk = reinterpret_cast<char*>(buffer);
+    }
+    mStats.mUsedBytes += capacity;
+    UpdatePeaks();
+    Unlock();
+
+    if (chunk == nullptr)
+    {
+        chunk = static_cast<char*>(mAllocator->AllocAlign(capacity + POOL_HEADER_SIZE, MAX_ALIGNMENT, flags, category, debugText, file, line));
+        if (chunk == nullptr)
+        {
+            Lock();
+            mStats.mUsedBytes -= capacity;
+            Unlock();
+            return nullptr;
+        }
+    }
+
+    PoolAllocationHeader* header = reinterpret_cast<PoolAllocationHeader*>(chunk);
+    header->mCapacity = capacity;
+    header->mSizeClass = sizeClass;
+    header->mPadding = 0;
+    return chunk + POOL_HEADER_SIZE;
+}
+
+//----------------------------------------------------------------------------------------
+
+void* PoolAllocator::AllocAlign(size_t size, Alloc::Alignment align, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line)
+{
+    PG_ASSERTSTR(align != 0 && (align & (align - 1)) == 0, "Alignment must be a power of 2");
+    PG_ASSERTSTR(align <= MAX_ALIGNMENT, "Alignment too large for the pool allocator");
+    return Alloc(size, flags, category, debugText, file, line);
+}
+
+//----------------------------------------------------------------------------------------
+
+void PoolAllocator::Delete(void* ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    char* chunk = static_cast<char*>(ptr) - POOL_HEADER_SIZE;
+    const PoolAllocationHeader* header = reinterpret_cast<const PoolAllocationHeader*>(chunk);
+    const size_t capacity = header->mCapacity;
+    const unsigned int sizeClass = header->mSizeClass;
+
+    Lock();
+    mStats.mUsedBytes -= capacity;
+    if (sizeClass < NUM_CLASSES)
+    {
+        // Keep the buffer for the next allocation of the same size class
+        FreeBuffer* buffer = reinterpret_cast<FreeBuffer*>(chunk);
+        buffer->mNext = mFreeLists[sizeClass];
+        mFreeLists[sizeClass] = buffer;
+        mStats.mCachedBytes += capacity;
+        chunk = nullptr;
+    }
+    Unlock();
+
+    if (chunk != nullptr)
+    {
+        mAllocator->Delete(chunk);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void PoolAllocator::Trim()
+{
+    // Detach the free lists first, so the decorated allocator is not called with the lock held
+    FreeBuffer* freeLists[NUM_CLASSES];
+    Lock();
+    Utils::Memcpy(freeLists, mFreeLists, sizeof(mFreeLists));
+    Utils::Memset8(mFreeLists, 0, sizeof(mFreeLists));
+    mStats.mCachedBytes = 0;
+    Unlock();
+
+    for (unsigned int c = 0; c < NUM_CLASSES; ++c)
+    {
+        FreeBuffer* buffer = freeLists[c];
+        while (buffer != nullptr)
+        {
+            FreeBuffer* next = buffer->mNext;
+            mAllocator->Delete(buffer);
+            buffer = next;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+PoolAllocator::Stats PoolAllocator::GetStats() const
+{
+    Lock();
+    const Stats stats = mStats;
+    Unlock();
+    return stats;
+}
+
+//----------------------------------------------------------------------------------------
+
+void PoolAllocator::ResetPeaks()
+{
+    Lock();
+    mStats.mPeakUsedBytes = mStats.mUsedBytes;
+    mStats.mPeakReservedBytes = mStats.mUsedBytes + mStats.mCachedBytes;
+    Unlock();
+}
+
+//----------------------------------------------------------------------------------------
+
+void PoolAllocator::LogStats(const char* name) const
+{
+    const Stats stats = GetStats();
+    PG_LOG('MEM_', "[%s] used: %llu bytes, peak: %llu bytes, cached: %llu bytes, peak reserved: %llu bytes, %u allocations (%u reused buffers)",
+           name, stats.mUsedBytes, stats.mPeakUsedBytes, stats.mCachedBytes, stats.mPeakReservedBytes, stats.mNumAllocs, stats.mNumReuses);
+}
+
+//----------------------------------------------------------------------------------------
+
+void PoolAllocator::UpdatePeaks()
+{
+    if (mStats.mUsedBytes > mStats.mPeakUsedBytes)
+    {
+        mStats.mPeakUsedBytes = mStats.mUsedBytes;
+    }
+    const unsigned long long reservedBytes = mStats.mUsedBytes + mStats.mCachedBytes;
+    if (reservedBytes > mStats.mPeakReservedBytes)
+    {
+        mStats.mPeakReservedBytes = reservedBytes;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void PoolAllocator::Lock() const
+{
+    while (Core::AtomicCompareExchange(&mLock, 1, 0) != 0)
+    {
+        // Spin, critical sections only update a free list and a few counters
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void PoolAllocator::Unlock() const
+{
+    Core::AtomicStore(&mLock, 0);
+}
@@ -0,0 +1,485 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TrackingAllocator.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Allocator decorator recording memory statistics per category and per call site.
+
+#include "Pegasus/Memory/TrackingAllocator.h"
+#include "Pegasus/Utils/ByteStream.h"
+#include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+#include <stdio.h>
+
+using namespace Pegasus;
+using namespace Pegasus::Memory;
+
+//! Header stored in front of each allocation
+struct TrackingAllocationHeader
+{
+    size_t mSize;                   //!< Requested size
+    int mSite;                      //!< Call site slot, -1 if the allocation was not sampled
+    unsigned short mCategorySlot;   //!< Category slot
+    unsigned short mPadding;        //!< Distance between the start of the internal allocation and the user pointer
+};
+
+//! Size reserved in front of each allocation, keeps the alignment of the decorated allocator
+static const size_t TRACKING_HEADER_SIZE = 16;
+
+//! Slot collecting the call sites that do not fit in the table
+static const int TRACKING_OVERFLOW_SITE = TrackingAllocator::MAX_SITES - 1;
+
+//! Slot collecting the categories that do not fit in the table
+static const int TRACKING_OVERFLOW_CATEGORY = TrackingAllocator::MAX_CATEGORIES - 1;
+
+//----------------------------------------------------------------------------------------
+
+//! Adds an allocation to a set of counters
+static void AddToStats(TrackingAllocator::Stats& stats, long long size, long long count)
+{
+    stats.mLiveBytes += size;
+    stats.mLiveCount += count;
+    stats.mTotalBytes += size;
+    stats.mTotalCount += count;
+    if (stats.mLiveBytes > stats.mPeakBytes)
+    {
+        stats.mPeakBytes = stats.mLiveBytes;
+    }
+}
+
+//! Removes an allocation from a set of counters
+static void RemoveFromStats(TrackingAllocator::Stats& stats, long long size, long long count)
+{
+    stats.mLiveBytes -= size;
+    stats.mLiveCount -= count;
+}
+
+//! Computes after - before for a set of counters
+static void DiffStats(const TrackingAllocator::Stats& before, const TrackingAllocator::Stats& after, TrackingAllocator::Stats& outDiff)
+{
+    outDiff.mLiveBytes = after.mLiveBytes - before.mLiveBytes;
+    outDiff.mLiveCount = after.mLiveCount - before.mLiveCount;
+    outDiff.mPeakBytes = after.mPeakBytes;
+    outDiff.mTotalBytes = after.mTotalBytes - before.mTotalBytes;
+    outDiff.mTotalCount = after.mTotalCount - before.mTotalCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+TrackingAllocator::TrackingAllocator(const char* name, Alloc::IAllocator* allocator, unsigned int sampleRate)
+    : mName(name),
+      mAllocator(allocator),
+      mSampleRate(sampleRate > 0 ? sampleRate : 1),
+      mSampleCounter(0),
+      mLock(0),
+      mSites(nullptr)
+{
+    PG_ASSERTSTR(allocator != nullptr, "A tracking allocator requires an allocator to decorate");
+    Utils::Memset8(&mTotal, 0, sizeof(mTotal));
+    Utils::Memset8(mCategories, 0, sizeof(mCategories));
+}
+
+//----------------------------------------------------------------------------------------
+
+TrackingAllocator::~TrackingAllocator()
+{
+    // Allocations freed after this point (static destructors) only update the totals
+    Lock();
+    if (mSites != nullptr)
+    {
+        mAllocator->Delete(mSites);
+        mSites = nullptr;
+    }
+    Unlock();
+}
+
+//----------------------------------------------------------------------------------------
+
+void* TrackingAllocator::Alloc(size_t size, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line)
+{
+    char* chunk = static_cast<char*>(mAllocator->Alloc(size + TRACKING_HEADER_SIZE, flags, category, debugText, file, line));
+    if (chunk == nullptr)
+    {
+        return nullptr;
+    }
+
+    TrackingAllocationHeader* header = reinterpret_cast<TrackingAllocationHeader*>(chunk + TRACKING_HEADER_SIZE - sizeof(TrackingAllocationHeader));
+    int categorySlot = 0;
+    header->mSize = size;
+    header->mSite = RecordAlloc(size, category, debugText, file, line, categorySlot);
+    header->mCategorySlot = static_cast<unsigned short>(categorySlot);
+    header->mPadding = static_cast<unsigned short>(TRACKING_HEADER_SIZE);
+    return chunk + TRACKING_HEADER_SIZE;
+}
+
+//----------------------------------------------------------------------------------------
+
+void* TrackingAllocator::AllocAlign(size_t size, Alloc::Alignment align, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line)
+{
+    PG_ASSERTSTR(align != 0 && (align & (align - 1)) == 0, "Alignment must be a power of 2");
+    PG_ASSERTSTR(align <= 0x8000, "Alignment too large for the tracking allocator");
+
+    // Keep the user pointer at a multiple of the alignment from the internal allocation
+    const size_t padding = align > TRACKING_HEADER_SIZE ? align : TRACKING_HEADER_SIZE;
+    char* chunk = static_cast<char*>(mAllocator->AllocAlign(size + padding, align, flags, category, debugText, file, line));
+    if (chunk == nullptr)
+    {
+        return nullptr;
+    }
+
+    TrackingAllocationHeader* header = reinterpret_cast<TrackingAllocationHeader*>(chunk + padding - sizeof(TrackingAllocationHeader));
+    int categorySlot = 0;
+    header->mSize = size;
+    header->mSite = RecordAlloc(size, category, debugText, file, line, categorySlot);
+    header->mCategorySlot = static_cast<unsigned short>(categorySlot);
+    header->mPadding = static_cast<unsigned short>(padding);
+    return chunk + padding;
+}
+
+//----------------------------------------------------------------------------------------
+
+void TrackingAllocator::Delete(void* ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+
+    char* userPtr = static_cast<char*>(ptr);
+    const TrackingAllocationHeader* header = reinterpret_cast<const TrackingAllocationHeader*>(userPtr - sizeof(TrackingAllocationHeader));
+    const long long size = static_cast<long long>(header->mSize);
+    char* chunk = userPtr - header->mPadding;
+
+    Lock();
+    RemoveFromStats(mTotal, size, 1);
+    RemoveFromStats(mCategories[header->mCategorySlot], size, 1);
+    if (header->mSite >= 0 && mSites != nullptr)
+    {
+        RemoveFromStats(mSites[header->mSite].mStats, size * mSampleRate, mSampleRate);
+    }
+    Unlock();
+
+    mAllocator->Delete(chunk);
+}
+
+//----------------------------------------------------------------------------------------
+
+TrackingAllocator::Stats TrackingAllocator::GetTotalStats() const
+{
+    Lock();
+    const Stats stats = mTotal;
+    Unlock();
+    return stats;
+}
+
+//----------------------------------------------------------------------------------------
+
+int TrackingAllocator::RecordAlloc(size_t size, Alloc::Category category, const char* debugText, const char* file, unsigned int line, int& outCategorySlot)
+{
+    outCategorySlot = (category >= -1 && category + 1 < TRACKING_OVERFLOW_CATEGORY) ? category + 1 : TRACKING_OVERFLOW_CATEGORY;
+    const long long size64 = static_cast<long long>(size);
+    int site = -1;
+
+    Lock();
+    AddToStats(mTotal, size64, 1);
+    AddToStats(mCategories[outCategorySlot], size64, 1);
+    if (++mSampleCounter >= mSampleRate)
+    {
+        mSampleCounter = 0;
+        site = FindSite(file, line, debugText, category);
+        if (site >= 0)
+        {
+            AddToStats(mSites[site].mStats, size64 * mSampleRate, mSampleRate);
+        }
+    }
+    Unlock();
+
+    return site;
+}
+
+//----------------------------------------------------------------------------------------
+
+int TrackingAllocator::FindSite(const char* file, unsigned int line, const char* debugText, Alloc::Category category)
+{
+    if (mSites == nullptr)
+    {
+        // Created on first use, with the lock held. The table itself is not tracked.
+        mSites = static_cast<SiteStats*>(mAllocator->Alloc(sizeof(SiteStats) * MAX_SITES, Alloc::PG_MEM_PERM, -1, "TrackingAllocator sites", __FILE__, __LINE__));
+        if (mSites == nullptr)
+        {
+            return -1;
+        }
+        Utils::Memset8(mSites, 0, sizeof(SiteStats) * MAX_SITES);
+        mSites[TRACKING_OVERFLOW_SITE].mFile = "<other call sites>";
+    }
+
+    if (file == nullptr)
+    {
+        file = "<unknown>";
+    }
+
+    // Open addressing, __FILE__ strings are compared by address, which is enough to separate call sites
+    const size_t hash = (reinterpret_cast<size_t>(file) >> 3) * 2654435761u + line * 40503u;
+    unsigned int slot = static_cast<unsigned int>(hash % TRACKING_OVERFLOW_SITE);
+    for (int probe = 0; probe < TRACKING_OVERFLOW_SITE; ++probe)
+    {
+        SiteStats& site = mSites[slot];
+        if (site.mFile == file && site.mLine == line)
+        {
+            return static_cast<int>(slot);
+        }
+        else if (site.mFile == nullptr)
+        {
+            site.mFile = file;
+            site.mLine = line;
+            site.mDebugText = debugText;
+            site.mCategory = category;
+            return static_cast<int>(slot);
+        }
+
+        if (++slot == TRACKING_OVERFLOW_SITE)
+        {
+            slot = 0;
+        }
+    }
+
+    return TRACKING_OVERFLOW_SITE;
+}
+
+//----------------------------------------------------------------------------------------
+
+void TrackingAllocator::Lock() const
+{
+    while (Core::AtomicCompareExchange(&mLock, 1, 0) != 0)
+    {
+        // Spin, critical sections only update a few counters
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void TrackingAllocator::Unlock() const
+{
+    Core::AtomicStore(&mLock, 0);
+}
+
+//----------------------------------------------------------------------------------------
+
+void TrackingAllocator::TakeSnapshot(Snapshot& outSnapshot) const
+{
+    Lock();
+    outSnapshot.mTotal = mTotal;
+    Utils::Memcpy(outSnapshot.mCategories, mCategories, sizeof(mCategories));
+    if (mSites != nullptr)
+    {
+        Utils::Memcpy(outSnapshot.mSites, mSites, sizeof(SiteStats) * MAX_SITES);
+    }
+    else
+    {
+        Utils::Memset8(outSnapshot.mSites, 0, sizeof(outSnapshot.mSites));
+    }
+    Unlock();
+}
+
+//----------------------------------------------------------------------------------------
+
+void TrackingAllocator::DiffSnapshots(const Snapshot& before, const Snapshot& after, Snapshot& outDiff)
+{
+    DiffStats(before.mTotal, after.mTotal, outDiff.mTotal);
+    for (int c = 0; c < MAX_CATEGORIES; ++c)
+    {
+        DiffStats(before.mCategories[c], after.mCategories[c], outDiff.mCategories[c]);
+    }
+
+    // Call sites keep their slot for the lifetime of the allocator, slots only get filled over time
+    for (int s = 0; s < MAX_SITES; ++s)
+    {
+        const SiteStats& afterSite = after.mSites[s];
+        const SiteStats& beforeSite = before.mSites[s];
+        SiteStats& diffSite = outDiff.mSites[s];
+        diffSite.mFile = afterSite.mFile;
+        diffSite.mLine = afterSite.mLine;
+        diffSite.mDebugText = afterSite.mDebugText;
+        diffSite.mCategory = afterSite.mCategory;
+        if (beforeSite.mFile != nullptr)
+        {
+            DiffStats(beforeSite.mStats, afterSite.mStats, diffSite.mStats);
+        }
+        else
+        {
+            diffSite.mStats = afterSite.mStats;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Appends a string to a JSON stream, with quotes and escaped characters (file paths contain backslashes)
+static void AppendJsonString(Utils::ByteStream& stream, const char* str)
+{
+    stream.Append("\"", 1);
+    if (str != nullptr)
+    {
+        for (const char* c = str; *c != '\0'; ++c)
+        {
+            if (*c == '\\' || *c == '"')
+            {
+                stream.Append("\\", 1);
+                stream.Append(c, 1);
+            }
+            else if (static_cast<unsigned char>(*c) >= 0x20)
+            {
+                stream.Append(c, 1);
+            }
+        }
+    }
+    stream.Append("\"", 1);
+}
+
+//! Appends formatted text to a stream
+static void AppendText(Utils::ByteStream& stream, const char* text)
+{
+    int length = 0;
+    while (text[length] != '\0') ++length;
+    stream.Append(text, length);
+}
+
+//! Appends the fields of a set of counters to a JSON stream
+static void AppendJsonStats(Utils::ByteStream& stream, const TrackingAllocator::Stats& stats)
+{
+    char buffer[256];
+    sprintf_s(buffer, sizeof(buffer), "\"liveBytes\":%lld,\"liveCount\":%lld,\"peakBytes\":%lld,\"totalBytes\":%lld,\"totalCount\":%lld",
+              stats.mLiveBytes, stats.mLiveCount, stats.mPeakBytes, stats.mTotalBytes, stats.mTotalCount);
+    AppendText(stream, buffer);
+}
+
+//----------------------------------------------------------------------------------------
+
+void TrackingAllocator::WriteJson(const Snapshot& snapshot, Utils::ByteStream& stream) const
+{
+    char buffer[256];
+
+    AppendText(stream, "{\"name\":");
+    AppendJsonString(stream, mName);
+    sprintf_s(buffer, sizeof(buffer), ",\"sampleRate\":%u,\"total\":{", mSampleRate);
+    AppendText(stream, buffer);
+    AppendJsonStats(stream, snapshot.mTotal);
+    AppendText(stream, "},\"categories\":[");
+
+    bool first = true;
+    for (int c = 0; c < MAX_CATEGORIES; ++c)
+    {
+        const Stats& stats = snapshot.mCategories[c];
+        if (stats.mTotalCount != 0 || stats.mLiveCount != 0)
+        {
+            sprintf_s(buffer, sizeof(buffer), "%s{\"category\":%d,\"overflow\":%s,", first ? "" : ",", c - 1, c == TRACKING_OVERFLOW_CATEGORY ? "true" : "false");
+            AppendText(stream, buffer);
+            AppendJsonStats(stream, stats);
+            AppendText(stream, "}");
+            first = false;
+        }
+    }
+
+    AppendText(stream, "],\"sites\":[");
+    first = true;
+    for (int s = 0; s < MAX_SITES; ++s)
+    {
+        const SiteStats& site = snapshot.mSites[s];
+        if (site.mFile != nullptr && (site.mStats.mTotalCount != 0 || site.mStats.mLiveCount != 0))
+        {
+            AppendText(stream, first ? "{\"file\":" : ",{\"file\":");
+            AppendJsonString(stream, site.mFile);
+            AppendText(stream, ",\"text\":");
+            AppendJsonString(stream, site.mDebugText);
+            sprintf_s(buffer, sizeof(buffer), ",\"line\":%u,\"category\":%d,", site.mLine, site.mCategory);
+            AppendText(stream, buffer);
+            AppendJsonStats(stream, site.mStats);
+            AppendText(stream, "}");
+            first = false;
+        }
+    }
+    AppendText(stream, "]}");
+}
+
+//----------------------------------------------------------------------------------------
+
+void TrackingAllocator::LogReport(unsigned int maxSites) const
+{
+    const Stats total = GetTotalStats();
+    PG_LOG('MEM_', "[%s] live: %lld bytes in %lld allocations, peak: %lld bytes, total: %lld bytes in %lld allocations",
+           mName, total.mLiveBytes, total.mLiveCount, total.mPeakBytes, total.mTotalBytes, total.mTotalCount);
+
+    Snapshot* snapshot = static_cast<Snapshot*>(mAllocator->Alloc(sizeof(Snapshot), Alloc::PG_MEM_TEMP, -1, "TrackingAllocator report", __FILE__, __LINE__));
+    TakeSnapshot(*snapshot);
+
+    for (int c = 0; c < MAX_CATEGORIES; ++c)
+    {
+        const Stats& stats = snapshot->mCategories[c];
+        if (stats.mTotalCount != 0)
+        {
+            PG_LOG('MEM_', "[%s]   category %d%s: live %lld bytes in %lld allocations, peak %lld bytes",
+                   mName, c - 1, c == TRACKING_OVERFLOW_CATEGORY ? "+" : "", stats.mLiveBytes, stats.mLiveCount, stats.mPeakBytes);
+        }
+    }
+
+    // Selection of the biggest call sites, the printed ones get their file cleared
+    for (unsigned int i = 0; i < maxSites; ++i)
+    {
+        int best = -1;
+        for (int s = 0; s < MAX_SITES; ++s)
+        {
+            const SiteStats& site = snapshot->mSites[s];
+            if (site.mFile != nullptr && site.mStats.mLiveBytes > 0 &&
+                (best < 0 || site.mStats.mLiveBytes > snapshot->mSites[best].mStats.mLiveBytes))
+            {
+                best = s;
+            }
+        }
+        if (best < 0)
+        {
+            break;
+        }
+
+        SiteStats& site = snapshot->mSites[best];
+        PG_LOG('MEM_', "[%s]   %s(%u) \"%s\": live %lld bytes in %lld allocations, peak %lld bytes",
+               mName, site.mFile, site.mLine, site.mDebugText != nullptr ? site.mDebugText : "",
+               site.mStats.mLiveBytes, site.mStats.mLiveCount, site.mStats.mPeakBytes);
+        site.mFile = nullptr;
+    }
+
+    mAllocator->Delete(snapshot);
+}
+
+//----------------------------------------------------------------------------------------
+
+long long TrackingAllocator::LogLeaks() const
+{
+    const Stats total = GetTotalStats();
+    if (total.mLiveCount == 0)
+    {
+        return 0;
+    }
+
+    PG_LOG('MEM_', "[%s] %lld allocations still alive (%lld bytes):", mName, total.mLiveCount, total.mLiveBytes);
+
+    Snapshot* snapshot = static_cast<Snapshot*>(mAllocator->Alloc(sizeof(Snapshot), Alloc::PG_MEM_TEMP, -1, "TrackingAllocator leaks", __FILE__, __LINE__));
+    TakeSnapshot(*snapshot);
+    for (int s = 0; s < MAX_SITES; ++s)
+    {
+        const SiteStats& site = snapshot->mSites[s];
+        if (site.mFile != nullptr && site.mStats.mLiveCount > 0)
+        {
+            PG_LOG('MEM_', "[%s]   %s(%u) \"%s\": %lld allocations, %lld bytes%s",
+                   mName, site.mFile, site.mLine, site.mDebugText != nullptr ? site.mDebugText : "",
+                   site.mStats.mLiveCount, site.mStats.mLiveBytes, mSampleRate > 1 ? " (estimated)" : "");
+        }
+    }
+    mAllocator->Delete(snapshot);
+
+    return total.mLiveCount;
+}
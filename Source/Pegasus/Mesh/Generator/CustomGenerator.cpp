@@ -30,7 +30,7 @@ MeshDataRef CustomGenerator::EditMeshData()
 {
     bool dummy = false;
     MeshDataRef meshData = GetUpdatedData(dummy);
-    meshData->Invalidate();
+    InvalidateData();
     return meshData;
 }
 
@@ -41,6 +41,14 @@ void CustomGenerator::GenerateData()
    
 }
 
+//----------------------------------------------------------------------------------------
+
+bool CustomGenerator::WriteDataKey(Graph::NodeDataKey & key) const
+{
+    // The content is edited by user code, it cannot be described by the node
+    return false;
+}
+
 
 }
 }
@@ -36,6 +36,8 @@ CylinderGenerator::CylinderGenerator(Pegasus::Alloc::IAllocator* nodeAllocator,
         INIT_PROPERTY(CylinderRingCuts)
         INIT_PROPERTY(CylinderFaceCount)
     END_INIT_PROPERTIES()
+    // Generated in an order with little vertex reuse, reordered once generated
+    mConfiguration.SetOptimizeVertexCache(true);
 }
 
 //----------------------------------------------------------------------------
@@ -10,19 +10,13 @@
 //! \brief	Icosphere Generator
 
 #include "Pegasus/Mesh/Generator/IcosphereGenerator.h"
-#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/Memset.h"
 #include "Pegasus/Math/Vector.h"
 
 using namespace Pegasus::Math;
 
-
-//TODO make part of the default MeshGenerator
-struct Vertex
-{
-    Pegasus::Math::Vec4 position; 
-    Pegasus::Math::Vec3 normal;        
-    Pegasus::Math::Vec2 uv; 
-};
+//! value of the empty entries of the edge hash, no edge has both parents equal to 0xFFFF
+static const unsigned int EMPTY_EDGE = 0xFFFFFFFF;
 
 static Vec2 GenUvs(const Vec3& p)
 {
@@ -51,13 +45,18 @@ END_IMPLEMENT_PROPERTIES(IcosphereGenerator)
 IcosphereGenerator::IcosphereGenerator(Pegasus::Alloc::IAllocator * nodeAllocator,
                                        Pegasus::Alloc::IAllocator * nodeDataAllocator)
 : MeshGenerator(nodeAllocator, nodeDataAllocator),
-  mIdxCache(nodeAllocator, sizeof(unsigned short))
+  mEdgeHash(nullptr),
+  mEdgeHashMask(0),
+  mVertexCount(0),
+  mIndexCount(0)
 {
     //INIT properties
     BEGIN_INIT_PROPERTIES(IcosphereGenerator)
         INIT_PROPERTY(Degree)
         INIT_PROPERTY(Radius)
     END_INIT_PROPERTIES()
+    // Generated in an order with little vertex reuse, reordered once generated
+    mConfiguration.SetOptimizeVertexCache(true);
 }
 
 //----------------------------------------------------------------------------------------
@@ -70,35 +69,38 @@ IcosphereGenerator::~IcosphereGenerator()
 
 unsigned short IcosphereGenerator::GenChild(MeshData * meshData, unsigned short p1, unsigned short p2)
 {
-    unsigned short r = 0; 
-    // is there a child generated by these two vertices?
-    mIdxCache.Get(p1, p2, r);
-
-    //mIdxCache represents an infinite table with values initialized to 0
-    if (r == 0) //no index generated yet, lets go and generate the child, which is the midpoint
+    // is there a child generated by these two vertices? the edge is the same from both sides
+    const unsigned int edge = p1 < p2 ? ((p1 << 16) | p2) : ((p2 << 16) | p1);
+    unsigned int h = edge * 0x9E3779B1u;
+    unsigned int slot = (h ^ (h >> 15)) & mEdgeHashMask;
+    while (mEdgeHash[slot].mEdge != EMPTY_EDGE)
     {
-        StdVertex * stream = meshData->GetStream<StdVertex>(0);
-        StdVertex * v1 = &stream[p1];
-        StdVertex * v2 = &stream[p2];
-        
-        StdVertex newVert;
-        //generate midpoint 
-        newVert.position =  (v1->position + v2->position) * 0.5;
-        Vec3 normalizedP = newVert.position.xyz;
-        Normalize(normalizedP);
-        newVert.position = Vec4(GetRadius()*normalizedP, 1.0);
-        newVert.normal = normalizedP;
-        newVert.uv = GenUvs(normalizedP);
-        
-        r = meshData->PushVertex(newVert, 0) + 1;
-        
-        //store the cached index
-        mIdxCache.Insert(p1, p2, r);
-        
+        if (mEdgeHash[slot].mEdge == edge)
+        {
+            return mEdgeHash[slot].mMidpoint;
+        }
+        slot = (slot + 1) & mEdgeHashMask;
     }
-    
-    return r - 1;
 
+    //no index generated yet, lets go and generate the child, which is the midpoint
+    StdVertex * stream = meshData->GetStream<StdVertex>(0);
+    PG_ASSERT(mVertexCount < meshData->GetVertexCount());
+    StdVertex * v1 = &stream[p1];
+    StdVertex * v2 = &stream[p2];
+    StdVertex * newVert = &stream[mVertexCount];
+    //generate midpoint 
+    newVert->position =  (v1->position + v2->position) * 0.5;
+    Vec3 normalizedP = newVert->position.xyz;
+    Normalize(normalizedP);
+    newVert->position = Vec4(GetRadius()*normalizedP, 1.0);
+    newVert->normal = normalizedP;
+    newVert->uv = GenUvs(normalizedP);
+    
+    //store the cached index
+    const unsigned short r = static_cast<unsigned short>(mVertexCount++);
+    mEdgeHash[slot].mEdge = edge;
+    mEdgeHash[slot].mMidpoint = r;
+    return r;
 }
 
 //----------------------------------------------------------------------------------------
@@ -109,9 +111,11 @@ void IcosphereGenerator::Tesselate(MeshData * meshData, int level, unsigned shor
     if (level == 1)
     {
         //base case, lets go ahead and register this triangle (reached the lowest tesselation level possilbe)
-        meshData->PushIndex(a);
-        meshData->PushIndex(b);
-        meshData->PushIndex(c);
+        PG_ASSERT(mIndexCount + 3 <= meshData->GetIndexCount());
+        unsigned short * indices = meshData->GetIndexBuffer();
+        indices[mIndexCount++] = a;
+        indices[mIndexCount++] = b;
+        indices[mIndexCount++] = c;
     }
     else
     {
@@ -192,30 +196,59 @@ void IcosphereGenerator::GenerateData()
         7,  9,  5
     };
 
+    int degree = GetDegree();
+    if (degree < 1 || degree > ICOSPHERE_MAX_DEGREE)
+    {
+        PG_LOG('ERR_', "Icosphere degree must be between 1 and %d.", ICOSPHERE_MAX_DEGREE);
+        degree = degree < 1 ? 1 : ICOSPHERE_MAX_DEGREE;
+    }
+
+    // each degree splits every triangle in 4, adding a single vertex per edge since the midpoints are shared:
+    // 20 * 4^(degree - 1) triangles, 30 * 4^(degree - 1) edges, and 10 * 4^(degree - 1) + 2 vertices
+    const int faceSplits = 1 << (2 * (degree - 1));
+    const int vertexCount = 10 * faceSplits + 2;
+    meshData->AllocateVertexes(vertexCount);
+    meshData->AllocateIndexes(60 * faceSplits);
+    mVertexCount = 0;
+    mIndexCount = 0;
+
+    // one edge hash entry per midpoint, the table is kept at most half full
+    unsigned int edgeHashSize = 1;
+    while (edgeHashSize < static_cast<unsigned int>(2 * vertexCount))
+    {
+        edgeHashSize <<= 1;
+    }
+    mEdgeHash = PG_NEW_ARRAY(GetNodeDataAllocator(), -1, "Icosphere edge hash", Pegasus::Alloc::PG_MEM_TEMP, EdgeEntry, edgeHashSize);
+    mEdgeHashMask = edgeHashSize - 1;
+    Pegasus::Utils::Memset8(mEdgeHash, static_cast<char>(0xFF), edgeHashSize * sizeof(EdgeEntry));
+
     //register all icosahedron vertices
+    StdVertex * stream = meshData->GetStream<StdVertex>(0);
     for (int i = 0; i < (sizeof(icosahedron) / sizeof(float)); i += 3)
     {
-        Vertex v;
+        StdVertex& v = stream[mVertexCount++];
         Vec3 pos = Vec3(icosahedron[i + 0], icosahedron[i + 1], icosahedron[i + 2]);
         Normalize(pos);
         v.position = Vec4(GetRadius()*pos, 1.0);
         v.normal = pos;
         v.uv = GenUvs(pos);
-        meshData->PushVertex<Vertex>(v, 0);
     }
-    PG_ASSERT(GetDegree() > 0);
     // do tesseleation step on icosahedron so we generate an icosphere
     for (int i = 0; i < sizeof(icotriangles)/sizeof(unsigned short); i += 3)
     {
         Tesselate(
             &(*meshData),
-            GetDegree() <= 0 ? 1 : GetDegree(),
+            degree,
             icotriangles[i + 2],
             icotriangles[i + 1],
             icotriangles[i]
         );
     } 
-    mIdxCache.Clear();
+    PG_ASSERT(mVertexCount == meshData->GetVertexCount() && mIndexCount == meshData->GetIndexCount());
+    PG_LOG('MESH', "Icosphere of degree %d: %d vertices for %d triangles (%d with unshared midpoints)",
+           degree, mVertexCount, mIndexCount / 3, mIndexCount);
+    PG_DELETE_ARRAY(GetNodeDataAllocator(), mEdgeHash);
+    mEdgeHash = nullptr;
 
     PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
 }
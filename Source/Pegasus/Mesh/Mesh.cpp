@@ -11,6 +11,7 @@
 
 #include "Pegasus/Mesh/Mesh.h"
 #include "Pegasus/Mesh/IMeshFactory.h"
+#include "Pegasus/Graph/NodeDataResidency.h"
 
 namespace Pegasus {
 namespace Mesh {
@@ -24,6 +25,7 @@ END_IMPLEMENT_PROPERTIES(Mesh)
 Mesh::Mesh(Graph::NodeManager* nodeManager, Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocator)
 :   Graph::OutputNode(nodeManager, nodeAllocator, nodeDataAllocator)
 ,   mConfiguration()
+,   mDataResidency(nullptr)
 #if PEGASUS_ENABLE_PROXIES
     ,mProxy(this)
 #endif
@@ -68,6 +70,12 @@ MeshDataReturn Mesh::GetUpdatedMeshData()
     MeshDataRef meshData = Graph::OutputNode::GetUpdatedData(updated);
     if (meshData != nullptr && meshData->IsGPUDataDirty())
     {
+        // The upload reads the CPU copy, discarded if the GPU data has been destroyed since the last upload
+        if (!meshData->IsCPUDataResident())
+        {
+            RestoreCPUData();
+        }
+
 #if PEGASUS_ENABLE_DETAILED_LOG
 #if PEGASUS_ENABLE_PROXIES
         PG_LOG('MESH', "Generating the GPU data of mesh \"%s\"", GetName());
@@ -77,12 +85,81 @@ MeshDataReturn Mesh::GetUpdatedMeshData()
 #endif  // PEGASUS_ENABLE_DETAILED_LOG
 
         mFactory->GenerateMeshGPUData(&(*meshData));
+        if (mDataResidency != nullptr)
+        {
+            mDataResidency->OnGPUDataValidated(&(*meshData));
+        }
     }
     return meshData;
 }
 
 //----------------------------------------------------------------------------------------
 
+int Mesh::SelectLod(float distance, float projectionScale, float maxPixelError)
+{
+    // The levels of detail are kept with the counts when the CPU copy is discarded
+    MeshDataRef meshData = GetUpdatedMeshData();
+    return (meshData != nullptr) ? meshData->SelectLod(distance, projectionScale, maxPixelError) : 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Mesh::GetPositionDecode(Math::Vec3 & offset, Math::Vec3 & scale)
+{
+    // The decoding is kept with the counts when the CPU copy is discarded
+    MeshDataRef meshData = GetUpdatedMeshData();
+    if (meshData != nullptr)
+    {
+        offset = meshData->GetPositionOffset();
+        scale = meshData->GetPositionScale();
+    }
+    else
+    {
+        offset = Math::Vec3(0.0f, 0.0f, 0.0f);
+        scale = Math::Vec3(1.0f, 1.0f, 1.0f);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Mesh::GetBounds(Math::AxisAlignedBoundingBox & box, Math::BoundingSphere & sphere)
+{
+    // The bounds are kept with the counts when the CPU copy is discarded
+    MeshDataRef meshData = GetUpdatedMeshData();
+    if (meshData != nullptr)
+    {
+        box = meshData->GetBoundingBox();
+        sphere = meshData->GetBoundingSphere();
+    }
+    else
+    {
+        box.SetZero();
+        sphere = Math::BoundingSphere();
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool Mesh::Raycast(const Math::Ray & ray, float maxDistance, MeshRayHit & hit)
+{
+    MeshDataRef meshData = GetUpdatedMeshData();
+    if (meshData == nullptr)
+    {
+        return false;
+    }
+
+    const MeshBvh * bvh = meshData->GetBvh();
+    if (bvh == nullptr && !meshData->IsCPUDataResident())
+    {
+        // The hierarchy is built from the CPU copy, regenerated once
+        RestoreCPUData();
+        bvh = meshData->GetBvh();
+    }
+    return (bvh != nullptr) && bvh->Raycast(ray, maxDistance, hit);
+}
+
+//----------------------------------------------------------------------------------------
+
 void Mesh::ReleaseDataAndPropagate()
 {
     //! \todo See note in ReleaseGPUData()
@@ -100,7 +177,8 @@ void Mesh::ReleaseGPUData()
     //!       This function can destroy GPU data of another graph sharing the same node.
     //!       GetUpdatedData() is called twice, and the first call might generate the data
     //!       of the graph that could have been empty, to release the content right after.
-    if (GetNumInputs() == 1 && GetInput(0)->GetData() != nullptr && mFactory != nullptr)
+    //!       Shared data keeps its GPU data for the other users, the data interner releases it.
+    if (GetNumInputs() == 1 && GetInput(0)->GetData() != nullptr && !GetInput(0)->GetData()->IsInterned() && mFactory != nullptr)
     {
 #if PEGASUS_ENABLE_DETAILED_LOG
 #if PEGASUS_ENABLE_PROXIES
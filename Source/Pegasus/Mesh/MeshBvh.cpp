@@ -0,0 +1,729 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshBvh.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Bounding volume hierarchy over the triangles of a mesh, for ray queries
+
+#include "Pegasus/Mesh/MeshBvh.h"
+#include "Pegasus/Math/Scalar.h"
+#include "Pegasus/Core/Profiler.h"
+#include "Pegasus/Core/Time.h"
+
+#if PEGASUS_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Pegasus {
+namespace Mesh {
+
+
+namespace Internal {
+
+//! Number of bins of the surface area heuristic, for each axis
+static const unsigned int BVH_BIN_COUNT = 16;
+
+//! Depth of the binary tree beyond which the nodes are split in halves, bounding the depth
+static const unsigned int BVH_SAH_MAX_DEPTH = 40;
+
+//! Size of the traversal stack, enough for the bounded depth of the tree
+static const unsigned int BVH_STACK_SIZE = 256;
+
+//! Smallest magnitude of the ray direction components, avoiding infinite inverses
+static const float BVH_MIN_DIRECTION = 1.0e-20f;
+
+//----------------------------------------------------------------------------------------
+
+// 4-lane vector operations used by the ray queries.
+// The scalar versions perform the same IEEE operations in the same order.
+
+#if PEGASUS_SIMD_SSE2
+
+typedef __m128 Float4;
+
+inline Float4 SetF(float v)                     { return _mm_set1_ps(v); }
+inline Float4 LoadF(const float * values)       { return _mm_loadu_ps(values); }
+inline Float4 AddF(Float4 a, Float4 b)          { return _mm_add_ps(a, b); }
+inline Float4 SubF(Float4 a, Float4 b)          { return _mm_sub_ps(a, b); }
+inline Float4 MulF(Float4 a, Float4 b)          { return _mm_mul_ps(a, b); }
+inline Float4 DivF(Float4 a, Float4 b)          { return _mm_div_ps(a, b); }
+inline Float4 MinF(Float4 a, Float4 b)          { return _mm_min_ps(a, b); }
+inline Float4 MaxF(Float4 a, Float4 b)          { return _mm_max_ps(a, b); }
+inline Float4 AbsF(Float4 a)                    { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+inline Float4 CmpLeF(Float4 a, Float4 b)        { return _mm_cmple_ps(a, b); }
+inline Float4 CmpLtF(Float4 a, Float4 b)        { return _mm_cmplt_ps(a, b); }
+inline Float4 CmpGeF(Float4 a, Float4 b)        { return _mm_cmpge_ps(a, b); }
+inline Float4 CmpGtF(Float4 a, Float4 b)        { return _mm_cmpgt_ps(a, b); }
+inline Float4 AndF(Float4 a, Float4 b)          { return _mm_and_ps(a, b); }
+inline int MaskF(Float4 a)                      { return _mm_movemask_ps(a); }
+inline void StoreF(float * values, Float4 a)    { _mm_storeu_ps(values, a); }
+
+#else
+
+struct Float4 { float v[4]; };
+
+//! Bits of a floating point number, for the comparison masks
+union FloatBits
+{
+    float f;
+    unsigned int u;
+};
+
+//! Comparison result of a lane, all bits set when true
+inline float MaskLane(bool value)
+{
+    FloatBits bits;
+    bits.u = value ? 0xFFFFFFFF : 0;
+    return bits.f;
+}
+
+//! Test if the comparison result of a lane is true
+inline bool IsLaneSet(float value)
+{
+    FloatBits bits;
+    bits.f = value;
+    return bits.u != 0;
+}
+
+#define PEGASUS_BVH_FLOAT4_OP(expression) Float4 r; for (unsigned int i = 0; i < 4; ++i) { r.v[i] = (expression); } return r;
+
+inline Float4 SetF(float v)                     { PEGASUS_BVH_FLOAT4_OP(v) }
+inline Float4 LoadF(const float * values)       { PEGASUS_BVH_FLOAT4_OP(values[i]) }
+inline Float4 AddF(Float4 a, Float4 b)          { PEGASUS_BVH_FLOAT4_OP(a.v[i] + b.v[i]) }
+inline Float4 SubF(Float4 a, Float4 b)          { PEGASUS_BVH_FLOAT4_OP(a.v[i] - b.v[i]) }
+inline Float4 MulF(Float4 a, Float4 b)          { PEGASUS_BVH_FLOAT4_OP(a.v[i] * b.v[i]) }
+inline Float4 DivF(Float4 a, Float4 b)          { PEGASUS_BVH_FLOAT4_OP(a.v[i] / b.v[i]) }
+inline Float4 MinF(Float4 a, Float4 b)          { PEGASUS_BVH_FLOAT4_OP((a.v[i] < b.v[i]) ? a.v[i] : b.v[i]) }
+inline Float4 MaxF(Float4 a, Float4 b)          { PEGASUS_BVH_FLOAT4_OP((a.v[i] > b.v[i]) ? a.v[i] : b.v[i]) }
+inline Float4 AbsF(Float4 a)                    { PEGASUS_BVH_FLOAT4_OP(Math::Abs(a.v[i])) }
+inline Float4 CmpLeF(Float4 a, Float4 b)        { PEGASUS_BVH_FLOAT4_OP(MaskLane(a.v[i] <= b.v[i])) }
+inline Float4 CmpLtF(Float4 a, Float4 b)        { PEGASUS_BVH_FLOAT4_OP(MaskLane(a.v[i] < b.v[i])) }
+inline Float4 CmpGeF(Float4 a, Float4 b)        { PEGASUS_BVH_FLOAT4_OP(MaskLane(a.v[i] >= b.v[i])) }
+inline Float4 CmpGtF(Float4 a, Float4 b)        { PEGASUS_BVH_FLOAT4_OP(MaskLane(a.v[i] > b.v[i])) }
+inline Float4 AndF(Float4 a, Float4 b)          { PEGASUS_BVH_FLOAT4_OP(MaskLane(IsLaneSet(a.v[i]) && IsLaneSet(b.v[i]))) }
+inline void StoreF(float * values, Float4 a)    { for (unsigned int i = 0; i < 4; ++i) { values[i] = a.v[i]; } }
+
+inline int MaskF(Float4 a)
+{
+    int mask = 0;
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        mask |= IsLaneSet(a.v[i]) ? (1 << i) : 0;
+    }
+    return mask;
+}
+
+#undef PEGASUS_BVH_FLOAT4_OP
+
+#endif  // PEGASUS_SIMD_SSE2
+
+//----------------------------------------------------------------------------------------
+
+//! Bounds being accumulated, empty when created
+struct Bounds
+{
+    float mMin[3];
+    float mMax[3];
+
+    Bounds()
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            mMin[c] = PFLOAT_MAX;
+            mMax[c] = -PFLOAT_MAX;
+        }
+    }
+
+    void Extend(const float * point)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            mMin[c] = Math::Min(mMin[c], point[c]);
+            mMax[c] = Math::Max(mMax[c], point[c]);
+        }
+    }
+
+    void Extend(const float * boundsMin, const float * boundsMax)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            mMin[c] = Math::Min(mMin[c], boundsMin[c]);
+            mMax[c] = Math::Max(mMax[c], boundsMax[c]);
+        }
+    }
+
+    //! Half of the surface area, 0 when empty
+    float HalfArea() const
+    {
+        if (mMin[0] > mMax[0])
+        {
+            return 0.0f;
+        }
+        const float dx = mMax[0] - mMin[0];
+        const float dy = mMax[1] - mMin[1];
+        const float dz = mMax[2] - mMin[2];
+        return dx * dy + dy * dz + dz * dx;
+    }
+};
+
+}   // namespace Internal
+
+//----------------------------------------------------------------------------------------
+
+//! Node of the binary tree being built
+struct MeshBvh::BuildNode
+{
+    float mMin[3];
+    float mMax[3];
+    unsigned int mFirst;    //!< First triangle reference of the node
+    unsigned int mCount;    //!< Number of triangle references, 0 for inner nodes after the split
+    unsigned int mLeft;     //!< Index of the left child, the right one following it
+    unsigned int mDepth;    //!< Depth in the binary tree
+};
+
+//! Temporary data of a build
+struct MeshBvh::BuildContext
+{
+    const Math::Vec3 * mPositions;
+    const unsigned short * mIndices;
+    unsigned int * mTriangleRefs;       //!< Triangle indices, reordered by the splits
+    float * mTriangleBounds;            //!< Min and max corners of each triangle (6 floats)
+    float * mCentroids;                 //!< Center of the bounds of each triangle (3 floats)
+    BuildNode * mBuildNodes;
+    unsigned int mNumBuildNodes;
+    unsigned int mNumInnerNodes;
+};
+
+//----------------------------------------------------------------------------------------
+
+MeshBvh::MeshBvh(Alloc::IAllocator * allocator)
+:   mAllocator(allocator),
+    mNodes(nullptr),
+    mNumNodes(0),
+    mPackets(nullptr),
+    mNumPackets(0),
+    mNumTriangles(0)
+{
+}
+
+//----------------------------------------------------------------------------------------
+
+MeshBvh::~MeshBvh()
+{
+    Clear();
+}
+
+//----------------------------------------------------------------------------------------
+
+void MeshBvh::Clear()
+{
+    if (mNodes != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mNodes);
+        mNodes = nullptr;
+    }
+    if (mPackets != nullptr)
+    {
+        PG_DELETE_ARRAY(mAllocator, mPackets);
+        mPackets = nullptr;
+    }
+    mNumNodes = 0;
+    mNumPackets = 0;
+    mNumTriangles = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int MeshBvh::GetMemorySize() const
+{
+    return mNumNodes * sizeof(Node) + mNumPackets * sizeof(TrianglePacket);
+}
+
+//----------------------------------------------------------------------------------------
+
+void MeshBvh::Build(const Math::Vec3 * positions,
+                    unsigned int numVertices,
+                    const unsigned short * indices,
+                    unsigned int numTriangles)
+{
+    PG_PROFILE_SCOPE("BuildMeshBvh");
+    const unsigned long long startCounter = Core::GetPerformanceCounter();
+
+    Clear();
+    if (numTriangles == 0)
+    {
+        return;
+    }
+    PG_ASSERT(positions != nullptr);
+    PG_ASSERT((indices != nullptr) || (numTriangles * 3 <= numVertices));
+    mNumTriangles = numTriangles;
+
+    BuildContext context;
+    context.mPositions = positions;
+    context.mIndices = indices;
+    context.mTriangleRefs = PG_NEW_ARRAY(mAllocator, -1, "MeshBvh::TriangleRefs", Alloc::PG_MEM_TEMP, unsigned int, numTriangles);
+    context.mTriangleBounds = PG_NEW_ARRAY(mAllocator, -1, "MeshBvh::TriangleBounds", Alloc::PG_MEM_TEMP, float, numTriangles * 6);
+    context.mCentroids = PG_NEW_ARRAY(mAllocator, -1, "MeshBvh::Centroids", Alloc::PG_MEM_TEMP, float, numTriangles * 3);
+    context.mBuildNodes = PG_NEW_ARRAY(mAllocator, -1, "MeshBvh::BuildNodes", Alloc::PG_MEM_TEMP, BuildNode, numTriangles * 2);
+    context.mNumBuildNodes = 1;
+    context.mNumInnerNodes = 0;
+
+    // Bounds and centroids of the triangles, and bounds of the root
+    Internal::Bounds rootBounds;
+    for (unsigned int t = 0; t < numTriangles; ++t)
+    {
+        Internal::Bounds triangleBounds;
+        for (unsigned int corner = 0; corner < 3; ++corner)
+        {
+            const unsigned int vertex = (indices != nullptr) ? indices[t * 3 + corner] : t * 3 + corner;
+            PG_ASSERT(vertex < numVertices);
+            triangleBounds.Extend(positions[vertex].v);
+        }
+        for (int c = 0; c < 3; ++c)
+        {
+            context.mTriangleBounds[t * 6 + c] = triangleBounds.mMin[c];
+            context.mTriangleBounds[t * 6 + 3 + c] = triangleBounds.mMax[c];
+            context.mCentroids[t * 3 + c] = (triangleBounds.mMin[c] + triangleBounds.mMax[c]) * 0.5f;
+        }
+        context.mTriangleRefs[t] = t;
+        rootBounds.Extend(triangleBounds.mMin, triangleBounds.mMax);
+    }
+
+    BuildNode & root = context.mBuildNodes[0];
+    for (int c = 0; c < 3; ++c)
+    {
+        root.mMin[c] = rootBounds.mMin[c];
+        root.mMax[c] = rootBounds.mMax[c];
+    }
+    root.mFirst = 0;
+    root.mCount = numTriangles;
+    root.mLeft = 0;
+    root.mDepth = 0;
+
+    // Split the nodes in creation order, the children being appended after them.
+    // Each split creates 2 non-empty nodes, so the tree has less than 2 nodes per triangle
+    for (unsigned int n = 0; n < context.mNumBuildNodes; ++n)
+    {
+        const unsigned int first = context.mBuildNodes[n].mFirst;
+        const unsigned int count = context.mBuildNodes[n].mCount;
+        if (count <= WIDTH)
+        {
+            continue;
+        }
+
+        Internal::Bounds centroidBounds;
+        for (unsigned int r = first; r < first + count; ++r)
+        {
+            centroidBounds.Extend(&context.mCentroids[context.mTriangleRefs[r] * 3]);
+        }
+
+        // Binned surface area heuristic, on the 3 axes
+        int bestAxis = -1;
+        unsigned int bestBin = 0;
+        float bestCost = PFLOAT_MAX;
+        if (context.mBuildNodes[n].mDepth < Internal::BVH_SAH_MAX_DEPTH)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                const float extent = centroidBounds.mMax[axis] - centroidBounds.mMin[axis];
+                if (extent <= 0.0f)
+                {
+                    continue;
+                }
+
+                const float binScale = static_cast<float>(Internal::BVH_BIN_COUNT) * 0.9999f / extent;
+                Internal::Bounds binBounds[Internal::BVH_BIN_COUNT];
+                unsigned int binCounts[Internal::BVH_BIN_COUNT] = { 0 };
+                for (unsigned int r = first; r < first + count; ++r)
+                {
+                    const unsigned int t = context.mTriangleRefs[r];
+                    const unsigned int bin = Math::Min(static_cast<unsigned int>((context.mCentroids[t * 3 + axis] - centroidBounds.mMin[axis]) * binScale),
+                                                       Internal::BVH_BIN_COUNT - 1);
+                    binBounds[bin].Extend(&context.mTriangleBounds[t * 6], &context.mTriangleBounds[t * 6 + 3]);
+                    ++binCounts[bin];
+                }
+
+                // Sweep from the right to get the cost of the right side of each split
+                float rightCosts[Internal::BVH_BIN_COUNT];
+                Internal::Bounds rightBounds;
+                unsigned int rightCount = 0;
+                for (unsigned int bin = Internal::BVH_BIN_COUNT - 1; bin > 0; --bin)
+                {
+                    rightBounds.Extend(binBounds[bin].mMin, binBounds[bin].mMax);
+                    rightCount += binCounts[bin];
+                    rightCosts[bin - 1] = rightBounds.HalfArea() * static_cast<float>(rightCount);
+                }
+
+                // Sweep from the left, the split being after the bin
+                Internal::Bounds leftBounds;
+                unsigned int leftCount = 0;
+                for (unsigned int bin = 0; bin < Internal::BVH_BIN_COUNT - 1; ++bin)
+                {
+                    leftBounds.Extend(binBounds[bin].mMin, binBounds[bin].mMax);
+                    leftCount += binCounts[bin];
+                    const float cost = leftBounds.HalfArea() * static_cast<float>(leftCount) + rightCosts[bin];
+                    if ((leftCount > 0) && (leftCount < count) && (cost < bestCost))
+                    {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestBin = bin;
+                    }
+                }
+            }
+        }
+
+        // Partition the triangle references
+        unsigned int leftCount = count / 2;
+        if (bestAxis >= 0)
+        {
+            const float extent = centroidBounds.mMax[bestAxis] - centroidBounds.mMin[bestAxis];
+            const float binScale = static_cast<float>(Internal::BVH_BIN_COUNT) * 0.9999f / extent;
+            unsigned int left = first;
+            unsigned int right = first + count;
+            while (left < right)
+            {
+                const unsigned int t = context.mTriangleRefs[left];
+                const unsigned int bin = Math::Min(static_cast<unsigned int>((context.mCentroids[t * 3 + bestAxis] - centroidBounds.mMin[bestAxis]) * binScale),
+                                                   Internal::BVH_BIN_COUNT - 1);
+                if (bin <= bestBin)
+                {
+                    ++left;
+                }
+                else
+                {
+                    --right;
+                    context.mTriangleRefs[left] = context.mTriangleRefs[right];
+                    context.mTriangleRefs[right] = t;
+                }
+            }
+            leftCount = left - first;
+        }
+        // else coincident centroids or deep node, split in halves in the current order
+        PG_ASSERT(leftCount > 0 && leftCount < count);
+
+        // Create the children
+        const unsigned int leftIndex = context.mNumBuildNodes;
+        context.mNumBuildNodes += 2;
+        PG_ASSERT(context.mNumBuildNodes <= numTriangles * 2);
+        for (unsigned int side = 0; side < 2; ++side)
+        {
+            BuildNode & child = context.mBuildNodes[leftIndex + side];
+            child.mFirst = (side == 0) ? first : first + leftCount;
+            child.mCount = (side == 0) ? leftCount : count - leftCount;
+            child.mLeft = 0;
+            child.mDepth = context.mBuildNodes[n].mDepth + 1;
+
+            Internal::Bounds childBounds;
+            for (unsigned int r = child.mFirst; r < child.mFirst + child.mCount; ++r)
+            {
+                const unsigned int t = context.mTriangleRefs[r];
+                childBounds.Extend(&context.mTriangleBounds[t * 6], &context.mTriangleBounds[t * 6 + 3]);
+            }
+            for (int c = 0; c < 3; ++c)
+            {
+                child.mMin[c] = childBounds.mMin[c];
+                child.mMax[c] = childBounds.mMax[c];
+            }
+        }
+        context.mBuildNodes[n].mLeft = leftIndex;
+        context.mBuildNodes[n].mCount = 0;
+        ++context.mNumInnerNodes;
+    }
+
+    // Collapse into the 4-wide tree, which has at most as many nodes as the inner binary nodes.
+    // A root leaf gets a node with a single child
+    const unsigned int numLeaves = context.mNumBuildNodes - context.mNumInnerNodes;
+    const unsigned int maxNodes = Math::Max(context.mNumInnerNodes, 1u);
+    mNodes = PG_NEW_ARRAY(mAllocator, -1, "MeshBvh::Nodes", Alloc::PG_MEM_PERM, Node, maxNodes);
+    mPackets = PG_NEW_ARRAY(mAllocator, -1, "MeshBvh::Packets", Alloc::PG_MEM_PERM, TrianglePacket, numLeaves);
+    if (context.mNumInnerNodes == 0)
+    {
+        Node & node = mNodes[mNumNodes++];
+        for (unsigned int slot = 0; slot < WIDTH; ++slot)
+        {
+            node.mMinX[slot] = root.mMin[0];    node.mMaxX[slot] = root.mMax[0];
+            node.mMinY[slot] = root.mMin[1];    node.mMaxY[slot] = root.mMax[1];
+            node.mMinZ[slot] = root.mMin[2];    node.mMaxZ[slot] = root.mMax[2];
+            node.mChildren[slot] = EMPTY_CHILD;
+        }
+        node.mChildren[0] = LEAF_FLAG | CreatePacket(context, 0);
+    }
+    else
+    {
+        CollapseNode(context, 0);
+    }
+
+    PG_DELETE_ARRAY(mAllocator, context.mBuildNodes);
+    PG_DELETE_ARRAY(mAllocator, context.mCentroids);
+    PG_DELETE_ARRAY(mAllocator, context.mTriangleBounds);
+    PG_DELETE_ARRAY(mAllocator, context.mTriangleRefs);
+
+    const double buildMs = static_cast<double>(Core::GetPerformanceCounter() - startCounter) * Core::GetPerformanceCounterPeriod() * 1000.0;
+    PG_LOG('MESH', "Mesh BVH built: %u triangles, %u nodes, %u leaves, %u bytes, %.2f ms",
+           numTriangles, mNumNodes, mNumPackets, GetMemorySize(), buildMs);
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int MeshBvh::CollapseNode(BuildContext & context, unsigned int buildNodeIndex)
+{
+    const unsigned int nodeIndex = mNumNodes++;
+
+    // Open the inner children with the largest area until the node is full
+    unsigned int children[WIDTH];
+    unsigned int numChildren = 2;
+    children[0] = context.mBuildNodes[buildNodeIndex].mLeft;
+    children[1] = children[0] + 1;
+    while (numChildren < WIDTH)
+    {
+        int openedChild = -1;
+        float openedArea = -1.0f;
+        for (unsigned int c = 0; c < numChildren; ++c)
+        {
+            const BuildNode & child = context.mBuildNodes[children[c]];
+            if (child.mCount == 0)
+            {
+                Internal::Bounds childBounds;
+                childBounds.Extend(child.mMin, child.mMax);
+                const float area = childBounds.HalfArea();
+                if (area > openedArea)
+                {
+                    openedArea = area;
+                    openedChild = static_cast<int>(c);
+                }
+            }
+        }
+        if (openedChild < 0)
+        {
+            break;
+        }
+        const unsigned int left = context.mBuildNodes[children[openedChild]].mLeft;
+        children[openedChild] = left;
+        children[numChildren++] = left + 1;
+    }
+
+    for (unsigned int slot = 0; slot < WIDTH; ++slot)
+    {
+        unsigned int childValue = EMPTY_CHILD;
+        float boundsMin[3] = { 0.0f, 0.0f, 0.0f };
+        float boundsMax[3] = { 0.0f, 0.0f, 0.0f };
+        if (slot < numChildren)
+        {
+            const BuildNode & child = context.mBuildNodes[children[slot]];
+            for (int c = 0; c < 3; ++c)
+            {
+                boundsMin[c] = child.mMin[c];
+                boundsMax[c] = child.mMax[c];
+            }
+            childValue = (child.mCount > 0) ? (LEAF_FLAG | CreatePacket(context, children[slot]))
+                                            : CollapseNode(context, children[slot]);
+        }
+
+        // The array is preallocated, the reference stays valid through the recursion
+        Node & node = mNodes[nodeIndex];
+        node.mMinX[slot] = boundsMin[0];    node.mMaxX[slot] = boundsMax[0];
+        node.mMinY[slot] = boundsMin[1];    node.mMaxY[slot] = boundsMax[1];
+        node.mMinZ[slot] = boundsMin[2];    node.mMaxZ[slot] = boundsMax[2];
+        node.mChildren[slot] = childValue;
+    }
+    return nodeIndex;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int MeshBvh::CreatePacket(BuildContext & context, unsigned int buildNodeIndex)
+{
+    const BuildNode & leaf = context.mBuildNodes[buildNodeIndex];
+    PG_ASSERT(leaf.mCount > 0 && leaf.mCount <= WIDTH);
+
+    const unsigned int packetIndex = mNumPackets++;
+    TrianglePacket & packet = mPackets[packetIndex];
+    for (unsigned int lane = 0; lane < WIDTH; ++lane)
+    {
+        if (lane < leaf.mCount)
+        {
+            const unsigned int t = context.mTriangleRefs[leaf.mFirst + lane];
+            const unsigned int i0 = (context.mIndices != nullptr) ? context.mIndices[t * 3]     : t * 3;
+            const unsigned int i1 = (context.mIndices != nullptr) ? context.mIndices[t * 3 + 1] : t * 3 + 1;
+            const unsigned int i2 = (context.mIndices != nullptr) ? context.mIndices[t * 3 + 2] : t * 3 + 2;
+            const Math::Vec3 & p0 = context.mPositions[i0];
+            const Math::Vec3 & p1 = context.mPositions[i1];
+            const Math::Vec3 & p2 = context.mPositions[i2];
+            packet.mP0X[lane] = p0.v[0];            packet.mP0Y[lane] = p0.v[1];            packet.mP0Z[lane] = p0.v[2];
+            packet.mE1X[lane] = p1.v[0] - p0.v[0];  packet.mE1Y[lane] = p1.v[1] - p0.v[1];  packet.mE1Z[lane] = p1.v[2] - p0.v[2];
+            packet.mE2X[lane] = p2.v[0] - p0.v[0];  packet.mE2Y[lane] = p2.v[1] - p0.v[1];  packet.mE2Z[lane] = p2.v[2] - p0.v[2];
+            packet.mTriangles[lane] = t;
+        }
+        else
+        {
+            packet.mP0X[lane] = 0.0f;   packet.mP0Y[lane] = 0.0f;   packet.mP0Z[lane] = 0.0f;
+            packet.mE1X[lane] = 0.0f;   packet.mE1Y[lane] = 0.0f;   packet.mE1Z[lane] = 0.0f;
+            packet.mE2X[lane] = 0.0f;   packet.mE2Y[lane] = 0.0f;   packet.mE2Z[lane] = 0.0f;
+            packet.mTriangles[lane] = EMPTY_CHILD;
+        }
+    }
+    return packetIndex;
+}
+
+//----------------------------------------------------------------------------------------
+
+bool MeshBvh::Raycast(const Math::Ray & ray, float maxDistance, MeshRayHit & hit) const
+{
+    using namespace Internal;
+
+    if (mNumNodes == 0)
+    {
+        return false;
+    }
+
+    const Math::Vec3 & origin = ray.GetOrigin();
+    const Math::Vec3 & direction = ray.GetDirection();
+    float invDirection[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        const float d = (Math::Abs(direction.v[c]) < BVH_MIN_DIRECTION) ? ((direction.v[c] < 0.0f) ? -BVH_MIN_DIRECTION : BVH_MIN_DIRECTION)
+                                                                         : direction.v[c];
+        invDirection[c] = 1.0f / d;
+    }
+
+    const Float4 originX = SetF(origin.v[0]);
+    const Float4 originY = SetF(origin.v[1]);
+    const Float4 originZ = SetF(origin.v[2]);
+    const Float4 directionX = SetF(direction.v[0]);
+    const Float4 directionY = SetF(direction.v[1]);
+    const Float4 directionZ = SetF(direction.v[2]);
+    const Float4 invDirectionX = SetF(invDirection[0]);
+    const Float4 invDirectionY = SetF(invDirection[1]);
+    const Float4 invDirectionZ = SetF(invDirection[2]);
+    const Float4 zero = SetF(0.0f);
+    const Float4 one = SetF(1.0f);
+
+    float closestDistance = maxDistance;
+    bool found = false;
+
+    // Stack of the entries to visit, with their entry distance
+    unsigned int stack[BVH_STACK_SIZE];
+    float stackDistances[BVH_STACK_SIZE];
+    unsigned int stackSize = 1;
+    stack[0] = 0;
+    stackDistances[0] = 0.0f;
+
+    while (stackSize > 0)
+    {
+        --stackSize;
+        if (stackDistances[stackSize] > closestDistance)
+        {
+            continue;
+        }
+        const unsigned int entry = stack[stackSize];
+
+        if (entry & LEAF_FLAG)
+        {
+            // Moller-Trumbore test of the 4 triangles of the leaf
+            const TrianglePacket & packet = mPackets[entry & ~LEAF_FLAG];
+            const Float4 e1X = LoadF(packet.mE1X), e1Y = LoadF(packet.mE1Y), e1Z = LoadF(packet.mE1Z);
+            const Float4 e2X = LoadF(packet.mE2X), e2Y = LoadF(packet.mE2Y), e2Z = LoadF(packet.mE2Z);
+
+            const Float4 pX = SubF(MulF(directionY, e2Z), MulF(directionZ, e2Y));
+            const Float4 pY = SubF(MulF(directionZ, e2X), MulF(directionX, e2Z));
+            const Float4 pZ = SubF(MulF(directionX, e2Y), MulF(directionY, e2X));
+            const Float4 det = AddF(AddF(MulF(e1X, pX), MulF(e1Y, pY)), MulF(e1Z, pZ));
+            const Float4 invDet = DivF(one, det);
+
+            const Float4 tX = SubF(originX, LoadF(packet.mP0X));
+            const Float4 tY = SubF(originY, LoadF(packet.mP0Y));
+            const Float4 tZ = SubF(originZ, LoadF(packet.mP0Z));
+            const Float4 u = MulF(AddF(AddF(MulF(tX, pX), MulF(tY, pY)), MulF(tZ, pZ)), invDet);
+
+            const Float4 qX = SubF(MulF(tY, e1Z), MulF(tZ, e1Y));
+            const Float4 qY = SubF(MulF(tZ, e1X), MulF(tX, e1Z));
+            const Float4 qZ = SubF(MulF(tX, e1Y), MulF(tY, e1X));
+            const Float4 v = MulF(AddF(AddF(MulF(directionX, qX), MulF(directionY, qY)), MulF(directionZ, qZ)), invDet);
+            const Float4 t = MulF(AddF(AddF(MulF(e2X, qX), MulF(e2Y, qY)), MulF(e2Z, qZ)), invDet);
+
+            // Null determinants (parallel rays and unused lanes) fail the first test
+            Float4 valid = CmpGtF(AbsF(det), zero);
+            valid = AndF(valid, CmpGeF(u, zero));
+            valid = AndF(valid, CmpGeF(v, zero));
+            valid = AndF(valid, CmpLeF(AddF(u, v), one));
+            valid = AndF(valid, CmpGeF(t, zero));
+            valid = AndF(valid, CmpLtF(t, SetF(closestDistance)));
+            const int validMask = MaskF(valid);
+            if (validMask != 0)
+            {
+                float laneT[WIDTH], laneU[WIDTH], laneV[WIDTH];
+                StoreF(laneT, t);
+                StoreF(laneU, u);
+                StoreF(laneV, v);
+                for (unsigned int lane = 0; lane < WIDTH; ++lane)
+                {
+                    if ((validMask & (1 << lane)) && (laneT[lane] < closestDistance))
+                    {
+                        closestDistance = laneT[lane];
+                        hit.mDistance = laneT[lane];
+                        hit.mTriangle = packet.mTriangles[lane];
+                        hit.mU = laneU[lane];
+                        hit.mV = laneV[lane];
+                        found = true;
+                    }
+                }
+            }
+            continue;
+        }
+
+        // Slab test of the 4 children
+        const Node & node = mNodes[entry];
+        const Float4 t0X = MulF(SubF(LoadF(node.mMinX), originX), invDirectionX);
+        const Float4 t1X = MulF(SubF(LoadF(node.mMaxX), originX), invDirectionX);
+        const Float4 t0Y = MulF(SubF(LoadF(node.mMinY), originY), invDirectionY);
+        const Float4 t1Y = MulF(SubF(LoadF(node.mMaxY), originY), invDirectionY);
+        const Float4 t0Z = MulF(SubF(LoadF(node.mMinZ), originZ), invDirectionZ);
+        const Float4 t1Z = MulF(SubF(LoadF(node.mMaxZ), originZ), invDirectionZ);
+        const Float4 tNear = MaxF(MaxF(MinF(t0X, t1X), MinF(t0Y, t1Y)), MaxF(MinF(t0Z, t1Z), zero));
+        const Float4 tFar = MinF(MinF(MaxF(t0X, t1X), MaxF(t0Y, t1Y)), MinF(MaxF(t0Z, t1Z), SetF(closestDistance)));
+        const int hitMask = MaskF(CmpLeF(tNear, tFar));
+        if (hitMask == 0)
+        {
+            continue;
+        }
+
+        // Push the hit children, the farthest first so the closest is visited first
+        float childDistances[WIDTH];
+        StoreF(childDistances, tNear);
+        unsigned int hitChildren[WIDTH];
+        float hitDistances[WIDTH];
+        unsigned int numHitChildren = 0;
+        for (unsigned int slot = 0; slot < WIDTH; ++slot)
+        {
+            if ((hitMask & (1 << slot)) && (node.mChildren[slot] != EMPTY_CHILD))
+            {
+                unsigned int position = numHitChildren++;
+                while ((position > 0) && (hitDistances[position - 1] < childDistances[slot]))
+                {
+                    hitChildren[position] = hitChildren[position - 1];
+                    hitDistances[position] = hitDistances[position - 1];
+                    --position;
+                }
+                hitChildren[position] = node.mChildren[slot];
+                hitDistances[position] = childDistances[slot];
+            }
+        }
+        PG_ASSERTSTR(stackSize + numHitChildren <= BVH_STACK_SIZE, "The mesh BVH is too deep for the traversal stack");
+        for (unsigned int c = 0; c < numHitChildren; ++c)
+        {
+            stack[stackSize] = hitChildren[c];
+            stackDistances[stackSize] = hitDistances[c];
+            ++stackSize;
+        }
+    }
+
+    return found;
+}
+
+
+}   // namespace Mesh
+}   // namespace Pegasus
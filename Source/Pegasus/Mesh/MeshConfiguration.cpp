@@ -11,6 +11,7 @@
 //!         between nodes to link them
 
 #include "Pegasus/Mesh/MeshConfiguration.h"
+#include "Pegasus/Graph/NodeDataInterner.h"
 #include "Pegasus/Utils/Memcpy.h"
 
 namespace Pegasus {
@@ -22,7 +23,8 @@ MeshConfiguration::MeshConfiguration()
 mIsIndexed(true),
 mIsDynamic(false),
 mIsDrawIndirect(false),
-mPrimitiveType(TRIANGLE)
+mPrimitiveType(TRIANGLE),
+mOptimizeVertexCache(false)
 {
 }
 
@@ -53,5 +55,31 @@ MeshConfiguration & MeshConfiguration::operator=(const MeshConfiguration & other
 }
 
 
+//----------------------------------------------------------------------------------------
+
+void MeshConfiguration::WriteDataKey(Graph::NodeDataKey & key) const
+{
+    // Written field by field, the configuration contains padding
+    key.WriteValue(mIsIndexed);
+    key.WriteValue(mIsDynamic);
+    key.WriteValue(mIsDrawIndirect);
+    key.WriteValue(static_cast<int>(mPrimitiveType));
+    key.WriteValue(mOptimizeVertexCache);
+
+    const int attributeCount = mInputLayout.GetAttributeCount();
+    key.WriteValue(attributeCount);
+    for (int a = 0; a < attributeCount; ++a)
+    {
+        const MeshInputLayout::AttrDesc & attr = mInputLayout.GetAttributeDesc(a);
+        key.WriteValue(static_cast<int>(attr.mSemantic));
+        key.WriteValue(static_cast<int>(attr.mType));
+        key.WriteValue(attr.mByteSize);
+        key.WriteValue(attr.mByteOffset);
+        key.WriteValue(static_cast<int>(attr.mSemanticIndex));
+        key.WriteValue(static_cast<int>(attr.mStreamIndex));
+    }
+}
+
+
 }   // namespace Mesh
 }   // namespace Pegasus
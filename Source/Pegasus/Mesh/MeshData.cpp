@@ -10,19 +10,32 @@
 //! \brief	Mesh node data, used by all mesh nodes, including generators and operators
 
 #include "Pegasus/Mesh/MeshData.h"
+#include "Pegasus/Mesh/MeshOptimizer.h"
+#include "Pegasus/Mesh/MeshBvh.h"
 #include "Pegasus/Utils/Memcpy.h"
 
 namespace Pegasus {
 namespace Mesh {
 
+//! Radius of the bounding sphere of the meshes with a single position or no position,
+//! the bounding spheres not supporting a null radius
+static const float MESH_MIN_BOUNDING_RADIUS = 1.0e-6f;
 
 MeshData::MeshData(const MeshConfiguration & configuration, Graph::Node::Mode mode, Alloc::IAllocator* allocator)
 :   Graph::NodeData(allocator),
     mConfiguration(configuration),
     mIndexCount(0),
     mVertexCount(0),
+    mLodCount(1),
+    mPositionOffset(0.0f, 0.0f, 0.0f),
+    mPositionScale(1.0f, 1.0f, 1.0f),
+    mBoundingSphere(Math::Point3(0.0f, 0.0f, 0.0f), MESH_MIN_BOUNDING_RADIUS),
+    mBvh(nullptr),
     mMode(mode)
 {
+    mLods[0].mFirstIndex = 0;
+    mLods[0].mIndexCount = 0;
+    mLods[0].mError = 0.0f;
     
     //fill in stream strides
     const MeshInputLayout& inputLayout = configuration.GetInputLayout();
@@ -76,6 +89,34 @@ void MeshData::AllocateVertexes(int count)
 void MeshData::AllocateIndexes(int count)
 {
     InternalAllocateIndexes(count, false);
+    mLodCount = 1;
+}
+
+void MeshData::SetLods(const int * indexCounts, const float * errors, int lodCount)
+{
+    PG_ASSERTSTR(lodCount >= 1 && lodCount <= MESH_MAX_LODS, "Invalid count of levels of detail (%d)", lodCount);
+    int firstIndex = 0;
+    for (int lod = 0; lod < lodCount; ++lod)
+    {
+        mLods[lod].mFirstIndex = firstIndex;
+        mLods[lod].mIndexCount = indexCounts[lod];
+        mLods[lod].mError = errors[lod];
+        firstIndex += indexCounts[lod];
+    }
+    PG_ASSERTSTR(firstIndex <= mIndexCount, "The levels of detail use more indices than the index buffer");
+    mLods[0].mError = 0.0f;
+    mLodCount = lodCount;
+}
+
+int MeshData::SelectLod(float distance, float projectionScale, float maxPixelError) const
+{
+    // The error projected on screen is error * projectionScale / distance
+    int lod = 0;
+    while (lod + 1 < mLodCount && mLods[lod + 1].mError * projectionScale <= maxPixelError * distance)
+    {
+        ++lod;
+    }
+    return lod;
 }
 
 void MeshData::InternalAllocateVertexes(int count, bool preserveElements)
@@ -120,6 +161,200 @@ void MeshData::Clear()
     
     mVertexCount = 0;
     mIndexCount = 0;
+    mLodCount = 1;
+    mPositionOffset = Math::Vec3(0.0f, 0.0f, 0.0f);
+    mPositionScale = Math::Vec3(1.0f, 1.0f, 1.0f);
+    mBoundingBox.SetZero();
+    mBoundingSphere.SetCenter(Math::Point3(0.0f, 0.0f, 0.0f));
+    mBoundingSphere.SetRadius(MESH_MIN_BOUNDING_RADIUS);
+    DestroyBvh();
+}
+
+bool MeshData::FindPositionAttribute(int& streamIndex, int& byteOffset, Core::Format& format) const
+{
+    const MeshInputLayout& inputLayout = mConfiguration.GetInputLayout();
+    for (int i = 0; i < inputLayout.GetAttributeCount(); ++i)
+    {
+        const MeshInputLayout::AttrDesc& desc = inputLayout.GetAttributeDesc(i);
+        if (desc.mSemantic == MeshInputLayout::POSITION && desc.mSemanticIndex == 0)
+        {
+            streamIndex = desc.mStreamIndex;
+            byteOffset = desc.mByteOffset;
+            format = desc.mType;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool MeshData::ExtractPositions(Math::Vec3 * positions)
+{
+    int streamIndex = 0;
+    int byteOffset = 0;
+    Core::Format format = Core::FORMAT_RGBA_32_FLOAT;
+    if (mMode != Graph::Node::STANDARD || !FindPositionAttribute(streamIndex, byteOffset, format))
+    {
+        return false;
+    }
+
+    const char * vertex = static_cast<const char *>(mVertexStreams[streamIndex].GetBuffer()) + byteOffset;
+    const int stride = mVertexStreams[streamIndex].GetStride();
+    switch (format)
+    {
+    case Core::FORMAT_RGBA_32_FLOAT:
+    case Core::FORMAT_RGB_32_FLOAT:
+        for (int v = 0; v < mVertexCount; ++v, vertex += stride)
+        {
+            const float * position = reinterpret_cast<const float *>(vertex);
+            positions[v] = Math::Vec3(position[0], position[1], position[2]);
+        }
+        return true;
+
+    case Core::FORMAT_RGBA_16_UNORM:
+        // quantized positions, decoded as the shaders do
+        for (int v = 0; v < mVertexCount; ++v, vertex += stride)
+        {
+            const unsigned short * position = reinterpret_cast<const unsigned short *>(vertex);
+            for (int c = 0; c < 3; ++c)
+            {
+                positions[v].v[c] = mPositionOffset.v[c] + (static_cast<float>(position[c]) / 65535.0f) * mPositionScale.v[c];
+            }
+        }
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+void MeshData::ComputeBounds()
+{
+    mBoundingBox.SetZero();
+    mBoundingSphere.SetCenter(Math::Point3(0.0f, 0.0f, 0.0f));
+    mBoundingSphere.SetRadius(MESH_MIN_BOUNDING_RADIUS);
+    if (mVertexCount == 0)
+    {
+        return;
+    }
+
+    Math::Vec3 * positions = PG_NEW_ARRAY(GetAllocator(), -1, "MeshData::Positions", Alloc::PG_MEM_TEMP, Math::Vec3, mVertexCount);
+    if (ExtractPositions(positions))
+    {
+        Math::Point3 boxMin = positions[0];
+        Math::Point3 boxMax = positions[0];
+        for (int v = 1; v < mVertexCount; ++v)
+        {
+            for (int c = 0; c < 3; ++c)
+            {
+                boxMin.v[c] = Math::Min(boxMin.v[c], positions[v].v[c]);
+                boxMax.v[c] = Math::Max(boxMax.v[c], positions[v].v[c]);
+            }
+        }
+        mBoundingBox.SetMinMax(boxMin, boxMax);
+
+        // the sphere around the box center is tighter than the sphere around the box
+        const Math::Point3 center = (boxMin + boxMax) * 0.5f;
+        float squaredRadius = 0.0f;
+        for (int v = 0; v < mVertexCount; ++v)
+        {
+            const Math::Vec3 offset = positions[v] - center;
+            squaredRadius = Math::Max(squaredRadius, Math::Dot(offset, offset));
+        }
+        mBoundingSphere.SetCenter(center);
+        mBoundingSphere.SetRadius(Math::Max(Math::Sqrt(squaredRadius), MESH_MIN_BOUNDING_RADIUS));
+    }
+    PG_DELETE_ARRAY(GetAllocator(), positions);
+}
+
+const MeshBvh * MeshData::GetBvh()
+{
+    if (mBvh != nullptr)
+    {
+        return mBvh;
+    }
+    if (mMode != Graph::Node::STANDARD || !IsCPUDataResident()
+        || mConfiguration.GetMeshPrimitiveType() != MeshConfiguration::TRIANGLE || mVertexCount == 0)
+    {
+        return nullptr;
+    }
+
+    Math::Vec3 * positions = PG_NEW_ARRAY(GetAllocator(), -1, "MeshData::Positions", Alloc::PG_MEM_TEMP, Math::Vec3, mVertexCount);
+    if (ExtractPositions(positions))
+    {
+        mBvh = PG_NEW(GetAllocator(), -1, "MeshData::MeshBvh", Alloc::PG_MEM_PERM) MeshBvh(GetAllocator());
+        if (mConfiguration.GetIsIndexed())
+        {
+            mBvh->Build(positions, mVertexCount, GetIndexBuffer() + GetLodFirstIndex(0), GetLodIndexCount(0) / 3);
+        }
+        else
+        {
+            mBvh->Build(positions, mVertexCount, nullptr, mVertexCount / 3);
+        }
+    }
+    PG_DELETE_ARRAY(GetAllocator(), positions);
+    return mBvh;
+}
+
+void MeshData::DestroyBvh()
+{
+    if (mBvh != nullptr)
+    {
+        PG_DELETE(GetAllocator(), mBvh);
+        mBvh = nullptr;
+    }
+}
+
+unsigned int MeshData::ReleaseCPUBuffers()
+{
+    if (mMode != Graph::Node::STANDARD)
+    {
+        return 0;
+    }
+
+    const unsigned int releasedBytes = GetMemorySize();
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    { 
+        if (mVertexStreams[s].GetBuffer() != nullptr)
+        {
+            mVertexStreams[s].Destroy(GetAllocator());
+        }
+    }
+    if (mIndexBuffer.GetBuffer() != nullptr)
+    {
+        mIndexBuffer.Destroy(GetAllocator());
+    }
+    return releasedBytes;
+}
+
+void MeshData::AllocateCPUBuffers()
+{
+    InternalAllocateVertexes(mVertexCount, false);
+    InternalAllocateIndexes(mIndexCount, false);
+}
+
+void MeshData::CompleteGeneration()
+{
+    if (mConfiguration.GetOptimizeVertexCache())
+    {
+        OptimizeMesh(this, VERTEX_CACHE_SIZE, true, GetAllocator());
+    }
+
+    // the hierarchy of the previous generation is rebuilt on demand
+    DestroyBvh();
+    if (mMode == Graph::Node::STANDARD)
+    {
+        ComputeBounds();
+    }
+}
+
+unsigned int MeshData::GetMemorySize() const
+{
+    unsigned int size = static_cast<unsigned int>(mIndexBuffer.GetByteSize());
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        size += static_cast<unsigned int>(mVertexStreams[s].GetByteSize());
+    }
+    return size;
 }
 
 MeshData::~MeshData()
@@ -10,6 +10,7 @@
 //! \brief	Base mesh generator node class
 
 #include "Pegasus/Mesh/MeshGenerator.h"
+#include "Pegasus/Graph/NodeDataInterner.h"
 #include "Pegasus/Mesh/IMeshFactory.h"
 
 namespace Pegasus {
@@ -77,7 +78,8 @@ MeshGenerator::~MeshGenerator()
 
 void MeshGenerator::ReleaseGPUData()
 {
-    if (GetData() != nullptr)
+    // Shared data keeps its GPU data for the other users, the data interner releases it
+    if (GetData() != nullptr && !GetData()->IsInterned())
     {
         GetFactory()->DestroyNodeGPUData((MeshData*)&(*GetData()));
     }
@@ -101,6 +103,19 @@ Graph::NodeData * MeshGenerator::AllocateData() const
                     MeshData(mConfiguration, GetMode(), GetNodeDataAllocator());
 }
 
+//----------------------------------------------------------------------------------------
+
+bool MeshGenerator::WriteDataKey(Graph::NodeDataKey & key) const
+{
+    if (GetMode() == Graph::Node::COMPUTE)
+    {
+        // The content lives on the GPU and is not described by the node
+        return false;
+    }
+    mConfiguration.WriteDataKey(key);
+    return true;
+}
+
 
 }   // namespace Mesh
 }   // namespace Pegasus
@@ -57,13 +57,14 @@ void MeshInputLayout::GenerateEditorLayout(MeshInputLayout::LayoutUsageBitMask m
 {
     mAttributeCount = 0; // delete all previous attributes, if any
     int offset = 0;
+    const bool compact = (mask & MeshInputLayout::USE_COMPACT) != 0;
 
     if (mask & MeshInputLayout::USE_POSITION)
     {
         AttrDesc attrPos = { 
             MeshInputLayout::POSITION,
-            Pegasus::Core::FORMAT_RGBA_32_FLOAT, // 32 bit precision
-            16,
+            compact ? Pegasus::Core::FORMAT_RGBA_16_UNORM : Pegasus::Core::FORMAT_RGBA_32_FLOAT, // 16 bit quantized or 32 bit precision
+            compact ? 8 : 16,
             offset, // byte offset
             0, // semantic index            
             0 // use the first stream
@@ -77,8 +78,8 @@ void MeshInputLayout::GenerateEditorLayout(MeshInputLayout::LayoutUsageBitMask m
     {
         AttrDesc attrNorm = {
             MeshInputLayout::NORMAL,
-            Pegasus::Core::FORMAT_RGB_32_FLOAT, // 16 bit precision
-            12,
+            compact ? Pegasus::Core::FORMAT_RG16_SNORM : Pegasus::Core::FORMAT_RGB_32_FLOAT, // 16 bit octahedral or 32 bit precision
+            compact ? 4 : 12,
             offset, // byte offset
             0, // semantic index
             0 // use the first stream
@@ -92,8 +93,8 @@ void MeshInputLayout::GenerateEditorLayout(MeshInputLayout::LayoutUsageBitMask m
     {
         AttrDesc attrUV = {
             MeshInputLayout::UV,
-            Pegasus::Core::FORMAT_RG_32_FLOAT, // 32 bit precision
-            8,
+            compact ? Pegasus::Core::FORMAT_RG16_FLOAT : Pegasus::Core::FORMAT_RG_32_FLOAT, // 16 or 32 bit precision
+            compact ? 4 : 8,
             offset, // byte offset
             0, // semantic index
             0  // use the first stream
@@ -105,6 +106,20 @@ void MeshInputLayout::GenerateEditorLayout(MeshInputLayout::LayoutUsageBitMask m
 
 //----------------------------------------------------------------------------------------
 
+bool MeshInputLayout::IsCompact() const
+{
+    for (int i = 0; i < mAttributeCount; ++i)
+    {
+        if (mAttributeDescs[i].mSemantic == MeshInputLayout::POSITION && mAttributeDescs[i].mType == Pegasus::Core::FORMAT_RGBA_16_UNORM)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------------------
+
 void MeshInputLayout::RegisterAttribute(AttrDesc& attribute)
 {
     PG_ASSERTSTR(mAttributeCount < MESH_MAX_ATTRIBUTES, "Attribute max capd! make sure you increase the count");
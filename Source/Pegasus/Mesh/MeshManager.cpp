@@ -14,6 +14,10 @@
 #include "Pegasus/Mesh/Operator/CombineTransformOperator.h"
 #include "Pegasus/Mesh/Operator/MultiCopyOperator.h"
 #include "Pegasus/Mesh/Operator/WaveFieldOperator.h"
+#include "Pegasus/Mesh/Operator/VertexCacheOperator.h"
+#include "Pegasus/Mesh/Operator/SimplifyOperator.h"
+#include "Pegasus/Mesh/Operator/WeldOperator.h"
+#include "Pegasus/Mesh/Operator/QuantizeOperator.h"
 #include "Pegasus/Mesh/Generator/QuadGenerator.h"
 #include "Pegasus/Mesh/Generator/BoxGenerator.h"
 #include "Pegasus/Mesh/Generator/IcosphereGenerator.h"
@@ -21,6 +25,8 @@
 #include "Pegasus/Mesh/Generator/CylinderGenerator.h"
 #include "Pegasus/Mesh/IMeshFactory.h"
 #include "Pegasus/Graph/NodeManager.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Memory/PoolAllocator.h"
 #include "Pegasus/Utils/String.h"
 
 namespace Pegasus {
@@ -73,6 +79,8 @@ void RegisterInNameSet(const char* name, Utils::Vector<unsigned int>& nameSet)
     
 MeshManager::MeshManager(Graph::NodeManager * nodeManager, IMeshFactory * factory)
 :   mNodeManager(nodeManager), mFactory(factory)
+    ,mDataInterner(Memory::GetNodeAllocator(), ReleaseInternedData, this)
+    ,mTransientNodeData(false)
 #if PEGASUS_ENABLE_PROXIES
     ,mProxy(this)
 #endif
@@ -82,6 +90,10 @@ MeshManager::MeshManager(Graph::NodeManager * nodeManager, IMeshFactory * factor
 #endif
 {
     PG_ASSERT(factory);
+
+    // Sharing the mesh data is opt-in
+    mDataInterner.SetEnabled(false);
+
     if (nodeManager != nullptr)
     {
         RegisterAllMeshNodes();
@@ -130,6 +142,8 @@ MeshReturn MeshManager::CreateMeshNode()
     {
         MeshRef mesh = mNodeManager->CreateNode("Mesh");
         mesh->SetFactory(mFactory);
+        mesh->SetDataInterner(&mDataInterner);
+        mesh->SetDataResidency(&mDataResidency);
         return mesh;
     }
     else
@@ -160,6 +174,11 @@ MeshGeneratorReturn MeshManager::CreateMeshGeneratorNode(const char * className)
         meshGenerator->SetEventListener(mEventListener);
 #endif
         meshGenerator->SetFactory(mFactory);
+        meshGenerator->SetDataInterner(&mDataInterner);
+        if (mTransientNodeData)
+        {
+            meshGenerator->SetTransientDataAllocator(Memory::GetTransientNodeDataAllocator());
+        }
         return meshGenerator;
     }
     else
@@ -190,6 +209,11 @@ MeshOperatorReturn MeshManager::CreateMeshOperatorNode(const char * className)
         meshOperator->SetEventListener(mEventListener);
 #endif
         meshOperator->SetFactory(mFactory);
+        meshOperator->SetDataInterner(&mDataInterner);
+        if (mTransientNodeData)
+        {
+            meshOperator->SetTransientDataAllocator(Memory::GetTransientNodeDataAllocator());
+        }
         return meshOperator;
     }
     else
@@ -201,6 +225,14 @@ MeshOperatorReturn MeshManager::CreateMeshOperatorNode(const char * className)
 
 //----------------------------------------------------------------------------------------
 
+void MeshManager::ReleaseInternedData(Graph::NodeData * data, void * userData)
+{
+    MeshManager * meshManager = static_cast<MeshManager *>(userData);
+    meshManager->mFactory->DestroyNodeGPUData(static_cast<MeshData *>(data));
+}
+
+//----------------------------------------------------------------------------------------
+
 
 void MeshManager::RegisterAllMeshNodes()
 {
@@ -213,6 +245,10 @@ void MeshManager::RegisterAllMeshNodes()
     REGISTER_MESH_NODE_OPERATOR(CombineTransformOperator);
     REGISTER_MESH_NODE_OPERATOR(MultiCopyOperator);
     REGISTER_MESH_NODE_OPERATOR(WaveFieldOperator);
+    REGISTER_MESH_NODE_OPERATOR(VertexCacheOperator);
+    REGISTER_MESH_NODE_OPERATOR(SimplifyOperator);
+    REGISTER_MESH_NODE_OPERATOR(WeldOperator);
+    REGISTER_MESH_NODE_OPERATOR(QuantizeOperator);
 
     // Register the generator nodes
     REGISTER_MESH_NODE_GENERATOR(QuadGenerator);
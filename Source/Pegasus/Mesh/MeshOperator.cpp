@@ -10,6 +10,7 @@
 //! \brief	Base mesh operator node class
 
 #include "Pegasus/Mesh/MeshOperator.h"
+#include "Pegasus/Graph/NodeDataInterner.h"
 #include "Pegasus/Mesh/IMeshFactory.h"
 
 namespace Pegasus {
@@ -74,7 +75,8 @@ MeshOperator::~MeshOperator()
 
 void MeshOperator::ReleaseGPUData()
 {
-    if (GetData() != nullptr)
+    // Shared data keeps its GPU data for the other users, the data interner releases it
+    if (GetData() != nullptr && !GetData()->IsInterned())
     {
         GetFactory()->DestroyNodeGPUData((MeshData*)&(*GetData()));
     }
@@ -100,6 +102,19 @@ Graph::NodeData * MeshOperator::AllocateData() const
 
 //----------------------------------------------------------------------------------------
 
+bool MeshOperator::WriteDataKey(Graph::NodeDataKey & key) const
+{
+    if (GetMode() == Graph::Node::COMPUTE)
+    {
+        // The content lives on the GPU and is not described by the node
+        return false;
+    }
+    mConfiguration.WriteDataKey(key);
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
 void MeshOperator::AddGeneratorInput(MeshGeneratorIn meshGenerator)
 {
     if (meshGenerator->GetConfiguration() == GetConfiguration())
@@ -0,0 +1,559 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshOptimizer.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Reordering of the triangles and vertices of indexed meshes
+//!         for the post-transform vertex cache, overdraw and vertex fetch
+
+#include "Pegasus/Mesh/MeshOptimizer.h"
+#include "Pegasus/Mesh/MeshData.h"
+#include "Pegasus/Math/Vector.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Core/Profiler.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+
+namespace Internal {
+
+//! Value of a vertex remapping table for the vertices not remapped yet
+static const unsigned int INVALID_VERTEX = 0xFFFFFFFF;
+
+//! Sort key of a cluster of triangles
+struct ClusterKey
+{
+    float mKey;                 //!< Exposure of the cluster, the most exposed clusters are drawn first
+    unsigned int mCluster;      //!< Index of the cluster
+};
+
+//! Test if a cluster is drawn before another one
+inline bool IsClusterBefore(const ClusterKey & key1, const ClusterKey & key2)
+{
+    return (key1.mKey > key2.mKey) || ((key1.mKey == key2.mKey) && (key1.mCluster < key2.mCluster));
+}
+
+//! Move an element of a heap down to its place
+//! \param keys Heap, the first element to be drawn being at the bottom
+//! \param root Index of the element to move
+//! \param numKeys Number of elements of the heap
+static void SiftClusterKeyDown(ClusterKey * keys, unsigned int root, unsigned int numKeys)
+{
+    for (;;)
+    {
+        unsigned int child = 2 * root + 1;
+        if (child >= numKeys)
+        {
+            return;
+        }
+        if ((child + 1 < numKeys) && IsClusterBefore(keys[child], keys[child + 1]))
+        {
+            ++child;
+        }
+        if (!IsClusterBefore(keys[root], keys[child]))
+        {
+            return;
+        }
+        const ClusterKey swap = keys[root];
+        keys[root] = keys[child];
+        keys[child] = swap;
+        root = child;
+    }
+}
+
+//! Sort the cluster keys in drawing order (heap sort, no allocation)
+//! \param keys Keys to sort
+//! \param numKeys Number of keys
+static void SortClusterKeys(ClusterKey * keys, unsigned int numKeys)
+{
+    if (numKeys < 2)
+    {
+        return;
+    }
+    for (unsigned int root = numKeys / 2; root > 0; --root)
+    {
+        SiftClusterKeyDown(keys, root - 1, numKeys);
+    }
+    for (unsigned int last = numKeys - 1; last > 0; --last)
+    {
+        const ClusterKey swap = keys[0];
+        keys[0] = keys[last];
+        keys[last] = swap;
+        SiftClusterKeyDown(keys, 0, last);
+    }
+}
+
+//! Read the position of a vertex
+inline Math::Vec3 GetPosition(const void * positions, unsigned int positionStride, unsigned short vertex)
+{
+    const float * p = reinterpret_cast<const float *>(static_cast<const char *>(positions) + vertex * positionStride);
+    return Math::Vec3(p[0], p[1], p[2]);
+}
+
+//! Accumulate the area weighted centroid and normal of a triangle
+//! \param positions First position of the vertices, 3 floats
+//! \param positionStride Number of bytes between two positions
+//! \param triangle Indices of the triangle
+//! \param centroidSum Sum of the centroids weighted by the doubled areas (input/output)
+//! \param normalSum Sum of the normals weighted by the doubled areas (input/output)
+//! \param areaSum Sum of the doubled areas (input/output)
+static void AccumulateTriangle(const void * positions, unsigned int positionStride, const unsigned short * triangle,
+                               Math::Vec3 & centroidSum, Math::Vec3 & normalSum, float & areaSum)
+{
+    const Math::Vec3 p0 = GetPosition(positions, positionStride, triangle[0]);
+    const Math::Vec3 p1 = GetPosition(positions, positionStride, triangle[1]);
+    const Math::Vec3 p2 = GetPosition(positions, positionStride, triangle[2]);
+    Math::Vec3 normal;
+    Math::Cross(normal, p1 - p0, p2 - p0);
+    const float area = Math::Length(normal);
+    centroidSum += (p0 + p1 + p2) * (area / 3.0f);
+    normalSum += normal;
+    areaSum += area;
+}
+
+}   // namespace Internal
+
+//----------------------------------------------------------------------------------------
+
+bool FindMeshPositions(MeshData * meshData, const void *& positions, unsigned int & positionStride)
+{
+    const MeshInputLayout & inputLayout = meshData->GetConfiguration().GetInputLayout();
+    for (int a = 0; a < inputLayout.GetAttributeCount(); ++a)
+    {
+        const MeshInputLayout::AttrDesc & attr = inputLayout.GetAttributeDesc(a);
+        if ((attr.mSemantic == MeshInputLayout::POSITION) && (attr.mSemanticIndex == 0)
+            && ((attr.mType == Core::FORMAT_RGBA_32_FLOAT) || (attr.mType == Core::FORMAT_RGB_32_FLOAT)))
+        {
+            positions = static_cast<const char *>(meshData->GetStream<void>(attr.mStreamIndex)) + attr.mByteOffset;
+            positionStride = static_cast<unsigned int>(meshData->GetStreamStride(attr.mStreamIndex));
+            return true;
+        }
+    }
+    return false;
+}
+
+//----------------------------------------------------------------------------------------
+
+void ComputeVertexCacheStats(const unsigned short * indices,
+                             unsigned int numIndices,
+                             unsigned int numVertices,
+                             unsigned int cacheSize,
+                             Alloc::IAllocator * allocator,
+                             VertexCacheStats & stats)
+{
+    PG_ASSERT((indices != nullptr) || (numIndices == 0));
+    PG_ASSERTSTR(cacheSize >= 3, "Invalid vertex cache size (%u)", cacheSize);
+
+    stats.mACMR = 0.0f;
+    stats.mATVR = 0.0f;
+    if ((numIndices < 3) || (numVertices == 0))
+    {
+        return;
+    }
+
+    // A vertex is in the FIFO cache if it has been inserted during the last cacheSize misses.
+    // The counter starts above the cache size so the initial time stamps are all out of the cache
+    unsigned int * insertionTimes = PG_NEW_ARRAY(allocator, -1, "Vertex cache insertion times", Alloc::PG_MEM_TEMP, unsigned int, numVertices);
+    Utils::Memset8(insertionTimes, 0, numVertices * sizeof(unsigned int));
+    unsigned int time = cacheSize + 1;
+    unsigned int numReferencedVertices = 0;
+    for (unsigned int i = 0; i < numIndices; ++i)
+    {
+        const unsigned short vertex = indices[i];
+        PG_ASSERT(vertex < numVertices);
+        if (time - insertionTimes[vertex] > cacheSize)
+        {
+            if (insertionTimes[vertex] == 0)
+            {
+                ++numReferencedVertices;
+            }
+            insertionTimes[vertex] = time++;
+        }
+    }
+    PG_DELETE_ARRAY(allocator, insertionTimes);
+
+    const float numTransforms = static_cast<float>(time - (cacheSize + 1));
+    stats.mACMR = numTransforms / static_cast<float>(numIndices / 3);
+    stats.mATVR = numTransforms / static_cast<float>(numReferencedVertices);
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int OptimizeVertexCache(unsigned short * indices,
+                                 unsigned int numIndices,
+                                 unsigned int numVertices,
+                                 unsigned int cacheSize,
+                                 Alloc::IAllocator * allocator,
+                                 unsigned int * clusterStarts)
+{
+    PG_ASSERT((indices != nullptr) || (numIndices == 0));
+    PG_ASSERTSTR((numIndices % 3) == 0, "Invalid number of indices (%u) for a triangle list", numIndices);
+    PG_ASSERTSTR(cacheSize >= 3, "Invalid vertex cache size (%u)", cacheSize);
+
+    const unsigned int numTriangles = numIndices / 3;
+    if ((numTriangles == 0) || (numVertices == 0))
+    {
+        return 0;
+    }
+
+    // Triangles using each vertex (compressed adjacency lists)
+    unsigned int * adjacencyOffsets = PG_NEW_ARRAY(allocator, -1, "Tipsify adjacency offsets", Alloc::PG_MEM_TEMP, unsigned int, numVertices + 1);
+    unsigned int * adjacency = PG_NEW_ARRAY(allocator, -1, "Tipsify adjacency", Alloc::PG_MEM_TEMP, unsigned int, numIndices);
+    unsigned int * liveTriangles = PG_NEW_ARRAY(allocator, -1, "Tipsify live triangles", Alloc::PG_MEM_TEMP, unsigned int, numVertices);
+    unsigned int * cacheTimes = PG_NEW_ARRAY(allocator, -1, "Tipsify cache times", Alloc::PG_MEM_TEMP, unsigned int, numVertices);
+    unsigned short * deadEndStack = PG_NEW_ARRAY(allocator, -1, "Tipsify dead-end stack", Alloc::PG_MEM_TEMP, unsigned short, numIndices);
+    unsigned short * candidates = PG_NEW_ARRAY(allocator, -1, "Tipsify candidates", Alloc::PG_MEM_TEMP, unsigned short, numIndices);
+    unsigned short * srcIndices = PG_NEW_ARRAY(allocator, -1, "Tipsify source indices", Alloc::PG_MEM_TEMP, unsigned short, numIndices);
+    unsigned char * emitted = PG_NEW_ARRAY(allocator, -1, "Tipsify emitted triangles", Alloc::PG_MEM_TEMP, unsigned char, numTriangles);
+
+    Utils::Memcpy(srcIndices, indices, numIndices * sizeof(unsigned short));
+    Utils::Memset8(liveTriangles, 0, numVertices * sizeof(unsigned int));
+    Utils::Memset8(cacheTimes, 0, numVertices * sizeof(unsigned int));
+    Utils::Memset8(emitted, 0, numTriangles);
+
+    unsigned int i, v;
+    for (i = 0; i < numIndices; ++i)
+    {
+        PG_ASSERT(srcIndices[i] < numVertices);
+        ++liveTriangles[srcIndices[i]];
+    }
+    adjacencyOffsets[0] = 0;
+    for (v = 0; v < numVertices; ++v)
+    {
+        adjacencyOffsets[v + 1] = adjacencyOffsets[v] + liveTriangles[v];
+    }
+    for (i = 0; i < numIndices; ++i)
+    {
+        // Filled backwards from the end of each list, the offsets are restored below
+        adjacency[--adjacencyOffsets[srcIndices[i] + 1]] = i / 3;
+    }
+    for (v = 0; v < numVertices; ++v)
+    {
+        adjacencyOffsets[v + 1] = adjacencyOffsets[v] + liveTriangles[v];
+    }
+
+    // Time stamps start above the cache size so every vertex starts out of the cache
+    unsigned int time = cacheSize + 1;
+    unsigned int numDeadEnds = 0;
+    unsigned int numOutputIndices = 0;
+    unsigned int numClusters = 0;
+    unsigned int scanCursor = 0;
+    int fanningVertex = 0;
+    bool newCluster = true;
+
+    while (fanningVertex >= 0)
+    {
+        // Emit all the remaining triangles around the fanning vertex
+        unsigned int numCandidates = 0;
+        for (unsigned int a = adjacencyOffsets[fanningVertex]; a < adjacencyOffsets[fanningVertex + 1]; ++a)
+        {
+            const unsigned int triangle = adjacency[a];
+            if (emitted[triangle] != 0)
+            {
+                continue;
+            }
+            if (newCluster)
+            {
+                if (clusterStarts != nullptr)
+                {
+                    clusterStarts[numClusters] = numOutputIndices / 3;
+                }
+                ++numClusters;
+                newCluster = false;
+            }
+            for (unsigned int c = 0; c < 3; ++c)
+            {
+                const unsigned short vertex = srcIndices[triangle * 3 + c];
+                indices[numOutputIndices++] = vertex;
+                deadEndStack[numDeadEnds++] = vertex;
+                candidates[numCandidates++] = vertex;
+                --liveTriangles[vertex];
+                if (time - cacheTimes[vertex] > cacheSize)
+                {
+                    cacheTimes[vertex] = time++;
+                }
+            }
+            emitted[triangle] = 1;
+        }
+
+        // Next fanning vertex: the candidate staying in the cache the longest once its triangles are emitted
+        int nextVertex = -1;
+        unsigned int bestPriority = 0;
+        for (unsigned int c = 0; c < numCandidates; ++c)
+        {
+            const unsigned short vertex = candidates[c];
+            if (liveTriangles[vertex] > 0)
+            {
+                unsigned int priority = 0;
+                if (time - cacheTimes[vertex] + 2 * liveTriangles[vertex] <= cacheSize)
+                {
+                    priority = time - cacheTimes[vertex];
+                }
+                if ((nextVertex < 0) || (priority > bestPriority))
+                {
+                    bestPriority = priority;
+                    nextVertex = vertex;
+                }
+            }
+        }
+
+        // Dead end: restart from the most recently used vertex with triangles left,
+        // or from the next vertex in index order, starting a new cluster
+        if (nextVertex < 0)
+        {
+            while ((numDeadEnds > 0) && (nextVertex < 0))
+            {
+                const unsigned short vertex = deadEndStack[--numDeadEnds];
+                if (liveTriangles[vertex] > 0)
+                {
+                    nextVertex = vertex;
+                }
+            }
+            while ((scanCursor < numVertices) && (nextVertex < 0))
+            {
+                if (liveTriangles[scanCursor] > 0)
+                {
+                    nextVertex = static_cast<int>(scanCursor);
+                }
+                ++scanCursor;
+            }
+            newCluster = true;
+        }
+        fanningVertex = nextVertex;
+    }
+    PG_ASSERT(numOutputIndices == numIndices);
+
+    PG_DELETE_ARRAY(allocator, emitted);
+    PG_DELETE_ARRAY(allocator, srcIndices);
+    PG_DELETE_ARRAY(allocator, candidates);
+    PG_DELETE_ARRAY(allocator, deadEndStack);
+    PG_DELETE_ARRAY(allocator, cacheTimes);
+    PG_DELETE_ARRAY(allocator, liveTriangles);
+    PG_DELETE_ARRAY(allocator, adjacency);
+    PG_DELETE_ARRAY(allocator, adjacencyOffsets);
+
+    return numClusters;
+}
+
+//----------------------------------------------------------------------------------------
+
+void SortClustersForOverdraw(unsigned short * indices,
+                             unsigned int numIndices,
+                             const void * positions,
+                             unsigned int positionStride,
+                             const unsigned int * clusterStarts,
+                             unsigned int numClusters,
+                             Alloc::IAllocator * allocator)
+{
+    PG_ASSERT((indices != nullptr) && (positions != nullptr) && (clusterStarts != nullptr));
+    if (numClusters < 2)
+    {
+        return;
+    }
+
+    const unsigned int numTriangles = numIndices / 3;
+    Internal::ClusterKey * keys = PG_NEW_ARRAY(allocator, -1, "Overdraw cluster keys", Alloc::PG_MEM_TEMP, Internal::ClusterKey, numClusters);
+    Math::Vec3 * clusterCentroids = PG_NEW_ARRAY(allocator, -1, "Overdraw cluster centroids", Alloc::PG_MEM_TEMP, Math::Vec3, numClusters);
+    Math::Vec3 * clusterNormals = PG_NEW_ARRAY(allocator, -1, "Overdraw cluster normals", Alloc::PG_MEM_TEMP, Math::Vec3, numClusters);
+
+    // Area weighted centroid and normal of each cluster and of the whole mesh
+    Math::Vec3 meshCentroid(0.0f, 0.0f, 0.0f);
+    float meshArea = 0.0f;
+    unsigned int c;
+    for (c = 0; c < numClusters; ++c)
+    {
+        const unsigned int lastTriangle = (c + 1 < numClusters) ? clusterStarts[c + 1] : numTriangles;
+        Math::Vec3 centroidSum(0.0f, 0.0f, 0.0f);
+        Math::Vec3 normalSum(0.0f, 0.0f, 0.0f);
+        float areaSum = 0.0f;
+        for (unsigned int t = clusterStarts[c]; t < lastTriangle; ++t)
+        {
+            Internal::AccumulateTriangle(positions, positionStride, indices + t * 3, centroidSum, normalSum, areaSum);
+        }
+        meshCentroid += centroidSum;
+        meshArea += areaSum;
+        clusterCentroids[c] = (areaSum > 0.0f) ? (centroidSum / areaSum) : centroidSum;
+        clusterNormals[c] = normalSum;
+    }
+    if (meshArea > 0.0f)
+    {
+        meshCentroid /= meshArea;
+    }
+
+    // Clusters facing away from the center are likely to occlude the other ones, they are drawn first
+    for (c = 0; c < numClusters; ++c)
+    {
+        const float normalLength = Math::Length(clusterNormals[c]);
+        keys[c].mKey = (normalLength > 0.0f) ? (Math::Dot(clusterCentroids[c] - meshCentroid, clusterNormals[c]) / normalLength) : 0.0f;
+        keys[c].mCluster = c;
+    }
+    Internal::SortClusterKeys(keys, numClusters);
+
+    unsigned short * srcIndices = PG_NEW_ARRAY(allocator, -1, "Overdraw source indices", Alloc::PG_MEM_TEMP, unsigned short, numIndices);
+    Utils::Memcpy(srcIndices, indices, numIndices * sizeof(unsigned short));
+    unsigned int numOutputIndices = 0;
+    for (c = 0; c < numClusters; ++c)
+    {
+        const unsigned int cluster = keys[c].mCluster;
+        const unsigned int firstIndex = clusterStarts[cluster] * 3;
+        const unsigned int lastIndex = ((cluster + 1 < numClusters) ? clusterStarts[cluster + 1] : numTriangles) * 3;
+        Utils::Memcpy(indices + numOutputIndices, srcIndices + firstIndex, (lastIndex - firstIndex) * sizeof(unsigned short));
+        numOutputIndices += lastIndex - firstIndex;
+    }
+    PG_ASSERT(numOutputIndices == numTriangles * 3);
+
+    PG_DELETE_ARRAY(allocator, srcIndices);
+    PG_DELETE_ARRAY(allocator, clusterNormals);
+    PG_DELETE_ARRAY(allocator, clusterCentroids);
+    PG_DELETE_ARRAY(allocator, keys);
+}
+
+//----------------------------------------------------------------------------------------
+
+void OptimizeVertexFetch(MeshData * meshData, Alloc::IAllocator * allocator)
+{
+    PG_ASSERT(meshData != nullptr);
+    PG_ASSERTSTR(meshData->GetMode() == Graph::Node::STANDARD, "Vertex fetch optimization only available in mesh STANDARD mode.");
+
+    const unsigned int numVertices = static_cast<unsigned int>(meshData->GetVertexCount());
+    const unsigned int numIndices = static_cast<unsigned int>(meshData->GetIndexCount());
+    if ((numVertices == 0) || (numIndices == 0))
+    {
+        return;
+    }
+
+    // New index of each vertex, in order of first use, the unused vertices at the end
+    unsigned int * remap = PG_NEW_ARRAY(allocator, -1, "Vertex fetch remapping", Alloc::PG_MEM_TEMP, unsigned int, numVertices);
+    Utils::Memset8(remap, static_cast<char>(0xFF), numVertices * sizeof(unsigned int));
+    unsigned short * indices = meshData->GetIndexBuffer();
+    unsigned int numRemappedVertices = 0;
+    unsigned int i, v;
+    for (i = 0; i < numIndices; ++i)
+    {
+        if (remap[indices[i]] == Internal::INVALID_VERTEX)
+        {
+            remap[indices[i]] = numRemappedVertices++;
+        }
+        indices[i] = static_cast<unsigned short>(remap[indices[i]]);
+    }
+    for (v = 0; v < numVertices; ++v)
+    {
+        if (remap[v] == Internal::INVALID_VERTEX)
+        {
+            remap[v] = numRemappedVertices++;
+        }
+    }
+
+    // Move the vertices of every stream
+    int maxStride = 0;
+    int stream;
+    for (stream = 0; stream < MESH_MAX_STREAMS; ++stream)
+    {
+        maxStride = Math::Max(maxStride, meshData->GetStreamStride(stream));
+    }
+    char * srcVertices = PG_NEW_ARRAY(allocator, -1, "Vertex fetch source vertices", Alloc::PG_MEM_TEMP, char, numVertices * maxStride);
+    for (stream = 0; stream < MESH_MAX_STREAMS; ++stream)
+    {
+        const unsigned int stride = static_cast<unsigned int>(meshData->GetStreamStride(stream));
+        char * vertices = static_cast<char *>(meshData->GetStream<void>(stream));
+        if ((stride > 0) && (vertices != nullptr))
+        {
+            Utils::Memcpy(srcVertices, vertices, numVertices * stride);
+            for (v = 0; v < numVertices; ++v)
+            {
+                Utils::Memcpy(vertices + remap[v] * stride, srcVertices + v * stride, stride);
+            }
+        }
+    }
+
+    PG_DELETE_ARRAY(allocator, srcVertices);
+    PG_DELETE_ARRAY(allocator, remap);
+}
+
+//----------------------------------------------------------------------------------------
+
+void OptimizeMesh(MeshData * meshData,
+                  unsigned int cacheSize,
+                  bool sortForOverdraw,
+                  Alloc::IAllocator * allocator)
+{
+    PG_ASSERT(meshData != nullptr);
+
+    const MeshConfiguration & configuration = meshData->GetConfiguration();
+    if (   (meshData->GetMode() != Graph::Node::STANDARD)
+        || !configuration.GetIsIndexed()
+        || (configuration.GetMeshPrimitiveType() != MeshConfiguration::TRIANGLE))
+    {
+        return;
+    }
+    const unsigned int numVertices = static_cast<unsigned int>(meshData->GetVertexCount());
+    const unsigned int numIndices = static_cast<unsigned int>(meshData->GetIndexCount());
+    if ((numIndices < 3) || (numVertices == 0))
+    {
+        return;
+    }
+    PG_ASSERTSTR((numIndices % 3) == 0, "Invalid number of indices (%u) for a triangle list", numIndices);
+
+    PG_PROFILE_SCOPE("OptimizeMesh");
+
+    unsigned short * indices = meshData->GetIndexBuffer();
+    const int numLods = meshData->GetLodCount();
+
+    const void * positions = nullptr;
+    unsigned int positionStride = 0;
+    if (sortForOverdraw && !FindMeshPositions(meshData, positions, positionStride))
+    {
+        sortForOverdraw = false;
+    }
+
+    // Each level of detail is a separate triangle list of the index buffer, they share the vertices
+    unsigned int * clusterStarts = nullptr;
+    if (sortForOverdraw)
+    {
+        clusterStarts = PG_NEW_ARRAY(allocator, -1, "Mesh optimizer cluster starts", Alloc::PG_MEM_TEMP, unsigned int, numIndices / 3);
+    }
+    unsigned int numClusters = 0;
+    VertexCacheStats statsBefore[MESH_MAX_LODS];
+    int lod;
+    for (lod = 0; lod < numLods; ++lod)
+    {
+        unsigned short * lodIndices = indices + meshData->GetLodFirstIndex(lod);
+        const unsigned int numLodIndices = static_cast<unsigned int>(meshData->GetLodIndexCount(lod));
+        ComputeVertexCacheStats(lodIndices, numLodIndices, numVertices, cacheSize, allocator, statsBefore[lod]);
+        const unsigned int numLodClusters = OptimizeVertexCache(lodIndices, numLodIndices, numVertices, cacheSize, allocator, clusterStarts);
+        if (sortForOverdraw)
+        {
+            SortClustersForOverdraw(lodIndices, numLodIndices, positions, positionStride, clusterStarts, numLodClusters, allocator);
+        }
+        numClusters += numLodClusters;
+    }
+    if (sortForOverdraw)
+    {
+        PG_DELETE_ARRAY(allocator, clusterStarts);
+    }
+
+    OptimizeVertexFetch(meshData, allocator);
+
+    // The levels are drawn separately, so their efficiency is measured separately,
+    // the cache being empty at the start of each level
+    PG_LOG('MESH', "Mesh optimized for a %u entry vertex cache (%u triangles, %d levels of detail, %u clusters)",
+           cacheSize, numIndices / 3, numLods, numClusters);
+    for (lod = 0; lod < numLods; ++lod)
+    {
+        const unsigned int numLodIndices = static_cast<unsigned int>(meshData->GetLodIndexCount(lod));
+        VertexCacheStats statsAfter;
+        ComputeVertexCacheStats(indices + meshData->GetLodFirstIndex(lod), numLodIndices, numVertices, cacheSize, allocator, statsAfter);
+        PG_LOG('MESH', "  LOD %d (%u triangles): ACMR %.3f -> %.3f, ATVR %.3f -> %.3f",
+               lod, numLodIndices / 3, statsBefore[lod].mACMR, statsAfter.mACMR, statsBefore[lod].mATVR, statsAfter.mATVR);
+    }
+}
+
+
+}   // namespace Mesh
+}   // namespace Pegasus
@@ -0,0 +1,129 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshQuantizer.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Conversion of the editor vertices to the compact vertex layout
+//!         (quantized positions, octahedral normals and half precision UVs)
+
+#include "Pegasus/Mesh/MeshQuantizer.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+
+namespace Internal {
+
+//! Get the sign of a number, 1 for 0
+inline float SignNotZero(float value)
+{
+    return (value >= 0.0f) ? 1.0f : -1.0f;
+}
+
+}   // namespace Internal
+
+//----------------------------------------------------------------------------------------
+
+void EncodeOctahedralNormal(const Math::Vec3 & normal, short encoded[2])
+{
+    const float l1Norm = Math::Abs(normal.v[0]) + Math::Abs(normal.v[1]) + Math::Abs(normal.v[2]);
+    float u = 0.0f;
+    float v = 0.0f;
+    if (l1Norm > 0.0f)
+    {
+        u = normal.v[0] / l1Norm;
+        v = normal.v[1] / l1Norm;
+        if (normal.v[2] < 0.0f)
+        {
+            // Fold the lower half of the octahedron over the upper half
+            const float foldedU = (1.0f - Math::Abs(v)) * Internal::SignNotZero(u);
+            const float foldedV = (1.0f - Math::Abs(u)) * Internal::SignNotZero(v);
+            u = foldedU;
+            v = foldedV;
+        }
+    }
+    encoded[0] = QuantizeSnorm16(u);
+    encoded[1] = QuantizeSnorm16(v);
+}
+
+//----------------------------------------------------------------------------------------
+
+Math::Vec3 DecodeOctahedralNormal(const short encoded[2])
+{
+    float u = Math::Max(static_cast<float>(encoded[0]) / 32767.0f, -1.0f);
+    float v = Math::Max(static_cast<float>(encoded[1]) / 32767.0f, -1.0f);
+    const float z = 1.0f - Math::Abs(u) - Math::Abs(v);
+    if (z < 0.0f)
+    {
+        const float unfoldedU = (1.0f - Math::Abs(v)) * Internal::SignNotZero(u);
+        const float unfoldedV = (1.0f - Math::Abs(u)) * Internal::SignNotZero(v);
+        u = unfoldedU;
+        v = unfoldedV;
+    }
+    Math::Vec3 normal(u, v, z);
+    Math::Normalize(normal);
+    return normal;
+}
+
+//----------------------------------------------------------------------------------------
+
+void ComputePositionDecode(const StdVertex * vertices, unsigned int numVertices, Math::Vec3 & offset, Math::Vec3 & scale)
+{
+    if (numVertices == 0)
+    {
+        offset = Math::Vec3(0.0f, 0.0f, 0.0f);
+        scale = Math::Vec3(1.0f, 1.0f, 1.0f);
+        return;
+    }
+
+    Math::Vec3 minPosition(vertices[0].position.v[0], vertices[0].position.v[1], vertices[0].position.v[2]);
+    Math::Vec3 maxPosition = minPosition;
+    for (unsigned int v = 1; v < numVertices; ++v)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            minPosition.v[c] = Math::Min(minPosition.v[c], vertices[v].position.v[c]);
+            maxPosition.v[c] = Math::Max(maxPosition.v[c], vertices[v].position.v[c]);
+        }
+    }
+
+    offset = minPosition;
+    for (int c = 0; c < 3; ++c)
+    {
+        // A flat axis keeps a unit scale, every position quantizing to 0
+        const float extent = maxPosition.v[c] - minPosition.v[c];
+        scale.v[c] = (extent > 0.0f) ? extent : 1.0f;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void QuantizeVertices(const StdVertex * vertices,
+                      unsigned int numVertices,
+                      const Math::Vec3 & offset,
+                      const Math::Vec3 & scale,
+                      StdCompactVertex * compactVertices)
+{
+    const Math::Vec3 invScale(1.0f / scale.v[0], 1.0f / scale.v[1], 1.0f / scale.v[2]);
+    for (unsigned int v = 0; v < numVertices; ++v)
+    {
+        const StdVertex & vertex = vertices[v];
+        StdCompactVertex & compactVertex = compactVertices[v];
+        for (int c = 0; c < 3; ++c)
+        {
+            compactVertex.position[c] = QuantizeUnorm16((vertex.position.v[c] - offset.v[c]) * invScale.v[c]);
+        }
+        compactVertex.position[3] = QuantizeUnorm16(1.0f);
+        EncodeOctahedralNormal(vertex.normal, compactVertex.normal);
+        compactVertex.uv[0] = Math::FloatToHalf(vertex.uv.v[0]);
+        compactVertex.uv[1] = Math::FloatToHalf(vertex.uv.v[1]);
+    }
+}
+
+
+}   // namespace Mesh
+}   // namespace Pegasus
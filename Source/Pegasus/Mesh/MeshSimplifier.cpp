@@ -0,0 +1,779 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshSimplifier.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Quadric error simplification of indexed meshes and chains of levels of detail
+
+#include "Pegasus/Mesh/MeshSimplifier.h"
+#include "Pegasus/Mesh/MeshOptimizer.h"
+#include "Pegasus/Mesh/MeshData.h"
+#include "Pegasus/Math/Vector.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Core/Profiler.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+
+namespace Internal {
+
+//! Value of the vertex tables for the empty entries
+static const unsigned int INVALID_VERTEX = 0xFFFFFFFF;
+
+//! Flag of the vertices of the open borders, never collapsed
+static const unsigned char VERTEX_LOCKED = 0x1;
+
+//! Flag of the vertices collapsed or receiving a collapse during the current pass
+static const unsigned char VERTEX_TOUCHED = 0x2;
+
+//! Maximum number of wedges of a collapsed position
+static const unsigned int MAX_COLLAPSED_WEDGES = 16;
+
+//! Number of buckets of the sort of the edge collapses, indexed by the upper 16 bits of their cost
+static const unsigned int COLLAPSE_SORT_BUCKETS = 65536;
+
+//! Tolerance on the cost of the collapses of a pass, relative to the cost of the collapse reaching its goal.
+//! Passes collapse many edges at once, so the tolerance trades a few expensive collapses for fewer passes
+static const float PASS_COST_TOLERANCE = 1.5f;
+
+//! Symmetric matrix of the sum of the squared distances to a set of planes, weighted by their area.
+//! The squared distance of a point p is p^T A p + 2 b^T p + c. The terms are large compared to
+//! the distances far from the origin, so they are kept in double precision
+struct Quadric
+{
+    double mA00, mA11, mA22;    //!< Diagonal of A
+    double mA01, mA02, mA12;    //!< Upper triangle of A
+    double mB0, mB1, mB2;       //!< Vector b
+    double mC;                  //!< Constant c
+    double mWeight;             //!< Total weight of the planes
+};
+
+//! Edge collapse moving a position onto another one
+struct Collapse
+{
+    unsigned int mSource;       //!< First vertex of the position removed
+    unsigned int mTarget;       //!< First vertex of the position kept
+    float mCost;                //!< Mean squared distance to the planes of the two positions
+};
+
+//! Get the position of a vertex
+inline Math::Vec3 GetPosition(const void * positions, unsigned int positionStride, unsigned int vertex)
+{
+    const float * p = reinterpret_cast<const float *>(static_cast<const char *>(positions) + vertex * positionStride);
+    return Math::Vec3(p[0], p[1], p[2]);
+}
+
+//! Get the bits of a float, +0 and -0 having the same bits
+inline unsigned int GetFloatBits(float f)
+{
+    union { float mFloat; unsigned int mBits; } value;
+    value.mFloat = (f == 0.0f) ? 0.0f : f;
+    return value.mBits;
+}
+
+//! Get the smallest power of 2 at least twice a number of entries, the size of an open addressing hash table
+inline unsigned int GetHashTableSize(unsigned int numEntries)
+{
+    unsigned int size = 1;
+    while (size < numEntries * 2)
+    {
+        size <<= 1;
+    }
+    return size;
+}
+
+//! Hash a pair of 32 bits values
+inline unsigned int HashPair(unsigned int a, unsigned int b)
+{
+    unsigned int h = (a * 0x9E3779B1u) ^ (b * 0x85EBCA6Bu);
+    return h ^ (h >> 15);
+}
+
+//! Add the plane of a triangle to a quadric
+inline void AddPlane(Quadric & q, Math::Vec3In normal, float distance, float weight)
+{
+    const double a = normal.v[0];
+    const double b = normal.v[1];
+    const double c = normal.v[2];
+    const double d = distance;
+    const double w = weight;
+    q.mA00 += w * a * a;
+    q.mA11 += w * b * b;
+    q.mA22 += w * c * c;
+    q.mA01 += w * a * b;
+    q.mA02 += w * a * c;
+    q.mA12 += w * b * c;
+    q.mB0 += w * a * d;
+    q.mB1 += w * b * d;
+    q.mB2 += w * c * d;
+    q.mC += w * d * d;
+    q.mWeight += w;
+}
+
+//! Add a quadric to another one
+inline void AddQuadric(Quadric & q, const Quadric & r)
+{
+    q.mA00 += r.mA00;   q.mA11 += r.mA11;   q.mA22 += r.mA22;
+    q.mA01 += r.mA01;   q.mA02 += r.mA02;   q.mA12 += r.mA12;
+    q.mB0 += r.mB0;     q.mB1 += r.mB1;     q.mB2 += r.mB2;
+    q.mC += r.mC;
+    q.mWeight += r.mWeight;
+}
+
+//! Evaluate the weighted sum of the squared distances of a point to the planes of a quadric
+inline double EvaluateQuadric(const Quadric & q, Math::Vec3In p)
+{
+    const double x = p.v[0];
+    const double y = p.v[1];
+    const double z = p.v[2];
+    const double e =   q.mA00 * x * x + q.mA11 * y * y + q.mA22 * z * z
+                     + 2.0 * (q.mA01 * x * y + q.mA02 * x * z + q.mA12 * y * z)
+                     + 2.0 * (q.mB0 * x + q.mB1 * y + q.mB2 * z)
+                     + q.mC;
+    return (e > 0.0) ? e : 0.0;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Link the vertices sharing a position. The vertices of a position are its wedges,
+//! differing by their attributes (UV seams, hard normals)
+//! \param positionVertices First vertex of the position of each vertex (output)
+//! \param nextWedges Next vertex of the same position of each vertex, in a circular list (output)
+static void LinkWedges(const void * positions,
+                       unsigned int positionStride,
+                       unsigned int numVertices,
+                       Alloc::IAllocator * allocator,
+                       unsigned int * positionVertices,
+                       unsigned int * nextWedges)
+{
+    const unsigned int tableSize = GetHashTableSize(numVertices);
+    const unsigned int tableMask = tableSize - 1;
+    unsigned int * table = PG_NEW_ARRAY(allocator, -1, "Simplifier position table", Alloc::PG_MEM_TEMP, unsigned int, tableSize);
+    Utils::Memset8(table, static_cast<char>(0xFF), tableSize * sizeof(unsigned int));
+
+    for (unsigned int v = 0; v < numVertices; ++v)
+    {
+        const Math::Vec3 p = GetPosition(positions, positionStride, v);
+        unsigned int slot = HashPair(GetFloatBits(p.v[0]) ^ (GetFloatBits(p.v[2]) * 0x27D4EB2Fu), GetFloatBits(p.v[1])) & tableMask;
+        while (table[slot] != INVALID_VERTEX)
+        {
+            const Math::Vec3 q = GetPosition(positions, positionStride, table[slot]);
+            if ((p.v[0] == q.v[0]) && (p.v[1] == q.v[1]) && (p.v[2] == q.v[2]))
+            {
+                break;
+            }
+            slot = (slot + 1) & tableMask;
+        }
+
+        if (table[slot] == INVALID_VERTEX)
+        {
+            table[slot] = v;
+            positionVertices[v] = v;
+            nextWedges[v] = v;
+        }
+        else
+        {
+            const unsigned int first = table[slot];
+            positionVertices[v] = first;
+            nextWedges[v] = nextWedges[first];
+            nextWedges[first] = v;
+        }
+    }
+
+    PG_DELETE_ARRAY(allocator, table);
+}
+
+//! Accumulate the planes of the triangles into the quadrics of their positions, weighted by their area,
+//! and compute the normals of the positions of the input mesh
+//! \param normals Normal of each position, null for the unused positions (output)
+static void ComputeQuadrics(const unsigned int * indices,
+                            unsigned int numIndices,
+                            const void * positions,
+                            unsigned int positionStride,
+                            const unsigned int * positionVertices,
+                            unsigned int numVertices,
+                            Quadric * quadrics,
+                            Math::Vec3 * normals)
+{
+    for (unsigned int v = 0; v < numVertices; ++v)
+    {
+        normals[v] = Math::Vec3(0.0f, 0.0f, 0.0f);
+    }
+
+    for (unsigned int i = 0; i < numIndices; i += 3)
+    {
+        const Math::Vec3 p0 = GetPosition(positions, positionStride, indices[i]);
+        const Math::Vec3 p1 = GetPosition(positions, positionStride, indices[i + 1]);
+        const Math::Vec3 p2 = GetPosition(positions, positionStride, indices[i + 2]);
+        Math::Vec3 normal;
+        Math::Cross(normal, p1 - p0, p2 - p0);
+        const float length = Math::Length(normal);
+        if (length > 0.0f)
+        {
+            for (unsigned int c = 0; c < 3; ++c)
+            {
+                normals[positionVertices[indices[i + c]]] += normal;
+            }
+            normal /= length;
+            const float distance = -Math::Dot(normal, p0);
+            const float weight = length * 0.5f;
+            for (unsigned int c = 0; c < 3; ++c)
+            {
+                AddPlane(quadrics[positionVertices[indices[i + c]]], normal, distance, weight);
+            }
+        }
+    }
+
+    for (unsigned int v = 0; v < numVertices; ++v)
+    {
+        const float length = Math::Length(normals[v]);
+        if (length > 0.0f)
+        {
+            normals[v] /= length;
+        }
+    }
+}
+
+//! Build the list of triangles using each position
+//! \param adjacencyOffsets First entry of each position in the adjacency, numVertices + 1 entries (output)
+//! \param adjacency Triangles of each position (output, numIndices entries)
+static void BuildAdjacency(const unsigned int * indices,
+                           unsigned int numIndices,
+                           const unsigned int * positionVertices,
+                           unsigned int numVertices,
+                           unsigned int * adjacencyOffsets,
+                           unsigned int * adjacency)
+{
+    Utils::Memset8(adjacencyOffsets, 0, (numVertices + 1) * sizeof(unsigned int));
+    for (unsigned int i = 0; i < numIndices; ++i)
+    {
+        ++adjacencyOffsets[positionVertices[indices[i]] + 1];
+    }
+    for (unsigned int v = 0; v < numVertices; ++v)
+    {
+        adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+    }
+    for (unsigned int i = 0; i < numIndices; ++i)
+    {
+        adjacency[adjacencyOffsets[positionVertices[indices[i]]]++] = i / 3;
+    }
+    // The fill moved each offset to the start of the next position
+    for (unsigned int v = numVertices; v > 0; --v)
+    {
+        adjacencyOffsets[v] = adjacencyOffsets[v - 1];
+    }
+    adjacencyOffsets[0] = 0;
+}
+
+//! Lock the positions of the open borders, the edges used by the triangles in only one direction
+//! \param vertexFlags Flags of the positions, receiving VERTEX_LOCKED (output)
+static void LockBorders(const unsigned int * indices,
+                        unsigned int numIndices,
+                        const unsigned int * positionVertices,
+                        const unsigned int * adjacencyOffsets,
+                        const unsigned int * adjacency,
+                        unsigned char * vertexFlags)
+{
+    for (unsigned int i = 0; i < numIndices; ++i)
+    {
+        const unsigned int a = positionVertices[indices[i]];
+        const unsigned int b = positionVertices[indices[(i % 3 == 2) ? (i - 2) : (i + 1)]];
+
+        // Look for the opposite edge in the triangles using the end of the edge
+        bool opposite = false;
+        for (unsigned int t = adjacencyOffsets[b]; (t < adjacencyOffsets[b + 1]) && !opposite; ++t)
+        {
+            const unsigned int * triangle = indices + adjacency[t] * 3;
+            for (unsigned int c = 0; c < 3; ++c)
+            {
+                if ((positionVertices[triangle[c]] == b) && (positionVertices[triangle[(c + 1) % 3]] == a))
+                {
+                    opposite = true;
+                    break;
+                }
+            }
+        }
+        if (!opposite)
+        {
+            vertexFlags[a] |= VERTEX_LOCKED;
+            vertexFlags[b] |= VERTEX_LOCKED;
+        }
+    }
+}
+
+//! Gather the cheapest collapse direction of each edge not locked at both ends
+//! \return Number of collapses
+static unsigned int GatherCollapses(const unsigned int * indices,
+                                    unsigned int numIndices,
+                                    const void * positions,
+                                    unsigned int positionStride,
+                                    const unsigned int * positionVertices,
+                                    const unsigned char * vertexFlags,
+                                    const Quadric * quadrics,
+                                    Collapse * collapses)
+{
+    unsigned int numCollapses = 0;
+    for (unsigned int i = 0; i < numIndices; ++i)
+    {
+        const unsigned int a = positionVertices[indices[i]];
+        const unsigned int b = positionVertices[indices[(i % 3 == 2) ? (i - 2) : (i + 1)]];
+
+        // The inner edges are used in both directions, only one is kept
+        if ((a >= b) || ((vertexFlags[a] & vertexFlags[b] & VERTEX_LOCKED) != 0))
+        {
+            continue;
+        }
+
+        Quadric q = quadrics[a];
+        AddQuadric(q, quadrics[b]);
+        const double rcpWeight = (q.mWeight > 0.0) ? (1.0 / q.mWeight) : 1.0;
+        const float costAB = static_cast<float>(EvaluateQuadric(q, GetPosition(positions, positionStride, b)) * rcpWeight);
+        const float costBA = static_cast<float>(EvaluateQuadric(q, GetPosition(positions, positionStride, a)) * rcpWeight);
+
+        Collapse & collapse = collapses[numCollapses++];
+        if (((vertexFlags[b] & VERTEX_LOCKED) != 0) || (((vertexFlags[a] & VERTEX_LOCKED) == 0) && (costAB <= costBA)))
+        {
+            collapse.mSource = a;
+            collapse.mTarget = b;
+            collapse.mCost = costAB;
+        }
+        else
+        {
+            collapse.mSource = b;
+            collapse.mTarget = a;
+            collapse.mCost = costBA;
+        }
+    }
+    return numCollapses;
+}
+
+//! Sort the collapses by increasing cost, with a counting sort on the upper 16 bits of the costs.
+//! The costs are positive, so their bits sort as integers. The order of the costs sharing a bucket is kept
+//! \param buckets Temporary buffer of COLLAPSE_SORT_BUCKETS entries
+//! \param order Indices of the sorted collapses (output)
+static void SortCollapses(const Collapse * collapses, unsigned int numCollapses, unsigned int * buckets, unsigned int * order)
+{
+    Utils::Memset8(buckets, 0, COLLAPSE_SORT_BUCKETS * sizeof(unsigned int));
+    for (unsigned int c = 0; c < numCollapses; ++c)
+    {
+        ++buckets[GetFloatBits(collapses[c].mCost) >> 16];
+    }
+    unsigned int offset = 0;
+    for (unsigned int b = 0; b < COLLAPSE_SORT_BUCKETS; ++b)
+    {
+        const unsigned int count = buckets[b];
+        buckets[b] = offset;
+        offset += count;
+    }
+    for (unsigned int c = 0; c < numCollapses; ++c)
+    {
+        order[buckets[GetFloatBits(collapses[c].mCost) >> 16]++] = c;
+    }
+}
+
+//! Test if moving a position does not flip or strongly tilt the triangles around it,
+//! and count the triangles removed by the collapse. The triangles are compared with their
+//! current normal and with the normals of the input mesh at their corners, so successive
+//! collapses cannot tilt them further than a single one
+//! \param numRemovedTriangles Number of triangles using both positions of the collapse (output)
+//! \return True if the collapse keeps the normals of the triangles
+static bool TestCollapseNormals(const Collapse & collapse,
+                                const unsigned int * indices,
+                                const void * positions,
+                                unsigned int positionStride,
+                                const unsigned int * positionVertices,
+                                const Math::Vec3 * normals,
+                                const unsigned int * remap,
+                                const unsigned int * adjacencyOffsets,
+                                const unsigned int * adjacency,
+                                unsigned int & numRemovedTriangles)
+{
+    const Math::Vec3 target = GetPosition(positions, positionStride, collapse.mTarget);
+    numRemovedTriangles = 0;
+    for (unsigned int a = adjacencyOffsets[collapse.mSource]; a < adjacencyOffsets[collapse.mSource + 1]; ++a)
+    {
+        const unsigned int * triangle = indices + adjacency[a] * 3;
+        unsigned int corners[3];
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            corners[c] = positionVertices[remap[triangle[c]]];
+        }
+        if ((corners[0] == collapse.mTarget) || (corners[1] == collapse.mTarget) || (corners[2] == collapse.mTarget))
+        {
+            ++numRemovedTriangles;
+            continue;
+        }
+        if ((corners[0] == corners[1]) || (corners[1] == corners[2]) || (corners[0] == corners[2]))
+        {
+            continue;
+        }
+
+        const Math::Vec3 p0 = GetPosition(positions, positionStride, corners[0]);
+        const Math::Vec3 p1 = GetPosition(positions, positionStride, corners[1]);
+        const Math::Vec3 p2 = GetPosition(positions, positionStride, corners[2]);
+        const Math::Vec3 q0 = (corners[0] == collapse.mSource) ? target : p0;
+        const Math::Vec3 q1 = (corners[1] == collapse.mSource) ? target : p1;
+        const Math::Vec3 q2 = (corners[2] == collapse.mSource) ? target : p2;
+        Math::Vec3 normalBefore;
+        Math::Vec3 normalAfter;
+        Math::Cross(normalBefore, p1 - p0, p2 - p0);
+        Math::Cross(normalAfter, q1 - q0, q2 - q0);
+        const float lengthBefore = Math::Length(normalBefore);
+        const float minDot = SIMPLIFY_MIN_NORMAL_COSINE * Math::Length(normalAfter);
+        if ((lengthBefore > 0.0f) && (Math::Dot(normalBefore, normalAfter) <= minDot * lengthBefore))
+        {
+            return false;
+        }
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            const Math::Vec3 & cornerNormal = normals[(corners[c] == collapse.mSource) ? collapse.mTarget : corners[c]];
+            if ((Math::Dot(cornerNormal, cornerNormal) > 0.0f) && (Math::Dot(cornerNormal, normalAfter) <= minDot))
+            {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+//! Find the wedge of the target position each wedge of the source position is collapsed onto,
+//! the one it shares an edge with. Keeps the seams between the wedges in place
+//! \param wedgeTargets Target vertex of each used wedge, INVALID_VERTEX for the unused ones, in the order of the wedge list (output)
+//! \return False if a used wedge shares no edge with the target position, the collapse would move a seam
+static bool FindWedgeTargets(const Collapse & collapse,
+                             const unsigned int * indices,
+                             const unsigned int * positionVertices,
+                             const unsigned int * nextWedges,
+                             const unsigned int * remap,
+                             const unsigned int * adjacencyOffsets,
+                             const unsigned int * adjacency,
+                             unsigned int * wedgeTargets,
+                             unsigned int maxWedges)
+{
+    unsigned int w = 0;
+    unsigned int wedge = collapse.mSource;
+    do
+    {
+        if (w == maxWedges)
+        {
+            return false;
+        }
+
+        bool used = false;
+        unsigned int wedgeTarget = INVALID_VERTEX;
+        for (unsigned int a = adjacencyOffsets[collapse.mSource]; (a < adjacencyOffsets[collapse.mSource + 1]) && (wedgeTarget == INVALID_VERTEX); ++a)
+        {
+            const unsigned int * triangle = indices + adjacency[a] * 3;
+            for (unsigned int c = 0; c < 3; ++c)
+            {
+                if (remap[triangle[c]] == wedge)
+                {
+                    used = true;
+                    const unsigned int next = remap[triangle[(c + 1) % 3]];
+                    const unsigned int previous = remap[triangle[(c + 2) % 3]];
+                    if (positionVertices[next] == collapse.mTarget)
+                    {
+                        wedgeTarget = next;
+                    }
+                    else if (positionVertices[previous] == collapse.mTarget)
+                    {
+                        wedgeTarget = previous;
+                    }
+                    break;
+                }
+            }
+        }
+        if (used && (wedgeTarget == INVALID_VERTEX))
+        {
+            return false;
+        }
+        wedgeTargets[w++] = wedgeTarget;
+        wedge = nextWedges[wedge];
+    }
+    while (wedge != collapse.mSource);
+    return true;
+}
+
+//! Apply the remapping of the vertices to the triangles and remove the degenerate ones
+//! \return Number of indices left
+static unsigned int CompactTriangles(unsigned int * indices,
+                                     unsigned int numIndices,
+                                     const unsigned int * positionVertices,
+                                     const unsigned int * remap)
+{
+    unsigned int numKept = 0;
+    for (unsigned int i = 0; i < numIndices; i += 3)
+    {
+        const unsigned int v0 = remap[indices[i]];
+        const unsigned int v1 = remap[indices[i + 1]];
+        const unsigned int v2 = remap[indices[i + 2]];
+        const unsigned int p0 = positionVertices[v0];
+        const unsigned int p1 = positionVertices[v1];
+        const unsigned int p2 = positionVertices[v2];
+        if ((p0 != p1) && (p1 != p2) && (p0 != p2))
+        {
+            indices[numKept] = v0;
+            indices[numKept + 1] = v1;
+            indices[numKept + 2] = v2;
+            numKept += 3;
+        }
+    }
+    return numKept;
+}
+
+}   // namespace Internal
+
+//----------------------------------------------------------------------------------------
+
+unsigned int SimplifyMesh(const unsigned int * indices,
+                          unsigned int numIndices,
+                          const void * positions,
+                          unsigned int positionStride,
+                          unsigned int numVertices,
+                          unsigned int targetNumIndices,
+                          float maxError,
+                          Alloc::IAllocator * allocator,
+                          unsigned int * outIndices,
+                          float * outError)
+{
+    PG_ASSERT((indices != nullptr) || (numIndices == 0));
+    PG_ASSERT((outIndices != nullptr) || (numIndices == 0));
+    PG_ASSERTSTR((numIndices % 3) == 0, "Invalid number of indices (%u) for a triangle list", numIndices);
+
+    if (outError != nullptr)
+    {
+        *outError = 0.0f;
+    }
+    if ((numIndices != 0) && (outIndices != indices))
+    {
+        Utils::Memcpy(outIndices, indices, numIndices * sizeof(unsigned int));
+    }
+    targetNumIndices -= targetNumIndices % 3;
+    if ((numIndices <= targetNumIndices) || (numVertices == 0))
+    {
+        return numIndices;
+    }
+
+    PG_PROFILE_SCOPE("SimplifyMesh");
+
+    unsigned int * positionVertices = PG_NEW_ARRAY(allocator, -1, "Simplifier position vertices", Alloc::PG_MEM_TEMP, unsigned int, numVertices);
+    unsigned int * nextWedges = PG_NEW_ARRAY(allocator, -1, "Simplifier next wedges", Alloc::PG_MEM_TEMP, unsigned int, numVertices);
+    unsigned int * remap = PG_NEW_ARRAY(allocator, -1, "Simplifier remap", Alloc::PG_MEM_TEMP, unsigned int, numVertices);
+    unsigned char * vertexFlags = PG_NEW_ARRAY(allocator, -1, "Simplifier vertex flags", Alloc::PG_MEM_TEMP, unsigned char, numVertices);
+    Internal::Quadric * quadrics = PG_NEW_ARRAY(allocator, -1, "Simplifier quadrics", Alloc::PG_MEM_TEMP, Internal::Quadric, numVertices);
+    Math::Vec3 * normals = PG_NEW_ARRAY(allocator, -1, "Simplifier normals", Alloc::PG_MEM_TEMP, Math::Vec3, numVertices);
+    Utils::Memset8(vertexFlags, 0, numVertices);
+    Utils::Memset8(quadrics, 0, numVertices * sizeof(Internal::Quadric));
+
+    // The simplification works on positions, each one represented by its first vertex
+    unsigned int * adjacencyOffsets = PG_NEW_ARRAY(allocator, -1, "Simplifier adjacency offsets", Alloc::PG_MEM_TEMP, unsigned int, numVertices + 1);
+    unsigned int * adjacency = PG_NEW_ARRAY(allocator, -1, "Simplifier adjacency", Alloc::PG_MEM_TEMP, unsigned int, numIndices);
+    unsigned int * workIndices = outIndices;
+    Internal::LinkWedges(positions, positionStride, numVertices, allocator, positionVertices, nextWedges);
+    Internal::BuildAdjacency(workIndices, numIndices, positionVertices, numVertices, adjacencyOffsets, adjacency);
+    Internal::LockBorders(workIndices, numIndices, positionVertices, adjacencyOffsets, adjacency, vertexFlags);
+    Internal::ComputeQuadrics(workIndices, numIndices, positions, positionStride, positionVertices, numVertices, quadrics, normals);
+
+    Internal::Collapse * collapses = PG_NEW_ARRAY(allocator, -1, "Simplifier collapses", Alloc::PG_MEM_TEMP, Internal::Collapse, numIndices);
+    unsigned int * collapseOrder = PG_NEW_ARRAY(allocator, -1, "Simplifier collapse order", Alloc::PG_MEM_TEMP, unsigned int, numIndices);
+    unsigned int * sortBuckets = PG_NEW_ARRAY(allocator, -1, "Simplifier sort buckets", Alloc::PG_MEM_TEMP, unsigned int, Internal::COLLAPSE_SORT_BUCKETS);
+
+    const float maxCost = (maxError > 0.0f) ? (maxError * maxError) : 3.0e38f;
+    float appliedCost = 0.0f;
+    unsigned int numCurrentIndices = numIndices;
+
+    // Each pass collapses the cheapest edges not touching each other, then rebuilds the triangles
+    while (numCurrentIndices > targetNumIndices)
+    {
+        const unsigned int numCollapses = Internal::GatherCollapses(workIndices, numCurrentIndices, positions, positionStride,
+                                                                    positionVertices, vertexFlags, quadrics, collapses);
+        if (numCollapses == 0)
+        {
+            break;
+        }
+        Internal::SortCollapses(collapses, numCollapses, sortBuckets, collapseOrder);
+
+        // A collapse removes about 2 triangles, the cost limit of the pass follows the collapse reaching the target
+        const unsigned int numTrianglesToRemove = (numCurrentIndices - targetNumIndices) / 3;
+        const unsigned int collapseGoal = Math::Min((numTrianglesToRemove + 1) / 2, numCollapses);
+        const float passCost = Math::Min(collapses[collapseOrder[collapseGoal - 1]].mCost * Internal::PASS_COST_TOLERANCE, maxCost);
+
+        for (unsigned int v = 0; v < numVertices; ++v)
+        {
+            remap[v] = v;
+            vertexFlags[v] &= ~Internal::VERTEX_TOUCHED;
+        }
+
+        unsigned int numRemovedTriangles = 0;
+        unsigned int numApplied = 0;
+        for (unsigned int c = 0; (c < numCollapses) && (numRemovedTriangles < numTrianglesToRemove); ++c)
+        {
+            const Internal::Collapse & collapse = collapses[collapseOrder[c]];
+            if (collapse.mCost > passCost)
+            {
+                break;
+            }
+            if (((vertexFlags[collapse.mSource] | vertexFlags[collapse.mTarget]) & Internal::VERTEX_TOUCHED) != 0)
+            {
+                continue;
+            }
+
+            unsigned int numCollapseTriangles = 0;
+            unsigned int wedgeTargets[Internal::MAX_COLLAPSED_WEDGES];
+            if (   !Internal::TestCollapseNormals(collapse, workIndices, positions, positionStride, positionVertices,
+                                                  normals, remap, adjacencyOffsets, adjacency, numCollapseTriangles)
+                || !Internal::FindWedgeTargets(collapse, workIndices, positionVertices, nextWedges, remap,
+                                               adjacencyOffsets, adjacency, wedgeTargets, Internal::MAX_COLLAPSED_WEDGES))
+            {
+                continue;
+            }
+
+            unsigned int w = 0;
+            unsigned int wedge = collapse.mSource;
+            do
+            {
+                if (wedgeTargets[w] != Internal::INVALID_VERTEX)
+                {
+                    remap[wedge] = wedgeTargets[w];
+                }
+                ++w;
+                wedge = nextWedges[wedge];
+            }
+            while (wedge != collapse.mSource);
+
+            Internal::AddQuadric(quadrics[collapse.mTarget], quadrics[collapse.mSource]);
+            vertexFlags[collapse.mSource] |= Internal::VERTEX_TOUCHED;
+            vertexFlags[collapse.mTarget] |= Internal::VERTEX_TOUCHED;
+            appliedCost = Math::Max(appliedCost, collapse.mCost);
+            numRemovedTriangles += numCollapseTriangles;
+            ++numApplied;
+        }
+
+        if (numApplied == 0)
+        {
+            break;
+        }
+        numCurrentIndices = Internal::CompactTriangles(workIndices, numCurrentIndices, positionVertices, remap);
+        Internal::BuildAdjacency(workIndices, numCurrentIndices, positionVertices, numVertices, adjacencyOffsets, adjacency);
+    }
+
+    if (outError != nullptr)
+    {
+        *outError = Math::Sqrt(appliedCost);
+    }
+
+    PG_DELETE_ARRAY(allocator, sortBuckets);
+    PG_DELETE_ARRAY(allocator, collapseOrder);
+    PG_DELETE_ARRAY(allocator, collapses);
+    PG_DELETE_ARRAY(allocator, adjacency);
+    PG_DELETE_ARRAY(allocator, adjacencyOffsets);
+    PG_DELETE_ARRAY(allocator, normals);
+    PG_DELETE_ARRAY(allocator, quadrics);
+    PG_DELETE_ARRAY(allocator, vertexFlags);
+    PG_DELETE_ARRAY(allocator, remap);
+    PG_DELETE_ARRAY(allocator, nextWedges);
+    PG_DELETE_ARRAY(allocator, positionVertices);
+
+    return numCurrentIndices;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int BuildMeshLods(MeshData * meshData,
+                           unsigned int numLods,
+                           float lodRatio,
+                           Alloc::IAllocator * allocator)
+{
+    PG_ASSERT(meshData != nullptr);
+    PG_ASSERTSTR((lodRatio > 0.0f) && (lodRatio < 1.0f), "Invalid ratio (%f) between two levels of detail", lodRatio);
+
+    const MeshConfiguration & configuration = meshData->GetConfiguration();
+    if (   (meshData->GetMode() != Graph::Node::STANDARD)
+        || !configuration.GetIsIndexed()
+        || (configuration.GetMeshPrimitiveType() != MeshConfiguration::TRIANGLE))
+    {
+        return 1;
+    }
+    const unsigned int numVertices = static_cast<unsigned int>(meshData->GetVertexCount());
+    const unsigned int numLod0Indices = static_cast<unsigned int>(meshData->GetLodIndexCount(0));
+    numLods = Math::Min(numLods, static_cast<unsigned int>(MESH_MAX_LODS));
+    if ((numLods < 2) || (numLod0Indices < 3) || (numVertices == 0))
+    {
+        return 1;
+    }
+
+    const void * positions = nullptr;
+    unsigned int positionStride = 0;
+    if (!FindMeshPositions(meshData, positions, positionStride))
+    {
+        PG_LOG('ERR_', "Cannot simplify a mesh without 32 bits float positions");
+        return 1;
+    }
+
+    PG_PROFILE_SCOPE("BuildMeshLods");
+
+    // The levels are built one after the other, each one having room for the whole level 0
+    unsigned int * lodIndices = PG_NEW_ARRAY(allocator, -1, "Mesh LOD indices", Alloc::PG_MEM_TEMP, unsigned int, numLod0Indices * numLods);
+    const unsigned short * lod0Indices = meshData->GetIndexBuffer() + meshData->GetLodFirstIndex(0);
+    for (unsigned int i = 0; i < numLod0Indices; ++i)
+    {
+        lodIndices[i] = lod0Indices[i];
+    }
+
+    int lodIndexCounts[MESH_MAX_LODS];
+    float lodErrors[MESH_MAX_LODS];
+    lodIndexCounts[0] = static_cast<int>(numLod0Indices);
+    lodErrors[0] = 0.0f;
+    unsigned int numBuiltLods = 1;
+    unsigned int numTotalIndices = numLod0Indices;
+    float targetNumIndices = static_cast<float>(numLod0Indices);
+    for (unsigned int lod = 1; lod < numLods; ++lod)
+    {
+        const unsigned int numPreviousIndices = static_cast<unsigned int>(lodIndexCounts[lod - 1]);
+        targetNumIndices *= lodRatio;
+        float error = 0.0f;
+        const unsigned int numLodIndices = SimplifyMesh(lodIndices + numTotalIndices - numPreviousIndices, numPreviousIndices,
+                                                        positions, positionStride, numVertices,
+                                                        static_cast<unsigned int>(targetNumIndices), 0.0f,
+                                                        allocator, lodIndices + numTotalIndices, &error);
+        if ((numLodIndices == 0) || (numLodIndices >= numPreviousIndices))
+        {
+            break;
+        }
+
+        // The error of a level is relative to the previous one, its sum bounds the error relative to the level 0
+        lodIndexCounts[lod] = static_cast<int>(numLodIndices);
+        lodErrors[lod] = lodErrors[lod - 1] + error;
+        numTotalIndices += numLodIndices;
+        ++numBuiltLods;
+    }
+
+    if (numBuiltLods > 1)
+    {
+        meshData->AllocateIndexes(static_cast<int>(numTotalIndices));
+        unsigned short * indices = meshData->GetIndexBuffer();
+        for (unsigned int i = 0; i < numTotalIndices; ++i)
+        {
+            indices[i] = static_cast<unsigned short>(lodIndices[i]);
+        }
+        meshData->SetLods(lodIndexCounts, lodErrors, static_cast<int>(numBuiltLods));
+
+        for (unsigned int lod = 0; lod < numBuiltLods; ++lod)
+        {
+            PG_LOG('MESH', "Mesh LOD %u: %d triangles, error %f", lod, lodIndexCounts[lod] / 3, lodErrors[lod]);
+        }
+    }
+
+    PG_DELETE_ARRAY(allocator, lodIndices);
+    return numBuiltLods;
+}
+
+
+}   // namespace Mesh
+}   // namespace Pegasus
@@ -0,0 +1,411 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshWelder.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Welding of the coincident vertices of indexed meshes
+
+#include "Pegasus/Mesh/MeshWelder.h"
+#include "Pegasus/Mesh/MeshOptimizer.h"
+#include "Pegasus/Mesh/MeshData.h"
+#include "Pegasus/Math/Vector.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Core/Profiler.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+
+namespace Internal {
+
+//! Value of the vertex tables for the empty entries
+static const unsigned int INVALID_VERTEX = 0xFFFFFFFF;
+
+//! Largest cell coordinate of the spatial hash, the positions further away share the last cells
+static const float MAX_CELL_COORDINATE = 1073741824.0f;
+
+//! Smallest size of the cells of the spatial hash, relative to the extent of the mesh,
+//! so exact matches do not put the whole mesh in a single cell
+static const float MIN_RELATIVE_CELL_SIZE = 1.0e-6f;
+
+//! Vertex attribute compared by the welding
+struct WeldAttribute
+{
+    const char * mData;         //!< Attribute of the first vertex
+    unsigned int mStride;       //!< Number of bytes between two vertices
+    unsigned int mByteSize;     //!< Size of the attribute in bytes
+    unsigned int mNumFloats;    //!< Number of float components compared with a tolerance, 0 to compare the bytes
+    float mSquaredTolerance;    //!< Maximum squared distance between two welded attributes
+};
+
+//! Cell of the spatial hash, chaining the vertices kept in it
+struct WeldCell
+{
+    unsigned int mX, mY, mZ;    //!< Coordinates of the cell
+    unsigned int mFirstVertex;  //!< Last vertex added to the cell, INVALID_VERTEX for an empty entry
+};
+
+//! Get the smallest power of 2 at least twice a number of entries, the size of an open addressing hash table
+inline unsigned int GetHashTableSize(unsigned int numEntries)
+{
+    unsigned int size = 1;
+    while (size < numEntries * 2)
+    {
+        size <<= 1;
+    }
+    return size;
+}
+
+//! Get the position of a vertex
+inline const float * GetPosition(const void * positions, unsigned int positionStride, unsigned int vertex)
+{
+    return reinterpret_cast<const float *>(static_cast<const char *>(positions) + vertex * positionStride);
+}
+
+//! Get the coordinate of the cell containing a position component
+inline unsigned int GetCellCoordinate(float position, float minPosition, float invCellSize)
+{
+    const float coordinate = Math::Floor((position - minPosition) * invCellSize);
+    return static_cast<unsigned int>(Math::Min(Math::Max(coordinate, 0.0f), MAX_CELL_COORDINATE));
+}
+
+//! Find the entry of a cell in the spatial hash
+//! \return Index of the entry of the cell, or of the empty entry where to add it
+inline unsigned int FindCell(const WeldCell * cells, unsigned int cellMask, unsigned int x, unsigned int y, unsigned int z)
+{
+    unsigned int h = (x * 0x8DA6B343u) ^ (y * 0xD8163841u) ^ (z * 0xCB1AB31Fu);
+    unsigned int slot = (h ^ (h >> 15)) & cellMask;
+    while ((cells[slot].mFirstVertex != INVALID_VERTEX)
+        && ((cells[slot].mX != x) || (cells[slot].mY != y) || (cells[slot].mZ != z)))
+    {
+        slot = (slot + 1) & cellMask;
+    }
+    return slot;
+}
+
+//! Test if two vertices can be welded
+static bool AreVerticesWeldable(const WeldAttribute * attributes, unsigned int numAttributes, unsigned int v1, unsigned int v2)
+{
+    for (unsigned int a = 0; a < numAttributes; ++a)
+    {
+        const WeldAttribute & attribute = attributes[a];
+        const char * data1 = attribute.mData + v1 * attribute.mStride;
+        const char * data2 = attribute.mData + v2 * attribute.mStride;
+        if (attribute.mNumFloats > 0)
+        {
+            const float * f1 = reinterpret_cast<const float *>(data1);
+            const float * f2 = reinterpret_cast<const float *>(data2);
+            float squaredDistance = 0.0f;
+            for (unsigned int c = 0; c < attribute.mNumFloats; ++c)
+            {
+                squaredDistance += (f1[c] - f2[c]) * (f1[c] - f2[c]);
+            }
+            if (!(squaredDistance <= attribute.mSquaredTolerance))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            for (unsigned int b = 0; b < attribute.mByteSize; ++b)
+            {
+                if (data1[b] != data2[b])
+                {
+                    return false;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+//! Gather the attributes compared by the welding, with the tolerance matching their semantic
+//! \return Number of attributes
+static unsigned int GatherWeldAttributes(MeshData * meshData,
+                                         float positionTolerance,
+                                         float normalTolerance,
+                                         float uvTolerance,
+                                         WeldAttribute * attributes)
+{
+    const MeshInputLayout & inputLayout = meshData->GetConfiguration().GetInputLayout();
+    unsigned int numAttributes = 0;
+    for (int a = 0; a < inputLayout.GetAttributeCount(); ++a)
+    {
+        const MeshInputLayout::AttrDesc & attr = inputLayout.GetAttributeDesc(a);
+        WeldAttribute & attribute = attributes[numAttributes++];
+        attribute.mData = static_cast<const char *>(meshData->GetStream<void>(attr.mStreamIndex)) + attr.mByteOffset;
+        attribute.mStride = static_cast<unsigned int>(meshData->GetStreamStride(attr.mStreamIndex));
+        attribute.mByteSize = static_cast<unsigned int>(attr.mByteSize);
+        attribute.mNumFloats = 0;
+        attribute.mSquaredTolerance = 0.0f;
+
+        const bool isFloat = (attr.mType == Core::FORMAT_RGBA_32_FLOAT) || (attr.mType == Core::FORMAT_RGB_32_FLOAT)
+                          || (attr.mType == Core::FORMAT_RG_32_FLOAT) || (attr.mType == Core::FORMAT_R32_FLOAT);
+        if (isFloat)
+        {
+            float tolerance = -1.0f;
+            switch (attr.mSemantic)
+            {
+            case MeshInputLayout::POSITION: tolerance = positionTolerance; break;
+            case MeshInputLayout::NORMAL:   tolerance = normalTolerance;   break;
+            case MeshInputLayout::UV:       tolerance = uvTolerance;       break;
+            default: break;
+            }
+            if (tolerance > 0.0f)
+            {
+                attribute.mNumFloats = attribute.mByteSize / sizeof(float);
+                attribute.mSquaredTolerance = tolerance * tolerance;
+            }
+        }
+    }
+    return numAttributes;
+}
+
+//! Remap the indices of the triangles to the welded vertices and remove the degenerate triangles
+//! of each level of detail, the levels staying consecutive in the index buffer
+//! \param lodIndexCounts Number of indices of each level of detail (input/output)
+//! \return Number of indices kept
+static unsigned int RemapTriangles(unsigned short * indices,
+                                   const unsigned int * remap,
+                                   int * lodIndexCounts,
+                                   int numLods)
+{
+    unsigned int numKeptIndices = 0;
+    unsigned int firstIndex = 0;
+    for (int lod = 0; lod < numLods; ++lod)
+    {
+        const unsigned int lodFirstKeptIndex = numKeptIndices;
+        const unsigned int lodEndIndex = firstIndex + static_cast<unsigned int>(lodIndexCounts[lod]);
+        for (unsigned int i = firstIndex; i + 2 < lodEndIndex; i += 3)
+        {
+            const unsigned short a = static_cast<unsigned short>(remap[indices[i]]);
+            const unsigned short b = static_cast<unsigned short>(remap[indices[i + 1]]);
+            const unsigned short c = static_cast<unsigned short>(remap[indices[i + 2]]);
+            if ((a != b) && (b != c) && (c != a))
+            {
+                indices[numKeptIndices++] = a;
+                indices[numKeptIndices++] = b;
+                indices[numKeptIndices++] = c;
+            }
+        }
+        firstIndex = lodEndIndex;
+        lodIndexCounts[lod] = static_cast<int>(numKeptIndices - lodFirstKeptIndex);
+    }
+    return numKeptIndices;
+}
+
+}   // namespace Internal
+
+//----------------------------------------------------------------------------------------
+
+unsigned int WeldMesh(MeshData * meshData,
+                      float positionTolerance,
+                      float normalTolerance,
+                      float uvTolerance,
+                      Alloc::IAllocator * allocator)
+{
+    PG_ASSERT(meshData != nullptr);
+
+    const MeshConfiguration & configuration = meshData->GetConfiguration();
+    if ((meshData->GetMode() != Graph::Node::STANDARD) || !configuration.GetIsIndexed())
+    {
+        return 0;
+    }
+    const unsigned int numVertices = static_cast<unsigned int>(meshData->GetVertexCount());
+    const unsigned int numIndices = static_cast<unsigned int>(meshData->GetIndexCount());
+    const void * positions = nullptr;
+    unsigned int positionStride = 0;
+    if ((numVertices < 2) || (numIndices == 0) || !FindMeshPositions(meshData, positions, positionStride))
+    {
+        return 0;
+    }
+
+    PG_PROFILE_SCOPE("WeldMesh");
+
+    positionTolerance = Math::Max(positionTolerance, 0.0f);
+    Internal::WeldAttribute attributes[MESH_MAX_ATTRIBUTES];
+    const unsigned int numAttributes = Internal::GatherWeldAttributes(meshData, positionTolerance, normalTolerance, uvTolerance, attributes);
+
+    // Cells twice as large as the tolerance, so the neighborhood of a position overlaps at most 2 cells per axis
+    float minPosition[3], maxPosition[3];
+    unsigned int v;
+    int c;
+    for (c = 0; c < 3; ++c)
+    {
+        minPosition[c] = maxPosition[c] = Internal::GetPosition(positions, positionStride, 0)[c];
+    }
+    for (v = 1; v < numVertices; ++v)
+    {
+        const float * p = Internal::GetPosition(positions, positionStride, v);
+        for (c = 0; c < 3; ++c)
+        {
+            minPosition[c] = Math::Min(minPosition[c], p[c]);
+            maxPosition[c] = Math::Max(maxPosition[c], p[c]);
+        }
+    }
+    const float extent = Math::Max(Math::Max(maxPosition[0] - minPosition[0], maxPosition[1] - minPosition[1]), maxPosition[2] - minPosition[2]);
+    float cellSize = Math::Max(2.0f * positionTolerance, extent * Internal::MIN_RELATIVE_CELL_SIZE);
+    if (!(cellSize > 0.0f))
+    {
+        cellSize = 1.0f;
+    }
+    const float invCellSize = 1.0f / cellSize;
+
+    const unsigned int numCells = Internal::GetHashTableSize(numVertices);
+    const unsigned int cellMask = numCells - 1;
+    Internal::WeldCell * cells = PG_NEW_ARRAY(allocator, -1, "Welder cells", Alloc::PG_MEM_TEMP, Internal::WeldCell, numCells);
+    unsigned int * nextCellVertices = PG_NEW_ARRAY(allocator, -1, "Welder cell vertices", Alloc::PG_MEM_TEMP, unsigned int, numVertices);
+    unsigned int * remap = PG_NEW_ARRAY(allocator, -1, "Welder remapping", Alloc::PG_MEM_TEMP, unsigned int, numVertices);
+    Utils::Memset8(cells, static_cast<char>(0xFF), numCells * sizeof(Internal::WeldCell));
+
+    // Weld each vertex to a kept vertex of the neighboring cells, otherwise keep it
+    unsigned int numWeldedVertices = 0;
+    for (v = 0; v < numVertices; ++v)
+    {
+        const float * p = Internal::GetPosition(positions, positionStride, v);
+        unsigned int minCell[3], maxCell[3];
+        for (c = 0; c < 3; ++c)
+        {
+            minCell[c] = Internal::GetCellCoordinate(p[c] - positionTolerance, minPosition[c], invCellSize);
+            maxCell[c] = Internal::GetCellCoordinate(p[c] + positionTolerance, minPosition[c], invCellSize);
+        }
+
+        unsigned int target = Internal::INVALID_VERTEX;
+        for (unsigned int z = minCell[2]; (z <= maxCell[2]) && (target == Internal::INVALID_VERTEX); ++z)
+        {
+            for (unsigned int y = minCell[1]; (y <= maxCell[1]) && (target == Internal::INVALID_VERTEX); ++y)
+            {
+                for (unsigned int x = minCell[0]; (x <= maxCell[0]) && (target == Internal::INVALID_VERTEX); ++x)
+                {
+                    const unsigned int slot = Internal::FindCell(cells, cellMask, x, y, z);
+                    for (unsigned int u = cells[slot].mFirstVertex; u != Internal::INVALID_VERTEX; u = nextCellVertices[u])
+                    {
+                        if (Internal::AreVerticesWeldable(attributes, numAttributes, u, v))
+                        {
+                            target = u;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        if (target != Internal::INVALID_VERTEX)
+        {
+            remap[v] = remap[target];
+        }
+        else
+        {
+            remap[v] = numWeldedVertices++;
+            const unsigned int x = Internal::GetCellCoordinate(p[0], minPosition[0], invCellSize);
+            const unsigned int y = Internal::GetCellCoordinate(p[1], minPosition[1], invCellSize);
+            const unsigned int z = Internal::GetCellCoordinate(p[2], minPosition[2], invCellSize);
+            const unsigned int slot = Internal::FindCell(cells, cellMask, x, y, z);
+            cells[slot].mX = x;
+            cells[slot].mY = y;
+            cells[slot].mZ = z;
+            nextCellVertices[v] = cells[slot].mFirstVertex;
+            cells[slot].mFirstVertex = v;
+        }
+    }
+    PG_DELETE_ARRAY(allocator, nextCellVertices);
+    PG_DELETE_ARRAY(allocator, cells);
+
+    if (numWeldedVertices == numVertices)
+    {
+        PG_DELETE_ARRAY(allocator, remap);
+        return 0;
+    }
+
+    // Remap the triangles, the degenerate ones are removed from their level of detail
+    const int numLods = meshData->GetLodCount();
+    int lodIndexCounts[MESH_MAX_LODS];
+    float lodErrors[MESH_MAX_LODS];
+    for (int lod = 0; lod < numLods; ++lod)
+    {
+        lodIndexCounts[lod] = meshData->GetLodIndexCount(lod);
+        lodErrors[lod] = meshData->GetLodError(lod);
+    }
+    unsigned short * indices = meshData->GetIndexBuffer();
+    unsigned int numKeptIndices = numIndices;
+    if (configuration.GetMeshPrimitiveType() == MeshConfiguration::TRIANGLE)
+    {
+        numKeptIndices = Internal::RemapTriangles(indices, remap, lodIndexCounts, numLods);
+    }
+    else
+    {
+        for (unsigned int i = 0; i < numIndices; ++i)
+        {
+            indices[i] = static_cast<unsigned short>(remap[indices[i]]);
+        }
+    }
+
+    // Keep the first vertex of each welded vertex, in every stream
+    unsigned int vertexSize = 0;
+    int stream;
+    for (stream = 0; stream < MESH_MAX_STREAMS; ++stream)
+    {
+        vertexSize += static_cast<unsigned int>(meshData->GetStreamStride(stream));
+    }
+    char * weldedVertices = PG_NEW_ARRAY(allocator, -1, "Welder vertices", Alloc::PG_MEM_TEMP, char, numWeldedVertices * vertexSize);
+    unsigned short * keptIndices = PG_NEW_ARRAY(allocator, -1, "Welder indices", Alloc::PG_MEM_TEMP, unsigned short, numKeptIndices);
+    Utils::Memcpy(keptIndices, indices, numKeptIndices * sizeof(unsigned short));
+    char * streamVertices = weldedVertices;
+    for (stream = 0; stream < MESH_MAX_STREAMS; ++stream)
+    {
+        const unsigned int stride = static_cast<unsigned int>(meshData->GetStreamStride(stream));
+        const char * vertices = static_cast<const char *>(meshData->GetStream<void>(stream));
+        if ((stride > 0) && (vertices != nullptr))
+        {
+            unsigned int numKeptVertices = 0;
+            for (v = 0; v < numVertices; ++v)
+            {
+                if (remap[v] == numKeptVertices)
+                {
+                    Utils::Memcpy(streamVertices + (numKeptVertices++) * stride, vertices + v * stride, stride);
+                }
+            }
+            streamVertices += numWeldedVertices * stride;
+        }
+    }
+
+    meshData->AllocateVertexes(static_cast<int>(numWeldedVertices));
+    meshData->AllocateIndexes(static_cast<int>(numKeptIndices));
+    streamVertices = weldedVertices;
+    for (stream = 0; stream < MESH_MAX_STREAMS; ++stream)
+    {
+        const unsigned int stride = static_cast<unsigned int>(meshData->GetStreamStride(stream));
+        char * vertices = static_cast<char *>(meshData->GetStream<void>(stream));
+        if ((stride > 0) && (vertices != nullptr))
+        {
+            Utils::Memcpy(vertices, streamVertices, numWeldedVertices * stride);
+            streamVertices += numWeldedVertices * stride;
+        }
+    }
+    if (numKeptIndices > 0)
+    {
+        Utils::Memcpy(meshData->GetIndexBuffer(), keptIndices, numKeptIndices * sizeof(unsigned short));
+    }
+    if (numLods > 1)
+    {
+        meshData->SetLods(lodIndexCounts, lodErrors, numLods);
+    }
+
+    PG_DELETE_ARRAY(allocator, keptIndices);
+    PG_DELETE_ARRAY(allocator, weldedVertices);
+    PG_DELETE_ARRAY(allocator, remap);
+
+    PG_LOG('MESH', "Mesh welded: %u -> %u vertices (%.1f%% fewer), %u -> %u triangles",
+           numVertices, numWeldedVertices, 100.0f * static_cast<float>(numVertices - numWeldedVertices) / static_cast<float>(numVertices),
+           numIndices / 3, numKeptIndices / 3);
+    return numVertices - numWeldedVertices;
+}
+
+
+}   // namespace Mesh
+}   // namespace Pegasus
@@ -35,6 +35,8 @@ MultiCopyOperator::MultiCopyOperator(Pegasus::Alloc::IAllocator* nodeAllocator,
         INIT_PROPERTY(ScaleOffset)
         INIT_PROPERTY(QuaternionRotOffset)
     END_INIT_PROPERTIES()
+    // Each copy keeps the order of the input mesh, the whole mesh is reordered once generated
+    mConfiguration.SetOptimizeVertexCache(true);
 }
 
 MultiCopyOperator::~MultiCopyOperator()
@@ -58,12 +60,14 @@ void MultiCopyOperator::GenerateData()
     bool updated = false;
     MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetUpdatedData(updated)));
     const StdVertex* inputVertex = inputMesh->GetStream<StdVertex>(0);
-    const unsigned short* inputIndexes = inputMesh->GetIndexBuffer();
+    //only the most detailed level is copied when the input has levels of detail
+    const unsigned short* inputIndexes = inputMesh->GetIndexBuffer() + inputMesh->GetLodFirstIndex(0);
+    const int inputIndexCount = inputMesh->GetLodIndexCount(0);
 
     MeshDataRef meshData = GetData();
     PG_ASSERT(meshData != nullptr); 
     meshData->AllocateVertexes(inputMesh->GetVertexCount() * iterCount);
-    meshData->AllocateIndexes(inputMesh->GetIndexCount() * iterCount);
+    meshData->AllocateIndexes(inputIndexCount * iterCount);
     StdVertex* outputVertex = meshData->GetStream<StdVertex>(0);
     unsigned short* outputIndexes = meshData->GetIndexBuffer();
 
@@ -78,9 +82,9 @@ void MultiCopyOperator::GenerateData()
             outputVertex[vIdx].uv = inputVertex[v].uv;
         }
 
-        for (int k = 0; k < inputMesh->GetIndexCount(); ++k)
+        for (int k = 0; k < inputIndexCount; ++k)
         {
-           int kIdx =  i*inputMesh->GetIndexCount() + k; 
+           int kIdx =  i*inputIndexCount + k; 
            outputIndexes[kIdx] = inputIndexes[k] + i*inputMesh->GetVertexCount();
         }
 
@@ -0,0 +1,145 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   QuantizeOperator.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  QuantizeOperator
+
+#include "Pegasus/Mesh/Operator/QuantizeOperator.h"
+#include "Pegasus/Mesh/MeshGenerator.h"
+#include "Pegasus/Mesh/MeshQuantizer.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+
+//! Property implementations
+BEGIN_IMPLEMENT_PROPERTIES(QuantizeOperator)
+END_IMPLEMENT_PROPERTIES(QuantizeOperator)
+
+
+QuantizeOperator::QuantizeOperator(Pegasus::Alloc::IAllocator* nodeAllocator,
+                                   Pegasus::Alloc::IAllocator* nodeDataAllocator)
+: MeshOperator(nodeAllocator, nodeDataAllocator)
+{
+    //INIT properties
+    BEGIN_INIT_PROPERTIES(QuantizeOperator)
+    END_INIT_PROPERTIES()
+
+    //the output uses the compact editor layout
+    MeshInputLayout compactIL;
+    compactIL.GenerateEditorLayout(MeshInputLayout::USE_POSITION | MeshInputLayout::USE_UV | MeshInputLayout::USE_NORMAL | MeshInputLayout::USE_COMPACT);
+    mConfiguration.SetInputLayout(compactIL);
+}
+
+QuantizeOperator::~QuantizeOperator()
+{
+}
+
+bool QuantizeOperator::IsInputCompatible(const MeshConfiguration & inputConfiguration) const
+{
+    MeshInputLayout editorIL;
+    editorIL.GenerateEditorLayout(MeshInputLayout::USE_POSITION | MeshInputLayout::USE_UV | MeshInputLayout::USE_NORMAL);
+    MeshConfiguration expectedConfiguration(GetConfiguration());
+    expectedConfiguration.SetInputLayout(editorIL);
+    return inputConfiguration == expectedConfiguration;
+}
+
+void QuantizeOperator::AddGeneratorInput(MeshGeneratorIn meshGenerator)
+{
+    if (IsInputCompatible(meshGenerator->GetConfiguration()))
+    {
+        AddInput(meshGenerator);
+    }
+    else
+    {
+        PG_LOG('ERR_', "Cannot connect mesh generator to quantize operator since it does not use the full precision editor layout.");
+    }
+}
+
+void QuantizeOperator::AddOperatorInput(const Pegasus::Core::Ref<MeshOperator>& meshOperator)
+{
+    if (IsInputCompatible(meshOperator->GetConfiguration()))
+    {
+        AddInput(meshOperator);
+    }
+    else
+    {
+        PG_LOG('ERR_', "Cannot connect mesh operator to quantize operator since it does not use the full precision editor layout.");
+    }
+}
+
+void QuantizeOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::BEGIN);
+
+    bool updated = false;
+    MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+
+    MeshDataRef meshData = GetData();
+    PG_ASSERT(meshData != nullptr);
+
+    if (inputMesh->GetStreamStride(0) != sizeof(StdVertex))
+    {
+        PG_LOG('ERR_', "Quantize operator input does not use the editor vertex layout, the mesh is left empty.");
+        PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_FAIL);
+        return;
+    }
+
+    const int vertexCount = inputMesh->GetVertexCount();
+    const int indexCount = inputMesh->GetIndexCount();
+    meshData->AllocateVertexes(vertexCount);
+    meshData->AllocateIndexes(indexCount);
+
+    //quantize the vertices in the bounds of the input mesh
+    const StdVertex * inputVertices = inputMesh->GetStream<StdVertex>(0);
+    StdCompactVertex * compactVertices = meshData->GetStream<StdCompactVertex>(0);
+    Math::Vec3 positionOffset;
+    Math::Vec3 positionScale;
+    ComputePositionDecode(inputVertices, vertexCount, positionOffset, positionScale);
+    QuantizeVertices(inputVertices, vertexCount, positionOffset, positionScale, compactVertices);
+    meshData->SetPositionDecode(positionOffset, positionScale);
+
+    //keep the triangles and the levels of detail, the vertices are in the same order
+    if (indexCount > 0)
+    {
+        Utils::Memcpy(meshData->GetIndexBuffer(), inputMesh->GetIndexBuffer(), indexCount * sizeof(unsigned short));
+    }
+    int lodIndexCounts[MESH_MAX_LODS];
+    float lodErrors[MESH_MAX_LODS];
+    for (int lod = 0; lod < inputMesh->GetLodCount(); ++lod)
+    {
+        lodIndexCounts[lod] = inputMesh->GetLodIndexCount(lod);
+        lodErrors[lod] = inputMesh->GetLodError(lod);
+    }
+    meshData->SetLods(lodIndexCounts, lodErrors, inputMesh->GetLodCount());
+
+    //measure the largest position error, to be compared with the mesh size
+    float maxPositionError = 0.0f;
+    for (int v = 0; v < vertexCount; ++v)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            const float decoded = positionOffset.v[c] + (static_cast<float>(compactVertices[v].position[c]) / 65535.0f) * positionScale.v[c];
+            maxPositionError = Math::Max(maxPositionError, Math::Abs(decoded - inputVertices[v].position.v[c]));
+        }
+    }
+
+    const unsigned int inputBytes = static_cast<unsigned int>(vertexCount) * sizeof(StdVertex);
+    const unsigned int compactBytes = static_cast<unsigned int>(vertexCount) * sizeof(StdCompactVertex);
+    PG_LOG('MESH', "Mesh quantized: %d vertices, %u -> %u vertex bytes (%u -> %u bytes per vertex, %.1f%% less bandwidth), max position error %g",
+           vertexCount, inputBytes, compactBytes,
+           static_cast<unsigned int>(sizeof(StdVertex)), static_cast<unsigned int>(sizeof(StdCompactVertex)),
+           100.0f * (1.0f - static_cast<float>(sizeof(StdCompactVertex)) / static_cast<float>(sizeof(StdVertex))),
+           maxPositionError);
+
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
+}
+
+}
+}
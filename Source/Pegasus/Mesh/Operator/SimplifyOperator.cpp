@@ -0,0 +1,93 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   SimplifyOperator.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  SimplifyOperator
+
+#include "Pegasus/Mesh/Operator/SimplifyOperator.h"
+#include "Pegasus/Mesh/MeshSimplifier.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+
+//! Property implementations
+BEGIN_IMPLEMENT_PROPERTIES(SimplifyOperator)
+    IMPLEMENT_PROPERTY(SimplifyOperator, LodCount)
+    IMPLEMENT_PROPERTY(SimplifyOperator, LodRatio)
+END_IMPLEMENT_PROPERTIES(SimplifyOperator)
+
+
+SimplifyOperator::SimplifyOperator(Pegasus::Alloc::IAllocator* nodeAllocator, 
+                                   Pegasus::Alloc::IAllocator* nodeDataAllocator) 
+: MeshOperator(nodeAllocator, nodeDataAllocator)
+{
+    //INIT properties
+    BEGIN_INIT_PROPERTIES(SimplifyOperator)
+        INIT_PROPERTY(LodCount)
+        INIT_PROPERTY(LodRatio)
+    END_INIT_PROPERTIES()
+
+    //each level of detail is reordered for the vertex cache once generated
+    mConfiguration.SetOptimizeVertexCache(true);
+}
+
+SimplifyOperator::~SimplifyOperator()
+{
+}
+
+void SimplifyOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::BEGIN);
+
+    int lodCount = GetLodCount();
+    if (lodCount < 1 || lodCount > MESH_MAX_LODS)
+    {
+        PG_LOG('ERR_', "LodCount not allowed to be below 1 or above %d.", MESH_MAX_LODS);
+        lodCount = MESH_MAX_LODS;
+    }
+    float lodRatio = GetLodRatio();
+    if (lodRatio < 0.05f || lodRatio > 0.95f)
+    {
+        PG_LOG('ERR_', "LodRatio not allowed to be below 0.05 or above 0.95.");
+        lodRatio = 0.5f;
+    }
+
+    bool updated = false;
+    MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+
+    MeshDataRef meshData = GetData();
+    PG_ASSERT(meshData != nullptr); 
+
+    //copy the vertices and the most detailed level of the input mesh
+    const int vertexCount = inputMesh->GetVertexCount();
+    const int indexCount = inputMesh->GetLodIndexCount(0);
+    meshData->AllocateVertexes(vertexCount);
+    meshData->AllocateIndexes(indexCount);
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        const int stride = inputMesh->GetStreamStride(s);
+        if (stride > 0 && vertexCount > 0)
+        {
+            Utils::Memcpy(meshData->GetStream<void>(s), inputMesh->GetStream<void>(s), vertexCount * stride);
+        }
+    }
+    if (indexCount > 0)
+    {
+        Utils::Memcpy(meshData->GetIndexBuffer(), inputMesh->GetIndexBuffer() + inputMesh->GetLodFirstIndex(0), indexCount * sizeof(unsigned short));
+    }
+
+    //append the simplified levels to the index buffer
+    BuildMeshLods(&(*meshData), static_cast<unsigned int>(lodCount), lodRatio, GetNodeDataAllocator());
+
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
+}
+
+}
+}
@@ -0,0 +1,93 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   VertexCacheOperator.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  VertexCacheOperator
+
+#include "Pegasus/Mesh/Operator/VertexCacheOperator.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+
+//! Property implementations
+BEGIN_IMPLEMENT_PROPERTIES(VertexCacheOperator)
+    IMPLEMENT_PROPERTY(VertexCacheOperator, CacheSize)
+    IMPLEMENT_PROPERTY(VertexCacheOperator, SortOverdraw)
+END_IMPLEMENT_PROPERTIES(VertexCacheOperator)
+
+
+VertexCacheOperator::VertexCacheOperator(Pegasus::Alloc::IAllocator* nodeAllocator, 
+                                         Pegasus::Alloc::IAllocator* nodeDataAllocator) 
+: MeshOperator(nodeAllocator, nodeDataAllocator)
+{
+    //INIT properties
+    BEGIN_INIT_PROPERTIES(VertexCacheOperator)
+        INIT_PROPERTY(CacheSize)
+        INIT_PROPERTY(SortOverdraw)
+    END_INIT_PROPERTIES()
+}
+
+VertexCacheOperator::~VertexCacheOperator()
+{
+}
+
+void VertexCacheOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::BEGIN);
+
+    int cacheSize = GetCacheSize();
+    if (cacheSize < 3 || cacheSize > 64)
+    {
+        PG_LOG('ERR_', "CacheSize not allowed to be below 3 or above 64.");
+        cacheSize = VERTEX_CACHE_SIZE;
+    }
+
+    bool updated = false;
+    MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+
+    MeshDataRef meshData = GetData();
+    PG_ASSERT(meshData != nullptr); 
+
+    //copy the input mesh
+    const int vertexCount = inputMesh->GetVertexCount();
+    const int indexCount = inputMesh->GetIndexCount();
+    meshData->AllocateVertexes(vertexCount);
+    meshData->AllocateIndexes(indexCount);
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        const int stride = inputMesh->GetStreamStride(s);
+        if (stride > 0 && vertexCount > 0)
+        {
+            Utils::Memcpy(meshData->GetStream<void>(s), inputMesh->GetStream<void>(s), vertexCount * stride);
+        }
+    }
+    if (indexCount > 0)
+    {
+        Utils::Memcpy(meshData->GetIndexBuffer(), inputMesh->GetIndexBuffer(), indexCount * sizeof(unsigned short));
+    }
+
+    //keep the levels of detail of the input, each one is reordered separately
+    int lodIndexCounts[MESH_MAX_LODS];
+    float lodErrors[MESH_MAX_LODS];
+    for (int lod = 0; lod < inputMesh->GetLodCount(); ++lod)
+    {
+        lodIndexCounts[lod] = inputMesh->GetLodIndexCount(lod);
+        lodErrors[lod] = inputMesh->GetLodError(lod);
+    }
+    meshData->SetLods(lodIndexCounts, lodErrors, inputMesh->GetLodCount());
+
+    //reorder the copy, logging the vertex cache efficiency before and after
+    OptimizeMesh(&(*meshData), static_cast<unsigned int>(cacheSize), GetSortOverdraw(), GetNodeDataAllocator());
+
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
+}
+
+}
+}
@@ -0,0 +1,102 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   WeldOperator.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  WeldOperator
+
+#include "Pegasus/Mesh/Operator/WeldOperator.h"
+#include "Pegasus/Utils/Memcpy.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+
+//! Property implementations
+BEGIN_IMPLEMENT_PROPERTIES(WeldOperator)
+    IMPLEMENT_PROPERTY(WeldOperator, PositionTolerance)
+    IMPLEMENT_PROPERTY(WeldOperator, NormalTolerance)
+    IMPLEMENT_PROPERTY(WeldOperator, UvTolerance)
+END_IMPLEMENT_PROPERTIES(WeldOperator)
+
+
+WeldOperator::WeldOperator(Pegasus::Alloc::IAllocator* nodeAllocator,
+                           Pegasus::Alloc::IAllocator* nodeDataAllocator)
+: MeshOperator(nodeAllocator, nodeDataAllocator)
+{
+    //INIT properties
+    BEGIN_INIT_PROPERTIES(WeldOperator)
+        INIT_PROPERTY(PositionTolerance)
+        INIT_PROPERTY(NormalTolerance)
+        INIT_PROPERTY(UvTolerance)
+    END_INIT_PROPERTIES()
+
+    //the welded vertices are shared by more triangles, reordered once generated
+    mConfiguration.SetOptimizeVertexCache(true);
+}
+
+WeldOperator::~WeldOperator()
+{
+}
+
+void WeldOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::BEGIN);
+
+    float positionTolerance = GetPositionTolerance();
+    float normalTolerance = GetNormalTolerance();
+    float uvTolerance = GetUvTolerance();
+    if (positionTolerance < 0.0f || normalTolerance < 0.0f || uvTolerance < 0.0f)
+    {
+        PG_LOG('ERR_', "Weld tolerances not allowed to be below 0.");
+        positionTolerance = WELD_POSITION_TOLERANCE;
+        normalTolerance = WELD_NORMAL_TOLERANCE;
+        uvTolerance = WELD_UV_TOLERANCE;
+    }
+
+    bool updated = false;
+    MeshDataRef inputMesh = static_cast<MeshData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+
+    MeshDataRef meshData = GetData();
+    PG_ASSERT(meshData != nullptr);
+
+    //copy the input mesh
+    const int vertexCount = inputMesh->GetVertexCount();
+    const int indexCount = inputMesh->GetIndexCount();
+    meshData->AllocateVertexes(vertexCount);
+    meshData->AllocateIndexes(indexCount);
+    for (int s = 0; s < MESH_MAX_STREAMS; ++s)
+    {
+        const int stride = inputMesh->GetStreamStride(s);
+        if (stride > 0 && vertexCount > 0)
+        {
+            Utils::Memcpy(meshData->GetStream<void>(s), inputMesh->GetStream<void>(s), vertexCount * stride);
+        }
+    }
+    if (indexCount > 0)
+    {
+        Utils::Memcpy(meshData->GetIndexBuffer(), inputMesh->GetIndexBuffer(), indexCount * sizeof(unsigned short));
+    }
+
+    //keep the levels of detail of the input, they share the welded vertices
+    int lodIndexCounts[MESH_MAX_LODS];
+    float lodErrors[MESH_MAX_LODS];
+    for (int lod = 0; lod < inputMesh->GetLodCount(); ++lod)
+    {
+        lodIndexCounts[lod] = inputMesh->GetLodIndexCount(lod);
+        lodErrors[lod] = inputMesh->GetLodError(lod);
+    }
+    meshData->SetLods(lodIndexCounts, lodErrors, inputMesh->GetLodCount());
+
+    //weld the copy, logging the vertex count before and after
+    WeldMesh(&(*meshData), positionTolerance, normalTolerance, uvTolerance, GetNodeDataAllocator());
+
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
+}
+
+}
+}
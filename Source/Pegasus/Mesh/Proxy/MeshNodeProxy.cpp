@@ -16,6 +16,31 @@ AssetLib::IRuntimeAssetObjectProxy* MeshNodeProxy::GetDecoratedObject() const
     return mMesh->GetRuntimeAssetObjectProxy();
 }
 
+void MeshNodeProxy::GetBoundingBox(float boxMin[3], float boxMax[3])
+{
+    Math::AxisAlignedBoundingBox box;
+    Math::BoundingSphere sphere;
+    mMesh->GetBounds(box, sphere);
+    for (int c = 0; c < 3; ++c)
+    {
+        boxMin[c] = box.GetMin().v[c];
+        boxMax[c] = box.GetMax().v[c];
+    }
+}
+
+bool MeshNodeProxy::Raycast(const float origin[3], const float direction[3], float & distance, unsigned int & triangle)
+{
+    const Math::Ray ray(Math::Point3(origin[0], origin[1], origin[2]), Math::Vec3(direction[0], direction[1], direction[2]));
+    MeshRayHit hit;
+    if (mMesh->Raycast(ray, PFLOAT_MAX, hit))
+    {
+        distance = hit.mDistance;
+        triangle = hit.mTriangle;
+        return true;
+    }
+    return false;
+}
+
 }
 }
 
@@ -148,6 +148,11 @@ struct DXMeshGPUData
 
     int mIndexCount;
     int mVertexCount;
+
+    // ranges of the index buffer of the levels of detail
+    int mLodCount;
+    int mLodFirstIndex[MESH_MAX_LODS];
+    int mLodIndexCount[MESH_MAX_LODS];
 };
 
 
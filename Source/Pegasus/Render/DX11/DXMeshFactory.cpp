@@ -93,6 +93,7 @@ Pegasus::Render::DXMeshGPUData* DXMeshFactory::GetOrAllocateGPUData(Pegasus::Mes
         meshGpuData->mIsIndirect = false;
         meshGpuData->mVertexCount = 0;
         meshGpuData->mIndexCount = 0;
+        meshGpuData->mLodCount = 0;
 
         for (unsigned i = 0; i < MESH_MAX_STREAMS; ++i)
         {
@@ -223,6 +224,12 @@ void DXMeshFactory::GenerateMeshGPUData(Pegasus::Mesh::MeshData * nodeData)
         }
 
         meshGpuData->mIndexCount = nodeData->GetIndexCount();
+        meshGpuData->mLodCount = nodeData->GetLodCount();
+        for (int lod = 0; lod < nodeData->GetLodCount(); ++lod)
+        {
+            meshGpuData->mLodFirstIndex[lod] = nodeData->GetLodFirstIndex(lod);
+            meshGpuData->mLodIndexCount[lod] = nodeData->GetLodIndexCount(lod);
+        }
         PG_ASSERTSTR( nodeData->GetIndexCount() != 0, "Cannot pass 0 size index buffer. Forgot to call AllocIndices on meshData?");
         if (bufferData.mBuffer == nullptr)
         {
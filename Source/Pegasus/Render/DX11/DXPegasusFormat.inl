@@ -48,7 +48,14 @@ const DXGI_FORMAT gFormatTranslations[Pegasus::Core::FORMAT_MAX_COUNT] =
        DXGI_FORMAT_R8_SINT,              // FORMAT_R8_SINT
        DXGI_FORMAT_R8_UINT,              // FORMAT_R8_UINT
        DXGI_FORMAT_R8_SNORM,             // FORMAT_R8_SNORM
-       DXGI_FORMAT_R8_TYPELESS           // FORMAT_R8_TYPELESS
+       DXGI_FORMAT_R8_TYPELESS,          // FORMAT_R8_TYPELESS
+       DXGI_FORMAT_BC1_UNORM,            // FORMAT_BC1_UNORM
+       DXGI_FORMAT_BC1_UNORM_SRGB,       // FORMAT_BC1_UNORM_SRGB
+       DXGI_FORMAT_BC3_UNORM,            // FORMAT_BC3_UNORM
+       DXGI_FORMAT_BC3_UNORM_SRGB,       // FORMAT_BC3_UNORM_SRGB
+       DXGI_FORMAT_BC5_UNORM,            // FORMAT_BC5_UNORM
+       DXGI_FORMAT_BC7_UNORM,            // FORMAT_BC7_UNORM
+       DXGI_FORMAT_BC7_UNORM_SRGB        // FORMAT_BC7_UNORM_SRGB
 };
 
 DXGI_FORMAT GetDxFormat(Pegasus::Core::Format format)
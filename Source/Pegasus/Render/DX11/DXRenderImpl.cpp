@@ -18,6 +18,7 @@
 #include "Pegasus/Utils/Memcpy.h"
 #include "Pegasus/Utils/Memset.h"
 #include "Pegasus/Utils/String.h"
+#include "Pegasus/Core/Profiler.h"
 #include "../Source/Pegasus/Render/DX11/DXRenderContext.h"
 #include "../Source/Pegasus/Render/DX11/DXGpuDataDefs.h"
 
@@ -52,6 +53,7 @@ struct DXState
     //TODO: implement versioning of mesh
     int mDispatchedMeshVersion;
     Pegasus::Render::DXMeshGPUData    * mDispatchedMeshGpuData;
+    int mDispatchedMeshLod;
     Pegasus::Math::ColorRGBA            mClearColorValue;
     Pegasus::Render::PrimitiveMode      mPrimitiveMode;
     int mTargetsCount;    
@@ -344,9 +346,21 @@ void Pegasus::Render::SetMesh (Pegasus::Mesh::MeshInOut mesh)
             );
         }
         gDXState.mDispatchedMeshGpuData = meshGpuData;
+        gDXState.mDispatchedMeshLod = 0;
     }
 }
 
+void Pegasus::Render::SetMeshLod (unsigned int lod)
+{
+    if (gDXState.mDispatchedMeshGpuData == nullptr)
+    {
+        PG_LOG('ERR_', "A mesh must be set before selecting its level of detail!");
+        return;
+    }
+    const int lodCount = gDXState.mDispatchedMeshGpuData->mLodCount;
+    gDXState.mDispatchedMeshLod = lod < static_cast<unsigned int>(lodCount) ? static_cast<int>(lod) : (lodCount > 0 ? lodCount - 1 : 0);
+}
+
 void Pegasus::Render::UnbindMesh()
 {
     ID3D11DeviceContext * context;
@@ -694,9 +708,9 @@ static void DrawInternal(unsigned int instanceCount)
             if (instanceCount > 0)
             {
                 context->DrawIndexedInstanced(
-                    mesh->mIndexCount,
+                    mesh->mLodIndexCount[gDXState.mDispatchedMeshLod],
                     instanceCount,
-                    0,
+                    mesh->mLodFirstIndex[gDXState.mDispatchedMeshLod],
                     0,
                     0
                 );
@@ -704,8 +718,8 @@ static void DrawInternal(unsigned int instanceCount)
             else
             {
                 context->DrawIndexed(
-                    mesh->mIndexCount,
-                    0,
+                    mesh->mLodIndexCount[gDXState.mDispatchedMeshLod],
+                    mesh->mLodFirstIndex[gDXState.mDispatchedMeshLod],
                     0
                 );
             }
@@ -1364,6 +1378,7 @@ void Pegasus::Render::CleanInternalState()
     gDXState.mDispatchedProgramVersion = 0;
     gDXState.mDispatchedMeshVersion = 0;
     gDXState.mDispatchedMeshGpuData = nullptr;
+    gDXState.mDispatchedMeshLod = 0;
     gDXState.mClearColorValue = Pegasus::Math::ColorRGBA(0.0f,0.0f,0.0f,0.0f);
     gDXState.mDepthClearVal = 1.0f;
     gDXState.mPrimitiveMode = Pegasus::Render::PRIMITIVE_AUTOMATIC;
@@ -1377,6 +1392,7 @@ void Pegasus::Render::CleanInternalState()
 
 void Pegasus::Render::BeginMarker(const char* marker)
 {
+    PG_PROFILE_BEGIN(marker);
 #if PEGASUS_GPU_DEBUG
     Pegasus::Render::DXRenderContext* bindedContext = Pegasus::Render::DXRenderContext::GetBindedContext();
     if (bindedContext != nullptr)
@@ -1395,6 +1411,7 @@ void Pegasus::Render::EndMarker()
         bindedContext->EndMarker();
     }
 #endif
+    PG_PROFILE_END();
 }
 
 #else
@@ -104,7 +104,7 @@ void DXTextureFactory::Get2DConfigTranslation(const Pegasus::Texture::TextureCon
 
     d3dDesc.Width = config.GetWidth();
     d3dDesc.Height = config.GetHeight();
-    d3dDesc.MipLevels = 1;
+    d3dDesc.MipLevels = config.GetNumMipLevels();
     d3dDesc.ArraySize = config.GetNumLayers();
     d3dDesc.Format = GetDxFormat(config.GetPixelFormat());
     d3dDesc.SampleDesc.Count = 1;
@@ -119,13 +119,30 @@ void DXTextureFactory::Get2DConfigTranslation(const Pegasus::Texture::TextureCon
 bool DXTextureFactory::ShouldRebuildTexture(const D3D11_TEXTURE2D_DESC& d3dDesc1, const D3D11_TEXTURE2D_DESC& d3dDesc2)
 {
     return
-    d3dDesc1.Width              != d3dDesc2.Width              &&   
-    d3dDesc1.Height             != d3dDesc2.Height             &&
-    d3dDesc1.MipLevels          != d3dDesc2.MipLevels          &&
-    d3dDesc1.ArraySize          != d3dDesc2.ArraySize          &&
+    d3dDesc1.Width              != d3dDesc2.Width              ||
+    d3dDesc1.Height             != d3dDesc2.Height             ||
+    d3dDesc1.MipLevels          != d3dDesc2.MipLevels          ||
+    d3dDesc1.ArraySize          != d3dDesc2.ArraySize          ||
     d3dDesc1.Format             != d3dDesc2.Format;
 }
 
+//! Get the data uploaded for a mip level, the block compressed copy when the texture data has one
+//! \param nodeData Texture data to upload
+//! \param level Index of the mip level
+//! \param rowPitch Size in bytes of a row of pixels, or of a row of blocks for compressed data (output)
+//! \return Data of the level for the first layer
+static const void * GetUploadedLevelData(const Pegasus::Texture::TextureData * nodeData, unsigned int level, unsigned int & rowPitch)
+{
+    if (nodeData->IsCompressed())
+    {
+        rowPitch = nodeData->GetCompressedRowPitch(level);
+        return nodeData->GetLayerMipCompressedData(0, level);
+    }
+    const Pegasus::Texture::TextureConfiguration& config = nodeData->GetConfiguration();
+    rowPitch = config.GetMipWidth(level) * config.GetNumBytesPerPixel();
+    return nodeData->GetLayerMipImageData(0, level);
+}
+
 void DXTextureFactory::GenerateTextureGPUData(Pegasus::Texture::TextureData * nodeData)
 {
     ID3D11DeviceContext * context;
@@ -138,6 +155,10 @@ void DXTextureFactory::GenerateTextureGPUData(Pegasus::Texture::TextureData * no
 
     D3D11_TEXTURE2D_DESC translation; 
     Get2DConfigTranslation(config, translation);
+    if (nodeData->IsCompressed())
+    {
+        translation.Format = GetDxFormat(nodeData->GetCompressedFormat());
+    }
 	bool doMap = true;
 
 	if (texGpuData->mTexture == nullptr)	
@@ -146,6 +167,13 @@ void DXTextureFactory::GenerateTextureGPUData(Pegasus::Texture::TextureData * no
 		translation.Usage = D3D11_USAGE_IMMUTABLE;
 		translation.CPUAccessFlags = 0;
 	}
+	else if ((translation.MipLevels > 1) || nodeData->IsCompressed())
+	{
+        // Dynamic textures cannot have mip levels, they are updated with UpdateSubresource instead,
+        // which also handles the row pitch of the compressed blocks
+		translation.Usage = D3D11_USAGE_DEFAULT;
+		translation.CPUAccessFlags = 0;
+	}
 	else
 	{
 		translation.Usage = D3D11_USAGE_DYNAMIC;
@@ -159,12 +187,15 @@ void DXTextureFactory::GenerateTextureGPUData(Pegasus::Texture::TextureData * no
         texGpuData->mTexture = nullptr;
         texGpuData->mSrv = nullptr;
 
-        D3D11_SUBRESOURCE_DATA srd; 
-        srd.pSysMem = nodeData->GetLayerImageData(0);
-        srd.SysMemPitch = translation.Width * config.GetNumBytesPerPixel();
-        srd.SysMemSlicePitch = 0;        
+        // One subresource per mip level
+        D3D11_SUBRESOURCE_DATA srd[Pegasus::Texture::TextureConfiguration::MAX_NUM_MIP_LEVELS];
+        for (unsigned int level = 0; level < translation.MipLevels; ++level)
+        {
+            srd[level].pSysMem = GetUploadedLevelData(nodeData, level, srd[level].SysMemPitch);
+            srd[level].SysMemSlicePitch = 0;
+        }
 
-        VALID_DECLARE(device->CreateTexture2D(&translation, &srd, &texGpuData->mTexture));
+        VALID_DECLARE(device->CreateTexture2D(&translation, srd, &texGpuData->mTexture));
         
         D3D11_SHADER_RESOURCE_VIEW_DESC& srvDesc = texGpuData->mSrvDesc;
         srvDesc.Format = translation.Format;
@@ -181,7 +212,17 @@ void DXTextureFactory::GenerateTextureGPUData(Pegasus::Texture::TextureData * no
         );
     }
 
-    if (doMap)
+    if (doMap && (translation.Usage == D3D11_USAGE_DEFAULT))
+    {
+        for (unsigned int level = 0; level < translation.MipLevels; ++level)
+        {
+            unsigned int rowPitch;
+            const void * levelData = GetUploadedLevelData(nodeData, level, rowPitch);
+            context->UpdateSubresource(texGpuData->mTexture, D3D11CalcSubresource(level, 0, translation.MipLevels), nullptr,
+                                       levelData, rowPitch, 0);
+        }
+    }
+    else if (doMap)
     {
         D3D11_MAPPED_SUBRESOURCE mappedResource;
         if (context->Map(texGpuData->mTexture, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource) == S_OK)
@@ -55,6 +55,7 @@ struct OGLTextureGPUData
 {
     PEGASUS_GRAPH_REGISTER_GPUDATA_RTTI(OGLTextureGPUData, 0x3);
     GLuint mHandle;
+    bool mCompressed; //! true when the images were last uploaded block compressed
 };
 
 //! basic internal container class with OpenGL handles for meshes
@@ -67,6 +68,9 @@ struct OGLMeshGPUData
         int  mIndexCount;
         int  mVertexCount;
         GLuint mPrimitive;
+        int  mLodCount;
+        int  mLodFirstIndex[MESH_MAX_LODS];
+        int  mLodIndexCount[MESH_MAX_LODS];
     } mDrawState;
 
     struct VAOEntry {
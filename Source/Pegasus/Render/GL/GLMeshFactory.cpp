@@ -60,6 +60,7 @@ Pegasus::Render::OGLMeshGPUData * GLMeshFactory::AllocateGPUData(Pegasus::Mesh::
     meshGPUData->mDrawState.mIndexCount  = 0;
     meshGPUData->mDrawState.mVertexCount = 0;
     meshGPUData->mDrawState.mPrimitive = GL_TRIANGLES; // defaulting to triangles
+    meshGPUData->mDrawState.mLodCount = 0;
 
     // setting up empty VAO table
     meshGPUData->mVAOTableSize = VAO_TABLE_INCREMENT;
@@ -164,6 +165,12 @@ void GLMeshFactory::GenerateMeshGPUData(Pegasus::Mesh::MeshData * nodeData)
     {
         gpuData->mDrawState.mIsIndexed = true;
         gpuData->mDrawState.mIndexCount = nodeData->GetIndexCount();
+        gpuData->mDrawState.mLodCount = nodeData->GetLodCount();
+        for (int lod = 0; lod < nodeData->GetLodCount(); ++lod)
+        {
+            gpuData->mDrawState.mLodFirstIndex[lod] = nodeData->GetLodFirstIndex(lod);
+            gpuData->mDrawState.mLodIndexCount[lod] = nodeData->GetLodIndexCount(lod);
+        }
         if (gpuData->mIndexBuffer == GL_INVALID_INDEX)
         {
             glGenBuffers(1, &gpuData->mIndexBuffer);
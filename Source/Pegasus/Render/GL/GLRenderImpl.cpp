@@ -33,19 +33,42 @@ struct GLState
 {
     Pegasus::Render::OGLProgramGPUData  * mDispatchedShader;
     Pegasus::Render::OGLMeshGPUData * mDispatchedMeshGPUData;
-} gOGLState  = { nullptr, nullptr };
+    int mDispatchedMeshLod;
+} gOGLState  = { nullptr, nullptr, 0 };
 
 
-// Must match the enum in MeshInputLayout for attribute types
-GLenum gOGLAttrTypeTranslation[Pegasus::Mesh::MeshInputLayout::ATTRTYPE_COUNT] =
+//! Get the layout of a vertex attribute
+//! \param format Format of the attribute
+//! \param componentCount Number of components of the attribute (output)
+//! \param componentType GL type of the components (output)
+//! \param normalized GL_TRUE if the integer components are read as [0,1] or [-1,1] values (output)
+static void GetGLVertexFormat(Pegasus::Core::Format format, GLint & componentCount, GLenum & componentType, GLboolean & normalized)
 {
-    GL_FLOAT,          //FLOAT
-    GL_INT,            //INT
-    GL_UNSIGNED_INT,   //UNSIGNED INT
-    GL_SHORT,          //SHORT
-    GL_UNSIGNED_SHORT, //USHORT
-    GL_UNSIGNED_BYTE   //BOOL    
-};
+    normalized = GL_FALSE;
+    switch (format)
+    {
+        case Pegasus::Core::FORMAT_RGBA_32_FLOAT:   componentCount = 4; componentType = GL_FLOAT;                                   break;
+        case Pegasus::Core::FORMAT_RGB_32_FLOAT:    componentCount = 3; componentType = GL_FLOAT;                                   break;
+        case Pegasus::Core::FORMAT_RG_32_FLOAT:     componentCount = 2; componentType = GL_FLOAT;                                   break;
+        case Pegasus::Core::FORMAT_R32_FLOAT:       componentCount = 1; componentType = GL_FLOAT;                                   break;
+        case Pegasus::Core::FORMAT_RGBA_32_SINT:    componentCount = 4; componentType = GL_INT;                                     break;
+        case Pegasus::Core::FORMAT_RGBA_32_UINT:    componentCount = 4; componentType = GL_UNSIGNED_INT;                            break;
+        case Pegasus::Core::FORMAT_RGBA_16_FLOAT:   componentCount = 4; componentType = GL_HALF_FLOAT;                              break;
+        case Pegasus::Core::FORMAT_RGBA_16_UNORM:   componentCount = 4; componentType = GL_UNSIGNED_SHORT;  normalized = GL_TRUE;   break;
+        case Pegasus::Core::FORMAT_RGBA_16_SNORM:   componentCount = 4; componentType = GL_SHORT;           normalized = GL_TRUE;   break;
+        case Pegasus::Core::FORMAT_RG16_FLOAT:      componentCount = 2; componentType = GL_HALF_FLOAT;                              break;
+        case Pegasus::Core::FORMAT_RG16_UNORM:      componentCount = 2; componentType = GL_UNSIGNED_SHORT;  normalized = GL_TRUE;   break;
+        case Pegasus::Core::FORMAT_RG16_SNORM:      componentCount = 2; componentType = GL_SHORT;           normalized = GL_TRUE;   break;
+        case Pegasus::Core::FORMAT_RGBA_8_UNORM:    componentCount = 4; componentType = GL_UNSIGNED_BYTE;   normalized = GL_TRUE;   break;
+        case Pegasus::Core::FORMAT_RGBA_8_SNORM:    componentCount = 4; componentType = GL_BYTE;            normalized = GL_TRUE;   break;
+
+        default:
+            PG_FAILSTR("Unsupported vertex attribute format (%d)", format);
+            componentCount = 4;
+            componentType = GL_FLOAT;
+            break;
+    }
+}
 
 bool gEnableColorBuffer = false;
 
@@ -138,10 +161,10 @@ void Pegasus::Render::SetMesh (Pegasus::Mesh::MeshInOut mesh)
         //create the VAO commands
         int previousStream = -1;
         int currStreamStride = 0;
-        const Pegasus::Mesh::MeshInputLayout * inputLayout = meshConfig.GetInputLayout();
-        for (int i = 0; i < inputLayout->GetAttributeCount() ; ++i)
+        const Pegasus::Mesh::MeshInputLayout& inputLayout = meshConfig.GetInputLayout();
+        for (int i = 0; i < inputLayout.GetAttributeCount() ; ++i)
         {
-            const Pegasus::Mesh::MeshInputLayout::AttrDesc& attrDesc = inputLayout->GetAttributeDesc(i);
+            const Pegasus::Mesh::MeshInputLayout::AttrDesc& attrDesc = inputLayout.GetAttributeDesc(i);
             if (attrDesc.mStreamIndex != previousStream)
             {
                 PG_ASSERT(meshGPUData->mBufferTable[attrDesc.mStreamIndex] != GL_INVALID_INDEX);
@@ -159,11 +182,15 @@ void Pegasus::Render::SetMesh (Pegasus::Mesh::MeshInOut mesh)
             if (slot != GL_INVALID_INDEX)
             {
                 PG_ASSERT(currStreamStride > 0);
+                GLint componentCount;
+                GLenum componentType;
+                GLboolean normalized;
+                GetGLVertexFormat(attrDesc.mType, componentCount, componentType, normalized);
                 glVertexAttribPointer (
                     slot, 
-                    attrDesc.mAttributeTypeCount, 
-                    gOGLAttrTypeTranslation[attrDesc.mType], 
-                    attrDesc.mIsNormalized ? GL_TRUE : GL_FALSE, 
+                    componentCount, 
+                    componentType, 
+                    normalized, 
                     currStreamStride, 
                     (void*)(attrDesc.mByteOffset)
                 );
@@ -184,6 +211,20 @@ void Pegasus::Render::SetMesh (Pegasus::Mesh::MeshInOut mesh)
     }
 
     gOGLState.mDispatchedMeshGPUData = meshGPUData;
+    gOGLState.mDispatchedMeshLod = 0;
+}
+
+// ---------------------------------------------------------------------------
+
+void Pegasus::Render::SetMeshLod (unsigned int lod)
+{
+    if (gOGLState.mDispatchedMeshGPUData == nullptr)
+    {
+        PG_LOG('ERR_', "A mesh must be set before selecting its level of detail!");
+        return;
+    }
+    const int lodCount = gOGLState.mDispatchedMeshGPUData->mDrawState.mLodCount;
+    gOGLState.mDispatchedMeshLod = lod < static_cast<unsigned int>(lodCount) ? static_cast<int>(lod) : (lodCount > 0 ? lodCount - 1 : 0);
 }
 
 // ---------------------------------------------------------------------------
@@ -444,7 +485,9 @@ void Pegasus::Render::Draw()
     
     if (drawState.mIsIndexed)
     {
-        glDrawElements(drawState.mPrimitive, drawState.mIndexCount, GL_UNSIGNED_SHORT, (void*)0x0);
+        const int lod = gOGLState.mDispatchedMeshLod;
+        glDrawElements(drawState.mPrimitive, drawState.mLodIndexCount[lod], GL_UNSIGNED_SHORT,
+                       reinterpret_cast<void*>(drawState.mLodFirstIndex[lod] * sizeof(unsigned short)));
     }
     else
     {
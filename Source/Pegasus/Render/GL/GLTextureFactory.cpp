@@ -61,6 +61,7 @@ private:
 void GLTextureFactory::AllocateGPUData(Pegasus::Render::OGLTextureGPUData& outputData)
 {
     glGenTextures(1, &outputData.mHandle);
+    outputData.mCompressed = false;
 }
 
 Pegasus::Render::OGLTextureGPUData * GLTextureFactory::AllocateGPUData()
@@ -83,6 +84,58 @@ Pegasus::Render::OGLTextureGPUData * GLTextureFactory::GetGPUData(Pegasus::Textu
     return PEGASUS_GRAPH_GPUDATA_SAFECAST(Pegasus::Render::OGLTextureGPUData, nodeData->GetNodeGPUData());
 }
 
+//! Get the formats of the pixels of a texture
+//! \param format Pixel format of the texture
+//! \param internalFormat GL internal format (output)
+//! \param pixelFormat GL format of the uploaded pixels (output)
+//! \param pixelType GL type of the channels of the uploaded pixels (output)
+static void GetGLPixelFormat(Pegasus::Core::Format format, GLint & internalFormat, GLenum & pixelFormat, GLenum & pixelType)
+{
+    switch (format)
+    {
+        case Pegasus::Core::FORMAT_RGBA_8_UNORM:        internalFormat = GL_RGBA8;          pixelFormat = GL_RGBA;  pixelType = GL_UNSIGNED_BYTE;   break;
+        case Pegasus::Core::FORMAT_RGBA_8_UNORM_SRGB:   internalFormat = GL_SRGB8_ALPHA8;   pixelFormat = GL_RGBA;  pixelType = GL_UNSIGNED_BYTE;   break;
+        case Pegasus::Core::FORMAT_RGBA_16_UNORM:       internalFormat = GL_RGBA16;         pixelFormat = GL_RGBA;  pixelType = GL_UNSIGNED_SHORT;  break;
+        case Pegasus::Core::FORMAT_RGBA_16_FLOAT:       internalFormat = GL_RGBA16F;        pixelFormat = GL_RGBA;  pixelType = GL_HALF_FLOAT;      break;
+        case Pegasus::Core::FORMAT_RGBA_32_FLOAT:       internalFormat = GL_RGBA32F;        pixelFormat = GL_RGBA;  pixelType = GL_FLOAT;           break;
+        case Pegasus::Core::FORMAT_RGB_32_FLOAT:        internalFormat = GL_RGB32F;         pixelFormat = GL_RGB;   pixelType = GL_FLOAT;           break;
+        case Pegasus::Core::FORMAT_RG_32_FLOAT:         internalFormat = GL_RG32F;          pixelFormat = GL_RG;    pixelType = GL_FLOAT;           break;
+        case Pegasus::Core::FORMAT_RG16_FLOAT:          internalFormat = GL_RG16F;          pixelFormat = GL_RG;    pixelType = GL_HALF_FLOAT;      break;
+        case Pegasus::Core::FORMAT_R32_FLOAT:           internalFormat = GL_R32F;           pixelFormat = GL_RED;   pixelType = GL_FLOAT;           break;
+        case Pegasus::Core::FORMAT_R16_FLOAT:           internalFormat = GL_R16F;           pixelFormat = GL_RED;   pixelType = GL_HALF_FLOAT;      break;
+        case Pegasus::Core::FORMAT_R16_UNORM:           internalFormat = GL_R16;            pixelFormat = GL_RED;   pixelType = GL_UNSIGNED_SHORT;  break;
+        case Pegasus::Core::FORMAT_R8_UNORM:            internalFormat = GL_R8;             pixelFormat = GL_RED;   pixelType = GL_UNSIGNED_BYTE;   break;
+
+        default:
+            PG_FAILSTR("Unsupported texture pixel format (%d)", format);
+            internalFormat = GL_RGBA8;
+            pixelFormat = GL_RGBA;
+            pixelType = GL_UNSIGNED_BYTE;
+            break;
+    }
+}
+
+//! Get the internal format of a block compressed texture
+//! \param format Block compressed format
+//! \return GL internal format
+static GLenum GetGLCompressedFormat(Pegasus::Core::Format format)
+{
+    switch (format)
+    {
+        case Pegasus::Core::FORMAT_BC1_UNORM:       return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+        case Pegasus::Core::FORMAT_BC1_UNORM_SRGB:  return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT1_EXT;
+        case Pegasus::Core::FORMAT_BC3_UNORM:       return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case Pegasus::Core::FORMAT_BC3_UNORM_SRGB:  return GL_COMPRESSED_SRGB_ALPHA_S3TC_DXT5_EXT;
+        case Pegasus::Core::FORMAT_BC5_UNORM:       return GL_COMPRESSED_RG_RGTC2;
+        case Pegasus::Core::FORMAT_BC7_UNORM:       return GL_COMPRESSED_RGBA_BPTC_UNORM;
+        case Pegasus::Core::FORMAT_BC7_UNORM_SRGB:  return GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
+
+        default:
+            PG_FAILSTR("Invalid block compressed format (%d)", format);
+            return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+    }
+}
+
 void GLTextureFactory::GenerateTextureGPUData(Pegasus::Texture::TextureData * nodeData)
 {
     Pegasus::Render::OGLTextureGPUData * gpuData = nullptr;
@@ -103,46 +156,72 @@ void GLTextureFactory::GenerateTextureGPUData(Pegasus::Texture::TextureData * no
     glBindTexture(GL_TEXTURE_2D, gpuData->mHandle);
 
     const Pegasus::Texture::TextureConfiguration& texConfig = nodeData->GetConfiguration();
-    const unsigned char * texData = nodeData->GetLayerImageData(0);
 
-    static const GLint GLPixelFormatTranslation[Pegasus::Texture::TextureConfiguration::NUM_PIXELFORMATS] =
-    {
-        GL_RGBA
-    };
+    GLint internalFormat;
+    GLenum pixelFormat, pixelType;
+    GetGLPixelFormat(texConfig.GetPixelFormat(), internalFormat, pixelFormat, pixelType);
 
     //! \todo Support all texture types
     PG_ASSERTSTR(texConfig.GetType() == Pegasus::Texture::TextureConfiguration::TYPE_2D,
                  "Unsupported texture format. Only 2D textures are supported for the moment");
 
-    if (newlyAllocated)
-    {
-        glTexImage2D(
-            GL_TEXTURE_2D,
-            0, 
-            GLPixelFormatTranslation[texConfig.GetPixelFormat()],
-            texConfig.GetWidth(),
-            texConfig.GetHeight(),
-            0,
-            GLPixelFormatTranslation[texConfig.GetPixelFormat()],
-            GL_UNSIGNED_BYTE,
-            texData);
-    }
-    else
+    // The rows of the single channel formats are not aligned to 4 bytes
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    // One image per mip level
+    const unsigned int numMipLevels = texConfig.GetNumMipLevels();
+    for (unsigned int level = 0; level < numMipLevels; ++level)
     {
-        glTexSubImage2D(
-            GL_TEXTURE_2D,
-            0,
-            0,
-            0,
-            texConfig.GetWidth(),
-            texConfig.GetHeight(),
-            GLPixelFormatTranslation[texConfig.GetPixelFormat()],
-            GL_UNSIGNED_BYTE,
-            texData);
+        // Compressed images are specified again on every upload, the format may have changed
+        if (nodeData->IsCompressed())
+        {
+            glCompressedTexImage2D(
+                GL_TEXTURE_2D,
+                level,
+                GetGLCompressedFormat(nodeData->GetCompressedFormat()),
+                texConfig.GetMipWidth(level),
+                texConfig.GetMipHeight(level),
+                0,
+                nodeData->GetCompressedLevelSize(level),
+                nodeData->GetLayerMipCompressedData(0, level));
+            continue;
+        }
+
+        const unsigned char * texData = nodeData->GetLayerMipImageData(0, level);
+        if (newlyAllocated || gpuData->mCompressed)
+        {
+            glTexImage2D(
+                GL_TEXTURE_2D,
+                level, 
+                internalFormat,
+                texConfig.GetMipWidth(level),
+                texConfig.GetMipHeight(level),
+                0,
+                pixelFormat,
+                pixelType,
+                texData);
+        }
+        else
+        {
+            glTexSubImage2D(
+                GL_TEXTURE_2D,
+                level,
+                0,
+                0,
+                texConfig.GetMipWidth(level),
+                texConfig.GetMipHeight(level),
+                pixelFormat,
+                pixelType,
+                texData);
+        }
     }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
-    // Default filter
-    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    gpuData->mCompressed = nodeData->IsCompressed();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, numMipLevels - 1);
+
+    // Default filter, trilinear when the mip levels are available
+    glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, (numMipLevels > 1) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
     glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
     glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
     glTexParameterf(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
@@ -15,6 +15,7 @@
 #include "Pegasus/Mesh/MeshManager.h"
 #include "Pegasus/RenderSystems/3dTerrain/MarchingCubeMeshGenerator.h"
 #include "Pegasus/RenderSystems/3dTerrain/Terrain3dGenerator.h"
+#include "Pegasus/RenderSystems/3dTerrain/Terrain3dCpuGenerator.h"
 #include "Pegasus/RenderSystems/3dTerrain/Terrain3d.h"
 #include "Pegasus/Core/IApplicationContext.h"
 #include "Pegasus/Core/Formats.h"
@@ -216,6 +217,7 @@ void Terrain3dSystem::OnRegisterCustomMeshNodes(Pegasus::Mesh::MeshManager* mesh
 {
     meshManager->RegisterMeshNode("MarchingCubeMeshGenerator", MarchingCubeMeshGenerator::CreateNode);
     meshManager->RegisterMeshNode("Terrain3dGenerator", Terrain3dGenerator::CreateNode);
+    meshManager->RegisterMeshNode("Terrain3dCpuGenerator", Terrain3dCpuGenerator::CreateNode);
 }
 
 #if PEGASUS_ENABLE_PROXIES
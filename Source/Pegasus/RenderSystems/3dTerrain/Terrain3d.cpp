@@ -20,6 +20,7 @@
 #include "Pegasus/Window/Window.h"
 #include "Pegasus/BlockScript/BsVm.h"
 #include "Pegasus/Timeline/Timeline.h"
+#include "Pegasus/Core/Profiler.h"
 
 
 using namespace Pegasus;
@@ -80,6 +81,7 @@ void Terrain3d::AllocateMeshBatch()
 
 void Terrain3d::Generate(unsigned int windowWidth, unsigned int windowHeight)
 {
+    PG_PROFILE_SCOPE("Terrain3d::Generate");
     static float sTerrainSeed = 0.0f;
     GenerateCullingData(windowWidth,windowHeight);
 
@@ -0,0 +1,78 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Terrain3dCpuGenerator.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Terrain mesh generator running the meshing on the CPU.
+
+#include "Pegasus/RenderSystems/3dTerrain/Terrain3dCpuGenerator.h"
+
+#if RENDER_SYSTEM_CONFIG_ENABLE_3DTERRAIN
+
+#include "Pegasus/RenderSystems/3dTerrain/3dTerrainSystem.h"
+#include "Pegasus/RenderSystems/3dTerrain/Terrain3dCpuMesher.h"
+#include "Pegasus/Mesh/Shared/MeshEvent.h"
+#include "Pegasus/Allocator/IAllocator.h"
+
+using namespace Pegasus;
+using namespace Pegasus::Mesh;
+using namespace Pegasus::RenderSystems;
+using namespace Pegasus::Math;
+
+extern RenderSystems::Terrain3dSystem* g3dTerrainSystemInstance;
+
+
+BEGIN_IMPLEMENT_PROPERTIES(Terrain3dCpuGenerator)
+    IMPLEMENT_PROPERTY(Terrain3dCpuGenerator, WorldOffset)
+    IMPLEMENT_PROPERTY(Terrain3dCpuGenerator, WorldScale)
+    IMPLEMENT_PROPERTY(Terrain3dCpuGenerator, ThreadCount)
+END_IMPLEMENT_PROPERTIES(Terrain3dCpuGenerator)
+
+Terrain3dCpuGenerator::Terrain3dCpuGenerator(Pegasus::Alloc::IAllocator* nodeAllocator,
+                          Pegasus::Alloc::IAllocator* nodeDataAllocator) : MeshGenerator(nodeAllocator, nodeDataAllocator)
+{
+    BEGIN_INIT_PROPERTIES(Terrain3dCpuGenerator)
+        INIT_PROPERTY(WorldOffset)
+        INIT_PROPERTY(WorldScale)
+        INIT_PROPERTY(ThreadCount)
+    END_INIT_PROPERTIES()
+
+    mConfiguration.SetIsIndexed(true);
+    mConfiguration.SetMeshPrimitiveType(MeshConfiguration::TRIANGLE);
+}
+
+Terrain3dCpuGenerator::~Terrain3dCpuGenerator()
+{
+}
+
+void Terrain3dCpuGenerator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::BEGIN);
+
+    if (GetWorldScale() <= 0.0f)
+    {
+        PG_LOG('ERR_', "Terrain3dCpuGenerator world scale must be above 0.");
+        PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_FAIL);
+        return;
+    }
+
+    Terrain3dCpuMesher::Segment segment;
+    segment.worldOffset = GetWorldOffset();
+    segment.worldScale = GetWorldScale();
+
+    MeshDataRef meshData = GetData();
+    Mesh::MeshData* meshDataPtr = &(*meshData);
+    Terrain3dCpuMesher mesher(GetNodeDataAllocator(), g3dTerrainSystemInstance->GetCaseTable());
+    mesher.GenerateSegments(&segment, 1, &meshDataPtr, static_cast<unsigned int>(GetThreadCount() < 0 ? 0 : GetThreadCount()));
+
+    PEGASUS_EVENT_DISPATCH(this, MeshOperationEvent, MeshOperationEvent::END_SUCCESS);
+}
+
+
+#else
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+#endif
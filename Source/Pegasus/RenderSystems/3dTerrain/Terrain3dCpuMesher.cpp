@@ -0,0 +1,614 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Terrain3dCpuMesher.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  CPU implementation of the 3d terrain meshing (density, marching cubes and mesh output)
+
+#include "Pegasus/RenderSystems/3dTerrain/Terrain3dCpuMesher.h"
+
+#if RENDER_SYSTEM_CONFIG_ENABLE_3DTERRAIN
+
+#include "Pegasus/RenderSystems/3dTerrain/3dTerrainSystem.h"
+#include "Pegasus/RenderSystems/3dTerrain/Terrain3d.h"
+#include "Pegasus/RenderSystems/3dTerrain/CaseTable.h"
+#include "Pegasus/Mesh/MeshData.h"
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Math/Scalar.h"
+#include "Pegasus/Core/Thread.h"
+#include "Pegasus/Core/Profiler.h"
+#include "Pegasus/Core/Time.h"
+
+#if PEGASUS_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+using namespace Pegasus;
+using namespace Pegasus::Mesh;
+using namespace Pegasus::RenderSystems;
+using namespace Pegasus::Math;
+
+namespace Internal
+{
+
+//! Cells of a segment per axis
+static const int CELL_DIM = Terrain3dSystem::THREAD_DIM;
+
+//! Corners of the cells of a segment per axis, each one owning the vertices of 3 edges
+static const int POINT_DIM = CELL_DIM + 1;
+
+//! Density samples per axis: the corners, one more on each side for the gradient normals, like the density texture
+static const int SAMPLE_DIM = CELL_DIM + 3;
+
+//! Blocks of a segment, the units of work of the passes
+static const int BLOCKS_PER_SEGMENT = Terrain3dSystem::GROUP_DIM * Terrain3dSystem::GROUP_DIM * Terrain3dSystem::GROUP_DIM;
+
+//! Maximum number of segments meshed at once, bounding the working memory (about 60 KB per segment)
+static const unsigned int SEGMENTS_PER_BATCH = 64;
+
+//! Density of the surface, same as MID_POINT in terrainCommon.h
+static const float MID_POINT = 0.5f;
+
+//! Corners of a cell, same order as the case signatures of geomInfo.cs
+static const int sCubePos[8][3] =
+{
+    { 0, 0, 0 },
+    { 1, 0, 0 },
+    { 1, 1, 0 },
+    { 0, 1, 0 },
+    { 0, 0, 1 },
+    { 1, 0, 1 },
+    { 1, 1, 1 },
+    { 0, 1, 1 }
+};
+
+//! Corners of the edges of a cell, same as the case table
+static const int sEdgeConnections[12][2] =
+{
+    { 0, 1 }, { 1, 2 }, { 2, 3 }, { 3, 0 },
+    { 4, 5 }, { 5, 6 }, { 6, 7 }, { 7, 4 },
+    { 4, 0 }, { 5, 1 }, { 6, 2 }, { 7, 3 }
+};
+
+//! Edges owned by a corner, the vertex of edge sOwnedEdges[k] of the cell at a corner being the vertex k of the corner
+static const int sOwnedEdges[3] = { 0, 3, 8 };
+
+//! Corner owning each edge of a cell (offset from the cell) and vertex of the edge in that corner, same as meshProducer.cs
+static const int sEdgeRemap[12][4] =
+{
+    { 0, 0, 0, 0 },
+    { 1, 0, 0, 1 },
+    { 0, 1, 0, 0 },
+    { 0, 0, 0, 1 },
+    { 0, 0, 1, 0 },
+    { 1, 0, 1, 1 },
+    { 0, 1, 1, 0 },
+    { 0, 0, 1, 1 },
+    { 0, 0, 0, 2 },
+    { 1, 0, 0, 2 },
+    { 1, 1, 0, 2 },
+    { 0, 1, 0, 2 }
+};
+
+//----------------------------------------------------------------------------------------
+
+// 4 densities evaluated at once
+
+#if PEGASUS_SIMD_SSE2
+
+typedef __m128 Float4;
+
+inline Float4 SetF(float v)                             { return _mm_set1_ps(v); }
+inline Float4 LoadF(const float * src)                  { return _mm_loadu_ps(src); }
+inline void StoreF(float * dst, Float4 a)               { _mm_storeu_ps(dst, a); }
+inline Float4 AddF(Float4 a, Float4 b)                  { return _mm_add_ps(a, b); }
+inline Float4 SubF(Float4 a, Float4 b)                  { return _mm_sub_ps(a, b); }
+inline Float4 MulF(Float4 a, Float4 b)                  { return _mm_mul_ps(a, b); }
+inline Float4 MinF(Float4 a, Float4 b)                  { return _mm_min_ps(a, b); }
+inline Float4 MaxF(Float4 a, Float4 b)                  { return _mm_max_ps(a, b); }
+inline Float4 RoundF(Float4 a)                          { return _mm_cvtepi32_ps(_mm_cvtps_epi32(a)); }
+
+#else
+
+struct Float4 { float v[4]; };
+
+#define PEGASUS_TERRAIN_FLOAT4_OP(expression) Float4 r; for (unsigned int i = 0; i < 4; ++i) { r.v[i] = (expression); } return r;
+
+inline Float4 SetF(float v)                             { PEGASUS_TERRAIN_FLOAT4_OP(v) }
+inline Float4 LoadF(const float * src)                  { PEGASUS_TERRAIN_FLOAT4_OP(src[i]) }
+inline void StoreF(float * dst, Float4 a)               { for (unsigned int i = 0; i < 4; ++i) { dst[i] = a.v[i]; } }
+inline Float4 AddF(Float4 a, Float4 b)                  { PEGASUS_TERRAIN_FLOAT4_OP(a.v[i] + b.v[i]) }
+inline Float4 SubF(Float4 a, Float4 b)                  { PEGASUS_TERRAIN_FLOAT4_OP(a.v[i] - b.v[i]) }
+inline Float4 MulF(Float4 a, Float4 b)                  { PEGASUS_TERRAIN_FLOAT4_OP(a.v[i] * b.v[i]) }
+inline Float4 MinF(Float4 a, Float4 b)                  { PEGASUS_TERRAIN_FLOAT4_OP((a.v[i] < b.v[i]) ? a.v[i] : b.v[i]) }
+inline Float4 MaxF(Float4 a, Float4 b)                  { PEGASUS_TERRAIN_FLOAT4_OP((a.v[i] > b.v[i]) ? a.v[i] : b.v[i]) }
+inline Float4 RoundF(Float4 a)                          { PEGASUS_TERRAIN_FLOAT4_OP(Math::Floor(a.v[i] + 0.5f)) }
+
+#undef PEGASUS_TERRAIN_FLOAT4_OP
+
+#endif  // PEGASUS_SIMD_SSE2
+
+//! Sine of 4 angles. The angles are reduced to [-pi, pi] then folded to [-pi/2, pi/2]
+//! where a polynomial of degree 11 is accurate to about 1e-7
+inline Float4 SinF(Float4 angle)
+{
+    // 2 pi split in an exact high part and a low part, so the reduction stays accurate for large angles
+    const Float4 turns = RoundF(MulF(angle, SetF(0.15915494309f)));
+    Float4 r = SubF(angle, MulF(turns, SetF(6.28125f)));
+    r = SubF(r, MulF(turns, SetF(0.0019353071795864769f)));
+
+    // sin(r) = sin(pi - r) = sin(-pi - r)
+    r = MinF(r, SubF(SetF(P_PI), r));
+    r = MaxF(r, SubF(SetF(-P_PI), r));
+
+    const Float4 r2 = MulF(r, r);
+    Float4 p = SetF(-2.5052108385e-8f);
+    p = AddF(MulF(p, r2), SetF(2.7557319224e-6f));
+    p = AddF(MulF(p, r2), SetF(-1.9841269841e-4f));
+    p = AddF(MulF(p, r2), SetF(8.3333333333e-3f));
+    p = AddF(MulF(p, r2), SetF(-1.6666666667e-1f));
+    p = AddF(MulF(p, r2), SetF(1.0f));
+    return MulF(p, r);
+}
+
+//! Density function of density3d.cs, for 4 points
+inline Float4 DensityF(Float4 x, Float4 y, Float4 z)
+{
+    const Float4 half = SetF(0.5f);
+    Float4 displacedY = AddF(y, SinF(AddF(MulF(half, x), SetF(P_PI * 0.5f))));
+    displacedY = AddF(displacedY, SinF(MulF(half, z)));
+    displacedY = SubF(displacedY, SinF(SubF(MulF(y, y), x)));
+    displacedY = AddF(displacedY, SinF(MulF(z, z)));
+    return SubF(SetF(3.0f), displacedY);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Index of a density sample
+inline int SampleIndex(int x, int y, int z)
+{
+    return (z * SAMPLE_DIM + y) * SAMPLE_DIM + x;
+}
+
+//! Index of a corner
+inline int PointIndex(int x, int y, int z)
+{
+    return (z * POINT_DIM + y) * POINT_DIM + x;
+}
+
+//! Density at a corner, the corners starting at the second sample
+inline float PointDensity(const float* densities, int x, int y, int z)
+{
+    return densities[SampleIndex(x + 1, y + 1, z + 1)];
+}
+
+//! Range of density samples computed by a block along an axis, the last block taking the extra samples
+inline void GetBlockSampleRange(int block, int& begin, int& end)
+{
+    begin = block * Terrain3dSystem::BLOCK_DIM;
+    end = (block == Terrain3dSystem::GROUP_DIM - 1) ? SAMPLE_DIM : begin + Terrain3dSystem::BLOCK_DIM;
+}
+
+//! Range of corners owned by a block along an axis, the last block owning the corners of the far side
+inline void GetBlockPointRange(int block, int& begin, int& end)
+{
+    begin = block * Terrain3dSystem::BLOCK_DIM;
+    end = (block == Terrain3dSystem::GROUP_DIM - 1) ? POINT_DIM : begin + Terrain3dSystem::BLOCK_DIM;
+}
+
+//! Block owning a corner along an axis
+inline int GetPointBlock(int point)
+{
+    const int block = point / Terrain3dSystem::BLOCK_DIM;
+    return (block < Terrain3dSystem::GROUP_DIM) ? block : Terrain3dSystem::GROUP_DIM - 1;
+}
+
+//! Block coordinates of a block index
+inline void GetBlockCoords(unsigned int blockIndex, int blockCoords[3])
+{
+    blockCoords[0] = static_cast<int>(blockIndex % Terrain3dSystem::GROUP_DIM);
+    blockCoords[1] = static_cast<int>((blockIndex / Terrain3dSystem::GROUP_DIM) % Terrain3dSystem::GROUP_DIM);
+    blockCoords[2] = static_cast<int>(blockIndex / (Terrain3dSystem::GROUP_DIM * Terrain3dSystem::GROUP_DIM));
+}
+
+//! Case signature of the cell at a corner, a bit being set for each corner inside the terrain
+inline unsigned int ComputeCaseId(const float* densities, int x, int y, int z)
+{
+    unsigned int caseId = 0;
+    for (unsigned int s = 0; s < 8; ++s)
+    {
+        const float density = PointDensity(densities, x + sCubePos[s][0], y + sCubePos[s][1], z + sCubePos[s][2]);
+        caseId |= ((density > MID_POINT) ? 1u : 0u) << s;
+    }
+    return caseId;
+}
+
+//! Vertices of a corner, a bit k being set when the edge sOwnedEdges[k] is crossed by the surface.
+//! Unlike meshProducer.cs, the edges leaving the segment are skipped since no triangle uses them
+//! \param countInfo Packed case count info of the cell at the corner
+//! \param x X coordinate of the corner
+//! \param y Y coordinate of the corner
+//! \param z Z coordinate of the corner
+inline unsigned int GetPointVertexMask(unsigned int countInfo, int x, int y, int z)
+{
+    const int coords[3] = { x, y, z };
+    unsigned int mask = 0;
+    for (int k = 0; k < 3; ++k)
+    {
+        //the edges 0, 3 and 8 go along x, y and z
+        if (((countInfo >> sOwnedEdges[k]) & 0x1) && coords[k] < CELL_DIM)
+        {
+            mask |= 1u << k;
+        }
+    }
+    return mask;
+}
+
+//! Trilinear sample of the densities, like the bilinear sampler of meshProducer.cs
+//! \param densities Density samples of the segment
+//! \param coords Coordinates in samples, clamped to the volume
+inline float SampleDensity(const float* densities, const Vec3& coords)
+{
+    int i0[3];
+    float t[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        const float coord = Clamp(coords.v[c], 0.0f, static_cast<float>(SAMPLE_DIM - 1));
+        i0[c] = Min(static_cast<int>(coord), SAMPLE_DIM - 2);
+        t[c] = coord - static_cast<float>(i0[c]);
+    }
+
+    const float* s = densities + SampleIndex(i0[0], i0[1], i0[2]);
+    const int dy = SAMPLE_DIM;
+    const int dz = SAMPLE_DIM * SAMPLE_DIM;
+    const float x00 = Lerp(s[0],           s[1],           t[0]);
+    const float x10 = Lerp(s[dy],          s[dy + 1],      t[0]);
+    const float x01 = Lerp(s[dz],          s[dz + 1],      t[0]);
+    const float x11 = Lerp(s[dz + dy],     s[dz + dy + 1], t[0]);
+    return Lerp(Lerp(x00, x10, t[1]), Lerp(x01, x11, t[1]), t[2]);
+}
+
+}   // namespace Internal
+
+//----------------------------------------------------------------------------------------
+
+//! Working data of a segment
+struct Terrain3dCpuMesher::SegmentContext
+{
+    Segment mSegment;
+    MeshData* mMesh;
+
+    float* mDensities;                  //!< Density samples (SAMPLE_DIM^3)
+    unsigned char* mPointCases;         //!< Case signature of the cell at each corner (POINT_DIM^3)
+    unsigned short* mVertexSlots;       //!< Index of the vertices of each corner in the vertices of its block (POINT_DIM^3 * 3)
+
+    unsigned int mBlockVertexCounts[Internal::BLOCKS_PER_SEGMENT];
+    unsigned int mBlockIndexCounts[Internal::BLOCKS_PER_SEGMENT];
+    unsigned int mBlockVertexOffsets[Internal::BLOCKS_PER_SEGMENT];
+    unsigned int mBlockIndexOffsets[Internal::BLOCKS_PER_SEGMENT];
+
+    StdVertex* mVertices;               //!< Vertices of the mesh data
+    unsigned short* mIndices;           //!< Indices of the mesh data
+};
+
+//! Data shared by the jobs of a batch, each job being a block of a segment
+struct Terrain3dCpuMesher::BatchContext
+{
+    const CaseTable* mCaseTable;
+    SegmentContext* mSegments;
+};
+
+//----------------------------------------------------------------------------------------
+
+Terrain3dCpuMesher::Terrain3dCpuMesher(Alloc::IAllocator* allocator, const CaseTable* caseTable)
+:   mAllocator(allocator),
+    mCaseTable(caseTable)
+{
+    PG_ASSERTSTR(allocator != nullptr, "Invalid allocator for the terrain mesher");
+    PG_ASSERTSTR(caseTable != nullptr, "Invalid case table for the terrain mesher");
+    PG_ASSERTSTR(Internal::CELL_DIM == Terrain3d::SEGMENT_UNIT_SIZE, "The terrain mesher assumes a segment is processed in one dispatch");
+}
+
+//----------------------------------------------------------------------------------------
+
+void Terrain3dCpuMesher::ComputeDensity4(const float x[4], const float y[4], const float z[4], float densities[4])
+{
+    Internal::StoreF(densities, Internal::DensityF(Internal::LoadF(x), Internal::LoadF(y), Internal::LoadF(z)));
+}
+
+//----------------------------------------------------------------------------------------
+
+void Terrain3dCpuMesher::DensityJob(void* userData, unsigned int jobIndex, unsigned int workerIndex)
+{
+    using namespace Internal;
+    BatchContext* batch = static_cast<BatchContext*>(userData);
+    SegmentContext& context = batch->mSegments[jobIndex / BLOCKS_PER_SEGMENT];
+    int blockCoords[3];
+    GetBlockCoords(jobIndex % BLOCKS_PER_SEGMENT, blockCoords);
+    int begin[3], end[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        GetBlockSampleRange(blockCoords[c], begin[c], end[c]);
+    }
+
+    //the sample s is the corner s - 1, like density3d.cs
+    const float scale = context.mSegment.worldScale;
+    const Vec3& offset = context.mSegment.worldOffset;
+    const Float4 scale4 = SetF(scale);
+    const Float4 zero = SetF(0.0f);
+    const Float4 one = SetF(1.0f);
+    float rowX[4];
+    float rowDensities[4];
+    for (int z = begin[2]; z < end[2]; ++z)
+    {
+        const Float4 worldZ = SetF(offset.v[2] + static_cast<float>(z - 1) * scale);
+        for (int y = begin[1]; y < end[1]; ++y)
+        {
+            const Float4 worldY = SetF(offset.v[1] + static_cast<float>(y - 1) * scale);
+            float* row = context.mDensities + SampleIndex(0, y, z);
+            for (int x = begin[0]; x < end[0]; x += 4)
+            {
+                for (int i = 0; i < 4; ++i)
+                {
+                    rowX[i] = offset.v[0] + static_cast<float>(x + i - 1) * scale;
+                }
+
+                //the densities are scaled by the cell size and saturated, like the density texture
+                const Float4 density = MinF(MaxF(MulF(scale4, DensityF(LoadF(rowX), worldY, worldZ)), zero), one);
+                if (x + 4 <= end[0])
+                {
+                    StoreF(row + x, density);
+                }
+                else
+                {
+                    StoreF(rowDensities, density);
+                    for (int i = 0; x + i < end[0]; ++i)
+                    {
+                        row[x + i] = rowDensities[i];
+                    }
+                }
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Terrain3dCpuMesher::CountJob(void* userData, unsigned int jobIndex, unsigned int workerIndex)
+{
+    using namespace Internal;
+    BatchContext* batch = static_cast<BatchContext*>(userData);
+    SegmentContext& context = batch->mSegments[jobIndex / BLOCKS_PER_SEGMENT];
+    const unsigned int blockIndex = jobIndex % BLOCKS_PER_SEGMENT;
+    int blockCoords[3];
+    GetBlockCoords(blockIndex, blockCoords);
+    int begin[3], end[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        GetBlockPointRange(blockCoords[c], begin[c], end[c]);
+    }
+
+    //case of each corner and vertices of its edges, like geomInfo.cs, the sparse offsets being the counts of the blocks
+    const unsigned int* caseCountInfo = batch->mCaseTable->GetPackedCaseCountInfoBuffer();
+    unsigned int vertexCount = 0;
+    unsigned int indexCount = 0;
+    for (int z = begin[2]; z < end[2]; ++z)
+    {
+        for (int y = begin[1]; y < end[1]; ++y)
+        {
+            for (int x = begin[0]; x < end[0]; ++x)
+            {
+                const unsigned int caseId = ComputeCaseId(context.mDensities, x, y, z);
+                const int pointIndex = PointIndex(x, y, z);
+                context.mPointCases[pointIndex] = static_cast<unsigned char>(caseId);
+
+                //the corners of the far side only exist for the vertices of their edges, their cell is outside the segment
+                const unsigned int countInfo = caseCountInfo[caseId];
+                if (x < CELL_DIM && y < CELL_DIM && z < CELL_DIM)
+                {
+                    indexCount += (countInfo >> 16) * 3;
+                }
+                const unsigned int vertexMask = GetPointVertexMask(countInfo, x, y, z);
+                for (int k = 0; k < 3; ++k)
+                {
+                    if (vertexMask & (1u << k))
+                    {
+                        context.mVertexSlots[pointIndex * 3 + k] = static_cast<unsigned short>(vertexCount++);
+                    }
+                }
+            }
+        }
+    }
+
+    context.mBlockVertexCounts[blockIndex] = vertexCount;
+    context.mBlockIndexCounts[blockIndex] = indexCount;
+}
+
+//----------------------------------------------------------------------------------------
+
+void Terrain3dCpuMesher::OutputJob(void* userData, unsigned int jobIndex, unsigned int workerIndex)
+{
+    using namespace Internal;
+    BatchContext* batch = static_cast<BatchContext*>(userData);
+    SegmentContext& context = batch->mSegments[jobIndex / BLOCKS_PER_SEGMENT];
+    const unsigned int blockIndex = jobIndex % BLOCKS_PER_SEGMENT;
+    int blockCoords[3];
+    GetBlockCoords(blockIndex, blockCoords);
+    int begin[3], end[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        GetBlockPointRange(blockCoords[c], begin[c], end[c]);
+    }
+
+    const unsigned int* caseCountInfo = batch->mCaseTable->GetPackedCaseCountInfoBuffer();
+    const float scale = context.mSegment.worldScale;
+    const Vec3& offset = context.mSegment.worldOffset;
+
+    //vertices of the owned corners, in the order of their slots, like WriteVertexes and WriteNormals of meshProducer.cs
+    StdVertex* vertex = context.mVertices + context.mBlockVertexOffsets[blockIndex];
+    for (int z = begin[2]; z < end[2]; ++z)
+    {
+        for (int y = begin[1]; y < end[1]; ++y)
+        {
+            for (int x = begin[0]; x < end[0]; ++x)
+            {
+                const unsigned int vertexMask = GetPointVertexMask(caseCountInfo[context.mPointCases[PointIndex(x, y, z)]], x, y, z);
+                for (int k = 0; k < 3; ++k)
+                {
+                    if ((vertexMask & (1u << k)) == 0)
+                    {
+                        continue;
+                    }
+
+                    //surface crossing of the edge, in corner units
+                    const int* cornerA = sCubePos[sEdgeConnections[sOwnedEdges[k]][0]];
+                    const int* cornerB = sCubePos[sEdgeConnections[sOwnedEdges[k]][1]];
+                    const float densityA = PointDensity(context.mDensities, x + cornerA[0], y + cornerA[1], z + cornerA[2]);
+                    const float densityB = PointDensity(context.mDensities, x + cornerB[0], y + cornerB[1], z + cornerB[2]);
+                    const float t = (MID_POINT - densityA) / (densityB - densityA);
+                    Vec3 position;
+                    for (int c = 0; c < 3; ++c)
+                    {
+                        position.v[c] = static_cast<float>(cornerA[c]) + static_cast<float>(cornerB[c] - cornerA[c]) * t;
+                    }
+                    position += Vec3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+
+                    //normal pointing out of the terrain, from the gradient of the densities one sample around
+                    Vec3 normal;
+                    const Vec3 sampleCoords = position + Vec3(1.0f, 1.0f, 1.0f);
+                    for (int c = 0; c < 3; ++c)
+                    {
+                        Vec3 delta(0.0f, 0.0f, 0.0f);
+                        delta.v[c] = 1.0f;
+                        normal.v[c] = SampleDensity(context.mDensities, sampleCoords - delta) - SampleDensity(context.mDensities, sampleCoords + delta);
+                    }
+                    const float normalLength = Length(normal);
+                    normal = (normalLength > 0.0f) ? normal / normalLength : Vec3(0.0f, 1.0f, 0.0f);
+
+                    vertex->position = Vec4(position * scale + offset, 1.0f);
+                    vertex->normal = normal;
+                    vertex->uv = Vec2(0.0f, 0.0f);
+                    ++vertex;
+                }
+            }
+        }
+    }
+    PG_ASSERT(vertex == context.mVertices + context.mBlockVertexOffsets[blockIndex] + context.mBlockVertexCounts[blockIndex]);
+
+    //triangles of the cells, like WriteIndices of meshProducer.cs, the vertices of an edge being in the block of its corner
+    const unsigned int* indexCases = batch->mCaseTable->GetPackedIndexCases();
+    unsigned short* index = context.mIndices + context.mBlockIndexOffsets[blockIndex];
+    for (int z = begin[2]; z < end[2] && z < CELL_DIM; ++z)
+    {
+        for (int y = begin[1]; y < end[1] && y < CELL_DIM; ++y)
+        {
+            for (int x = begin[0]; x < end[0] && x < CELL_DIM; ++x)
+            {
+                const unsigned int caseId = context.mPointCases[PointIndex(x, y, z)];
+                const unsigned int caseIndexCount = (caseCountInfo[caseId] >> 16) * 3;
+                for (unsigned int i = 0; i < caseIndexCount; ++i)
+                {
+                    const int* remap = sEdgeRemap[indexCases[caseId * 16 + i]];
+                    const int pointX = x + remap[0];
+                    const int pointY = y + remap[1];
+                    const int pointZ = z + remap[2];
+                    const unsigned int pointBlock = static_cast<unsigned int>(GetPointBlock(pointX)
+                                                  + Terrain3dSystem::GROUP_DIM * (GetPointBlock(pointY) + Terrain3dSystem::GROUP_DIM * GetPointBlock(pointZ)));
+                    *index++ = static_cast<unsigned short>(context.mBlockVertexOffsets[pointBlock]
+                                                         + context.mVertexSlots[PointIndex(pointX, pointY, pointZ) * 3 + remap[3]]);
+                }
+            }
+        }
+    }
+    PG_ASSERT(index == context.mIndices + context.mBlockIndexOffsets[blockIndex] + context.mBlockIndexCounts[blockIndex]);
+}
+
+//----------------------------------------------------------------------------------------
+
+void Terrain3dCpuMesher::GenerateSegments(const Segment* segments, unsigned int segmentCount, MeshData* const* meshes, unsigned int workerCount) const
+{
+    using namespace Internal;
+    PG_PROFILE_SCOPE("Terrain3dCpuMesher");
+    const unsigned long long startCounter = Core::GetPerformanceCounter();
+
+    const unsigned int batchCapacity = Min(segmentCount, SEGMENTS_PER_BATCH);
+    if (batchCapacity == 0)
+    {
+        return;
+    }
+
+    SegmentContext* contexts = PG_NEW_ARRAY(mAllocator, -1, "Terrain3dCpuMesher segments", Alloc::PG_MEM_TEMP, SegmentContext, batchCapacity);
+    float* densities = PG_NEW_ARRAY(mAllocator, -1, "Terrain3dCpuMesher densities", Alloc::PG_MEM_TEMP, float, batchCapacity * SAMPLE_DIM * SAMPLE_DIM * SAMPLE_DIM);
+    unsigned char* pointCases = PG_NEW_ARRAY(mAllocator, -1, "Terrain3dCpuMesher cases", Alloc::PG_MEM_TEMP, unsigned char, batchCapacity * POINT_DIM * POINT_DIM * POINT_DIM);
+    unsigned short* vertexSlots = PG_NEW_ARRAY(mAllocator, -1, "Terrain3dCpuMesher vertex slots", Alloc::PG_MEM_TEMP, unsigned short, batchCapacity * POINT_DIM * POINT_DIM * POINT_DIM * 3);
+
+    BatchContext batch;
+    batch.mCaseTable = mCaseTable;
+    batch.mSegments = contexts;
+
+    unsigned int totalVertexCount = 0;
+    unsigned int totalIndexCount = 0;
+    for (unsigned int batchBegin = 0; batchBegin < segmentCount; batchBegin += batchCapacity)
+    {
+        const unsigned int batchCount = Min(segmentCount - batchBegin, batchCapacity);
+        for (unsigned int s = 0; s < batchCount; ++s)
+        {
+            SegmentContext& context = contexts[s];
+            context.mSegment = segments[batchBegin + s];
+            context.mMesh = meshes[batchBegin + s];
+            context.mDensities = densities + s * SAMPLE_DIM * SAMPLE_DIM * SAMPLE_DIM;
+            context.mPointCases = pointCases + s * POINT_DIM * POINT_DIM * POINT_DIM;
+            context.mVertexSlots = vertexSlots + s * POINT_DIM * POINT_DIM * POINT_DIM * 3;
+        }
+
+        //the passes read the results of the neighbor blocks from the previous pass
+        const unsigned int jobCount = batchCount * BLOCKS_PER_SEGMENT;
+        Core::RunParallelJobs(DensityJob, &batch, jobCount, workerCount);
+        Core::RunParallelJobs(CountJob, &batch, jobCount, workerCount);
+
+        //offsets of the blocks in the meshes, like the sparse2_8 and sparse1_4 passes
+        for (unsigned int s = 0; s < batchCount; ++s)
+        {
+            SegmentContext& context = contexts[s];
+            unsigned int vertexCount = 0;
+            unsigned int indexCount = 0;
+            for (int b = 0; b < BLOCKS_PER_SEGMENT; ++b)
+            {
+                context.mBlockVertexOffsets[b] = vertexCount;
+                context.mBlockIndexOffsets[b] = indexCount;
+                vertexCount += context.mBlockVertexCounts[b];
+                indexCount += context.mBlockIndexCounts[b];
+            }
+            PG_ASSERTSTR(vertexCount <= 0xFFFF, "Too many vertices for a terrain segment");
+
+            context.mMesh->AllocateVertexes(static_cast<int>(vertexCount));
+            context.mMesh->AllocateIndexes(static_cast<int>(indexCount));
+            context.mVertices = context.mMesh->GetStream<StdVertex>(0);
+            context.mIndices = context.mMesh->GetIndexBuffer();
+            totalVertexCount += vertexCount;
+            totalIndexCount += indexCount;
+        }
+
+        Core::RunParallelJobs(OutputJob, &batch, jobCount, workerCount);
+    }
+
+    PG_DELETE_ARRAY(mAllocator, vertexSlots);
+    PG_DELETE_ARRAY(mAllocator, pointCases);
+    PG_DELETE_ARRAY(mAllocator, densities);
+    PG_DELETE_ARRAY(mAllocator, contexts);
+
+    const double seconds = static_cast<double>(Core::GetPerformanceCounter() - startCounter) * Core::GetPerformanceCounterPeriod();
+    const unsigned int blockCount = segmentCount * BLOCKS_PER_SEGMENT;
+    PG_LOG('MESH', "Terrain3d CPU meshing: %u segments of %u^3 cells (%u blocks), %u vertices, %u triangles, %.2f ms, %.0f blocks/s",
+           segmentCount, CELL_DIM, blockCount, totalVertexCount, totalIndexCount / 3, seconds * 1000.0,
+           (seconds > 0.0) ? static_cast<double>(blockCount) / seconds : 0.0);
+}
+
+
+#else
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+#endif
@@ -15,6 +15,7 @@
 #include "Pegasus/BlockScript/BlockLib.h"
 #include "Pegasus/BlockScript/BsVm.h"
 #include "Pegasus/BlockScript/FunCallback.h"
+#include "Pegasus/BlockScript/FunBinding.h"
 
 #if RENDER_SYSTEM_CONFIG_ENABLE_LIGHTING
 
@@ -23,22 +24,28 @@ using namespace Pegasus::Application;
 using namespace Pegasus::RenderSystems;
 using namespace Pegasus::Lighting;
 
+//! Script types of the handles and structures passed by value
+typedef BlockScript::ObjectHandle<LightRig> LightRigHandle;
+typedef BlockScript::ObjectHandle<LightRig::Light> ScriptLightHandle;
+typedef BlockScript::ObjectHandle<Render::Buffer> BufferHandle;
+BS_BINDING_TYPE(LightRigHandle,                         "LightRig")
+BS_BINDING_TYPE(ScriptLightHandle,                      "LightHandle")
+BS_BINDING_TYPE(BufferHandle,                           "Buffer")
+BS_BINDING_TYPE(Pegasus::Lighting::LightRig::SphereLight, "SphereLight")
+BS_BINDING_TYPE(Pegasus::Lighting::LightRig::SpotLight,   "SpotLight")
+
 LightingSystem* gLightingSystemInstance = nullptr;
 
-void LightRig_CreateLightRig(BlockScript::FunCallbackContext& context)
+LightRigHandle LightRig_CreateLightRig(BlockScript::BsVmState* state)
 {
-    BlockScript::FunParamStream stream(context);
-    RenderCollection* collection = static_cast<RenderCollection*>(context.GetVmState()->GetUserContext());
+    RenderCollection* collection = static_cast<RenderCollection*>(state->GetUserContext());
     LightRig* newLightRig = PG_NEW(Memory::GetCoreAllocator(), -1, "LightRig", Pegasus::Alloc::PG_MEM_TEMP) LightRig(Memory::GetCoreAllocator());
-    RenderCollection::CollectionHandle handle = RenderCollection::AddResource(collection, static_cast<GenericResource*>(newLightRig));
-    stream.SubmitReturn<RenderCollection::CollectionHandle>(handle);
+    return RenderCollection::AddResource(collection, static_cast<GenericResource*>(newLightRig));
 }
 
-void LightRig_SetActiveLightRig(BlockScript::FunCallbackContext& context)
+void LightRig_SetActiveLightRig(BlockScript::BsVmState* state, LightRigHandle lightRigHandle)
 {
-    BlockScript::FunParamStream stream(context);
-    RenderCollection* collection = static_cast<RenderCollection*>(context.GetVmState()->GetUserContext());
-    RenderCollection::CollectionHandle lightRigHandle = stream.NextArgument<RenderCollection::CollectionHandle>();
+    RenderCollection* collection = static_cast<RenderCollection*>(state->GetUserContext());
     if (lightRigHandle != RenderCollection::INVALID_HANDLE)
     {
         GenericResource* lightRigResource = RenderCollection::GetResource<GenericResource>(collection, lightRigHandle);
@@ -51,34 +58,27 @@ void LightRig_SetActiveLightRig(BlockScript::FunCallbackContext& context)
     }
 }
 
-void LightRig_LoadCulledLightBuffer(BlockScript::FunCallbackContext& context)
+BufferHandle LightRig_LoadCulledLightBuffer(BlockScript::BsVmState* state)
 {
-    BlockScript::FunParamStream stream(context);
-    RenderCollection* collection = static_cast<RenderCollection*>(context.GetVmState()->GetUserContext());
+    RenderCollection* collection = static_cast<RenderCollection*>(state->GetUserContext());
     //register first this buffer to this context
     Render::BufferRef culledLightBuffer = gLightingSystemInstance->GetCulledLightBuffer();
-    stream.SubmitReturn( RenderCollection::AddResource<Render::Buffer>(collection, culledLightBuffer) );
+    return RenderCollection::AddResource<Render::Buffer>(collection, culledLightBuffer);
 }
 
-void LightRig_GetActiveLightCount(BlockScript::FunCallbackContext& context)
+int LightRig_GetActiveLightCount()
 {
-    BlockScript::FunParamStream stream(context);
-    RenderCollection* collection = static_cast<RenderCollection*>(context.GetVmState()->GetUserContext());
-    //register first this buffer to this context
-    stream.SubmitReturn( gLightingSystemInstance->GetActiveLightCount() );
+    return gLightingSystemInstance->GetActiveLightCount();
 }
 
 template<class T>
-void LightRig_AddLight(BlockScript::FunCallbackContext& context)
+ScriptLightHandle LightRig_AddLight(BlockScript::BsVmState* state, LightRigHandle thisHandle, T& lightType)
 {
-    BlockScript::FunParamStream stream(context);
-    RenderCollection* collection = static_cast<RenderCollection*>(context.GetVmState()->GetUserContext());
-    RenderCollection::CollectionHandle thisHandle = stream.NextArgument<RenderCollection::CollectionHandle>();
+    RenderCollection* collection = static_cast<RenderCollection*>(state->GetUserContext());
     LightHandle retHandle = InvalidLightHandle;
     if (thisHandle != RenderCollection::INVALID_HANDLE)
     {
         LightRig* lr = static_cast<LightRig*>(RenderCollection::GetResource<GenericResource>(collection, thisHandle));
-        T& lightType = stream.NextArgument<T>();
         LightRig::Light l;
         l.SetState(lightType);
         retHandle = lr->AddLight(l);
@@ -87,20 +87,16 @@ void LightRig_AddLight(BlockScript::FunCallbackContext& context)
     {
         PG_LOG('ERR_', "Invalid light rig pointer / handle in AddLight");
     }
-    stream.SubmitReturn<LightHandle>(retHandle);
+    return retHandle;
 }
 
 template<class T>
-void LightRig_UpdateLight(BlockScript::FunCallbackContext& context)
+void LightRig_UpdateLight(BlockScript::BsVmState* state, LightRigHandle thisHandle, ScriptLightHandle lightHandle, T& lightType)
 {
-    BlockScript::FunParamStream stream(context);
-    RenderCollection* collection = static_cast<RenderCollection*>(context.GetVmState()->GetUserContext());
-    RenderCollection::CollectionHandle thisHandle = stream.NextArgument<RenderCollection::CollectionHandle>();
+    RenderCollection* collection = static_cast<RenderCollection*>(state->GetUserContext());
     if (thisHandle != RenderCollection::INVALID_HANDLE)
     {
         LightRig* lr = static_cast<LightRig*>(RenderCollection::GetResource<GenericResource>(collection, thisHandle));
-        LightHandle& lightHandle = stream.NextArgument<LightHandle>();
-        T& lightType = stream.NextArgument<T>();
         LightRig::Light l;
         l.SetState(lightType);
         lr->UpdateLight(lightHandle, l);
@@ -111,11 +107,9 @@ void LightRig_UpdateLight(BlockScript::FunCallbackContext& context)
     }
 }
 
-void LightRig_Clear(BlockScript::FunCallbackContext& context)
+void LightRig_Clear(BlockScript::BsVmState* state, LightRigHandle thisHandle)
 {
-    BlockScript::FunParamStream stream(context);
-    RenderCollection* collection = static_cast<RenderCollection*>(context.GetVmState()->GetUserContext());
-    RenderCollection::CollectionHandle thisHandle = stream.NextArgument<RenderCollection::CollectionHandle>();
+    RenderCollection* collection = static_cast<RenderCollection*>(state->GetUserContext());
     if (thisHandle != RenderCollection::INVALID_HANDLE)
     {
         LightRig* lr = static_cast<LightRig*>(RenderCollection::GetResource<GenericResource>(collection, thisHandle));
@@ -186,74 +180,20 @@ void LightingSystem::OnRegisterBlockscriptApi(BlockScript::BlockLib* blocklib, C
 
     //register methods of light rig
     const BlockScript::FunctionDeclarationDesc lightRigMethods[] = {
-        {
-            "AddLight",
-            "LightHandle",
-            { "LightRig", "SphereLight", nullptr },
-            { "this", "sphereLight", nullptr },
-            LightRig_AddLight<LightRig::SphereLight>
-        },
-        {
-            "AddLight",
-            "LightHandle",
-            { "LightRig", "SpotLight", nullptr },
-            { "this", "spotlight", nullptr },
-            LightRig_AddLight<LightRig::SpotLight>
-        },
-        {
-            "UpdateLight",
-            "int",
-            { "LightRig", "LightHandle" ,"SphereLight", nullptr },
-            { "this", "handle", "sphereLight", nullptr },
-            LightRig_UpdateLight<LightRig::SphereLight>
-        },
-        {
-            "UpdateLight",
-            "int",
-            { "LightRig", "LightHandle", "SpotLight", nullptr },
-            { "this", "handle", "spotlight", nullptr },
-            LightRig_UpdateLight<LightRig::SpotLight>
-        },
-        {
-            "Clear",
-            "int",
-            { "LightRig", nullptr },
-            { "this", nullptr },
-            LightRig_Clear
-        }
+        BS_BIND(LightRig_AddLight<LightRig::SphereLight>)::Declare("AddLight", "this", "sphereLight"),
+        BS_BIND(LightRig_AddLight<LightRig::SpotLight>)::Declare("AddLight", "this", "spotlight"),
+        BS_BIND(LightRig_UpdateLight<LightRig::SphereLight>)::Declare("UpdateLight", "this", "handle", "sphereLight"),
+        BS_BIND(LightRig_UpdateLight<LightRig::SpotLight>)::Declare("UpdateLight", "this", "handle", "spotlight"),
+        BS_BIND(LightRig_Clear)::Declare("Clear", "this")
     };
 
     Application::GenericResource::RegisterGenericResourceType(Pegasus::Lighting::LightRig::GetStaticClassInfo(), blocklib, lightRigMethods, sizeof(lightRigMethods)/sizeof(lightRigMethods[0]));
 
     const BlockScript::FunctionDeclarationDesc extraFuns[] = {
-        {
-            "CreateLightRig",
-            "LightRig",
-            { nullptr },
-            { nullptr },
-            LightRig_CreateLightRig
-        },
-        {
-            "SetActiveLightRig",
-            "int",
-            { "LightRig", nullptr },
-            { "lightrig", nullptr },
-            LightRig_SetActiveLightRig
-        },
-        {
-            "LoadCulledLightBuffer",
-            "Buffer",
-            { nullptr },
-            { nullptr },
-            LightRig_LoadCulledLightBuffer
-        },
-        {
-            "GetActiveLightCount",
-            "int",
-            { nullptr },
-            { nullptr },
-            LightRig_GetActiveLightCount
-        }
+        BS_BIND(LightRig_CreateLightRig)::Declare("CreateLightRig"),
+        BS_BIND(LightRig_SetActiveLightRig)::Declare("SetActiveLightRig", "lightrig"),
+        BS_BIND(LightRig_LoadCulledLightBuffer)::Declare("LoadCulledLightBuffer"),
+        BS_BIND(LightRig_GetActiveLightCount)::Declare("GetActiveLightCount")
     };
 
 
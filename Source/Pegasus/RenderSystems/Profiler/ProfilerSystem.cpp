@@ -0,0 +1,105 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   ProfilerSystem.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Debug render system exposing the CPU frame profiler to scripts
+
+#include "Pegasus/RenderSystems/Profiler/ProfilerSystem.h"
+
+#if RENDER_SYSTEM_CONFIG_ENABLE_PROFILER
+
+#include "Pegasus/Core/Profiler.h"
+#include "Pegasus/BlockScript/BlockLib.h"
+#include "Pegasus/BlockScript/FunCallback.h"
+
+using namespace Pegasus;
+using namespace Pegasus::RenderSystems;
+
+void Profiler_EnableProfiler(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    int enabled = stream.NextArgument<int>();
+    Core::SetProfilerEnabled(enabled != 0);
+    stream.SubmitReturn<int>(1);
+}
+
+void Profiler_GetProfileFrameTime(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    stream.SubmitReturn<float>(Core::GetProfileAverageFrameTime());
+}
+
+void Profiler_GetProfileScopeTime(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    const Core::ProfileSummaryEntry* entry = Core::FindProfileSummaryEntry(stream.NextBsStringArgument());
+    stream.SubmitReturn<float>(entry != nullptr ? entry->mAverageMs : 0.0f);
+}
+
+void Profiler_GetProfileScopeMaxTime(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    const Core::ProfileSummaryEntry* entry = Core::FindProfileSummaryEntry(stream.NextBsStringArgument());
+    stream.SubmitReturn<float>(entry != nullptr ? entry->mMaxMs : 0.0f);
+}
+
+void Profiler_LogProfileSummary(BlockScript::FunCallbackContext& context)
+{
+    BlockScript::FunParamStream stream(context);
+    Core::LogProfileSummary();
+    stream.SubmitReturn<int>(1);
+}
+
+void ProfilerSystem::OnRegisterBlockscriptApi(BlockScript::BlockLib* blocklib, Core::IApplicationContext* appContext)
+{
+    const BlockScript::FunctionDeclarationDesc profilerFuns[] = {
+        {
+            "EnableProfiler",
+            "int",
+            { "int", nullptr },
+            { "enabled", nullptr },
+            Profiler_EnableProfiler
+        },
+        {
+            "GetProfileFrameTime",
+            "float",
+            { nullptr },
+            { nullptr },
+            Profiler_GetProfileFrameTime
+        },
+        {
+            "GetProfileScopeTime",
+            "float",
+            { "string", nullptr },
+            { "scopeName", nullptr },
+            Profiler_GetProfileScopeTime
+        },
+        {
+            "GetProfileScopeMaxTime",
+            "float",
+            { "string", nullptr },
+            { "scopeName", nullptr },
+            Profiler_GetProfileScopeMaxTime
+        },
+        {
+            "LogProfileSummary",
+            "int",
+            { nullptr },
+            { nullptr },
+            Profiler_LogProfileSummary
+        }
+    };
+
+    blocklib->CreateIntrinsicFunctions(profilerFuns, sizeof(profilerFuns) / sizeof(profilerFuns[0]));
+}
+
+#else
+
+PEGASUS_AVOID_EMPTY_FILE_WARNING
+
+#endif
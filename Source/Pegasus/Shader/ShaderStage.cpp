@@ -145,11 +145,8 @@ void Pegasus::Shader::ShaderStage::SetSource(const char * src, int srcSize)
 
 void Pegasus::Shader::ShaderStage::InvalidateData()
 {
-    //! mark data as dirty
-    if (GetData() != nullptr)
-    {
-        GetData()->Invalidate();
-    }
+    //! mark data as dirty, and the programs using the shader stage
+    Pegasus::Shader::ShaderSource::InvalidateData();
 }
 
 Pegasus::Graph::NodeData * Pegasus::Shader::ShaderStage::AllocateData() const
@@ -0,0 +1,1081 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BlockCompression.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Block compression of RGBA8 images to the BC1, BC3, BC5 and BC7 formats
+
+#include "Pegasus/Texture/BlockCompression.h"
+#include "Pegasus/Math/Scalar.h"
+
+#if PEGASUS_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Error larger than any error of a block
+static const float MAX_BLOCK_ERROR = 1e30f;
+
+//! Number of power iterations computing the principal axis of the colors of a block
+static const unsigned int NUM_PCA_ITERATIONS = 8;
+
+//! Number of least squares refinements of the endpoints with the high quality preset
+static const unsigned int NUM_REFINEMENT_ITERATIONS = 2;
+
+//! Weights of the 16 interpolated colors of BC7 mode 6, in 1/64 units
+static const unsigned int BC7_WEIGHTS_4[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+//! Pixels of a 4x4 block, stored by channel so the palette search processes 4 entries at once
+struct BlockPixels
+{
+    float mChannels[4][16];         //!< Values in [0, 255] of the R, G, B and A channels of the 16 pixels
+};
+
+//! Decoded colors of a block, stored by channel like the pixels
+struct BlockPalette
+{
+    float mChannels[4][16];         //!< Values in [0, 255] of the R, G, B and A channels of the entries
+    unsigned int mNumEntries;       //!< Number of entries (4, 8 or 16), always a multiple of 4
+};
+
+//! Writer of the bit fields of a block, least significant bit first
+struct BlockBitWriter
+{
+    unsigned char * mData;          //!< Block data, cleared before writing
+    unsigned int mPosition;         //!< Index of the next bit to write
+
+    void Write(unsigned int value, unsigned int numBits)
+    {
+        for (unsigned int b = 0; b < numBits; ++b, ++mPosition)
+        {
+            if ((value >> b) & 1)
+            {
+                mData[mPosition >> 3] |= static_cast<unsigned char>(1 << (mPosition & 7));
+            }
+        }
+    }
+};
+
+//! Reader of the bit fields of a block, least significant bit first
+struct BlockBitReader
+{
+    const unsigned char * mData;    //!< Block data
+    unsigned int mPosition;         //!< Index of the next bit to read
+
+    unsigned int Read(unsigned int numBits)
+    {
+        unsigned int value = 0;
+        for (unsigned int b = 0; b < numBits; ++b, ++mPosition)
+        {
+            value |= ((mData[mPosition >> 3] >> (mPosition & 7)) & 1) << b;
+        }
+        return value;
+    }
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Round a value in [0, 255] to the nearest byte
+//! \param value Value to round
+//! \return Rounded and clamped value
+static inline unsigned int RoundToByte(float value)
+{
+    return static_cast<unsigned int>(Math::Clamp(value + 0.5f, 0.0f, 255.0f));
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Load a 4x4 block of an RGBA8 image, replicating the last row and column for partial blocks
+//! \param rgbaData RGBA8 image
+//! \param width Width of the image in pixels
+//! \param height Height of the image in pixels
+//! \param blockX Horizontal index of the block
+//! \param blockY Vertical index of the block
+//! \param pixels Pixels of the block (output)
+static void LoadBlock(const unsigned char * rgbaData, unsigned int width, unsigned int height,
+                      unsigned int blockX, unsigned int blockY, BlockPixels & pixels)
+{
+    for (unsigned int y = 0; y < 4; ++y)
+    {
+        const unsigned int srcY = Math::Min(blockY * 4 + y, height - 1);
+        const unsigned char * srcRow = rgbaData + srcY * width * 4;
+        for (unsigned int x = 0; x < 4; ++x)
+        {
+            const unsigned char * srcPixel = srcRow + Math::Min(blockX * 4 + x, width - 1) * 4;
+            for (unsigned int c = 0; c < 4; ++c)
+            {
+                pixels.mChannels[c][y * 4 + x] = static_cast<float>(srcPixel[c]);
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Store the decoded pixels of a 4x4 block, skipping the pixels outside of the image
+//! \param decodedPixels RGBA8 values of the 16 pixels of the block
+//! \param width Width of the image in pixels
+//! \param height Height of the image in pixels
+//! \param blockX Horizontal index of the block
+//! \param blockY Vertical index of the block
+//! \param rgbaData RGBA8 image
+static void StoreBlock(const unsigned char decodedPixels[16 * 4], unsigned int width, unsigned int height,
+                       unsigned int blockX, unsigned int blockY, unsigned char * rgbaData)
+{
+    for (unsigned int y = 0; (y < 4) && (blockY * 4 + y < height); ++y)
+    {
+        for (unsigned int x = 0; (x < 4) && (blockX * 4 + x < width); ++x)
+        {
+            unsigned char * dstPixel = rgbaData + ((blockY * 4 + y) * width + blockX * 4 + x) * 4;
+            for (unsigned int c = 0; c < 4; ++c)
+            {
+                dstPixel[c] = decodedPixels[(y * 4 + x) * 4 + c];
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Find the closest palette entry of each pixel of a block
+//! \param pixels Pixels of the block
+//! \param palette Palette of the block
+//! \param firstChannel Index of the first channel compared
+//! \param numChannels Number of channels compared
+//! \param indices Index of the closest entry of each pixel (output)
+//! \return Sum of the squared errors of the pixels
+static float FindClosestEntries(const BlockPixels & pixels, const BlockPalette & palette,
+                                unsigned int firstChannel, unsigned int numChannels,
+                                unsigned char indices[16])
+{
+    const unsigned int lastChannel = firstChannel + numChannels;
+    float totalError = 0.0f;
+    for (unsigned int p = 0; p < 16; ++p)
+    {
+        float bestError = MAX_BLOCK_ERROR;
+        unsigned int bestEntry = 0;
+        for (unsigned int e = 0; e < palette.mNumEntries; e += 4)
+        {
+            float errors[4];
+#if PEGASUS_SIMD_SSE2
+            // Distance to 4 entries at once
+            __m128 error = _mm_setzero_ps();
+            for (unsigned int c = firstChannel; c < lastChannel; ++c)
+            {
+                const __m128 diff = _mm_sub_ps(_mm_loadu_ps(&palette.mChannels[c][e]), _mm_set1_ps(pixels.mChannels[c][p]));
+                error = _mm_add_ps(error, _mm_mul_ps(diff, diff));
+            }
+            _mm_storeu_ps(errors, error);
+#else
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                errors[i] = 0.0f;
+                for (unsigned int c = firstChannel; c < lastChannel; ++c)
+                {
+                    const float diff = palette.mChannels[c][e + i] - pixels.mChannels[c][p];
+                    errors[i] += diff * diff;
+                }
+            }
+#endif  // PEGASUS_SIMD_SSE2
+
+            for (unsigned int i = 0; i < 4; ++i)
+            {
+                if (errors[i] < bestError)
+                {
+                    bestError = errors[i];
+                    bestEntry = e + i;
+                }
+            }
+        }
+        indices[p] = static_cast<unsigned char>(bestEntry);
+        totalError += bestError;
+    }
+    return totalError;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Compute the endpoints of a block from its bounding box, inset to reduce the quantization error
+//! \param pixels Pixels of the block
+//! \param firstChannel Index of the first channel of the endpoints
+//! \param numChannels Number of channels of the endpoints
+//! \param endpoint0 First endpoint, the maximum of each channel (output)
+//! \param endpoint1 Second endpoint, the minimum of each channel (output)
+static void FitEndpointsBoundingBox(const BlockPixels & pixels, unsigned int firstChannel, unsigned int numChannels,
+                                    float endpoint0[4], float endpoint1[4])
+{
+    for (unsigned int c = firstChannel; c < firstChannel + numChannels; ++c)
+    {
+        float minValue = pixels.mChannels[c][0];
+        float maxValue = minValue;
+        for (unsigned int p = 1; p < 16; ++p)
+        {
+            minValue = Math::Min(minValue, pixels.mChannels[c][p]);
+            maxValue = Math::Max(maxValue, pixels.mChannels[c][p]);
+        }
+
+        // Inset by 1/16 of the range, the extreme pixels are rarely worth an endpoint
+        const float inset = (maxValue - minValue) / 16.0f;
+        endpoint0[c] = maxValue - inset;
+        endpoint1[c] = minValue + inset;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Compute the endpoints of a block from the principal axis of its pixels
+//! \param pixels Pixels of the block
+//! \param firstChannel Index of the first channel of the endpoints
+//! \param numChannels Number of channels of the endpoints
+//! \param endpoint0 First endpoint, at the positive end of the axis (output)
+//! \param endpoint1 Second endpoint, at the negative end of the axis (output)
+static void FitEndpointsPrincipalAxis(const BlockPixels & pixels, unsigned int firstChannel, unsigned int numChannels,
+                                      float endpoint0[4], float endpoint1[4])
+{
+    const unsigned int lastChannel = firstChannel + numChannels;
+
+    float mean[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    for (unsigned int c = firstChannel; c < lastChannel; ++c)
+    {
+        for (unsigned int p = 0; p < 16; ++p)
+        {
+            mean[c] += pixels.mChannels[c][p];
+        }
+        mean[c] /= 16.0f;
+    }
+
+    // Covariance matrix of the channels
+    float covariance[4][4];
+    for (unsigned int c0 = firstChannel; c0 < lastChannel; ++c0)
+    {
+        for (unsigned int c1 = c0; c1 < lastChannel; ++c1)
+        {
+            float sum = 0.0f;
+            for (unsigned int p = 0; p < 16; ++p)
+            {
+                sum += (pixels.mChannels[c0][p] - mean[c0]) * (pixels.mChannels[c1][p] - mean[c1]);
+            }
+            covariance[c0][c1] = sum;
+            covariance[c1][c0] = sum;
+        }
+    }
+
+    // Power iteration, starting from the diagonal of the bounding box
+    float axis[4];
+    for (unsigned int c = firstChannel; c < lastChannel; ++c)
+    {
+        float minValue = pixels.mChannels[c][0];
+        float maxValue = minValue;
+        for (unsigned int p = 1; p < 16; ++p)
+        {
+            minValue = Math::Min(minValue, pixels.mChannels[c][p]);
+            maxValue = Math::Max(maxValue, pixels.mChannels[c][p]);
+        }
+        axis[c] = maxValue - minValue + 1.0f;
+    }
+    for (unsigned int i = 0; i < NUM_PCA_ITERATIONS; ++i)
+    {
+        float newAxis[4];
+        float maxComponent = 0.0f;
+        for (unsigned int c0 = firstChannel; c0 < lastChannel; ++c0)
+        {
+            newAxis[c0] = 0.0f;
+            for (unsigned int c1 = firstChannel; c1 < lastChannel; ++c1)
+            {
+                newAxis[c0] += covariance[c0][c1] * axis[c1];
+            }
+            maxComponent = Math::Max(maxComponent, Math::Abs(newAxis[c0]));
+        }
+        if (maxComponent < 1e-6f)
+        {
+            // Uniform block
+            break;
+        }
+        for (unsigned int c = firstChannel; c < lastChannel; ++c)
+        {
+            axis[c] = newAxis[c] / maxComponent;
+        }
+    }
+
+    float axisLengthSq = 0.0f;
+    for (unsigned int c = firstChannel; c < lastChannel; ++c)
+    {
+        axisLengthSq += axis[c] * axis[c];
+    }
+    const float invAxisLength = 1.0f / Math::Sqrt(Math::Max(axisLengthSq, 1e-12f));
+
+    // Extent of the pixels projected on the axis
+    float minT = 0.0f;
+    float maxT = 0.0f;
+    for (unsigned int p = 0; p < 16; ++p)
+    {
+        float t = 0.0f;
+        for (unsigned int c = firstChannel; c < lastChannel; ++c)
+        {
+            t += (pixels.mChannels[c][p] - mean[c]) * axis[c];
+        }
+        t *= invAxisLength;
+        minT = Math::Min(minT, t);
+        maxT = Math::Max(maxT, t);
+    }
+
+    for (unsigned int c = firstChannel; c < lastChannel; ++c)
+    {
+        const float direction = axis[c] * invAxisLength;
+        endpoint0[c] = Math::Clamp(mean[c] + direction * maxT, 0.0f, 255.0f);
+        endpoint1[c] = Math::Clamp(mean[c] + direction * minT, 0.0f, 255.0f);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Compute the endpoints of a block minimizing the squared error for given indices
+//! \param pixels Pixels of the block
+//! \param firstChannel Index of the first channel of the endpoints
+//! \param numChannels Number of channels of the endpoints
+//! \param indices Palette entry of each pixel
+//! \param entryWeights Weight of the second endpoint for each palette entry, in [0, 1]
+//! \param endpoint0 First endpoint (input and output, unchanged when the system is singular)
+//! \param endpoint1 Second endpoint (input and output, unchanged when the system is singular)
+static void RefineEndpoints(const BlockPixels & pixels, unsigned int firstChannel, unsigned int numChannels,
+                            const unsigned char indices[16], const float * entryWeights,
+                            float endpoint0[4], float endpoint1[4])
+{
+    float aa = 0.0f;
+    float ab = 0.0f;
+    float bb = 0.0f;
+    float ax[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    float bx[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    for (unsigned int p = 0; p < 16; ++p)
+    {
+        const float b = entryWeights[indices[p]];
+        const float a = 1.0f - b;
+        aa += a * a;
+        ab += a * b;
+        bb += b * b;
+        for (unsigned int c = firstChannel; c < firstChannel + numChannels; ++c)
+        {
+            ax[c] += a * pixels.mChannels[c][p];
+            bx[c] += b * pixels.mChannels[c][p];
+        }
+    }
+
+    const float determinant = aa * bb - ab * ab;
+    if (Math::Abs(determinant) < 1e-6f)
+    {
+        return;
+    }
+    const float invDeterminant = 1.0f / determinant;
+    for (unsigned int c = firstChannel; c < firstChannel + numChannels; ++c)
+    {
+        endpoint0[c] = Math::Clamp((ax[c] * bb - bx[c] * ab) * invDeterminant, 0.0f, 255.0f);
+        endpoint1[c] = Math::Clamp((bx[c] * aa - ax[c] * ab) * invDeterminant, 0.0f, 255.0f);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Compute the endpoints of a block with the method of a quality preset
+//! \param pixels Pixels of the block
+//! \param firstChannel Index of the first channel of the endpoints
+//! \param numChannels Number of channels of the endpoints
+//! \param quality Quality preset
+//! \param endpoint0 First endpoint (output)
+//! \param endpoint1 Second endpoint (output)
+static void FitEndpoints(const BlockPixels & pixels, unsigned int firstChannel, unsigned int numChannels,
+                         CompressionQuality quality, float endpoint0[4], float endpoint1[4])
+{
+    if (quality == COMPRESSIONQUALITY_FAST)
+    {
+        FitEndpointsBoundingBox(pixels, firstChannel, numChannels, endpoint0, endpoint1);
+    }
+    else
+    {
+        FitEndpointsPrincipalAxis(pixels, firstChannel, numChannels, endpoint0, endpoint1);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Pack an RGB color to 565
+//! \param color Color with channels in [0, 255]
+//! \return 565 color
+static inline unsigned int PackColor565(const float color[4])
+{
+    const unsigned int r = static_cast<unsigned int>(Math::Clamp(color[0] * (31.0f / 255.0f) + 0.5f, 0.0f, 31.0f));
+    const unsigned int g = static_cast<unsigned int>(Math::Clamp(color[1] * (63.0f / 255.0f) + 0.5f, 0.0f, 63.0f));
+    const unsigned int b = static_cast<unsigned int>(Math::Clamp(color[2] * (31.0f / 255.0f) + 0.5f, 0.0f, 31.0f));
+    return (r << 11) | (g << 5) | b;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Unpack a 565 color to 8 bits per channel
+//! \param packedColor 565 color
+//! \param color RGB channels in [0, 255] (output)
+static inline void UnpackColor565(unsigned int packedColor, unsigned int color[3])
+{
+    const unsigned int r = (packedColor >> 11) & 31;
+    const unsigned int g = (packedColor >> 5) & 63;
+    const unsigned int b = packedColor & 31;
+    color[0] = (r << 3) | (r >> 2);
+    color[1] = (g << 2) | (g >> 4);
+    color[2] = (b << 3) | (b >> 2);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Build the palette of a BC1 block
+//! \param packedColor0 First 565 color
+//! \param packedColor1 Second 565 color
+//! \param allowThreeColors True to decode the 3 color mode when packedColor0 <= packedColor1 (false for BC3)
+//! \param colors RGBA8 values of the 4 entries (output)
+static void BuildBC1Palette(unsigned int packedColor0, unsigned int packedColor1, bool allowThreeColors, unsigned int colors[4][4])
+{
+    UnpackColor565(packedColor0, colors[0]);
+    UnpackColor565(packedColor1, colors[1]);
+    colors[0][3] = 255;
+    colors[1][3] = 255;
+    colors[2][3] = 255;
+    colors[3][3] = 255;
+    if (allowThreeColors && (packedColor0 <= packedColor1))
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            colors[2][c] = (colors[0][c] + colors[1][c]) / 2;
+            colors[3][c] = 0;
+        }
+        colors[3][3] = 0;
+    }
+    else
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            colors[2][c] = (2 * colors[0][c] + colors[1][c]) / 3;
+            colors[3][c] = (colors[0][c] + 2 * colors[1][c]) / 3;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Quantize the endpoints of a BC1 color block and find the indices of the pixels.
+//! The 4 color mode is always used, the endpoints are swapped to keep packedColor0 > packedColor1
+//! \param pixels Pixels of the block
+//! \param endpoint0 First endpoint, in [0, 255]
+//! \param endpoint1 Second endpoint, in [0, 255]
+//! \param packedColor0 First 565 color (output)
+//! \param packedColor1 Second 565 color (output)
+//! \param indices Index of each pixel (output)
+//! \return Sum of the squared errors of the pixels
+static float QuantizeBC1Endpoints(const BlockPixels & pixels, const float endpoint0[4], const float endpoint1[4],
+                                  unsigned int & packedColor0, unsigned int & packedColor1, unsigned char indices[16])
+{
+    packedColor0 = PackColor565(endpoint0);
+    packedColor1 = PackColor565(endpoint1);
+    if (packedColor0 < packedColor1)
+    {
+        const unsigned int swapped = packedColor0;
+        packedColor0 = packedColor1;
+        packedColor1 = swapped;
+    }
+
+    unsigned int colors[4][4];
+    BuildBC1Palette(packedColor0, packedColor1, false, colors);
+    BlockPalette palette;
+    palette.mNumEntries = 4;
+    for (unsigned int e = 0; e < 4; ++e)
+    {
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            palette.mChannels[c][e] = static_cast<float>(colors[e][c]);
+        }
+    }
+    return FindClosestEntries(pixels, palette, 0, 3, indices);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Encode the color part of a BC1 or BC3 block, always in the 4 color mode
+//! \param pixels Pixels of the block
+//! \param quality Quality preset
+//! \param dst 8 bytes of the encoded block (output)
+static void EncodeBC1ColorBlock(const BlockPixels & pixels, CompressionQuality quality, unsigned char * dst)
+{
+    // Weight of the second endpoint for each index in the 4 color mode
+    static const float BC1_ENTRY_WEIGHTS[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+
+    float endpoint0[4];
+    float endpoint1[4];
+    FitEndpoints(pixels, 0, 3, quality, endpoint0, endpoint1);
+
+    unsigned int packedColor0;
+    unsigned int packedColor1;
+    unsigned char indices[16];
+    float error = QuantizeBC1Endpoints(pixels, endpoint0, endpoint1, packedColor0, packedColor1, indices);
+
+    if (quality == COMPRESSIONQUALITY_HIGH)
+    {
+        for (unsigned int i = 0; (i < NUM_REFINEMENT_ITERATIONS) && (error > 0.0f); ++i)
+        {
+            // The indices refer to the quantized endpoints, which may have been swapped
+            unsigned int colors[2][3];
+            UnpackColor565(packedColor0, colors[0]);
+            UnpackColor565(packedColor1, colors[1]);
+            for (unsigned int c = 0; c < 3; ++c)
+            {
+                endpoint0[c] = static_cast<float>(colors[0][c]);
+                endpoint1[c] = static_cast<float>(colors[1][c]);
+            }
+            RefineEndpoints(pixels, 0, 3, indices, BC1_ENTRY_WEIGHTS, endpoint0, endpoint1);
+
+            unsigned int refinedColor0;
+            unsigned int refinedColor1;
+            unsigned char refinedIndices[16];
+            const float refinedError = QuantizeBC1Endpoints(pixels, endpoint0, endpoint1, refinedColor0, refinedColor1, refinedIndices);
+            if (refinedError >= error)
+            {
+                break;
+            }
+            error = refinedError;
+            packedColor0 = refinedColor0;
+            packedColor1 = refinedColor1;
+            for (unsigned int p = 0; p < 16; ++p)
+            {
+                indices[p] = refinedIndices[p];
+            }
+        }
+    }
+
+    // Equal endpoints would select the 3 color mode, index 0 is then the only valid one
+    if (packedColor0 == packedColor1)
+    {
+        for (unsigned int p = 0; p < 16; ++p)
+        {
+            indices[p] = 0;
+        }
+    }
+
+    dst[0] = static_cast<unsigned char>(packedColor0 & 0xFF);
+    dst[1] = static_cast<unsigned char>(packedColor0 >> 8);
+    dst[2] = static_cast<unsigned char>(packedColor1 & 0xFF);
+    dst[3] = static_cast<unsigned char>(packedColor1 >> 8);
+    for (unsigned int row = 0; row < 4; ++row)
+    {
+        dst[4 + row] = static_cast<unsigned char>(  indices[row * 4]
+                                                  | (indices[row * 4 + 1] << 2)
+                                                  | (indices[row * 4 + 2] << 4)
+                                                  | (indices[row * 4 + 3] << 6));
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Build the palette of a BC4 block
+//! \param value0 First endpoint
+//! \param value1 Second endpoint
+//! \param values Values of the 8 entries (output)
+static void BuildBC4Palette(unsigned int value0, unsigned int value1, float values[8])
+{
+    const float v0 = static_cast<float>(value0);
+    const float v1 = static_cast<float>(value1);
+    values[0] = v0;
+    values[1] = v1;
+    if (value0 > value1)
+    {
+        for (unsigned int i = 2; i < 8; ++i)
+        {
+            values[i] = (static_cast<float>(8 - i) * v0 + static_cast<float>(i - 1) * v1) / 7.0f;
+        }
+    }
+    else
+    {
+        for (unsigned int i = 2; i < 6; ++i)
+        {
+            values[i] = (static_cast<float>(6 - i) * v0 + static_cast<float>(i - 1) * v1) / 5.0f;
+        }
+        values[6] = 0.0f;
+        values[7] = 255.0f;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Encode one channel of a block to a BC4 block, used for the alpha of BC3 and the channels of BC5.
+//! The 8 value mode is used, the high quality preset also tries endpoints inset from the range
+//! \param pixels Pixels of the block
+//! \param channel Index of the encoded channel
+//! \param quality Quality preset
+//! \param dst 8 bytes of the encoded block (output)
+static void EncodeBC4Block(const BlockPixels & pixels, unsigned int channel, CompressionQuality quality, unsigned char * dst)
+{
+    float minValue = pixels.mChannels[channel][0];
+    float maxValue = minValue;
+    for (unsigned int p = 1; p < 16; ++p)
+    {
+        minValue = Math::Min(minValue, pixels.mChannels[channel][p]);
+        maxValue = Math::Max(maxValue, pixels.mChannels[channel][p]);
+    }
+
+    const unsigned int numInsets = (quality == COMPRESSIONQUALITY_HIGH) ? 4 : 1;
+    const float insetStep = Math::Max(1.0f, (maxValue - minValue) / 28.0f);
+
+    BlockPalette palette;
+    palette.mNumEntries = 8;
+    float bestError = MAX_BLOCK_ERROR;
+    unsigned int bestValue0 = 0;
+    unsigned int bestValue1 = 0;
+    unsigned char bestIndices[16];
+    for (unsigned int inset0 = 0; inset0 < numInsets; ++inset0)
+    {
+        for (unsigned int inset1 = 0; inset1 < numInsets; ++inset1)
+        {
+            const unsigned int value0 = RoundToByte(maxValue - static_cast<float>(inset0) * insetStep);
+            const unsigned int value1 = RoundToByte(minValue + static_cast<float>(inset1) * insetStep);
+            if ((value0 < value1) || ((value0 == value1) && ((inset0 > 0) || (inset1 > 0))))
+            {
+                continue;
+            }
+
+            BuildBC4Palette(value0, value1, palette.mChannels[channel]);
+            unsigned char indices[16];
+            const float error = FindClosestEntries(pixels, palette, channel, 1, indices);
+            if (error < bestError)
+            {
+                bestError = error;
+                bestValue0 = value0;
+                bestValue1 = value1;
+                for (unsigned int p = 0; p < 16; ++p)
+                {
+                    bestIndices[p] = indices[p];
+                }
+            }
+        }
+    }
+
+    for (unsigned int i = 0; i < 8; ++i)
+    {
+        dst[i] = 0;
+    }
+    BlockBitWriter writer = { dst, 0 };
+    writer.Write(bestValue0, 8);
+    writer.Write(bestValue1, 8);
+    for (unsigned int p = 0; p < 16; ++p)
+    {
+        writer.Write(bestIndices[p], 3);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Quantize the endpoints of a BC7 mode 6 block to 7 bits and a shared p-bit, and find the indices of the pixels
+//! \param pixels Pixels of the block
+//! \param endpoint0 First endpoint, in [0, 255]
+//! \param endpoint1 Second endpoint, in [0, 255]
+//! \param quantized0 7 bit RGBA channels of the first endpoint (output)
+//! \param quantized1 7 bit RGBA channels of the second endpoint (output)
+//! \param pBits P-bits of the endpoints (output)
+//! \param indices Index of each pixel (output)
+//! \return Sum of the squared errors of the pixels
+static float QuantizeBC7Mode6Endpoints(const BlockPixels & pixels, const float endpoint0[4], const float endpoint1[4],
+                                       unsigned int quantized0[4], unsigned int quantized1[4], unsigned int pBits[2],
+                                       unsigned char indices[16])
+{
+    const float * endpoints[2] = { endpoint0, endpoint1 };
+    unsigned int * quantized[2] = { quantized0, quantized1 };
+    unsigned int values[2][4];
+    for (unsigned int e = 0; e < 2; ++e)
+    {
+        // Choose the p-bit giving the smallest quantization error of the endpoint
+        float bestError = MAX_BLOCK_ERROR;
+        for (unsigned int pBit = 0; pBit < 2; ++pBit)
+        {
+            unsigned int candidate[4];
+            float error = 0.0f;
+            for (unsigned int c = 0; c < 4; ++c)
+            {
+                candidate[c] = static_cast<unsigned int>(Math::Clamp((endpoints[e][c] - static_cast<float>(pBit)) * 0.5f + 0.5f, 0.0f, 127.0f));
+                const float diff = static_cast<float>(candidate[c] * 2 + pBit) - endpoints[e][c];
+                error += diff * diff;
+            }
+            if (error < bestError)
+            {
+                bestError = error;
+                pBits[e] = pBit;
+                for (unsigned int c = 0; c < 4; ++c)
+                {
+                    quantized[e][c] = candidate[c];
+                    values[e][c] = candidate[c] * 2 + pBit;
+                }
+            }
+        }
+    }
+
+    BlockPalette palette;
+    palette.mNumEntries = 16;
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+        for (unsigned int c = 0; c < 4; ++c)
+        {
+            palette.mChannels[c][i] = static_cast<float>(((64 - BC7_WEIGHTS_4[i]) * values[0][c] + BC7_WEIGHTS_4[i] * values[1][c] + 32) >> 6);
+        }
+    }
+    return FindClosestEntries(pixels, palette, 0, 4, indices);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Encode a BC7 block, using mode 6 only (one subset, RGBA endpoints of 7 bits with p-bits, 4 bit indices)
+//! \param pixels Pixels of the block
+//! \param quality Quality preset
+//! \param dst 16 bytes of the encoded block (output)
+static void EncodeBC7Block(const BlockPixels & pixels, CompressionQuality quality, unsigned char * dst)
+{
+    float entryWeights[16];
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+        entryWeights[i] = static_cast<float>(BC7_WEIGHTS_4[i]) / 64.0f;
+    }
+
+    float endpoint0[4];
+    float endpoint1[4];
+    FitEndpoints(pixels, 0, 4, quality, endpoint0, endpoint1);
+
+    unsigned int quantized0[4];
+    unsigned int quantized1[4];
+    unsigned int pBits[2];
+    unsigned char indices[16];
+    float error = QuantizeBC7Mode6Endpoints(pixels, endpoint0, endpoint1, quantized0, quantized1, pBits, indices);
+
+    if (quality == COMPRESSIONQUALITY_HIGH)
+    {
+        for (unsigned int i = 0; (i < NUM_REFINEMENT_ITERATIONS) && (error > 0.0f); ++i)
+        {
+            RefineEndpoints(pixels, 0, 4, indices, entryWeights, endpoint0, endpoint1);
+
+            unsigned int refined0[4];
+            unsigned int refined1[4];
+            unsigned int refinedPBits[2];
+            unsigned char refinedIndices[16];
+            const float refinedError = QuantizeBC7Mode6Endpoints(pixels, endpoint0, endpoint1, refined0, refined1, refinedPBits, refinedIndices);
+            if (refinedError >= error)
+            {
+                break;
+            }
+            error = refinedError;
+            for (unsigned int c = 0; c < 4; ++c)
+            {
+                quantized0[c] = refined0[c];
+                quantized1[c] = refined1[c];
+            }
+            pBits[0] = refinedPBits[0];
+            pBits[1] = refinedPBits[1];
+            for (unsigned int p = 0; p < 16; ++p)
+            {
+                indices[p] = refinedIndices[p];
+            }
+        }
+    }
+
+    // The most significant bit of the anchor index is implicit, swap the endpoints when it is set
+    if (indices[0] >= 8)
+    {
+        for (unsigned int c = 0; c < 4; ++c)
+        {
+            const unsigned int swapped = quantized0[c];
+            quantized0[c] = quantized1[c];
+            quantized1[c] = swapped;
+        }
+        const unsigned int swappedPBit = pBits[0];
+        pBits[0] = pBits[1];
+        pBits[1] = swappedPBit;
+        for (unsigned int p = 0; p < 16; ++p)
+        {
+            indices[p] = static_cast<unsigned char>(15 - indices[p]);
+        }
+    }
+
+    for (unsigned int i = 0; i < 16; ++i)
+    {
+        dst[i] = 0;
+    }
+    BlockBitWriter writer = { dst, 0 };
+    writer.Write(1 << 6, 7);
+    for (unsigned int c = 0; c < 4; ++c)
+    {
+        writer.Write(quantized0[c], 7);
+        writer.Write(quantized1[c], 7);
+    }
+    writer.Write(pBits[0], 1);
+    writer.Write(pBits[1], 1);
+    writer.Write(indices[0], 3);
+    for (unsigned int p = 1; p < 16; ++p)
+    {
+        writer.Write(indices[p], 4);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Decode the color part of a BC1 or BC3 block
+//! \param src 8 bytes of the encoded block
+//! \param allowThreeColors True for BC1, false for BC3
+//! \param decodedPixels RGBA8 values of the 16 pixels (output, alpha written only when allowThreeColors is true)
+static void DecodeBC1ColorBlock(const unsigned char * src, bool allowThreeColors, unsigned char decodedPixels[16 * 4])
+{
+    const unsigned int packedColor0 = src[0] | (src[1] << 8);
+    const unsigned int packedColor1 = src[2] | (src[3] << 8);
+    unsigned int colors[4][4];
+    BuildBC1Palette(packedColor0, packedColor1, allowThreeColors, colors);
+    const unsigned int numChannels = allowThreeColors ? 4 : 3;
+    for (unsigned int p = 0; p < 16; ++p)
+    {
+        const unsigned int index = (src[4 + p / 4] >> ((p % 4) * 2)) & 3;
+        for (unsigned int c = 0; c < numChannels; ++c)
+        {
+            decodedPixels[p * 4 + c] = static_cast<unsigned char>(colors[index][c]);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Decode a BC4 block to one channel
+//! \param src 8 bytes of the encoded block
+//! \param channel Index of the decoded channel
+//! \param decodedPixels RGBA8 values of the 16 pixels (output, only the channel is written)
+static void DecodeBC4Block(const unsigned char * src, unsigned int channel, unsigned char decodedPixels[16 * 4])
+{
+    float values[8];
+    BuildBC4Palette(src[0], src[1], values);
+    BlockBitReader reader = { src, 16 };
+    for (unsigned int p = 0; p < 16; ++p)
+    {
+        decodedPixels[p * 4 + channel] = static_cast<unsigned char>(RoundToByte(values[reader.Read(3)]));
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Decode a BC7 mode 6 block, other modes are decoded to black
+//! \param src 16 bytes of the encoded block
+//! \param decodedPixels RGBA8 values of the 16 pixels (output)
+static void DecodeBC7Block(const unsigned char * src, unsigned char decodedPixels[16 * 4])
+{
+    BlockBitReader reader = { src, 0 };
+    if (reader.Read(7) != (1 << 6))
+    {
+        for (unsigned int i = 0; i < 16 * 4; ++i)
+        {
+            decodedPixels[i] = 0;
+        }
+        return;
+    }
+
+    unsigned int values[2][4];
+    for (unsigned int c = 0; c < 4; ++c)
+    {
+        values[0][c] = reader.Read(7) << 1;
+        values[1][c] = reader.Read(7) << 1;
+    }
+    const unsigned int pBit0 = reader.Read(1);
+    const unsigned int pBit1 = reader.Read(1);
+    for (unsigned int c = 0; c < 4; ++c)
+    {
+        values[0][c] |= pBit0;
+        values[1][c] |= pBit1;
+    }
+
+    for (unsigned int p = 0; p < 16; ++p)
+    {
+        const unsigned int index = reader.Read((p == 0) ? 3 : 4);
+        for (unsigned int c = 0; c < 4; ++c)
+        {
+            decodedPixels[p * 4 + c] = static_cast<unsigned char>(((64 - BC7_WEIGHTS_4[index]) * values[0][c] + BC7_WEIGHTS_4[index] * values[1][c] + 32) >> 6);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool IsBlockCompressedFormat(Core::Format format)
+{
+    switch (format)
+    {
+        case Core::FORMAT_BC1_UNORM:
+        case Core::FORMAT_BC1_UNORM_SRGB:
+        case Core::FORMAT_BC3_UNORM:
+        case Core::FORMAT_BC3_UNORM_SRGB:
+        case Core::FORMAT_BC5_UNORM:
+        case Core::FORMAT_BC7_UNORM:
+        case Core::FORMAT_BC7_UNORM_SRGB:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int GetCompressedBlockSize(Core::Format format)
+{
+    PG_ASSERTSTR(IsBlockCompressedFormat(format), "Invalid block compressed format (%d)", format);
+    return ((format == Core::FORMAT_BC1_UNORM) || (format == Core::FORMAT_BC1_UNORM_SRGB)) ? 8 : 16;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int GetCompressedImageSize(Core::Format format, unsigned int width, unsigned int height)
+{
+    return GetNumCompressedBlocks(width) * GetNumCompressedBlocks(height) * GetCompressedBlockSize(format);
+}
+
+//----------------------------------------------------------------------------------------
+
+void CompressBlockRows(Core::Format format,
+                       CompressionQuality quality,
+                       const unsigned char * rgbaData,
+                       unsigned int width,
+                       unsigned int height,
+                       unsigned int firstBlockRow,
+                       unsigned int numBlockRows,
+                       unsigned char * compressedData)
+{
+    PG_ASSERTSTR(rgbaData != nullptr, "Invalid image given to the block compression");
+    PG_ASSERTSTR(compressedData != nullptr, "Invalid compressed image given to the block compression");
+    PG_ASSERTSTR(quality < NUM_COMPRESSIONQUALITIES, "Invalid compression quality (%d)", quality);
+
+    const unsigned int numBlocksX = GetNumCompressedBlocks(width);
+    const unsigned int blockSize = GetCompressedBlockSize(format);
+    const unsigned int lastBlockRow = Math::Min(firstBlockRow + numBlockRows, GetNumCompressedBlocks(height));
+    BlockPixels pixels;
+    for (unsigned int blockY = firstBlockRow; blockY < lastBlockRow; ++blockY)
+    {
+        unsigned char * dst = compressedData + blockY * numBlocksX * blockSize;
+        for (unsigned int blockX = 0; blockX < numBlocksX; ++blockX, dst += blockSize)
+        {
+            LoadBlock(rgbaData, width, height, blockX, blockY, pixels);
+            switch (format)
+            {
+                case Core::FORMAT_BC1_UNORM:
+                case Core::FORMAT_BC1_UNORM_SRGB:
+                    EncodeBC1ColorBlock(pixels, quality, dst);
+                    break;
+
+                case Core::FORMAT_BC3_UNORM:
+                case Core::FORMAT_BC3_UNORM_SRGB:
+                    EncodeBC4Block(pixels, 3, quality, dst);
+                    EncodeBC1ColorBlock(pixels, quality, dst + 8);
+                    break;
+
+                case Core::FORMAT_BC5_UNORM:
+                    EncodeBC4Block(pixels, 0, quality, dst);
+                    EncodeBC4Block(pixels, 1, quality, dst + 8);
+                    break;
+
+                case Core::FORMAT_BC7_UNORM:
+                case Core::FORMAT_BC7_UNORM_SRGB:
+                    EncodeBC7Block(pixels, quality, dst);
+                    break;
+
+                default:
+                    PG_FAILSTR("Invalid block compressed format (%d)", format);
+                    return;
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void DecompressBlockRows(Core::Format format,
+                         const unsigned char * compressedData,
+                         unsigned int width,
+                         unsigned int height,
+                         unsigned int firstBlockRow,
+                         unsigned int numBlockRows,
+                         unsigned char * rgbaData)
+{
+    PG_ASSERTSTR(compressedData != nullptr, "Invalid compressed image given to the block decompression");
+    PG_ASSERTSTR(rgbaData != nullptr, "Invalid image given to the block decompression");
+
+    const unsigned int numBlocksX = GetNumCompressedBlocks(width);
+    const unsigned int blockSize = GetCompressedBlockSize(format);
+    const unsigned int lastBlockRow = Math::Min(firstBlockRow + numBlockRows, GetNumCompressedBlocks(height));
+    unsigned char decodedPixels[16 * 4];
+    for (unsigned int blockY = firstBlockRow; blockY < lastBlockRow; ++blockY)
+    {
+        const unsigned char * src = compressedData + blockY * numBlocksX * blockSize;
+        for (unsigned int blockX = 0; blockX < numBlocksX; ++blockX, src += blockSize)
+        {
+            switch (format)
+            {
+                case Core::FORMAT_BC1_UNORM:
+                case Core::FORMAT_BC1_UNORM_SRGB:
+                    DecodeBC1ColorBlock(src, true, decodedPixels);
+                    break;
+
+                case Core::FORMAT_BC3_UNORM:
+                case Core::FORMAT_BC3_UNORM_SRGB:
+                    DecodeBC4Block(src, 3, decodedPixels);
+                    DecodeBC1ColorBlock(src + 8, false, decodedPixels);
+                    break;
+
+                case Core::FORMAT_BC5_UNORM:
+                    DecodeBC4Block(src, 0, decodedPixels);
+                    DecodeBC4Block(src + 8, 1, decodedPixels);
+                    for (unsigned int p = 0; p < 16; ++p)
+                    {
+                        decodedPixels[p * 4 + 2] = 0;
+                        decodedPixels[p * 4 + 3] = 255;
+                    }
+                    break;
+
+                case Core::FORMAT_BC7_UNORM:
+                case Core::FORMAT_BC7_UNORM_SRGB:
+                    DecodeBC7Block(src, decodedPixels);
+                    break;
+
+                default:
+                    PG_FAILSTR("Invalid block compressed format (%d)", format);
+                    return;
+            }
+            StoreBlock(decodedPixels, width, height, blockX, blockY, rgbaData);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+double ComputePSNR(const unsigned char * rgbaData1, const unsigned char * rgbaData2, unsigned int numPixels, unsigned int numChannels)
+{
+    PG_ASSERTSTR((numChannels >= 1) && (numChannels <= 4), "Invalid number of channels for the PSNR (%u)", numChannels);
+
+    double squaredErrorSum = 0.0;
+    for (unsigned int p = 0; p < numPixels; ++p)
+    {
+        for (unsigned int c = 0; c < numChannels; ++c)
+        {
+            const double diff = static_cast<double>(rgbaData1[p * 4 + c]) - static_cast<double>(rgbaData2[p * 4 + c]);
+            squaredErrorSum += diff * diff;
+        }
+    }
+    if (squaredErrorSum == 0.0)
+    {
+        return 99.0;
+    }
+    const double meanSquaredError = squaredErrorSum / (static_cast<double>(numPixels) * static_cast<double>(numChannels));
+    return 10.0 * Math::Log10(255.0 * 255.0 / meanSquaredError);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
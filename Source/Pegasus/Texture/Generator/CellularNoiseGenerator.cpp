@@ -0,0 +1,70 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   CellularNoiseGenerator.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Texture generator that renders tileable Worley cellular noise
+
+#include "Pegasus/Texture/Generator/CellularNoiseGenerator.h"
+#include "Pegasus/Texture/Noise.h"
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+BEGIN_IMPLEMENT_PROPERTIES(CellularNoiseGenerator)
+    IMPLEMENT_PROPERTY(CellularNoiseGenerator, Color0)
+    IMPLEMENT_PROPERTY(CellularNoiseGenerator, Color1)
+    IMPLEMENT_PROPERTY(CellularNoiseGenerator, Frequency)
+    IMPLEMENT_PROPERTY(CellularNoiseGenerator, Jitter)
+    IMPLEMENT_PROPERTY(CellularNoiseGenerator, Seed)
+END_IMPLEMENT_PROPERTIES(CellularNoiseGenerator)
+
+//----------------------------------------------------------------------------------------
+
+void CellularNoiseGenerator::InitProperties()
+{
+    BEGIN_INIT_PROPERTIES(CellularNoiseGenerator)
+        INIT_PROPERTY(Color0)
+        INIT_PROPERTY(Color1)
+        INIT_PROPERTY(Frequency)
+        INIT_PROPERTY(Jitter)
+        INIT_PROPERTY(Seed)
+    END_INIT_PROPERTIES()
+}
+
+//----------------------------------------------------------------------------------------
+
+void CellularNoiseGenerator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    NoiseSettings settings;
+    settings.mType = NOISETYPE_CELLULAR;
+    settings.mSeed = GetSeed();
+    settings.mFrequency = GetFrequency();
+    settings.mNumOctaves = 1;
+    settings.mGain = 0.5f;
+    settings.mJitter = GetJitter();
+
+    if (!GenerateNoise(data, settings, ToColorRGBA(GetColor0()), ToColorRGBA(GetColor1())))
+    {
+        PG_FAILSTR("Unsupported pixel format (%d) for CellularNoiseGenerator", GetConfiguration().GetPixelFormat());
+    }
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
@@ -12,6 +12,7 @@
 #include "Pegasus/Texture/Generator/ConstantColorGenerator.h"
 #include "Pegasus/Math/Types.h"
 #include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Texture/PixelFormat.h"
 
 namespace Pegasus {
 namespace Texture {
@@ -21,7 +22,57 @@ BEGIN_IMPLEMENT_PROPERTIES(ConstantColorGenerator)
     IMPLEMENT_PROPERTY(ConstantColorGenerator, Color)
 END_IMPLEMENT_PROPERTIES(ConstantColorGenerator)
 
+//----------------------------------------------------------------------------------------
+
+namespace Internal {
+
+//! Parameters of the constant color kernel
+struct ConstantColorParameters
+{
+    TextureData * mData;                //!< Texture data to fill
+    Math::Color8RGBA mColor;            //!< Color of every pixel
+};
+
+//! Constant color kernel, compiled for each pixel format
+template <typename Pixel>
+struct ConstantColorKernel
+{
+    static void Run(const ConstantColorParameters & parameters)
+    {
+        const TextureConfiguration & configuration = parameters.mData->GetConfiguration();
+        const unsigned int numLayers = configuration.GetNumLayers();
+        const unsigned int numPixelsPerLayer = configuration.GetNumPixelsPerLayer();
+
+        typename Pixel::ChannelType pixel[Pixel::NUM_CHANNELS];
+        Pixel::FromColor8(parameters.mColor, pixel);
+
+        // For each layer, copy the constant color to each pixel
+        for (unsigned int layer = 0; layer < numLayers; ++layer)
+        {
+            Pixel::Fill(reinterpret_cast<typename Pixel::ChannelType *>(parameters.mData->GetLayerImageData(layer)), numPixelsPerLayer, pixel);
+        }
+    }
+};
 
+//! Constant color kernel for RGBA8, filling 32 bits at a time
+template <>
+struct ConstantColorKernel<PixelRGBA8Unorm>
+{
+    static void Run(const ConstantColorParameters & parameters)
+    {
+        const TextureConfiguration & configuration = parameters.mData->GetConfiguration();
+        const unsigned int numLayers = configuration.GetNumLayers();
+        const unsigned int numBytesPerLayer = configuration.GetNumBytesPerLayer();
+
+        // For each layer, copy the constant color to each pixel
+        for (unsigned int layer = 0; layer < numLayers; ++layer)
+        {
+            Utils::Memset32(parameters.mData->GetLayerImageData(layer), parameters.mColor.rgba32, numBytesPerLayer);
+        }
+    }
+};
+
+}   // namespace Internal
 
 //----------------------------------------------------------------------------------------
 
@@ -43,31 +94,14 @@ void ConstantColorGenerator::GenerateData()
     TextureData * data = static_cast<TextureData *>(&(*dataRef));
     PG_ASSERT(data != nullptr);
 
-    const Math::PUInt32 color32 = GetColor().rgba32;
-    
-    const TextureConfiguration & configuration = GetConfiguration();
-    const unsigned int numBytesPerPixel = configuration.GetNumBytesPerPixel();
-    const unsigned int numLayers = configuration.GetNumLayers();
-    const unsigned int numBytesPerLayer = configuration.GetNumBytesPerLayer();
-    
-    unsigned char * layerData;
-    unsigned int layer;
-
-    // For each layer
-    for (layer = 0; layer < numLayers; ++layer)
-    {
-        layerData = data->GetLayerImageData(layer);
-
-        switch (numBytesPerPixel)
-        {
-            case 4:
-                // For each pixel, copy the constant color
-                Utils::Memset32(layerData, color32, numBytesPerLayer);
-                break;
+    Internal::ConstantColorParameters parameters;
+    parameters.mData = data;
+    parameters.mColor = GetColor();
 
-            default:
-                PG_FAILSTR("Unsupported number of bytes per pixel (%d) for ConstantColorGenerator", numBytesPerPixel);
-        }
+    const Core::Format pixelFormat = GetConfiguration().GetPixelFormat();
+    if (!RunPixelKernel<Internal::ConstantColorKernel>(pixelFormat, parameters))
+    {
+        PG_FAILSTR("Unsupported pixel format (%d) for ConstantColorGenerator", pixelFormat);
     }
 
     PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::END_SUCCESS);
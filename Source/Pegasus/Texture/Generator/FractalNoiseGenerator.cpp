@@ -0,0 +1,74 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   FractalNoiseGenerator.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Texture generator that renders tileable fractal (fBm or ridged) noise
+
+#include "Pegasus/Texture/Generator/FractalNoiseGenerator.h"
+#include "Pegasus/Texture/Noise.h"
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+BEGIN_IMPLEMENT_PROPERTIES(FractalNoiseGenerator)
+    IMPLEMENT_PROPERTY(FractalNoiseGenerator, Color0)
+    IMPLEMENT_PROPERTY(FractalNoiseGenerator, Color1)
+    IMPLEMENT_PROPERTY(FractalNoiseGenerator, Frequency)
+    IMPLEMENT_PROPERTY(FractalNoiseGenerator, NumOctaves)
+    IMPLEMENT_PROPERTY(FractalNoiseGenerator, Gain)
+    IMPLEMENT_PROPERTY(FractalNoiseGenerator, Ridged)
+    IMPLEMENT_PROPERTY(FractalNoiseGenerator, Seed)
+END_IMPLEMENT_PROPERTIES(FractalNoiseGenerator)
+
+//----------------------------------------------------------------------------------------
+
+void FractalNoiseGenerator::InitProperties()
+{
+    BEGIN_INIT_PROPERTIES(FractalNoiseGenerator)
+        INIT_PROPERTY(Color0)
+        INIT_PROPERTY(Color1)
+        INIT_PROPERTY(Frequency)
+        INIT_PROPERTY(NumOctaves)
+        INIT_PROPERTY(Gain)
+        INIT_PROPERTY(Ridged)
+        INIT_PROPERTY(Seed)
+    END_INIT_PROPERTIES()
+}
+
+//----------------------------------------------------------------------------------------
+
+void FractalNoiseGenerator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    NoiseSettings settings;
+    settings.mType = GetRidged() ? NOISETYPE_RIDGED : NOISETYPE_FBM;
+    settings.mSeed = GetSeed();
+    settings.mFrequency = GetFrequency();
+    settings.mNumOctaves = GetNumOctaves();
+    settings.mGain = GetGain();
+    settings.mJitter = 0.0f;
+
+    if (!GenerateNoise(data, settings, ToColorRGBA(GetColor0()), ToColorRGBA(GetColor1())))
+    {
+        PG_FAILSTR("Unsupported pixel format (%d) for FractalNoiseGenerator", GetConfiguration().GetPixelFormat());
+    }
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
@@ -11,6 +11,7 @@
 
 #include "Pegasus/Texture/Generator/GradientGenerator.h"
 #include "Pegasus/Math/Plane.h"
+#include "Pegasus/Texture/PixelFormat.h"
 #include "Pegasus/Texture/Shared/TextureEventDefs.h"
 
 namespace Pegasus {
@@ -26,6 +27,82 @@ END_IMPLEMENT_PROPERTIES(GradientGenerator)
 
 //----------------------------------------------------------------------------------------
 
+namespace Internal {
+
+//! Parameters of the gradient kernel
+struct GradientParameters
+{
+    TextureData * mData;                //!< Texture data to fill
+    Math::ColorRGBA mColor0;            //!< Color of the first plane
+    Math::ColorRGBA mColorDiff;         //!< Difference between the colors of the second and first planes
+    const Math::Plane * mPlane0;        //!< First plane, with a normalized normal
+    float mPlaneNormalLengthRcp;        //!< Inverse of the distance between the planes
+};
+
+//! Gradient kernel, compiled for each pixel format
+template <typename Pixel>
+struct GradientKernel
+{
+    static void Run(const GradientParameters & parameters)
+    {
+        const TextureConfiguration & configuration = parameters.mData->GetConfiguration();
+        const unsigned int width = configuration.GetWidth();
+        const float widthRcp = 1.0f / static_cast<float>(width);
+        const unsigned int height = configuration.GetHeight();
+        const float heightRcp = 1.0f / static_cast<float>(height);
+        const unsigned int depth = configuration.GetDepth();
+        const float depthRcp = 1.0f / static_cast<float>(depth);
+        const unsigned int numLayers = configuration.GetNumLayers();
+
+        typename Pixel::ChannelType * layerData;
+        unsigned int layer, x, y, z;
+        Math::Vec3 currentPoint;
+        float distance0, lerpFactor;
+        Math::ColorRGBA colorF;
+
+        // For each layer
+        for (layer = 0; layer < numLayers; ++layer)
+        {
+            layerData = reinterpret_cast<typename Pixel::ChannelType *>(parameters.mData->GetLayerImageData(layer));
+
+            // For each pixel, compute the coordinates in normalized space
+            for (z = 0; z < depth; ++z)
+            {
+                currentPoint.z = (static_cast<float>(z) + 0.5f) * depthRcp;
+                for (y = 0; y < height; ++y)
+                {
+                    currentPoint.y = (static_cast<float>(y) + 0.5f) * heightRcp;
+                    for (x = 0; x < width; ++x)
+                    {
+                        currentPoint.x = (static_cast<float>(x) + 0.5f) * widthRcp;
+
+                        // Compute the distance from the first plane
+                        // (no need to compute the distance from the second plane,
+                        //  as we know they are parallel and we know the distance between them)
+                        distance0 = parameters.mPlane0->DistanceOfPoint(currentPoint);
+
+                        // Scale the distance from the first plane (so a point in the second plane
+                        // has a distance of 0 from the first plane) to obtain a lerp factor.
+                        // Clamp the result to clamp the gradient.
+                        lerpFactor = Math::Saturate(distance0 * parameters.mPlaneNormalLengthRcp);
+
+                        // Apply linear interpolation to the color
+                        colorF = parameters.mColor0 + lerpFactor * parameters.mColorDiff;
+
+                        // Convert the color to the pixel format and store the pixel
+                        Pixel::FromColor(colorF, layerData);
+                        layerData += Pixel::NUM_CHANNELS;
+                    }
+                }
+            }
+        }
+    }
+};
+
+}   // namespace Internal
+
+//----------------------------------------------------------------------------------------
+
 void GradientGenerator::InitProperties()
 {
     BEGIN_INIT_PROPERTIES(GradientGenerator)
@@ -47,20 +124,12 @@ void GradientGenerator::GenerateData()
     TextureData * data = static_cast<TextureData *>(&(*dataRef));
     PG_ASSERT(data != nullptr);
 
+    Internal::GradientParameters parameters;
+    parameters.mData = data;
+
     // Conversion of the color parameters to floating point numbers
-    const Math::ColorRGBA color0F(ToColorRGBA(GetColor0()));
-    const Math::ColorRGBA color1F(ToColorRGBA(GetColor1()));
-    const Math::ColorRGBA colorDiffF(color1F - color0F);
-
-    const TextureConfiguration & configuration = GetConfiguration();
-    const unsigned int width = configuration.GetWidth();
-    const float widthRcp = 1.0f / static_cast<float>(width);
-    const unsigned int height = configuration.GetHeight();
-    const float heightRcp = 1.0f / static_cast<float>(height);
-    const unsigned int depth = configuration.GetDepth();
-    const float depthRcp = 1.0f / static_cast<float>(depth);
-    const unsigned int numBytesPerPixel = configuration.GetNumBytesPerPixel();
-    const unsigned int numLayers = configuration.GetNumLayers();
+    parameters.mColor0 = ToColorRGBA(GetColor0());
+    parameters.mColorDiff = ToColorRGBA(GetColor1()) - parameters.mColor0;
 
     // To calculate the gradient, we consider two parallel planes,
     // the first one for which all points use color0, and the second one for color1.
@@ -74,65 +143,17 @@ void GradientGenerator::GenerateData()
         point1.x = point0.x + PEG_PLANE_NORMAL_EPSILON;
     }
     Math::Vec3 planeNormal(point1 - point0);
-    const float planeNormalLengthRcp = RcpLength(planeNormal);
-    planeNormal *= planeNormalLengthRcp;
+    parameters.mPlaneNormalLengthRcp = RcpLength(planeNormal);
+    planeNormal *= parameters.mPlaneNormalLengthRcp;
     const Math::Plane plane0(planeNormal, point0);
+    parameters.mPlane0 = &plane0;
 
-    Math::PUInt32 * layerData32;
-    unsigned int layer, x, y, z;
-    Math::Vec3 currentPoint;
-    float distance0, lerpFactor;
-    Math::ColorRGBA colorF;
-    Math::Color8RGBA color;
-
-    // For each layer
-    for (layer = 0; layer < numLayers; ++layer)
+    const Core::Format pixelFormat = GetConfiguration().GetPixelFormat();
+    if (!RunPixelKernel<Internal::GradientKernel>(pixelFormat, parameters))
     {
-        switch (numBytesPerPixel)
-        {
-            case 4:
-                {
-                    layerData32 = reinterpret_cast<Math::PUInt32 *>(data->GetLayerImageData(layer));
-
-                    // For each pixel, compute the coordinates in normalized space
-                    for (z = 0; z < depth; ++z)
-                    {
-                        currentPoint.z = (static_cast<float>(z) + 0.5f) * depthRcp;
-                        for (y = 0; y < height; ++y)
-                        {
-                            currentPoint.y = (static_cast<float>(y) + 0.5f) * heightRcp;
-                            for (x = 0; x < width; ++x)
-                            {
-                                currentPoint.x = (static_cast<float>(x) + 0.5f) * widthRcp;
-
-                                // Compute the distance from the first plane
-                                // (no need to compute the distance from the second plane,
-                                //  as we know they are parallel and we know the distance between them)
-                                distance0 = plane0.DistanceOfPoint(currentPoint);
-
-                                // Scale the distance from the first plane (so a point in the second plane
-                                // has a distance of 0 from the first plane) to obtain a lerp factor.
-                                // Clamp the result to clamp the gradient.
-                                lerpFactor = Math::Saturate(distance0 * planeNormalLengthRcp);
-
-                                // Apply linear interpolation to the color
-                                colorF = color0F + lerpFactor * colorDiffF;
-
-                                // Convert the color to 8 bits
-                                color = colorF;
-
-                                // Store the pixel
-                                *layerData32++ = color.rgba32;
-                            }
-                        }
-                    }
-                }
-                break;
-                
-            default:
-                PG_FAILSTR("Unsupported number of bytes per pixel (%d) for GradientGenerator", numBytesPerPixel);
-        }
+        PG_FAILSTR("Unsupported pixel format (%d) for GradientGenerator", pixelFormat);
     }
+
     PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::END_SUCCESS);
 }
 
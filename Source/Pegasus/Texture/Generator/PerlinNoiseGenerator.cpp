@@ -0,0 +1,68 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   PerlinNoiseGenerator.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Texture generator that renders tileable Perlin gradient noise
+
+#include "Pegasus/Texture/Generator/PerlinNoiseGenerator.h"
+#include "Pegasus/Texture/Noise.h"
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+BEGIN_IMPLEMENT_PROPERTIES(PerlinNoiseGenerator)
+    IMPLEMENT_PROPERTY(PerlinNoiseGenerator, Color0)
+    IMPLEMENT_PROPERTY(PerlinNoiseGenerator, Color1)
+    IMPLEMENT_PROPERTY(PerlinNoiseGenerator, Frequency)
+    IMPLEMENT_PROPERTY(PerlinNoiseGenerator, Seed)
+END_IMPLEMENT_PROPERTIES(PerlinNoiseGenerator)
+
+//----------------------------------------------------------------------------------------
+
+void PerlinNoiseGenerator::InitProperties()
+{
+    BEGIN_INIT_PROPERTIES(PerlinNoiseGenerator)
+        INIT_PROPERTY(Color0)
+        INIT_PROPERTY(Color1)
+        INIT_PROPERTY(Frequency)
+        INIT_PROPERTY(Seed)
+    END_INIT_PROPERTIES()
+}
+
+//----------------------------------------------------------------------------------------
+
+void PerlinNoiseGenerator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    NoiseSettings settings;
+    settings.mType = NOISETYPE_GRADIENT;
+    settings.mSeed = GetSeed();
+    settings.mFrequency = GetFrequency();
+    settings.mNumOctaves = 1;
+    settings.mGain = 0.5f;
+    settings.mJitter = 0.0f;
+
+    if (!GenerateNoise(data, settings, ToColorRGBA(GetColor0()), ToColorRGBA(GetColor1())))
+    {
+        PG_FAILSTR("Unsupported pixel format (%d) for PerlinNoiseGenerator", GetConfiguration().GetPixelFormat());
+    }
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
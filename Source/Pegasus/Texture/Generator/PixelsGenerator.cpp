@@ -12,6 +12,7 @@
 #include "Pegasus/Texture/Generator/PixelsGenerator.h"
 #include "Pegasus/Math/Types.h"
 #include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Texture/PixelFormat.h"
 #include <stdlib.h>
 
 namespace Pegasus {
@@ -51,6 +52,89 @@ static inline unsigned int ChooseRandomPixel(unsigned int width,
     return (pz * height + py) * width + px;
 }
 
+//! Parameters of the pixels kernel
+struct PixelsParameters
+{
+    TextureData * mData;                //!< Texture data to fill
+    Math::Color8RGBA mBackgroundColor;  //!< Color of the background pixels
+    Math::Color8RGBA mColor0;           //!< Color of the random pixels
+    unsigned int mNumPixels;            //!< Number of random pixels to render
+};
+
+//! Pixels kernel, compiled for each pixel format.
+//! The random number generator must be initialized by the caller
+template <typename Pixel>
+struct PixelsKernel
+{
+    static void Run(const PixelsParameters & parameters)
+    {
+        const TextureConfiguration & configuration = parameters.mData->GetConfiguration();
+        const unsigned int width  = configuration.GetWidth ();
+        const unsigned int height = configuration.GetHeight();
+        const unsigned int depth  = configuration.GetDepth ();
+        const unsigned int numLayers = configuration.GetNumLayers();
+        const unsigned int numPixelsPerLayer = configuration.GetNumPixelsPerLayer();
+
+        typename Pixel::ChannelType backgroundPixel[Pixel::NUM_CHANNELS];
+        typename Pixel::ChannelType pixel0[Pixel::NUM_CHANNELS];
+        Pixel::FromColor8(parameters.mBackgroundColor, backgroundPixel);
+        Pixel::FromColor8(parameters.mColor0, pixel0);
+
+        typename Pixel::ChannelType * layerData;
+        unsigned int layer, p, c;
+
+        // For each layer
+        for (layer = 0; layer < numLayers; ++layer)
+        {
+            // For each background pixel, copy the background color
+            layerData = reinterpret_cast<typename Pixel::ChannelType *>(parameters.mData->GetLayerImageData(layer));
+            Pixel::Fill(layerData, numPixelsPerLayer, backgroundPixel);
+
+            // For each random pixel
+            for (p = 0; p < parameters.mNumPixels; ++p)
+            {
+                typename Pixel::ChannelType * randomPixel = layerData + ChooseRandomPixel(width, height, depth) * Pixel::NUM_CHANNELS;
+                for (c = 0; c < Pixel::NUM_CHANNELS; ++c)
+                {
+                    randomPixel[c] = pixel0[c];
+                }
+            }
+        }
+    }
+};
+
+//! Pixels kernel for RGBA8, filling the background 32 bits at a time
+template <>
+struct PixelsKernel<PixelRGBA8Unorm>
+{
+    static void Run(const PixelsParameters & parameters)
+    {
+        const TextureConfiguration & configuration = parameters.mData->GetConfiguration();
+        const unsigned int width  = configuration.GetWidth ();
+        const unsigned int height = configuration.GetHeight();
+        const unsigned int depth  = configuration.GetDepth ();
+        const unsigned int numLayers = configuration.GetNumLayers();
+        const unsigned int numBytesPerLayer = configuration.GetNumBytesPerLayer();
+
+        Math::PUInt32 * layerData32;
+        unsigned int layer, p;
+
+        // For each layer
+        for (layer = 0; layer < numLayers; ++layer)
+        {
+            // For each background pixel, copy the background color
+            layerData32 = reinterpret_cast<Math::PUInt32 *>(parameters.mData->GetLayerImageData(layer));
+            Utils::Memset32(layerData32, parameters.mBackgroundColor.rgba32, numBytesPerLayer);
+
+            // For each random pixel
+            for (p = 0; p < parameters.mNumPixels; ++p)
+            {
+                layerData32[ChooseRandomPixel(width, height, depth)] = parameters.mColor0.rgba32;
+            }
+        }
+    }
+};
+
 }   // namespace Internal
 
 //----------------------------------------------------------------------------------------
@@ -77,48 +161,19 @@ void PixelsGenerator::GenerateData()
     TextureData * data = static_cast<TextureData *>(&(*dataRef));
     PG_ASSERT(data != nullptr);
 
-    const Math::PUInt32 backColor32 = GetBackgroundColor().rgba32;
-    const Math::PUInt32 color0_32 = GetColor0().rgba32;
-    
-    const TextureConfiguration & configuration = GetConfiguration();
-    const unsigned int width  = configuration.GetWidth ();
-    const unsigned int height = configuration.GetHeight();
-    const unsigned int depth  = configuration.GetDepth ();
-    const unsigned int numBytesPerPixel = configuration.GetNumBytesPerPixel();
-    const unsigned int numLayers = configuration.GetNumLayers();
-    const unsigned int numBytesPerLayer = configuration.GetNumBytesPerLayer();
-
-    const unsigned int numPixelsToRender = GetNumPixels();
+    Internal::PixelsParameters parameters;
+    parameters.mData = data;
+    parameters.mBackgroundColor = GetBackgroundColor();
+    parameters.mColor0 = GetColor0();
+    parameters.mNumPixels = GetNumPixels();
 
     // Initialize the random number generator
     srand(GetSeed());
 
-    unsigned char * layerData;
-    Math::PUInt32 * layerData32;
-    unsigned int layer, p;
-
-    // For each layer
-    for (layer = 0; layer < numLayers; ++layer)
+    const Core::Format pixelFormat = GetConfiguration().GetPixelFormat();
+    if (!RunPixelKernel<Internal::PixelsKernel>(pixelFormat, parameters))
     {
-        layerData = data->GetLayerImageData(layer);
-
-        switch (numBytesPerPixel)
-        {
-            case 4:
-                // For each background pixel, copy the background color
-                layerData32 = reinterpret_cast<Math::PUInt32 *>(layerData);
-                Utils::Memset32(layerData32, backColor32, numBytesPerLayer);
-
-                // For each random pixel
-                for (p = 0; p < numPixelsToRender; ++p)
-                {
-                    layerData32[Internal::ChooseRandomPixel(width, height, depth)] = color0_32;
-                }
-            break;
-
-            default:
-                PG_FAILSTR("Unsupported number of bytes per pixel (%d) for PixelsGenerator", numBytesPerPixel);
-        }
+        PG_FAILSTR("Unsupported pixel format (%d) for PixelsGenerator", pixelFormat);
     }
 
     PEGASUS_EVENT_DISPATCH(this, TextureNodeGenerationEvent, TextureNodeGenerationEvent::END_SUCCESS);
@@ -0,0 +1,778 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   ImageFilter.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Image processing filters of the texture operators (blur, normal map, levels, blend, warp)
+
+#include "Pegasus/Texture/ImageFilter.h"
+#include "Pegasus/Texture/TextureData.h"
+#include "Pegasus/Texture/PixelFormat.h"
+#include "Pegasus/Math/Scalar.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Core/Thread.h"
+
+#if PEGASUS_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Pegasus {
+namespace Texture {
+
+
+namespace Internal {
+
+//! Number of intervals of the gamma curve table of the levels
+static const unsigned int LEVELS_CURVE_SIZE = 1024;
+
+//----------------------------------------------------------------------------------------
+
+// 4 floats processed at once: the RGBA channels of a pixel, or a channel of 4 pixels
+
+#if PEGASUS_SIMD_SSE2
+
+typedef __m128 Float4;
+
+inline Float4 SetF(float v)                             { return _mm_set1_ps(v); }
+inline Float4 SetF(float x, float y, float z, float w)  { return _mm_setr_ps(x, y, z, w); }
+inline Float4 LoadF(const float * src)                  { return _mm_loadu_ps(src); }
+inline void StoreF(float * dst, Float4 a)               { _mm_storeu_ps(dst, a); }
+inline Float4 AddF(Float4 a, Float4 b)                  { return _mm_add_ps(a, b); }
+inline Float4 SubF(Float4 a, Float4 b)                  { return _mm_sub_ps(a, b); }
+inline Float4 MulF(Float4 a, Float4 b)                  { return _mm_mul_ps(a, b); }
+inline Float4 DivF(Float4 a, Float4 b)                  { return _mm_div_ps(a, b); }
+inline Float4 MinF(Float4 a, Float4 b)                  { return _mm_min_ps(a, b); }
+inline Float4 MaxF(Float4 a, Float4 b)                  { return _mm_max_ps(a, b); }
+inline Float4 SqrtF(Float4 a)                           { return _mm_sqrt_ps(a); }
+
+//! Select a when x < threshold, b otherwise
+inline Float4 SelectLessF(Float4 x, Float4 threshold, Float4 a, Float4 b)
+{
+    const __m128 mask = _mm_cmplt_ps(x, threshold);
+    return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+}
+
+//! Replace the alpha channel of a pixel
+inline Float4 SetAlphaF(Float4 pixel, Float4 alphaPixel)
+{
+    const __m128 rgbMask = _mm_castsi128_ps(_mm_setr_epi32(-1, -1, -1, 0));
+    return _mm_or_ps(_mm_and_ps(rgbMask, pixel), _mm_andnot_ps(rgbMask, alphaPixel));
+}
+
+#else
+
+struct Float4 { float v[4]; };
+
+#define PEGASUS_FILTER_FLOAT4_OP(expression) Float4 r; for (unsigned int i = 0; i < 4; ++i) { r.v[i] = (expression); } return r;
+
+inline Float4 SetF(float v)                             { PEGASUS_FILTER_FLOAT4_OP(v) }
+inline Float4 SetF(float x, float y, float z, float w)  { Float4 r; r.v[0] = x; r.v[1] = y; r.v[2] = z; r.v[3] = w; return r; }
+inline Float4 LoadF(const float * src)                  { PEGASUS_FILTER_FLOAT4_OP(src[i]) }
+inline void StoreF(float * dst, Float4 a)               { for (unsigned int i = 0; i < 4; ++i) { dst[i] = a.v[i]; } }
+inline Float4 AddF(Float4 a, Float4 b)                  { PEGASUS_FILTER_FLOAT4_OP(a.v[i] + b.v[i]) }
+inline Float4 SubF(Float4 a, Float4 b)                  { PEGASUS_FILTER_FLOAT4_OP(a.v[i] - b.v[i]) }
+inline Float4 MulF(Float4 a, Float4 b)                  { PEGASUS_FILTER_FLOAT4_OP(a.v[i] * b.v[i]) }
+inline Float4 DivF(Float4 a, Float4 b)                  { PEGASUS_FILTER_FLOAT4_OP(a.v[i] / b.v[i]) }
+inline Float4 MinF(Float4 a, Float4 b)                  { PEGASUS_FILTER_FLOAT4_OP((a.v[i] < b.v[i]) ? a.v[i] : b.v[i]) }
+inline Float4 MaxF(Float4 a, Float4 b)                  { PEGASUS_FILTER_FLOAT4_OP((a.v[i] > b.v[i]) ? a.v[i] : b.v[i]) }
+inline Float4 SqrtF(Float4 a)                           { PEGASUS_FILTER_FLOAT4_OP(Math::Sqrt(a.v[i])) }
+inline Float4 SelectLessF(Float4 x, Float4 threshold, Float4 a, Float4 b) { PEGASUS_FILTER_FLOAT4_OP((x.v[i] < threshold.v[i]) ? a.v[i] : b.v[i]) }
+inline Float4 SetAlphaF(Float4 pixel, Float4 alphaPixel) { pixel.v[3] = alphaPixel.v[3]; return pixel; }
+
+#undef PEGASUS_FILTER_FLOAT4_OP
+
+#endif  // PEGASUS_SIMD_SSE2
+
+//! Linear interpolation between two vectors
+inline Float4 LerpF(Float4 a, Float4 b, Float4 t)
+{
+    return AddF(a, MulF(t, SubF(b, a)));
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Get the index of a pixel along an axis, handling the pixels out of the image
+//! \param i Index of the pixel, possibly out of the image
+//! \param size Number of pixels along the axis
+//! \param wrap True to wrap around the edges, false to clamp
+//! \return Index of the pixel in [0, size)
+inline unsigned int EdgeIndex(int i, unsigned int size, bool wrap)
+{
+    const int n = static_cast<int>(size);
+    if ((i >= 0) && (i < n))
+    {
+        return static_cast<unsigned int>(i);
+    }
+    if (wrap)
+    {
+        const int m = i % n;
+        return static_cast<unsigned int>((m < 0) ? (m + n) : m);
+    }
+    return (i < 0) ? 0 : (size - 1);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Parameters of the kernel reading an image
+struct ReadImageParameters
+{
+    const TextureData * mData;          //!< Texture data to read
+    unsigned int mLayer;                //!< Index of the layer
+    unsigned int mSlice;                //!< Index of the slice
+    float * mPixels;                    //!< Image receiving the RGBA pixels
+};
+
+//! Kernel reading an image, compiled for each pixel format
+template <typename Pixel>
+struct ReadImageKernel
+{
+    static void Run(const ReadImageParameters & parameters)
+    {
+        const TextureConfiguration & configuration = parameters.mData->GetConfiguration();
+        const unsigned int numPixels = configuration.GetWidth() * configuration.GetHeight();
+        const typename Pixel::ChannelType * pixel = reinterpret_cast<const typename Pixel::ChannelType *>(parameters.mData->GetLayerImageData(parameters.mLayer))
+                                                  + parameters.mSlice * numPixels * Pixel::NUM_CHANNELS;
+        float * dst = parameters.mPixels;
+        Math::ColorRGBA color;
+        for (unsigned int p = 0; p < numPixels; ++p, pixel += Pixel::NUM_CHANNELS, dst += 4)
+        {
+            Pixel::ToColor(pixel, color);
+            dst[0] = color.v[0];
+            dst[1] = color.v[1];
+            dst[2] = color.v[2];
+            dst[3] = color.v[3];
+        }
+    }
+};
+
+//! Parameters of the kernel writing an image
+struct WriteImageParameters
+{
+    TextureData * mData;                //!< Texture data to write
+    unsigned int mLayer;                //!< Index of the layer
+    unsigned int mSlice;                //!< Index of the slice
+    const float * mPixels;              //!< Image of RGBA pixels
+};
+
+//! Kernel writing an image, compiled for each pixel format
+template <typename Pixel>
+struct WriteImageKernel
+{
+    static void Run(const WriteImageParameters & parameters)
+    {
+        const TextureConfiguration & configuration = parameters.mData->GetConfiguration();
+        const unsigned int numPixels = configuration.GetWidth() * configuration.GetHeight();
+        typename Pixel::ChannelType * pixel = reinterpret_cast<typename Pixel::ChannelType *>(parameters.mData->GetLayerImageData(parameters.mLayer))
+                                            + parameters.mSlice * numPixels * Pixel::NUM_CHANNELS;
+        const float * src = parameters.mPixels;
+        for (unsigned int p = 0; p < numPixels; ++p, pixel += Pixel::NUM_CHANNELS, src += 4)
+        {
+            Pixel::FromColor(Math::ColorRGBA(src[0], src[1], src[2], src[3]), pixel);
+        }
+    }
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Horizontal box pass on a range of rows, with a running sum
+//! \param src Source image
+//! \param dst Destination image
+//! \param width Width of the images in pixels
+//! \param radius Radius of the box in pixels
+//! \param wrap True to wrap around the edges, false to clamp
+//! \param firstRow First row of the job
+//! \param numRows Number of rows of the job
+static void BoxBlurRows(const float * src, float * dst, unsigned int width, unsigned int radius, bool wrap,
+                        unsigned int firstRow, unsigned int numRows)
+{
+    const int r = static_cast<int>(radius);
+    const Float4 scale = SetF(1.0f / static_cast<float>(2 * radius + 1));
+    for (unsigned int y = firstRow; y < firstRow + numRows; ++y)
+    {
+        const float * srcRow = src + y * width * 4;
+        float * dstRow = dst + y * width * 4;
+
+        Float4 sum = SetF(0.0f);
+        for (int i = -r; i <= r; ++i)
+        {
+            sum = AddF(sum, LoadF(srcRow + EdgeIndex(i, width, wrap) * 4));
+        }
+        for (int x = 0; x < static_cast<int>(width); ++x)
+        {
+            StoreF(dstRow + x * 4, MulF(sum, scale));
+            sum = AddF(sum, SubF(LoadF(srcRow + EdgeIndex(x + r + 1, width, wrap) * 4),
+                                 LoadF(srcRow + EdgeIndex(x - r, width, wrap) * 4)));
+        }
+    }
+}
+
+//! Vertical box pass on a tile of columns, with one running sum per column.
+//! The rows are traversed in order, so the memory accesses stay sequential
+//! \param src Source image
+//! \param dst Destination image
+//! \param width Width of the images in pixels
+//! \param height Height of the images in pixels
+//! \param radius Radius of the box in pixels
+//! \param wrap True to wrap around the edges, false to clamp
+//! \param firstColumn First column of the tile
+//! \param numColumns Number of columns of the tile (<= FILTER_COLUMNS_PER_TILE)
+static void BoxBlurColumns(const float * src, float * dst, unsigned int width, unsigned int height, unsigned int radius, bool wrap,
+                           unsigned int firstColumn, unsigned int numColumns)
+{
+    const int r = static_cast<int>(radius);
+    const Float4 scale = SetF(1.0f / static_cast<float>(2 * radius + 1));
+    const unsigned int rowStride = width * 4;
+    src += firstColumn * 4;
+    dst += firstColumn * 4;
+
+    Float4 sums[FILTER_COLUMNS_PER_TILE];
+    unsigned int c;
+    for (c = 0; c < numColumns; ++c)
+    {
+        sums[c] = SetF(0.0f);
+    }
+    for (int i = -r; i <= r; ++i)
+    {
+        const float * srcRow = src + EdgeIndex(i, height, wrap) * rowStride;
+        for (c = 0; c < numColumns; ++c)
+        {
+            sums[c] = AddF(sums[c], LoadF(srcRow + c * 4));
+        }
+    }
+
+    for (int y = 0; y < static_cast<int>(height); ++y)
+    {
+        float * dstRow = dst + y * rowStride;
+        const float * addRow = src + EdgeIndex(y + r + 1, height, wrap) * rowStride;
+        const float * subRow = src + EdgeIndex(y - r, height, wrap) * rowStride;
+        for (c = 0; c < numColumns; ++c)
+        {
+            StoreF(dstRow + c * 4, MulF(sums[c], scale));
+            sums[c] = AddF(sums[c], SubF(LoadF(addRow + c * 4), LoadF(subRow + c * 4)));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Compute a range of rows of a normal map with a Sobel filter, 4 pixels at a time
+//! \param heightBuffer Heights with a border of one pixel
+//! \param normalPixels Image receiving the normal map
+//! \param width Width of the image in pixels
+//! \param strength Height in pixels of a height value of 1
+//! \param firstRow First row of the job
+//! \param numRows Number of rows of the job
+static void NormalMapRows(const float * heightBuffer, float * normalPixels, unsigned int width, float strength,
+                          unsigned int firstRow, unsigned int numRows)
+{
+    const unsigned int stride = width + 2;
+    const Float4 two = SetF(2.0f);
+    const Float4 one = SetF(1.0f);
+    const Float4 half = SetF(0.5f);
+    const Float4 slopeScale = SetF(strength * 0.125f);
+    float nx[4], ny[4], nz[4], h[4];
+
+    for (unsigned int y = firstRow; y < firstRow + numRows; ++y)
+    {
+        const float * top = heightBuffer + y * stride;
+        const float * middle = top + stride;
+        const float * bottom = middle + stride;
+        float * dstRow = normalPixels + y * width * 4;
+
+        for (unsigned int x = 0; x < width; x += 4)
+        {
+            const Float4 topLeft = LoadF(top + x);
+            const Float4 topRight = LoadF(top + x + 2);
+            const Float4 left = LoadF(middle + x);
+            const Float4 right = LoadF(middle + x + 2);
+            const Float4 bottomLeft = LoadF(bottom + x);
+            const Float4 bottomRight = LoadF(bottom + x + 2);
+
+            // Slopes in height units per pixel, the rows going down
+            const Float4 slopeX = MulF(SubF(AddF(AddF(topRight, MulF(two, right)), bottomRight),
+                                            AddF(AddF(topLeft, MulF(two, left)), bottomLeft)), slopeScale);
+            const Float4 slopeY = MulF(SubF(AddF(AddF(bottomLeft, MulF(two, LoadF(bottom + x + 1))), bottomRight),
+                                            AddF(AddF(topLeft, MulF(two, LoadF(top + x + 1))), topRight)), slopeScale);
+
+            // Normal (-slopeX, slopeY, 1) normalized, green pointing up the image
+            const Float4 lengthRcp = DivF(one, SqrtF(AddF(AddF(MulF(slopeX, slopeX), MulF(slopeY, slopeY)), one)));
+            StoreF(nx, AddF(MulF(SubF(SetF(0.0f), MulF(slopeX, lengthRcp)), half), half));
+            StoreF(ny, AddF(MulF(MulF(slopeY, lengthRcp), half), half));
+            StoreF(nz, AddF(MulF(lengthRcp, half), half));
+            StoreF(h, LoadF(middle + x + 1));
+
+            const unsigned int numPixels = Math::Min(4u, width - x);
+            for (unsigned int i = 0; i < numPixels; ++i)
+            {
+                float * dst = dstRow + (x + i) * 4;
+                dst[0] = nx[i];
+                dst[1] = ny[i];
+                dst[2] = nz[i];
+                dst[3] = h[i];
+            }
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Settings of the levels shared by the jobs
+struct LevelsSettings
+{
+    Float4 mInputBlack;                         //!< Input black of the RGB channels, 0 for alpha
+    Float4 mInputScale;                         //!< Inverse of the input range of the RGB channels, 1 for alpha
+    float mCurve[LEVELS_CURVE_SIZE + 1];        //!< Output value of the input values i / LEVELS_CURVE_SIZE
+};
+
+//! Apply the levels to a range of rows
+//! \param settings Settings of the levels
+//! \param pixels Image to modify
+//! \param width Width of the image in pixels
+//! \param firstRow First row of the job
+//! \param numRows Number of rows of the job
+static void LevelsRows(const LevelsSettings & settings, float * pixels, unsigned int width,
+                       unsigned int firstRow, unsigned int numRows)
+{
+    const Float4 zero = SetF(0.0f);
+    const Float4 curveScale = SetF(static_cast<float>(LEVELS_CURVE_SIZE));
+    float position[4];
+
+    float * pixel = pixels + firstRow * width * 4;
+    const unsigned int numPixels = numRows * width;
+    for (unsigned int p = 0; p < numPixels; ++p, pixel += 4)
+    {
+        // Input range and position in the curve table, in [0, LEVELS_CURVE_SIZE]
+        const Float4 value = MinF(MaxF(MulF(SubF(LoadF(pixel), settings.mInputBlack), settings.mInputScale), zero), SetF(1.0f));
+        StoreF(position, MulF(value, curveScale));
+
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            const unsigned int index = Math::Min(static_cast<unsigned int>(position[c]), LEVELS_CURVE_SIZE - 1);
+            const float fraction = position[c] - static_cast<float>(index);
+            pixel[c] = settings.mCurve[index] + fraction * (settings.mCurve[index + 1] - settings.mCurve[index]);
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Blend function of a blend mode
+template <BlendMode Mode> inline Float4 BlendPixel(Float4 a, Float4 b);
+
+template <> inline Float4 BlendPixel<BLENDMODE_MIX>(Float4 a, Float4 b)
+{
+    return b;
+}
+
+template <> inline Float4 BlendPixel<BLENDMODE_MULTIPLY>(Float4 a, Float4 b)
+{
+    return MulF(a, b);
+}
+
+template <> inline Float4 BlendPixel<BLENDMODE_SCREEN>(Float4 a, Float4 b)
+{
+    return SubF(AddF(a, b), MulF(a, b));
+}
+
+template <> inline Float4 BlendPixel<BLENDMODE_OVERLAY>(Float4 a, Float4 b)
+{
+    const Float4 one = SetF(1.0f);
+    const Float4 two = SetF(2.0f);
+    const Float4 multiply = MulF(two, MulF(a, b));
+    const Float4 screen = SubF(one, MulF(two, MulF(SubF(one, a), SubF(one, b))));
+    return SelectLessF(a, SetF(0.5f), multiply, screen);
+}
+
+//! Blend a range of rows, compiled for each blend mode
+//! \param pixels First image, receiving the result
+//! \param layerPixels Second image
+//! \param width Width of the images in pixels
+//! \param opacity Interpolation factor between the first image and the blended image
+//! \param firstRow First row of the job
+//! \param numRows Number of rows of the job
+template <BlendMode Mode>
+void BlendRows(float * pixels, const float * layerPixels, unsigned int width, float opacity,
+               unsigned int firstRow, unsigned int numRows)
+{
+    const Float4 opacityF = SetF(opacity);
+    const unsigned int firstPixel = firstRow * width;
+    const unsigned int lastPixel = firstPixel + numRows * width;
+    for (unsigned int p = firstPixel; p < lastPixel; ++p)
+    {
+        const Float4 a = LoadF(pixels + p * 4);
+        const Float4 blended = BlendPixel<Mode>(a, LoadF(layerPixels + p * 4));
+        StoreF(pixels + p * 4, SetAlphaF(LerpF(a, blended, opacityF), a));
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Warp a range of rows, sampling the source image with bilinear filtering
+//! \param srcPixels Image to distort
+//! \param displacementPixels Displacement image
+//! \param dstPixels Image receiving the distorted image
+//! \param width Width of the images in pixels
+//! \param height Height of the images in pixels
+//! \param strength Offset of a displacement of 1, relative to the size of the image
+//! \param wrap True to wrap around the edges, false to clamp
+//! \param firstRow First row of the job
+//! \param numRows Number of rows of the job
+static void WarpRows(const float * srcPixels, const float * displacementPixels, float * dstPixels,
+                     unsigned int width, unsigned int height, float strength, bool wrap,
+                     unsigned int firstRow, unsigned int numRows)
+{
+    // The displacement in [0, 1] is remapped to [-1, 1]
+    const float scaleX = 2.0f * strength * static_cast<float>(width);
+    const float scaleY = 2.0f * strength * static_cast<float>(height);
+    for (unsigned int y = firstRow; y < firstRow + numRows; ++y)
+    {
+        const float * displacement = displacementPixels + y * width * 4;
+        float * dst = dstPixels + y * width * 4;
+        for (unsigned int x = 0; x < width; ++x, displacement += 4, dst += 4)
+        {
+            const float sampleX = static_cast<float>(x) + (displacement[0] - 0.5f) * scaleX;
+            const float sampleY = static_cast<float>(y) + (displacement[1] - 0.5f) * scaleY;
+            const float floorX = Math::Floor(sampleX);
+            const float floorY = Math::Floor(sampleY);
+            const int x0 = static_cast<int>(floorX);
+            const int y0 = static_cast<int>(floorY);
+            const unsigned int column0 = EdgeIndex(x0, width, wrap) * 4;
+            const unsigned int column1 = EdgeIndex(x0 + 1, width, wrap) * 4;
+            const float * row0 = srcPixels + EdgeIndex(y0, height, wrap) * width * 4;
+            const float * row1 = srcPixels + EdgeIndex(y0 + 1, height, wrap) * width * 4;
+
+            const Float4 fractionX = SetF(sampleX - floorX);
+            const Float4 top = LerpF(LoadF(row0 + column0), LoadF(row0 + column1), fractionX);
+            const Float4 bottom = LerpF(LoadF(row1 + column0), LoadF(row1 + column1), fractionX);
+            StoreF(dst, LerpF(top, bottom, SetF(sampleY - floorY)));
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Arguments of the jobs of a filter, run by Core::RunParallelJobs().
+//! Each job processes FILTER_ROWS_PER_JOB rows, or FILTER_COLUMNS_PER_TILE columns for the vertical blur passes
+struct FilterJobs
+{
+    const float * mSrcPixels;               //!< Image read by the filter
+    const float * mSecondPixels;            //!< Second image read by the filter (layer, displacement), nullptr if none
+    float * mDstPixels;                     //!< Image written by the filter, can be mSrcPixels for the filters working in place
+    unsigned int mWidth;                    //!< Width of the images in pixels
+    unsigned int mHeight;                   //!< Height of the images in pixels
+    unsigned int mRadius;                   //!< Radius of the box blur pass
+    float mAmount;                          //!< Opacity of the blend, strength of the normal map and of the warp
+    bool mWrap;                             //!< True to wrap around the edges, false to clamp
+    const LevelsSettings * mLevels;         //!< Settings of the levels, nullptr for the other filters
+};
+
+//! Function running a job of a filter
+typedef void (*FilterJobFunc)(void * userData, unsigned int jobIndex, unsigned int workerIndex);
+
+//! Get the range of rows or columns of a job
+//! \param jobIndex Index of the job
+//! \param numItemsPerJob Number of rows or columns of a job
+//! \param numItems Total number of rows or columns of the image
+//! \param first Index of the first row or column of the job (output)
+//! \return Number of rows or columns of the job
+inline unsigned int GetJobRange(unsigned int jobIndex, unsigned int numItemsPerJob, unsigned int numItems, unsigned int & first)
+{
+    first = jobIndex * numItemsPerJob;
+    return Math::Min(numItemsPerJob, numItems - first);
+}
+
+//! Run the jobs of a filter in parallel, returning once all of them are complete
+//! \param jobFunc Function running a job
+//! \param jobs Arguments of the jobs
+//! \param numItemsPerJob Number of rows or columns of a job
+//! \param numItems Total number of rows or columns of the image
+inline void RunFilterJobs(FilterJobFunc jobFunc, FilterJobs & jobs, unsigned int numItemsPerJob, unsigned int numItems)
+{
+    Core::RunParallelJobs(jobFunc, &jobs, (numItems + numItemsPerJob - 1) / numItemsPerJob, 0);
+}
+
+static void BoxBlurRowsJob(void * userData, unsigned int jobIndex, unsigned int workerIndex)
+{
+    const FilterJobs & jobs = *static_cast<const FilterJobs *>(userData);
+    unsigned int firstRow;
+    const unsigned int numRows = GetJobRange(jobIndex, FILTER_ROWS_PER_JOB, jobs.mHeight, firstRow);
+    BoxBlurRows(jobs.mSrcPixels, jobs.mDstPixels, jobs.mWidth, jobs.mRadius, jobs.mWrap, firstRow, numRows);
+}
+
+static void BoxBlurColumnsJob(void * userData, unsigned int jobIndex, unsigned int workerIndex)
+{
+    const FilterJobs & jobs = *static_cast<const FilterJobs *>(userData);
+    unsigned int firstColumn;
+    const unsigned int numColumns = GetJobRange(jobIndex, FILTER_COLUMNS_PER_TILE, jobs.mWidth, firstColumn);
+    BoxBlurColumns(jobs.mSrcPixels, jobs.mDstPixels, jobs.mWidth, jobs.mHeight, jobs.mRadius, jobs.mWrap, firstColumn, numColumns);
+}
+
+static void NormalMapRowsJob(void * userData, unsigned int jobIndex, unsigned int workerIndex)
+{
+    const FilterJobs & jobs = *static_cast<const FilterJobs *>(userData);
+    unsigned int firstRow;
+    const unsigned int numRows = GetJobRange(jobIndex, FILTER_ROWS_PER_JOB, jobs.mHeight, firstRow);
+    NormalMapRows(jobs.mSrcPixels, jobs.mDstPixels, jobs.mWidth, jobs.mAmount, firstRow, numRows);
+}
+
+static void LevelsRowsJob(void * userData, unsigned int jobIndex, unsigned int workerIndex)
+{
+    const FilterJobs & jobs = *static_cast<const FilterJobs *>(userData);
+    unsigned int firstRow;
+    const unsigned int numRows = GetJobRange(jobIndex, FILTER_ROWS_PER_JOB, jobs.mHeight, firstRow);
+    LevelsRows(*jobs.mLevels, jobs.mDstPixels, jobs.mWidth, firstRow, numRows);
+}
+
+//! Blend job, compiled for each blend mode
+template <BlendMode Mode>
+void BlendRowsJob(void * userData, unsigned int jobIndex, unsigned int workerIndex)
+{
+    const FilterJobs & jobs = *static_cast<const FilterJobs *>(userData);
+    unsigned int firstRow;
+    const unsigned int numRows = GetJobRange(jobIndex, FILTER_ROWS_PER_JOB, jobs.mHeight, firstRow);
+    BlendRows<Mode>(jobs.mDstPixels, jobs.mSecondPixels, jobs.mWidth, jobs.mAmount, firstRow, numRows);
+}
+
+static void WarpRowsJob(void * userData, unsigned int jobIndex, unsigned int workerIndex)
+{
+    const FilterJobs & jobs = *static_cast<const FilterJobs *>(userData);
+    unsigned int firstRow;
+    const unsigned int numRows = GetJobRange(jobIndex, FILTER_ROWS_PER_JOB, jobs.mHeight, firstRow);
+    WarpRows(jobs.mSrcPixels, jobs.mSecondPixels, jobs.mDstPixels, jobs.mWidth, jobs.mHeight, jobs.mAmount, jobs.mWrap, firstRow, numRows);
+}
+
+}   // namespace Internal
+
+//----------------------------------------------------------------------------------------
+
+bool ReadFilterImage(const TextureData * data, unsigned int layer, unsigned int slice, float * pixels)
+{
+    PG_ASSERT(data != nullptr);
+    PG_ASSERT(pixels != nullptr);
+    PG_ASSERT(slice < data->GetConfiguration().GetDepth());
+
+    Internal::ReadImageParameters parameters;
+    parameters.mData = data;
+    parameters.mLayer = layer;
+    parameters.mSlice = slice;
+    parameters.mPixels = pixels;
+    return RunPixelKernel<Internal::ReadImageKernel>(data->GetConfiguration().GetPixelFormat(), parameters);
+}
+
+//----------------------------------------------------------------------------------------
+
+bool WriteFilterImage(TextureData * data, unsigned int layer, unsigned int slice, const float * pixels)
+{
+    PG_ASSERT(data != nullptr);
+    PG_ASSERT(pixels != nullptr);
+    PG_ASSERT(slice < data->GetConfiguration().GetDepth());
+
+    Internal::WriteImageParameters parameters;
+    parameters.mData = data;
+    parameters.mLayer = layer;
+    parameters.mSlice = slice;
+    parameters.mPixels = pixels;
+    return RunPixelKernel<Internal::WriteImageKernel>(data->GetConfiguration().GetPixelFormat(), parameters);
+}
+
+//----------------------------------------------------------------------------------------
+
+void ComputeGaussianBoxRadii(float sigma, unsigned int radii[MAX_BLUR_PASSES])
+{
+    if (sigma <= 0.0f)
+    {
+        for (unsigned int pass = 0; pass < MAX_BLUR_PASSES; ++pass)
+        {
+            radii[pass] = 0;
+        }
+        return;
+    }
+
+    // Successive boxes converge to a Gaussian. The box widths are the odd integers wl and wl + 2
+    // whose combination has the variance of the Gaussian (Kovesi, "Fast almost-Gaussian filtering")
+    const float numPasses = static_cast<float>(MAX_BLUR_PASSES);
+    const float variance12 = 12.0f * sigma * sigma;
+    int lowerWidth = static_cast<int>(Math::Floor(Math::Sqrt(variance12 / numPasses + 1.0f)));
+    if ((lowerWidth & 1) == 0)
+    {
+        --lowerWidth;
+    }
+    const float lower = static_cast<float>(lowerWidth);
+    const float numLowerPasses = (variance12 - numPasses * lower * lower - 4.0f * numPasses * lower - 3.0f * numPasses) / (-4.0f * lower - 4.0f);
+    const int numLower = static_cast<int>(Math::Floor(numLowerPasses + 0.5f));
+    for (unsigned int pass = 0; pass < MAX_BLUR_PASSES; ++pass)
+    {
+        const int boxWidth = (static_cast<int>(pass) < numLower) ? lowerWidth : (lowerWidth + 2);
+        radii[pass] = static_cast<unsigned int>((boxWidth - 1) / 2);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void BlurImage(float * pixels,
+               float * tempPixels,
+               unsigned int width,
+               unsigned int height,
+               const unsigned int * radii,
+               unsigned int numPasses,
+               bool wrap)
+{
+    PG_ASSERT((pixels != nullptr) && (tempPixels != nullptr) && (radii != nullptr));
+    PG_ASSERTSTR(numPasses <= MAX_BLUR_PASSES, "Invalid number of blur passes (%u)", numPasses);
+
+    Internal::FilterJobs jobs = { nullptr, nullptr, nullptr, width, height, 0, 0.0f, wrap, nullptr };
+
+    // The passes alternate between the two images, the jobs of a pass running in parallel
+    float * src = pixels;
+    float * dst = tempPixels;
+    float * swap;
+    unsigned int pass;
+    for (pass = 0; pass < numPasses; ++pass)
+    {
+        if (radii[pass] > 0)
+        {
+            jobs.mSrcPixels = src;
+            jobs.mDstPixels = dst;
+            jobs.mRadius = radii[pass];
+            Internal::RunFilterJobs(Internal::BoxBlurRowsJob, jobs, FILTER_ROWS_PER_JOB, height);
+            swap = src; src = dst; dst = swap;
+        }
+    }
+    for (pass = 0; pass < numPasses; ++pass)
+    {
+        if (radii[pass] > 0)
+        {
+            jobs.mSrcPixels = src;
+            jobs.mDstPixels = dst;
+            jobs.mRadius = radii[pass];
+            Internal::RunFilterJobs(Internal::BoxBlurColumnsJob, jobs, FILTER_COLUMNS_PER_TILE, width);
+            swap = src; src = dst; dst = swap;
+        }
+    }
+
+    if (src != pixels)
+    {
+        Utils::Memcpy(pixels, src, width * height * 4 * sizeof(float));
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void ComputeNormalMap(const float * heightPixels,
+                      float * normalPixels,
+                      unsigned int width,
+                      unsigned int height,
+                      float strength,
+                      bool wrap,
+                      float * heightBuffer)
+{
+    PG_ASSERT((heightPixels != nullptr) && (normalPixels != nullptr) && (heightBuffer != nullptr));
+
+    // Copy the red channel with a border of one pixel, so the Sobel filter has no edge case
+    const unsigned int stride = width + 2;
+    for (int y = -1; y <= static_cast<int>(height); ++y)
+    {
+        const float * srcRow = heightPixels + Internal::EdgeIndex(y, height, wrap) * width * 4;
+        float * dstRow = heightBuffer + (y + 1) * stride;
+        for (int x = -1; x <= static_cast<int>(width); ++x)
+        {
+            dstRow[x + 1] = srcRow[Internal::EdgeIndex(x, width, wrap) * 4];
+        }
+    }
+
+    // Padding read by the last group of 4 pixels
+    for (unsigned int p = stride * (height + 2); p < GetNormalMapBufferSize(width, height); ++p)
+    {
+        heightBuffer[p] = 0.0f;
+    }
+
+    Internal::FilterJobs jobs = { heightBuffer, nullptr, normalPixels, width, height, 0, strength, wrap, nullptr };
+    Internal::RunFilterJobs(Internal::NormalMapRowsJob, jobs, FILTER_ROWS_PER_JOB, height);
+}
+
+//----------------------------------------------------------------------------------------
+
+void ApplyLevels(float * pixels,
+                 unsigned int width,
+                 unsigned int height,
+                 float inputBlack,
+                 float inputWhite,
+                 float gamma,
+                 float outputBlack,
+                 float outputWhite)
+{
+    PG_ASSERT(pixels != nullptr);
+
+    // An empty input range becomes a threshold
+    float inputRange = inputWhite - inputBlack;
+    if (Math::Abs(inputRange) < 1e-6f)
+    {
+        inputRange = (inputRange < 0.0f) ? -1e-6f : 1e-6f;
+    }
+
+    Internal::LevelsSettings settings;
+    settings.mInputBlack = Internal::SetF(inputBlack, inputBlack, inputBlack, 0.0f);
+    settings.mInputScale = Internal::SetF(1.0f / inputRange, 1.0f / inputRange, 1.0f / inputRange, 1.0f);
+
+    // The gamma curve is tabulated with the output range, the table being linearly interpolated
+    const float exponent = 1.0f / Math::Max(gamma, 0.01f);
+    const float outputRange = outputWhite - outputBlack;
+    for (unsigned int i = 0; i <= Internal::LEVELS_CURVE_SIZE; ++i)
+    {
+        const float value = static_cast<float>(i) / static_cast<float>(Internal::LEVELS_CURVE_SIZE);
+        settings.mCurve[i] = outputBlack + outputRange * ((i == 0) ? 0.0f : Math::Pow(value, exponent));
+    }
+
+    Internal::FilterJobs jobs = { pixels, nullptr, pixels, width, height, 0, 0.0f, false, &settings };
+    Internal::RunFilterJobs(Internal::LevelsRowsJob, jobs, FILTER_ROWS_PER_JOB, height);
+}
+
+//----------------------------------------------------------------------------------------
+
+void BlendImages(float * pixels,
+                 const float * layerPixels,
+                 unsigned int width,
+                 unsigned int height,
+                 BlendMode mode,
+                 float opacity)
+{
+    PG_ASSERT((pixels != nullptr) && (layerPixels != nullptr));
+
+    Internal::FilterJobs jobs = { pixels, layerPixels, pixels, width, height, 0, Math::Saturate(opacity), false, nullptr };
+    switch (mode)
+    {
+        case BLENDMODE_MIX:         Internal::RunFilterJobs(Internal::BlendRowsJob<BLENDMODE_MIX     >, jobs, FILTER_ROWS_PER_JOB, height);  break;
+        case BLENDMODE_MULTIPLY:    Internal::RunFilterJobs(Internal::BlendRowsJob<BLENDMODE_MULTIPLY>, jobs, FILTER_ROWS_PER_JOB, height);  break;
+        case BLENDMODE_SCREEN:      Internal::RunFilterJobs(Internal::BlendRowsJob<BLENDMODE_SCREEN  >, jobs, FILTER_ROWS_PER_JOB, height);  break;
+        case BLENDMODE_OVERLAY:     Internal::RunFilterJobs(Internal::BlendRowsJob<BLENDMODE_OVERLAY >, jobs, FILTER_ROWS_PER_JOB, height);  break;
+
+        default:
+            PG_FAILSTR("Invalid blend mode (%d)", mode);
+            break;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void WarpImage(const float * srcPixels,
+               const float * displacementPixels,
+               float * dstPixels,
+               unsigned int width,
+               unsigned int height,
+               float strength,
+               bool wrap)
+{
+    PG_ASSERT((srcPixels != nullptr) && (displacementPixels != nullptr) && (dstPixels != nullptr));
+    PG_ASSERT((dstPixels != srcPixels) && (dstPixels != displacementPixels));
+
+    Internal::FilterJobs jobs = { srcPixels, displacementPixels, dstPixels, width, height, 0, strength, wrap, nullptr };
+    Internal::RunFilterJobs(Internal::WarpRowsJob, jobs, FILTER_ROWS_PER_JOB, height);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
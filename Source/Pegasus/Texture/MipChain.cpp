@@ -0,0 +1,411 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MipChain.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Computation of the mip levels of the texture data from the full resolution level
+
+#include "Pegasus/Texture/MipChain.h"
+#include "Pegasus/Texture/TextureData.h"
+#include "Pegasus/Math/Scalar.h"
+#include "Pegasus/Core/Profiler.h"
+#include "Pegasus/Core/Thread.h"
+
+#if PEGASUS_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Maximum number of taps of the mip filters
+static const unsigned int MAX_MIP_FILTER_TAPS = 6;
+
+//! Number of entries of the table converting linear values to sRGB
+static const unsigned int LINEAR_TO_SRGB_TABLE_SIZE = 4096;
+
+//! Separable filter computing a pixel of a mip level from the previous level.
+//! Pixel x of the level reads the pixels 2 * x + mFirstTap + i of the previous level, for i < mNumTaps
+struct MipFilterKernel
+{
+    unsigned int mNumTaps;                      //!< Number of taps of the filter, in each direction
+    int mFirstTap;                              //!< Offset of the first tap, relative to 2 * x
+    float mWeights[MAX_MIP_FILTER_TAPS];        //!< Normalized weights of the taps
+};
+
+//! Tables shared by all the mip chain generations, built on first use
+struct MipTables
+{
+    MipFilterKernel mKernels[TextureConfiguration::NUM_MIPFILTERS];     //!< Kernel of each filter
+    float mSRGBToLinear[256];                                           //!< sRGB byte to linear value in [0, 255]
+    unsigned char mLinearToSRGB[LINEAR_TO_SRGB_TABLE_SIZE];             //!< Linear value in [0, 1] to sRGB byte
+
+    MipTables();
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Modified Bessel function of the first kind of order 0, for the Kaiser window
+//! \param x Input value
+//! \return I0(x)
+static float BesselI0(float x)
+{
+    float sum = 1.0f;
+    float term = 1.0f;
+    const float halfXSq = 0.25f * x * x;
+    for (unsigned int k = 1; k < 32; ++k)
+    {
+        term *= halfXSq / static_cast<float>(k * k);
+        sum += term;
+        if (term < sum * 1e-7f)
+        {
+            break;
+        }
+    }
+    return sum;
+}
+
+//----------------------------------------------------------------------------------------
+
+MipTables::MipTables()
+{
+    // Box filter, average of the 2x2 pixels covered by the pixel of the level
+    MipFilterKernel & box = mKernels[TextureConfiguration::MIPFILTER_BOX];
+    box.mNumTaps = 2;
+    box.mFirstTap = 0;
+    box.mWeights[0] = 0.5f;
+    box.mWeights[1] = 0.5f;
+
+    // Kaiser-windowed sinc with a radius of 1.5 pixels of the level (3 pixels of the previous level), alpha = 4.
+    // The tap distances to the center of the pixel are 0.25, 0.75 and 1.25 pixels of the level
+    const float radius = 1.5f;
+    const float alpha = 4.0f;
+    MipFilterKernel & kaiser = mKernels[TextureConfiguration::MIPFILTER_KAISER];
+    kaiser.mNumTaps = 6;
+    kaiser.mFirstTap = -2;
+    float sum = 0.0f;
+    for (unsigned int t = 0; t < kaiser.mNumTaps; ++t)
+    {
+        const float distance = Math::Abs(static_cast<float>(static_cast<int>(t) + kaiser.mFirstTap) - 0.5f) * 0.5f;
+        const float sinc = Math::Sin(Math::P_PI * distance) / (Math::P_PI * distance);
+        const float ratio = distance / radius;
+        const float window = BesselI0(alpha * Math::Sqrt(1.0f - ratio * ratio)) / BesselI0(alpha);
+        kaiser.mWeights[t] = sinc * window;
+        sum += kaiser.mWeights[t];
+    }
+    for (unsigned int t = 0; t < kaiser.mNumTaps; ++t)
+    {
+        kaiser.mWeights[t] /= sum;
+    }
+
+    // sRGB conversions, the linear values are kept in [0, 255] like the other channels
+    for (unsigned int i = 0; i < 256; ++i)
+    {
+        const float s = static_cast<float>(i) / 255.0f;
+        const float linear = (s <= 0.04045f) ? (s / 12.92f) : Math::Pow((s + 0.055f) / 1.055f, 2.4f);
+        mSRGBToLinear[i] = linear * 255.0f;
+    }
+    for (unsigned int i = 0; i < LINEAR_TO_SRGB_TABLE_SIZE; ++i)
+    {
+        const float linear = static_cast<float>(i) / static_cast<float>(LINEAR_TO_SRGB_TABLE_SIZE - 1);
+        const float s = (linear <= 0.0031308f) ? (linear * 12.92f) : (1.055f * Math::Pow(linear, 1.0f / 2.4f) - 0.055f);
+        mLinearToSRGB[i] = static_cast<unsigned char>(Math::Clamp(s * 255.0f + 0.5f, 0.0f, 255.0f));
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Get the tables shared by the mip chain generations
+//! \return Tables, built on the first call
+static const MipTables & GetMipTables()
+{
+    static const MipTables sTables;
+    return sTables;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Clamp a pixel coordinate to the edge of a level
+//! \param coord Coordinate to clamp
+//! \param size Size of the level in pixels (>= 1)
+//! \return Coordinate in [0, size - 1]
+inline unsigned int ClampToEdge(int coord, unsigned int size)
+{
+    return (coord < 0) ? 0 : ((static_cast<unsigned int>(coord) >= size) ? (size - 1) : static_cast<unsigned int>(coord));
+}
+
+//----------------------------------------------------------------------------------------
+
+#if PEGASUS_SIMD_SSE2
+
+//! Pixel with 4 float channels in [0, 255], one SSE register
+typedef __m128 MipPixel;
+
+//! Get a pixel with all channels set to 0
+inline MipPixel ZeroPixel()
+{
+    return _mm_setzero_ps();
+}
+
+//! Load an RGBA8 pixel
+//! \param src Pointer to the pixel
+//! \param tables Tables for the sRGB conversion, nullptr for linear pixels
+inline MipPixel LoadPixel(const unsigned char * src, const MipTables * tables)
+{
+    if (tables != nullptr)
+    {
+        return _mm_set_ps(static_cast<float>(src[3]), tables->mSRGBToLinear[src[2]], tables->mSRGBToLinear[src[1]], tables->mSRGBToLinear[src[0]]);
+    }
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i bytes = _mm_cvtsi32_si128(*reinterpret_cast<const int *>(src));
+    return _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(bytes, zero), zero));
+}
+
+//! Accumulate a weighted pixel
+inline MipPixel MulAddPixel(MipPixel acc, MipPixel pixel, float weight)
+{
+    return _mm_add_ps(acc, _mm_mul_ps(pixel, _mm_set1_ps(weight)));
+}
+
+//! Load a pixel of the row buffer
+inline MipPixel LoadRowPixel(const float * src)
+{
+    return _mm_loadu_ps(src);
+}
+
+//! Store a pixel in the row buffer
+inline void StoreRowPixel(float * dst, MipPixel pixel)
+{
+    _mm_storeu_ps(dst, pixel);
+}
+
+//! Store a pixel as RGBA8, clamping the channels
+//! \param dst Pointer to the pixel
+//! \param pixel Pixel to store
+//! \param tables Tables for the sRGB conversion, nullptr for linear pixels
+inline void StorePixel(unsigned char * dst, MipPixel pixel, const MipTables * tables)
+{
+    pixel = _mm_min_ps(_mm_max_ps(pixel, _mm_setzero_ps()), _mm_set1_ps(255.0f));
+    if (tables != nullptr)
+    {
+        float channels[4];
+        _mm_storeu_ps(channels, _mm_mul_ps(pixel, _mm_set_ps(1.0f, static_cast<float>(LINEAR_TO_SRGB_TABLE_SIZE - 1) / 255.0f,
+                                                                   static_cast<float>(LINEAR_TO_SRGB_TABLE_SIZE - 1) / 255.0f,
+                                                                   static_cast<float>(LINEAR_TO_SRGB_TABLE_SIZE - 1) / 255.0f)));
+        dst[0] = tables->mLinearToSRGB[static_cast<unsigned int>(channels[0] + 0.5f)];
+        dst[1] = tables->mLinearToSRGB[static_cast<unsigned int>(channels[1] + 0.5f)];
+        dst[2] = tables->mLinearToSRGB[static_cast<unsigned int>(channels[2] + 0.5f)];
+        dst[3] = static_cast<unsigned char>(channels[3] + 0.5f);
+        return;
+    }
+    const __m128i words = _mm_cvttps_epi32(_mm_add_ps(pixel, _mm_set1_ps(0.5f)));
+    const __m128i halfWords = _mm_packs_epi32(words, words);
+    const __m128i bytes = _mm_packus_epi16(halfWords, halfWords);
+    *reinterpret_cast<int *>(dst) = _mm_cvtsi128_si32(bytes);
+}
+
+#else
+
+//! Pixel with 4 float channels in [0, 255]
+struct MipPixel
+{
+    float mChannels[4];
+};
+
+//! Get a pixel with all channels set to 0
+inline MipPixel ZeroPixel()
+{
+    MipPixel pixel = { { 0.0f, 0.0f, 0.0f, 0.0f } };
+    return pixel;
+}
+
+//! Load an RGBA8 pixel
+//! \param src Pointer to the pixel
+//! \param tables Tables for the sRGB conversion, nullptr for linear pixels
+inline MipPixel LoadPixel(const unsigned char * src, const MipTables * tables)
+{
+    MipPixel pixel;
+    for (unsigned int c = 0; c < 3; ++c)
+    {
+        pixel.mChannels[c] = (tables != nullptr) ? tables->mSRGBToLinear[src[c]] : static_cast<float>(src[c]);
+    }
+    pixel.mChannels[3] = static_cast<float>(src[3]);
+    return pixel;
+}
+
+//! Accumulate a weighted pixel
+inline MipPixel MulAddPixel(MipPixel acc, const MipPixel & pixel, float weight)
+{
+    for (unsigned int c = 0; c < 4; ++c)
+    {
+        acc.mChannels[c] += pixel.mChannels[c] * weight;
+    }
+    return acc;
+}
+
+//! Load a pixel of the row buffer
+inline MipPixel LoadRowPixel(const float * src)
+{
+    MipPixel pixel = { { src[0], src[1], src[2], src[3] } };
+    return pixel;
+}
+
+//! Store a pixel in the row buffer
+inline void StoreRowPixel(float * dst, const MipPixel & pixel)
+{
+    for (unsigned int c = 0; c < 4; ++c)
+    {
+        dst[c] = pixel.mChannels[c];
+    }
+}
+
+//! Store a pixel as RGBA8, clamping the channels
+//! \param dst Pointer to the pixel
+//! \param pixel Pixel to store
+//! \param tables Tables for the sRGB conversion, nullptr for linear pixels
+inline void StorePixel(unsigned char * dst, const MipPixel & pixel, const MipTables * tables)
+{
+    for (unsigned int c = 0; c < 4; ++c)
+    {
+        const float value = Math::Clamp(pixel.mChannels[c], 0.0f, 255.0f);
+        if ((tables != nullptr) && (c < 3))
+        {
+            dst[c] = tables->mLinearToSRGB[static_cast<unsigned int>(value * (static_cast<float>(LINEAR_TO_SRGB_TABLE_SIZE - 1) / 255.0f) + 0.5f)];
+        }
+        else
+        {
+            dst[c] = static_cast<unsigned char>(value + 0.5f);
+        }
+    }
+}
+
+#endif  // PEGASUS_SIMD_SSE2
+
+//----------------------------------------------------------------------------------------
+
+void DownsampleMipRows(const TextureConfiguration & configuration,
+                       const unsigned char * srcLevelData,
+                       unsigned char * dstLevelData,
+                       unsigned int level,
+                       unsigned int firstRow,
+                       unsigned int numRows,
+                       float * rowBuffer)
+{
+    PG_ASSERTSTR(configuration.GetNumBytesPerPixel() == 4, "The mip chain generation supports only RGBA8 textures");
+    PG_ASSERTSTR((level >= 1) && (level < configuration.GetNumMipLevels()), "Invalid mip level (%d), it must be in [1, %d[", level, configuration.GetNumMipLevels());
+    PG_ASSERTSTR(firstRow + numRows <= configuration.GetMipHeight(level), "Invalid range of rows for the mip level %d", level);
+
+    const MipTables & tables = GetMipTables();
+    const MipTables * srgbTables = configuration.IsSRGB() ? &tables : nullptr;
+    const MipFilterKernel & kernel = tables.mKernels[configuration.GetMipFilter()];
+    const unsigned int srcWidth = configuration.GetMipWidth(level - 1);
+    const unsigned int srcHeight = configuration.GetMipHeight(level - 1);
+    const unsigned int dstWidth = configuration.GetMipWidth(level);
+
+    for (unsigned int y = firstRow; y < firstRow + numRows; ++y)
+    {
+        // Vertical pass, combine the source rows covered by the filter into the row buffer, in linear space
+        const unsigned char * srcRows[MAX_MIP_FILTER_TAPS];
+        for (unsigned int t = 0; t < kernel.mNumTaps; ++t)
+        {
+            const unsigned int srcY = ClampToEdge(static_cast<int>(2 * y) + kernel.mFirstTap + static_cast<int>(t), srcHeight);
+            srcRows[t] = srcLevelData + srcY * srcWidth * 4;
+        }
+        for (unsigned int x = 0; x < srcWidth; ++x)
+        {
+            MipPixel acc = ZeroPixel();
+            for (unsigned int t = 0; t < kernel.mNumTaps; ++t)
+            {
+                acc = MulAddPixel(acc, LoadPixel(srcRows[t] + x * 4, srgbTables), kernel.mWeights[t]);
+            }
+            StoreRowPixel(rowBuffer + x * 4, acc);
+        }
+
+        // Horizontal pass, filter the row buffer into the destination row
+        unsigned char * dstRow = dstLevelData + y * dstWidth * 4;
+        for (unsigned int x = 0; x < dstWidth; ++x)
+        {
+            MipPixel acc = ZeroPixel();
+            for (unsigned int t = 0; t < kernel.mNumTaps; ++t)
+            {
+                const unsigned int srcX = ClampToEdge(static_cast<int>(2 * x) + kernel.mFirstTap + static_cast<int>(t), srcWidth);
+                acc = MulAddPixel(acc, LoadRowPixel(rowBuffer + srcX * 4), kernel.mWeights[t]);
+            }
+            StorePixel(dstRow + x * 4, acc, srgbTables);
+        }
+    }
+}
+
+//! Jobs computing the rows of a mip level, run by Core::RunParallelJobs()
+struct MipLevelJobs
+{
+    const TextureConfiguration * mConfiguration;
+    const unsigned char * mSrcLevelData;
+    unsigned char * mDstLevelData;
+    unsigned int mLevel;
+    unsigned int mHeight;                   //!< Height of the level
+    float * mRowBuffers;                    //!< One row buffer per worker
+    unsigned int mRowBufferSize;            //!< Number of floats of each row buffer
+};
+
+//! Compute the MIP_ROWS_PER_JOB rows of a job, with the row buffer of the worker
+static void DownsampleMipJob(void * userData, unsigned int jobIndex, unsigned int workerIndex)
+{
+    const MipLevelJobs & jobs = *static_cast<const MipLevelJobs *>(userData);
+    const unsigned int firstRow = jobIndex * MIP_ROWS_PER_JOB;
+    const unsigned int numRows = (jobs.mHeight - firstRow < MIP_ROWS_PER_JOB) ? (jobs.mHeight - firstRow) : MIP_ROWS_PER_JOB;
+    DownsampleMipRows(*jobs.mConfiguration, jobs.mSrcLevelData, jobs.mDstLevelData, jobs.mLevel,
+                      firstRow, numRows, jobs.mRowBuffers + workerIndex * jobs.mRowBufferSize);
+}
+
+//----------------------------------------------------------------------------------------
+
+void GenerateMipChain(TextureData * data, Alloc::IAllocator * allocator)
+{
+    PG_ASSERTSTR(data != nullptr, "Invalid texture data for the mip chain generation");
+    const TextureConfiguration & configuration = data->GetConfiguration();
+    const unsigned int numMipLevels = configuration.GetNumMipLevels();
+    if (numMipLevels <= 1)
+    {
+        return;
+    }
+
+    PG_PROFILE_SCOPE("GenerateMipChain");
+    unsigned int numWorkers = Core::GetHardwareThreadCount();
+    if (numWorkers > Core::MAX_PARALLEL_WORKERS)
+    {
+        numWorkers = Core::MAX_PARALLEL_WORKERS;
+    }
+
+    MipLevelJobs jobs;
+    jobs.mConfiguration = &configuration;
+    jobs.mRowBufferSize = GetMipRowBufferSize(configuration);
+    jobs.mRowBuffers = PG_NEW_ARRAY(allocator, -1, "Mip chain row buffers", Alloc::PG_MEM_TEMP, float, numWorkers * jobs.mRowBufferSize);
+
+    // The jobs of a level only depend on the previous level, so they run in parallel
+    // and the levels one after the other
+    const unsigned int numLayers = configuration.GetNumLayers();
+    for (unsigned int layer = 0; layer < numLayers; ++layer)
+    {
+        for (unsigned int level = 1; level < numMipLevels; ++level)
+        {
+            jobs.mSrcLevelData = data->GetLayerMipImageData(layer, level - 1);
+            jobs.mDstLevelData = data->GetLayerMipImageData(layer, level);
+            jobs.mLevel = level;
+            jobs.mHeight = configuration.GetMipHeight(level);
+            const unsigned int numJobs = (jobs.mHeight + MIP_ROWS_PER_JOB - 1) / MIP_ROWS_PER_JOB;
+            Core::RunParallelJobs(DownsampleMipJob, &jobs, numJobs, numWorkers);
+        }
+    }
+
+    PG_DELETE_ARRAY(allocator, jobs.mRowBuffers);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
@@ -0,0 +1,602 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Noise.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Tileable procedural noise (gradient, cellular and fractal) for the texture generators
+
+#include "Pegasus/Texture/Noise.h"
+#include "Pegasus/Texture/TextureData.h"
+#include "Pegasus/Texture/PixelFormat.h"
+#include "Pegasus/Math/Scalar.h"
+#include "Pegasus/Utils/Memcpy.h"
+#include "Pegasus/Core/Thread.h"
+
+#if PEGASUS_SIMD_SSE2
+#include <emmintrin.h>
+#endif
+
+namespace Pegasus {
+namespace Texture {
+
+
+namespace Internal {
+
+//! Number of pixels evaluated at once by the noise kernel
+static const unsigned int NOISE_SEGMENT_SIZE = 64;
+
+//! Multipliers of the lattice coordinates before hashing
+static const unsigned int HASH_PRIME_X = 0x8DA6B343;
+static const unsigned int HASH_PRIME_Y = 0xD8163841;
+static const unsigned int HASH_PRIME_Z = 0xCB1AB31F;
+
+//! Scale of the 2D gradient noise, whose projected gradients give values in [-1/sqrt(2), 1/sqrt(2)]
+static const float GRADIENT_NOISE_2D_SCALE = 1.41421356f;
+
+//! Seed increment between two octaves of the fractal noises
+static const unsigned int OCTAVE_SEED_INCREMENT = 0x9E3779B9;
+
+//----------------------------------------------------------------------------------------
+
+// 4-lane vector operations used by the noise functions.
+// The scalar versions perform the same IEEE operations in the same order,
+// so both paths give bit-identical results.
+// The integer lanes are unsigned, the comparisons are only used on values < 2^31.
+
+#if PEGASUS_SIMD_SSE2
+
+typedef __m128 Float4;
+typedef __m128i Int4;
+
+inline Float4 SetF(float v)                             { return _mm_set1_ps(v); }
+inline Float4 AddF(Float4 a, Float4 b)                  { return _mm_add_ps(a, b); }
+inline Float4 SubF(Float4 a, Float4 b)                  { return _mm_sub_ps(a, b); }
+inline Float4 MulF(Float4 a, Float4 b)                  { return _mm_mul_ps(a, b); }
+inline Float4 MinF(Float4 a, Float4 b)                  { return _mm_min_ps(a, b); }
+inline Float4 MaxF(Float4 a, Float4 b)                  { return _mm_max_ps(a, b); }
+inline Float4 SqrtF(Float4 a)                           { return _mm_sqrt_ps(a); }
+inline Float4 AbsF(Float4 a)                            { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+inline Float4 FlipSignF(Float4 a, Int4 signBits)        { return _mm_xor_ps(a, _mm_castsi128_ps(signBits)); }
+inline Float4 SelectF(Int4 mask, Float4 a, Float4 b)    { const __m128 m = _mm_castsi128_ps(mask); return _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b)); }
+inline void StoreF(float * values, Float4 a)            { _mm_storeu_ps(values, a); }
+
+inline Int4 SetI(unsigned int v)                        { return _mm_set1_epi32(static_cast<int>(v)); }
+inline Int4 RampI(unsigned int v)                       { return _mm_setr_epi32(static_cast<int>(v), static_cast<int>(v + 1), static_cast<int>(v + 2), static_cast<int>(v + 3)); }
+inline Int4 AddI(Int4 a, Int4 b)                        { return _mm_add_epi32(a, b); }
+inline Int4 SubI(Int4 a, Int4 b)                        { return _mm_sub_epi32(a, b); }
+inline Int4 AndI(Int4 a, Int4 b)                        { return _mm_and_si128(a, b); }
+inline Int4 OrI(Int4 a, Int4 b)                         { return _mm_or_si128(a, b); }
+inline Int4 XorI(Int4 a, Int4 b)                        { return _mm_xor_si128(a, b); }
+inline Int4 CmpEqI(Int4 a, Int4 b)                      { return _mm_cmpeq_epi32(a, b); }
+inline Int4 CmpLtI(Int4 a, Int4 b)                      { return _mm_cmplt_epi32(a, b); }
+inline Int4 SelectI(Int4 mask, Int4 a, Int4 b)          { return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b)); }
+template <int N> inline Int4 ShiftLeftI(Int4 a)         { return _mm_slli_epi32(a, N); }
+template <int N> inline Int4 ShiftRightI(Int4 a)        { return _mm_srli_epi32(a, N); }
+
+//! Low 32 bits of the products of the lanes (SSE2 has no 32 bits multiplication)
+inline Int4 MulI(Int4 a, Int4 b)
+{
+    const __m128i even = _mm_mul_epu32(a, b);
+    const __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+inline Int4 TruncateF(Float4 a)                         { return _mm_cvttps_epi32(a); }
+inline Float4 ToFloatI(Int4 a)                          { return _mm_cvtepi32_ps(a); }
+
+#else
+
+struct Float4 { float v[4]; };
+struct Int4 { unsigned int v[4]; };
+
+//! Bits of a floating point number
+union FloatBits
+{
+    float f;
+    unsigned int u;
+};
+
+#define PEGASUS_NOISE_FLOAT4_OP(expression) Float4 r; for (unsigned int i = 0; i < 4; ++i) { r.v[i] = (expression); } return r;
+#define PEGASUS_NOISE_INT4_OP(expression) Int4 r; for (unsigned int i = 0; i < 4; ++i) { r.v[i] = (expression); } return r;
+
+inline Float4 SetF(float v)                             { PEGASUS_NOISE_FLOAT4_OP(v) }
+inline Float4 AddF(Float4 a, Float4 b)                  { PEGASUS_NOISE_FLOAT4_OP(a.v[i] + b.v[i]) }
+inline Float4 SubF(Float4 a, Float4 b)                  { PEGASUS_NOISE_FLOAT4_OP(a.v[i] - b.v[i]) }
+inline Float4 MulF(Float4 a, Float4 b)                  { PEGASUS_NOISE_FLOAT4_OP(a.v[i] * b.v[i]) }
+inline Float4 MinF(Float4 a, Float4 b)                  { PEGASUS_NOISE_FLOAT4_OP((a.v[i] < b.v[i]) ? a.v[i] : b.v[i]) }
+inline Float4 MaxF(Float4 a, Float4 b)                  { PEGASUS_NOISE_FLOAT4_OP((a.v[i] > b.v[i]) ? a.v[i] : b.v[i]) }
+inline Float4 SqrtF(Float4 a)                           { PEGASUS_NOISE_FLOAT4_OP(Math::Sqrt(a.v[i])) }
+inline Float4 SelectF(Int4 mask, Float4 a, Float4 b)    { PEGASUS_NOISE_FLOAT4_OP((mask.v[i] != 0) ? a.v[i] : b.v[i]) }
+inline void StoreF(float * values, Float4 a)            { for (unsigned int i = 0; i < 4; ++i) { values[i] = a.v[i]; } }
+
+inline Float4 AbsF(Float4 a)
+{
+    Float4 r;
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        FloatBits bits;
+        bits.f = a.v[i];
+        bits.u &= 0x7FFFFFFF;
+        r.v[i] = bits.f;
+    }
+    return r;
+}
+
+inline Float4 FlipSignF(Float4 a, Int4 signBits)
+{
+    Float4 r;
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        FloatBits bits;
+        bits.f = a.v[i];
+        bits.u ^= signBits.v[i];
+        r.v[i] = bits.f;
+    }
+    return r;
+}
+
+inline Int4 SetI(unsigned int v)                        { PEGASUS_NOISE_INT4_OP(v) }
+inline Int4 RampI(unsigned int v)                       { PEGASUS_NOISE_INT4_OP(v + i) }
+inline Int4 AddI(Int4 a, Int4 b)                        { PEGASUS_NOISE_INT4_OP(a.v[i] + b.v[i]) }
+inline Int4 SubI(Int4 a, Int4 b)                        { PEGASUS_NOISE_INT4_OP(a.v[i] - b.v[i]) }
+inline Int4 AndI(Int4 a, Int4 b)                        { PEGASUS_NOISE_INT4_OP(a.v[i] & b.v[i]) }
+inline Int4 OrI(Int4 a, Int4 b)                         { PEGASUS_NOISE_INT4_OP(a.v[i] | b.v[i]) }
+inline Int4 XorI(Int4 a, Int4 b)                        { PEGASUS_NOISE_INT4_OP(a.v[i] ^ b.v[i]) }
+inline Int4 MulI(Int4 a, Int4 b)                        { PEGASUS_NOISE_INT4_OP(a.v[i] * b.v[i]) }
+inline Int4 CmpEqI(Int4 a, Int4 b)                      { PEGASUS_NOISE_INT4_OP((a.v[i] == b.v[i]) ? 0xFFFFFFFF : 0) }
+inline Int4 CmpLtI(Int4 a, Int4 b)                      { PEGASUS_NOISE_INT4_OP((static_cast<int>(a.v[i]) < static_cast<int>(b.v[i])) ? 0xFFFFFFFF : 0) }
+inline Int4 SelectI(Int4 mask, Int4 a, Int4 b)          { PEGASUS_NOISE_INT4_OP((mask.v[i] != 0) ? a.v[i] : b.v[i]) }
+template <int N> inline Int4 ShiftLeftI(Int4 a)         { PEGASUS_NOISE_INT4_OP(a.v[i] << N) }
+template <int N> inline Int4 ShiftRightI(Int4 a)        { PEGASUS_NOISE_INT4_OP(a.v[i] >> N) }
+
+inline Int4 TruncateF(Float4 a)                         { PEGASUS_NOISE_INT4_OP(static_cast<unsigned int>(static_cast<int>(a.v[i]))) }
+inline Float4 ToFloatI(Int4 a)                          { PEGASUS_NOISE_FLOAT4_OP(static_cast<float>(static_cast<int>(a.v[i]))) }
+
+#undef PEGASUS_NOISE_INT4_OP
+#undef PEGASUS_NOISE_FLOAT4_OP
+
+#endif  // PEGASUS_SIMD_SSE2
+
+//----------------------------------------------------------------------------------------
+
+//! Linear interpolation between two vectors
+inline Float4 LerpF(Float4 a, Float4 b, Float4 t)
+{
+    return AddF(a, MulF(t, SubF(b, a)));
+}
+
+//! Hash the premultiplied lattice coordinates of a cell
+//! \param seed Seed of the noise, added to the premultiplied z coordinate for the 3D noises
+//! \param hx X coordinate of the cell multiplied by HASH_PRIME_X
+//! \param hy Y coordinate of the cell multiplied by HASH_PRIME_Y
+//! \return Well mixed 32 bits hash
+inline Int4 Hash(Int4 seed, Int4 hx, Int4 hy)
+{
+    Int4 h = AddI(seed, AddI(hx, hy));
+    h = XorI(h, ShiftRightI<16>(h));
+    h = MulI(h, SetI(0x7FEB352D));
+    h = XorI(h, ShiftRightI<15>(h));
+    h = MulI(h, SetI(0x846CA68B));
+    h = XorI(h, ShiftRightI<16>(h));
+    return h;
+}
+
+//! Cells of the lattice surrounding a coordinate along one axis
+struct LatticeAxis
+{
+    Int4 mCell;             //!< Cell containing the coordinate
+    Int4 mPreviousCell;     //!< Previous cell, wrapped around the period
+    Int4 mNextCell;         //!< Next cell, wrapped around the period
+    Float4 mFraction;       //!< Position of the coordinate in its cell, in [0, 1)
+};
+
+//! Compute the lattice cells surrounding a coordinate.
+//! The cells wrap around the period so the noise tiles
+//! \param p Coordinate in lattice space, in [0, period)
+//! \param period Number of cells of the lattice along the axis
+//! \param axis Cells of the lattice (output)
+inline void ComputeLatticeAxis(Float4 p, Int4 period, LatticeAxis & axis)
+{
+    // Truncation is a floor, the coordinates being positive
+    const Int4 zero = SetI(0);
+    const Int4 one = SetI(1);
+    axis.mCell = TruncateF(p);
+    axis.mFraction = SubF(p, ToFloatI(axis.mCell));
+    axis.mPreviousCell = SelectI(CmpEqI(axis.mCell, zero), SubI(period, one), SubI(axis.mCell, one));
+    const Int4 next = AddI(axis.mCell, one);
+    axis.mNextCell = SelectI(CmpEqI(next, period), zero, next);
+}
+
+//! Quintic interpolation curve of the gradient noise, 6t^5 - 15t^4 + 10t^3
+inline Float4 Fade(Float4 t)
+{
+    return MulF(MulF(MulF(t, t), t), AddF(MulF(t, SubF(MulF(t, SetF(6.0f)), SetF(15.0f))), SetF(10.0f)));
+}
+
+//! Dot product of an offset with the gradient of a lattice corner.
+//! The 12 gradients are the directions to the edges of a cube, as in the improved Perlin noise.
+//! For the 2D noise, z is 0 and the gradients project to the 8 axis and diagonal directions
+inline Float4 Gradient(Int4 hash, Float4 x, Float4 y, Float4 z)
+{
+    const Int4 h = AndI(hash, SetI(15));
+    const Float4 u = SelectF(CmpLtI(h, SetI(8)), x, y);
+    const Float4 v = SelectF(CmpLtI(h, SetI(4)), y, SelectF(OrI(CmpEqI(h, SetI(12)), CmpEqI(h, SetI(14))), x, z));
+    return AddF(FlipSignF(u, ShiftLeftI<31>(h)), FlipSignF(v, ShiftLeftI<30>(AndI(h, SetI(2)))));
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Tileable gradient noise
+//! \param Is3D True to evaluate the 3D noise, false for the 2D noise (pz is ignored)
+//! \param px, py, pz Coordinates in lattice space, in [0, period)
+//! \param period Number of cells of the lattice along each axis
+//! \param seed Seed of the noise
+//! \return Noise values, in [-1, 1]
+template <bool Is3D>
+Float4 GradientNoise(Float4 px, Float4 py, Float4 pz, unsigned int period, unsigned int seed)
+{
+    const Int4 periodI = SetI(period);
+    const Float4 one = SetF(1.0f);
+    LatticeAxis ax, ay;
+    ComputeLatticeAxis(px, periodI, ax);
+    ComputeLatticeAxis(py, periodI, ay);
+
+    const Int4 hx0 = MulI(ax.mCell, SetI(HASH_PRIME_X));
+    const Int4 hx1 = MulI(ax.mNextCell, SetI(HASH_PRIME_X));
+    const Int4 hy0 = MulI(ay.mCell, SetI(HASH_PRIME_Y));
+    const Int4 hy1 = MulI(ay.mNextCell, SetI(HASH_PRIME_Y));
+    const Float4 fx0 = ax.mFraction;
+    const Float4 fx1 = SubF(fx0, one);
+    const Float4 fy0 = ay.mFraction;
+    const Float4 fy1 = SubF(fy0, one);
+    const Float4 fadeX = Fade(fx0);
+    const Float4 fadeY = Fade(fy0);
+
+    if (Is3D)
+    {
+        LatticeAxis az;
+        ComputeLatticeAxis(pz, periodI, az);
+        const Int4 s0 = AddI(SetI(seed), MulI(az.mCell, SetI(HASH_PRIME_Z)));
+        const Int4 s1 = AddI(SetI(seed), MulI(az.mNextCell, SetI(HASH_PRIME_Z)));
+        const Float4 fz0 = az.mFraction;
+        const Float4 fz1 = SubF(fz0, one);
+
+        const Float4 n000 = Gradient(Hash(s0, hx0, hy0), fx0, fy0, fz0);
+        const Float4 n100 = Gradient(Hash(s0, hx1, hy0), fx1, fy0, fz0);
+        const Float4 n010 = Gradient(Hash(s0, hx0, hy1), fx0, fy1, fz0);
+        const Float4 n110 = Gradient(Hash(s0, hx1, hy1), fx1, fy1, fz0);
+        const Float4 n001 = Gradient(Hash(s1, hx0, hy0), fx0, fy0, fz1);
+        const Float4 n101 = Gradient(Hash(s1, hx1, hy0), fx1, fy0, fz1);
+        const Float4 n011 = Gradient(Hash(s1, hx0, hy1), fx0, fy1, fz1);
+        const Float4 n111 = Gradient(Hash(s1, hx1, hy1), fx1, fy1, fz1);
+
+        const Float4 nz0 = LerpF(LerpF(n000, n100, fadeX), LerpF(n010, n110, fadeX), fadeY);
+        const Float4 nz1 = LerpF(LerpF(n001, n101, fadeX), LerpF(n011, n111, fadeX), fadeY);
+        return LerpF(nz0, nz1, Fade(fz0));
+    }
+    else
+    {
+        const Int4 s = SetI(seed);
+        const Float4 zero = SetF(0.0f);
+        const Float4 n00 = Gradient(Hash(s, hx0, hy0), fx0, fy0, zero);
+        const Float4 n10 = Gradient(Hash(s, hx1, hy0), fx1, fy0, zero);
+        const Float4 n01 = Gradient(Hash(s, hx0, hy1), fx0, fy1, zero);
+        const Float4 n11 = Gradient(Hash(s, hx1, hy1), fx1, fy1, zero);
+        return MulF(LerpF(LerpF(n00, n10, fadeX), LerpF(n01, n11, fadeX), fadeY), SetF(GRADIENT_NOISE_2D_SCALE));
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Position of the feature point of a cell along one axis, relative to the cell of the pixel
+//! \param hash Hash of the cell, 10 bits of which are used
+//! \param offset Offset of the cell from the cell of the pixel (-1, 0 or 1)
+//! \param jitter Displacement of the feature point from the cell center, in [0, 1]
+inline Float4 FeaturePoint(Int4 hash, float offset, Float4 jitter)
+{
+    const Float4 random = MulF(ToFloatI(AndI(hash, SetI(0x3FF))), SetF(1.0f / 1023.0f));
+    return AddF(SetF(offset + 0.5f), MulF(jitter, SubF(random, SetF(0.5f))));
+}
+
+//! Tileable cellular noise, distance to the closest feature point of the lattice
+//! \param Is3D True to evaluate the 3D noise, false for the 2D noise (pz is ignored)
+//! \param px, py, pz Coordinates in lattice space, in [0, period)
+//! \param period Number of cells of the lattice along each axis
+//! \param seed Seed of the noise
+//! \param jitter Displacement of the feature points from the cell centers, in [0, 1]
+//! \return Distances in lattice space
+template <bool Is3D>
+Float4 CellularNoise(Float4 px, Float4 py, Float4 pz, unsigned int period, unsigned int seed, float jitter)
+{
+    const Int4 periodI = SetI(period);
+    const Float4 jitterF = SetF(jitter);
+    LatticeAxis ax, ay, az;
+    ComputeLatticeAxis(px, periodI, ax);
+    ComputeLatticeAxis(py, periodI, ay);
+    if (Is3D)
+    {
+        ComputeLatticeAxis(pz, periodI, az);
+    }
+
+    const Int4 hx[3] = { MulI(ax.mPreviousCell, SetI(HASH_PRIME_X)), MulI(ax.mCell, SetI(HASH_PRIME_X)), MulI(ax.mNextCell, SetI(HASH_PRIME_X)) };
+    const Int4 hy[3] = { MulI(ay.mPreviousCell, SetI(HASH_PRIME_Y)), MulI(ay.mCell, SetI(HASH_PRIME_Y)), MulI(ay.mNextCell, SetI(HASH_PRIME_Y)) };
+
+    Float4 minDistance2 = SetF(1e30f);
+    const int firstZ = Is3D ? -1 : 0;
+    const int lastZ = Is3D ? 1 : 0;
+    for (int dz = firstZ; dz <= lastZ; ++dz)
+    {
+        Int4 s = SetI(seed);
+        Float4 deltaZ2 = SetF(0.0f);
+        if (Is3D)
+        {
+            const Int4 cz = (dz < 0) ? az.mPreviousCell : ((dz > 0) ? az.mNextCell : az.mCell);
+            s = AddI(s, MulI(cz, SetI(HASH_PRIME_Z)));
+        }
+
+        for (int dy = -1; dy <= 1; ++dy)
+        {
+            for (int dx = -1; dx <= 1; ++dx)
+            {
+                const Int4 h = Hash(s, hx[dx + 1], hy[dy + 1]);
+                const Float4 deltaX = SubF(FeaturePoint(h, static_cast<float>(dx), jitterF), ax.mFraction);
+                const Float4 deltaY = SubF(FeaturePoint(ShiftRightI<10>(h), static_cast<float>(dy), jitterF), ay.mFraction);
+                if (Is3D)
+                {
+                    const Float4 deltaZ = SubF(FeaturePoint(ShiftRightI<20>(h), static_cast<float>(dz), jitterF), az.mFraction);
+                    deltaZ2 = MulF(deltaZ, deltaZ);
+                }
+                const Float4 distance2 = AddF(AddF(MulF(deltaX, deltaX), MulF(deltaY, deltaY)), deltaZ2);
+                minDistance2 = MinF(minDistance2, distance2);
+            }
+        }
+    }
+
+    return SqrtF(minDistance2);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Evaluate a noise for 4 pixels
+//! \param Is3D True to evaluate the 3D noise, false for the 2D noise (pz is ignored)
+//! \param settings Settings of the noise, validated
+//! \param px, py, pz Coordinates in lattice space of the first octave, in [0, mFrequency)
+//! \return Noise values, in [0, 1]
+template <bool Is3D>
+Float4 EvaluateNoise4(const NoiseSettings & settings, Float4 px, Float4 py, Float4 pz)
+{
+    Float4 value;
+    switch (settings.mType)
+    {
+        case NOISETYPE_GRADIENT:
+            value = AddF(MulF(GradientNoise<Is3D>(px, py, pz, settings.mFrequency, settings.mSeed), SetF(0.5f)), SetF(0.5f));
+            break;
+
+        case NOISETYPE_CELLULAR:
+            value = CellularNoise<Is3D>(px, py, pz, settings.mFrequency, settings.mSeed, settings.mJitter);
+            break;
+
+        case NOISETYPE_FBM:
+        case NOISETYPE_RIDGED:
+            {
+                // Each octave doubles the frequency and the period, so the sum still tiles.
+                // The scaling by a power of 2 is exact, all the octaves sample the same positions
+                const bool ridged = (settings.mType == NOISETYPE_RIDGED);
+                Float4 sum = SetF(0.0f);
+                float amplitude = 1.0f;
+                float amplitudeSum = 0.0f;
+                float scale = 1.0f;
+                for (unsigned int octave = 0; octave < settings.mNumOctaves; ++octave)
+                {
+                    const Float4 scaleF = SetF(scale);
+                    Float4 octaveValue = GradientNoise<Is3D>(MulF(px, scaleF), MulF(py, scaleF), MulF(pz, scaleF),
+                                                             settings.mFrequency << octave,
+                                                             settings.mSeed + octave * OCTAVE_SEED_INCREMENT);
+                    if (ridged)
+                    {
+                        octaveValue = SubF(SetF(1.0f), AbsF(octaveValue));
+                        octaveValue = MulF(octaveValue, octaveValue);
+                    }
+                    sum = AddF(sum, MulF(octaveValue, SetF(amplitude)));
+                    amplitudeSum += amplitude;
+                    amplitude *= settings.mGain;
+                    scale *= 2.0f;
+                }
+                value = MulF(sum, SetF(1.0f / amplitudeSum));
+                if (!ridged)
+                {
+                    value = AddF(MulF(value, SetF(0.5f)), SetF(0.5f));
+                }
+            }
+            break;
+
+        default:
+            value = SetF(0.0f);
+            break;
+    }
+
+    return MinF(MaxF(value, SetF(0.0f)), SetF(1.0f));
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Evaluate a noise for a range of pixels of a row, 4 pixels at a time
+//! \param Is3D True to evaluate the 3D noise, false for the 2D noise
+//! \param settings Settings of the noise, validated
+template <bool Is3D>
+void EvaluateNoiseRange(const NoiseSettings & settings,
+                        float scaleX, float py, float pz,
+                        unsigned int x, unsigned int numPixels, float * values)
+{
+    const Float4 pyF = SetF(py);
+    const Float4 pzF = SetF(pz);
+    const Float4 scaleXF = SetF(scaleX);
+    const Float4 half = SetF(0.5f);
+
+    unsigned int p = 0;
+    for (; p + 4 <= numPixels; p += 4)
+    {
+        const Float4 px = MulF(AddF(ToFloatI(RampI(x + p)), half), scaleXF);
+        StoreF(values + p, EvaluateNoise4<Is3D>(settings, px, pyF, pzF));
+    }
+
+    // Last incomplete group of pixels, the values of the pixels out of the range are dropped
+    if (p < numPixels)
+    {
+        float lastValues[4];
+        const Float4 px = MulF(AddF(ToFloatI(RampI(x + p)), half), scaleXF);
+        StoreF(lastValues, EvaluateNoise4<Is3D>(settings, px, pyF, pzF));
+        for (unsigned int i = 0; p + i < numPixels; ++i)
+        {
+            values[p + i] = lastValues[i];
+        }
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Parameters of the noise kernel
+struct NoiseParameters
+{
+    TextureData * mData;                //!< Texture data to fill
+    NoiseSettings mSettings;            //!< Settings of the noise, validated
+    Math::ColorRGBA mColor0;            //!< Color of the noise value 0
+    Math::ColorRGBA mColorDiff;         //!< Difference between the colors of the noise values 1 and 0
+};
+
+//! Noise kernel, compiled for each pixel format
+template <typename Pixel>
+struct NoiseKernel
+{
+    //! Generate a job of rows of a slice
+    //! \param parameters Parameters of the kernel
+    //! \param sliceData First pixel of the slice
+    //! \param z Index of the slice
+    //! \param firstRow First row of the job
+    //! \param numRows Number of rows of the job, clamped to the height of the texture
+    static void GenerateRows(const NoiseParameters & parameters,
+                             typename Pixel::ChannelType * sliceData,
+                             unsigned int z, unsigned int firstRow, unsigned int numRows)
+    {
+        const TextureConfiguration & configuration = parameters.mData->GetConfiguration();
+        const unsigned int width = configuration.GetWidth();
+        const unsigned int height = configuration.GetHeight();
+        const unsigned int depth = configuration.GetDepth();
+        const unsigned int lastRow = Math::Min(firstRow + numRows, height);
+
+        float values[NOISE_SEGMENT_SIZE];
+        Math::ColorRGBA color;
+        typename Pixel::ChannelType * pixel = sliceData + firstRow * width * Pixel::NUM_CHANNELS;
+        for (unsigned int y = firstRow; y < lastRow; ++y)
+        {
+            for (unsigned int x = 0; x < width; x += NOISE_SEGMENT_SIZE)
+            {
+                const unsigned int numPixels = Math::Min(NOISE_SEGMENT_SIZE, width - x);
+                EvaluateNoise(parameters.mSettings, width, height, depth, x, y, z, numPixels, values);
+
+                for (unsigned int p = 0; p < numPixels; ++p)
+                {
+                    color = parameters.mColor0 + values[p] * parameters.mColorDiff;
+                    Pixel::FromColor(color, pixel);
+                    pixel += Pixel::NUM_CHANNELS;
+                }
+            }
+        }
+    }
+
+    //! Generate the NOISE_ROWS_PER_JOB rows of a job, run by Core::RunParallelJobs()
+    //! \param userData Parameters of the kernel
+    //! \param jobIndex Index of the job, the jobs of a slice being contiguous
+    //! \param workerIndex Unused
+    static void GenerateRowsJob(void * userData, unsigned int jobIndex, unsigned int workerIndex)
+    {
+        const NoiseParameters & parameters = *static_cast<const NoiseParameters *>(userData);
+        const TextureConfiguration & configuration = parameters.mData->GetConfiguration();
+        const unsigned int numJobsPerSlice = (configuration.GetHeight() + NOISE_ROWS_PER_JOB - 1) / NOISE_ROWS_PER_JOB;
+        const unsigned int z = jobIndex / numJobsPerSlice;
+        const unsigned int firstRow = (jobIndex % numJobsPerSlice) * NOISE_ROWS_PER_JOB;
+        typename Pixel::ChannelType * layerData = reinterpret_cast<typename Pixel::ChannelType *>(parameters.mData->GetLayerImageData(0));
+        typename Pixel::ChannelType * sliceData = layerData + z * configuration.GetWidth() * configuration.GetHeight() * Pixel::NUM_CHANNELS;
+        GenerateRows(parameters, sliceData, z, firstRow, NOISE_ROWS_PER_JOB);
+    }
+
+    static void Run(const NoiseParameters & parameters)
+    {
+        const TextureConfiguration & configuration = parameters.mData->GetConfiguration();
+        const unsigned int numJobsPerSlice = (configuration.GetHeight() + NOISE_ROWS_PER_JOB - 1) / NOISE_ROWS_PER_JOB;
+
+        // The rows and slices are independent jobs, run in parallel
+        Core::RunParallelJobs(GenerateRowsJob, const_cast<NoiseParameters *>(&parameters), numJobsPerSlice * configuration.GetDepth(), 0);
+
+        // The noise does not depend on the layer, the other layers are copies of the first one
+        const unsigned int numLayers = configuration.GetNumLayers();
+        const unsigned int numBytesPerLayer = configuration.GetNumBytesPerLayer();
+        for (unsigned int layer = 1; layer < numLayers; ++layer)
+        {
+            Utils::Memcpy(parameters.mData->GetLayerImageData(layer), parameters.mData->GetLayerImageData(0), numBytesPerLayer);
+        }
+    }
+};
+
+}   // namespace Internal
+
+//----------------------------------------------------------------------------------------
+
+void EvaluateNoise(const NoiseSettings & settings,
+                   unsigned int width,
+                   unsigned int height,
+                   unsigned int depth,
+                   unsigned int x,
+                   unsigned int y,
+                   unsigned int z,
+                   unsigned int numPixels,
+                   float * values)
+{
+    PG_ASSERTSTR(settings.mType < NUM_NOISETYPES, "Invalid noise type (%d)", settings.mType);
+    PG_ASSERTSTR((settings.mFrequency >= 1) && (settings.mFrequency <= MAX_NOISE_FREQUENCY), "Invalid noise frequency (%u)", settings.mFrequency);
+    PG_ASSERTSTR((settings.mNumOctaves >= 1) && (settings.mNumOctaves <= MAX_NOISE_OCTAVES), "Invalid number of noise octaves (%u)", settings.mNumOctaves);
+    PG_ASSERT(values != nullptr);
+
+    const float frequency = static_cast<float>(settings.mFrequency);
+    const float scaleX = frequency / static_cast<float>(width);
+    const float py = (static_cast<float>(y) + 0.5f) * (frequency / static_cast<float>(height));
+    const float pz = (static_cast<float>(z) + 0.5f) * (frequency / static_cast<float>(depth));
+    if (depth > 1)
+    {
+        Internal::EvaluateNoiseRange<true>(settings, scaleX, py, pz, x, numPixels, values);
+    }
+    else
+    {
+        Internal::EvaluateNoiseRange<false>(settings, scaleX, py, pz, x, numPixels, values);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+bool GenerateNoise(TextureData * data,
+                   const NoiseSettings & settings,
+                   const Math::ColorRGBA & color0,
+                   const Math::ColorRGBA & color1)
+{
+    PG_ASSERT(data != nullptr);
+
+    Internal::NoiseParameters parameters;
+    parameters.mData = data;
+    parameters.mSettings = settings;
+    parameters.mSettings.mFrequency = Math::Min(Math::Max(settings.mFrequency, 1u), MAX_NOISE_FREQUENCY);
+    parameters.mSettings.mNumOctaves = Math::Min(Math::Max(settings.mNumOctaves, 1u), MAX_NOISE_OCTAVES);
+    parameters.mSettings.mJitter = Math::Saturate(settings.mJitter);
+    parameters.mColor0 = color0;
+    parameters.mColorDiff = color1 - color0;
+
+    return RunPixelKernel<Internal::NoiseKernel>(data->GetConfiguration().GetPixelFormat(), parameters);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
@@ -11,6 +11,7 @@
 
 #include "Pegasus/Texture/Shared/TextureEventDefs.h"
 #include "Pegasus/Texture/Operator/AddOperator.h"
+#include "Pegasus/Texture/PixelFormat.h"
 #include "Pegasus/Utils/Memcpy.h"
 
 namespace Pegasus {
@@ -23,6 +24,48 @@ END_IMPLEMENT_PROPERTIES(AddOperator)
 
 //----------------------------------------------------------------------------------------
 
+namespace Internal {
+
+//! Parameters of the add kernel
+struct AddParameters
+{
+    TextureData * mData;                //!< Texture data receiving the sum, containing the first term
+    const TextureData * mInputData;     //!< Texture data to add
+    bool mClamp;                        //!< True to clamp the sum to the range of the format ([0, 1] for floats)
+};
+
+//! Add kernel, compiled for each pixel format
+template <typename Pixel>
+struct AddKernel
+{
+    static void Run(const AddParameters & parameters)
+    {
+        typedef typename Pixel::ChannelType ChannelType;
+        typedef typename Pixel::ChannelTraits ChannelTraits;
+
+        const TextureConfiguration & configuration = parameters.mData->GetConfiguration();
+        const unsigned int numLayers = configuration.GetNumLayers();
+        const unsigned int numChannelsPerLayer = configuration.GetNumPixelsPerLayer() * Pixel::NUM_CHANNELS;
+        const bool clamp = parameters.mClamp;
+
+        for (unsigned int layer = 0; layer < numLayers; ++layer)
+        {
+            const ChannelType * inputLayerData = reinterpret_cast<const ChannelType *>(parameters.mInputData->GetLayerImageData(layer));
+            ChannelType * layerData = reinterpret_cast<ChannelType *>(parameters.mData->GetLayerImageData(layer));
+
+            // For each component of each pixel, perform the addition
+            for (unsigned int c = 0; c < numChannelsPerLayer; ++c)
+            {
+                layerData[c] = ChannelTraits::Add(layerData[c], inputLayerData[c], clamp);
+            }
+        }
+    }
+};
+
+}   // namespace Internal
+
+//----------------------------------------------------------------------------------------
+
 void AddOperator::InitProperties()
 {
     BEGIN_INIT_PROPERTIES(AddOperator)
@@ -48,8 +91,7 @@ void AddOperator::GenerateData()
     unsigned char * layerData;
     const TextureData * inputData;
     const unsigned char * inputLayerData;
-    unsigned int layer, b;
-    unsigned short addedValue;
+    unsigned int layer;
     bool updated;
 
     // Copy the first input texture
@@ -65,43 +107,22 @@ void AddOperator::GenerateData()
     }
 
     // For each extra input texture to add
+    Internal::AddParameters parameters;
+    parameters.mData = data;
+    parameters.mClamp = GetClamp();
+    const Core::Format pixelFormat = configuration.GetPixelFormat();
     const unsigned int numInputs = GetNumInputs();
     unsigned int input;
     for (input = 1; input < numInputs; ++input)
     {
         //! \todo Use a simpler syntax
         updated = false;
-        inputData = static_cast<TextureData *>(&(*GetInput(input)->GetUpdatedData(updated)));
+        parameters.mInputData = static_cast<TextureData *>(&(*GetInput(input)->GetUpdatedData(updated)));
 
-        for (layer = 0; layer < numLayers; ++layer)
+        if (!RunPixelKernel<Internal::AddKernel>(pixelFormat, parameters))
         {
-            inputLayerData = inputData->GetLayerImageData(layer);
-            layerData = data->GetLayerImageData(layer);
-
-            if (GetClamp())
-            {
-                // For each component of each pixel, perform the addition
-                for (b = 0; b < numBytesPerLayer; ++b)
-                {
-                    // Add the values and clamp
-                    addedValue = static_cast<unsigned short>(layerData[b]) + static_cast<unsigned short>(inputLayerData[b]);
-                    if (addedValue > 255)
-                    {
-                        addedValue = 255;
-                    }
-                    layerData[b] = static_cast<unsigned char>(addedValue);
-                }
-            }
-            else
-            {
-                // For each component of each pixel, perform the addition
-                for (b = 0; b < numBytesPerLayer; ++b)
-                {
-                    // Cannot use += on unsigned chars with no masking.
-                    // When overflowing, the runtime can detect the loss of data
-                    layerData[b] = static_cast<unsigned char>((layerData[b] + inputLayerData[b]) & 0xFF);
-                }
-            }
+            PG_FAILSTR("Unsupported pixel format (%d) for AddOperator", pixelFormat);
+            break;
         }
     }
 
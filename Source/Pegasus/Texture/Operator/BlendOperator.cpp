@@ -0,0 +1,94 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BlendOperator.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Texture operator blending its second input texture over its first one
+
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+#include "Pegasus/Texture/Operator/BlendOperator.h"
+#include "Pegasus/Texture/ImageFilter.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+BEGIN_IMPLEMENT_PROPERTIES(BlendOperator)
+    IMPLEMENT_PROPERTY(BlendOperator, Mode)
+    IMPLEMENT_PROPERTY(BlendOperator, Opacity)
+END_IMPLEMENT_PROPERTIES(BlendOperator)
+
+//----------------------------------------------------------------------------------------
+
+void BlendOperator::InitProperties()
+{
+    BEGIN_INIT_PROPERTIES(BlendOperator)
+        INIT_PROPERTY(Mode)
+        INIT_PROPERTY(Opacity)
+    END_INIT_PROPERTIES()
+}
+
+//----------------------------------------------------------------------------------------
+
+void BlendOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    bool updated = false;
+    const TextureData * inputData = static_cast<TextureData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+    updated = false;
+    const TextureData * secondInputData = static_cast<TextureData *>(&(*GetInput(1)->GetUpdatedData(updated)));
+
+    const TextureConfiguration & configuration = GetConfiguration();
+    const unsigned int width = configuration.GetWidth();
+    const unsigned int height = configuration.GetHeight();
+    const unsigned int depth = configuration.GetDepth();
+    const unsigned int numLayers = configuration.GetNumLayers();
+    const unsigned int numFloats = width * height * 4;
+
+    const unsigned int mode = GetMode();
+    PG_ASSERTSTR(mode < NUM_BLENDMODES, "Invalid blend mode (%u) for BlendOperator", mode);
+
+    // Each slice of each layer is filtered as a float RGBA image
+    Alloc::IAllocator * allocator = GetNodeDataAllocator();
+    float * pixels = PG_NEW_ARRAY(allocator, -1, "BlendOperator::pixels", Alloc::PG_MEM_TEMP, float, numFloats);
+    float * layerPixels = PG_NEW_ARRAY(allocator, -1, "BlendOperator::layerPixels", Alloc::PG_MEM_TEMP, float, numFloats);
+
+    bool supported = true;
+    for (unsigned int layer = 0; (layer < numLayers) && supported; ++layer)
+    {
+        for (unsigned int slice = 0; (slice < depth) && supported; ++slice)
+        {
+            supported = ReadFilterImage(inputData, layer, slice, pixels)
+                     && ReadFilterImage(secondInputData, layer, slice, layerPixels);
+            if (supported)
+            {
+                BlendImages(pixels, layerPixels, width, height, static_cast<BlendMode>(mode), GetOpacity());
+                WriteFilterImage(data, layer, slice, pixels);
+            }
+        }
+    }
+
+    PG_DELETE_ARRAY(allocator, layerPixels);
+    PG_DELETE_ARRAY(allocator, pixels);
+
+    if (!supported)
+    {
+        PG_FAILSTR("Unsupported pixel format (%d) for BlendOperator", configuration.GetPixelFormat());
+    }
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
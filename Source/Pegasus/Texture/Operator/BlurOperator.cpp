@@ -0,0 +1,106 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BlurOperator.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Texture operator blurring its input texture
+
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+#include "Pegasus/Texture/Operator/BlurOperator.h"
+#include "Pegasus/Texture/ImageFilter.h"
+#include "Pegasus/Math/Scalar.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+BEGIN_IMPLEMENT_PROPERTIES(BlurOperator)
+    IMPLEMENT_PROPERTY(BlurOperator, Radius)
+    IMPLEMENT_PROPERTY(BlurOperator, Gaussian)
+    IMPLEMENT_PROPERTY(BlurOperator, Tile)
+END_IMPLEMENT_PROPERTIES(BlurOperator)
+
+//----------------------------------------------------------------------------------------
+
+void BlurOperator::InitProperties()
+{
+    BEGIN_INIT_PROPERTIES(BlurOperator)
+        INIT_PROPERTY(Radius)
+        INIT_PROPERTY(Gaussian)
+        INIT_PROPERTY(Tile)
+    END_INIT_PROPERTIES()
+}
+
+//----------------------------------------------------------------------------------------
+
+void BlurOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    bool updated = false;
+    const TextureData * inputData = static_cast<TextureData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+
+    const TextureConfiguration & configuration = GetConfiguration();
+    const unsigned int width = configuration.GetWidth();
+    const unsigned int height = configuration.GetHeight();
+    const unsigned int depth = configuration.GetDepth();
+    const unsigned int numLayers = configuration.GetNumLayers();
+    const unsigned int numFloats = width * height * 4;
+
+    // A Gaussian is approximated by three box passes, otherwise a single box pass is used
+    unsigned int radii[MAX_BLUR_PASSES];
+    unsigned int numPasses;
+    const float radius = Math::Max(GetRadius(), 0.0f);
+    if (GetGaussian())
+    {
+        ComputeGaussianBoxRadii(radius, radii);
+        numPasses = MAX_BLUR_PASSES;
+    }
+    else
+    {
+        radii[0] = static_cast<unsigned int>(radius + 0.5f);
+        numPasses = 1;
+    }
+
+    // Each slice of each layer is filtered as a float RGBA image
+    Alloc::IAllocator * allocator = GetNodeDataAllocator();
+    float * pixels = PG_NEW_ARRAY(allocator, -1, "BlurOperator::pixels", Alloc::PG_MEM_TEMP, float, numFloats);
+    float * tempPixels = PG_NEW_ARRAY(allocator, -1, "BlurOperator::tempPixels", Alloc::PG_MEM_TEMP, float, numFloats);
+
+    bool supported = true;
+    for (unsigned int layer = 0; (layer < numLayers) && supported; ++layer)
+    {
+        for (unsigned int slice = 0; (slice < depth) && supported; ++slice)
+        {
+            supported = ReadFilterImage(inputData, layer, slice, pixels);
+            if (supported)
+            {
+                BlurImage(pixels, tempPixels, width, height, radii, numPasses, GetTile());
+                WriteFilterImage(data, layer, slice, pixels);
+            }
+        }
+    }
+
+    PG_DELETE_ARRAY(allocator, tempPixels);
+    PG_DELETE_ARRAY(allocator, pixels);
+
+    if (!supported)
+    {
+        PG_FAILSTR("Unsupported pixel format (%d) for BlurOperator", configuration.GetPixelFormat());
+    }
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
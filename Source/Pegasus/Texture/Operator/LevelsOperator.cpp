@@ -0,0 +1,92 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   LevelsOperator.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Texture operator remapping the RGB channels of its input texture with levels and a gamma curve
+
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+#include "Pegasus/Texture/Operator/LevelsOperator.h"
+#include "Pegasus/Texture/ImageFilter.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+BEGIN_IMPLEMENT_PROPERTIES(LevelsOperator)
+    IMPLEMENT_PROPERTY(LevelsOperator, InputBlack)
+    IMPLEMENT_PROPERTY(LevelsOperator, InputWhite)
+    IMPLEMENT_PROPERTY(LevelsOperator, Gamma)
+    IMPLEMENT_PROPERTY(LevelsOperator, OutputBlack)
+    IMPLEMENT_PROPERTY(LevelsOperator, OutputWhite)
+END_IMPLEMENT_PROPERTIES(LevelsOperator)
+
+//----------------------------------------------------------------------------------------
+
+void LevelsOperator::InitProperties()
+{
+    BEGIN_INIT_PROPERTIES(LevelsOperator)
+        INIT_PROPERTY(InputBlack)
+        INIT_PROPERTY(InputWhite)
+        INIT_PROPERTY(Gamma)
+        INIT_PROPERTY(OutputBlack)
+        INIT_PROPERTY(OutputWhite)
+    END_INIT_PROPERTIES()
+}
+
+//----------------------------------------------------------------------------------------
+
+void LevelsOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    bool updated = false;
+    const TextureData * inputData = static_cast<TextureData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+
+    const TextureConfiguration & configuration = GetConfiguration();
+    const unsigned int width = configuration.GetWidth();
+    const unsigned int height = configuration.GetHeight();
+    const unsigned int depth = configuration.GetDepth();
+    const unsigned int numLayers = configuration.GetNumLayers();
+    const unsigned int numFloats = width * height * 4;
+
+    // Each slice of each layer is filtered as a float RGBA image
+    Alloc::IAllocator * allocator = GetNodeDataAllocator();
+    float * pixels = PG_NEW_ARRAY(allocator, -1, "LevelsOperator::pixels", Alloc::PG_MEM_TEMP, float, numFloats);
+
+    bool supported = true;
+    for (unsigned int layer = 0; (layer < numLayers) && supported; ++layer)
+    {
+        for (unsigned int slice = 0; (slice < depth) && supported; ++slice)
+        {
+            supported = ReadFilterImage(inputData, layer, slice, pixels);
+            if (supported)
+            {
+                ApplyLevels(pixels, width, height, GetInputBlack(), GetInputWhite(), GetGamma(), GetOutputBlack(), GetOutputWhite());
+                WriteFilterImage(data, layer, slice, pixels);
+            }
+        }
+    }
+
+    PG_DELETE_ARRAY(allocator, pixels);
+
+    if (!supported)
+    {
+        PG_FAILSTR("Unsupported pixel format (%d) for LevelsOperator", configuration.GetPixelFormat());
+    }
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
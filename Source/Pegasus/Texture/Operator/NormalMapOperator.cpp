@@ -0,0 +1,90 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NormalMapOperator.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Texture operator converting a height map to a normal map
+
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+#include "Pegasus/Texture/Operator/NormalMapOperator.h"
+#include "Pegasus/Texture/ImageFilter.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+BEGIN_IMPLEMENT_PROPERTIES(NormalMapOperator)
+    IMPLEMENT_PROPERTY(NormalMapOperator, Strength)
+    IMPLEMENT_PROPERTY(NormalMapOperator, Tile)
+END_IMPLEMENT_PROPERTIES(NormalMapOperator)
+
+//----------------------------------------------------------------------------------------
+
+void NormalMapOperator::InitProperties()
+{
+    BEGIN_INIT_PROPERTIES(NormalMapOperator)
+        INIT_PROPERTY(Strength)
+        INIT_PROPERTY(Tile)
+    END_INIT_PROPERTIES()
+}
+
+//----------------------------------------------------------------------------------------
+
+void NormalMapOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    bool updated = false;
+    const TextureData * inputData = static_cast<TextureData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+
+    const TextureConfiguration & configuration = GetConfiguration();
+    const unsigned int width = configuration.GetWidth();
+    const unsigned int height = configuration.GetHeight();
+    const unsigned int depth = configuration.GetDepth();
+    const unsigned int numLayers = configuration.GetNumLayers();
+    const unsigned int numFloats = width * height * 4;
+
+    // Each slice of each layer is filtered as a float RGBA image
+    Alloc::IAllocator * allocator = GetNodeDataAllocator();
+    float * heightPixels = PG_NEW_ARRAY(allocator, -1, "NormalMapOperator::heightPixels", Alloc::PG_MEM_TEMP, float, numFloats);
+    float * normalPixels = PG_NEW_ARRAY(allocator, -1, "NormalMapOperator::normalPixels", Alloc::PG_MEM_TEMP, float, numFloats);
+    float * heightBuffer = PG_NEW_ARRAY(allocator, -1, "NormalMapOperator::heightBuffer", Alloc::PG_MEM_TEMP, float, GetNormalMapBufferSize(width, height));
+
+    bool supported = true;
+    for (unsigned int layer = 0; (layer < numLayers) && supported; ++layer)
+    {
+        for (unsigned int slice = 0; (slice < depth) && supported; ++slice)
+        {
+            supported = ReadFilterImage(inputData, layer, slice, heightPixels);
+            if (supported)
+            {
+                ComputeNormalMap(heightPixels, normalPixels, width, height, GetStrength(), GetTile(), heightBuffer);
+                WriteFilterImage(data, layer, slice, normalPixels);
+            }
+        }
+    }
+
+    PG_DELETE_ARRAY(allocator, heightBuffer);
+    PG_DELETE_ARRAY(allocator, normalPixels);
+    PG_DELETE_ARRAY(allocator, heightPixels);
+
+    if (!supported)
+    {
+        PG_FAILSTR("Unsupported pixel format (%d) for NormalMapOperator", configuration.GetPixelFormat());
+    }
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
@@ -0,0 +1,93 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   WarpOperator.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Texture operator distorting its first input texture with its second one
+
+#include "Pegasus/Texture/Shared/TextureEventDefs.h"
+#include "Pegasus/Texture/Operator/WarpOperator.h"
+#include "Pegasus/Texture/ImageFilter.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+BEGIN_IMPLEMENT_PROPERTIES(WarpOperator)
+    IMPLEMENT_PROPERTY(WarpOperator, Strength)
+    IMPLEMENT_PROPERTY(WarpOperator, Tile)
+END_IMPLEMENT_PROPERTIES(WarpOperator)
+
+//----------------------------------------------------------------------------------------
+
+void WarpOperator::InitProperties()
+{
+    BEGIN_INIT_PROPERTIES(WarpOperator)
+        INIT_PROPERTY(Strength)
+        INIT_PROPERTY(Tile)
+    END_INIT_PROPERTIES()
+}
+
+//----------------------------------------------------------------------------------------
+
+void WarpOperator::GenerateData()
+{
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::BEGIN);
+
+    //! \todo Use a simpler syntax
+    Graph::NodeDataRef dataRef = GetData();
+    TextureData * data = static_cast<TextureData *>(&(*dataRef));
+    PG_ASSERT(data != nullptr);
+
+    bool updated = false;
+    const TextureData * inputData = static_cast<TextureData *>(&(*GetInput(0)->GetUpdatedData(updated)));
+    updated = false;
+    const TextureData * secondInputData = static_cast<TextureData *>(&(*GetInput(1)->GetUpdatedData(updated)));
+
+    const TextureConfiguration & configuration = GetConfiguration();
+    const unsigned int width = configuration.GetWidth();
+    const unsigned int height = configuration.GetHeight();
+    const unsigned int depth = configuration.GetDepth();
+    const unsigned int numLayers = configuration.GetNumLayers();
+    const unsigned int numFloats = width * height * 4;
+
+    // Each slice of each layer is filtered as a float RGBA image
+    Alloc::IAllocator * allocator = GetNodeDataAllocator();
+    float * srcPixels = PG_NEW_ARRAY(allocator, -1, "WarpOperator::srcPixels", Alloc::PG_MEM_TEMP, float, numFloats);
+    float * displacementPixels = PG_NEW_ARRAY(allocator, -1, "WarpOperator::displacementPixels", Alloc::PG_MEM_TEMP, float, numFloats);
+    float * dstPixels = PG_NEW_ARRAY(allocator, -1, "WarpOperator::dstPixels", Alloc::PG_MEM_TEMP, float, numFloats);
+
+    bool supported = true;
+    for (unsigned int layer = 0; (layer < numLayers) && supported; ++layer)
+    {
+        for (unsigned int slice = 0; (slice < depth) && supported; ++slice)
+        {
+            supported = ReadFilterImage(inputData, layer, slice, srcPixels)
+                     && ReadFilterImage(secondInputData, layer, slice, displacementPixels);
+            if (supported)
+            {
+                WarpImage(srcPixels, displacementPixels, dstPixels, width, height, GetStrength(), GetTile());
+                WriteFilterImage(data, layer, slice, dstPixels);
+            }
+        }
+    }
+
+    PG_DELETE_ARRAY(allocator, dstPixels);
+    PG_DELETE_ARRAY(allocator, displacementPixels);
+    PG_DELETE_ARRAY(allocator, srcPixels);
+
+    if (!supported)
+    {
+        PG_FAILSTR("Unsupported pixel format (%d) for WarpOperator", configuration.GetPixelFormat());
+    }
+
+    PEGASUS_EVENT_DISPATCH(this, TextureNodeOperationEvent, TextureNodeOperationEvent::END_SUCCESS);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
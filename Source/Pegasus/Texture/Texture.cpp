@@ -11,6 +11,8 @@
 
 #include "Pegasus/Texture/Texture.h"
 #include "Pegasus/Texture/ITextureFactory.h"
+#include "Pegasus/Graph/NodeDataResidency.h"
+#include "Pegasus/Utils/Memcpy.h"
 
 #if PEGASUS_ENABLE_PROXIES
 #include "Pegasus/Texture/Proxy/TextureNodeProxy.h"
@@ -28,6 +30,12 @@ END_IMPLEMENT_PROPERTIES(Texture)
 Texture::Texture(Graph::NodeManager* nodeManager, Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocator)
 :   Graph::OutputNode(nodeManager, nodeAllocator, nodeDataAllocator)
 ,   mConfiguration()
+,   mDataResidency(nullptr)
+,   mCompressionFormat(Core::FORMAT_MAX_COUNT)
+,   mCompressionQuality(COMPRESSIONQUALITY_NORMAL)
+,   mCompressionChanged(false)
+,   mCompressedSourceData(nullptr)
+,   mCompressedSourceGeneration(0)
 #if PEGASUS_ENABLE_PROXIES
 ,   mProxy(this)
 #endif  // PEGASUS_ENABLE_PROXIES
@@ -45,6 +53,12 @@ Texture::Texture(Graph::NodeManager* nodeManager, const TextureConfiguration & c
                  Alloc::IAllocator* nodeAllocator, Alloc::IAllocator* nodeDataAllocator)
 :   Graph::OutputNode(nodeManager, nodeAllocator, nodeDataAllocator)
 ,   mConfiguration(configuration)
+,   mDataResidency(nullptr)
+,   mCompressionFormat(Core::FORMAT_MAX_COUNT)
+,   mCompressionQuality(COMPRESSIONQUALITY_NORMAL)
+,   mCompressionChanged(false)
+,   mCompressedSourceData(nullptr)
+,   mCompressedSourceGeneration(0)
 #if PEGASUS_ENABLE_PROXIES
 ,   mProxy(this)
 #endif  // PEGASUS_ENABLE_PROXIES
@@ -72,6 +86,34 @@ void Texture::SetConfiguration(const TextureConfiguration & configuration)
 
 //----------------------------------------------------------------------------------------
 
+void Texture::SetCompression(Core::Format format, CompressionQuality quality)
+{
+    if (!IsBlockCompressedFormat(format) || (quality >= NUM_COMPRESSIONQUALITIES))
+    {
+        PG_FAILSTR("Invalid block compression settings for a texture (format %d, quality %d)", format, quality);
+        return;
+    }
+    if ((format != mCompressionFormat) || (quality != mCompressionQuality))
+    {
+        mCompressionFormat = format;
+        mCompressionQuality = quality;
+        mCompressionChanged = true;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Texture::DisableCompression()
+{
+    if (mCompressionFormat != Core::FORMAT_MAX_COUNT)
+    {
+        mCompressionFormat = Core::FORMAT_MAX_COUNT;
+        mCompressionChanged = true;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
 void Texture::SetGeneratorInput(TextureGeneratorIn textureGenerator)
 {
     // Check that the configuration is compatible
@@ -109,8 +151,28 @@ TextureDataReturn Texture::GetUpdatedTextureData()
     PG_ASSERT(mFactory);
     bool updated = false;
     TextureDataRef textureData = Graph::OutputNode::GetUpdatedData(updated);
+    if (mCompressionChanged)
+    {
+        ReleaseCompressedTextureData();
+        mCompressionChanged = false;
+    }
+
+    // The input data can be shared by structurally identical graphs and is never modified here,
+    // the compressed copy and its GPU data belong to the output node
+    if ((mCompressionFormat != Core::FORMAT_MAX_COUNT) && CanCompress(textureData->GetConfiguration()))
+    {
+        UpdateCompressedTextureData(textureData);
+        return mCompressedTextureData;
+    }
+
     if (textureData->IsGPUDataDirty())
     {
+        // The upload reads the CPU copy, discarded if the GPU data has been destroyed since the last upload
+        if (!textureData->IsCPUDataResident())
+        {
+            RestoreCPUData();
+        }
+
 #if PEGASUS_ENABLE_DETAILED_LOG
 #if PEGASUS_ENABLE_PROXIES
         PG_LOG('TXTR', "Generating the GPU data of texture \"%s\"", GetName());
@@ -119,13 +181,98 @@ TextureDataReturn Texture::GetUpdatedTextureData()
 #endif
 #endif  // PEGASUS_ENABLE_DETAILED_LOG
 
+        if (mCompressionFormat != Core::FORMAT_MAX_COUNT)
+        {
+            PG_LOG('TXTR', "Texture of %ux%u pixels uploaded uncompressed, the block compression requires a 2D RGBA8 texture with a multiple of 4 pixels",
+                   mConfiguration.GetWidth(), mConfiguration.GetHeight());
+        }
+
         mFactory->GenerateTextureGPUData(&(*textureData));
+        if (mDataResidency != nullptr)
+        {
+            mDataResidency->OnGPUDataValidated(&(*textureData));
+        }
     }
     return textureData;
 }
 
 //----------------------------------------------------------------------------------------
 
+bool Texture::CanCompress(const TextureConfiguration & configuration)
+{
+    return ((configuration.GetWidth() & 3) == 0) && ((configuration.GetHeight() & 3) == 0)
+        && (configuration.GetDepth() == 1) && configuration.HasRGBA8Pixels();
+}
+
+//----------------------------------------------------------------------------------------
+
+void Texture::UpdateCompressedTextureData(TextureDataIn sourceData)
+{
+    // The input node generation changes every time its data is generated again
+    const unsigned int sourceGeneration = GetInput(0)->GetGeneration();
+    if ((mCompressedTextureData != nullptr) && !mCompressedTextureData->IsGPUDataDirty()
+        && (mCompressedSourceData == &(*sourceData)) && (mCompressedSourceGeneration == sourceGeneration))
+    {
+        return;
+    }
+    ReleaseCompressedTextureData();
+
+    if (!sourceData->IsCPUDataResident())
+    {
+        RestoreCPUData();
+    }
+
+#if PEGASUS_ENABLE_DETAILED_LOG
+#if PEGASUS_ENABLE_PROXIES
+    PG_LOG('TXTR', "Generating the compressed GPU data of texture \"%s\"", GetName());
+#else
+    PG_LOG('TXTR', "Generating the compressed GPU data of a texture");
+#endif
+#endif  // PEGASUS_ENABLE_DETAILED_LOG
+
+    // Copy on write: the image is copied to a data owned by the output node, then compressed.
+    // Compression is the last stage of the graph, the factory uploads the compressed copy
+    const TextureConfiguration & configuration = sourceData->GetConfiguration();
+    mCompressedTextureData = PG_NEW(GetNodeDataAllocator(), -1, "Texture::mCompressedTextureData", Alloc::PG_MEM_TEMP)
+                                TextureData(configuration, GetNodeDataAllocator());
+    const unsigned int numLayers = configuration.GetNumLayers();
+    for (unsigned int layer = 0; layer < numLayers; ++layer)
+    {
+        Utils::Memcpy(mCompressedTextureData->GetLayerImageData(layer), sourceData->GetLayerImageData(layer),
+                      configuration.GetNumBytesPerLayerMipChain());
+    }
+    if (!mCompressedTextureData->Compress(mCompressionFormat, mCompressionQuality))
+    {
+        PG_FAILSTR("The block compression of a texture failed");
+    }
+    mCompressedSourceData = &(*sourceData);
+    mCompressedSourceGeneration = sourceGeneration;
+
+    mFactory->GenerateTextureGPUData(&(*mCompressedTextureData));
+    if (mDataResidency != nullptr)
+    {
+        mDataResidency->OnGPUDataValidated(&(*mCompressedTextureData));
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void Texture::ReleaseCompressedTextureData()
+{
+    if (mCompressedTextureData != nullptr)
+    {
+        if (mFactory != nullptr)
+        {
+            mFactory->DestroyNodeGPUData(&(*mCompressedTextureData));
+        }
+        mCompressedTextureData = nullptr;
+    }
+    mCompressedSourceData = nullptr;
+    mCompressedSourceGeneration = 0;
+}
+
+//----------------------------------------------------------------------------------------
+
 void Texture::ReleaseDataAndPropagate()
 {
     //! \todo See note in ReleaseGPUData()
@@ -138,14 +285,18 @@ void Texture::ReleaseDataAndPropagate()
 
 void Texture::ReleaseGPUData()
 {
+    ReleaseCompressedTextureData();
+
     //! \todo Investigate and optimize this function.
     //!       This function assumes node GPU data exists only once for the graph used by the texture.
     //!       This function can destroy GPU data of another graph sharing the same node.
     //!       GetUpdatedData() is called twice, and the first call might generate the data
     //!       of the graph that could have been empty, to release the content right after.
+    //!       Shared data keeps its GPU data for the other users, the data interner releases it.
 
     bool dummyVariable = false;
-    if (GetNumInputs() == 1 && GetInput(0)->GetUpdatedData(dummyVariable) != nullptr && mFactory != nullptr)
+    if (GetNumInputs() == 1 && GetInput(0)->GetUpdatedData(dummyVariable) != nullptr
+        && !GetInput(0)->GetData()->IsInterned() && mFactory != nullptr)
     {
 #if PEGASUS_ENABLE_DETAILED_LOG
 #if PEGASUS_ENABLE_PROXIES
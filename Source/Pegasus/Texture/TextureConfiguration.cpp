@@ -11,6 +11,8 @@
 //!         between nodes to link them
 
 #include "Pegasus/Texture/TextureConfiguration.h"
+#include "Pegasus/Texture/PixelFormat.h"
+#include "Pegasus/Graph/NodeDataInterner.h"
 
 namespace Pegasus {
 namespace Texture {
@@ -23,6 +25,8 @@ TextureConfiguration::TextureConfiguration()
 ,   mHeight(256)
 ,   mDepth(1)
 ,   mNumLayers(1)
+,   mNumMipLevels(1)
+,   mMipFilter(MIPFILTER_BOX)
 #if PEGASUS_ENABLE_PROXIES
 ,   mProxy(this)
 #endif
@@ -36,7 +40,9 @@ TextureConfiguration::TextureConfiguration(Type type,
                                            unsigned int width,
                                            unsigned int height,
                                            unsigned int depth,
-                                           unsigned int numLayers)
+                                           unsigned int numLayers,
+                                           unsigned int numMipLevels,
+                                           MipFilter mipFilter)
 #if PEGASUS_ENABLE_PROXIES
 :   mProxy(this)
 #endif
@@ -55,13 +61,13 @@ TextureConfiguration::TextureConfiguration(Type type,
     }
 
     // Pixel format
-    if (pixelFormat < Core::FORMAT_MAX_COUNT)
+    if (IsPixelKernelFormat(pixelFormat))
     {
         mPixelFormat = pixelFormat;
     }
     else
     {
-        PG_FAILSTR("Invalid pixel format for a texture (%d), it must be < %d", pixelFormat, Core::FORMAT_MAX_COUNT);
+        PG_FAILSTR("Invalid pixel format for a texture (%d), it is not supported by the texture generators", pixelFormat);
         mPixelFormat = Core::FORMAT_RGBA_8_UNORM;
     }
 
@@ -142,6 +148,46 @@ TextureConfiguration::TextureConfiguration(Type type,
         PG_ASSERTSTR(numLayers == 1, "Invalid number of layers for a non-array texture (%d), it must be == 1", numLayers);
         mNumLayers = 1;
     }
+
+    // Number of mip levels
+    if (mType == TYPE_3D)
+    {
+        PG_ASSERTSTR(numMipLevels == 1, "Invalid number of mip levels for a 3D texture (%d), it must be == 1", numMipLevels);
+        mNumMipLevels = 1;
+    }
+    else if (!HasRGBA8Pixels())
+    {
+        PG_ASSERTSTR(numMipLevels == 1, "Invalid number of mip levels for a texture with a non-RGBA8 pixel format (%d), it must be == 1", numMipLevels);
+        mNumMipLevels = 1;
+    }
+    else
+    {
+        const unsigned int maxNumMipLevels = GetMaxNumMipLevels(mWidth, mHeight);
+        if (numMipLevels == 0)
+        {
+            mNumMipLevels = maxNumMipLevels;
+        }
+        else if (numMipLevels <= maxNumMipLevels)
+        {
+            mNumMipLevels = numMipLevels;
+        }
+        else
+        {
+            PG_FAILSTR("Invalid number of mip levels for a %dx%d texture (%d), it must be <= %d", mWidth, mHeight, numMipLevels, maxNumMipLevels);
+            mNumMipLevels = maxNumMipLevels;
+        }
+    }
+
+    // Mip filter
+    if (mipFilter < NUM_MIPFILTERS)
+    {
+        mMipFilter = mipFilter;
+    }
+    else
+    {
+        PG_FAILSTR("Invalid mip filter for a texture (%d), it must be < %d", mipFilter, NUM_MIPFILTERS);
+        mMipFilter = MIPFILTER_BOX;
+    }
 }
 
 //----------------------------------------------------------------------------------------
@@ -164,6 +210,8 @@ TextureConfiguration & TextureConfiguration::operator=(const TextureConfiguratio
     PG_ASSERT(other.mHeight >= 1);
     PG_ASSERT(other.mDepth >= 1);
     PG_ASSERT(other.mNumLayers >= 1);
+    PG_ASSERT(other.mNumMipLevels >= 1);
+    PG_ASSERT(other.mMipFilter < NUM_MIPFILTERS);
 
     mType = other.mType;
     mPixelFormat = other.mPixelFormat;
@@ -171,6 +219,8 @@ TextureConfiguration & TextureConfiguration::operator=(const TextureConfiguratio
     mHeight = other.mHeight;
     mDepth = other.mDepth;
     mNumLayers = other.mNumLayers;
+    mNumMipLevels = other.mNumMipLevels;
+    mMipFilter = other.mMipFilter;
 
     return *this;
 }
@@ -179,14 +229,39 @@ TextureConfiguration & TextureConfiguration::operator=(const TextureConfiguratio
 
 unsigned int TextureConfiguration::GetNumBytesPerPixel() const
 {
-    switch (mPixelFormat)
+    unsigned int numBytesPerPixel = 1;
+    if (!RunPixelKernel<PixelSizeKernel>(mPixelFormat, numBytesPerPixel))
+    {
+        PG_FAILSTR("Invalid texture pixel format (%d), it is not supported by the texture generators", mPixelFormat);
+    }
+    return numBytesPerPixel;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int TextureConfiguration::GetMaxNumMipLevels(unsigned int width, unsigned int height)
+{
+    unsigned int size = (width > height) ? width : height;
+    unsigned int numLevels = 1;
+    while ((size > 1) && (numLevels < MAX_NUM_MIP_LEVELS))
     {
-        case Core::FORMAT_RGBA_8_UNORM:         return 4;
+        size >>= 1;
+        ++numLevels;
+    }
+    return numLevels;
+}
 
-        default:
-            PG_FAILSTR("Invalid texture pixel format (%d), it should be less than %d", mPixelFormat, Core::FORMAT_RGBA_8_UNORM);
-            return 1;
+//----------------------------------------------------------------------------------------
+
+unsigned int TextureConfiguration::GetMipLevelOffset(unsigned int level) const
+{
+    PG_ASSERTSTR(level <= mNumMipLevels, "Invalid mip level (%d), it must be <= %d", level, mNumMipLevels);
+    unsigned int offset = 0;
+    for (unsigned int l = 0; l < level; ++l)
+    {
+        offset += GetNumBytesPerMipLevel(l);
     }
+    return offset;
 }
 
 //----------------------------------------------------------------------------------------
@@ -202,5 +277,20 @@ bool TextureConfiguration::IsCompatible(const TextureConfiguration & configurati
 }
 
 
+//----------------------------------------------------------------------------------------
+
+void TextureConfiguration::WriteDataKey(Graph::NodeDataKey & key) const
+{
+    key.WriteValue(static_cast<unsigned int>(mType));
+    key.WriteValue(static_cast<unsigned int>(mPixelFormat));
+    key.WriteValue(mWidth);
+    key.WriteValue(mHeight);
+    key.WriteValue(mDepth);
+    key.WriteValue(mNumLayers);
+    key.WriteValue(mNumMipLevels);
+    key.WriteValue(static_cast<unsigned int>(mMipFilter));
+}
+
+
 }   // namespace Texture
 }   // namespace Pegasus
@@ -10,6 +10,9 @@
 //! \brief	Texture node data, used by all texture nodes, including generators and operators
 
 #include "Pegasus/Texture/TextureData.h"
+#include "Pegasus/Texture/MipChain.h"
+#include "Pegasus/Core/Profiler.h"
+#include "Pegasus/Core/Thread.h"
 
 namespace Pegasus {
 namespace Texture {
@@ -21,24 +24,163 @@ TextureData::TextureData(const TextureConfiguration & configuration, Alloc::IAll
 {
     // Allocate the image data
     const unsigned int numLayers = configuration.GetNumLayers();
-    const unsigned int numBytesPerLayer = configuration.GetNumBytesPerLayer();
     mImageData = PG_NEW_ARRAY(GetAllocator(), -1, "TextureData::mImageData", Alloc::PG_MEM_TEMP, unsigned char *, numLayers);
+    AllocateCPUBuffers();
+}
+
+//----------------------------------------------------------------------------------------
+
+TextureData::~TextureData()
+{
+    const unsigned int numLayers = mConfiguration.GetNumLayers();
     for (unsigned int layer = 0; layer < numLayers; ++layer)
     {
-        mImageData[layer] = PG_NEW_ARRAY(GetAllocator(), -1, "TextureData::mImageData[layer]", Alloc::PG_MEM_TEMP, unsigned char, numBytesPerLayer);
+        if (mImageData[layer] != nullptr)
+        {
+            PG_DELETE_ARRAY(GetAllocator(), mImageData[layer]);
+        }
     }
+    PG_DELETE_ARRAY(GetAllocator(), mImageData);
+    ReleaseCompressedData();
+}
+
+//! Jobs compressing the block rows of a mip level of every layer, run by Core::RunParallelJobs()
+struct CompressionJobs
+{
+    Core::Format mFormat;
+    CompressionQuality mQuality;
+    const TextureData * mData;
+    unsigned int mLevel;
+    unsigned int mNumJobsPerLayer;              //!< Number of jobs covering the block rows of the level
+    unsigned char * mCompressedLevelData;       //!< Compressed level of the first layer
+    unsigned int mCompressedLayerSize;          //!< Size in bytes of the compressed mip levels of a layer
+};
+
+//! Compress the COMPRESSION_BLOCK_ROWS_PER_JOB block rows of a job
+static void CompressBlockRowsJob(void * userData, unsigned int jobIndex, unsigned int workerIndex)
+{
+    const CompressionJobs & jobs = *static_cast<const CompressionJobs *>(userData);
+    const TextureConfiguration & configuration = jobs.mData->GetConfiguration();
+    const unsigned int layer = jobIndex / jobs.mNumJobsPerLayer;
+    const unsigned int firstBlockRow = (jobIndex % jobs.mNumJobsPerLayer) * COMPRESSION_BLOCK_ROWS_PER_JOB;
+    CompressBlockRows(jobs.mFormat, jobs.mQuality, jobs.mData->GetLayerMipImageData(layer, jobs.mLevel),
+                      configuration.GetMipWidth(jobs.mLevel), configuration.GetMipHeight(jobs.mLevel),
+                      firstBlockRow, COMPRESSION_BLOCK_ROWS_PER_JOB, jobs.mCompressedLevelData + layer * jobs.mCompressedLayerSize);
 }
 
 //----------------------------------------------------------------------------------------
 
-TextureData::~TextureData()
+bool TextureData::Compress(Core::Format format, CompressionQuality quality)
+{
+    PG_ASSERTSTR(IsBlockCompressedFormat(format), "Invalid block compressed format (%d)", format);
+    PG_ASSERTSTR(quality < NUM_COMPRESSIONQUALITIES, "Invalid compression quality (%d)", quality);
+    if ((mCompressedData != nullptr) && (mCompressedFormat == format) && (mCompressionQuality == quality))
+    {
+        return true;
+    }
+    ReleaseCompressedData();
+    if ((mConfiguration.GetDepth() > 1) || !mConfiguration.HasRGBA8Pixels() || !IsCPUDataResident())
+    {
+        return false;
+    }
+
+    PG_PROFILE_SCOPE("CompressTextureData");
+    mCompressedFormat = format;
+    mCompressionQuality = quality;
+    const unsigned int numLayers = mConfiguration.GetNumLayers();
+    const unsigned int numMipLevels = mConfiguration.GetNumMipLevels();
+    for (unsigned int level = 0; level < numMipLevels; ++level)
+    {
+        mCompressedDataSize += GetCompressedLevelSize(level) * numLayers;
+    }
+    mCompressedData = PG_NEW_ARRAY(GetAllocator(), -1, "TextureData::mCompressedData", Alloc::PG_MEM_TEMP, unsigned char, mCompressedDataSize);
+
+    // The block rows of every layer and level are independent, each level runs its jobs for all the layers
+    // in parallel. The compressed levels of a layer are contiguous, then come the levels of the next layer
+    CompressionJobs jobs;
+    jobs.mFormat = format;
+    jobs.mQuality = quality;
+    jobs.mData = this;
+    jobs.mCompressedLevelData = mCompressedData;
+    jobs.mCompressedLayerSize = mCompressedDataSize / numLayers;
+    for (unsigned int level = 0; level < numMipLevels; ++level)
+    {
+        const unsigned int numBlockRows = GetNumCompressedBlocks(mConfiguration.GetMipHeight(level));
+        jobs.mLevel = level;
+        jobs.mNumJobsPerLayer = (numBlockRows + COMPRESSION_BLOCK_ROWS_PER_JOB - 1) / COMPRESSION_BLOCK_ROWS_PER_JOB;
+        Core::RunParallelJobs(CompressBlockRowsJob, &jobs, jobs.mNumJobsPerLayer * numLayers, 0);
+        jobs.mCompressedLevelData += GetCompressedLevelSize(level);
+    }
+    return true;
+}
+
+//----------------------------------------------------------------------------------------
+
+void TextureData::ReleaseCompressedData()
+{
+    if (mCompressedData != nullptr)
+    {
+        PG_DELETE_ARRAY(GetAllocator(), mCompressedData);
+        mCompressedData = nullptr;
+    }
+    mCompressedDataSize = 0;
+    mCompressedFormat = Core::FORMAT_MAX_COUNT;
+}
+
+//----------------------------------------------------------------------------------------
+
+const unsigned char * TextureData::GetLayerMipCompressedData(unsigned int layer, unsigned int level) const
+{
+    PG_ASSERTSTR(mCompressedData != nullptr, "The texture data has no compressed copy");
+    PG_ASSERTSTR(layer < mConfiguration.GetNumLayers(), "Invalid layer index (%d), it must be < %d", layer, mConfiguration.GetNumLayers());
+    PG_ASSERTSTR(level < mConfiguration.GetNumMipLevels(), "Invalid mip level (%d), it must be < %d", level, mConfiguration.GetNumMipLevels());
+
+    unsigned int layerSize = 0;
+    unsigned int levelOffset = 0;
+    for (unsigned int l = 0; l < mConfiguration.GetNumMipLevels(); ++l)
+    {
+        if (l == level)
+        {
+            levelOffset = layerSize;
+        }
+        layerSize += GetCompressedLevelSize(l);
+    }
+    return mCompressedData + layer * layerSize + levelOffset;
+}
+
+//----------------------------------------------------------------------------------------
+
+unsigned int TextureData::ReleaseCPUBuffers()
 {
     const unsigned int numLayers = mConfiguration.GetNumLayers();
     for (unsigned int layer = 0; layer < numLayers; ++layer)
     {
         PG_DELETE_ARRAY(GetAllocator(), mImageData[layer]);
+        mImageData[layer] = nullptr;
     }
-    PG_DELETE_ARRAY(GetAllocator(), mImageData);
+    const unsigned int compressedDataSize = mCompressedDataSize;
+    ReleaseCompressedData();
+    return mConfiguration.GetNumBytes() + compressedDataSize;
+}
+
+//----------------------------------------------------------------------------------------
+
+void TextureData::AllocateCPUBuffers()
+{
+    const unsigned int numLayers = mConfiguration.GetNumLayers();
+    const unsigned int numBytesPerLayer = mConfiguration.GetNumBytesPerLayerMipChain();
+    for (unsigned int layer = 0; layer < numLayers; ++layer)
+    {
+        mImageData[layer] = PG_NEW_ARRAY(GetAllocator(), -1, "TextureData::mImageData[layer]", Alloc::PG_MEM_TEMP, unsigned char, numBytesPerLayer);
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+void TextureData::CompleteGeneration()
+{
+    ReleaseCompressedData();
+    GenerateMipChain(this, GetAllocator());
 }
 
 
@@ -10,6 +10,7 @@
 //! \brief	Base texture generator node class
 
 #include "Pegasus/Texture/TextureGenerator.h"
+#include "Pegasus/Graph/NodeDataInterner.h"
 
 namespace Pegasus {
 namespace Texture {
@@ -86,6 +87,14 @@ Graph::NodeData * TextureGenerator::AllocateData() const
                     TextureData(mConfiguration, GetNodeDataAllocator());
 }
 
+//----------------------------------------------------------------------------------------
+
+bool TextureGenerator::WriteDataKey(Graph::NodeDataKey & key) const
+{
+    mConfiguration.WriteDataKey(key);
+    return true;
+}
+
 
 }   // namespace Texture
 }   // namespace Pegasus
@@ -11,12 +11,23 @@
 
 #include "Pegasus/Texture/TextureManager.h"
 #include "Pegasus/Graph/NodeManager.h"
+#include "Pegasus/Texture/ITextureFactory.h"
+#include "Pegasus/Memory/MemoryManager.h"
+#include "Pegasus/Memory/PoolAllocator.h"
 
 #include "Pegasus/Texture/Generator/ConstantColorGenerator.h"
 #include "Pegasus/Texture/Generator/GradientGenerator.h"
+#include "Pegasus/Texture/Generator/PerlinNoiseGenerator.h"
+#include "Pegasus/Texture/Generator/CellularNoiseGenerator.h"
+#include "Pegasus/Texture/Generator/FractalNoiseGenerator.h"
 #include "Pegasus/Texture/Generator/PixelsGenerator.h"
 
 #include "Pegasus/Texture/Operator/AddOperator.h"
+#include "Pegasus/Texture/Operator/BlurOperator.h"
+#include "Pegasus/Texture/Operator/NormalMapOperator.h"
+#include "Pegasus/Texture/Operator/LevelsOperator.h"
+#include "Pegasus/Texture/Operator/BlendOperator.h"
+#include "Pegasus/Texture/Operator/WarpOperator.h"
 
 namespace Pegasus {
 namespace Texture {
@@ -31,6 +42,8 @@ namespace Texture {
 TextureManager::TextureManager(Graph::NodeManager * nodeManager, ITextureFactory * textureFactory)
 :   mNodeManager(nodeManager)
 ,   mFactory(textureFactory)
+,   mDataInterner(Memory::GetNodeAllocator(), ReleaseInternedData, this)
+,   mTransientNodeData(false)
 #if PEGASUS_ENABLE_PROXIES
 ,   mProxy(this)
 #endif  // PEGASUS_ENABLE_PROXIES
@@ -39,6 +52,9 @@ TextureManager::TextureManager(Graph::NodeManager * nodeManager, ITextureFactory
 ,   mEventListener(nullptr)
 #endif
 {
+    // Sharing the texture data is opt-in
+    mDataInterner.SetEnabled(false);
+
     if (nodeManager != nullptr)
     {
         RegisterAllTextureNodes();
@@ -78,6 +94,8 @@ TextureReturn TextureManager::CreateTextureNode(const TextureConfiguration & con
         TextureRef texture = mNodeManager->CreateNode("Texture");
         texture->SetConfiguration(configuration);
         texture->SetFactory(mFactory);
+        texture->SetDataInterner(&mDataInterner);
+        texture->SetDataResidency(&mDataResidency);
 
 #if PEGASUS_ENABLE_PROXIES
         PEGASUS_EVENT_INIT_USER_DATA(static_cast<Pegasus::Texture::ITextureNodeProxy*>(texture->GetProxy()), "Texture", mEventListener);
@@ -103,6 +121,11 @@ TextureGeneratorReturn TextureManager::CreateTextureGeneratorNode(const char * c
 
         TextureGeneratorRef textureGenerator = mNodeManager->CreateNode(className);
         textureGenerator->SetConfiguration(configuration);
+        textureGenerator->SetDataInterner(&mDataInterner);
+        if (mTransientNodeData)
+        {
+            textureGenerator->SetTransientDataAllocator(Memory::GetTransientNodeDataAllocator());
+        }
 #if PEGASUS_USE_EVENTS
         //propagate event listener
         textureGenerator->SetEventListener(mEventListener);
@@ -128,6 +151,11 @@ TextureOperatorReturn TextureManager::CreateTextureOperatorNode(const char * cla
 
         TextureOperatorRef textureOperator = mNodeManager->CreateNode(className);
         textureOperator->SetConfiguration(configuration);
+        textureOperator->SetDataInterner(&mDataInterner);
+        if (mTransientNodeData)
+        {
+            textureOperator->SetTransientDataAllocator(Memory::GetTransientNodeDataAllocator());
+        }
 #if PEGASUS_USE_EVENTS
         //propagate event listener
         textureOperator->SetEventListener(mEventListener);
@@ -157,11 +185,30 @@ void TextureManager::RegisterAllTextureNodes()
     REGISTER_TEXTURE_NODE(ConstantColorGenerator);
     REGISTER_TEXTURE_NODE(GradientGenerator);
     REGISTER_TEXTURE_NODE(PixelsGenerator);
+    REGISTER_TEXTURE_NODE(PerlinNoiseGenerator);
+    REGISTER_TEXTURE_NODE(CellularNoiseGenerator);
+    REGISTER_TEXTURE_NODE(FractalNoiseGenerator);
 
     // Register the operator nodes
     // IMPORTANT! Add here every texture operator node that is created
     //            and update the list of #includes above
     REGISTER_TEXTURE_NODE(AddOperator);
+    REGISTER_TEXTURE_NODE(BlurOperator);
+    REGISTER_TEXTURE_NODE(NormalMapOperator);
+    REGISTER_TEXTURE_NODE(LevelsOperator);
+    REGISTER_TEXTURE_NODE(BlendOperator);
+    REGISTER_TEXTURE_NODE(WarpOperator);
+}
+
+//----------------------------------------------------------------------------------------
+
+void TextureManager::ReleaseInternedData(Graph::NodeData * data, void * userData)
+{
+    TextureManager * textureManager = static_cast<TextureManager *>(userData);
+    if (textureManager->mFactory != nullptr)
+    {
+        textureManager->mFactory->DestroyNodeGPUData(static_cast<TextureData *>(data));
+    }
 }
 
 //----------------------------------------------------------------------------------------
@@ -10,6 +10,7 @@
 //! \brief	Base texture operator node class
 
 #include "Pegasus/Texture/TextureOperator.h"
+#include "Pegasus/Graph/NodeDataInterner.h"
 
 namespace Pegasus {
 namespace Texture {
@@ -170,6 +171,14 @@ Graph::NodeData * TextureOperator::AllocateData() const
                   TextureData(mConfiguration, GetNodeDataAllocator());
 }
 
+//----------------------------------------------------------------------------------------
+
+bool TextureOperator::WriteDataKey(Graph::NodeDataKey & key) const
+{
+    mConfiguration.WriteDataKey(key);
+    return true;
+}
+
 
 }   // namespace Texture
 }   // namespace Pegasus
@@ -20,6 +20,7 @@
 #include "Pegasus/AssetLib/ASTree.h"
 #include "Pegasus/Utils/String.h"
 #include "Pegasus/Utils/Memset.h"
+#include "Pegasus/Core/Profiler.h"
 
 #if PEGASUS_ENABLE_PROXIES
 #include "Pegasus/Timeline/Proxy/BlockProxy.h"
@@ -359,6 +360,8 @@ void Lane::Update(UpdateInfo& updateInfo)
 
 void Lane::Render(RenderInfo& renderInfo)
 {
+    PG_PROFILE_SCOPE("Lane::Render");
+
     //! \todo The current approach is extremely brute force and inefficient.
     //! \todo Cache the current selected block in function of the timeline time.
 
@@ -17,6 +17,7 @@
 #include "Pegasus/AssetLib/Asset.h"
 #include "Pegasus/AssetLib/ASTree.h"
 #include "Pegasus/Core/Time.h"
+#include "Pegasus/Core/Profiler.h"
 #include "Pegasus/Math/Scalar.h"
 #include "Pegasus/Utils/String.h"
 #include "Pegasus/Utils/Memcpy.h"
@@ -291,6 +292,8 @@ void Timeline::ShutdownBlocks()
     
 void Timeline::Update(unsigned int musicPosition)
 {
+    PG_PROFILE_SCOPE("Timeline::Update");
+
     if ((mCurrentBeat == INVALID_BEAT) || (mCurrentBeat < 0.0f))
     {
         mCurrentBeat = 0.0f;
@@ -17,6 +17,7 @@
 #include "Pegasus/BlockScript/FunCallback.h"
 #include "Pegasus/BlockScript/BlockScriptManager.h"
 #include "Pegasus/BlockScript/IFileIncluder.h"
+#include "Pegasus/BlockScript/IBytecodeCache.h"
 #include "Pegasus/Utils/String.h"
 #include "Pegasus/Utils/Memset.h"
 #include "Pegasus/Utils/Vector.h"
@@ -71,6 +72,73 @@ void ScriptIncluder::Close(const char* buffer)
     //do nothing
 }
 
+//Helper class to store the compiled scripts in the cache root of the IO manager, named after the path of their asset
+//with the separators flattened and a 'c' appended. Nothing is cached without a cache root.
+class ScriptBytecodeCache : public IBytecodeCache
+{
+public:
+    ScriptBytecodeCache(IAllocator* allocator, IOManager* ioManager, const char* assetPath);
+
+    virtual ~ScriptBytecodeCache(){}
+
+    virtual bool Read(const char** outBuffer, int& outBufferSize);
+
+    virtual void ReleaseRead(const char* buffer);
+
+    virtual void Write(const void* buffer, int bufferSize);
+
+private:
+    IAllocator* mAllocator;
+    IOManager* mIoManager;
+    FileBuffer mFileBuffer;
+    char mPath[IOManager::MAX_FILEPATH_LENGTH];
+};
+
+ScriptBytecodeCache::ScriptBytecodeCache(IAllocator* allocator, IOManager* ioManager, const char* assetPath)
+: mAllocator(allocator), mIoManager(ioManager)
+{
+    mPath[0] = '\0';
+    if (mIoManager->HasCacheRoot() && Utils::Strlen(assetPath) + 1 < IOManager::MAX_FILEPATH_LENGTH)
+    {
+        Utils::Strcat(mPath, assetPath);
+        Utils::Strcat(mPath, "c");
+        for (char* c = mPath; *c != '\0'; ++c)
+        {
+            if (*c == '/' || *c == '\\' || *c == ':')
+            {
+                *c = '_';
+            }
+        }
+    }
+}
+
+bool ScriptBytecodeCache::Read(const char** outBuffer, int& outBufferSize)
+{
+    if (mPath[0] == '\0' || mIoManager->MapFileToBuffer(mPath, mFileBuffer, mAllocator, IOManager::ROOT_CACHE) != Io::ERR_NONE)
+    {
+        return false;
+    }
+    *outBuffer = mFileBuffer.GetBuffer();
+    outBufferSize = mFileBuffer.GetFileSize();
+    return true;
+}
+
+void ScriptBytecodeCache::ReleaseRead(const char* buffer)
+{
+    mFileBuffer.DestroyBuffer();
+}
+
+void ScriptBytecodeCache::Write(const void* buffer, int bufferSize)
+{
+    if (mPath[0] != '\0')
+    {
+        FileBuffer fb;
+        fb.OwnBuffer(mAllocator, static_cast<char*>(const_cast<void*>(buffer)), bufferSize);
+        mIoManager->SaveFileToBuffer(mPath, fb, IOManager::ROOT_CACHE);
+        fb.ForgetBuffer();
+    }
+}
+
 static int Pegasus_PrintString(const char * str)
 {
     PG_LOG('TMLN', " {script-echo} %s", str);
@@ -242,11 +310,19 @@ bool TimelineScript::CompileInternal()
 #endif
         mScript->SetFileIncluder(&includer);
         mScript->RegisterDefinitions(defNames, defValues, sizeof(defNames)/sizeof(defNames[0]));
+
+        //Scripts loaded from an asset keep their compiled version in the cache root, loaded when still valid.
+        ScriptBytecodeCache bytecodeCache(mAllocator, mAppContext->GetIOManager(), GetOwnerAsset() != nullptr ? GetOwnerAsset()->GetPath() : "");
+        mScript->SetBytecodeCache(GetOwnerAsset() != nullptr ? &bytecodeCache : nullptr);
         mScriptActive = mScript->Compile(&mFileBuffer);
+#if PEGASUS_ENABLE_PROXIES
+        PG_LOG('TMLN', "Script %s %s in %.2f ms", GetDisplayName(), mScript->IsLoadedFromCache() ? "loaded from cache" : "compiled", mScript->GetCompilationTime());
+#endif
 
         headersCopy.Clear(); //don't need the copy anymore.
 
         mScript->SetFileIncluder(nullptr);
+        mScript->SetBytecodeCache(nullptr);
         const char* types[] = { "float" }; //the only type of this functions is the beat
 
         const struct BindPointDesc {
@@ -315,7 +391,10 @@ void TimelineScript::CallFunction(BsVmState* state, TimelineScript::BindPoint fu
 {
     if (IsValidBindPoint(funct))
     {
-        bool res = mScript->ExecuteFunction(state, mBindPoints[funct], inputBuffer, inputBufferSz, &outputBuffer, outputBufferSz);
+        //functions called while an update is suspended run on top of it, and leave it suspended
+        bool res = state->GetExecutionState() == BsVmState::Suspended
+                 ? mScript->ExecuteFunctionWhileSuspended(state, mBindPoints[funct], inputBuffer, inputBufferSz, &outputBuffer, outputBufferSz)
+                 : mScript->ExecuteFunction(state, mBindPoints[funct], inputBuffer, inputBufferSz, &outputBuffer, outputBufferSz);
         if (!res)
        {
 #if PEGASUS_ENABLE_PROXIES
@@ -349,6 +428,21 @@ void TimelineScript::CallWindowDestroyed(int windowIndex, BsVmState* state)
     CallFunction(state, BIND_POINT_WINDOW_DESTROYED, &windowIndex, sizeof(windowIndex), &output, sizeof(output));
 }
 
+void TimelineScript::CallResume(BsVmState* state)
+{
+    if (mScriptActive)
+    {
+        //the return values of the timeline functions are not used
+        bool res = mScript->ResumeExecution(state);
+        if (!res)
+        {
+#if PEGASUS_ENABLE_PROXIES
+            PG_LOG('ERR_', "Error resuming suspended execution of script %s.", GetDisplayName());
+#endif
+        }
+    }
+}
+
 TimelineScript::~TimelineScript()
 {
     ClearHeaderList();
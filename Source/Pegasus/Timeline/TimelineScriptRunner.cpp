@@ -10,6 +10,8 @@
 //! \brief	Script runner, with state and coordination of Vm / compilation
 
 #include "Pegasus/Core/Assertion.h"
+#include "Pegasus/Core/Profiler.h"
+#include "Pegasus/Core/Time.h"
 #include "Pegasus/AssetLib/AssetLib.h"
 #include "Pegasus/Timeline/Timeline.h"
 #include "Pegasus/Timeline/TimelineScriptRunner.h"
@@ -27,6 +29,9 @@ namespace Pegasus
 namespace Timeline
 {
 
+    //! Default time budget of a script per frame, in milliseconds
+    static const double DEFAULT_YIELD_BUDGET = 4.0;
+
 #if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
     static Application::ScriptPermissions GetWindowCreationPermissions(bool controlGlobalCache)
     {
@@ -67,6 +72,9 @@ namespace Timeline
     , mVmState(nullptr)
     , mGlobalCache(nullptr)
     , mControlGlobalCacheReset(false)
+    , mYieldBudget(DEFAULT_YIELD_BUDGET)
+    , mPendingExecution(PENDING_NONE)
+    , mGlobalScopeUsesCategories(false)
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
     , mCategory(category)
 #endif
@@ -81,6 +89,7 @@ namespace Timeline
 #if PEGASUS_ENABLE_PROXIES
         if (mTimelineScript != nullptr)
         {
+            ResumePendingExecution(false);
             mTimelineScript->CallGlobalScopeDestroy(mVmState);
             mTimelineScript->UnregisterObserver(&mBlockScriptObserver);
             mTimelineScript = nullptr;
@@ -130,6 +139,7 @@ namespace Timeline
                 userCtx->Clean();
             }
             mVmState->Reset();
+            mPendingExecution = PENDING_NONE;
         }       
 #if PEGASUS_ENABLE_PROXIES
         script->RegisterObserver(&mBlockScriptObserver);
@@ -154,7 +164,9 @@ namespace Timeline
                     nodeContaier->Clean();
                 }
                 mVmState->Reset();
+                mVmState->SetRuntimeListener(nullptr);
             }
+            mPendingExecution = PENDING_NONE;
             mTimelineScript = nullptr;
         }
     
@@ -174,27 +186,16 @@ namespace Timeline
                 nodeContainer->SetGlobalCache(mGlobalCache);
                 nodeContainer->SetGlobalCacheListener(this);
             }
+            //an execution still suspended is abandoned, the global scope starts over
             mVmState->Reset();
 
-            //just listen for runtime events on the global scope initialization
-            mVmState->SetRuntimeListener(&mRuntimeListener);
             //re-initialize everything!
-#if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
-            if (useCategories) mAppContext->GetAssetLib()->BeginCategory(mCategory);
-#endif
-
-#if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
-            
-            static_cast<Application::RenderCollection*>(mVmState->GetUserContext())->SetPermissions(GetGlobalScopePermissions(mControlGlobalCacheReset));
-#endif
+            mGlobalScopeUsesCategories = useCategories;
+            BeginGlobalScope();
+            BeginYieldBudget();
             mTimelineScript->CallGlobalScopeInit(mVmState); 
-
-#if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
-            if (useCategories) mAppContext->GetAssetLib()->EndCategory();
-#endif
-
-            // remove the listener. No need to listen for more events.
-            mVmState->SetRuntimeListener(nullptr);
+            EndYieldBudget();
+            EndGlobalScope();
 
             //restart initialization of all windows
 #if PEGASUS_ENABLE_PROXIES
@@ -211,6 +212,7 @@ namespace Timeline
         //TODO: remove this global scope destroy stuff
         if (mTimelineScript != nullptr && mTimelineScript->IsDirty())
         {
+            ResumePendingExecution(false);
             mTimelineScript->CallGlobalScopeDestroy(mVmState);
         }
 
@@ -239,21 +241,39 @@ namespace Timeline
 
     void TimelineScriptRunner::CallUpdate(const UpdateInfo& updateInfo)
     {
+        PG_PROFILE_SCOPE("TimelineScriptRunner::CallUpdate");
         if (mTimelineScript != nullptr)
         {
             InitializeScript(); //in case a dirty compilation has been carried on.
             Application::RenderCollection* nodeContainer = static_cast<Application::RenderCollection*>(mVmState->GetUserContext());
+            if (mPendingExecution != PENDING_NONE)
+            {
+                //continue the work suspended by a yield statement instead of starting a new update
+                ResumePendingExecution(true);
+            }
+            else
+            {
 #if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
-            nodeContainer->SetPermissions(Application::PERMISSIONS_DEFAULT);
+                nodeContainer->SetPermissions(Application::PERMISSIONS_DEFAULT);
 #endif
-            mTimelineScript->CallUpdate(updateInfo, mVmState);
+                BeginYieldBudget();
+                mTimelineScript->CallUpdate(updateInfo, mVmState);
+                EndYieldBudget();
+                if (mVmState->GetExecutionState() == BlockScript::BsVmState::Suspended)
+                {
+                    mPendingExecution = PENDING_UPDATE;
+                }
+            }
             nodeContainer->UpdateAll();
         }
     }
 
     void TimelineScriptRunner::CallRender(const RenderInfo& renderInfo)
     {
-        if (mTimelineScript != nullptr)
+        PG_PROFILE_SCOPE("TimelineScriptRunner::CallRender");
+        //the globals are not ready to render until the global scope completes.
+        //A suspended update renders the state it has reached so far
+        if (mTimelineScript != nullptr && mPendingExecution != PENDING_GLOBAL_SCOPE)
         {
 #if PEGASUS_ENABLE_PROXIES
             if (!mWindowIsInitialized[renderInfo.windowId])
@@ -279,6 +299,7 @@ namespace Timeline
 #endif
         if (mTimelineScript != nullptr)
         {
+            ResumePendingExecution(false);
 
 #if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
             Application::RenderCollection* nodeContainer = static_cast<Application::RenderCollection*>(mVmState->GetUserContext());
@@ -296,6 +317,8 @@ namespace Timeline
 #endif
         if (mTimelineScript != nullptr)
         {
+            ResumePendingExecution(false);
+
 #if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
             Application::RenderCollection* nodeContainer = static_cast<Application::RenderCollection*>(mVmState->GetUserContext());
             nodeContainer->SetPermissions(GetWindowCreationPermissions(mControlGlobalCacheReset));
@@ -309,6 +332,84 @@ namespace Timeline
         mScriptVersion = -1; // invalidate the script version, will force rerun of globals 
     }
 
+    void TimelineScriptRunner::BeginYieldBudget()
+    {
+        const double budgetTicks = mYieldBudget * 0.001 / Core::GetPerformanceCounterPeriod();
+        mVmState->SetYieldDeadline(Core::GetPerformanceCounter() + static_cast<unsigned long long>(budgetTicks > 0.0 ? budgetTicks : 0.0));
+    }
+
+    void TimelineScriptRunner::EndYieldBudget()
+    {
+        mVmState->SetYieldDeadline(BlockScript::BsVmState::NO_YIELD_DEADLINE);
+    }
+
+    void TimelineScriptRunner::BeginGlobalScope()
+    {
+        //just listen for runtime events on the global scope initialization
+        mVmState->SetRuntimeListener(&mRuntimeListener);
+#if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
+        if (mGlobalScopeUsesCategories) mAppContext->GetAssetLib()->BeginCategory(mCategory);
+#endif
+
+#if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
+        static_cast<Application::RenderCollection*>(mVmState->GetUserContext())->SetPermissions(GetGlobalScopePermissions(mControlGlobalCacheReset));
+#endif
+    }
+
+    void TimelineScriptRunner::EndGlobalScope()
+    {
+#if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
+        if (mGlobalScopeUsesCategories) mAppContext->GetAssetLib()->EndCategory();
+#endif
+
+        if (mVmState->GetExecutionState() == BlockScript::BsVmState::Suspended)
+        {
+            //keep listening until the global scope completes
+            mPendingExecution = PENDING_GLOBAL_SCOPE;
+        }
+        else
+        {
+            // remove the listener. No need to listen for more events.
+            mVmState->SetRuntimeListener(nullptr);
+            mPendingExecution = PENDING_NONE;
+        }
+    }
+
+    void TimelineScriptRunner::ResumePendingExecution(bool useYieldBudget)
+    {
+        if (mPendingExecution == PENDING_NONE)
+        {
+            return;
+        }
+
+        if (mPendingExecution == PENDING_GLOBAL_SCOPE)
+        {
+            BeginGlobalScope();
+        }
+#if PEGASUS_ENABLE_SCRIPT_PERMISSIONS
+        else
+        {
+            static_cast<Application::RenderCollection*>(mVmState->GetUserContext())->SetPermissions(Application::PERMISSIONS_DEFAULT);
+        }
+#endif
+
+        if (useYieldBudget)
+        {
+            BeginYieldBudget();
+        }
+        mTimelineScript->CallResume(mVmState);
+        EndYieldBudget();
+
+        if (mPendingExecution == PENDING_GLOBAL_SCOPE)
+        {
+            EndGlobalScope();
+        }
+        else if (mVmState->GetExecutionState() != BlockScript::BsVmState::Suspended)
+        {
+            mPendingExecution = PENDING_NONE;
+        }
+    }
+
 
 #if PEGASUS_ENABLE_PROXIES
     void TimelineScriptRunner::BlockScriptObserver::OnCompilationBegin()
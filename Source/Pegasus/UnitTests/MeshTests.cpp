@@ -0,0 +1,777 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshTests.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Pegasus Unit tests for the mesh processing functions of the Mesh package, implementation.
+//!         The measured figures are printed, so they can be compared between machines
+
+#include "Pegasus/UnitTests/MeshTests.h"
+#include "Pegasus/Memory/MallocFreeAllocator.h"
+#include "Pegasus/Mesh/MeshOptimizer.h"
+#include "Pegasus/Mesh/MeshSimplifier.h"
+#include "Pegasus/Mesh/MeshWelder.h"
+#include "Pegasus/Mesh/MeshData.h"
+#include "Pegasus/Mesh/MeshQuantizer.h"
+#include "Pegasus/Mesh/MeshBvh.h"
+#include "Pegasus/Math/Intersections.h"
+#include "Pegasus/Math/Scalar.h"
+#include "Pegasus/Core/Time.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+using namespace Pegasus::Mesh;
+
+static Pegasus::Memory::MallocFreeAllocator sGlobalAllocator(0);
+
+//! Number of vertices on each side of the test grids
+static const unsigned int GRID_SIZE = 100;
+
+//! Number of quads on each side of the height field of the simplification tests (18,432 triangles).
+//! The simplification of a larger terrain is measured by the GraphBenchmark block of TestApp1
+static const unsigned int TERRAIN_SIZE = 96;
+
+//! Pseudo random generator of the tests, deterministic so the figures can be reproduced
+static unsigned int NextRandom(unsigned int & seed)
+{
+    seed = seed * 1664525u + 1013904223u;
+    return seed >> 8;
+}
+
+//! Pseudo random value in [-1, 1]
+static float NextRandomFloat(unsigned int & seed)
+{
+    return static_cast<float>(NextRandom(seed) & 0xFFFF) * (2.0f / 65535.0f) - 1.0f;
+}
+
+//! Start measuring a duration
+//! \return Performance counter at the start of the measurement
+static unsigned long long StartTimer()
+{
+    static bool sTimeInitialized = false;
+    if (!sTimeInitialized)
+    {
+        Pegasus::Core::InitializePegasusTime();
+        sTimeInitialized = true;
+    }
+    return Pegasus::Core::GetPerformanceCounter();
+}
+
+//! Get the duration since the start of a measurement
+//! \param startCounter Performance counter returned by \a StartTimer()
+//! \return Duration in milliseconds
+static double GetElapsedMs(unsigned long long startCounter)
+{
+    return static_cast<double>(Pegasus::Core::GetPerformanceCounter() - startCounter) * Pegasus::Core::GetPerformanceCounterPeriod() * 1000.0;
+}
+
+//! Fill the indices of a square grid of vertices, row after row, 2 triangles per quad
+//! \param indices Indices to fill, 6 * (gridSize - 1)^2 entries
+//! \param gridSize Number of vertices on each side of the grid
+//! \return Number of indices
+static unsigned int BuildGridIndices(unsigned short * indices, unsigned int gridSize)
+{
+    unsigned int numIndices = 0;
+    for (unsigned int y = 0; y + 1 < gridSize; ++y)
+    {
+        for (unsigned int x = 0; x + 1 < gridSize; ++x)
+        {
+            const unsigned short v = static_cast<unsigned short>(y * gridSize + x);
+            const unsigned short right = static_cast<unsigned short>(v + 1);
+            const unsigned short below = static_cast<unsigned short>(v + gridSize);
+            indices[numIndices++] = v;
+            indices[numIndices++] = below;
+            indices[numIndices++] = right;
+            indices[numIndices++] = right;
+            indices[numIndices++] = below;
+            indices[numIndices++] = static_cast<unsigned short>(below + 1);
+        }
+    }
+    return numIndices;
+}
+
+//! Shuffle the triangles of a triangle list, keeping the corners of each triangle in order
+static void ShuffleTriangles(unsigned short * indices, unsigned int numIndices, unsigned int seed)
+{
+    for (unsigned int t = numIndices / 3; t > 1; --t)
+    {
+        const unsigned int other = NextRandom(seed) % t;
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            const unsigned short index = indices[(t - 1) * 3 + c];
+            indices[(t - 1) * 3 + c] = indices[other * 3 + c];
+            indices[other * 3 + c] = index;
+        }
+    }
+}
+
+//! Comparison function of the triangle keys for qsort
+static int CompareTriangleKeys(const void * key1, const void * key2)
+{
+    const unsigned long long k1 = *static_cast<const unsigned long long *>(key1);
+    const unsigned long long k2 = *static_cast<const unsigned long long *>(key2);
+    return (k1 < k2) ? -1 : ((k1 > k2) ? 1 : 0);
+}
+
+//! Compute the sorted keys of the triangles of a list, each triangle being rotated
+//! to start with its smallest index, so the key is independent of the first corner but keeps the winding
+static void ComputeTriangleKeys(const unsigned short * indices, unsigned int numIndices, unsigned long long * keys)
+{
+    for (unsigned int t = 0; t < numIndices / 3; ++t)
+    {
+        const unsigned short * triangle = indices + t * 3;
+        const unsigned int first = (triangle[0] <= triangle[1] && triangle[0] <= triangle[2]) ? 0
+                                 : ((triangle[1] <= triangle[2]) ? 1 : 2);
+        keys[t] = (static_cast<unsigned long long>(triangle[first]) << 32)
+                | (static_cast<unsigned long long>(triangle[(first + 1) % 3]) << 16)
+                |  static_cast<unsigned long long>(triangle[(first + 2) % 3]);
+    }
+    qsort(keys, numIndices / 3, sizeof(unsigned long long), CompareTriangleKeys);
+}
+
+//! True if two triangle lists contain the same triangles with the same windings, in any order
+static bool SameTriangles(const unsigned short * indices1, const unsigned short * indices2, unsigned int numIndices)
+{
+    const unsigned int numTriangles = numIndices / 3;
+    unsigned long long * keys1 = static_cast<unsigned long long *>(malloc(numTriangles * sizeof(unsigned long long)));
+    unsigned long long * keys2 = static_cast<unsigned long long *>(malloc(numTriangles * sizeof(unsigned long long)));
+    ComputeTriangleKeys(indices1, numIndices, keys1);
+    ComputeTriangleKeys(indices2, numIndices, keys2);
+    bool match = true;
+    for (unsigned int t = 0; t < numTriangles; ++t)
+    {
+        match = match && (keys1[t] == keys2[t]);
+    }
+    free(keys1);
+    free(keys2);
+    return match;
+}
+
+//! Optimize a grid for the default vertex cache size and check the efficiency before and after
+//! \param shuffle True to shuffle the triangles of the grid before the optimization
+//! \param minACMRBefore Minimum expected ACMR before the optimization
+//! \param maxACMRBefore Maximum expected ACMR before the optimization
+//! \param maxACMRAfter Maximum expected ACMR after the optimization
+//! \return True if the ACMRs are in range and the triangles are preserved
+static bool TestGridVertexCache(bool shuffle, float minACMRBefore, float maxACMRBefore, float maxACMRAfter)
+{
+    const unsigned int numVertices = GRID_SIZE * GRID_SIZE;
+    const unsigned int maxNumIndices = 6 * (GRID_SIZE - 1) * (GRID_SIZE - 1);
+    unsigned short * indices = static_cast<unsigned short *>(malloc(maxNumIndices * sizeof(unsigned short)));
+    unsigned short * inputIndices = static_cast<unsigned short *>(malloc(maxNumIndices * sizeof(unsigned short)));
+    const unsigned int numIndices = BuildGridIndices(indices, GRID_SIZE);
+    if (shuffle)
+    {
+        ShuffleTriangles(indices, numIndices, 12345);
+    }
+    for (unsigned int i = 0; i < numIndices; ++i)
+    {
+        inputIndices[i] = indices[i];
+    }
+
+    VertexCacheStats statsBefore;
+    ComputeVertexCacheStats(indices, numIndices, numVertices, VERTEX_CACHE_SIZE, &sGlobalAllocator, statsBefore);
+    const unsigned int numClusters = OptimizeVertexCache(indices, numIndices, numVertices, VERTEX_CACHE_SIZE, &sGlobalAllocator, nullptr);
+    VertexCacheStats statsAfter;
+    ComputeVertexCacheStats(indices, numIndices, numVertices, VERTEX_CACHE_SIZE, &sGlobalAllocator, statsAfter);
+
+    printf("%ux%u grid%s, cache %u: ACMR %.3f -> %.3f, ATVR %.3f -> %.3f, %u clusters\n",
+           GRID_SIZE, GRID_SIZE, shuffle ? " (shuffled)" : "", VERTEX_CACHE_SIZE,
+           statsBefore.mACMR, statsAfter.mACMR, statsBefore.mATVR, statsAfter.mATVR, numClusters);
+
+    const bool match = (statsBefore.mACMR >= minACMRBefore) && (statsBefore.mACMR <= maxACMRBefore)
+                    && (statsAfter.mACMR <= maxACMRAfter)
+                    && (numClusters >= 1) && (numClusters <= numIndices / 3)
+                    && SameTriangles(inputIndices, indices, numIndices);
+    free(indices);
+    free(inputIndices);
+    return match;
+}
+
+bool UNIT_TEST_VertexCache1()
+{
+    //a grid drawn row after row misses the previous row in a 16 entries cache, about 1 vertex per triangle
+    return TestGridVertexCache(false, 0.95f, 1.05f, 0.65f);
+}
+
+bool UNIT_TEST_VertexCache2()
+{
+    //shuffled triangles miss almost every vertex, the optimization brings them back to the regular order level
+    return TestGridVertexCache(true, 2.9f, 3.0f, 0.65f);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Height field with a UV seam, as a simplifier input
+struct Terrain
+{
+    unsigned int mNumVertices;      //!< Number of vertices, including the copies of the seam
+    unsigned int mNumIndices;       //!< Number of indices, 3 per triangle
+    unsigned int mSeamColumn;       //!< Column of vertices of the seam
+    float * mPositions;             //!< Positions of the vertices, 3 floats each
+    unsigned int * mIndices;        //!< Indices of the triangles
+};
+
+//! Get the input vertex of a grid position of a terrain
+//! \param terrain Terrain to look into
+//! \param x Column of the vertex
+//! \param y Row of the vertex
+//! \param rightOfSeam True to get the copy of the vertex used on the right of the seam
+static unsigned int GetTerrainVertex(const Terrain & terrain, unsigned int x, unsigned int y, bool rightOfSeam)
+{
+    const unsigned int gridSize = TERRAIN_SIZE + 1;
+    return (rightOfSeam && (x == terrain.mSeamColumn)) ? (gridSize * gridSize + y) : (y * gridSize + x);
+}
+
+//! Build a noisy height field, the triangles on the right of its middle column use copies
+//! of the vertices of that column, as a UV seam would
+static void BuildTerrain(Terrain & terrain)
+{
+    const unsigned int gridSize = TERRAIN_SIZE + 1;
+    terrain.mNumVertices = gridSize * gridSize + gridSize;
+    terrain.mNumIndices = TERRAIN_SIZE * TERRAIN_SIZE * 6;
+    terrain.mSeamColumn = TERRAIN_SIZE / 2;
+    terrain.mPositions = static_cast<float *>(malloc(terrain.mNumVertices * 3 * sizeof(float)));
+    terrain.mIndices = static_cast<unsigned int *>(malloc(terrain.mNumIndices * sizeof(unsigned int)));
+
+    unsigned int seed = 4321;
+    for (unsigned int y = 0; y < gridSize; ++y)
+    {
+        for (unsigned int x = 0; x < gridSize; ++x)
+        {
+            float * position = terrain.mPositions + (y * gridSize + x) * 3;
+            position[0] = static_cast<float>(x);
+            position[1] = static_cast<float>(y);
+            position[2] = 8.0f * Pegasus::Math::Sin(static_cast<float>(x) * 0.02f) * Pegasus::Math::Cos(static_cast<float>(y) * 0.03f)
+                        + 0.05f * NextRandomFloat(seed);
+        }
+    }
+    for (unsigned int y = 0; y < gridSize; ++y)
+    {
+        const float * position = terrain.mPositions + GetTerrainVertex(terrain, terrain.mSeamColumn, y, false) * 3;
+        float * copy = terrain.mPositions + GetTerrainVertex(terrain, terrain.mSeamColumn, y, true) * 3;
+        copy[0] = position[0];
+        copy[1] = position[1];
+        copy[2] = position[2];
+    }
+
+    unsigned int numIndices = 0;
+    for (unsigned int y = 0; y < TERRAIN_SIZE; ++y)
+    {
+        for (unsigned int x = 0; x < TERRAIN_SIZE; ++x)
+        {
+            const bool rightOfSeam = (x >= terrain.mSeamColumn);
+            const unsigned int v = GetTerrainVertex(terrain, x, y, rightOfSeam);
+            const unsigned int right = GetTerrainVertex(terrain, x + 1, y, rightOfSeam);
+            const unsigned int below = GetTerrainVertex(terrain, x, y + 1, rightOfSeam);
+            const unsigned int belowRight = GetTerrainVertex(terrain, x + 1, y + 1, rightOfSeam);
+            terrain.mIndices[numIndices++] = v;
+            terrain.mIndices[numIndices++] = right;
+            terrain.mIndices[numIndices++] = below;
+            terrain.mIndices[numIndices++] = right;
+            terrain.mIndices[numIndices++] = belowRight;
+            terrain.mIndices[numIndices++] = below;
+        }
+    }
+}
+
+//! Release the buffers of a terrain
+static void DestroyTerrain(Terrain & terrain)
+{
+    free(terrain.mPositions);
+    free(terrain.mIndices);
+}
+
+//! Check the triangles of a simplified terrain
+//! \param terrain Input terrain
+//! \param indices Indices of the simplified triangles
+//! \param numIndices Number of indices of the simplified triangles
+//! \return True if no triangle is flipped, every border vertex is kept and no triangle mixes both sides of the seam
+static bool CheckSimplifiedTerrain(const Terrain & terrain, const unsigned int * indices, unsigned int numIndices)
+{
+    const unsigned int gridSize = TERRAIN_SIZE + 1;
+    bool * usedVertices = static_cast<bool *>(malloc(terrain.mNumVertices * sizeof(bool)));
+    for (unsigned int v = 0; v < terrain.mNumVertices; ++v)
+    {
+        usedVertices[v] = false;
+    }
+
+    unsigned int numFlipped = 0;
+    unsigned int numMixed = 0;
+    for (unsigned int t = 0; t < numIndices / 3; ++t)
+    {
+        const unsigned int * triangle = indices + t * 3;
+        const float * p0 = terrain.mPositions + triangle[0] * 3;
+        const float * p1 = terrain.mPositions + triangle[1] * 3;
+        const float * p2 = terrain.mPositions + triangle[2] * 3;
+        const float normalZ = (p1[0] - p0[0]) * (p2[1] - p0[1]) - (p1[1] - p0[1]) * (p2[0] - p0[0]);
+        numFlipped += (normalZ <= 0.0f) ? 1 : 0;
+
+        //the original seam vertices belong to the left side of the seam, their copies to the right side
+        bool hasLeft = false;
+        bool hasRight = false;
+        for (unsigned int c = 0; c < 3; ++c)
+        {
+            const unsigned int vertex = triangle[c];
+            usedVertices[vertex] = true;
+            const bool isCopy = (vertex >= gridSize * gridSize);
+            hasLeft = hasLeft || (!isCopy && (vertex % gridSize <= terrain.mSeamColumn));
+            hasRight = hasRight || isCopy || (vertex % gridSize > terrain.mSeamColumn);
+        }
+        numMixed += (hasLeft && hasRight) ? 1 : 0;
+    }
+
+    unsigned int numLostBorderVertices = 0;
+    for (unsigned int i = 0; i < gridSize; ++i)
+    {
+        const unsigned int borderX[4] = { i, i, 0, TERRAIN_SIZE };
+        const unsigned int borderY[4] = { 0, TERRAIN_SIZE, i, i };
+        for (unsigned int b = 0; b < 4; ++b)
+        {
+            const bool used = usedVertices[GetTerrainVertex(terrain, borderX[b], borderY[b], false)]
+                           || usedVertices[GetTerrainVertex(terrain, borderX[b], borderY[b], true)];
+            numLostBorderVertices += used ? 0 : 1;
+        }
+    }
+    free(usedVertices);
+
+    if ((numFlipped != 0) || (numMixed != 0) || (numLostBorderVertices != 0))
+    {
+        printf("%u flipped triangles, %u triangles across the seam, %u border vertices lost\n", numFlipped, numMixed, numLostBorderVertices);
+    }
+    return (numFlipped == 0) && (numMixed == 0) && (numLostBorderVertices == 0);
+}
+
+//! Simplify the test terrain to a ratio of its triangles and check the result
+//! \param ratio Ratio of triangles to keep, in ]0, 1[
+//! \return True if the target is reached and the simplified triangles pass \a CheckSimplifiedTerrain()
+static bool TestTerrainSimplification(float ratio)
+{
+    Terrain terrain;
+    BuildTerrain(terrain);
+    unsigned int * outIndices = static_cast<unsigned int *>(malloc(terrain.mNumIndices * sizeof(unsigned int)));
+    const unsigned int targetNumIndices = static_cast<unsigned int>(static_cast<float>(terrain.mNumIndices) * ratio);
+
+    float error = 0.0f;
+    const unsigned int numOutIndices = SimplifyMesh(terrain.mIndices, terrain.mNumIndices, terrain.mPositions, 3 * sizeof(float),
+                                                    terrain.mNumVertices, targetNumIndices, 0.0f, &sGlobalAllocator, outIndices, &error);
+
+    printf("%u triangles (%u vertices) simplified to %u triangles (target %u), error %.4f\n",
+           terrain.mNumIndices / 3, terrain.mNumVertices, numOutIndices / 3, targetNumIndices / 3, error);
+
+    const bool match = (numOutIndices <= targetNumIndices) && (numOutIndices >= targetNumIndices * 9 / 10) && (error > 0.0f)
+                    && CheckSimplifiedTerrain(terrain, outIndices, numOutIndices);
+    free(outIndices);
+    DestroyTerrain(terrain);
+    return match;
+}
+
+bool UNIT_TEST_Simplify1()
+{
+    return TestTerrainSimplification(0.5f);
+}
+
+bool UNIT_TEST_Simplify2()
+{
+    return TestTerrainSimplification(0.25f);
+}
+
+bool UNIT_TEST_Simplify3()
+{
+    return TestTerrainSimplification(0.1f);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Number of quads on each side of the unwelded grid of the welding tests
+static const unsigned int WELD_GRID_SIZE = 100;
+
+//! Fill the vertex of a corner of an unwelded grid. The left and right halves of the grid
+//! have different texture coordinates (UV seam), the top and bottom halves are tilted
+//! in opposite directions (normal crease)
+//! \param x Column of the corner
+//! \param y Row of the corner
+//! \param quadX Column of the quad using the corner
+//! \param quadY Row of the quad using the corner
+//! \param vertex Vertex to fill (output)
+static void FillWeldGridVertex(unsigned int x, unsigned int y, unsigned int quadX, unsigned int quadY, StdVertex & vertex)
+{
+    const unsigned int half = WELD_GRID_SIZE / 2;
+    const float tilt = 0.5f;
+    const float distanceToCrease = static_cast<float>(y) - static_cast<float>(half);
+    vertex.position = Pegasus::Math::Vec4(static_cast<float>(x), static_cast<float>(y), tilt * Pegasus::Math::Abs(distanceToCrease), 1.0f);
+    vertex.normal = Pegasus::Math::Vec3(0.0f, (quadY < half) ? tilt : -tilt, 1.0f);
+    Pegasus::Math::Normalize(vertex.normal);
+    vertex.uv = Pegasus::Math::Vec2(static_cast<float>(x) / static_cast<float>(WELD_GRID_SIZE) + ((quadX < half) ? 0.0f : 1.0f),
+                                    static_cast<float>(y) / static_cast<float>(WELD_GRID_SIZE));
+}
+
+//! True if two vertices have the same attributes
+static bool SameVertex(const StdVertex & vertex1, const StdVertex & vertex2)
+{
+    return (vertex1.position.x == vertex2.position.x) && (vertex1.position.y == vertex2.position.y) && (vertex1.position.z == vertex2.position.z)
+        && (vertex1.normal.x == vertex2.normal.x) && (vertex1.normal.y == vertex2.normal.y) && (vertex1.normal.z == vertex2.normal.z)
+        && (vertex1.uv.x == vertex2.uv.x) && (vertex1.uv.y == vertex2.uv.y);
+}
+
+bool UNIT_TEST_Weld1()
+{
+    //an unwelded grid, every triangle having its own vertices, and a second level of detail
+    //using one quad out of two. Once welded, each grid position keeps one vertex per side of the seam
+    //and of the crease: (101 + 1) * (101 + 1) vertices
+    MeshConfiguration configuration;
+    MeshInputLayout inputLayout;
+    inputLayout.GenerateEditorLayout(MeshInputLayout::USE_POSITION | MeshInputLayout::USE_UV | MeshInputLayout::USE_NORMAL);
+    configuration.SetInputLayout(inputLayout);
+    configuration.SetIsIndexed(true);
+    MeshDataRef meshData = PG_NEW(&sGlobalAllocator, -1, "Weld test mesh", Pegasus::Alloc::PG_MEM_TEMP)
+                                  MeshData(configuration, Pegasus::Graph::Node::STANDARD, &sGlobalAllocator);
+
+    const unsigned int numVertices = WELD_GRID_SIZE * WELD_GRID_SIZE * 6;
+    const unsigned int numLod1Indices = numVertices / 2;
+    meshData->AllocateVertexes(static_cast<int>(numVertices));
+    meshData->AllocateIndexes(static_cast<int>(numVertices + numLod1Indices));
+    StdVertex * vertices = meshData->GetStream<StdVertex>(0);
+    unsigned short * indices = meshData->GetIndexBuffer();
+    const unsigned int cornerX[6] = { 0, 1, 0, 1, 1, 0 };
+    const unsigned int cornerY[6] = { 0, 0, 1, 0, 1, 1 };
+    unsigned int numLodIndices = numVertices;
+    for (unsigned int quadY = 0; quadY < WELD_GRID_SIZE; ++quadY)
+    {
+        for (unsigned int quadX = 0; quadX < WELD_GRID_SIZE; ++quadX)
+        {
+            const unsigned int firstVertex = (quadY * WELD_GRID_SIZE + quadX) * 6;
+            for (unsigned int c = 0; c < 6; ++c)
+            {
+                FillWeldGridVertex(quadX + cornerX[c], quadY + cornerY[c], quadX, quadY, vertices[firstVertex + c]);
+                indices[firstVertex + c] = static_cast<unsigned short>(firstVertex + c);
+                if (((quadX + quadY) & 1) == 0)
+                {
+                    indices[numLodIndices++] = static_cast<unsigned short>(firstVertex + c);
+                }
+            }
+        }
+    }
+    const int lodIndexCounts[2] = { static_cast<int>(numVertices), static_cast<int>(numLod1Indices) };
+    const float lodErrors[2] = { 0.0f, 1.0f };
+    meshData->SetLods(lodIndexCounts, lodErrors, 2);
+
+    //the corners of the triangles before the welding
+    StdVertex * inputCorners = static_cast<StdVertex *>(malloc((numVertices + numLod1Indices) * sizeof(StdVertex)));
+    for (unsigned int i = 0; i < numVertices + numLod1Indices; ++i)
+    {
+        inputCorners[i] = vertices[indices[i]];
+    }
+
+    const unsigned long long startCounter = StartTimer();
+    const unsigned int numRemovedVertices = WeldMesh(&(*meshData), WELD_POSITION_TOLERANCE, WELD_NORMAL_TOLERANCE, WELD_UV_TOLERANCE, &sGlobalAllocator);
+    const double durationMs = GetElapsedMs(startCounter);
+
+    const unsigned int expectedNumVertices = (WELD_GRID_SIZE + 2) * (WELD_GRID_SIZE + 2);
+    printf("%u vertices welded to %u (expected %u) in %.1f ms\n",
+           numVertices, numVertices - numRemovedVertices, expectedNumVertices, durationMs);
+
+    //every corner keeps its attributes, and the levels of detail keep their triangles
+    vertices = meshData->GetStream<StdVertex>(0);
+    indices = meshData->GetIndexBuffer();
+    bool match = (static_cast<unsigned int>(meshData->GetVertexCount()) == expectedNumVertices)
+              && (numVertices - numRemovedVertices == expectedNumVertices)
+              && (static_cast<unsigned int>(meshData->GetIndexCount()) == numVertices + numLod1Indices)
+              && (meshData->GetLodCount() == 2)
+              && (meshData->GetLodFirstIndex(1) == static_cast<int>(numVertices))
+              && (meshData->GetLodIndexCount(1) == static_cast<int>(numLod1Indices));
+    for (unsigned int i = 0; match && (i < numVertices + numLod1Indices); ++i)
+    {
+        match = (indices[i] < expectedNumVertices) && SameVertex(vertices[indices[i]], inputCorners[i]);
+    }
+    free(inputCorners);
+    return match;
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Number of random vertices of the quantization tests
+static const unsigned int QUANTIZE_VERTEX_COUNT = 100000;
+
+//! Angle between two unit vectors, precise for small angles
+//! \return Angle in degrees
+static double GetAngleDegrees(const Pegasus::Math::Vec3 & vector1, const Pegasus::Math::Vec3 & vector2)
+{
+    const double crossX = static_cast<double>(vector1.y) * vector2.z - static_cast<double>(vector1.z) * vector2.y;
+    const double crossY = static_cast<double>(vector1.z) * vector2.x - static_cast<double>(vector1.x) * vector2.z;
+    const double crossZ = static_cast<double>(vector1.x) * vector2.y - static_cast<double>(vector1.y) * vector2.x;
+    const double dot = static_cast<double>(vector1.x) * vector2.x + static_cast<double>(vector1.y) * vector2.y + static_cast<double>(vector1.z) * vector2.z;
+    return atan2(sqrt(crossX * crossX + crossY * crossY + crossZ * crossZ), dot) * (180.0 / static_cast<double>(Pegasus::Math::P_PI));
+}
+
+bool UNIT_TEST_Quantize1()
+{
+    //the compact vertex is 16 bytes, the positions are within half a step of the 16 bits grid of the bounds,
+    //the texture coordinates within the precision of a half float
+    const unsigned int numVertices = QUANTIZE_VERTEX_COUNT;
+    StdVertex * vertices = static_cast<StdVertex *>(malloc(numVertices * sizeof(StdVertex)));
+    StdCompactVertex * compactVertices = static_cast<StdCompactVertex *>(malloc(numVertices * sizeof(StdCompactVertex)));
+    unsigned int seed = 2468;
+    for (unsigned int v = 0; v < numVertices; ++v)
+    {
+        vertices[v].position = Pegasus::Math::Vec4(100.0f * NextRandomFloat(seed) + 20.0f, 5.0f * NextRandomFloat(seed), 0.01f * NextRandomFloat(seed), 1.0f);
+        vertices[v].normal = Pegasus::Math::Vec3(0.0f, 0.0f, 1.0f);
+        vertices[v].uv = Pegasus::Math::Vec2(2.0f * NextRandomFloat(seed), 0.5f * NextRandomFloat(seed) + 0.5f);
+    }
+
+    Pegasus::Math::Vec3 offset, scale;
+    ComputePositionDecode(vertices, numVertices, offset, scale);
+    QuantizeVertices(vertices, numVertices, offset, scale, compactVertices);
+
+    float maxPositionError[3] = { 0.0f, 0.0f, 0.0f };
+    float maxRelativeUVError = 0.0f;
+    for (unsigned int v = 0; v < numVertices; ++v)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            const float decoded = offset.v[c] + scale.v[c] * (static_cast<float>(compactVertices[v].position[c]) / 65535.0f);
+            maxPositionError[c] = Pegasus::Math::Max(maxPositionError[c], Pegasus::Math::Abs(decoded - vertices[v].position.v[c]) / scale.v[c]);
+        }
+        for (int c = 0; c < 2; ++c)
+        {
+            const float uv = vertices[v].uv.v[c];
+            const float error = Pegasus::Math::Abs(Pegasus::Math::HalfToFloat(compactVertices[v].uv[c]) - uv);
+            maxRelativeUVError = Pegasus::Math::Max(maxRelativeUVError, error / Pegasus::Math::Max(Pegasus::Math::Abs(uv), 1.0f / 16384.0f));
+        }
+    }
+
+    const float savings = 100.0f * (1.0f - static_cast<float>(sizeof(StdCompactVertex)) / static_cast<float>(sizeof(StdVertex)));
+    printf("%u bytes per compact vertex instead of %u (%.1f%% less), position errors %.2e %.2e %.2e of the bounds, UV relative error %.2e\n",
+           static_cast<unsigned int>(sizeof(StdCompactVertex)), static_cast<unsigned int>(sizeof(StdVertex)), savings,
+           maxPositionError[0], maxPositionError[1], maxPositionError[2], maxRelativeUVError);
+
+    const float maxAllowedPositionError = 0.5f / 65535.0f + 1.0e-6f;
+    const bool match = (sizeof(StdCompactVertex) == 16) && (sizeof(StdVertex) == 36)
+                    && (maxPositionError[0] <= maxAllowedPositionError)
+                    && (maxPositionError[1] <= maxAllowedPositionError)
+                    && (maxPositionError[2] <= maxAllowedPositionError)
+                    && (maxRelativeUVError <= 1.0f / 2048.0f)
+                    && (compactVertices[0].position[3] == 65535);
+    free(vertices);
+    free(compactVertices);
+    return match;
+}
+
+bool UNIT_TEST_Quantize2()
+{
+    //the octahedral normals decode within 0.005 degree, including the axes and the folded lower half
+    Pegasus::Math::Vec3 * normals = static_cast<Pegasus::Math::Vec3 *>(malloc(QUANTIZE_VERTEX_COUNT * sizeof(Pegasus::Math::Vec3)));
+    const Pegasus::Math::Vec3 axes[6] = { Pegasus::Math::Vec3( 1.0f, 0.0f, 0.0f), Pegasus::Math::Vec3(-1.0f, 0.0f, 0.0f),
+                                          Pegasus::Math::Vec3( 0.0f, 1.0f, 0.0f), Pegasus::Math::Vec3( 0.0f,-1.0f, 0.0f),
+                                          Pegasus::Math::Vec3( 0.0f, 0.0f, 1.0f), Pegasus::Math::Vec3( 0.0f, 0.0f,-1.0f) };
+    unsigned int seed = 1357;
+    for (unsigned int n = 0; n < QUANTIZE_VERTEX_COUNT; ++n)
+    {
+        if (n < 6)
+        {
+            normals[n] = axes[n];
+        }
+        else
+        {
+            do
+            {
+                normals[n] = Pegasus::Math::Vec3(NextRandomFloat(seed), NextRandomFloat(seed), NextRandomFloat(seed));
+            }
+            while ((Pegasus::Math::Dot(normals[n], normals[n]) > 1.0f) || (Pegasus::Math::Dot(normals[n], normals[n]) < 1.0e-4f));
+            Pegasus::Math::Normalize(normals[n]);
+        }
+    }
+
+    double maxAngle = 0.0;
+    unsigned int numLowerHalf = 0;
+    for (unsigned int n = 0; n < QUANTIZE_VERTEX_COUNT; ++n)
+    {
+        short encoded[2];
+        EncodeOctahedralNormal(normals[n], encoded);
+        const Pegasus::Math::Vec3 decoded = DecodeOctahedralNormal(encoded);
+        const double angle = GetAngleDegrees(normals[n], decoded);
+        maxAngle = (angle > maxAngle) ? angle : maxAngle;
+        numLowerHalf += (normals[n].z < 0.0f) ? 1 : 0;
+    }
+
+    free(normals);
+
+    printf("%u normals (%u in the lower half), largest octahedral error %.4f degree\n", QUANTIZE_VERTEX_COUNT, numLowerHalf, maxAngle);
+    return (maxAngle < 0.005) && (numLowerHalf > 0);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Number of rings and of segments of the noisy sphere of the BVH tests (28800 triangles)
+static const unsigned int SPHERE_SUBDIVISIONS = 120;
+
+//! Number of rays compared with the brute force intersection
+static const unsigned int BVH_CHECKED_RAY_COUNT = 3000;
+
+//! Number of rays aimed inside the closed sphere. The ray throughput is measured by the GraphBenchmark block of TestApp1
+static const unsigned int BVH_INSIDE_RAY_COUNT = 5000;
+
+//! Sphere with a noisy radius, as a ray casting input
+struct NoisySphere
+{
+    unsigned int mNumVertices;              //!< Number of vertices
+    unsigned int mNumTriangles;             //!< Number of triangles
+    Pegasus::Math::Vec3 * mPositions;       //!< Positions of the vertices
+    unsigned short * mIndices;              //!< Indices of the triangles
+};
+
+//! Build a closed sphere of unit radius, the radius of each grid position varying by up to 5%
+static void BuildNoisySphere(NoisySphere & sphere)
+{
+    const unsigned int gridSize = SPHERE_SUBDIVISIONS + 1;
+    sphere.mNumVertices = gridSize * gridSize;
+    sphere.mNumTriangles = SPHERE_SUBDIVISIONS * SPHERE_SUBDIVISIONS * 2;
+    sphere.mPositions = static_cast<Pegasus::Math::Vec3 *>(malloc(sphere.mNumVertices * sizeof(Pegasus::Math::Vec3)));
+    sphere.mIndices = static_cast<unsigned short *>(malloc(sphere.mNumTriangles * 3 * sizeof(unsigned short)));
+
+    //the last segment and the poles reuse the radius of the positions they duplicate, so the sphere stays closed
+    float * radii = static_cast<float *>(malloc(gridSize * SPHERE_SUBDIVISIONS * sizeof(float)));
+    unsigned int seed = 97531;
+    for (unsigned int r = 0; r < gridSize * SPHERE_SUBDIVISIONS; ++r)
+    {
+        radii[r] = 1.0f + 0.05f * NextRandomFloat(seed);
+    }
+    for (unsigned int ring = 0; ring < gridSize; ++ring)
+    {
+        const float theta = static_cast<float>(ring) * (Pegasus::Math::P_PI / static_cast<float>(SPHERE_SUBDIVISIONS));
+        for (unsigned int segment = 0; segment < gridSize; ++segment)
+        {
+            const float phi = static_cast<float>(segment) * (2.0f * Pegasus::Math::P_PI / static_cast<float>(SPHERE_SUBDIVISIONS));
+            const bool isPole = (ring == 0) || (ring == SPHERE_SUBDIVISIONS);
+            const float radius = radii[ring * SPHERE_SUBDIVISIONS + (isPole ? 0 : (segment % SPHERE_SUBDIVISIONS))];
+            const float sinTheta = isPole ? 0.0f : Pegasus::Math::Sin(theta);
+            const float cosTheta = (ring == 0) ? 1.0f : ((ring == SPHERE_SUBDIVISIONS) ? -1.0f : Pegasus::Math::Cos(theta));
+            const float cosPhi = (segment % SPHERE_SUBDIVISIONS == 0) ? 1.0f : Pegasus::Math::Cos(phi);
+            const float sinPhi = (segment % SPHERE_SUBDIVISIONS == 0) ? 0.0f : Pegasus::Math::Sin(phi);
+            sphere.mPositions[ring * gridSize + segment] = Pegasus::Math::Vec3(radius * sinTheta * cosPhi, radius * sinTheta * sinPhi, radius * cosTheta);
+        }
+    }
+    free(radii);
+
+    unsigned int numIndices = 0;
+    for (unsigned int ring = 0; ring < SPHERE_SUBDIVISIONS; ++ring)
+    {
+        for (unsigned int segment = 0; segment < SPHERE_SUBDIVISIONS; ++segment)
+        {
+            const unsigned short v = static_cast<unsigned short>(ring * gridSize + segment);
+            sphere.mIndices[numIndices++] = v;
+            sphere.mIndices[numIndices++] = static_cast<unsigned short>(v + gridSize);
+            sphere.mIndices[numIndices++] = static_cast<unsigned short>(v + 1);
+            sphere.mIndices[numIndices++] = static_cast<unsigned short>(v + 1);
+            sphere.mIndices[numIndices++] = static_cast<unsigned short>(v + gridSize);
+            sphere.mIndices[numIndices++] = static_cast<unsigned short>(v + gridSize + 1);
+        }
+    }
+}
+
+//! Release the buffers of a noisy sphere
+static void DestroyNoisySphere(NoisySphere & sphere)
+{
+    free(sphere.mPositions);
+    free(sphere.mIndices);
+}
+
+//! Build a random ray starting outside of the noisy sphere, aimed at a random point of a ball
+//! \param targetRadius Radius of the ball around the center of the sphere containing the aimed point
+static Pegasus::Math::Ray GetRandomSphereRay(unsigned int & seed, float targetRadius)
+{
+    Pegasus::Math::Vec3 origin, target;
+    do
+    {
+        origin = Pegasus::Math::Vec3(NextRandomFloat(seed), NextRandomFloat(seed), NextRandomFloat(seed));
+    }
+    while ((Pegasus::Math::Dot(origin, origin) > 1.0f) || (Pegasus::Math::Dot(origin, origin) < 1.0e-4f));
+    Pegasus::Math::Normalize(origin);
+    origin *= 3.0f;
+    target = Pegasus::Math::Vec3(NextRandomFloat(seed), NextRandomFloat(seed), NextRandomFloat(seed));
+    target *= targetRadius;
+
+    Pegasus::Math::Ray ray;
+    ray.SetFromPoints(origin, target);
+    return ray;
+}
+
+bool UNIT_TEST_Bvh1()
+{
+    //the closest hit of the hierarchy matches the closest hit of every triangle tested one by one
+    NoisySphere sphere;
+    BuildNoisySphere(sphere);
+    MeshBvh bvh(&sGlobalAllocator);
+    bvh.Build(sphere.mPositions, sphere.mNumVertices, sphere.mIndices, sphere.mNumTriangles);
+
+    unsigned int seed = 8642;
+    unsigned int numHits = 0;
+    unsigned int numMismatches = 0;
+    for (unsigned int r = 0; r < BVH_CHECKED_RAY_COUNT; ++r)
+    {
+        //the aimed points go past the sphere, so some rays miss it
+        const Pegasus::Math::Ray ray = GetRandomSphereRay(seed, 1.5f);
+        MeshRayHit hit;
+        const bool bvhHit = bvh.Raycast(ray, 1.0e30f, hit);
+
+        bool bruteForceHit = false;
+        float bruteForceDistance = 1.0e30f;
+        for (unsigned int t = 0; t < sphere.mNumTriangles; ++t)
+        {
+            float distance, u, v;
+            if (Pegasus::Math::GetIntersectionDistance(ray, sphere.mPositions[sphere.mIndices[t * 3]], sphere.mPositions[sphere.mIndices[t * 3 + 1]],
+                                                       sphere.mPositions[sphere.mIndices[t * 3 + 2]], distance, u, v)
+                && (distance < bruteForceDistance))
+            {
+                bruteForceHit = true;
+                bruteForceDistance = distance;
+            }
+        }
+
+        numHits += bvhHit ? 1 : 0;
+        if ((bvhHit != bruteForceHit) || (bvhHit && (Pegasus::Math::Abs(hit.mDistance - bruteForceDistance) > 1.0e-4f)))
+        {
+            ++numMismatches;
+        }
+    }
+
+    printf("%u triangles, BVH of %u nodes, %u rays (%u hits) with %u mismatches against brute force\n",
+           sphere.mNumTriangles, bvh.GetNodeCount(), BVH_CHECKED_RAY_COUNT, numHits, numMismatches);
+    const bool match = (bvh.GetTriangleCount() == sphere.mNumTriangles) && (bvh.GetNodeCount() > 0)
+                    && (numMismatches == 0) && (numHits > 0) && (numHits < BVH_CHECKED_RAY_COUNT);
+    DestroyNoisySphere(sphere);
+    return match;
+}
+
+bool UNIT_TEST_Bvh2()
+{
+    //every ray aimed inside the closed sphere hits it, at a distance within the noise of the radius
+    NoisySphere sphere;
+    BuildNoisySphere(sphere);
+    MeshBvh bvh(&sGlobalAllocator);
+    bvh.Build(sphere.mPositions, sphere.mNumVertices, sphere.mIndices, sphere.mNumTriangles);
+
+    unsigned int seed = 7531;
+    unsigned int numHits = 0;
+    unsigned int numOutOfRange = 0;
+    for (unsigned int r = 0; r < BVH_INSIDE_RAY_COUNT; ++r)
+    {
+        const Pegasus::Math::Ray ray = GetRandomSphereRay(seed, 0.5f);
+        MeshRayHit hit;
+        if (bvh.Raycast(ray, 1.0e30f, hit))
+        {
+            ++numHits;
+            //the origins are 3 units away from the center, the first hit is on the near side of the sphere
+            numOutOfRange += ((hit.mDistance < 3.0f - 1.05f) || (hit.mDistance > 3.0f)) ? 1 : 0;
+        }
+    }
+
+    printf("%u rays aimed inside the sphere, %u hits, %u hits out of range\n", BVH_INSIDE_RAY_COUNT, numHits, numOutOfRange);
+    DestroyNoisySphere(sphere);
+    return (numHits == BVH_INSIDE_RAY_COUNT) && (numOutOfRange == 0);
+}
@@ -0,0 +1,136 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TextureTests.cpp
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Pegasus Unit tests for the pixel formats of the Texture package, implementation
+
+#include "Pegasus/UnitTests/TextureTests.h"
+#include "Pegasus/Texture/PixelFormat.h"
+#include "Pegasus/Math/Half.h"
+
+using namespace Pegasus::Math;
+using namespace Pegasus::Texture;
+
+//! True if a half float is a NaN (all exponent bits and a non-zero mantissa)
+static bool IsHalfNaN(PFloat16 value)
+{
+    return ((value & 0x7C00) == 0x7C00) && ((value & 0x03FF) != 0);
+}
+
+//! True if the channels of a color match exactly
+static bool SameColor(const ColorRGBA & color, float red, float green, float blue, float alpha)
+{
+    return (color.v[0] == red) && (color.v[1] == green) && (color.v[2] == blue) && (color.v[3] == alpha);
+}
+
+bool UNIT_TEST_HalfFloat1()
+{
+    //every half value, denormals and infinities included, survives a round trip through a float
+    bool match = true;
+    for (unsigned int h = 0; h <= 0xFFFF; ++h)
+    {
+        const PFloat16 half = static_cast<PFloat16>(h);
+        const PFloat16 roundTrip = FloatToHalf(HalfToFloat(half));
+        match = match && (IsHalfNaN(half) ? IsHalfNaN(roundTrip) : (roundTrip == half));
+    }
+    return match;
+}
+
+bool UNIT_TEST_HalfFloat2()
+{
+    //rounding to the nearest half, overflow to infinity and underflow to zero
+    return FloatToHalf(1.0f) == 0x3C00
+        && FloatToHalf(-2.5f) == 0xC100
+        && FloatToHalf(65504.0f) == 0x7BFF
+        && FloatToHalf(65536.0f) == 0x7C00
+        && FloatToHalf(1.0f / 16777216.0f) == 0x0001
+        && FloatToHalf(1.0e-9f) == 0x0000
+        && FloatToHalf(-1.0e-9f) == 0x8000
+        && FloatToHalf(1.0f + 1.0f / 4096.0f) == 0x3C00
+        && FloatToHalf(1.0f + 3.0f / 4096.0f) == 0x3C01
+        && FloatToHalf(2047.9f) == 0x6800
+        && HalfToFloat(0x3555) == 0.333251953125f;
+}
+
+bool UNIT_TEST_PixelFormat1()
+{
+    //the kernels are resolved for every supported format, and only those
+    const Pegasus::Core::Format formats[] = {
+        Pegasus::Core::FORMAT_RGBA_8_UNORM, Pegasus::Core::FORMAT_RGBA_8_UNORM_SRGB, Pegasus::Core::FORMAT_RGBA_16_UNORM,
+        Pegasus::Core::FORMAT_RGBA_16_FLOAT, Pegasus::Core::FORMAT_RGBA_32_FLOAT, Pegasus::Core::FORMAT_RGB_32_FLOAT,
+        Pegasus::Core::FORMAT_RG_32_FLOAT, Pegasus::Core::FORMAT_RG16_FLOAT, Pegasus::Core::FORMAT_R32_FLOAT,
+        Pegasus::Core::FORMAT_R16_FLOAT, Pegasus::Core::FORMAT_R16_UNORM, Pegasus::Core::FORMAT_R8_UNORM
+    };
+    const unsigned int expectedSizes[] = { 4, 4, 8, 8, 16, 12, 8, 4, 4, 2, 2, 1 };
+
+    bool match = true;
+    for (unsigned int f = 0; f < sizeof(formats) / sizeof(formats[0]); ++f)
+    {
+        unsigned int numBytesPerPixel = 0;
+        match = match && RunPixelKernel<PixelSizeKernel>(formats[f], numBytesPerPixel);
+        match = match && (numBytesPerPixel == expectedSizes[f]);
+    }
+    return match && !IsPixelKernelFormat(Pegasus::Core::FORMAT_BC1_UNORM);
+}
+
+bool UNIT_TEST_PixelFormat2()
+{
+    //the float formats keep HDR and negative values, the missing channels read as (0, 0, 1)
+    const ColorRGBA hdrColor(4.5f, -1.0f, 0.25f, 2.0f);
+    ColorRGBA color;
+
+    PixelRGBA32Float::ChannelType rgba32[4];
+    PixelRGBA32Float::FromColor(hdrColor, rgba32);
+    PixelRGBA32Float::ToColor(rgba32, color);
+    bool match = SameColor(color, 4.5f, -1.0f, 0.25f, 2.0f);
+
+    PixelRGBA16Float::ChannelType rgba16[4];
+    PixelRGBA16Float::FromColor(hdrColor, rgba16);
+    PixelRGBA16Float::ToColor(rgba16, color);
+    match = match && SameColor(color, 4.5f, -1.0f, 0.25f, 2.0f);
+
+    PixelR32Float::ChannelType r32[1];
+    PixelR32Float::FromColor(hdrColor, r32);
+    PixelR32Float::ToColor(r32, color);
+    match = match && SameColor(color, 4.5f, 0.0f, 0.0f, 1.0f);
+
+    PixelRG16Float::ChannelType rg16[2];
+    PixelRG16Float::FromColor(hdrColor, rg16);
+    PixelRG16Float::ToColor(rg16, color);
+    match = match && SameColor(color, 4.5f, -1.0f, 0.0f, 1.0f);
+
+    //the unorm formats clamp to [0, 1]
+    PixelRGBA16Unorm::ChannelType rgba16Unorm[4];
+    PixelRGBA16Unorm::FromColor(hdrColor, rgba16Unorm);
+    match = match && (rgba16Unorm[0] == 0xFFFF) && (rgba16Unorm[1] == 0) && (rgba16Unorm[2] == 0x3FFF) && (rgba16Unorm[3] == 0xFFFF);
+    return match;
+}
+
+bool UNIT_TEST_PixelFormat3()
+{
+    //8 bits colors convert exactly to the 8 and 16 bits unorm formats
+    bool match = true;
+    for (unsigned int value = 0; value < 256; ++value)
+    {
+        Color8RGBA color8;
+        color8.rgba[0] = color8.rgba[1] = color8.rgba[2] = color8.rgba[3] = static_cast<PUInt8>(value);
+        PixelRGBA8Unorm::ChannelType rgba8[4];
+        PixelRGBA8Unorm::FromColor8(color8, rgba8);
+        PixelR16Unorm::ChannelType r16[1];
+        PixelR16Unorm::FromColor8(color8, r16);
+        match = match && (rgba8[0] == value) && (rgba8[3] == value) && (r16[0] == value * 257);
+    }
+
+    //the additions saturate or wrap the unorm channels, the float channels are clamped only when requested
+    typedef PixelRGBA8Unorm::ChannelTraits Unorm8;
+    typedef PixelRGBA16Float::ChannelTraits Half;
+    match = match && (Unorm8::Add(200, 100, true) == 255) && (Unorm8::Add(200, 100, false) == 44);
+    match = match && (Half::ToFloat(Half::Add(Half::FromFloat(0.75f), Half::FromFloat(0.75f), true)) == 1.0f);
+    match = match && (Half::ToFloat(Half::Add(Half::FromFloat(0.75f), Half::FromFloat(0.75f), false)) == 1.5f);
+    return match;
+}
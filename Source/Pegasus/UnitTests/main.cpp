@@ -11,6 +11,8 @@
 //!         any data structure. To run, edit Utils project to generate an executable, and run
 
 #include "Pegasus/UnitTests/UtilsTests.h"
+#include "Pegasus/UnitTests/TextureTests.h"
+#include "Pegasus/UnitTests/MeshTests.h"
 #include <stdio.h>
 
 typedef bool (*TestFunc)(void);
@@ -114,6 +116,35 @@ int main()
     RUN_TEST(ByteStream2);
     RUN_TEST(ByteStream3);    
 
+    //Half float conversions
+    RUN_TEST(HalfFloat1);
+    RUN_TEST(HalfFloat2);
+
+    //Texture pixel formats
+    RUN_TEST(PixelFormat1);
+    RUN_TEST(PixelFormat2);
+    RUN_TEST(PixelFormat3);
+
+    //Mesh vertex cache optimization
+    RUN_TEST(VertexCache1);
+    RUN_TEST(VertexCache2);
+
+    //Mesh simplification
+    RUN_TEST(Simplify1);
+    RUN_TEST(Simplify2);
+    RUN_TEST(Simplify3);
+
+    //Mesh welding
+    RUN_TEST(Weld1);
+
+    //Mesh quantization
+    RUN_TEST(Quantize1);
+    RUN_TEST(Quantize2);
+
+    //Mesh ray casting
+    RUN_TEST(Bvh1);
+    RUN_TEST(Bvh2);
+
     ///////////////////////////////////////////////////////////
 
     printf("Final Results: %d out of %d succeeded\n", successes, total);
@@ -0,0 +1,127 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   GraphBenchmarkBlock.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Timeline block measuring the cost of querying wide and deep texture and mesh graphs
+
+#ifndef TESTAPP1_GRAPHBENCHMARK_BLOCK_H
+#define TESTAPP1_GRAPHBENCHMARK_BLOCK_H
+
+#include "Pegasus/Core/IApplicationContext.h"
+#include "Pegasus/Texture/Texture.h"
+#include "Pegasus/Texture/TextureGenerator.h"
+#include "Pegasus/Mesh/Mesh.h"
+#include "Pegasus/Mesh/MeshGenerator.h"
+#include "Pegasus/Timeline/Block.h"
+
+namespace Pegasus {
+    namespace Timeline {
+        struct UpdateInfo;
+    }
+}
+
+
+//! Timeline block measuring the cost of querying wide and deep texture and mesh graphs.
+//! Each graph has GRAPH_WIDTH generators followed by GRAPH_DEPTH layers of operators,
+//! every operator reading several nodes of the previous layer so the subgraphs are shared.
+//! The results are sent to the log when the block is initialized, and the outputs
+//! are queried every frame like a renderer would.
+//! The graphs are then rebuilt with the sharing of identical node data enabled,
+//! to report the memory saved by the data interners of the managers.
+//! Then a long operator chain is generated with and without transient node data,
+//! to report the peak memory of the intermediate data in both cases.
+//! A large texture is generated with the different mip filters, to report the cost of the mip chains.
+//! A terrain of about one million triangles is simplified, to report the simplification throughput.
+//! Finally rays are cast on the bounding volume hierarchy of a terrain, to report the ray casting throughput
+class GraphBenchmarkBlock : public Pegasus::Timeline::Block
+{
+    DECLARE_TIMELINE_BLOCK(GraphBenchmarkBlock, "GraphBenchmark");
+
+public:
+
+    //! Constructor
+    //! \param allocator Allocator used for all timeline allocations
+    //! \param appContext Application context, providing access to the global managers
+    GraphBenchmarkBlock(Pegasus::Alloc::IAllocator * allocator, Pegasus::Core::IApplicationContext* appContext);
+
+    //! Destructor
+    virtual ~GraphBenchmarkBlock();
+
+
+    //! Initialize the data of the block
+    virtual void Initialize();
+
+    //! Deallocate the data used by the block
+    virtual void Shutdown();
+
+    virtual void Update(const Pegasus::Timeline::UpdateInfo& updateInfo) override;
+
+    //------------------------------------------------------------------------------------
+
+private:
+
+    // Blocks cannot be copied
+    PG_DISABLE_COPY(GraphBenchmarkBlock)
+
+    //! Number of generators, and number of operators per layer
+    enum { GRAPH_WIDTH = 64 };
+
+    //! Number of layers of operators
+    enum { GRAPH_DEPTH = 16 };
+
+    //! Number of frames measured per scenario
+    enum { NUM_BENCHMARK_FRAMES = 256 };
+
+    //! Create the texture graph
+    void CreateTextureGraph();
+
+    //! Create the mesh graph
+    void CreateMeshGraph();
+
+    //! Update and get the data of every output node, as done once per frame by the users of the graphs
+    //! \return True if any node data has been regenerated
+    bool QueryOutputs();
+
+    //! Measure the query of the outputs when nothing changes, then when one generator changes per frame
+    void RunBenchmark();
+
+    //! Rebuild the graphs with the sharing of identical node data enabled,
+    //! measure the first generation and log the memory saved
+    void RunInterningBenchmark();
+
+    //! Generate a chain of texture operators with kept then transient node data,
+    //! and log the peak memory of the node data and the generation time of both
+    void RunTransientBenchmark();
+
+    //! Generate a large texture without mip levels, then with the complete mip chain for each filter,
+    //! and log the generation cost per MB of full resolution data
+    void RunMipBenchmark();
+
+    //! Compress a procedural image to each block compressed format with each quality preset,
+    //! and log the PSNR and the encoding throughput
+    void RunCompressionBenchmark();
+
+    //! Simplify a large noisy height field to several ratios of its triangles,
+    //! and log the error and the number of input triangles processed per second
+    void RunSimplificationBenchmark();
+
+    //! Build the bounding volume hierarchy of a noisy height field, cast rays crossing it,
+    //! and log the build time and the number of rays per second
+    void RunRaycastBenchmark();
+
+    //! Release the nodes of the graphs
+    void ReleaseGraphs();
+
+    Pegasus::Texture::TextureGeneratorRef mTextureGenerators[GRAPH_WIDTH];
+    Pegasus::Texture::TextureRef mTextures[GRAPH_WIDTH];
+    Pegasus::Mesh::MeshGeneratorRef mMeshGenerators[GRAPH_WIDTH];
+    Pegasus::Mesh::MeshRef mMeshes[GRAPH_WIDTH];
+};
+
+
+#endif  // TESTAPP1_GRAPHBENCHMARK_BLOCK_H
@@ -60,6 +60,7 @@ struct ApplicationConfig
 public:
     Os::ModuleHandle mModuleHandle; //!< Handle to the module containing this application
     const char* mBasePath; //!< The base path to load all assets from
+    const char* mCachePath; //!< The directory receiving the files generated from the assets (compiled scripts), nullptr to generate none
 
     // Debug API
 
@@ -71,7 +72,7 @@ public:
 
     //! Default constructor
     inline ApplicationConfig()
-        : mModuleHandle(0), mBasePath(nullptr)
+        : mModuleHandle(0), mBasePath(nullptr), mCachePath(nullptr)
 #if PEGASUS_ENABLE_LOG
           ,mLoghandler(nullptr)
 #endif
@@ -29,6 +29,7 @@ BS_PROCESS(StmtIfElse)
 BS_PROCESS(StmtWhile)
 BS_PROCESS(StmtFor)
 BS_PROCESS(StmtReturn)
+BS_PROCESS(StmtYield)
 BS_PROCESS(StmtStructDef)
 BS_PROCESS(StmtEnumTypeDef)
 BS_PROCESS(Annotations)
@@ -66,6 +66,72 @@ public:
         int   outputBufferSize
     );
 
+    //! Executes a function from a specific bind point while an execution of ExecuteFunction is suspended by a yield statement.
+    //! The function runs to completion on top of the suspended one, which continues untouched with ResumeExecution.
+    //! vmState - the Suspended state of the VM.
+    //! See ExecuteFunction for the other arguments.
+    //! returns false if the state is not Suspended in a function, or if the sizes do not match.
+    bool ExecuteFunctionWhileSuspended(
+        BsVmState*   vmState,
+        FunBindPoint functionBindPoint,
+        const void* inputBuffer,
+        int   inputBufferSize,
+        void* outputBuffer,
+        int   outputBufferSize
+    );
+
+    //! Continues an execution of Run or ExecuteFunction suspended by a yield statement (see BsVmState::SetYieldDeadline).
+    //! vmState - the Suspended state of the VM.
+    //! outputBuffer - for a function, the output buffer receiving the return value once it completes, can be null to discard it.
+    //! outputBufferSize - the size of the return buffer, as passed to ExecuteFunction.
+    //! returns false if the state is not Suspended, true otherwise. The execution is complete if the state is not Suspended anymore.
+    bool ResumeExecution(
+        BsVmState* vmState,
+        void* outputBuffer = nullptr,
+        int   outputBufferSize = 0
+    );
+
+    //! Executes a function from a specific bind point on many vm states, in parallel on worker threads.
+    //! vmStates - the states of the VM to run, each one initialized by Run. A state can only appear once.
+    //! stateCount - the count of states.
+    //! bindPoint - the function bind point. If an invalid bind point is passed, we return 0.
+    //! inputBuffers - the input buffers of every state, packed one after the other (see ExecuteFunction for the content).
+    //! inputBufferSize - the size of the input argument buffer of one state.
+    //! outputBuffers - the output buffers of every state, packed one after the other.
+    //! outputBufferSize - the size of the return buffer of one state.
+    //! workerCount - the count of threads including the calling one, 0 to use all the hardware threads.
+    //! returns the count of states on which the function has been executed.
+    int ExecuteFunctionParallel(
+        BsVmState* const* vmStates,
+        int          stateCount,
+        FunBindPoint functionBindPoint,
+        const void* inputBuffers,
+        int   inputBufferSize,
+        void* outputBuffers,
+        int   outputBufferSize,
+        unsigned int workerCount = 0
+    );
+
+    //! Executes a function from a specific bind point on many instances of its arguments, with a single vm state.
+    //! The instances run together in lanes when the function allows it (see Pegasus::BlockScript::ExecuteFunctionBatch).
+    //! vmState - the state of the VM to run, initialized by Run.
+    //! bindPoint - the function bind point. If an invalid bind point is passed, we return false.
+    //! inputBuffers - the input buffers of every instance, packed one after the other (see ExecuteFunction for the content).
+    //! inputBufferSize - the size of the input argument buffer of one instance.
+    //! outputBuffers - the output buffers of every instance, packed one after the other. Can be the input buffers when the sizes are equal.
+    //! outputBufferSize - the size of the return buffer of one instance.
+    //! instanceCount - the count of instances.
+    //! returns true if the function has been executed for all the instances, false otherwise.
+    bool ExecuteFunctionBatch(
+        BsVmState*   vmState,
+        FunBindPoint functionBindPoint,
+        const void* inputBuffers,
+        int   inputBufferSize,
+        void* outputBuffers,
+        int   outputBufferSize,
+        int   instanceCount
+    );
+
     //! Read the global value stored in a handle.
     //! \param vmState - the virtual machine state containing all memory.
     //! \param bindPoint - the bind point of the global
@@ -350,13 +350,20 @@ class Stmt : public Node
 {
 public:
 
-    Stmt(){}
+    Stmt() : mLine(0) {}
 
     virtual ~Stmt(){}
 
+    //! \return the source line of this statement, as reported by the compiler errors
+    int GetLine() const { return mLine; }
+
+    //! \param line the source line of this statement
+    void SetLine(int line) { mLine = line; }
+
     VISITOR_ACCESS
 
 private:
+    int mLine;
 };
 
 class StmtEnumTypeDef : public Stmt
@@ -456,6 +463,18 @@ private:
 
 };
 
+//! yield statement, suspends the execution when the yield deadline of the vm state has passed
+class StmtYield : public Stmt
+{
+public:
+
+    StmtYield() {}
+
+    virtual ~StmtYield() {}
+
+    VISITOR_ACCESS
+};
+
 //! struct definition
 class StmtStructDef : public Stmt
 {
@@ -58,6 +58,7 @@ namespace BlockScript
 //! Block Script Builder, type checker and constructor of script abstract syntax tree
 class BlockScriptBuilder
 {
+    friend class BlockScriptCache;
 public:
     explicit BlockScriptBuilder() 
         : mCurrentFrame(nullptr)
@@ -109,6 +110,7 @@ public:
     Ast::StmtExp* BuildExternVariable(Ast::Exp* lhs, Ast::Exp* rhs);
     Ast::StmtExp* BuildDeclarationWithAnnotation(Ast::Annotations* ann, Ast::Exp* exp);
     Ast::StmtReturn* BuildStmtReturn(Ast::Exp* exp);
+    Ast::StmtYield*  BuildStmtYield();
     Ast::StmtWhile*  BuildStmtWhile(Ast::Exp* exp, Ast::StmtList* stmtList);
     Ast::StmtFor*    BuildStmtFor(Ast::Exp* init, Ast::Exp* cond, Ast::Exp* update, Ast::StmtList* stmtList);
     Ast::StmtFunDec* BuildStmtFunDec(Ast::ArgList* argList, const TypeDesc* returnType, const char * nameIdd);
@@ -199,6 +201,9 @@ public:
 
     Pegasus::Alloc::IAllocator* GetAllocator() const { return mGeneralAllocator; }
 
+    //! \return the callback of the constructors created for each struct definition
+    static FunCallback GetStructConstructorCallback();
+
 private:
 
     // registers a member into the stack. Returns the offset of the current stack frame.
@@ -0,0 +1,125 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BlockScriptCache.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Serialization of compiled scripts (abstract syntax tree, symbol table, assembly
+//!         and globals) into a binary cache, loaded instead of compiling when still valid.
+
+#ifndef PEGASUS_BLOCKSCRIPT_CACHE_H
+#define PEGASUS_BLOCKSCRIPT_CACHE_H
+
+#include "Pegasus/BlockScript/BlockScriptBuilder.h"
+#include "Pegasus/BlockScript/Container.h"
+#include "Pegasus/BlockScript/Preprocessor.h"
+
+//forward declarations begin
+namespace Pegasus {
+    namespace Io
+    {
+        class FileBuffer;
+    }
+
+    namespace Utils
+    {
+        class ByteStream;
+    }
+
+    namespace BlockScript
+    {
+        class IFileIncluder;
+    }
+}
+//forward declarations end
+
+namespace Pegasus
+{
+namespace BlockScript
+{
+
+//! Binary cache of a compiled script.
+//! The cache is keyed by the hash of the source, of the definitions and of the signature of the
+//! libraries (types and functions of the symbol tables registered as children of the builder).
+//! Each include opened by the compilation is stored with the hash of its content, and opened again
+//! through the file includer to validate the cache. The content is only valid for the build that
+//! wrote it: it stores indices in the library tables and native data layouts, checked by the version.
+class BlockScriptCache
+{
+public:
+    //! Format version of the cached content, increment when the layout of the records changes
+    static const int VERSION = 2;
+
+    //! Everything a compilation depends on, except its includes
+    struct Key
+    {
+        unsigned long long mSourceHash;      //!< Hash of the script source
+        unsigned long long mDefinitionsHash; //!< Hash of the names and values of the definitions
+        unsigned long long mLibSignature;    //!< Hash of the types and functions of the libraries
+
+        Key() : mSourceHash(0), mDefinitionsHash(0), mLibSignature(0) {}
+    };
+
+    //! Include opened during a compilation
+    struct Include
+    {
+        const char*        mPath; //!< Path given to the file includer
+        unsigned long long mHash; //!< Hash of the content returned by the file includer
+
+        Include() : mPath(nullptr), mHash(0) {}
+    };
+
+    //! Hashes a buffer (64 bits FNV-1a)
+    //! \param buffer the buffer to hash
+    //! \param bufferSize the size of the buffer in bytes
+    //! \param hash the hash to continue from, to hash several buffers
+    //! \return the hash of the buffer
+    static unsigned long long HashBuffer(const void* buffer, int bufferSize, unsigned long long hash = HASH_SEED);
+
+    //! Computes the key of a compilation
+    //! \param builder the builder, with the libraries registered in its symbol table
+    //! \param fb the file buffer containing the script
+    //! \param definitions the definitions passed to the preprocessor
+    //! \param outKey output parameter, the key of the compilation
+    static void ComputeKey(const BlockScriptBuilder* builder, const Io::FileBuffer* fb, const Container<Preprocessor::Definition>& definitions, Key& outKey);
+
+    //! Serializes the result of a successful compilation
+    //! \param builder the builder, after EndBuild
+    //! \param result the result of the compilation
+    //! \param key the key of the compilation
+    //! \param includes the includes opened by the compilation
+    //! \param outStream output parameter, the stream receiving the cached content
+    //! \return true if successful, false if the script uses something that cannot be cached
+    static bool Save(BlockScriptBuilder* builder, const BlockScriptBuilder::CompilationResult& result, const Key& key, const Container<Include>& includes, Utils::ByteStream& outStream);
+
+    //! Checks that cached content has been written by this version, for this key, is not corrupted,
+    //! and that the content of its includes did not change
+    //! \param buffer the cached content
+    //! \param bufferSize the size of the cached content
+    //! \param key the key of the compilation
+    //! \param includer the file includer used to open the includes, can be null if there are none
+    //! \return true if the content can be loaded, false otherwise
+    static bool IsValid(const char* buffer, int bufferSize, const Key& key, IFileIncluder* includer);
+
+    //! Rebuilds the result of a compilation from valid cached content (see IsValid), instead of compiling.
+    //! The builder must be freshly reset with its libraries registered, and must be reset again on failure.
+    //! \param builder the builder receiving the symbol table, abstract syntax tree and assembly
+    //! \param buffer the cached content
+    //! \param bufferSize the size of the cached content
+    //! \param outResult output parameter, the result of the compilation
+    //! \return true if successful, false if the content does not match the libraries
+    static bool Load(BlockScriptBuilder* builder, const char* buffer, int bufferSize, BlockScriptBuilder::CompilationResult& outResult);
+
+private:
+
+    //! Initial value of the hashes (FNV-1a offset basis)
+    static const unsigned long long HASH_SEED = 14695981039346656037ULL;
+};
+
+}
+}
+
+#endif
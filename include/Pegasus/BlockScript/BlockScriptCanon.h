@@ -71,6 +71,7 @@ enum CanonTypes
     T_READ_OBJ_PROP,
     T_WRITE_OBJ_PROP,
     T_EXIT,
+    T_YIELD,
     T_CHECK_MEM_ACESS,
 };
 
@@ -345,6 +346,15 @@ public:
     virtual CanonTypes GetType() const { return T_EXIT; }
 };
 
+class Yield : public CanonNode
+{
+public:
+    Yield(){}
+    virtual ~Yield(){}
+    
+    virtual CanonTypes GetType() const { return T_YIELD; }
+};
+
 class PushFrame : public CanonNode
 {
 public:
@@ -426,7 +436,7 @@ public:
     //! initializes this block
     //! \param the allocator
     //! \param the label
-    void Initialize(Alloc::IAllocator* alloc, int label) { mStmts.Initialize(alloc); mLabel = label; }
+    void Initialize(Alloc::IAllocator* alloc, int label) { mStmts.Initialize(alloc); mLines.Initialize(alloc); mLabel = label; }
 
     //! \return the label of this block
     int GetLabel() const { return mLabel; }
@@ -436,6 +446,15 @@ public:
 
     const Container<CanonNode*>& GetStmts() const { return mStmts; }
 
+    //! adds a canonical node to this block
+    //! \param n the node to add
+    //! \param line the source line of the statement this node comes from
+    void PushStmt(CanonNode* n, int line) { mStmts.PushEmpty() = n; mLines.PushEmpty() = line; }
+
+    //! \param stmtIndex index of a node in the statement list
+    //! \return the source line of the statement the node comes from
+    int GetLine(int stmtIndex) const { return mLines[stmtIndex]; }
+
     //! gets the index of the next block
     int NextBlock() const { return mNextBlock; }
 
@@ -444,6 +463,7 @@ public:
 
 private:
     Container<CanonNode*> mStmts;
+    Container<int> mLines;
     int mLabel;
     int mNextBlock;
 };
@@ -13,6 +13,7 @@
 #define PEGASUS_BLOCKSCRIPT_COMPILER_H
 
 #include "Pegasus/BlockScript/BlockScriptBuilder.h"
+#include "Pegasus/BlockScript/BlockScriptCache.h"
 #include "Pegasus/BlockScript/IddStrPool.h"
 #include "Pegasus/BlockScript/BlockScriptCanon.h"
 #include "Pegasus/BlockScript/FunCallback.h"
@@ -40,6 +41,7 @@ namespace Pegasus {
 		class IddStrPool;
         class IBlockScriptCompilerListener;
         class IFileIncluder;
+        class IBytecodeCache;
     
         namespace Ast
         {
@@ -126,6 +128,21 @@ public:
     //! \return the includer to get.
     IFileIncluder* GetFileIncluder() const { return mFileIncluder; }
 
+    //! Sets a cache of the compiled script. Compile loads the script from it when its content is still valid
+    //! for the source, definitions, libraries and includes, and stores the result of a compilation otherwise.
+    //! \param cache - the cache to use, null to always compile
+    void SetBytecodeCache(IBytecodeCache* cache) { mBytecodeCache = cache; }
+
+    //! Gets the cache of the compiled script
+    //! \return the cache set, null if none
+    IBytecodeCache* GetBytecodeCache() const { return mBytecodeCache; }
+
+    //! \return true if the last Compile loaded the script from the cache instead of compiling it
+    bool IsLoadedFromCache() const { return mIsLoadedFromCache; }
+
+    //! \return the time spent in the last Compile, in milliseconds, including the cache accesses
+    double GetCompilationTime() const { return mCompilationTime; }
+
 protected:
     BlockScriptBuilder       mBuilder;
 
@@ -135,8 +152,22 @@ private:
     Ast::Program*            mAst;
     Assembly                 mAsm;
     IFileIncluder*           mFileIncluder;
+    IBytecodeCache*          mBytecodeCache;
+    bool                     mIsLoadedFromCache;
+    double                   mCompilationTime;
     Container<Preprocessor::Definition>   mDefinitionList;
     const char* mTitle;
+
+    //! Compiles the script, and writes the result to the cache if there is one
+    //! \param fb the file buffer containing the script
+    //! \param key the key of the compilation, to write to the cache
+    //! \return true if successful, false otherwise
+    bool CompileSource(const Io::FileBuffer* fb, const BlockScriptCache::Key& key);
+
+    //! Loads the script from the cache
+    //! \param key the key of the compilation, to validate the cached content
+    //! \return true if successful, false if the script has to be compiled
+    bool LoadFromCache(const BlockScriptCache::Key& key);
 };
 
 }
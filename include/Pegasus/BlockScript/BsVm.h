@@ -28,6 +28,8 @@ namespace BlockScript
 //! Forward declarations
 class BsVmState;
 class IRuntimeListener;
+class BsVmProfiler;
+struct Assembly;
 
 // memory and register state of the current virtual machine
 class BsVmState
@@ -40,7 +42,23 @@ public:
     {
         Crashed, //application has terminated due to an error. 
                  //To capture the error add a runtime listener and listen to the function OnCrash. Vm will not perform any operations any further along
-        Alive  //VM is alive, and can receive requests to ExecutionFunction, StepExecution or Run.
+        Alive, //VM is alive, and can receive requests to ExecutionFunction, StepExecution or Run.
+        Suspended //a yield statement has been reached after the yield deadline. The execution continues with ResumeExecution,
+                  //or is abandoned with Reset. Other requests fail until then, except ExecuteFunctionWhileSuspended.
+    };
+
+    //! Value of the yield deadline that never passes, yield statements do nothing
+    static const unsigned long long NO_YIELD_DEADLINE = ~0ULL;
+
+    //! Execution interrupted by a yield statement, to continue with ResumeExecution
+    struct SuspendedCall
+    {
+        bool mIsFunction; //!< true if suspended in ExecuteFunction, false if suspended in Run
+        int mSavedIp; //!< instruction pointer to restore once the function returns
+        const Assembly* mSavedAssembly; //!< assembly to restore once the function returns
+        int mOutputBufferSize; //!< byte size of the return value of the function
+
+        SuspendedCall() : mIsFunction(false), mSavedIp(0), mSavedAssembly(nullptr), mOutputBufferSize(0) {}
     };
 
     // Constructor
@@ -66,6 +84,34 @@ public:
 
     //! Get the runtime event listener
     IRuntimeListener* GetRuntimeListener() const { return mRuntimeListener; }
+
+    //! Set the profiler recording the execution of this state, nullptr to stop profiling.
+    //! The VM calls the profiler only if PEGASUS_ENABLE_BS_PROFILER is set.
+    void SetProfiler(BsVmProfiler* profiler) { mProfiler = profiler; }
+
+    //! Get the profiler recording the execution of this state
+    BsVmProfiler* GetProfiler() const { return mProfiler; }
+
+    //! Set the assembly executed on this state. Set by Run and ExecuteFunction for the duration of the execution,
+    //! so callbacks can execute other functions of the script.
+    void SetAssembly(const Assembly* assembly) { mAssembly = assembly; }
+
+    //! Get the assembly being executed on this state, nullptr outside of an execution
+    const Assembly* GetAssembly() const { return mAssembly; }
+
+    //! Get the allocator of the memory of this state
+    Alloc::IAllocator* GetAllocator() const { return mAllocator; }
+
+    //! Set the yield deadline. Yield statements reached once the performance counter passes the deadline
+    //! suspend the execution (see Core::GetPerformanceCounter). Kept by Reset.
+    //! \param deadline the deadline in ticks of the performance counter, NO_YIELD_DEADLINE to ignore yield statements
+    void SetYieldDeadline(unsigned long long deadline) { mYieldDeadline = deadline; }
+
+    //! Get the yield deadline, NO_YIELD_DEADLINE if yield statements are ignored
+    unsigned long long GetYieldDeadline() const { return mYieldDeadline; }
+
+    //! Get the execution interrupted by a yield statement, valid while the execution state is Suspended
+    SuspendedCall& GetSuspendedCall() { return mSuspendedCall; }
     
     // gets registers
     int  GetReg(Canon::Register reg) const { return mR[reg]; }
@@ -140,6 +186,18 @@ private:
 
     //! Runtime listener
     IRuntimeListener* mRuntimeListener;
+
+    //! Profiler, nullptr when not profiling
+    BsVmProfiler* mProfiler;
+
+    //! Assembly being executed, nullptr outside of an execution
+    const Assembly* mAssembly;
+
+    //! Yield deadline, in ticks of the performance counter
+    unsigned long long mYieldDeadline;
+
+    //! Execution interrupted by a yield statement
+    SuspendedCall mSuspendedCall;
 };
 
 //actual virtual machine modifying the state
@@ -152,7 +210,8 @@ public:
     //! destructor
     ~BsVm(){}
 
-    //! Runs this assembly and modifies the virtual machine state of such
+    //! Runs this assembly and modifies the virtual machine state of such.
+    //! The state is left Suspended if a yield statement is reached after its yield deadline, see ResumeExecution.
     void Run(const Assembly& assembly, BsVmState& state) const;
 
     //! steps execution (one instruction).
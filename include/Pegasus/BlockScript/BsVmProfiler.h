@@ -0,0 +1,209 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BsVmProfiler.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Profiler of the blockscript virtual machine, instruction counts and time per function and per line
+
+#ifndef BSVMPROFILER_H
+#define BSVMPROFILER_H
+
+#include "Pegasus/BlockScript/FunCallback.h"
+
+namespace Pegasus
+{
+namespace Alloc
+{
+    class IAllocator;
+}
+
+namespace BlockScript
+{
+
+class FunDesc;
+
+//! Profiler attached to a virtual machine state with BsVmState::SetProfiler().
+//! Counts the instructions executed and measures the wall time spent per function (FunDesc)
+//! and per source line. Time spent in native callbacks is measured around each call, and is
+//! reported both for the callback function and for the line calling it.
+//! The clock is read on function calls and returns, and every "sample interval" instructions.
+//! With an interval of 1 the time of every instruction is measured, with a bigger interval
+//! the elapsed time is attributed to the instruction executing when the clock is read (sampling).
+//! The VM calls the profiler only when PEGASUS_ENABLE_BS_PROFILER is set, and only for states
+//! with a profiler attached. A profiler must be attached to a single state at a time.
+class BsVmProfiler
+{
+public:
+
+    //! Counters of a function
+    struct FunctionStats
+    {
+        const FunDesc* mFunDesc;                //!< Function, nullptr for the global scope of the script
+        bool mIsNative;                         //!< True if the function is a native callback
+        unsigned int mCalls;                    //!< Number of calls
+        unsigned long long mInstructions;       //!< Instructions executed by the function itself
+        unsigned long long mSelfTicks;          //!< Time spent in the function itself (or in the callback), in performance counter ticks
+        unsigned long long mInclusiveTicks;     //!< Time spent in the function and its callees, in performance counter ticks
+        int mActiveDepth;                       //!< Number of calls of the function currently on the call stack
+    };
+
+    //! Counters of a source line
+    struct LineStats
+    {
+        unsigned long long mInstructions;       //!< Instructions generated by the line and executed
+        unsigned long long mTicks;              //!< Time spent executing the line, including the native callbacks it calls
+    };
+
+    //! Maximum number of functions tracked, further functions are ignored
+    static const int MAX_FUNCTIONS = 1024;
+
+    //! Maximum depth of the call stack tracked, deeper calls are attributed to the last tracked function
+    static const int MAX_CALL_DEPTH = 256;
+
+    //! Constructor
+    BsVmProfiler();
+
+    //! Destructor
+    ~BsVmProfiler();
+
+    //! Allocates the tables of the profiler
+    //! \param allocator the allocator used for the tables
+    void Initialize(Alloc::IAllocator* allocator);
+
+    //! Clears all the counters, keeps the memory
+    void Reset();
+
+    //! Sets the number of instructions between two reads of the clock
+    //! \param interval the number of instructions, 1 to measure every instruction
+    void SetSampleInterval(unsigned int interval) { mSampleInterval = interval > 0 ? interval : 1; }
+
+    //! \return the number of instructions between two reads of the clock
+    unsigned int GetSampleInterval() const { return mSampleInterval; }
+
+    //! \return the number of functions recorded
+    int GetFunctionCount() const { return mFunctionCount; }
+
+    //! \param index the index of the function, < GetFunctionCount()
+    //! \return the counters of the function
+    const FunctionStats& GetFunctionStats(int index) const;
+
+    //! \return the number of source lines in the line table (highest line executed + 1)
+    int GetLineCount() const { return mLineCount; }
+
+    //! \param line the source line, counted from 0 like the compiler does, < GetLineCount()
+    //! \return the counters of the line
+    const LineStats& GetLineStats(int line) const;
+
+    //! \return the total number of instructions executed
+    unsigned long long GetTotalInstructions() const { return mTotalInstructions; }
+
+    //! \param ticks a duration in performance counter ticks
+    //! \return the duration in milliseconds
+    double TicksToMs(unsigned long long ticks) const;
+
+    //! \param funDesc the function
+    //! \return the name of the function, "<global>" for the global scope
+    static const char* GetFunctionName(const FunDesc* funDesc);
+
+    //! Prints the functions sorted by self time, then the lines sorted by time (lines counted from 1)
+    //! \param str callback printing a string
+    //! \param pint callback printing an integer
+    //! \param pfloat callback printing a float
+    //! \param maxEntries the maximum number of functions and lines to print
+    void PrintReport(PrintStringCallbackType str, PrintIntCallbackType pint, PrintFloatCallbackType pfloat, int maxEntries = 32) const;
+
+    //-- VM hooks --//
+
+    //! Called by the VM when a script starts running from its global scope
+    void OnRunBegin();
+
+    //! Called by the VM when a script exits
+    void OnRunEnd();
+
+    //! Called when a function is called from native code, the call stack is cleared
+    //! \param funDesc the function called
+    void OnExternalCall(const FunDesc* funDesc);
+
+    //! Called by the VM before executing an instruction
+    //! \param line the source line of the instruction
+    void OnInstruction(int line)
+    {
+        if (++mSampleCounter >= mSampleInterval)
+        {
+            mSampleCounter = 0;
+            Flush();
+        }
+        ++mTotalInstructions;
+        mCurrentLine = line;
+        if (line >= 0)
+        {
+            if (line >= mLineCount)
+            {
+                GrowLines(line + 1);
+            }
+            ++mLines[line].mInstructions;
+        }
+        if (mCallDepth > 0)
+        {
+            ++mFunctions[mCallStack[mCallDepth - 1].mFunction].mInstructions;
+        }
+    }
+
+    //! Called by the VM when entering a function (script function or native callback)
+    //! \param funDesc the function entered
+    void OnFunctionEnter(const FunDesc* funDesc);
+
+    //! Called by the VM when leaving the last function entered
+    void OnFunctionExit();
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(BsVmProfiler);
+
+    //! Entry of the call stack
+    struct CallStackEntry
+    {
+        int mFunction;                      //!< Index of the function in the function table
+        unsigned long long mStartTick;      //!< Tick of the call
+    };
+
+    //! Attributes the time elapsed since the last read of the clock to the current function and line
+    //! \return the current tick
+    unsigned long long Flush();
+
+    //! Finds or creates the entry of a function
+    //! \return the index of the function, -1 if the table is full
+    int FindFunction(const FunDesc* funDesc);
+
+    //! Pops all the functions of the call stack
+    void UnwindCallStack();
+
+    //! Grows the line table
+    //! \param lineCount the minimum number of lines of the table
+    void GrowLines(int lineCount);
+
+    Alloc::IAllocator* mAllocator;
+    FunctionStats* mFunctions;
+    int* mFunctionSlots;
+    int mFunctionCount;
+    LineStats* mLines;
+    int mLineCount;
+    int mLineCapacity;
+    CallStackEntry* mCallStack;
+    int mCallDepth;
+    int mIgnoredDepth;
+    int mCurrentLine;
+    unsigned int mSampleInterval;
+    unsigned int mSampleCounter;
+    unsigned long long mLastTick;
+    unsigned long long mTotalInstructions;
+};
+
+}
+}
+
+#endif
@@ -75,7 +75,8 @@ public:
         mCurrentFunDesc(nullptr),
         mCurrentBlock(0), 
         mCurrentTempAllocationSize(0),
-        mNextLabel(0)
+        mNextLabel(0),
+        mCurrentLine(0)
     {
     }
 
@@ -174,6 +175,7 @@ private:
     int mCurrentBlock;
     int mCurrentTempAllocationSize;
     int mNextLabel;
+    int mCurrentLine;
 
     Memory::BlockAllocator mAllocator;
     Container<Canon::Block> mBlocks;
@@ -28,14 +28,20 @@ namespace Pegasus
 namespace BlockScript
 {
 
-//! class that interprets an expression tree
+//! class that interprets an expression tree.
+//! An engine only lives for the evaluation of one expression, on the stack of the caller,
+//! so states evaluated on different threads never share an engine.
 template<class IntrinsicType>
 class ExpressionEngine : public IVisitor
 {
 public:
-    explicit ExpressionEngine() : mState(nullptr) {}
     virtual ~ExpressionEngine(){}
-    IntrinsicType& Eval(Ast::Exp* exp, BsVmState& state);
+
+    //! Evaluates an expression
+    //! \param exp the expression to evaluate
+    //! \param state the vm state containing the memory read by the expression
+    //! \return the value of the expression
+    static IntrinsicType Eval(Ast::Exp* exp, BsVmState& state);
 
     
 #define BS_PROCESS(N) virtual void Visit(Ast::N* n);
@@ -43,6 +49,7 @@ public:
 #undef BS_PROCESS
 
 private:
+    explicit ExpressionEngine(BsVmState& state) : mState(&state) {}
     IntrinsicType* GetArrayReference(Ast::Exp* lhs, Ast::Exp* rhs);
     BsVmState* mState;
     IntrinsicType mResult;
@@ -58,17 +65,6 @@ typedef ExpressionEngine<Pegasus::Math::Vec4> ExpressionEngine_Float4;
 typedef ExpressionEngine<Pegasus::Math::Vec3> ExpressionEngine_Float3;
 typedef ExpressionEngine<Pegasus::Math::Vec2> ExpressionEngine_Float2;
 
-//Singleton expression engines. 
-ExpressionEngine_Int    gIntExpEngine;
-ExpressionEngine_Float  gFloatExpEngine;
-ExpressionEngine_Float2 gFloat2ExpEngine;
-ExpressionEngine_Float3 gFloat3ExpEngine;
-ExpressionEngine_Float4 gFloat4ExpEngine;
-ExpressionEngine_Mat22 gMat22ExpEngine;
-ExpressionEngine_Mat33 gMat33ExpEngine;
-ExpressionEngine_Mat44 gMat44ExpEngine;
-
-
 }
 }
 
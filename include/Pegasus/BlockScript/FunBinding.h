@@ -0,0 +1,315 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   FunBinding.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Binding of c++ functions into blockscript. The signature and the callback are generated
+//!         from the c++ function pointer, arguments are read at offsets computed at compile time.
+
+#ifndef BLOCKSCRIPT_FUNBINDING_H
+#define BLOCKSCRIPT_FUNBINDING_H
+
+#include "Pegasus/BlockScript/FunCallback.h"
+#include "Pegasus/BlockScript/BsVm.h"
+#include "Pegasus/Math/Vector.h"
+#include "Pegasus/Math/Matrix.h"
+#include "Pegasus/Core/Assertion.h"
+
+//! Binding of a c++ function, use it to declare the function in a FunctionDeclarationDesc table:
+//! BS_BIND(Dot)::Declare("dot", "x", "y")
+//! The function must not be overloaded, templates need all their arguments, e.g. BS_BIND(Dot<Math::Vec4>)
+#define BS_BIND(...) Pegasus::BlockScript::FunBinding<decltype(&__VA_ARGS__), &__VA_ARGS__>
+
+//! Declares a c++ type that is passed by value with its native layout, as the blockscript type scriptTypeName.
+//! Use it in the global namespace, for structures registered with CreateStructTypes or for handles (see ObjectHandle).
+#define BS_BINDING_TYPE(cppType, scriptTypeName) \
+    namespace Pegasus { namespace BlockScript { \
+        template<> struct BindingType< cppType > : public Private_FunBinding::PackedType< cppType > \
+        { static const char* GetName() { return scriptTypeName; } }; \
+    } }
+
+namespace Pegasus
+{
+namespace BlockScript
+{
+
+//! Describes how a c++ type crosses into blockscript. Specialize it (see BS_BINDING_TYPE) for every type
+//! in the signature of a bound function. A specialization defines:
+//!     SIZE      the byte size of the type in the packed argument buffer, 0 if not a script argument
+//!     GetName() the blockscript type name, nullptr if not a script argument
+//!     Read()    the argument value, from the context and the argument location in the buffer
+//!     Write()   (return types only) the return value, into the output buffer
+template <class T>
+struct BindingType;
+
+//! Integer handle of a script object. T only distinguishes the kinds of handles, so each gets its own script type name
+template <class T>
+struct ObjectHandle
+{
+    int mHandle;
+
+    ObjectHandle() {}
+    ObjectHandle(int handle) : mHandle(handle) {}
+    operator int() const { return mHandle; }
+};
+
+namespace Private_FunBinding
+{
+    //! Type passed with its native layout
+    template <class T>
+    struct PackedType
+    {
+        static const int SIZE = sizeof(T);
+        static T& Read(FunCallbackContext& context, char* buffer) { return *reinterpret_cast<T*>(buffer); }
+        static void Write(void* buffer, const T& value) { *static_cast<T*>(buffer) = value; }
+    };
+
+    //! Type of the context of the call, passed to the c++ function but not part of the blockscript signature
+    struct ContextType
+    {
+        static const int SIZE = 0;
+        static const char* GetName() { return nullptr; }
+    };
+
+    template <int... I>
+    struct IndexList
+    {
+    };
+
+    //! IndexList<0, 1, ... N-1>
+    template <int N, int... I>
+    struct MakeIndexList : public MakeIndexList<N - 1, N - 1, I...>
+    {
+    };
+
+    template <int... I>
+    struct MakeIndexList<0, I...>
+    {
+        typedef IndexList<I...> Type;
+    };
+
+    //! Byte size of the packed arguments
+    template <class... A>
+    struct ArgSize
+    {
+        static const int VALUE = 0;
+    };
+
+    template <class H, class... T>
+    struct ArgSize<H, T...>
+    {
+        static const int VALUE = BindingType<H>::SIZE + ArgSize<T...>::VALUE;
+    };
+
+    //! Count of the arguments that are part of the blockscript signature
+    template <class... A>
+    struct ScriptArgCount
+    {
+        static const int VALUE = 0;
+    };
+
+    template <class H, class... T>
+    struct ScriptArgCount<H, T...>
+    {
+        static const int VALUE = (BindingType<H>::SIZE > 0 ? 1 : 0) + ScriptArgCount<T...>::VALUE;
+    };
+
+    //! Byte offset of the argument I in the packed arguments
+    template <int I, class... A>
+    struct ArgOffset;
+
+    template <class H, class... T>
+    struct ArgOffset<0, H, T...>
+    {
+        static const int VALUE = 0;
+    };
+
+    template <int I, class H, class... T>
+    struct ArgOffset<I, H, T...>
+    {
+        static const int VALUE = BindingType<H>::SIZE + ArgOffset<I - 1, T...>::VALUE;
+    };
+
+    //! Fills a declaration from the signature of a c++ function
+    //! \param functionName the blockscript name of the function
+    //! \param returnType the blockscript return type
+    //! \param argumentTypes the blockscript types of the c++ arguments, nullptr for the context arguments
+    //! \param argumentCount the count of c++ arguments
+    //! \param argumentNames the names of the script arguments
+    //! \param callback the callback of the function
+    //! \return the declaration of the function
+    inline FunctionDeclarationDesc Declare(const char* functionName, const char* returnType, const char* const* argumentTypes, int argumentCount, const char* const* argumentNames, FunCallback callback)
+    {
+        FunctionDeclarationDesc desc;
+        desc.functionName = functionName;
+        desc.returnType = returnType;
+        desc.callback = callback;
+        int scriptArgCount = 0;
+        for (int i = 0; i < argumentCount; ++i)
+        {
+            if (argumentTypes[i] != nullptr)
+            {
+                desc.argumentTypes[scriptArgCount] = argumentTypes[i];
+                desc.argumentNames[scriptArgCount] = argumentNames[scriptArgCount];
+                ++scriptArgCount;
+            }
+        }
+        for (int i = scriptArgCount; i < MAX_FUN_ARG_LIST; ++i)
+        {
+            desc.argumentTypes[i] = nullptr;
+            desc.argumentNames[i] = nullptr;
+        }
+        return desc;
+    }
+}
+
+// const and reference qualifiers are only relevant to the c++ function
+template <class T>
+struct BindingType<const T> : public BindingType<T>
+{
+};
+
+template <class T>
+struct BindingType<T&> : public BindingType<T>
+{
+};
+
+//! Functions without return value are declared as returning an int, set to 0
+template <>
+struct BindingType<void>
+{
+    static const int SIZE = sizeof(int);
+    static const char* GetName() { return "int"; }
+};
+
+template <>
+struct BindingType<FunCallbackContext&> : public Private_FunBinding::ContextType
+{
+    static FunCallbackContext& Read(FunCallbackContext& context, char* buffer) { return context; }
+};
+
+template <>
+struct BindingType<BsVmState*> : public Private_FunBinding::ContextType
+{
+    static BsVmState* Read(FunCallbackContext& context, char* buffer) { return context.GetVmState(); }
+};
+
+//! Blockscript strings are passed as heap handles
+template <>
+struct BindingType<const char*>
+{
+    static const int SIZE = sizeof(int);
+    static const char* GetName() { return "string"; }
+    static const char* Read(FunCallbackContext& context, char* buffer)
+    {
+        return static_cast<const char*>(context.GetVmState()->GetHeapElement(*reinterpret_cast<int*>(buffer)).mObject);
+    }
+};
+
+//! The star type is passed as an offset in the memory of the vm
+template <>
+struct BindingType<void*>
+{
+    static const int SIZE = sizeof(int);
+    static const char* GetName() { return "*"; }
+    static void* Read(FunCallbackContext& context, char* buffer)
+    {
+        return context.GetVmState()->Ram() + *reinterpret_cast<int*>(buffer);
+    }
+};
+
+//! Generates the callback and the declaration of a c++ function, see BS_BIND.
+//! Arguments are read in place from the packed argument buffer, the return value is written in the output buffer.
+template <class F, F f>
+class FunBinding;
+
+template <class R, class... A, R (*f)(A...)>
+class FunBinding<R (*)(A...), f>
+{
+public:
+    //! Declares the function, with the types of the c++ signature
+    //! \param functionName the blockscript name of the function
+    //! \param argumentNames the names of the arguments, context arguments excluded
+    //! \return the declaration, to register with BlockLib::CreateIntrinsicFunctions
+    template <class... N>
+    static FunctionDeclarationDesc Declare(const char* functionName, N... argumentNames)
+    {
+        static_assert(sizeof...(N) == Private_FunBinding::ScriptArgCount<A...>::VALUE, "one name is required per script argument");
+        static_assert(sizeof...(A) < MAX_FUN_ARG_LIST, "too many arguments");
+        const char* const argumentTypes[] = { BindingType<A>::GetName()..., nullptr };
+        const char* const names[] = { argumentNames..., nullptr };
+        return Private_FunBinding::Declare(functionName, BindingType<R>::GetName(), argumentTypes, sizeof...(A), names, &Invoke);
+    }
+
+    //! Callback of the function
+    static void Invoke(FunCallbackContext& context)
+    {
+        Call(context, typename Private_FunBinding::MakeIndexList<sizeof...(A)>::Type());
+    }
+
+private:
+    template <int... I>
+    static void Call(FunCallbackContext& context, Private_FunBinding::IndexList<I...>)
+    {
+        PG_ASSERTSTR(context.GetInputBufferSize() == Private_FunBinding::ArgSize<A...>::VALUE, "Size of input buffer: %d", context.GetInputBufferSize());
+        PG_ASSERTSTR(context.GetOutputBufferSize() == BindingType<R>::SIZE, "Size of output buffer: %d", context.GetOutputBufferSize());
+        char* input = static_cast<char*>(context.GetRawInputBuffer());
+        BindingType<R>::Write(
+            context.GetRawOutputBuffer(),
+            f(BindingType<A>::Read(context, input + Private_FunBinding::ArgOffset<I, A...>::VALUE)...)
+        );
+    }
+};
+
+template <class... A, void (*f)(A...)>
+class FunBinding<void (*)(A...), f>
+{
+public:
+    //! Declares the function, with the types of the c++ signature
+    //! \param functionName the blockscript name of the function
+    //! \param argumentNames the names of the arguments, context arguments excluded
+    //! \return the declaration, to register with BlockLib::CreateIntrinsicFunctions
+    template <class... N>
+    static FunctionDeclarationDesc Declare(const char* functionName, N... argumentNames)
+    {
+        static_assert(sizeof...(N) == Private_FunBinding::ScriptArgCount<A...>::VALUE, "one name is required per script argument");
+        static_assert(sizeof...(A) < MAX_FUN_ARG_LIST, "too many arguments");
+        const char* const argumentTypes[] = { BindingType<A>::GetName()..., nullptr };
+        const char* const names[] = { argumentNames..., nullptr };
+        return Private_FunBinding::Declare(functionName, BindingType<void>::GetName(), argumentTypes, sizeof...(A), names, &Invoke);
+    }
+
+    //! Callback of the function
+    static void Invoke(FunCallbackContext& context)
+    {
+        Call(context, typename Private_FunBinding::MakeIndexList<sizeof...(A)>::Type());
+    }
+
+private:
+    template <int... I>
+    static void Call(FunCallbackContext& context, Private_FunBinding::IndexList<I...>)
+    {
+        PG_ASSERTSTR(context.GetInputBufferSize() == Private_FunBinding::ArgSize<A...>::VALUE, "Size of input buffer: %d", context.GetInputBufferSize());
+        char* input = static_cast<char*>(context.GetRawInputBuffer());
+        f(BindingType<A>::Read(context, input + Private_FunBinding::ArgOffset<I, A...>::VALUE)...);
+        *static_cast<int*>(context.GetRawOutputBuffer()) = 0;
+    }
+};
+
+}
+}
+
+BS_BINDING_TYPE(int,                     "int")
+BS_BINDING_TYPE(float,                   "float")
+BS_BINDING_TYPE(Pegasus::Math::Vec2,     "float2")
+BS_BINDING_TYPE(Pegasus::Math::Vec3,     "float3")
+BS_BINDING_TYPE(Pegasus::Math::Vec4,     "float4")
+BS_BINDING_TYPE(Pegasus::Math::Mat22,    "float2x2")
+BS_BINDING_TYPE(Pegasus::Math::Mat33,    "float3x3")
+BS_BINDING_TYPE(Pegasus::Math::Mat44,    "float4x4")
+
+#endif
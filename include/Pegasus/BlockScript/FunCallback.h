@@ -187,7 +187,7 @@ struct ObjectPropertyDesc
     int propertyUniqueId;
 };
 
-#define MAX_ENUM_MEMBER_LIST 50
+#define MAX_ENUM_MEMBER_LIST 64
 
 struct EnumDeclarationDesc
 {
@@ -235,6 +235,19 @@ FunBindPoint GetFunctionBindPoint(
     int argumentListCount
 );
 
+//! Gets a function bind point to be used to call, from the type descriptions of its arguments.
+//! \param assembly - the assembly code, containing the mapping with function bind points
+//! \param funName - the string name of the function
+//! \param argTypes - the types of the arguments of this function
+//! \param argumentListCount - the count of the arguments of this function
+//! \return FUN_INVALID_BIND_POINT if the function does not exist, otherwise a valid bind point.
+FunBindPoint GetFunctionBindPoint(
+    const Assembly& assembly,
+    const char* funName,
+    const TypeDesc*const* argTypes,
+    int argumentListCount
+);
+
 
 //! Executes a function from a specific bind point.
 //! \param bindPoint - the function bind point. If an invalid bind point is passed, we return false.
@@ -247,6 +260,8 @@ FunBindPoint GetFunctionBindPoint(
 //! \param inputBufferSize - the size of the input argument buffer. If this size does not match the input buffer size of the function then this function returns false.
 //! \param outputBuffer - the output buffer to be used. 
 //! \param outputBufferSize - the size of the return buffer. If this size does not match the return value size, then this function returns false.
+//! \note If the function reaches a yield statement after the yield deadline of the state, this function returns true with the
+//!       state Suspended and the output buffer not written yet. The execution then continues with ResumeExecution.
 bool ExecuteFunction(
     FunBindPoint bindPoint,
     BlockScriptBuilder* builder, 
@@ -259,6 +274,124 @@ bool ExecuteFunction(
     int   outputBufferSize
 );
 
+//! Executes a function from a specific bind point while a function started by ExecuteFunction is suspended by a yield statement.
+//! The function runs to completion on top of the suspended one, and reads the state it has reached so far.
+//! The state is left Suspended, and the suspended function continues untouched with ResumeExecution.
+//! \param bindPoint - the function bind point. If an invalid bind point is passed, we return false.
+//! \param builder - the ast builder, containing necessary meta-data
+//! \param assembly - the assembly instruction set.
+//! \param bsVmState - the vm state, Suspended.
+//! \param vm - the vm that will run the function.
+//! \param inputBuffer - the input buffer (see ExecuteFunction).
+//! \param inputBufferSize - the size of the input argument buffer.
+//! \param outputBuffer - the output buffer to be used.
+//! \param outputBufferSize - the size of the return buffer.
+//! \return false if the state is not Suspended in a function (a suspended global scope is not complete), or if the sizes do not match.
+bool ExecuteFunctionWhileSuspended(
+    FunBindPoint bindPoint,
+    BlockScriptBuilder* builder, 
+    const Assembly& assembly,
+    BsVmState& state,
+    BsVm& vm,
+    const void* inputBuffer,
+    int   inputBufferSize,
+    void* outputBuffer,
+    int   outputBufferSize
+);
+
+//! Continues an execution suspended by a yield statement (see BsVmState::SetYieldDeadline), until it completes
+//! or reaches a yield statement after the yield deadline again.
+//! \param assembly - the assembly instruction set, the one of the suspended execution.
+//! \param state - the vm state, Suspended.
+//! \param vm - the vm that will run the execution.
+//! \param outputBuffer - for a function started by ExecuteFunction, the output buffer receiving the return value once the function completes.
+//!                       Can be null to discard it, and is ignored when the suspended execution is the global scope (see BsVm::Run).
+//! \param outputBufferSize - the size of the return buffer, as passed to ExecuteFunction.
+//! \return false if the state is not Suspended or the size of the return buffer does not match, true otherwise.
+//!         The execution is complete if the state is not Suspended anymore.
+bool ResumeExecution(
+    const Assembly& assembly,
+    BsVmState& state,
+    BsVm& vm,
+    void* outputBuffer,
+    int   outputBufferSize
+);
+
+//! Executes a function from a specific bind point on many independent vm states, in parallel on worker threads.
+//! The assembly is only read, so every state can run on its own thread. Each state must have its own memory
+//! (already initialized by running the script once) and must not be used by anything else during the call.
+//! Native callbacks called by the function run on the worker threads and must be thread safe.
+//! \param bindPoint - the function bind point. If an invalid bind point is passed, no state executes the function.
+//! \param builder - the ast builder, containing necessary meta-data
+//! \param assembly - the assembly instruction set.
+//! \param states - the vm states, one execution of the function per state.
+//! \param stateCount - the count of states.
+//! \param vm - the vm that will run the function.
+//! \param inputBuffers - the input buffers, packed one after the other: the arguments of the state i start at i * inputBufferSize.
+//! \param inputBufferSize - the size of the input argument buffer of one execution, as in ExecuteFunction.
+//! \param outputBuffers - the output buffers, packed one after the other: the return value of the state i starts at i * outputBufferSize.
+//! \param outputBufferSize - the size of the return buffer of one execution, as in ExecuteFunction.
+//! \param workerCount - the count of threads running the states including the calling thread, 0 to use all the hardware threads.
+//! \return the count of states on which the function has been executed successfully (see ExecuteFunction).
+int ExecuteFunctionParallel(
+    FunBindPoint bindPoint,
+    BlockScriptBuilder* builder, 
+    const Assembly& assembly,
+    BsVmState* const* states,
+    int   stateCount,
+    BsVm& vm,
+    const void* inputBuffers,
+    int   inputBufferSize,
+    void* outputBuffers,
+    int   outputBufferSize,
+    unsigned int workerCount
+);
+
+//! Executes a function from a specific bind point on many instances of its arguments, with a single vm state.
+//! The instances run together in lanes: each instruction executes once for all the lanes, with the memory of the
+//! lanes laid out as a structure of arrays, so the float and vector arithmetic runs on all the instances at once.
+//! Lanes that take different branches split, and join again when they reach the same block.
+//! The instances must be independent: the function can read globals but not write them. Functions that write
+//! globals, access object properties, create strings or pass the star type to a callback cannot run in lanes
+//! and are executed once per instance with ExecuteFunction instead. Callbacks are called once per instance.
+//! The instances run to completion, yield statements are ignored.
+//! The lanes work in memory of the frame allocator of the calling thread (see Memory::GetFrameAllocator).
+//! \param bindPoint - the function bind point. If an invalid bind point is passed, we return false.
+//! \param builder - the ast builder, containing necessary meta-data
+//! \param assembly - the assembly instruction set.
+//! \param state - the vm state, with its globals initialized. Its memory is only written when running one instance at a time.
+//! \param vm - the vm running the function when it cannot run in lanes.
+//! \param inputBuffers - the input buffers, packed one after the other: the arguments of the instance i start at i * inputBufferSize.
+//!                       Input and output buffers can be the same when their sizes are equal.
+//! \param inputBufferSize - the size of the input argument buffer of one instance, as in ExecuteFunction.
+//! \param outputBuffers - the output buffers, packed one after the other: the return value of the instance i starts at i * outputBufferSize.
+//! \param outputBufferSize - the size of the return buffer of one instance, as in ExecuteFunction.
+//! \param instanceCount - the count of instances.
+//! \return true if the function executed for all the instances, false otherwise.
+bool ExecuteFunctionBatch(
+    FunBindPoint bindPoint,
+    BlockScriptBuilder* builder, 
+    const Assembly& assembly,
+    BsVmState& state,
+    BsVm& vm,
+    const void* inputBuffers,
+    int   inputBufferSize,
+    void* outputBuffers,
+    int   outputBufferSize,
+    int   instanceCount
+);
+
+//! Checks if a function can run in lanes when executed with ExecuteFunctionBatch.
+//! \param bindPoint - the function bind point.
+//! \param assembly - the assembly instruction set.
+//! \param state - the vm state the function would run on.
+//! \return true if the function runs in lanes, false if it would be executed once per instance or if the bind point is invalid.
+bool CanExecuteFunctionInLanes(
+    FunBindPoint bindPoint,
+    const Assembly& assembly,
+    BsVmState& state
+);
+
 //! Reads a global value from the VM state.
 //! \param bindPoint the bind point of the global value to read from
 //! \param assembly the assembly instruction set with global metadata
@@ -0,0 +1,47 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   IBytecodeCache.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Storage interface of compiled scripts. Pass this on a compiler and it will try to
+//!         load the compiled script from it before compiling, and store the result after a compilation.
+
+#ifndef PEGASUS_BLOCKSCRIPT_IBYTECODECACHE_H
+#define PEGASUS_BLOCKSCRIPT_IBYTECODECACHE_H
+
+namespace Pegasus
+{
+namespace BlockScript
+{
+
+class IBytecodeCache
+{
+public:
+    IBytecodeCache() {}
+    virtual ~IBytecodeCache() {}
+
+    //! Callback, triggered when the compiler looks for a cached version of the script
+    //! \param outBuffer output parameter, set the cached content here.
+    //! \param outBufferSize output parameter of the size that corresponds to the outBuffer
+    //! \return true if there is a cached content, false otherwise
+    virtual bool Read(const char** outBuffer, int& outBufferSize) = 0;
+
+    //! If Read returns true, this function is guaranteed to be executed, once the content is not needed anymore.
+    //! \param buffer - the buffer that was filled in outBuffer in the Read function
+    virtual void ReleaseRead(const char* buffer) = 0;
+
+    //! Callback, triggered after a successful compilation when the compiled script can be cached
+    //! \param buffer the content to store, only valid during the call
+    //! \param bufferSize size of the content
+    virtual void Write(const void* buffer, int bufferSize) = 0;
+
+};
+
+}
+}
+
+#endif
@@ -106,12 +106,27 @@ public:
     //! \return gets the parent stack frame id
     StackFrameInfo* GetParentStackFrame() const { return mParent; }
 
+    //! sets the source line where this stack frame is opened
+    //! \param line the source line
+    void SetLine(int line) { mLine = line; }
+
+    //! \return the source line where this stack frame is opened
+    int GetLine() const { return mLine; }
+
+    //! \return the number of declarations allocated in this frame
+    int GetEntryCount() const { return mEntries.Size(); }
+
+    //! \param index the index of the declaration, from 0 to GetEntryCount(), in allocation order
+    //! \return the declaration
+    const Entry& GetEntry(int index) const { return mEntries[index]; }
+
 private:
     int mSize; 
     int mTempSize;
     CreatorCategory mCreatorCategory;
     Container<Entry> mEntries;
     StackFrameInfo*  mParent;
+    int mLine;
 };
 
 }
@@ -159,6 +159,24 @@ public:
     //! \return the type table
     const TypeTable* GetTypeTable() const { return &mTypeTable; }
 
+    //! \return the number of child symbol tables (external libraries)
+    int GetChildCount() const { return mChildren.Size(); }
+
+    //! \param index the index of the child, from 0 to GetChildCount()
+    //! \return the child symbol table
+    const SymbolTable* GetChild(int index) const { return mChildren[index]; }
+
+    //! \param index the index of the child, from 0 to GetChildCount()
+    //! \return the child symbol table
+    SymbolTable* GetChild(int index) { return mChildren[index]; }
+
+    //! \return the number of stack frames
+    int GetFrameCount() const { return mFrames.Size(); }
+
+    //! \param index the index of the frame, from 0 to GetFrameCount(). Frame 0 is the root global frame
+    //! \return the stack frame
+    StackFrameInfo* GetFrameByIndex(int index) { return &mFrames[index]; }
+
 private:
     //! Creates a new type if it does not exist. If the type exists already, it will find it and return it
     //! \param modifier  the modifier to be using
@@ -93,9 +93,10 @@ extern int BS_debug;
      O_METHOD_CALL = 302,
      O_IMPLICIT_CAST = 303,
      O_EXPLICIT_CAST = 304,
-     ACCESS_PREC = 305,
-     CAST = 306,
-     NEG = 307
+     K_YIELD = 305,
+     ACCESS_PREC = 306,
+     CAST = 307,
+     NEG = 308
    };
 #endif
 
@@ -119,7 +120,7 @@ typedef union YYSTYPE
 
 
 /* Line 2058 of yacc.c  */
-#line 123 "bs.parser.hpp"
+#line 124 "bs.parser.hpp"
 } YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define yystype YYSTYPE /* obsolescent; will be withdrawn */
@@ -0,0 +1,135 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Atomic.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Atomic operations on 32 bit integers and pointers, for lock-free structures shared between threads.
+//!         All the operations are full memory barriers.
+
+#ifndef PEGASUS_CORE_ATOMIC_H
+#define PEGASUS_CORE_ATOMIC_H
+
+#if PEGASUS_COMPILER_MSVC
+#include <intrin.h>
+#endif
+
+namespace Pegasus {
+namespace Core {
+
+//! 32 bit integer meant to be accessed only through the Atomic* functions
+typedef volatile long AtomicInt;
+
+//----------------------------------------------------------------------------------------
+
+//! Atomically adds a value to an integer
+//! \param value Integer to modify.
+//! \param increment Value to add, can be negative.
+//! \return The new value of the integer.
+inline long AtomicAdd(AtomicInt* value, long increment)
+{
+#if PEGASUS_COMPILER_MSVC
+    return _InterlockedExchangeAdd(value, increment) + increment;
+#else
+    return __sync_add_and_fetch(value, increment);
+#endif
+}
+
+//! Atomically increments an integer
+//! \param value Integer to modify.
+//! \return The new value of the integer.
+inline long AtomicIncrement(AtomicInt* value)
+{
+#if PEGASUS_COMPILER_MSVC
+    return _InterlockedIncrement(value);
+#else
+    return __sync_add_and_fetch(value, 1);
+#endif
+}
+
+//! Atomically decrements an integer
+//! \param value Integer to modify.
+//! \return The new value of the integer.
+inline long AtomicDecrement(AtomicInt* value)
+{
+#if PEGASUS_COMPILER_MSVC
+    return _InterlockedDecrement(value);
+#else
+    return __sync_sub_and_fetch(value, 1);
+#endif
+}
+
+//! Atomically replaces an integer if it equals an expected value
+//! \param value Integer to modify.
+//! \param newValue Value to store.
+//! \param expected Value the integer must have for the store to happen.
+//! \return The value of the integer before the operation. The store happened if it equals expected.
+inline long AtomicCompareExchange(AtomicInt* value, long newValue, long expected)
+{
+#if PEGASUS_COMPILER_MSVC
+    return _InterlockedCompareExchange(value, newValue, expected);
+#else
+    return __sync_val_compare_and_swap(value, expected, newValue);
+#endif
+}
+
+//! Atomically reads an integer, with a full barrier so later reads are not moved before it
+//! \param value Integer to read.
+//! \return Value of the integer.
+inline long AtomicLoad(AtomicInt* value)
+{
+    return AtomicAdd(value, 0);
+}
+
+//! Atomically writes an integer, with a full barrier so previous writes are visible before it
+//! \param value Integer to write.
+//! \param newValue Value to store.
+inline void AtomicStore(AtomicInt* value, long newValue)
+{
+#if PEGASUS_COMPILER_MSVC
+    _InterlockedExchange(value, newValue);
+#else
+    __sync_lock_test_and_set(value, newValue);
+    __sync_synchronize();
+#endif
+}
+
+//! Atomically raises an integer to a value if the value is greater
+//! \param value Integer to modify.
+//! \param candidate Candidate maximum.
+inline void AtomicMax(AtomicInt* value, long candidate)
+{
+    long current = *value;
+    while (candidate > current)
+    {
+        const long previous = AtomicCompareExchange(value, candidate, current);
+        if (previous == current)
+        {
+            break;
+        }
+        current = previous;
+    }
+}
+
+//! Atomically replaces a pointer if it equals an expected value
+//! \param ptr Pointer to modify.
+//! \param newValue Value to store.
+//! \param expected Value the pointer must have for the store to happen.
+//! \return The value of the pointer before the operation. The store happened if it equals expected.
+inline void* AtomicCompareExchangePointer(void* volatile* ptr, void* newValue, void* expected)
+{
+#if PEGASUS_COMPILER_MSVC
+    return _InterlockedCompareExchangePointer(ptr, newValue, expected);
+#else
+    return __sync_val_compare_and_swap(ptr, expected, newValue);
+#endif
+}
+
+
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_CORE_ATOMIC_H
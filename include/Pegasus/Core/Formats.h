@@ -68,6 +68,13 @@ namespace Core
         FORMAT_R8_UINT,
         FORMAT_R8_SNORM,
         FORMAT_R8_TYPELESS,
+        FORMAT_BC1_UNORM,
+        FORMAT_BC1_UNORM_SRGB,
+        FORMAT_BC3_UNORM,
+        FORMAT_BC3_UNORM_SRGB,
+        FORMAT_BC5_UNORM,
+        FORMAT_BC7_UNORM,
+        FORMAT_BC7_UNORM_SRGB,
         FORMAT_MAX_COUNT
     };
 }
@@ -50,6 +50,22 @@ public:
     //! Destroys the currently owned buffer
     void DestroyBuffer();
 
+    //! Takes ownership of a read-only memory mapped view of a file
+    //! \param bufferAlloc Allocator used if the contents ever need to be copied to a writable buffer.
+    //! \param view Address of the mapped view.
+    //! \param viewSize Size of the mapped view.
+    //! \note The view is released by DestroyBuffer, as for an allocated buffer
+    void OwnMapping(Alloc::IAllocator* bufferAlloc, const char * view, int viewSize);
+
+    //! Tells if the contained buffer is a read-only memory mapped view of a file
+    //! \return True if the buffer is mapped. Writing to a mapped buffer causes an access violation.
+    bool IsMapped() const { return mIsMapped; }
+
+    //! Copies the contents of a mapped view into a buffer allocated with the allocator of the mapping,
+    //! then releases the view. Use this before writing to the buffer or overwriting the mapped file.
+    //! Does nothing if the buffer is not mapped.
+    void ResolveMapping();
+
 
     //! Sets the size of the contained file
     //! \param fileSize New file size.
@@ -82,6 +98,62 @@ private:
     char* mBuffer; //!< Contained buffer
     int mFileSize; //!< Size of the file in the buiffer
     int mBufferSize; //!< Size of the buffer
+    bool mIsMapped; //!< True when mBuffer is a read-only view of a mapped file
+};
+
+//----------------------------------------------------------------------------------------
+
+//! File opened for streaming reads. Data is read in chunks into buffers provided by the caller,
+//! so a file of any size (including bigger than 4 GB) can be processed with a fixed memory footprint.
+class FileStream
+{
+public:
+    //! Constructor
+    FileStream();
+
+    //! Destructor, closes the file if still open
+    ~FileStream();
+
+    //! Closes the file. Does nothing if no file is open
+    void Close();
+
+    //! Tells if a file is currently open
+    //! \return True if a file is open.
+    bool IsOpen() const { return mHandle != nullptr; }
+
+    //! Reads the next chunk of the file
+    //! \param buffer Caller provided destination buffer.
+    //! \param bufferSize Size of the destination buffer, maximum number of bytes to read.
+    //! \param outBytesRead Number of bytes read, less than bufferSize only at the end of the file.
+    //! \return Error code.
+    IoError Read(char* buffer, int bufferSize, int& outBytesRead);
+
+    //! Moves the read position
+    //! \param position Absolute position in bytes from the beginning of the file.
+    //! \return Error code.
+    IoError Seek(unsigned long long position);
+
+    //! Gets the size of the open file
+    //! \return File size in bytes.
+    unsigned long long GetFileSize() const { return mFileSize; }
+
+    //! Gets the current read position
+    //! \return Read position in bytes.
+    unsigned long long GetPosition() const { return mPosition; }
+
+    //! Tells if the read position reached the end of the file
+    //! \return True if there is nothing left to read.
+    bool IsEndOfFile() const { return mPosition >= mFileSize; }
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(FileStream);
+
+    friend class IOManager;
+
+    void* mHandle; //!< Native (or C runtime) handle of the file, nullptr when closed
+    unsigned long long mFileSize; //!< Size of the file, in bytes
+    unsigned long long mPosition; //!< Current read position, in bytes
 };
 
 //----------------------------------------------------------------------------------------
@@ -98,35 +170,82 @@ public:
     ~IOManager();
 
 
+    //! Roots the relative paths of the file functions are resolved from
+    enum FileRoot
+    {
+        ROOT_ASSETS, //!< the asset root, see GetRoot
+        ROOT_CACHE   //!< the cache root, receiving the files generated from the assets. See SetCacheRoot
+    };
+
     //! Gets the root filesystem for this manager
     //! \return Root filesystem path.
     inline const char* GetRoot() const { return mRootDirectory; }
 
+    //! Sets the root of the files generated from the assets, such as compiled caches, and creates its directory.
+    //! Kept apart from the asset root so generated files never land next to the sources.
+    //! \param cachePath Full path of the cache directory, ending with a separator. nullptr or empty disables the cache root.
+    void SetCacheRoot(const char* cachePath);
+
+    //! \return true if a cache root is set. The functions called with ROOT_CACHE fail otherwise.
+    inline bool HasCacheRoot() const { return mCacheDirectory[0] != '\0'; }
+
 
     //! Utility function that allocates memory and dumps it into an output buffer
     //! \param relativePath Relative path to the file, within the asset root.
     //! \param outputBuffer Output buffer, in which the loaded file is stored.
     //! \param allocateBuffer Whether to allocate the buffer inside of outputBuffer, or use a pre-allocated one.  This is a performance optimization.
     //! \param alloc Allocator to use when allocating the buffer.
+    //! \param root Root the path is relative to.
     //! \return Error code.
     //! \note Buffer must be deallocated by the caller
-    IoError OpenFileToBuffer(const char* relativePath, FileBuffer& outputBuffer, bool allocateBuffer = false, Alloc::IAllocator* alloc = nullptr);
+    IoError OpenFileToBuffer(const char* relativePath, FileBuffer& outputBuffer, bool allocateBuffer = false, Alloc::IAllocator* alloc = nullptr, FileRoot root = ROOT_ASSETS);
+
+    //! Maps a file in memory as a read-only buffer, avoiding a copy of its contents.
+    //! Pages are loaded on demand by the OS when first accessed.
+    //! \param relativePath Relative path to the file, within the asset root.
+    //! \param outputBuffer Output buffer, receiving the mapped view.
+    //! \param alloc Allocator used when the file is too small to be worth mapping (see MIN_MAPPED_FILE_SIZE),
+    //!              or when the contents are later resolved into a writable buffer.
+    //! \param root Root the path is relative to.
+    //! \return Error code.
+    //! \note Falls back to OpenFileToBuffer when the file cannot be mapped (small or empty file, no native IO).
+    //!       Check FileBuffer::IsMapped() before writing to the buffer.
+    IoError MapFileToBuffer(const char* relativePath, FileBuffer& outputBuffer, Alloc::IAllocator* alloc, FileRoot root = ROOT_ASSETS);
+
+    //! Opens a file for chunked streaming reads
+    //! \param relativePath Relative path to the file, within the asset root.
+    //! \param outputStream Stream receiving the open file.
+    //! \return Error code.
+    IoError OpenFileStream(const char* relativePath, FileStream& outputStream);
 
     //! Utility function that writes binary data to a file
     //! \param relativePath Relative path to the file, within the asset root.
     //! \param inputBuffer the file buffer to dump into the file.
+    //! \param root Root the path is relative to.
     //! \return Error code.
-    IoError SaveFileToBuffer(const char* relativePath, const FileBuffer& inputBuffer);
+    IoError SaveFileToBuffer(const char* relativePath, const FileBuffer& inputBuffer, FileRoot root = ROOT_ASSETS);
 
 
     static const unsigned int MAX_FILEPATH_LENGTH = 256; //!< Max length for a file path
 
+    //! Files smaller than this are read into an allocated buffer by MapFileToBuffer,
+    //! since a mapping costs at least one page of address space and a kernel object
+    static const int MIN_MAPPED_FILE_SIZE = 64 * 1024;
+
 private:
     // No copies allowed
     PG_DISABLE_COPY(IOManager);
 
+    //! Builds the full path of a file from the root directory
+    //! \param relativePath Relative path to the file, within the root.
+    //! \param outPath Output buffer of MAX_FILEPATH_LENGTH characters.
+    //! \param root Root the path is relative to.
+    //! \return false if the root is not set (no cache root), outPath is then empty
+    bool BuildFullPath(const char* relativePath, char* outPath, FileRoot root = ROOT_ASSETS) const;
+
 
     char mRootDirectory[MAX_FILEPATH_LENGTH]; //!< Root directory this manager loads files from
+    char mCacheDirectory[MAX_FILEPATH_LENGTH]; //!< Root directory of the generated files, empty if not set
 };
 
 
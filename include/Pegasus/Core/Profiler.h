@@ -0,0 +1,166 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Profiler.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  CPU frame profiler, hierarchical scopes recorded into per-thread ring buffers
+
+#ifndef PEGASUS_CORE_PROFILER_H
+#define PEGASUS_CORE_PROFILER_H
+
+#include "Pegasus/Core/Io.h"
+
+namespace Pegasus {
+    namespace Alloc {
+        class IAllocator;
+    }
+
+    namespace Utils {
+        class ByteStream;
+    }
+}
+
+namespace Pegasus {
+namespace Core {
+
+//! Rolling statistics of the scopes sharing a name, updated by \a BeginProfileFrame()
+struct ProfileSummaryEntry
+{
+    const char* mName;      //!< Name of the scope
+    float mLastMs;          //!< Time spent in the scope during the last frame, in milliseconds
+    float mAverageMs;       //!< Moving average of the time spent per frame, in milliseconds
+    float mMaxMs;           //!< Maximum time spent during a frame over the last PROFILER_SUMMARY_WINDOW frames, in milliseconds
+    unsigned int mCalls;    //!< Number of times the scope was closed during the last frame
+};
+
+//! Number of frames the maximum of a summary entry is computed over
+const unsigned int PROFILER_SUMMARY_WINDOW = 120;
+
+//! Initialize the profiler. The profiler starts disabled.
+//! \param allocator Allocator used for the per-thread event buffers.
+//! \warning Has to be done after \a InitializePegasusTime()
+void InitializeProfiler(Alloc::IAllocator* allocator);
+
+//! Destroy the event buffers of all the threads. Scopes opened after this call are ignored.
+void ShutdownProfiler();
+
+//! Request the profiler to be enabled or disabled, the change happens at the next \a BeginProfileFrame()
+//! so the scopes opened during a frame are always closed
+//! \param enabled True to record the scopes.
+void SetProfilerEnabled(bool enabled);
+
+//! Current state of the profiler, changed only by \a BeginProfileFrame(). Use \a IsProfilerEnabled()
+extern bool gProfilerEnabled;
+
+//! Tell if the scopes are currently recorded
+//! \return True if the profiler is enabled.
+inline bool IsProfilerEnabled() { return gProfilerEnabled; }
+
+//! Close the frame scope of the main thread, update the rolling summary, then open the scope of the next frame.
+//! \note Call from the main thread only, once per frame (done by Application::Update())
+void BeginProfileFrame();
+
+//! Open a scope on the calling thread
+//! \param name Name of the scope. The string must stay alive until the profiler is shut down (literal or class name).
+void BeginProfileScope(const char* name);
+
+//! Close the last scope opened by the calling thread
+void EndProfileScope();
+
+//! Get the number of entries in the rolling summary
+//! \return Number of distinct scope names recorded so far
+unsigned int GetProfileSummaryEntryCount();
+
+//! Get an entry of the rolling summary
+//! \param index Index of the entry, < \a GetProfileSummaryEntryCount().
+//! \return Entry of the summary, valid until the next call to \a BeginProfileFrame()
+const ProfileSummaryEntry& GetProfileSummaryEntry(unsigned int index);
+
+//! Find the entry of the rolling summary for a scope name
+//! \param name Name of the scope.
+//! \return Entry of the summary, nullptr if no scope with that name has been recorded
+const ProfileSummaryEntry* FindProfileSummaryEntry(const char* name);
+
+//! Get the moving average of the frame time, measured between two calls to \a BeginProfileFrame()
+//! \return Average frame time, in milliseconds
+float GetProfileAverageFrameTime();
+
+//! Send the rolling summary to the log, scopes sorted by average time
+void LogProfileSummary();
+
+//! Write the events currently held by the ring buffers as a Chrome trace (chrome://tracing, JSON object format)
+//! \param stream Stream receiving the JSON text (not null terminated).
+void WriteChromeTrace(Utils::ByteStream& stream);
+
+//! Save the events currently held by the ring buffers as a Chrome trace file
+//! \param ioManager IO manager used to save the file.
+//! \param relativePath Path of the file, relative to the root of the IO manager.
+//! \return Error code of the save.
+Io::IoError SaveChromeTrace(Io::IOManager* ioManager, const char* relativePath);
+
+//----------------------------------------------------------------------------------------
+
+//! Profiler scope open for the lifetime of the object, use PG_PROFILE_SCOPE() rather than declaring it
+class ProfileScope
+{
+public:
+    //! Constructor, opens the scope if the profiler is enabled
+    //! \param name Name of the scope, see \a BeginProfileScope().
+    explicit ProfileScope(const char* name) : mActive(IsProfilerEnabled())
+    {
+        if (mActive)
+        {
+            BeginProfileScope(name);
+        }
+    }
+
+    //! Destructor, closes the scope
+    ~ProfileScope()
+    {
+        if (mActive)
+        {
+            EndProfileScope();
+        }
+    }
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(ProfileScope);
+
+    bool mActive;
+};
+
+
+}   // namespace Core
+}   // namespace Pegasus
+
+//----------------------------------------------------------------------------------------
+
+#if PEGASUS_ENABLE_PROFILER
+
+#define PG_PROFILE_SCOPE_NAME_CONCAT2(a, b) a##b
+#define PG_PROFILE_SCOPE_NAME_CONCAT(a, b) PG_PROFILE_SCOPE_NAME_CONCAT2(a, b)
+
+//! Profile the rest of the current C++ scope
+//! \param name Name of the scope, literal or string alive until the profiler is shut down.
+#define PG_PROFILE_SCOPE(name) Pegasus::Core::ProfileScope PG_PROFILE_SCOPE_NAME_CONCAT(pgProfileScope, __LINE__)(name)
+
+//! Open a profiler scope, to close with PG_PROFILE_END() in the same frame
+#define PG_PROFILE_BEGIN(name) { if (Pegasus::Core::IsProfilerEnabled()) { Pegasus::Core::BeginProfileScope(name); } }
+
+//! Close the last profiler scope opened with PG_PROFILE_BEGIN()
+#define PG_PROFILE_END() { if (Pegasus::Core::IsProfilerEnabled()) { Pegasus::Core::EndProfileScope(); } }
+
+#else
+
+#define PG_PROFILE_SCOPE(name)
+#define PG_PROFILE_BEGIN(name)
+#define PG_PROFILE_END()
+
+#endif  // PEGASUS_ENABLE_PROFILER
+
+#endif  // PEGASUS_CORE_PROFILER_H
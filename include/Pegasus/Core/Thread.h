@@ -0,0 +1,52 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Thread.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Parallel execution of independent jobs on worker threads
+
+#ifndef PEGASUS_CORE_THREAD_H
+#define PEGASUS_CORE_THREAD_H
+
+namespace Pegasus {
+namespace Core {
+
+
+//! Maximum number of workers running jobs in parallel, including the calling thread
+static const unsigned int MAX_PARALLEL_WORKERS = 64;
+
+//! Function running one job of a parallel loop
+//! \param userData Pointer given to \a RunParallelJobs(), shared by all the jobs
+//! \param jobIndex Index of the job, in [0, jobCount)
+//! \param workerIndex Index of the worker running the job, in [0, workerCount), 0 being the calling thread.
+//!                    Two jobs never run at the same time with the same worker index, so it can select per-worker scratch data
+typedef void (*ParallelJobFunc)(void* userData, unsigned int jobIndex, unsigned int workerIndex);
+
+//! Get the number of threads the hardware runs at the same time
+//! \return Number of logical processors, at least 1
+unsigned int GetHardwareThreadCount();
+
+//! Run independent jobs on worker threads and the calling thread, returning once all of them are complete.
+//! Each worker takes the next job index from a shared counter, so jobs of uneven cost are balanced.
+//! The worker threads are started on first use and sleep between calls until \a ShutdownParallelJobs().
+//! A call made while another one runs (from a job or from another thread) runs its jobs on the calling thread only.
+//! \param jobFunc Function running a job, called once per job index
+//! \param userData Pointer given to each call of jobFunc
+//! \param jobCount Number of jobs
+//! \param workerCount Number of workers including the calling thread, 0 for \a GetHardwareThreadCount().
+//!                    Clamped to jobCount and MAX_PARALLEL_WORKERS, 1 runs every job on the calling thread
+void RunParallelJobs(ParallelJobFunc jobFunc, void* userData, unsigned int jobCount, unsigned int workerCount);
+
+//! Stop the worker threads of \a RunParallelJobs(), before exiting the application.
+//! Must not be called while jobs are running, a later call to RunParallelJobs() starts the threads again
+void ShutdownParallelJobs();
+
+
+}   // namespace Core
+}   // namespace Pegasus
+
+#endif  // PEGASUS_CORE_THREAD_H
@@ -31,6 +31,15 @@ void UpdatePegasusTime();
 //! \return System time in seconds
 double GetPegasusTime();
 
+//! Read the high resolution counter of the system, for measuring short durations.
+//! Unlike \a GetPegasusTime(), the counter is read at each call
+//! \return Current value of the counter, in ticks (see \a GetPerformanceCounterPeriod())
+unsigned long long GetPerformanceCounter();
+
+//! Get the duration of a tick of the high resolution counter
+//! \return Duration of a tick, in seconds
+double GetPerformanceCounterPeriod();
+
 
 }   // namespace Core
 }   // namespace Pegasus
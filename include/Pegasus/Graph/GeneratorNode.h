@@ -39,7 +39,8 @@ public:
     //!       In that case, this Update() should be called first, then the dirty flag
     //!       can be ORed with the content of the override before returning it.
     //! \note This class implements the default behavior of a generator,
-    //!       which returns only the dirty state of the data
+    //!       which returns only the dirty state of the node, property changes being
+    //!       pushed when they happen
     //! \warning If this base class function is called in a derived class,
     //!       it must be called at the end, after updating the internal state
     //!       and invalidating the node data
@@ -48,7 +49,7 @@ public:
 
     //! Return the node up-to-date data.
     //! \note Defines the standard behavior of all texture generator nodes.
-    //!       Calls GenerateData() if the node data is dirty.
+    //!       Calls GenerateData() if the node data is dirty, returns the data directly otherwise.
     //!       It should be overridden only for special cases.
     //! \param updated Set to true if the node has had the data recomputed
     //!                (output parameter, set to false only by the caller)
@@ -29,6 +29,8 @@ namespace Pegasus {
 namespace Graph {
 
 class NodeManager;
+class NodeDataInterner;
+class NodeDataKey;
 
 //! Base node class for all graph-based systems (textures, meshes, shaders, etc.)
 class Node : public Core::RefCounted, public PropertyGrid::PropertyGridObject
@@ -80,9 +82,10 @@ public:
 
             
     //! Update the node internal state by pulling external parameters.
-    //! This function sets the dirty flag of the node data if the internal state has changed
-    //! or if an input node is dirty, and returns the dirty flag to the parent caller.
-    //! That will trigger a chain of refreshed data when calling GetUpdatedData().
+    //! Property and input changes are pushed to the dependent nodes when they happen,
+    //! so this function only has to handle state living outside of the graph.
+    //! It sets the dirty flag of the node if the internal state has changed,
+    //! and returns the dirty flag to the caller.
     //! \warning To be redefined in derived classes
     //! \return True if the node data is dirty or if any input node is.
     virtual bool Update() = 0;
@@ -103,6 +106,52 @@ public:
     //! to save memory and to be able to restore the data later
     virtual void ReleaseDataAndPropagate();
 
+    //! Test if the node has to regenerate its data before it can be used.
+    //! Dirtiness is propagated to the dependent nodes as soon as a property or an input changes,
+    //! so testing a node never walks the graph
+    //! \return True if the node, one of its inputs or its data have changed since the last generation
+    inline bool IsNodeDirty() const { return mNodeDirty || IsDataDirty(); }
+
+    //! Get the generation of the node data, incremented every time the data is regenerated.
+    //! Dependent nodes compare it with the generation they were built from to know
+    //! if an input has changed, so can any user of the node data
+    //! \return Generation of the node data, 0 if the data has never been generated
+    inline unsigned int GetGeneration() const { return mGeneration; }
+
+    //! Get the number of nodes using the current node as an input
+    //! \return Number of dependent nodes, a node using the current node twice is counted twice
+    inline unsigned int GetNumDependents() const { return mNumDependents; }
+
+    //! Set the table used to share the node data with structurally identical nodes
+    //! \param interner Table of shared node data, nullptr to always generate the data of the node
+    //! \note Only nodes whose data depends exclusively on their class, properties, configuration
+    //!       and inputs can share their data, see \a WriteDataKey()
+    void SetDataInterner(NodeDataInterner * interner);
+
+    //! Get the table used to share the node data with structurally identical nodes
+    //! \return Table of shared node data, nullptr if the node always generates its data
+    inline NodeDataInterner * GetDataInterner() const { return mDataInterner; }
+
+    //! Make the node data transient: the data is allocated from a pool and released as soon as
+    //! every dependent node has been generated from it, then regenerated on demand.
+    //! Intended for the intermediate nodes of operator chains, to reduce the peak memory
+    //! \param transientAllocator Pool allocator for the node data, nullptr to keep the data
+    //!                           and allocate it from the node data allocator
+    //! \note Data already allocated is freed by the allocator it comes from.
+    //!       Data read by an output node, shared or with GPU data is never released
+    void SetTransientDataAllocator(Alloc::IAllocator * transientAllocator);
+
+    //! Test if the node data is transient
+    //! \return True if the node data is released once the dependent nodes have been generated
+    inline bool IsDataTransient() const { return mTransientDataAllocator != nullptr; }
+
+    //! Make sure the CPU copy of the node data is in memory. When it has been discarded
+    //! after the upload of the GPU data, it is regenerated without invalidating the GPU data.
+    //! To be called before reading the content of data obtained with \a GetUpdatedData()
+    //! outside of the graph, such as in the editor
+    //! \return True if the CPU copy has been regenerated
+    virtual bool RestoreCPUData();
+
     //! Return the node data, even if dirty or unallocated
     //! \return Node data, can be nullptr
     //! \warning The data can be missing. Use \a GetUpdatedData() if up-to-date data is required
@@ -161,8 +210,9 @@ protected:
     inline Alloc::IAllocator* GetNodeAllocator() const { return mNodeAllocator; }
 
     //! Get the allocator used for NodeData
-    //! \return Node data allocator
-    inline Alloc::IAllocator* GetNodeDataAllocator() const { return mNodeDataAllocator; }
+    //! \return Node data allocator, or the transient data allocator when the node data is transient
+    inline Alloc::IAllocator* GetNodeDataAllocator() const
+        { return (mTransientDataAllocator != nullptr) ? mTransientDataAllocator : mNodeDataAllocator; }
 
     //! Allocate the data associated with the node
     //! \warning To be redefined by each class defining a new class for its data
@@ -195,12 +245,71 @@ protected:
     //! \return True if the node data is dirty or unallocated
     inline bool IsDataDirty() const { return (mData != nullptr) ? mData->IsDirty() : true; }
 
-    //! Set the dirty flag of the node data if allocated, keep it set when not allocated
+    //! Set the dirty flag of the node data if allocated, keep it set when not allocated,
+    //! and mark every node depending on the current node as dirty
     void InvalidateData();
 
+    //! Called by \a GetUpdatedData() once the node data is up-to-date, clears the dirty flag of the node
+    //! \param generated True if \a GenerateData() has been called, starts a new generation of the data
+    void ValidateNode(bool generated);
+
+    //! Compare the generation of every input with the one used for the last generation of the data,
+    //! and record the current ones
+    //! \note To be called by \a GetUpdatedData() after the data of the inputs has been updated
+    //! \return True if any input has a new generation of data
+    bool UpdateInputGenerations();
+
+    //! Called when a property of the node changes, invalidates the data and the dependent nodes
+    virtual void OnPropertyGridInvalidated();
+
+    //! Append to the key of the node data the state that is not stored in properties or inputs,
+    //! such as the configuration of the node
+    //! \note The default behavior writes nothing and accepts the key
+    //! \param key Key being built by \a BuildDataKey()
+    //! \return False if the data cannot be shared, for example when it is edited by user code
+    virtual bool WriteDataKey(NodeDataKey & key) const;
+
+    //! Build the key describing the content of the node data: class, properties, input data
+    //! and the state written by \a WriteDataKey()
+    //! \param key Empty key receiving the description
+    //! \return True if the data can be shared, meaning a data interner is enabled,
+    //!         every input has interned data and the key is valid
+    bool BuildDataKey(NodeDataKey & key) const;
+
+    //! Look up the key in the data interner and use the shared data if found
+    //! \param key Key built by \a BuildDataKey()
+    //! \return True if the node now uses the shared data, which does not need to be generated
+    bool AdoptInternedData(const NodeDataKey & key);
+
+    //! Share the freshly generated node data through the data interner
+    //! \param key Key built by \a BuildDataKey() before the generation
+    void InternData(const NodeDataKey & key);
+
+    //! Prepare the node data to be regenerated. Shared data is dropped and the node
+    //! generates new data (copy-on-write), otherwise the data is invalidated
+    void DetachOrInvalidateData();
+
     //! Deallocate the data, set the dirty flag of the node data at the same time
     inline void ReleaseData() { mData = nullptr; }
 
+    //! Make sure the CPU copy of the data of every input node is in memory
+    //! \note To be called by \a GetUpdatedData() before generating data reading the input data
+    void RestoreInputCPUData();
+
+    //! Generate the content of the allocated data with \a GenerateData(),
+    //! then let the data complete its content (mip levels of textures for example)
+    //! \note To be called by \a GetUpdatedData() instead of calling \a GenerateData() directly
+    void GenerateAndCompleteData();
+
+    //! Release the transient data of the input nodes whose dependent nodes are all up-to-date
+    //! \note To be called by \a GetUpdatedData() once the node data has been generated
+    void ReleaseTransientInputData();
+
+    //! Test if the node returns the data of its input instead of its own data,
+    //! in which case the data of the input must never be released as transient data
+    //! \return False by default, true for output nodes
+    virtual bool RetainsInputData() const { return false; }
+
 
     //! Maximum number of input nodes
     enum { MAX_NUM_INPUTS = 8 };
@@ -255,6 +364,22 @@ private:
     // Nodes cannot be copied, only references to them
     PG_DISABLE_COPY(Node)
 
+    //! Register a node using the current node as an input
+    //! \param dependent Node the current node has been added to as an input
+    void AddDependent(Node * dependent);
+
+    //! Unregister a node using the current node as an input, once per call
+    //! \param dependent Node the current node has been removed from
+    void RemoveDependent(Node * dependent);
+
+    //! Set the dirty flag of the node and of all its dependent nodes.
+    //! Stops at nodes already dirty, since their dependent nodes are dirty as well
+    void PropagateDirty();
+
+    //! Release the data if it is transient and every dependent node is up-to-date
+    void ReleaseTransientData();
+
+
     //! Allocator used for node internal data (except the attached NodeData)
     Alloc::IAllocator* mNodeAllocator;
 
@@ -267,9 +392,34 @@ private:
     //! Number of used input nodes (0 to MAX_NUM_INPUTS)
     unsigned int mNumInputs;
 
+    //! Generation of each input node data when the node data was last generated
+    unsigned int mInputGenerations[MAX_NUM_INPUTS];
+
+    //! Nodes using the current node as an input (weak pointers, the inputs hold the references)
+    Node ** mDependents;
+
+    //! Number of used dependent node pointers
+    unsigned int mNumDependents;
+
+    //! Number of allocated dependent node pointers
+    unsigned int mDependentsCapacity;
+
+    //! Generation of the node data, incremented every time the data is generated
+    unsigned int mGeneration;
+
+    //! True when a property or an input has changed since the last generation of the data.
+    //! When set, every dependent node has it set as well
+    bool mNodeDirty;
+
     //! Data node, used to store optional intermediate node data
     NodeDataRef mData;
 
+    //! Table of shared node data, nullptr when the node always generates its own data
+    NodeDataInterner * mDataInterner;
+
+    //! Allocator of the transient node data, nullptr when the data is kept
+    Alloc::IAllocator * mTransientDataAllocator;
+
 #if PEGASUS_ENABLE_PROXIES
 
     //! Proxy associated with the node
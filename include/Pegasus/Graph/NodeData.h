@@ -18,12 +18,16 @@
 namespace Pegasus {
 namespace Graph {
 
+class NodeDataResidency;
+
 
 //! Base node data class for all graph-based systems (textures, meshes, shaders, etc.)
 class NodeData
 {
     template<class C> friend class Pegasus::Core::Ref;
     friend class Node;
+    friend class NodeDataInterner;
+    friend class NodeDataResidency;
 
 public:
 
@@ -45,6 +49,10 @@ public:
     //! Set the GPU data as non-dirty
     inline void ValidateGPUData() { mGPUDataDirty = false; }
 
+    //! Set the GPU data as dirty while the CPU data stays valid,
+    //! when the output node changes how the data is uploaded
+    inline void InvalidateGPUData() { mGPUDataDirty = true; }
+
     //! Test if the data is dirty
     //! \return True if the dirty flag is set
     inline bool IsDirty() const { return mDirty; }
@@ -67,6 +75,28 @@ public:
     //! \return External GPU data stored in the node data, can be nullptr if invalid or dirty
     inline const NodeGPUData * GetNodeGPUData () const { return mNodeGPUData; }
 
+    //! Test if the data is shared through a NodeDataInterner.
+    //! Interned data must not be modified, nor its GPU data destroyed by a single user
+    //! \return True if the data belongs to a NodeDataInterner table
+    inline bool IsInterned() const { return mInterned; }
+
+    //! Get the size of the memory used by the content of the data, for statistics
+    //! \return Size in bytes, 0 if unknown
+    virtual unsigned int GetMemorySize() const { return 0; }
+
+    //! Test if the CPU copy of the data is in memory
+    //! \return False if the CPU copy has been discarded, only the GPU data is valid then
+    inline bool IsCPUDataResident() const { return mCPUDataResident; }
+
+    //! Free the CPU copy of the data, typically once the GPU data is valid.
+    //! The dirty flags are not changed, the owner node regenerates the CPU copy when needed
+    //! \return Number of bytes freed, 0 if the data has no CPU copy that can be discarded
+    unsigned int DiscardCPUData();
+
+    //! Allocate the CPU copy of the data again after it has been discarded,
+    //! its content is undefined until the data is regenerated
+    void RestoreCPUData();
+
     //------------------------------------------------------------------------------------
     
 protected:
@@ -75,6 +105,18 @@ protected:
     //! \return Node allocator
     inline Alloc::IAllocator * GetAllocator() const { return mAllocator; }
 
+    //! Free the buffers of the CPU copy of the data
+    //! \note The default behavior keeps the data, to be redefined by data with large buffers
+    //! \return Number of bytes freed, 0 if nothing has been freed
+    virtual unsigned int ReleaseCPUBuffers() { return 0; }
+
+    //! Allocate the buffers of the CPU copy of the data freed by \a ReleaseCPUBuffers()
+    virtual void AllocateCPUBuffers() { }
+
+    //! Complete the content of the data once generated by its node, such as the content derived from the generated one
+    //! \note Called by the node right after GenerateData(), the default behavior does nothing
+    virtual void CompleteGeneration() { }
+
     //------------------------------------------------------------------------------------
     
 private:
@@ -109,6 +151,27 @@ private:
 
     //! True when the GPU data is dirty, meaning it will need to be recomputed to be valid
     bool mGPUDataDirty;
+
+    //! True when the data belongs to a NodeDataInterner table
+    bool mInterned;
+
+    //! Number of NodeDataInterner entries using the data as an input, each holding a reference
+    unsigned int mNumInternedDependents;
+
+    //! False when the CPU copy of the data has been discarded
+    bool mCPUDataResident;
+
+    //! Residency policy the data is registered in, nullptr if not registered
+    NodeDataResidency * mResidency;
+
+    //! Previous node data in the list of the residency policy (more recently used)
+    NodeData * mResidencyPrev;
+
+    //! Next node data in the list of the residency policy (less recently used)
+    NodeData * mResidencyNext;
+
+    //! Size of the CPU copy when the data has been registered in the residency policy
+    unsigned int mResidencyBytes;
 };
 
 //----------------------------------------------------------------------------------------
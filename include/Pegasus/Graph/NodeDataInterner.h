@@ -0,0 +1,260 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NodeDataInterner.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Table sharing one node data between structurally identical nodes (hash consing)
+
+#ifndef PEGASUS_GRAPH_NODEDATAINTERNER_H
+#define PEGASUS_GRAPH_NODEDATAINTERNER_H
+
+#include "Pegasus/Graph/NodeData.h"
+#include "Pegasus/Core/Shared/LogChannel.h"
+
+namespace Pegasus {
+namespace Graph {
+
+
+//! Key describing everything the content of a node data depends on:
+//! class of the node, property values, configuration and input data.
+//! Two nodes with the same key generate the same data
+class NodeDataKey
+{
+public:
+
+    //! Maximum size of a key in bytes, bigger keys are invalid
+    enum { MAX_SIZE = 512 };
+
+    //! Maximum number of input data of a key, same as the maximum number of inputs of a node
+    enum { MAX_INPUTS = 8 };
+
+    //! Constructor, creates a valid empty key
+    NodeDataKey();
+
+    //! Append bytes to the key
+    //! \param data Pointer to the bytes to append
+    //! \param size Number of bytes to append
+    //! \note Invalidates the key if it becomes bigger than MAX_SIZE
+    void Write(const void * data, unsigned int size);
+
+    //! Append a value to the key
+    //! \param value Value to append, must not contain padding bytes
+    template <typename T>
+    inline void WriteValue(const T & value) { Write(&value, sizeof(T)); }
+
+    //! Append a null-terminated string to the key, including the terminator
+    //! \param str String to append
+    void WriteString(const char * str);
+
+    //! Append the data of an input node to the key. The data is identified by its address,
+    //! so the table keeps a reference to it as long as the key is in use
+    //! \param data Interned data of the input node
+    void WriteInput(const NodeData * data);
+
+    //! Mark the key as invalid, the node data described by the key will not be shared
+    inline void Invalidate() { mValid = false; }
+
+    //! Test if the key can be used
+    //! \return False if \a Invalidate() has been called or the key is too big
+    inline bool IsValid() const { return mValid; }
+
+    //! Get the content of the key
+    //! \return Pointer to the bytes of the key
+    inline const unsigned char * GetBytes() const { return mBytes; }
+
+    //! Get the size of the key
+    //! \return Number of bytes of the key
+    inline unsigned int GetSize() const { return mSize; }
+
+    //! Get the hash of the key
+    //! \return FNV-1a hash of the bytes of the key
+    inline unsigned int GetHash() const { return mHash; }
+
+    //! Get the number of input data of the key
+    //! \return Number of calls to \a WriteInput()
+    inline unsigned int GetNumInputs() const { return mNumInputs; }
+
+    //! Get an input data of the key
+    //! \param index Index of the input (< GetNumInputs())
+    //! \return Data of the input node
+    inline const NodeData * GetInput(unsigned int index) const { return mInputs[index]; }
+
+private:
+
+    //! Content of the key
+    unsigned char mBytes[MAX_SIZE];
+
+    //! Number of used bytes in mBytes
+    unsigned int mSize;
+
+    //! Hash of the used bytes, updated on each write
+    unsigned int mHash;
+
+    //! Input data written to the key
+    const NodeData * mInputs[MAX_INPUTS];
+
+    //! Number of used input data in mInputs
+    unsigned int mNumInputs;
+
+    //! False when the key cannot be used
+    bool mValid;
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Table of node data shared between structurally identical nodes.
+//! Before generating its data, a node builds its key and looks it up in the table.
+//! On a hit the node adopts the data of the table instead of generating and uploading its own.
+//! The table holds a reference to every data it contains and to the input data of their keys,
+//! interned data is never modified: a node about to regenerate shared data drops its reference
+//! and generates new data (copy-on-write), while a node that is the only user of its data
+//! takes it back out of the table and reuses it.
+//! Entries only referenced by the table are kept as a cache until \a Purge() is called
+//! or the table is full
+class NodeDataInterner
+{
+public:
+
+    //! Function called when an entry is removed from the table and its data is only referenced by the table,
+    //! typically to destroy the GPU data before the node data is deleted
+    //! \param data Node data about to be released
+    //! \param userData User data given to the constructor
+    typedef void (* ReleaseDataCallback)(NodeData * data, void * userData);
+
+    //! Maximum number of entries of the table
+    enum { MAX_ENTRIES = 1024 };
+
+    //! Statistics of the table
+    struct Statistics
+    {
+        unsigned int mNumEntries;           //!< Number of node data in the table
+        unsigned int mNumSharedEntries;     //!< Number of node data used by more than one node
+        unsigned int mNumUnusedEntries;     //!< Number of node data only referenced by the table
+        unsigned int mNumUsers;             //!< Number of references to the node data, excluding the table
+        unsigned int mNumHits;              //!< Number of lookups that found a node data
+        unsigned int mNumMisses;            //!< Number of lookups that did not
+        unsigned long long mUsedBytes;      //!< Memory used by the node data in the table
+        unsigned long long mSavedBytes;     //!< Memory the users would have used without sharing
+    };
+
+    //! Constructor
+    //! \param allocator Allocator used for the table
+    //! \param releaseCallback Function called before the table releases an unused node data, can be nullptr
+    //! \param userData User data given to the release callback
+    NodeDataInterner(Alloc::IAllocator * allocator, ReleaseDataCallback releaseCallback, void * userData);
+
+    //! Destructor, removes every entry of the table
+    ~NodeDataInterner();
+
+    //! Enable or disable the sharing of node data. When disabled, nodes generate their own data,
+    //! data shared before stays shared until regenerated
+    //! \param enabled True to look up and insert node data
+    inline void SetEnabled(bool enabled) { mEnabled = enabled; }
+
+    //! Test if the sharing of node data is enabled
+    //! \return True if the nodes look up and insert their data
+    inline bool IsEnabled() const { return mEnabled; }
+
+    //! Find the node data of a key
+    //! \param key Key of the node data, must be valid
+    //! \return Node data shared by the nodes with the same key, nullptr if none
+    NodeDataReturn Find(const NodeDataKey & key);
+
+    //! Insert freshly generated node data in the table
+    //! \param key Key of the node data, must be valid and not in the table yet
+    //! \param data Node data generated for the key, must not be dirty
+    //! \note When the table is full, unused entries are purged first,
+    //!       and the data is not inserted if there is still no room
+    void Insert(const NodeDataKey & key, NodeData * data);
+
+    //! Called by a node before modifying its interned data
+    //! \param data Interned node data the node is going to regenerate
+    //! \return True if the data is shared with other users, the node must then drop it and generate new data.
+    //!         False if the node is the only user, the data has been removed from the table and can be modified
+    bool Detach(NodeData * data);
+
+    //! Called by a node dropping its own data to use shared data instead.
+    //! The release callback is called if the node holds the last reference to its data
+    //! \param data Node data about to be dropped, not interned
+    void ReleaseNodeData(NodeData * data);
+
+    //! Release the node data only referenced by the table, including input data
+    //! that were only referenced by released entries
+    void Purge();
+
+    //! Remove every entry of the table. Node data still in use stay with their users
+    void Clear();
+
+    //! Compute the statistics of the table
+    //! \param stats Structure receiving the statistics
+    void GetStatistics(Statistics & stats) const;
+
+    //! Send the statistics of the table to the log
+    //! \param channel Log channel to use
+    //! \param name Name of the table, used as a prefix
+    void LogStatistics(Core::LogChannel channel, const char * name) const;
+
+    //------------------------------------------------------------------------------------
+
+private:
+
+    // The table cannot be copied
+    PG_DISABLE_COPY(NodeDataInterner)
+
+    //! Entry of the table
+    struct Entry
+    {
+        unsigned int mHash;                 //!< Hash of the key
+        unsigned int mKeySize;              //!< Size of the key in bytes
+        unsigned char * mKey;               //!< Copy of the key
+        NodeDataRef mData;                  //!< Interned node data
+        NodeDataRef mInputs[NodeDataKey::MAX_INPUTS];   //!< Input data of the key, kept alive so their address stays unique
+        unsigned int mNumInputs;            //!< Number of input data
+    };
+
+    //! Find the slot of the hash table pointing to an entry
+    //! \param entry Index of the entry
+    //! \return Index of the slot
+    unsigned int FindSlot(unsigned int entry) const;
+
+    //! Remove an entry from the table, the last entry is moved into its place
+    //! \param entry Index of the entry to remove
+    void RemoveEntry(unsigned int entry);
+
+    //! Allocator used for the table
+    Alloc::IAllocator * mAllocator;
+
+    //! Function called before releasing unused node data
+    ReleaseDataCallback mReleaseCallback;
+
+    //! User data given to mReleaseCallback
+    void * mReleaseUserData;
+
+    //! Entries of the table (only the first mNumEntries are valid)
+    Entry * mEntries;
+
+    //! Open addressing hash table of entry indices, -1 for empty slots
+    int * mSlots;
+
+    //! Number of used entries
+    unsigned int mNumEntries;
+
+    //! Number of lookups that found a node data
+    unsigned int mNumHits;
+
+    //! Number of lookups that did not find a node data
+    unsigned int mNumMisses;
+
+    //! True when the nodes look up and insert their data
+    bool mEnabled;
+};
+
+
+}   // namespace Graph
+}   // namespace Pegasus
+
+#endif  // PEGASUS_GRAPH_NODEDATAINTERNER_H
@@ -0,0 +1,150 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NodeDataResidency.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Policy discarding the CPU copy of node data once uploaded to the GPU, within a memory budget
+
+#ifndef PEGASUS_GRAPH_NODEDATARESIDENCY_H
+#define PEGASUS_GRAPH_NODEDATARESIDENCY_H
+
+#include "Pegasus/Graph/NodeData.h"
+#include "Pegasus/Core/Shared/LogChannel.h"
+
+namespace Pegasus {
+namespace Graph {
+
+
+//! Residency policy of the CPU copy of node data with valid GPU data.
+//! Output nodes register their data once the GPU data has been created, the data is then kept
+//! in a least recently used list. When the CPU copies of the registered data exceed the budget,
+//! the least recently used ones are discarded, only the GPU data stays in memory.
+//! A node needing the CPU copy again regenerates it with \a Node::RestoreCPUData(),
+//! without invalidating the GPU data. Shared (interned) data is never discarded.
+//! The lists are intrusive, the links are stored in the node data
+class NodeDataResidency
+{
+public:
+
+    //! Statistics of the policy
+    struct Statistics
+    {
+        unsigned int mNumResident;          //!< Number of registered node data with a CPU copy
+        unsigned long long mResidentBytes;  //!< Memory used by the CPU copies of the registered node data
+        unsigned long long mBudgetBytes;    //!< Maximum memory of the CPU copies of the registered node data
+        unsigned int mNumDiscards;          //!< Number of CPU copies discarded
+        unsigned long long mDiscardedBytes; //!< Memory freed by the discarded CPU copies
+        unsigned int mNumRegenerations;     //!< Number of CPU copies regenerated after being discarded
+    };
+
+    //! Constructor, the policy is disabled and the budget is 0
+    NodeDataResidency();
+
+    //! Destructor, unregisters every node data
+    ~NodeDataResidency();
+
+    //! Enable or disable the policy. When disabled, the CPU copies are kept.
+    //! Disabling the policy unregisters every node data, the discarded CPU copies stay discarded
+    //! \param enabled True to discard the CPU copies over the budget
+    void SetEnabled(bool enabled);
+
+    //! Test if the policy is enabled
+    //! \return True if the CPU copies over the budget are discarded
+    inline bool IsEnabled() const { return mEnabled; }
+
+    //! Set the maximum memory used by the CPU copies of the node data with valid GPU data,
+    //! discards the least recently used CPU copies over the new budget
+    //! \param budgetBytes Budget in bytes, 0 to discard the CPU copies right after the upload
+    void SetBudget(unsigned long long budgetBytes);
+
+    //! Get the maximum memory used by the CPU copies of the node data with valid GPU data
+    //! \return Budget in bytes
+    inline unsigned long long GetBudget() const { return mBudgetBytes; }
+
+    //! Called by an output node once the GPU data of its node data has been created,
+    //! registers the data as the most recently used and applies the budget
+    //! \param data Node data with valid GPU data
+    void OnGPUDataValidated(NodeData * data);
+
+    //! Called when the CPU copy of a node data is read, makes it the most recently used
+    //! \param data Node data being read, does nothing if not registered
+    void Touch(NodeData * data);
+
+    //! Called by a node once the discarded CPU copy of its data has been regenerated,
+    //! registers the data again as the most recently used. The budget is applied
+    //! at the next upload, so the caller can read the regenerated copy
+    //! \param data Node data with a regenerated CPU copy, not registered
+    void OnCPUDataRestored(NodeData * data);
+
+    //! Unregister a node data, called when the data is destroyed or its CPU copy reallocated
+    //! \param data Node data to unregister, does nothing if not registered
+    void Remove(NodeData * data);
+
+    //! Compute the statistics of the policy
+    //! \param stats Structure receiving the statistics
+    void GetStatistics(Statistics & stats) const;
+
+    //! Send the statistics of the policy to the log
+    //! \param channel Log channel to use
+    //! \param name Name of the policy, used as a prefix
+    void LogStatistics(Core::LogChannel channel, const char * name) const;
+
+    //------------------------------------------------------------------------------------
+
+private:
+
+    // The policy cannot be copied
+    PG_DISABLE_COPY(NodeDataResidency)
+
+    //! Doubly linked list of node data, using the links stored in the node data
+    struct List
+    {
+        NodeData * mHead;               //!< Most recently used node data, nullptr if the list is empty
+        NodeData * mTail;               //!< Least recently used node data, nullptr if the list is empty
+        unsigned int mCount;            //!< Number of node data in the list
+        unsigned long long mBytes;      //!< Memory used by the CPU copies of the node data when they were linked
+    };
+
+    //! Insert a node data at the head of a list (most recently used)
+    //! \param list List receiving the node data, mResident or mDiscarded
+    //! \param data Node data to insert, not registered
+    void Link(List & list, NodeData * data);
+
+    //! Remove a node data from its list
+    //! \param data Registered node data
+    void Unlink(NodeData * data);
+
+    //! Discard the CPU copies of the least recently used node data until the budget is respected
+    void ApplyBudget();
+
+    //! Node data with a CPU copy and valid GPU data, from the most to the least recently used
+    List mResident;
+
+    //! Node data whose CPU copy has been discarded, kept to count their regenerations
+    List mDiscarded;
+
+    //! Maximum memory of the CPU copies of the registered node data
+    unsigned long long mBudgetBytes;
+
+    //! Number of CPU copies discarded
+    unsigned int mNumDiscards;
+
+    //! Memory freed by the discarded CPU copies
+    unsigned long long mDiscardedBytes;
+
+    //! Number of CPU copies regenerated after being discarded
+    unsigned int mNumRegenerations;
+
+    //! True when the CPU copies over the budget are discarded
+    bool mEnabled;
+};
+
+
+}   // namespace Graph
+}   // namespace Pegasus
+
+#endif  // PEGASUS_GRAPH_NODEDATARESIDENCY_H
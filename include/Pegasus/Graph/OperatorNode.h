@@ -52,8 +52,9 @@ public:
     //!       In that case, this Update() should be called first, then the dirty flag
     //!       can be ORed with the content of the override before returning it.
     //! \note This class implements the default behavior of an operator:
-    //!       if any input is dirty, invalidate the node data and return true,
-    //!       otherwise return the dirty state of the data
+    //!       return the dirty state of the node. Input nodes are not visited,
+    //!       since property and input changes anywhere in the input graph
+    //!       are pushed to the node when they happen
     //! \warning If this base class function is called in a derived class,
     //!       it must be called at the end, after updating the internal state
     //!       and invalidating the node data
@@ -62,8 +63,9 @@ public:
 
     //! Return the node up-to-date data.
     //! \note Defines the standard behavior of all operator nodes.
-    //!       Calls GetUpdatedData() on all inputs, and if any of them was dirty,
-    //!       then calls GenerateData() to update the node data.
+    //!       If the node is not dirty, returns the data without visiting the inputs.
+    //!       Otherwise calls GetUpdatedData() on all inputs, and if any of them has a new
+    //!       generation of data, then calls GenerateData() to update the node data.
     //!       It should be overridden only for special cases.
     //! \param updated Set to true if the node or any of its input nodes has had the data recomputed
     //!                (output parameter, set to false only by the caller)
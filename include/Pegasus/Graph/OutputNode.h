@@ -66,6 +66,10 @@ public:
     //!         (throws an assertion error in that case)
     virtual NodeDataReturn GetUpdatedData();
 
+    //! Make sure the CPU copy of the data of the input node is in memory
+    //! \return True if the CPU copy has been regenerated
+    virtual bool RestoreCPUData() override;
+
     //------------------------------------------------------------------------------------
 
     //! callback to implement reading / parsing an asset
@@ -113,6 +117,10 @@ protected:
     //! \param index Index of the node before it is removed
     virtual void OnRemoveInput(unsigned int index);
 
+    //! Output nodes return the data of their input, which must then never be released as transient data
+    //! \return True
+    virtual bool RetainsInputData() const { return true; }
+
 #if PEGASUS_ENABLE_PROXIES
     //! Returns the display name of this runtime object
     //! \return string representing the display name of this object
@@ -0,0 +1,108 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Half.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Conversions between 32 bits and 16 bits (half precision) floating point numbers
+
+#ifndef PEGASUS_MATH_HALF_H
+#define PEGASUS_MATH_HALF_H
+
+#include "Pegasus/Math/Types.h"
+
+namespace Pegasus {
+namespace Math {
+
+
+//! 16 bits floating point number (1 sign bit, 5 exponent bits, 10 mantissa bits), stored as its bits
+typedef PUInt16 PFloat16;
+
+//----------------------------------------------------------------------------------------
+
+//! Convert a 32 bits floating point number to 16 bits, rounding to the nearest value
+//! \param value Value to convert
+//! \return Half precision value, infinity when too large, a signed zero when too small
+inline PFloat16 FloatToHalf(PFloat32 value)
+{
+    union { PFloat32 f; unsigned int u; } bits;
+    bits.f = value;
+
+    const unsigned int sign = (bits.u >> 16) & 0x8000;
+    const int exponent = static_cast<int>((bits.u >> 23) & 0xFF) - 127 + 15;
+    unsigned int mantissa = bits.u & 0x007FFFFF;
+
+    if (((bits.u >> 23) & 0xFF) == 0xFF)
+    {
+        // Infinity or NaN
+        return static_cast<PFloat16>(sign | 0x7C00 | ((mantissa != 0) ? 0x0200 : 0));
+    }
+    if (exponent >= 31)
+    {
+        // Overflow
+        return static_cast<PFloat16>(sign | 0x7C00);
+    }
+    if (exponent <= 0)
+    {
+        // Denormalized half, or zero when too small
+        if (exponent < -10)
+        {
+            return static_cast<PFloat16>(sign);
+        }
+        mantissa |= 0x00800000;
+        const unsigned int shift = static_cast<unsigned int>(14 - exponent);
+        unsigned int half = mantissa >> shift;
+        if ((mantissa >> (shift - 1)) & 1)
+        {
+            ++half;
+        }
+        return static_cast<PFloat16>(sign | half);
+    }
+
+    // Normalized half, a carry of the rounding correctly increments the exponent
+    unsigned int half = (static_cast<unsigned int>(exponent) << 10) | (mantissa >> 13);
+    if (mantissa & 0x00001000)
+    {
+        ++half;
+    }
+    return static_cast<PFloat16>(sign | half);
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Convert a 16 bits floating point number to 32 bits (exact conversion)
+//! \param value Half precision value to convert
+//! \return 32 bits floating point value
+inline PFloat32 HalfToFloat(PFloat16 value)
+{
+    const unsigned int sign = static_cast<unsigned int>(value & 0x8000) << 16;
+    const unsigned int exponent = (value >> 10) & 0x1F;
+    const unsigned int mantissa = value & 0x03FF;
+
+    union { PFloat32 f; unsigned int u; } bits;
+    if (exponent == 0)
+    {
+        // Zero or denormalized half, mantissa * 2^-24
+        bits.f = static_cast<PFloat32>(mantissa) * (1.0f / 16777216.0f);
+        bits.u |= sign;
+    }
+    else if (exponent == 31)
+    {
+        // Infinity or NaN
+        bits.u = sign | 0x7F800000 | (mantissa << 13);
+    }
+    else
+    {
+        bits.u = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+    }
+    return bits.f;
+}
+
+
+}   // namespace Math
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MATH_HALF_H
@@ -14,6 +14,7 @@
 
 #include "Pegasus/Math/Ray.h"
 #include "Pegasus/Math/Plane.h"
+#include "Pegasus/Math/AxisAlignedBoundingBox.h"
 
 namespace Pegasus {
 namespace Math {
@@ -30,6 +31,12 @@ namespace Math {
 //! \return true if the ray and the plane intersect
 bool AreIntersecting(RayIn ray, PlaneIn plane);
 
+//! Test the intersection between a ray and an axis-aligned bounding box
+//! \param ray Input ray
+//! \param box Input bounding box
+//! \return true if the ray enters the box, or starts inside it
+bool AreIntersecting(RayIn ray, const AxisAlignedBoundingBox & box);
+
 //----------------------------------------------------------------------------------------
 
 // Functions that give the intersection point between geometric primitives
@@ -49,6 +56,25 @@ Point3Return GetIntersection(RayIn ray, PlaneIn plane);
 inline void GetIntersection(Point3InOut result, RayIn ray, PlaneIn plane)
     {   result = GetIntersection(ray, plane);   }
 
+//! Get the distance along a ray to an axis-aligned bounding box (slab test)
+//! \param ray Input ray
+//! \param box Input bounding box
+//! \param distance Distance from the ray origin to the entry point, 0 if the origin is inside the box (output)
+//! \return true if the ray enters the box, or starts inside it
+bool GetIntersectionDistance(RayIn ray, const AxisAlignedBoundingBox & box, PFloat32 & distance);
+
+//! Get the distance along a ray to a triangle (Moller-Trumbore test, both faces are hit)
+//! \param ray Input ray
+//! \param p0 First corner of the triangle
+//! \param p1 Second corner of the triangle
+//! \param p2 Third corner of the triangle
+//! \param distance Distance from the ray origin to the intersection point (output)
+//! \param u Barycentric coordinate of the intersection point along p1 - p0 (output)
+//! \param v Barycentric coordinate of the intersection point along p2 - p0 (output)
+//! \return true if the ray hits the triangle in front of its origin
+bool GetIntersectionDistance(RayIn ray, Point3In p0, Point3In p1, Point3In p2,
+                             PFloat32 & distance, PFloat32 & u, PFloat32 & v);
+
 //----------------------------------------------------------------------------------------
 
 //! Value considered as zero for intersection processing
@@ -0,0 +1,155 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   FrameAllocator.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  FrameAllocator, linear allocator for transient data, reset every frame.
+
+#ifndef PEGASUS_FRAME_ALLOCATOR_H
+#define PEGASUS_FRAME_ALLOCATOR_H
+
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Core/Atomic.h"
+
+namespace Pegasus
+{
+
+namespace Memory
+{
+
+//! Linear (bump) allocator for transient data. Each thread owns its own instance (see Memory::GetFrameAllocator()),
+//! so no locking is required. Memory is double buffered: an allocation made during frame N stays valid
+//! until the end of frame N + 1, so data produced during a frame can be consumed during the next one.
+//! Individual deletions are ignored, the memory of a frame is released all at once when it gets recycled.
+//! In debug builds, recycled memory is filled with a pattern and each allocation is stamped with its frame,
+//! so a pointer kept alive for too long can be detected with ValidatePointer().
+class FrameAllocator : public Alloc::IAllocator
+{
+public:
+
+    //! Constructor
+    //! \param pageAllocator allocator used to create the pages of memory the allocations are carved from
+    //! \param pageSize size in bytes of each page. Bigger allocations get a dedicated page.
+    FrameAllocator(Alloc::IAllocator* pageAllocator, int pageSize = DEFAULT_PAGE_SIZE);
+
+    //! Destructor, frees all the pages
+    virtual ~FrameAllocator();
+
+    //! Allocate a block of memory, valid until the end of the next frame
+    //! \param Size of the allocation, in bytes.
+    //! \param flags Allocation flags.
+    //! \param category Allocation category.
+    //! \param debugText Debug name for this allocation.
+    //! \param file File that made this allocation.
+    //! \param line Line number of this allocation.
+    //! \return Allocated memory, 16 bytes aligned.
+    virtual void* Alloc(
+            size_t size,
+            Alloc::Flags flags,
+            Alloc::Category category = -1,
+            const char* debugText = nullptr,
+            const char* file = nullptr,
+            unsigned int line = 0
+    );
+
+    //! Allocate a block of memory, aligned, valid until the end of the next frame
+    //! \param Size of the allocation, in bytes.
+    //! \param align Allocation alignment, in bytes (power of 2).
+    //! \param flags Allocation flags.
+    //! \param category Allocation category.
+    //! \param debugText Debug name for this allocation.
+    //! \param file File that made this allocation.
+    //! \param line Line number of this allocation.
+    //! \return Allocated memory.
+    virtual void* AllocAlign(
+        size_t size,
+        Alloc::Alignment align,
+        Alloc::Flags flags,
+        Alloc::Category category = -1,
+        const char* debugText = nullptr,
+        const char* file = nullptr,
+        unsigned int line = 0
+    );
+
+    //! Does nothing, memory is recycled when the frame of the allocation expires.
+    //! In debug builds, asserts if the pointer has already expired.
+    //! \param ptr Address of the memory.
+    virtual void Delete(void* ptr);
+
+    //! Asserts if a pointer does not belong to the current or previous frame of this allocator.
+    //! Does nothing outside of debug builds.
+    //! \param ptr pointer returned by Alloc or AllocAlign
+    void ValidatePointer(const void* ptr) const;
+
+    //! \return number of bytes allocated during the current frame (including alignment padding)
+    size_t GetFrameUsage() const;
+
+    //! \return maximum number of bytes allocated during a single frame since the creation of this allocator
+    size_t GetHighWaterMark() const { return mHighWaterMark; }
+
+    //! \return total number of bytes owned by this allocator in pages
+    size_t GetReservedSize() const { return mReservedSize; }
+
+    //! Ends the current frame for all the threads. Allocations of the frame before the current one expire.
+    //! Each thread recycles its memory lazily, on its next allocation.
+    //! \note Call from the main thread only, once per frame (done by Application::Update())
+    static void AdvanceFrame();
+
+    //! \return index of the current frame
+    static unsigned int GetFrameIndex() { return static_cast<unsigned int>(Core::AtomicLoad(&sFrameIndex)); }
+
+    //! \return maximum number of bytes allocated during a single frame by any thread
+    static size_t GetGlobalHighWaterMark() { return static_cast<size_t>(Core::AtomicLoad(&sGlobalHighWaterMark)); }
+
+    //! Default size of a page of memory
+    static const int DEFAULT_PAGE_SIZE = 256 * 1024;
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(FrameAllocator);
+
+    //! Page of memory, the allocations follow the header
+    struct Page
+    {
+        Page*  mNext; //!< Next page in the arena
+        size_t mSize; //!< Usable size of the page
+        size_t mUsed; //!< Bytes allocated in the page
+    };
+
+    //! Set of pages holding the allocations of one frame
+    struct Arena
+    {
+        Page*  mFirstPage;   //!< First page of the list
+        Page*  mCurrentPage; //!< Page allocations are currently carved from
+        size_t mUsage;       //!< Bytes allocated during the frame
+        unsigned int mFrameIndex; //!< Frame the allocations belong to
+    };
+
+    //! Recycles the arenas that expired since the last allocation of this thread
+    void SyncFrame();
+
+    //! Makes all the pages of an arena available again
+    //! \param arena the arena to recycle
+    void RecycleArena(Arena& arena);
+
+    Alloc::IAllocator* mPageAllocator;
+    int    mPageSize;
+    Arena  mArenas[2];
+    int    mCurrentArena;
+    unsigned int mFrameIndex;
+    size_t mHighWaterMark;
+    size_t mReservedSize;
+
+    static Core::AtomicInt sFrameIndex;
+    static Core::AtomicInt sGlobalHighWaterMark;
+};
+
+
+}
+}
+
+#endif
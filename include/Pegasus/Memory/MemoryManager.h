@@ -14,9 +14,17 @@
 
 #include "Pegasus/Allocator/IAllocator.h"
 
+namespace Pegasus {
+    namespace Utils {
+        class ByteStream;
+    }
+}
+
 namespace Pegasus {
 namespace Memory {
 
+class FrameAllocator;
+class PoolAllocator;
 
 //! Get the global allocator
 //! \return Global allocator, for the global heap
@@ -38,6 +46,11 @@ Alloc::IAllocator* GetNodeAllocator();
 //! \return Node data allocator
 Alloc::IAllocator* GetNodeDataAllocator();
 
+//! Get the pool allocator for transient node data, reusing the buffers of the node data released
+//! once their dependent nodes have been generated. The buffers are taken from the node data heap
+//! \return Transient node data allocator
+PoolAllocator* GetTransientNodeDataAllocator();
+
 //! Get the allocator for the pointers to properties inside property grid objects
 //! \return Node data allocator
 Alloc::IAllocator* GetPropertyPointerAllocator();
@@ -50,6 +63,24 @@ Alloc::IAllocator* GetTimelineAllocator();
 //! \return Window allocator
 Alloc::IAllocator* GetWindowAllocator();
 
+//! Get the frame allocator of the calling thread, for transient data.
+//! Allocations are valid until the end of the frame following the one they were made in,
+//! frames are advanced by Application::Update(). Deleting allocations is optional.
+//! \return Frame allocator of the calling thread
+FrameAllocator* GetFrameAllocator();
+
+//! Sends the statistics of all the heaps to the log (requires PEGASUS_ENABLE_MEMORY_TRACKING, does nothing otherwise)
+void LogMemoryReport();
+
+//! Sends the allocations still alive in all the heaps to the log (requires PEGASUS_ENABLE_MEMORY_TRACKING)
+//! \return Number of allocations still alive, 0 when tracking is disabled.
+long long LogMemoryLeaks();
+
+//! Appends the statistics of all the heaps as a JSON document to a stream,
+//! with an empty list of allocators when PEGASUS_ENABLE_MEMORY_TRACKING is disabled
+//! \param stream Stream receiving the JSON text (not null terminated).
+void WriteMemoryReportJson(Utils::ByteStream& stream);
+
 
 }   // namespace Memory
 }   // namespace Pegasus
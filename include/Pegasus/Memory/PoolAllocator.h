@@ -0,0 +1,121 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   PoolAllocator.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Allocator keeping freed buffers in size buckets to reuse them for later allocations.
+
+#ifndef PEGASUS_MEMORY_POOLALLOCATOR_H
+#define PEGASUS_MEMORY_POOLALLOCATOR_H
+
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Core/Atomic.h"
+
+namespace Pegasus {
+namespace Memory {
+
+//! Allocator decorator rounding the allocations up to a size class and keeping the freed buffers
+//! in one free list per size class. An allocation reuses a freed buffer of the same class when there is one,
+//! so buffers with lifetimes that do not overlap share the same memory.
+//! Size classes are powers of 2 split in 4 steps, wasting at most 25% of the requested size.
+//! Freed buffers are only returned to the decorated allocator by \a Trim() and by the destructor.
+//! Allocations bigger than the largest size class are forwarded without pooling.
+//! The allocator is thread safe as long as the decorated allocator is.
+class PoolAllocator : public Alloc::IAllocator
+{
+public:
+
+    //! Counters of the pool, in bytes of buffer capacity (headers excluded)
+    struct Stats
+    {
+        unsigned long long mUsedBytes;          //!< Capacity of the buffers currently allocated
+        unsigned long long mPeakUsedBytes;      //!< Maximum value reached by mUsedBytes
+        unsigned long long mCachedBytes;        //!< Capacity of the freed buffers kept for reuse
+        unsigned long long mPeakReservedBytes;  //!< Maximum value reached by mUsedBytes + mCachedBytes, memory taken from the decorated allocator
+        unsigned int mNumAllocs;                //!< Number of allocations
+        unsigned int mNumReuses;                //!< Number of allocations served by a freed buffer
+    };
+
+    //! Smallest size class is 1 << MIN_CLASS_SHIFT bytes
+    static const unsigned int MIN_CLASS_SHIFT = 8;
+
+    //! Largest size class is 1 << (MAX_CLASS_SHIFT + 1) bytes
+    static const unsigned int MAX_CLASS_SHIFT = 30;
+
+    //! Number of size classes between two powers of 2
+    static const unsigned int CLASSES_PER_POWER = 4;
+
+    //! Number of size classes, including the smallest one
+    static const unsigned int NUM_CLASSES = 1 + (MAX_CLASS_SHIFT - MIN_CLASS_SHIFT + 1) * CLASSES_PER_POWER;
+
+    //! Maximum alignment of the allocations
+    static const Alloc::Alignment MAX_ALIGNMENT = 16;
+
+    //! Constructor
+    //! \param allocator Allocator providing the buffers.
+    PoolAllocator(Alloc::IAllocator* allocator);
+
+    //! Destructor, releases the freed buffers. Buffers still allocated are leaked
+    virtual ~PoolAllocator();
+
+    // IAllocator interface
+    virtual void* Alloc(size_t size, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line);
+    virtual void* AllocAlign(size_t size, Alloc::Alignment align, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line);
+    virtual void Delete(void* ptr);
+
+    //! \return Decorated allocator
+    Alloc::IAllocator* GetInternalAlloc() const { return mAllocator; }
+
+    //! Returns the freed buffers to the decorated allocator
+    void Trim();
+
+    //! \return Current counters of the pool
+    Stats GetStats() const;
+
+    //! Sets the peaks to the current values, to measure the peaks of a new period
+    void ResetPeaks();
+
+    //! Sends the counters of the pool to the log
+    //! \param name Name of the pool, used as a prefix.
+    void LogStats(const char* name) const;
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(PoolAllocator);
+
+    //! Freed buffer, linked in the free list of its size class
+    struct FreeBuffer
+    {
+        FreeBuffer* mNext;  //!< Next freed buffer of the same size class, nullptr for the last one
+    };
+
+    //! Finds the size class of an allocation
+    //! \param size Requested size in bytes.
+    //! \param outCapacity Capacity of the size class.
+    //! \return Index of the size class, NUM_CLASSES if the allocation is too big to be pooled.
+    static unsigned int GetSizeClass(size_t size, size_t& outCapacity);
+
+    //! Updates the peaks after a change of the counters, lock must be held
+    void UpdatePeaks();
+
+    //! Acquire the internal lock
+    void Lock() const;
+
+    //! Release the internal lock
+    void Unlock() const;
+
+    Alloc::IAllocator* mAllocator;
+    mutable Core::AtomicInt mLock;
+    FreeBuffer* mFreeLists[NUM_CLASSES];
+    Stats mStats;
+};
+
+
+}   // namespace Memory
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MEMORY_POOLALLOCATOR_H
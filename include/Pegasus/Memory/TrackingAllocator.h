@@ -0,0 +1,156 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TrackingAllocator.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Allocator decorator recording memory statistics per category and per call site.
+
+#ifndef PEGASUS_MEMORY_TRACKINGALLOCATOR_H
+#define PEGASUS_MEMORY_TRACKINGALLOCATOR_H
+
+#include "Pegasus/Allocator/IAllocator.h"
+#include "Pegasus/Core/Atomic.h"
+
+namespace Pegasus {
+    namespace Utils {
+        class ByteStream;
+    }
+}
+
+namespace Pegasus {
+namespace Memory {
+
+//! Allocator decorator, forwarding all the allocations to another allocator while recording
+//! live bytes, allocation counts and peaks. Statistics are kept per category for every allocation,
+//! and per call site (__FILE__, __LINE__) for a sample of the allocations (1 out of the sample rate),
+//! scaled back up so the reported call site values are estimates of the real ones.
+//! Each allocation is prefixed with a small header, so the decorated allocator must not be
+//! used directly to free memory returned by this one.
+//! The decorator is thread safe as long as the decorated allocator is.
+class TrackingAllocator : public Alloc::IAllocator
+{
+public:
+
+    //! Counters for a group of allocations
+    struct Stats
+    {
+        long long mLiveBytes;   //!< Bytes currently allocated
+        long long mLiveCount;   //!< Number of allocations currently alive
+        long long mPeakBytes;   //!< Maximum value reached by mLiveBytes
+        long long mTotalBytes;  //!< Bytes allocated since the creation of the allocator
+        long long mTotalCount;  //!< Number of allocations since the creation of the allocator
+    };
+
+    //! Statistics of one call site
+    struct SiteStats
+    {
+        const char* mFile;      //!< File of the call site, nullptr for an empty slot
+        unsigned int mLine;     //!< Line of the call site
+        const char* mDebugText; //!< Debug text of the first allocation recorded for this call site
+        Alloc::Category mCategory; //!< Category of the first allocation recorded for this call site
+        Stats mStats;           //!< Estimated counters of the call site
+    };
+
+    //! Maximum number of categories tracked separately. Category -1 is tracked, bigger categories are merged in the last one.
+    static const int MAX_CATEGORIES = 32;
+
+    //! Maximum number of call sites tracked. Further call sites are merged in a single "unknown" site.
+    static const int MAX_SITES = 4096;
+
+    //! Copy of the statistics at a point in time. Can also hold the difference between two snapshots.
+    struct Snapshot
+    {
+        Stats mTotal;                        //!< Counters of all the allocations
+        Stats mCategories[MAX_CATEGORIES];   //!< Counters per category, index is category + 1
+        SiteStats mSites[MAX_SITES];         //!< Call site counters, same slots as the allocator table
+    };
+
+    //! Constructor
+    //! \param name Name of the allocator, used in the reports.
+    //! \param allocator Allocator performing the actual allocations.
+    //! \param sampleRate One out of sampleRate allocations gets its call site recorded. 1 records all of them.
+    TrackingAllocator(const char* name, Alloc::IAllocator* allocator, unsigned int sampleRate = DEFAULT_SAMPLE_RATE);
+
+    //! Destructor
+    virtual ~TrackingAllocator();
+
+    // IAllocator interface
+    virtual void* Alloc(size_t size, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line);
+    virtual void* AllocAlign(size_t size, Alloc::Alignment align, Alloc::Flags flags, Alloc::Category category, const char* debugText, const char* file, unsigned int line);
+    virtual void Delete(void* ptr);
+
+    //! \return Name of this allocator
+    const char* GetName() const { return mName; }
+
+    //! \return Decorated allocator
+    Alloc::IAllocator* GetInternalAlloc() const { return mAllocator; }
+
+    //! \return Counters of all the allocations
+    Stats GetTotalStats() const;
+
+    //! \return Call site sample rate
+    unsigned int GetSampleRate() const { return mSampleRate; }
+
+    //! Copies the current statistics
+    //! \param outSnapshot Snapshot receiving the statistics.
+    void TakeSnapshot(Snapshot& outSnapshot) const;
+
+    //! Computes the difference between two snapshots of the same allocator (after - before).
+    //! Live counters of the result are signed growths, peaks are the peaks of the after snapshot.
+    //! \param before Snapshot taken first.
+    //! \param after Snapshot taken second.
+    //! \param outDiff Snapshot receiving the difference, can alias after.
+    static void DiffSnapshots(const Snapshot& before, const Snapshot& after, Snapshot& outDiff);
+
+    //! Appends the statistics of a snapshot as a JSON object to a stream
+    //! \param snapshot Statistics to write, usually from TakeSnapshot() or DiffSnapshots().
+    //! \param stream Stream receiving the JSON text (not null terminated).
+    void WriteJson(const Snapshot& snapshot, Utils::ByteStream& stream) const;
+
+    //! Sends the current statistics to the log, call sites sorted by live bytes
+    //! \param maxSites Maximum number of call sites to print.
+    void LogReport(unsigned int maxSites = 16) const;
+
+    //! Sends the call sites with allocations still alive to the log
+    //! \return Number of allocations still alive.
+    long long LogLeaks() const;
+
+    //! Default call site sample rate
+    static const unsigned int DEFAULT_SAMPLE_RATE = 1;
+
+private:
+    // No copies allowed
+    PG_DISABLE_COPY(TrackingAllocator);
+
+    //! Records an allocation
+    //! \return slot of the call site, -1 if the allocation was not sampled.
+    int RecordAlloc(size_t size, Alloc::Category category, const char* debugText, const char* file, unsigned int line, int& outCategorySlot);
+
+    //! Finds or creates the slot of a call site, lock must be held
+    int FindSite(const char* file, unsigned int line, const char* debugText, Alloc::Category category);
+
+    //! Acquire the internal lock
+    void Lock() const;
+
+    //! Release the internal lock
+    void Unlock() const;
+
+    const char* mName;
+    Alloc::IAllocator* mAllocator;
+    unsigned int mSampleRate;
+    unsigned int mSampleCounter;
+    mutable Core::AtomicInt mLock;
+    Stats mTotal;
+    Stats mCategories[MAX_CATEGORIES];
+    SiteStats* mSites;
+};
+
+
+}   // namespace Memory
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MEMORY_TRACKINGALLOCATOR_H
@@ -40,6 +40,10 @@ protected:
 
     //! Generate the content of the data associated with the texture generator
     virtual void GenerateData();
+
+    //! The data is edited through \a EditMeshData(), so it is never shared with other nodes
+    //! \return False
+    virtual bool WriteDataKey(Graph::NodeDataKey & key) const;
 };
 }
 
@@ -13,13 +13,15 @@
 #define PEGASUS_ICOSPHERE_GENERATOR_H
 
 #include "Pegasus/Mesh/MeshGenerator.h"
-#include "Pegasus/Utils/TesselationTable.h"
 
 namespace Pegasus
 {
 namespace Mesh
 {
 
+//! Maximum degree of an icosphere, the vertex count of the next degree exceeding 16 bits indices
+const int ICOSPHERE_MAX_DEGREE = 7;
+
 class IcosphereGenerator : public MeshGenerator
 {
     DECLARE_MESH_GENERATOR_NODE(IcosphereGenerator)
@@ -47,7 +49,7 @@ protected:
     virtual void GenerateData();
 
     //! generates the midpoint between two vertices (passed by index). Caches the index
-    //! and returns the cached one if is generated.
+    //! in the edge hash and returns the cached one if is generated.
     //! \param p1 the first parent
     //! \param p2 the second parent
     //! \return the new child index
@@ -56,7 +58,21 @@ protected:
     //! recursive function that tesselates the icosphere
     void Tesselate(MeshData * meshData, int level, unsigned short a, unsigned short b, unsigned short c);
 
-    Utils::TesselationTable mIdxCache;
+    //! entry of the edge hash, the midpoint generated on an edge
+    struct EdgeEntry
+    {
+        unsigned int mEdge; //! both parents, the smallest index in the upper 16 bits
+        unsigned short mMidpoint; //! index of the midpoint
+    };
+
+    //! open addressing hash of the subdivided edges, shared by the triangles on both sides,
+    //! sized for the edge count of the degree during the generation only
+    EdgeEntry * mEdgeHash;
+    unsigned int mEdgeHashMask;
+
+    //! count of vertices and indices written so far, the buffers being allocated once
+    int mVertexCount;
+    int mIndexCount;
        
 };
 
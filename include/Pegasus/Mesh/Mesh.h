@@ -16,6 +16,7 @@
 #include "Pegasus/Graph/OutputNode.h"
 #include "Pegasus/Mesh/MeshConfiguration.h"
 #include "Pegasus/Mesh/MeshData.h"
+#include "Pegasus/Mesh/MeshBvh.h"
 #include "Pegasus/Mesh/MeshGenerator.h"
 #include "Pegasus/Mesh/MeshOperator.h"
 #include "Pegasus/Mesh/Proxy/MeshNodeProxy.h"
@@ -24,6 +25,7 @@
 namespace Pegasus {
 namespace Graph {
     class NodeManager;
+    class NodeDataResidency;
 }
 }
 
@@ -57,6 +59,10 @@ public:
     //! Sets the GPU factory for the mesh
     void SetFactory(IMeshFactory * factory) { mFactory = factory; }
 
+    //! Set the policy discarding the CPU copy of the mesh data once the GPU data is created
+    //! \param residency Residency policy, nullptr to always keep the CPU copy
+    void SetDataResidency(Graph::NodeDataResidency * residency) { mDataResidency = residency; }
+
     //! Set the input of the mesh output node to a generator node
     //! \warning If an input was already set (generator or operator), it is replaced
     //! \note If the generator is incompatible with the current node,
@@ -79,6 +85,32 @@ public:
     //!       if any part of the graph is dirty
     virtual MeshDataReturn GetUpdatedMeshData();
 
+    //! Select the level of detail to draw, the coarsest one whose error covers at most a number of pixels
+    //! \param distance Distance between the camera and the mesh
+    //! \param projectionScale Height of the viewport in pixels divided by 2 tan(fovY / 2)
+    //! \param maxPixelError Error allowed on screen, in pixels
+    //! \return Level of detail, to give to Render::SetMeshLod(), 0 when the mesh has no levels of detail
+    int SelectLod(float distance, float projectionScale, float maxPixelError);
+
+    //! Get the decoding of the quantized positions of a compact mesh, position = offset + quantized * scale
+    //! \param offset Minimum of the bounds of the positions, (0, 0, 0) for float positions (output)
+    //! \param scale Size of the bounds of the positions, (1, 1, 1) for float positions (output)
+    void GetPositionDecode(Math::Vec3 & offset, Math::Vec3 & scale);
+
+    //! Get the bounds of the positions of the mesh, for culling
+    //! \param box Bounding box, of zero size for an empty mesh (output)
+    //! \param sphere Bounding sphere (output)
+    void GetBounds(Math::AxisAlignedBoundingBox & box, Math::BoundingSphere & sphere);
+
+    //! Find the closest triangle of the most detailed level hit by a ray, in the space of the mesh,
+    //! for picking and script raycasts. The bounding volume hierarchy is built at the first query
+    //! after each generation, regenerating the discarded CPU copy if needed
+    //! \param ray Ray to test
+    //! \param maxDistance Maximum distance of the hit from the ray origin
+    //! \param hit Closest hit, unchanged when nothing is hit (output)
+    //! \return True if a triangle is hit
+    bool Raycast(const Math::Ray & ray, float maxDistance, MeshRayHit & hit);
+
 
     //! Releases the node internal data
     virtual void ReleaseDataAndPropagate();
@@ -136,6 +168,9 @@ private:
     //! Pointer to GPU Mesh factory
     IMeshFactory * mFactory;
 
+    //! Policy discarding the CPU copy of the mesh data after the upload, nullptr to keep it
+    Graph::NodeDataResidency * mDataResidency;
+
 };
 
 //----------------------------------------------------------------------------------------
@@ -0,0 +1,154 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshBvh.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Bounding volume hierarchy over the triangles of a mesh, for ray queries
+
+#ifndef PEGASUS_MESH_MESHBVH_H
+#define PEGASUS_MESH_MESHBVH_H
+
+#include "Pegasus/Math/Ray.h"
+
+namespace Pegasus {
+    namespace Alloc {
+        class IAllocator;
+    }
+}
+
+namespace Pegasus {
+namespace Mesh {
+
+
+//! Result of a ray query on a mesh
+struct MeshRayHit
+{
+    float mDistance;            //!< Distance from the ray origin to the hit point
+    unsigned int mTriangle;     //!< Index of the hit triangle (first index of the triangle / 3)
+    float mU;                   //!< Barycentric coordinate of the hit point along the second corner
+    float mV;                   //!< Barycentric coordinate of the hit point along the third corner
+};
+
+//! Bounding volume hierarchy over the triangles of a mesh.
+//! A binary tree is built with the surface area heuristic (binned), then collapsed into
+//! a flattened 4-wide tree: each node stores the boxes of its 4 children as SoA lanes,
+//! and each leaf is a packet of at most 4 triangles, so a ray is tested against
+//! 4 boxes or 4 triangles at once (SSE2 when available)
+class MeshBvh
+{
+public:
+
+    //! Constructor, the hierarchy is empty
+    //! \param allocator Allocator used for the nodes and the triangle packets
+    MeshBvh(Alloc::IAllocator * allocator);
+
+    //! Destructor
+    ~MeshBvh();
+
+    //! Build the hierarchy, replacing the previous one
+    //! \param positions Positions of the vertices
+    //! \param numVertices Number of vertices
+    //! \param indices Vertex indices of the triangles, nullptr to use the vertices 3 by 3
+    //! \param numTriangles Number of triangles
+    void Build(const Math::Vec3 * positions,
+               unsigned int numVertices,
+               const unsigned short * indices,
+               unsigned int numTriangles);
+
+    //! Destroy the hierarchy
+    void Clear();
+
+    //! Find the closest triangle hit by a ray, on both faces
+    //! \param ray Ray to test
+    //! \param maxDistance Maximum distance of the hit from the ray origin
+    //! \param hit Closest hit, unchanged when nothing is hit (output)
+    //! \return True if a triangle is hit
+    bool Raycast(const Math::Ray & ray, float maxDistance, MeshRayHit & hit) const;
+
+    //! Get the number of triangles of the hierarchy
+    //! \return Number of triangles given to \a Build()
+    inline unsigned int GetTriangleCount() const { return mNumTriangles; }
+
+    //! Get the number of 4-wide nodes of the hierarchy
+    //! \return Number of nodes, 0 when empty
+    inline unsigned int GetNodeCount() const { return mNumNodes; }
+
+    //! Get the memory used by the nodes and the triangle packets
+    //! \return Size in bytes
+    unsigned int GetMemorySize() const;
+
+    //------------------------------------------------------------------------------------
+
+private:
+
+    //! Maximum number of children of a node, and of triangles of a leaf
+    enum { WIDTH = 4 };
+
+    //! Node of the flattened tree, with the boxes of its children in SoA form
+    struct Node
+    {
+        float mMinX[WIDTH], mMinY[WIDTH], mMinZ[WIDTH];
+        float mMaxX[WIDTH], mMaxY[WIDTH], mMaxZ[WIDTH];
+
+        //! Index of the child node, or LEAF_FLAG | packet index, or EMPTY_CHILD
+        unsigned int mChildren[WIDTH];
+    };
+
+    //! Leaf of the flattened tree, with its triangles in SoA form (first corner and edges).
+    //! The unused lanes have null edges, which no ray hits
+    struct TrianglePacket
+    {
+        float mP0X[WIDTH], mP0Y[WIDTH], mP0Z[WIDTH];
+        float mE1X[WIDTH], mE1Y[WIDTH], mE1Z[WIDTH];
+        float mE2X[WIDTH], mE2Y[WIDTH], mE2Z[WIDTH];
+        unsigned int mTriangles[WIDTH];
+    };
+
+    //! Child flag of the leaves
+    static const unsigned int LEAF_FLAG = 0x80000000;
+
+    //! Child value of the unused slots
+    static const unsigned int EMPTY_CHILD = 0xFFFFFFFF;
+
+    struct BuildNode;
+    struct BuildContext;
+
+    //! Collapse a node of the binary tree into a node of the flattened tree, recursively
+    //! \param context Data of the build
+    //! \param buildNodeIndex Index of the binary node, an inner node
+    //! \return Index of the flattened node
+    unsigned int CollapseNode(BuildContext & context, unsigned int buildNodeIndex);
+
+    //! Create the triangle packet of a leaf of the binary tree
+    //! \param context Data of the build
+    //! \param buildNodeIndex Index of the binary node, a leaf
+    //! \return Index of the packet
+    unsigned int CreatePacket(BuildContext & context, unsigned int buildNodeIndex);
+
+    // The hierarchy cannot be copied
+    PG_DISABLE_COPY(MeshBvh)
+
+    //! Allocator of the nodes and packets
+    Alloc::IAllocator * mAllocator;
+
+    //! Flattened nodes, the root being the first one
+    Node * mNodes;
+    unsigned int mNumNodes;
+
+    //! Triangle packets of the leaves
+    TrianglePacket * mPackets;
+    unsigned int mNumPackets;
+
+    //! Number of triangles
+    unsigned int mNumTriangles;
+};
+
+
+}   // namespace Mesh
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MESH_MESHBVH_H
@@ -18,6 +18,12 @@
 //Increase this number if we are to use more than 32 attributes
 #define MESH_MAX_ATTRIBUTES 32
 
+namespace Pegasus {
+    namespace Graph {
+        class NodeDataKey;
+    }
+}
+
 namespace Pegasus {
 namespace Mesh {
 
@@ -84,6 +90,18 @@ public:
     //! Sets the primitive type for this mesh
     void    SetMeshPrimitiveType(MeshPrim primitiveType) { mPrimitiveType = primitiveType; }
 
+    //! Gets wether the triangles and vertices are reordered for the vertex cache once generated
+    bool    GetOptimizeVertexCache() const { return mOptimizeVertexCache; }
+
+    //! Sets wether the triangles and vertices are reordered for the vertex cache once generated.
+    //! Only applies to indexed triangle lists. The layout is unchanged, so this setting
+    //! does not affect the compatibility between nodes
+    void    SetOptimizeVertexCache(bool optimizeVertexCache) { mOptimizeVertexCache = optimizeVertexCache; }
+
+    //! Append the configuration to the key of a node data, used to share identical node data
+    //! \param key Key being built by the node
+    void WriteDataKey(Graph::NodeDataKey & key) const;
+
     //! Compares this with another mesh configuration for equality
     bool operator==(const MeshConfiguration& other) const;
 
@@ -106,6 +124,9 @@ private:
     //! the primitive type
     MeshPrim mPrimitiveType;
 
+    //! boolean that determines if the mesh is optimized for the vertex cache once generated
+    bool     mOptimizeVertexCache;
+
     //! the input layout
     MeshInputLayout mInputLayout;
     
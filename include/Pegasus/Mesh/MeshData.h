@@ -17,6 +17,9 @@
 #include "Pegasus/Graph/Node.h"
 #include "Pegasus/Mesh/MeshConfiguration.h"
 #include "Pegasus/Math/Vector.h"
+#include "Pegasus/Math/Half.h"
+#include "Pegasus/Math/AxisAlignedBoundingBox.h"
+#include "Pegasus/Math/BoundingSphere.h"
 
 namespace Pegasus {
 namespace Mesh {
@@ -29,6 +32,17 @@ struct StdVertex {
     Math::Vec2 uv; 
 };
 
+class MeshBvh;
+
+//Compact vertex definition, for editor meshes using the USE_COMPACT layout (16 bytes instead of 36).
+//The position is quantized in the bounds of the mesh (see MeshData::GetPositionOffset / GetPositionScale),
+//the normal is octahedral encoded (see MeshQuantizer.h).
+struct StdCompactVertex {
+    unsigned short position[4];
+    short normal[2];
+    Math::PFloat16 uv[2];
+};
+
 //! Mesh node data, used by all mesh nodes, including generators and operators
 class MeshData : public Graph::NodeData
 {
@@ -100,6 +114,76 @@ public:
 
     //! Destroys all internal data and initializes this mesh data as completely new
     void Clear();
+
+    //! Gets the number of levels of detail stored in the index buffer
+    //! \return the count of levels, 1 when the whole index buffer is the only level
+    int GetLodCount() const { return mLodCount; }
+
+    //! Gets the first index of a level of detail
+    //! \param lod the level of detail, 0 being the most detailed one
+    //! \return the offset of the level in the index buffer
+    int GetLodFirstIndex(int lod) const { PG_ASSERT(lod >= 0 && lod < mLodCount); return mLodCount > 1 ? mLods[lod].mFirstIndex : 0; }
+
+    //! Gets the index count of a level of detail
+    //! \param lod the level of detail, 0 being the most detailed one
+    //! \return the count of indices of the level
+    int GetLodIndexCount(int lod) const { PG_ASSERT(lod >= 0 && lod < mLodCount); return mLodCount > 1 ? mLods[lod].mIndexCount : mIndexCount; }
+
+    //! Gets the geometric error of a level of detail
+    //! \param lod the level of detail, 0 being the most detailed one
+    //! \return the distance between the surface of the level and the surface of the level 0
+    float GetLodError(int lod) const { PG_ASSERT(lod >= 0 && lod < mLodCount); return mLods[lod].mError; }
+
+    //! Sets the levels of detail, stored one after the other in the index buffer
+    //! \param indexCounts the count of indices of each level, the sum being at most the index count
+    //! \param errors the geometric error of each level, increasing with the levels
+    //! \param lodCount the count of levels (<= MESH_MAX_LODS), 1 to use the whole index buffer
+    //! \note the levels are reset by AllocateIndexes and Clear
+    void SetLods(const int * indexCounts, const float * errors, int lodCount);
+
+    //! Selects the coarsest level of detail whose geometric error covers at most a number of pixels
+    //! \param distance the distance between the camera and the mesh
+    //! \param projectionScale the height of the viewport in pixels divided by 2 tan(fovY / 2)
+    //! \param maxPixelError the error allowed on screen, in pixels
+    //! \return the selected level of detail
+    int SelectLod(float distance, float projectionScale, float maxPixelError) const;
+
+    //! Sets the decoding of the quantized positions, position = offset + quantized * scale
+    //! \param offset the minimum of the bounds of the quantized positions
+    //! \param scale the size of the bounds of the quantized positions
+    //! \note the decoding is reset by Clear, it is unused by float positions
+    void SetPositionDecode(const Math::Vec3& offset, const Math::Vec3& scale) { mPositionOffset = offset; mPositionScale = scale; }
+
+    //! Gets the offset decoding the quantized positions
+    //! \return the minimum of the bounds of the positions, (0, 0, 0) for float positions
+    const Math::Vec3& GetPositionOffset() const { return mPositionOffset; }
+
+    //! Gets the scale decoding the quantized positions
+    //! \return the size of the bounds of the positions, (1, 1, 1) for float positions
+    const Math::Vec3& GetPositionScale() const { return mPositionScale; }
+
+    //! Gets the bounding box of the positions, computed once the mesh is generated
+    //! \return the bounding box, of zero size for an empty mesh
+    const Math::AxisAlignedBoundingBox& GetBoundingBox() const { return mBoundingBox; }
+
+    //! Gets the bounding sphere of the positions, computed once the mesh is generated
+    //! \return the bounding sphere, centered on the bounding box
+    const Math::BoundingSphere& GetBoundingSphere() const { return mBoundingSphere; }
+
+    //! Reads the positions of the vertices, decoding the quantized positions
+    //! \param positions the positions, GetVertexCount() entries (output)
+    //! \return false if the layout has no 32 bits float or 16 bits unorm position, or outside of STANDARD mode
+    bool ExtractPositions(Math::Vec3 * positions);
+
+    //! Gets the bounding volume hierarchy over the triangles of the most detailed level,
+    //! built at the first call after each generation. The hierarchy is kept when the CPU copy is discarded
+    //! \return the hierarchy, nullptr if the mesh is not a triangle list, has no readable position,
+    //!         or if its CPU copy has been discarded before the first call
+    const MeshBvh * GetBvh();
+
+    //! Get the size of the memory used by the vertex streams and the index buffer
+    //! \return Size in bytes
+    virtual unsigned int GetMemorySize() const;
     
 protected:
 
@@ -112,6 +196,18 @@ protected:
     //! Destroys the index buffer
     void DestroyIndexBuffer();
 
+    //! Frees the vertex streams and the index buffer, once the GPU data is valid.
+    //! The vertex and index counts are kept
+    //! \return Number of bytes freed, 0 outside of STANDARD mode
+    virtual unsigned int ReleaseCPUBuffers();
+
+    //! Allocates the vertex streams and the index buffer again, for the current counts
+    virtual void AllocateCPUBuffers();
+
+    //! Optimizes the mesh for the vertex cache once generated, when enabled by the configuration,
+    //! and computes the bounds of the positions
+    virtual void CompleteGeneration();
+
     //------------------------------------------------------------------------------------
     
 private:
@@ -133,6 +229,19 @@ private:
     //!        the new buffer
     void InternalAllocateIndexes(int count, bool preserveElements);
 
+    //! finds the position attribute
+    //! \param streamIndex the stream of the attribute (output)
+    //! \param byteOffset the offset of the attribute in the vertices (output)
+    //! \param format the format of the attribute (output)
+    //! \return false if the layout has no position attribute
+    bool FindPositionAttribute(int& streamIndex, int& byteOffset, Core::Format& format) const;
+
+    //! computes the bounding box and the bounding sphere of the positions
+    void ComputeBounds();
+
+    //! destroys the bounding volume hierarchy, if any
+    void DestroyBvh();
+
     //!helper class, encoding a stream buffer of bytes
     class Stream
     {
@@ -189,6 +298,31 @@ private:
     //! total count of indices
     int mIndexCount;
 
+    //! range of the index buffer drawn for a level of detail
+    struct Lod
+    {
+        int mFirstIndex;
+        int mIndexCount;
+        float mError;
+    };
+
+    //! levels of detail, only the error of the level 0 is used when there is a single level
+    Lod mLods[MESH_MAX_LODS];
+
+    //! count of levels of detail
+    int mLodCount;
+
+    //! decoding of the quantized positions, position = offset + quantized * scale
+    Math::Vec3 mPositionOffset;
+    Math::Vec3 mPositionScale;
+
+    //! bounds of the positions
+    Math::AxisAlignedBoundingBox mBoundingBox;
+    Math::BoundingSphere mBoundingSphere;
+
+    //! bounding volume hierarchy over the triangles, built on demand
+    MeshBvh * mBvh;
+
     // mode of mesh data.
     Graph::Node::Mode mMode;
 };
@@ -94,6 +94,11 @@ protected:
     //! \note Called by \a GetUpdatedData()
     virtual void GenerateData() = 0;
 
+    //! Append the configuration to the key of the node data, used to share identical node data
+    //! \param key Key being built by the node
+    //! \return False for nodes generating their data on the GPU (compute mode), true otherwise
+    virtual bool WriteDataKey(Graph::NodeDataKey & key) const;
+
     //! Configuration of the generator
     MeshConfiguration mConfiguration;
 
@@ -26,6 +26,9 @@
 //! Maximum number of vertex streams
 #define MESH_MAX_STREAMS 8
 
+//! Maximum number of levels of detail stored in the index buffer of a mesh
+#define MESH_MAX_LODS 4
+
 namespace Pegasus {
 namespace Mesh {
 
@@ -41,6 +44,7 @@ public:
     static const int USE_POSITION = 0x1;
     static const int USE_NORMAL = 0x2;
     static const int USE_UV = 0x4;
+    static const int USE_COMPACT = 0x8; //! quantized formats, see GenerateEditorLayout
     typedef int LayoutUsageBitMask;
     
 
@@ -92,9 +96,15 @@ public:
     //! This layout consistency must be perseverant on all the mesh nodes.
     //! Violation of this layout in mesh operations will result in mesh compositing errors
     //! \param mask the attribute components to use. The basic formats are:
-    //!        float4 for position, ushort3(normalized) for normals and float2 for UVs
+    //!        float4 for position, float3 for normals and float2 for UVs (36 bytes).
+    //!        With USE_COMPACT, the formats are unorm16x4 for positions quantized in the bounds of the mesh,
+    //!        snorm16x2 for octahedral encoded normals and half2 for UVs (16 bytes)
     void GenerateEditorLayout(LayoutUsageBitMask mask);
 
+    //! Tests if the layout is the compact editor layout, its positions and normals need decoding in the shaders
+    //! \return true if the position is quantized to 16 bits
+    bool IsCompact() const;
+
     //! Copy constructor
     //! \param other Other configuration to copy from
     explicit MeshInputLayout(const MeshInputLayout & other);
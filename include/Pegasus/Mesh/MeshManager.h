@@ -14,6 +14,8 @@
 
 
 #include "Pegasus/Graph/Node.h"
+#include "Pegasus/Graph/NodeDataInterner.h"
+#include "Pegasus/Graph/NodeDataResidency.h"
 #include "Pegasus/Mesh/Mesh.h"
 #include "Pegasus/Mesh/MeshGenerator.h"
 #include "Pegasus/Mesh/MeshOperator.h"
@@ -83,6 +85,34 @@ public:
     //! \return the runtime asset created. return null if unsuccessfull.
     virtual AssetLib::RuntimeAssetObjectRef CreateRuntimeObject(const PegasusAssetTypeDesc* desc);
 
+    //! Get the table sharing the data of structurally identical mesh generators and operators.
+    //! Sharing is disabled by default, enable it with \a NodeDataInterner::SetEnabled().
+    //! The statistics of the table report the memory saved
+    //! \return Table of shared mesh data
+    //@{
+    inline Graph::NodeDataInterner & GetDataInterner() { return mDataInterner; }
+    inline const Graph::NodeDataInterner & GetDataInterner() const { return mDataInterner; }
+    //@}
+
+    //! Make the data of the mesh generators and operators created from now on transient.
+    //! Their data is then allocated from the transient node data pool and released once the dependent
+    //! nodes have been generated, reducing the peak memory of long operator chains
+    //! at the cost of regenerating the released data when it is needed again. Disabled by default
+    //! \param transient True to create nodes with transient data
+    inline void SetTransientNodeData(bool transient) { mTransientNodeData = transient; }
+
+    //! Test if the mesh generators and operators are created with transient data
+    //! \return True if the nodes created from now on have transient data
+    inline bool IsTransientNodeData() const { return mTransientNodeData; }
+
+    //! Get the residency policy of the mesh data, discarding the CPU copies once uploaded to the GPU.
+    //! Disabled by default, enable it and set a budget to release the CPU copies of the least recently used meshs
+    //! \return Residency policy shared by the mesh nodes of the manager
+    //@{
+    inline Graph::NodeDataResidency & GetDataResidency() { return mDataResidency; }
+    inline const Graph::NodeDataResidency & GetDataResidency() const { return mDataResidency; }
+    //@}
+
 #if PEGASUS_USE_EVENTS
     //! Registers an event listener so we can listen to mesh specific event whilst constructing nodes.
     //! \param the event listener to use
@@ -107,12 +137,26 @@ private:
     //! Register all the mesh nodes of the Mesh project
     void RegisterAllMeshNodes();
 
+    //! Destroy the GPU data of a mesh data released by the data interner
+    //! \param data Mesh data about to be released
+    //! \param userData Pointer to the mesh manager
+    static void ReleaseInternedData(Graph::NodeData * data, void * userData);
+
     //! Pointer to the node manager (!= nullptr)
     Graph::NodeManager * mNodeManager;
 
     //! Pointer to the GPU factory. Generates GPU data from cpu mesh data
     IMeshFactory * mFactory;
 
+    //! Table sharing the data of structurally identical generators and operators
+    Graph::NodeDataInterner mDataInterner;
+
+    //! True to create the generators and operators with transient data
+    bool mTransientNodeData;
+
+    //! Residency policy of the CPU copies of the mesh data
+    Graph::NodeDataResidency mDataResidency;
+
 #if PEGASUS_USE_EVENTS
     IMeshEventListener * mEventListener;
 #endif
@@ -0,0 +1,118 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshOptimizer.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Reordering of the triangles and vertices of indexed meshes
+//!         for the post-transform vertex cache, overdraw and vertex fetch
+
+#ifndef PEGASUS_MESH_MESHOPTIMIZER_H
+#define PEGASUS_MESH_MESHOPTIMIZER_H
+
+namespace Pegasus {
+    namespace Alloc {
+        class IAllocator;
+    }
+}
+
+namespace Pegasus {
+namespace Mesh {
+
+class MeshData;
+
+
+//! Default number of entries of the simulated FIFO post-transform vertex cache
+const unsigned int VERTEX_CACHE_SIZE = 16;
+
+//! Efficiency of a triangle list for a FIFO post-transform vertex cache
+struct VertexCacheStats
+{
+    float mACMR;        //!< Average cache miss ratio, transformed vertices per triangle (0.5 at best, 3 at worst)
+    float mATVR;        //!< Average transform to vertex ratio, transformed vertices per referenced vertex (1 at best)
+};
+
+//! Find the position attribute of a mesh
+//! \param meshData Mesh to look into, in STANDARD mode
+//! \param positions First position of the vertices (output)
+//! \param positionStride Number of bytes between two positions (output)
+//! \return False if the mesh has no 32 bits float position with at least 3 components
+bool FindMeshPositions(MeshData * meshData, const void *& positions, unsigned int & positionStride);
+
+//! Simulate a FIFO vertex cache on a triangle list
+//! \param indices Indices of the triangles, 3 per triangle
+//! \param numIndices Number of indices (multiple of 3)
+//! \param numVertices Number of vertices referenced by the indices
+//! \param cacheSize Number of entries of the cache (>= 3)
+//! \param allocator Allocator used for the temporary buffers
+//! \param stats Efficiency of the triangle list (output)
+void ComputeVertexCacheStats(const unsigned short * indices,
+                             unsigned int numIndices,
+                             unsigned int numVertices,
+                             unsigned int cacheSize,
+                             Alloc::IAllocator * allocator,
+                             VertexCacheStats & stats);
+
+//! Reorder the triangles of a triangle list for a vertex cache of a given size (Tipsify).
+//! The triangles are emitted in fans around the vertices, the next fanning vertex being
+//! one still in the cache. When none is left, the order restarts from a recently used
+//! vertex, which starts a new cluster of triangles
+//! \param indices Indices of the triangles, reordered in place, the winding of each triangle is kept
+//! \param numIndices Number of indices (multiple of 3)
+//! \param numVertices Number of vertices referenced by the indices
+//! \param cacheSize Number of entries of the targeted cache (>= 3)
+//! \param allocator Allocator used for the temporary buffers
+//! \param clusterStarts Index of the first triangle of each cluster (output, can be nullptr),
+//!                      at most numIndices / 3 entries
+//! \return Number of clusters
+unsigned int OptimizeVertexCache(unsigned short * indices,
+                                 unsigned int numIndices,
+                                 unsigned int numVertices,
+                                 unsigned int cacheSize,
+                                 Alloc::IAllocator * allocator,
+                                 unsigned int * clusterStarts);
+
+//! Sort the clusters of triangles so the outer surfaces are drawn first, reducing overdraw.
+//! The order of the triangles in each cluster is kept, so is the vertex cache efficiency
+//! \param indices Indices of the triangles, reordered in place
+//! \param numIndices Number of indices (multiple of 3)
+//! \param positions First position of the vertices, 3 floats
+//! \param positionStride Number of bytes between two positions
+//! \param clusterStarts Index of the first triangle of each cluster, as given by \a OptimizeVertexCache()
+//! \param numClusters Number of clusters
+//! \param allocator Allocator used for the temporary buffers
+void SortClustersForOverdraw(unsigned short * indices,
+                             unsigned int numIndices,
+                             const void * positions,
+                             unsigned int positionStride,
+                             const unsigned int * clusterStarts,
+                             unsigned int numClusters,
+                             Alloc::IAllocator * allocator);
+
+//! Reorder the vertices of a mesh in the order of their first use by the triangles,
+//! so the vertex fetches are sequential. Every vertex stream is reordered, the unused
+//! vertices are moved to the end
+//! \param meshData Mesh to modify, indexed and in STANDARD mode
+//! \param allocator Allocator used for the temporary buffers
+void OptimizeVertexFetch(MeshData * meshData, Alloc::IAllocator * allocator);
+
+//! Optimize an indexed triangle mesh for the vertex cache, then optionally for overdraw,
+//! then for vertex fetch. Each level of detail of the mesh is reordered separately.
+//! The vertex cache efficiency of each level before and after is logged
+//! \param meshData Mesh to optimize, ignored if not an indexed triangle list in STANDARD mode
+//! \param cacheSize Number of entries of the targeted vertex cache (>= 3)
+//! \param sortForOverdraw True to sort the triangle clusters to reduce overdraw
+//! \param allocator Allocator used for the temporary buffers
+void OptimizeMesh(MeshData * meshData,
+                  unsigned int cacheSize,
+                  bool sortForOverdraw,
+                  Alloc::IAllocator * allocator);
+
+
+}   // namespace Mesh
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MESH_MESHOPTIMIZER_H
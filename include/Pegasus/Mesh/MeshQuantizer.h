@@ -0,0 +1,75 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshQuantizer.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Conversion of the editor vertices to the compact vertex layout
+//!         (quantized positions, octahedral normals and half precision UVs)
+
+#ifndef PEGASUS_MESH_MESHQUANTIZER_H
+#define PEGASUS_MESH_MESHQUANTIZER_H
+
+#include "Pegasus/Mesh/MeshData.h"
+
+namespace Pegasus {
+namespace Mesh {
+
+
+//! Quantize a number in [0, 1] to a 16 bits unsigned normalized integer, rounding to the nearest value
+//! \param value Value to quantize, clamped to [0, 1]
+//! \return Quantized value, 65535 representing 1
+inline unsigned short QuantizeUnorm16(float value)
+{
+    value = (value < 0.0f) ? 0.0f : ((value > 1.0f) ? 1.0f : value);
+    return static_cast<unsigned short>(value * 65535.0f + 0.5f);
+}
+
+//! Quantize a number in [-1, 1] to a 16 bits signed normalized integer, rounding to the nearest value
+//! \param value Value to quantize, clamped to [-1, 1]
+//! \return Quantized value, 32767 representing 1
+inline short QuantizeSnorm16(float value)
+{
+    value = (value < -1.0f) ? -1.0f : ((value > 1.0f) ? 1.0f : value);
+    return static_cast<short>(value * 32767.0f + ((value >= 0.0f) ? 0.5f : -0.5f));
+}
+
+//! Encode a unit vector with the octahedral mapping. The vector is projected on the octahedron
+//! |x| + |y| + |z| = 1, whose lower half is folded over the upper half, giving 2 numbers in [-1, 1].
+//! The error of 16 bits components is below 0.005 degree
+//! \param normal Unit vector to encode
+//! \param encoded Octahedral coordinates, as 16 bits signed normalized integers (output)
+void EncodeOctahedralNormal(const Math::Vec3 & normal, short encoded[2]);
+
+//! Decode a unit vector encoded with \a EncodeOctahedralNormal(), like the shaders of the compact layout
+//! \param encoded Octahedral coordinates, as 16 bits signed normalized integers
+//! \return Unit vector
+Math::Vec3 DecodeOctahedralNormal(const short encoded[2]);
+
+//! Compute the decoding of the positions quantized in the bounds of a set of vertices
+//! \param vertices Vertices to quantize
+//! \param numVertices Number of vertices
+//! \param offset Minimum of the bounds of the positions (output)
+//! \param scale Size of the bounds of the positions, never 0 (output)
+void ComputePositionDecode(const StdVertex * vertices, unsigned int numVertices, Math::Vec3 & offset, Math::Vec3 & scale);
+
+//! Convert editor vertices to the compact layout
+//! \param vertices Vertices to convert
+//! \param numVertices Number of vertices
+//! \param offset Minimum of the bounds of the quantized positions, given by \a ComputePositionDecode()
+//! \param scale Size of the bounds of the quantized positions, given by \a ComputePositionDecode()
+//! \param compactVertices Converted vertices (output, numVertices entries)
+void QuantizeVertices(const StdVertex * vertices,
+                      unsigned int numVertices,
+                      const Math::Vec3 & offset,
+                      const Math::Vec3 & scale,
+                      StdCompactVertex * compactVertices);
+
+
+}   // namespace Mesh
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MESH_MESHQUANTIZER_H
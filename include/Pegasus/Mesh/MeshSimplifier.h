@@ -0,0 +1,76 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshSimplifier.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Quadric error simplification of indexed meshes and chains of levels of detail
+
+#ifndef PEGASUS_MESH_MESHSIMPLIFIER_H
+#define PEGASUS_MESH_MESHSIMPLIFIER_H
+
+namespace Pegasus {
+    namespace Alloc {
+        class IAllocator;
+    }
+}
+
+namespace Pegasus {
+namespace Mesh {
+
+class MeshData;
+
+
+//! Minimum cosine of the rotation of a triangle normal allowed by an edge collapse.
+//! Collapses folding or strongly tilting a triangle are rejected, preserving the shading
+const float SIMPLIFY_MIN_NORMAL_COSINE = 0.25f;
+
+//! Simplify a triangle list by collapsing its edges in the order of their quadric error.
+//! An edge collapse moves a vertex onto one of its neighbors, so the simplified triangles
+//! only use vertices of the input mesh and their attributes are preserved.
+//! Vertices sharing a position but not the attributes (UV seams, hard normals) are collapsed
+//! together, only along the edges of the seam. The vertices of the open borders are kept.
+//! \param indices Indices of the triangles, 3 per triangle
+//! \param numIndices Number of indices (multiple of 3)
+//! \param positions First position of the vertices, 3 floats
+//! \param positionStride Number of bytes between two positions
+//! \param numVertices Number of vertices referenced by the indices
+//! \param targetNumIndices Number of indices to reach, the simplification can stop before
+//! \param maxError Maximum distance between the simplified surface and the input one, 0 for no limit
+//! \param allocator Allocator used for the temporary buffers
+//! \param outIndices Indices of the simplified triangles (output, numIndices entries, can be \a indices)
+//! \param outError Distance between the simplified surface and the input one (output, can be nullptr)
+//! \return Number of indices of the simplified triangles
+unsigned int SimplifyMesh(const unsigned int * indices,
+                          unsigned int numIndices,
+                          const void * positions,
+                          unsigned int positionStride,
+                          unsigned int numVertices,
+                          unsigned int targetNumIndices,
+                          float maxError,
+                          Alloc::IAllocator * allocator,
+                          unsigned int * outIndices,
+                          float * outError);
+
+//! Replace the index buffer of a mesh with a chain of levels of detail sharing its vertices.
+//! Each level is simplified from the previous one, down to a ratio of its triangles.
+//! The level 0 is the level 0 of the input mesh, the further levels are appended
+//! to the index buffer and their ranges are stored in the mesh data
+//! \param meshData Mesh to modify, ignored if not an indexed triangle list in STANDARD mode
+//! \param numLods Number of levels of detail to build (<= MESH_MAX_LODS)
+//! \param lodRatio Ratio of triangles kept from one level to the next, in ]0, 1[
+//! \param allocator Allocator used for the temporary buffers
+//! \return Number of levels of detail built, 1 when the mesh could not be simplified
+unsigned int BuildMeshLods(MeshData * meshData,
+                           unsigned int numLods,
+                           float lodRatio,
+                           Alloc::IAllocator * allocator);
+
+
+}   // namespace Mesh
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MESH_MESHSIMPLIFIER_H
@@ -0,0 +1,57 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshWelder.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Welding of the coincident vertices of indexed meshes
+
+#ifndef PEGASUS_MESH_MESHWELDER_H
+#define PEGASUS_MESH_MESHWELDER_H
+
+namespace Pegasus {
+    namespace Alloc {
+        class IAllocator;
+    }
+}
+
+namespace Pegasus {
+namespace Mesh {
+
+class MeshData;
+
+
+//! Default maximum distance between the positions of two welded vertices
+const float WELD_POSITION_TOLERANCE = 1.0e-5f;
+
+//! Default maximum distance between the normals of two welded vertices (about 0.6 degree for unit normals)
+const float WELD_NORMAL_TOLERANCE = 1.0e-2f;
+
+//! Default maximum distance between the texture coordinates of two welded vertices
+const float WELD_UV_TOLERANCE = 1.0e-5f;
+
+//! Weld the vertices of an indexed mesh sharing their position, normal and texture coordinates.
+//! The positions are bucketed in a spatial hash of cells twice as large as the position tolerance,
+//! so the candidates of a vertex are in at most 8 cells. A vertex is welded to a matching vertex
+//! kept before it, every other attribute must be identical. The vertices of every stream are compacted
+//! in their order, the triangles made degenerate by the welding are removed from each level of detail
+//! \param meshData Mesh to modify, ignored if not indexed, in STANDARD mode, with 32 bits float positions
+//! \param positionTolerance Maximum distance between the positions of two welded vertices, 0 for exact matches
+//! \param normalTolerance Maximum distance between the normals of two welded vertices (32 bits float normals), 0 for exact matches
+//! \param uvTolerance Maximum distance between the texture coordinates of two welded vertices (32 bits float UVs), 0 for exact matches
+//! \param allocator Allocator used for the temporary buffers
+//! \return Number of vertices removed
+unsigned int WeldMesh(MeshData * meshData,
+                      float positionTolerance,
+                      float normalTolerance,
+                      float uvTolerance,
+                      Alloc::IAllocator * allocator);
+
+
+}   // namespace Mesh
+}   // namespace Pegasus
+
+#endif  // PEGASUS_MESH_MESHWELDER_H
@@ -0,0 +1,71 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   QuantizeOperator.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  QuantizeOperator
+
+#ifndef PEGASUS_QUANTIZE_OPERATOR_H
+#define PEGASUS_QUANTIZE_OPERATOR_H
+
+#include "Pegasus/Mesh/MeshOperator.h"
+
+namespace Pegasus
+{
+
+namespace Mesh
+{
+
+//! Mesh quantize operator. Converts an editor mesh to the compact layout (see MeshInputLayout::USE_COMPACT):
+//! positions quantized to 16 bits in the bounds of the mesh, octahedral encoded normals and half precision UVs.
+//! The input nodes use the full precision editor layout, the output uses the compact layout,
+//! so this operator is the last one of a mesh graph
+class QuantizeOperator : public MeshOperator
+{
+    DECLARE_MESH_OPERATOR_NODE(QuantizeOperator)
+
+    //! Property declarations
+    BEGIN_DECLARE_PROPERTIES(QuantizeOperator, MeshOperator)
+    END_DECLARE_PROPERTIES()
+
+public:
+    
+    //! constructor
+    QuantizeOperator(Pegasus::Alloc::IAllocator* nodeAllocator, 
+                     Pegasus::Alloc::IAllocator* nodeDataAllocator);
+
+    virtual ~QuantizeOperator();
+
+    virtual unsigned int GetMinNumInputNodes() const override { return 1; }
+
+    virtual unsigned int GetMaxNumInputNodes() const override { return 1; }
+
+    //! Append a mesh generator node to the list of input nodes, using the full precision layout
+    virtual void AddGeneratorInput(MeshGeneratorIn gen) override;
+
+    //! Append a mesh operator node to the list of input nodes, using the full precision layout
+    virtual void AddOperatorInput(const Pegasus::Core::Ref<MeshOperator>& op) override;
+
+protected:
+
+    //! Generate the content of the data associated with the mesh operator
+    virtual void GenerateData();
+
+private:
+
+    //! Tests if the configuration of an input node matches the configuration of this node
+    //! before the quantization
+    //! \param inputConfiguration Configuration of the input node
+    //! \return True if the input node can be connected
+    bool IsInputCompatible(const MeshConfiguration & inputConfiguration) const;
+
+};
+}
+
+}
+
+#endif//PEGASUS_QUANTIZE_OPERATOR_H
@@ -0,0 +1,59 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   SimplifyOperator.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  SimplifyOperator
+
+#ifndef PEGASUS_SIMPLIFY_OPERATOR_H
+#define PEGASUS_SIMPLIFY_OPERATOR_H
+
+#include "Pegasus/Mesh/MeshOperator.h"
+
+namespace Pegasus
+{
+
+namespace Mesh
+{
+
+//! Mesh simplification operator. Builds a chain of levels of detail of the input mesh
+//! with quadric error edge collapses, the levels sharing the vertices of the input.
+//! UV seams, hard normals and open borders are preserved.
+//! Only applies to indexed triangle lists, other meshes are copied unchanged
+class SimplifyOperator : public MeshOperator
+{
+    DECLARE_MESH_OPERATOR_NODE(SimplifyOperator)
+
+    //! Property declarations
+    BEGIN_DECLARE_PROPERTIES(SimplifyOperator, MeshOperator)
+        DECLARE_PROPERTY(int, LodCount, MESH_MAX_LODS)
+        DECLARE_PROPERTY(float, LodRatio, 0.5f)
+    END_DECLARE_PROPERTIES()
+
+public:
+    
+    //! constructor
+    SimplifyOperator(Pegasus::Alloc::IAllocator* nodeAllocator, 
+                     Pegasus::Alloc::IAllocator* nodeDataAllocator);
+
+    virtual ~SimplifyOperator();
+
+    virtual unsigned int GetMinNumInputNodes() const override { return 1; }
+
+    virtual unsigned int GetMaxNumInputNodes() const override { return 1; }
+
+protected:
+
+    //! Generate the content of the data associated with the mesh operator
+    virtual void GenerateData();
+
+};
+}
+
+}
+
+#endif//PEGASUS_SIMPLIFY_OPERATOR_H
@@ -0,0 +1,59 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   VertexCacheOperator.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  VertexCacheOperator
+
+#ifndef PEGASUS_VERTEX_CACHE_OPERATOR_H
+#define PEGASUS_VERTEX_CACHE_OPERATOR_H
+
+#include "Pegasus/Mesh/MeshOperator.h"
+#include "Pegasus/Mesh/MeshOptimizer.h"
+
+namespace Pegasus
+{
+
+namespace Mesh
+{
+
+//! Mesh vertex cache operator. Reorders the triangles of the input mesh for the vertex cache,
+//! optionally sorts them to reduce overdraw, then reorders the vertices for vertex fetch.
+//! Only applies to indexed triangle lists, other meshes are copied unchanged
+class VertexCacheOperator : public MeshOperator
+{
+    DECLARE_MESH_OPERATOR_NODE(VertexCacheOperator)
+
+    //! Property declarations
+    BEGIN_DECLARE_PROPERTIES(VertexCacheOperator, MeshOperator)
+        DECLARE_PROPERTY(int, CacheSize, VERTEX_CACHE_SIZE)
+        DECLARE_PROPERTY(bool, SortOverdraw, true)
+    END_DECLARE_PROPERTIES()
+
+public:
+    
+    //! constructor
+    VertexCacheOperator(Pegasus::Alloc::IAllocator* nodeAllocator, 
+                        Pegasus::Alloc::IAllocator* nodeDataAllocator);
+
+    virtual ~VertexCacheOperator();
+
+    virtual unsigned int GetMinNumInputNodes() const override { return 1; }
+
+    virtual unsigned int GetMaxNumInputNodes() const override { return 1; }
+
+protected:
+
+    //! Generate the content of the data associated with the mesh operator
+    virtual void GenerateData();
+
+};
+}
+
+}
+
+#endif//PEGASUS_VERTEX_CACHE_OPERATOR_H
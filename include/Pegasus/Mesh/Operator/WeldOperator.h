@@ -0,0 +1,60 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   WeldOperator.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  WeldOperator
+
+#ifndef PEGASUS_WELD_OPERATOR_H
+#define PEGASUS_WELD_OPERATOR_H
+
+#include "Pegasus/Mesh/MeshOperator.h"
+#include "Pegasus/Mesh/MeshWelder.h"
+
+namespace Pegasus
+{
+
+namespace Mesh
+{
+
+//! Mesh weld operator. Merges the vertices of the input mesh sharing their position, normal
+//! and texture coordinates within tolerances, such as the vertices duplicated by combined meshes.
+//! Only applies to indexed meshes, other meshes are copied unchanged
+class WeldOperator : public MeshOperator
+{
+    DECLARE_MESH_OPERATOR_NODE(WeldOperator)
+
+    //! Property declarations
+    BEGIN_DECLARE_PROPERTIES(WeldOperator, MeshOperator)
+        DECLARE_PROPERTY(float, PositionTolerance, WELD_POSITION_TOLERANCE)
+        DECLARE_PROPERTY(float, NormalTolerance, WELD_NORMAL_TOLERANCE)
+        DECLARE_PROPERTY(float, UvTolerance, WELD_UV_TOLERANCE)
+    END_DECLARE_PROPERTIES()
+
+public:
+    
+    //! constructor
+    WeldOperator(Pegasus::Alloc::IAllocator* nodeAllocator, 
+                 Pegasus::Alloc::IAllocator* nodeDataAllocator);
+
+    virtual ~WeldOperator();
+
+    virtual unsigned int GetMinNumInputNodes() const override { return 1; }
+
+    virtual unsigned int GetMaxNumInputNodes() const override { return 1; }
+
+protected:
+
+    //! Generate the content of the data associated with the mesh operator
+    virtual void GenerateData();
+
+};
+}
+
+}
+
+#endif//PEGASUS_WELD_OPERATOR_H
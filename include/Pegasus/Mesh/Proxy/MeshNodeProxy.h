@@ -27,6 +27,19 @@ public:
     MeshNodeProxy(Mesh* mesh) :mMesh(mesh) {}
     virtual ~MeshNodeProxy(){}
 
+    //! Get the bounding box of the mesh, for framing it in the editor views
+    //! \param boxMin Minimum coordinates of the box (output)
+    //! \param boxMax Maximum coordinates of the box (output)
+    virtual void GetBoundingBox(float boxMin[3], float boxMax[3]);
+
+    //! Find the closest triangle of the mesh hit by a ray, for picking in the editor views
+    //! \param origin Origin of the ray, in the space of the mesh
+    //! \param direction Direction of the ray, normalized
+    //! \param distance Distance from the origin to the hit point (output)
+    //! \param triangle Index of the hit triangle (output)
+    //! \return True if a triangle is hit
+    virtual bool Raycast(const float origin[3], const float direction[3], float & distance, unsigned int & triangle);
+
 protected:
     virtual AssetLib::IRuntimeAssetObjectProxy* GetDecoratedObject() const;
 
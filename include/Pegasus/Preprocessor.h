@@ -192,6 +192,16 @@
 
 //----------------------------------------------------------------------------------------
 
+// SIMD instruction sets of the target CPU.
+// SSE2 is part of x64, and is the default instruction set of Visual Studio for x86
+#if defined(_M_X64) || defined(_M_AMD64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)) || defined(__SSE2__)
+#define PEGASUS_SIMD_SSE2           1
+#else
+#define PEGASUS_SIMD_SSE2           0
+#endif
+
+//----------------------------------------------------------------------------------------
+
 // Graphics API
 #if PEGASUS_PLATFORM_WINDOWS
 
@@ -304,6 +314,10 @@
 // See the implementation of the functions living in the Pegasus::Io namespace for more details
 #define PEGASUS_USE_NATIVE_IO_CALLS                     1
 
+// Enable memory mapping of raw (non structured) assets rather than copying them into an allocated buffer.
+// Requires PEGASUS_USE_NATIVE_IO_CALLS, otherwise raw assets are always read into memory
+#define PEGASUS_ASSETLIB_MAP_RAW_ASSETS                 (PEGASUS_USE_NATIVE_IO_CALLS)
+
 //Enable events only if dev mode. In rel mode the boiler plate code gets removed
 //Events are used to communicate information to an editor app.
 #define PEGASUS_USE_EVENTS                        (PEGASUS_DEV)
@@ -327,6 +341,20 @@
 // so the user has easy documentation access to the available BlockScript functions
 #define PEGASUS_ENABLE_BS_REFLECTION_INFO               (PEGASUS_ENABLE_PROXIES)
 
+//! Enable the detection of frame allocator memory used after its frame expired (stamps and poisoning)
+#define PEGASUS_ENABLE_FRAME_ALLOCATOR_CHECKS           (PEGASUS_DEBUG)
+
+//! Enable the tracking of the allocations of the memory manager heaps (per category and per call site statistics,
+//! memory report and leak report at application shutdown). Adds a header and a lock to every allocation.
+#define PEGASUS_ENABLE_MEMORY_TRACKING                  0
+
+//! Enable the CPU frame profiler (scopes, render markers, Chrome trace export). Disabled at runtime until requested.
+#define PEGASUS_ENABLE_PROFILER                         (PEGASUS_DEV || PEGASUS_PROFILE)
+
+//! Enable the blockscript VM profiler hooks (instructions and time per function and per line, see BsVmProfiler).
+//! When disabled the VM does not test for an attached profiler.
+#define PEGASUS_ENABLE_BS_PROFILER                      (PEGASUS_ENABLE_PROFILER)
+
 //! Enable size checks in the property grid accessors
 #define PEGASUS_ENABLE_PROPERTYGRID_SAFE_ACCESSOR       (PEGASUS_DEBUG)
 
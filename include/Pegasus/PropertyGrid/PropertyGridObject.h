@@ -582,7 +582,7 @@ public:
     
     //! Invalidate the property grid (sets the dirty flag)
     //! \note Called automatically by setters, but can be used to force the dirty flag manually
-    inline void InvalidatePropertyGrid() { mPropertyGridDirty = true; }
+    inline void InvalidatePropertyGrid() { mPropertyGridDirty = true; OnPropertyGridInvalidated(); }
 
     //! Pegasus event function to invalidate the data.
     inline void InvalidateData() { InvalidatePropertyGrid(); }
@@ -639,6 +639,10 @@ protected:
     //!       of declaration/implementation/initialization macros does not match
     inline unsigned int GetNumClassPropertyPointers() const { return mClassPropertyPointers.GetSize(); }
 
+    //! Called every time the property grid is invalidated, to let the owner react to the change immediately
+    //! \note The override of this function is optional, the default behavior does nothing
+    virtual void OnPropertyGridInvalidated() { }
+
 
     //------------------------------------------------------------------------------------
     
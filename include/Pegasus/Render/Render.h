@@ -370,6 +370,11 @@ namespace Render
     //!           or throw an assert
     void SetMesh (Mesh::MeshInOut mesh);
 
+    //! Selects the level of detail drawn for the dispatched mesh.
+    //! \param lod level of detail, clamped to the levels of the mesh. 0 is the most detailed one
+    //! \note SetMesh resets the level of detail to 0. Use Mesh::SelectLod to pick a level from a distance
+    void SetMeshLod (unsigned int lod);
+
     //! Clears mesh streams and indices being set. Use only when using meshes as compute outputs.
     void UnbindMesh();
 
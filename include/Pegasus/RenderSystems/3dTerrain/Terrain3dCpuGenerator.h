@@ -0,0 +1,60 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Terrain3dCpuGenerator.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Terrain mesh generator running the meshing on the CPU.
+
+#ifndef PEGASUS_TERRAIN_3D_CPU_MESH_GENERATOR
+#define PEGASUS_TERRAIN_3D_CPU_MESH_GENERATOR
+
+#include "Pegasus/RenderSystems/Config.h"
+#if RENDER_SYSTEM_CONFIG_ENABLE_3DTERRAIN
+
+#include "Pegasus/Mesh/MeshGenerator.h"
+#include "Pegasus/Math/Vector.h"
+
+namespace Pegasus
+{
+namespace RenderSystems
+{
+
+//! Terrain mesh generator producing the mesh of a segment on the CPU (see Terrain3dCpuMesher).
+//! Unlike Terrain3dGenerator, the mesh data is in memory, for the tools and the offline baking
+class Terrain3dCpuGenerator : public Mesh::MeshGenerator
+{
+    DECLARE_MESH_GENERATOR_NODE(Terrain3dCpuGenerator)
+
+    //! Property declarations
+    BEGIN_DECLARE_PROPERTIES(Terrain3dCpuGenerator, MeshGenerator)
+        DECLARE_PROPERTY(Math::Vec3, WorldOffset, Math::Vec3(0.0f, 0.0f, 0.0f))
+        DECLARE_PROPERTY(float, WorldScale, 1.0f)
+        DECLARE_PROPERTY(int, ThreadCount, 0) //! 0 to use all the hardware threads
+    END_DECLARE_PROPERTIES()
+
+public:
+
+    //! Terrain generator constructor
+    //!\param nodeAllocator the allocator for the node properties (if any)
+    //!\param nodeDataAllocator the allocator of the node data
+    Terrain3dCpuGenerator(Pegasus::Alloc::IAllocator* nodeAllocator, 
+                  Pegasus::Alloc::IAllocator* nodeDataAllocator);
+
+    virtual ~Terrain3dCpuGenerator();
+
+protected:
+
+    //! Generate the content of the data associated with the mesh generator
+    virtual void GenerateData();
+};
+
+
+}
+}
+
+#endif
+#endif
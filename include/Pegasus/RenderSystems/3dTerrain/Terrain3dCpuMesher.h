@@ -0,0 +1,99 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Terrain3dCpuMesher.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  CPU implementation of the 3d terrain meshing (density, marching cubes and mesh output)
+
+#ifndef PEGASUS_TERRAIN_3D_CPU_MESHER_H
+#define PEGASUS_TERRAIN_3D_CPU_MESHER_H
+
+#include "Pegasus/RenderSystems/Config.h"
+#if RENDER_SYSTEM_CONFIG_ENABLE_3DTERRAIN
+
+#include "Pegasus/Math/Vector.h"
+
+namespace Pegasus {
+    namespace Alloc {
+        class IAllocator;
+    }
+    namespace Mesh {
+        class MeshData;
+    }
+}
+
+namespace Pegasus
+{
+namespace RenderSystems
+{
+
+class CaseTable;
+
+//! CPU version of Terrain3dSystem::ComputeTerrainMesh, meshing segments of Terrain3d::SEGMENT_UNIT_SIZE cells per axis.
+//! It runs the same passes as the compute shaders (density3d, geomInfo, sparse offsets, meshProducer)
+//! with the same case table, density function, vertex sharing and gradient normals, so it serves as a reference
+//! for the GPU results and as a fallback for the tools. Differences with the GPU path:
+//! the densities are kept in full precision instead of 8 bits, and the triangles are in a different order.
+//! The density is evaluated 4 samples at once (SSE2 when available), and the blocks of
+//! Terrain3dSystem::BLOCK_DIM cells per axis of all the segments are processed in parallel.
+class Terrain3dCpuMesher
+{
+public:
+
+    //! Segment to mesh
+    struct Segment
+    {
+        Math::Vec3 worldOffset;     //!< World position of the first corner of the segment
+        float worldScale;           //!< World size of a cell
+    };
+
+    //! Constructor
+    //! \param allocator Allocator of the working memory of the passes
+    //! \param caseTable Initialized marching cube cases, from Terrain3dSystem::GetCaseTable()
+    Terrain3dCpuMesher(Alloc::IAllocator* allocator, const CaseTable* caseTable);
+
+    //! Mesh segments, each one into its own mesh data
+    //! \param segments Segments to mesh
+    //! \param segmentCount Number of segments
+    //! \param meshes Mesh data receiving the segments, in STANDARD mode with the editor vertex layout (StdVertex),
+    //!               filled with indexed triangles (segmentCount entries)
+    //! \param workerCount Number of threads including the calling one, 0 for all the hardware threads
+    void GenerateSegments(const Segment* segments, unsigned int segmentCount, Mesh::MeshData* const* meshes, unsigned int workerCount) const;
+
+    //! Evaluate the terrain density at 4 points, the density function of density3d.cs
+    //! \param x X coordinates of the points
+    //! \param y Y coordinates of the points
+    //! \param z Z coordinates of the points
+    //! \param densities Unscaled densities of the points, the terrain being where they are above 0.5 (output)
+    static void ComputeDensity4(const float x[4], const float y[4], const float z[4], float densities[4]);
+
+private:
+
+    struct SegmentContext;
+    struct BatchContext;
+
+    //! Run a pass of the meshing on a block, the jobs of the passes being the blocks of all the segments of a batch
+    static void DensityJob(void* userData, unsigned int jobIndex, unsigned int workerIndex);
+    static void CountJob(void* userData, unsigned int jobIndex, unsigned int workerIndex);
+    static void OutputJob(void* userData, unsigned int jobIndex, unsigned int workerIndex);
+
+    // The mesher cannot be copied
+    PG_DISABLE_COPY(Terrain3dCpuMesher)
+
+    //! Allocator of the working memory
+    Alloc::IAllocator* mAllocator;
+
+    //! Marching cube cases
+    const CaseTable* mCaseTable;
+};
+
+
+}
+}
+
+#endif
+#endif
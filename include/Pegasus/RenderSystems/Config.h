@@ -18,6 +18,7 @@
 #define RENDER_SYSTEM_CONFIG_ENABLE_LIGHTING 1 
 #define RENDER_SYSTEM_CONFIG_ENABLE_3DTERRAIN 1
 #define RENDER_SYSTEM_CONFIG_ENABLE_CAMERA 1
+#define RENDER_SYSTEM_CONFIG_ENABLE_PROFILER (PEGASUS_ENABLE_PROFILER)
 
 
 #endif
@@ -0,0 +1,52 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   ProfilerSystem.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Debug render system exposing the CPU frame profiler to scripts
+
+#ifndef PEGASUS_RENDER_SYSTEM_PROFILER_H
+#define PEGASUS_RENDER_SYSTEM_PROFILER_H
+
+#include "Pegasus/RenderSystems/Config.h"
+
+#if RENDER_SYSTEM_CONFIG_ENABLE_PROFILER
+
+#include "Pegasus/RenderSystems/System/RenderSystem.h"
+
+namespace Pegasus
+{
+namespace RenderSystems
+{
+
+//! Debug system giving access to the rolling summary of the CPU profiler.
+//! Registers a blockscript library to enable the profiler, read the time spent in scopes
+//! (so timelines can display them) and dump the summary to the log.
+class ProfilerSystem : public RenderSystem
+{
+public:
+    //! Constructor
+    explicit ProfilerSystem(Alloc::IAllocator* allocator) : RenderSystem(allocator) {}
+
+    //! Destructor
+    virtual ~ProfilerSystem() {}
+
+    //! \return true, this system registers a blockscript api
+    virtual bool CanCreateBlockScriptApi() const { return true; }
+
+    //! \return the name of this system
+    virtual const char* GetSystemName() const { return "ProfilerSystem"; }
+
+    //! Registers the profiler functions
+    virtual void OnRegisterBlockscriptApi(BlockScript::BlockLib* blocklib, Core::IApplicationContext* appContext);
+};
+
+}
+}
+
+#endif
+#endif
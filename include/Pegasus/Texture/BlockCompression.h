@@ -0,0 +1,105 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BlockCompression.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Block compression of RGBA8 images to the BC1, BC3, BC5 and BC7 formats
+
+#ifndef PEGASUS_TEXTURE_BLOCKCOMPRESSION_H
+#define PEGASUS_TEXTURE_BLOCKCOMPRESSION_H
+
+#include "Pegasus/Core/Formats.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Quality presets of the block compression, trading encoding speed for quality
+enum CompressionQuality
+{
+    COMPRESSIONQUALITY_FAST = 0,    //!< Bounding box endpoints, for textures regenerated every frame
+    COMPRESSIONQUALITY_NORMAL,      //!< Principal axis endpoints
+    COMPRESSIONQUALITY_HIGH,        //!< Principal axis endpoints refined by least squares, more endpoint candidates
+    NUM_COMPRESSIONQUALITIES
+};
+
+//! Number of block rows compressed by one job of the texture compression
+const unsigned int COMPRESSION_BLOCK_ROWS_PER_JOB = 4;
+
+//! Test if a format is one of the block compressed formats supported by the encoder
+//! \param format Format to test
+//! \return True for the BC1, BC3, BC5 and BC7 formats, including the sRGB ones
+bool IsBlockCompressedFormat(Core::Format format);
+
+//! Get the size of a 4x4 block of a block compressed format
+//! \param format Block compressed format
+//! \return 8 for BC1, 16 for BC3, BC5 and BC7
+unsigned int GetCompressedBlockSize(Core::Format format);
+
+//! Get the number of blocks covering a number of pixels
+//! \param numPixels Width or height in pixels (>= 1)
+//! \return Number of 4 pixel blocks, the last one being partial when numPixels is not a multiple of 4
+inline unsigned int GetNumCompressedBlocks(unsigned int numPixels) { return (numPixels + 3) / 4; }
+
+//! Get the size of a compressed image
+//! \param format Block compressed format
+//! \param width Width of the image in pixels (>= 1)
+//! \param height Height of the image in pixels (>= 1)
+//! \return Size in bytes of the compressed image
+unsigned int GetCompressedImageSize(Core::Format format, unsigned int width, unsigned int height);
+
+//! Compress a range of block rows of an RGBA8 image.
+//! The blocks are independent, so several ranges of the same image can be compressed at once.
+//! The sRGB formats encode the same blocks as the linear ones, only the GPU decoding differs
+//! \param format Block compressed format
+//! \param quality Quality preset (COMPRESSIONQUALITY_xxx constant)
+//! \param rgbaData RGBA8 image, rows of width * 4 bytes
+//! \param width Width of the image in pixels (>= 1)
+//! \param height Height of the image in pixels (>= 1)
+//! \param firstBlockRow Index of the first block row to compress
+//! \param numBlockRows Number of block rows to compress
+//! \param compressedData Compressed image, of GetCompressedImageSize() bytes
+void CompressBlockRows(Core::Format format,
+                       CompressionQuality quality,
+                       const unsigned char * rgbaData,
+                       unsigned int width,
+                       unsigned int height,
+                       unsigned int firstBlockRow,
+                       unsigned int numBlockRows,
+                       unsigned char * compressedData);
+
+//! Decompress a range of block rows to an RGBA8 image, to measure the quality of the encoder.
+//! BC5 is decoded to the red and green channels, blue is set to 0 and alpha to 255.
+//! Only the BC7 blocks written by the encoder (mode 6) are supported
+//! \param format Block compressed format
+//! \param compressedData Compressed image
+//! \param width Width of the image in pixels (>= 1)
+//! \param height Height of the image in pixels (>= 1)
+//! \param firstBlockRow Index of the first block row to decompress
+//! \param numBlockRows Number of block rows to decompress
+//! \param rgbaData RGBA8 image receiving the pixels, rows of width * 4 bytes
+void DecompressBlockRows(Core::Format format,
+                         const unsigned char * compressedData,
+                         unsigned int width,
+                         unsigned int height,
+                         unsigned int firstBlockRow,
+                         unsigned int numBlockRows,
+                         unsigned char * rgbaData);
+
+//! Compute the peak signal to noise ratio between two RGBA8 images
+//! \param rgbaData1 First image
+//! \param rgbaData2 Second image, of the same size
+//! \param numPixels Number of pixels of the images
+//! \param numChannels Number of channels compared, starting from red (3 for BC1, 2 for BC5, 4 otherwise)
+//! \return PSNR in dB, 99 for identical images
+double ComputePSNR(const unsigned char * rgbaData1, const unsigned char * rgbaData2, unsigned int numPixels, unsigned int numChannels);
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_BLOCKCOMPRESSION_H
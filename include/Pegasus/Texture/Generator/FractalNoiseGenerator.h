@@ -0,0 +1,50 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   FractalNoiseGenerator.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Texture generator that renders tileable fractal (fBm or ridged) noise
+
+#ifndef PEGASUS_TEXTURE_GENERATOR_FRACTALNOISEGENERATOR_H
+#define PEGASUS_TEXTURE_GENERATOR_FRACTALNOISEGENERATOR_H
+
+#include "Pegasus/Texture/TextureGenerator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture generator that renders tileable fractal (fBm or ridged) noise.
+//! The noise tiles with the texture, Frequency being the number of lattice cells along each axis.
+//! Textures with a depth greater than 1 use the 3D noise
+class FractalNoiseGenerator : public TextureGenerator
+{
+    DECLARE_TEXTURE_GENERATOR_NODE(FractalNoiseGenerator)
+
+    BEGIN_DECLARE_PROPERTIES(FractalNoiseGenerator, TextureGenerator)
+        DECLARE_PROPERTY(Math::Color8RGBA, Color0, Math::Color8RGBA(0, 0, 0, 255))
+        DECLARE_PROPERTY(Math::Color8RGBA, Color1, Math::Color8RGBA(255, 255, 255, 255))
+        DECLARE_PROPERTY(unsigned int, Frequency, 4)
+        DECLARE_PROPERTY(unsigned int, NumOctaves, 5)
+        DECLARE_PROPERTY(float, Gain, 0.5f)
+        DECLARE_PROPERTY(bool, Ridged, false)
+        DECLARE_PROPERTY(unsigned int, Seed, 123456789)
+    END_DECLARE_PROPERTIES()
+
+    //------------------------------------------------------------------------------------
+    
+protected:
+
+    //! Generate the content of the data associated with the texture generator
+    virtual void GenerateData();
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_GENERATOR_FRACTALNOISEGENERATOR_H
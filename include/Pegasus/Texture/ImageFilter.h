@@ -0,0 +1,169 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   ImageFilter.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Image processing filters of the texture operators (blur, normal map, levels, blend, warp)
+
+#ifndef PEGASUS_TEXTURE_IMAGEFILTER_H
+#define PEGASUS_TEXTURE_IMAGEFILTER_H
+
+namespace Pegasus {
+namespace Texture {
+
+class TextureData;
+
+
+//! Number of rows processed by one job of the filters
+const unsigned int FILTER_ROWS_PER_JOB = 16;
+
+//! Number of columns processed by one job of the vertical blur passes.
+//! The running sums of a tile stay in the L1 cache while the rows are traversed
+const unsigned int FILTER_COLUMNS_PER_TILE = 64;
+
+//! Maximum number of box passes of a blur
+const unsigned int MAX_BLUR_PASSES = 3;
+
+//! Blend modes of \a BlendImages()
+enum BlendMode
+{
+    BLENDMODE_MIX = 0,      //!< Second image
+    BLENDMODE_MULTIPLY,     //!< Product of the images
+    BLENDMODE_SCREEN,       //!< Inverse of the product of the inverted images
+    BLENDMODE_OVERLAY,      //!< Multiply for the dark values of the first image, screen for the bright ones
+    NUM_BLENDMODES
+};
+
+//----------------------------------------------------------------------------------------
+
+// The filters work on images of RGBA float pixels, 4 floats per pixel.
+// An image is one slice of a layer of a texture, read and written with any pixel format
+// supported by the pixel kernels. The missing channels of a format are read as (0, 0, 0, 1).
+// Each filter splits its image into independent jobs of rows (or columns for the vertical
+// blur passes), running in parallel with Core::RunParallelJobs().
+
+//! Read a slice of a layer of a texture as an image of RGBA float pixels
+//! \param data Texture data to read
+//! \param layer Index of the layer
+//! \param slice Index of the slice (< depth)
+//! \param pixels Image receiving width * height RGBA pixels (output)
+//! \return False if the pixel format of the texture is not supported
+bool ReadFilterImage(const TextureData * data, unsigned int layer, unsigned int slice, float * pixels);
+
+//! Write an image of RGBA float pixels to a slice of a layer of a texture
+//! \param data Texture data to write
+//! \param layer Index of the layer
+//! \param slice Index of the slice (< depth)
+//! \param pixels Image of width * height RGBA pixels, converted to the pixel format of the texture
+//! \return False if the pixel format of the texture is not supported
+bool WriteFilterImage(TextureData * data, unsigned int layer, unsigned int slice, const float * pixels);
+
+//----------------------------------------------------------------------------------------
+
+//! Compute the radii of the box passes approximating a Gaussian blur
+//! \param sigma Standard deviation of the Gaussian in pixels (>= 0)
+//! \param radii Radii in pixels of the MAX_BLUR_PASSES box passes (output)
+void ComputeGaussianBoxRadii(float sigma, unsigned int radii[MAX_BLUR_PASSES]);
+
+//! Blur an image with successive separable box passes, computed with running sums
+//! so the cost does not depend on the radii
+//! \param pixels Image to blur, receiving the result
+//! \param tempPixels Temporary image of the same size
+//! \param width Width of the image in pixels (>= 1)
+//! \param height Height of the image in pixels (>= 1)
+//! \param radii Radius in pixels of each box pass, a pass of radius 0 being skipped
+//! \param numPasses Number of box passes (<= MAX_BLUR_PASSES)
+//! \param wrap True to wrap around the edges of the image (tileable textures), false to clamp
+void BlurImage(float * pixels,
+               float * tempPixels,
+               unsigned int width,
+               unsigned int height,
+               const unsigned int * radii,
+               unsigned int numPasses,
+               bool wrap);
+
+//! Get the size of the temporary buffer of \a ComputeNormalMap(),
+//! the heights with a border of one pixel, padded for the last group of 4 pixels
+//! \param width Width of the image in pixels (>= 1)
+//! \param height Height of the image in pixels (>= 1)
+//! \return Number of floats of the buffer
+inline unsigned int GetNormalMapBufferSize(unsigned int width, unsigned int height) { return (width + 2) * (height + 2) + 4; }
+
+//! Compute a tangent space normal map from the red channel of a height image.
+//! The normals are stored in RGB as 0.5 + 0.5 * n, the height is kept in alpha.
+//! The green channel points to the first row of the image (OpenGL convention)
+//! \param heightPixels Image of the heights, in [0, 1] in the red channel
+//! \param normalPixels Image receiving the normal map
+//! \param width Width of the images in pixels (>= 1)
+//! \param height Height of the images in pixels (>= 1)
+//! \param strength Height in pixels of a height value of 1
+//! \param wrap True to wrap around the edges of the image (tileable textures), false to clamp
+//! \param heightBuffer Temporary buffer of GetNormalMapBufferSize() floats
+void ComputeNormalMap(const float * heightPixels,
+                      float * normalPixels,
+                      unsigned int width,
+                      unsigned int height,
+                      float strength,
+                      bool wrap,
+                      float * heightBuffer);
+
+//! Remap the RGB channels of an image: the input range is stretched to [0, 1],
+//! a gamma curve is applied, then the result is remapped to the output range.
+//! The alpha channel is unchanged
+//! \param pixels Image to modify
+//! \param width Width of the image in pixels (>= 1)
+//! \param height Height of the image in pixels (>= 1)
+//! \param inputBlack Input value mapped to 0
+//! \param inputWhite Input value mapped to 1
+//! \param gamma Gamma of the curve (> 0), values > 1 brighten the midtones
+//! \param outputBlack Output value of 0
+//! \param outputWhite Output value of 1
+void ApplyLevels(float * pixels,
+                 unsigned int width,
+                 unsigned int height,
+                 float inputBlack,
+                 float inputWhite,
+                 float gamma,
+                 float outputBlack,
+                 float outputWhite);
+
+//! Blend a second image over a first one. The alpha channel of the first image is kept
+//! \param pixels First image, receiving the result
+//! \param layerPixels Second image
+//! \param width Width of the images in pixels (>= 1)
+//! \param height Height of the images in pixels (>= 1)
+//! \param mode Blend mode
+//! \param opacity Interpolation factor between the first image and the blended image, in [0, 1]
+void BlendImages(float * pixels,
+                 const float * layerPixels,
+                 unsigned int width,
+                 unsigned int height,
+                 BlendMode mode,
+                 float opacity);
+
+//! Distort an image by offsetting its pixels with a displacement image, with bilinear filtering
+//! \param srcPixels Image to distort
+//! \param displacementPixels Displacement image, the red and green channels in [0, 1] encode
+//!                           offsets in [-1, 1] along x and y, 0.5 leaving the pixel in place
+//! \param dstPixels Image receiving the distorted image
+//! \param width Width of the images in pixels (>= 1)
+//! \param height Height of the images in pixels (>= 1)
+//! \param strength Offset of a displacement of 1, relative to the size of the image
+//! \param wrap True to wrap around the edges of the image (tileable textures), false to clamp
+void WarpImage(const float * srcPixels,
+               const float * displacementPixels,
+               float * dstPixels,
+               unsigned int width,
+               unsigned int height,
+               float strength,
+               bool wrap);
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_IMAGEFILTER_H
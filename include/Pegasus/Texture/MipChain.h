@@ -0,0 +1,68 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MipChain.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Computation of the mip levels of the texture data from the full resolution level
+
+#ifndef PEGASUS_TEXTURE_MIPCHAIN_H
+#define PEGASUS_TEXTURE_MIPCHAIN_H
+
+#include "Pegasus/Texture/TextureConfiguration.h"
+
+namespace Pegasus {
+    namespace Alloc {
+        class IAllocator;
+    }
+}
+
+namespace Pegasus {
+namespace Texture {
+
+class TextureData;
+
+
+//! Number of rows of a mip level computed by one job of the mip chain generation
+const unsigned int MIP_ROWS_PER_JOB = 32;
+
+//! Compute the mip levels of every layer of a texture data from its full resolution level.
+//! Each level is computed from the previous one, by jobs of MIP_ROWS_PER_JOB rows running in parallel
+//! \param data Texture data with an up-to-date full resolution level
+//! \param allocator Allocator used for the temporary rows of the filter
+void GenerateMipChain(TextureData * data, Alloc::IAllocator * allocator);
+
+//! Get the size of the temporary row buffer required by \a DownsampleMipRows()
+//! \param configuration Configuration of the texture
+//! \return Number of floats of the buffer
+inline unsigned int GetMipRowBufferSize(const TextureConfiguration & configuration) { return configuration.GetWidth() * 4; }
+
+//! Compute a range of rows of a mip level from the previous level.
+//! The rows of a level are independent, so several ranges of the same level can be computed at once,
+//! but the levels have to be computed in order.
+//! The filter is separable: the source rows are combined vertically in linear space in the row buffer,
+//! which is then filtered horizontally, using SSE2 when available.
+//! sRGB textures are filtered in linear space, the alpha channel is always linear
+//! \param configuration Configuration of the texture, with RGBA8 pixels
+//! \param srcLevelData Image data of the previous level
+//! \param dstLevelData Image data of the level to compute
+//! \param level Index of the level to compute (>= 1)
+//! \param firstRow Index of the first row to compute
+//! \param numRows Number of rows to compute
+//! \param rowBuffer Temporary buffer of GetMipRowBufferSize() floats, owned by the caller
+void DownsampleMipRows(const TextureConfiguration & configuration,
+                       const unsigned char * srcLevelData,
+                       unsigned char * dstLevelData,
+                       unsigned int level,
+                       unsigned int firstRow,
+                       unsigned int numRows,
+                       float * rowBuffer);
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_MIPCHAIN_H
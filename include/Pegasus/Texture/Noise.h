@@ -0,0 +1,93 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   Noise.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Tileable procedural noise (gradient, cellular and fractal) for the texture generators
+
+#ifndef PEGASUS_TEXTURE_NOISE_H
+#define PEGASUS_TEXTURE_NOISE_H
+
+#include "Pegasus/Math/Color.h"
+
+namespace Pegasus {
+namespace Texture {
+
+class TextureData;
+
+
+//! Types of procedural noise
+enum NoiseType
+{
+    NOISETYPE_GRADIENT = 0,     //!< Perlin gradient noise
+    NOISETYPE_CELLULAR,         //!< Worley cellular noise, distance to the closest feature point
+    NOISETYPE_FBM,              //!< Fractal sum of gradient noise octaves
+    NOISETYPE_RIDGED,           //!< Fractal sum of inverted absolute gradient noise octaves
+    NUM_NOISETYPES
+};
+
+//! Maximum number of cells of the noise lattice along one axis, for the first octave
+const unsigned int MAX_NOISE_FREQUENCY = 1024;
+
+//! Maximum number of octaves of the fractal noises
+const unsigned int MAX_NOISE_OCTAVES = 10;
+
+//! Number of rows generated by one job of the noise generators
+const unsigned int NOISE_ROWS_PER_JOB = 8;
+
+//! Settings of a procedural noise
+struct NoiseSettings
+{
+    NoiseType mType;                //!< Type of noise (NOISETYPE_xxx constant)
+    unsigned int mSeed;             //!< Seed of the noise, the same seed gives the same noise on every platform
+    unsigned int mFrequency;        //!< Number of cells of the lattice along each axis of the texture (1 to MAX_NOISE_FREQUENCY),
+                                    //!< the noise tiles with the texture
+    unsigned int mNumOctaves;       //!< Number of octaves of the fractal noises (1 to MAX_NOISE_OCTAVES),
+                                    //!< each octave doubles the frequency of the previous one
+    float mGain;                    //!< Amplitude ratio between two consecutive octaves of the fractal noises
+    float mJitter;                  //!< Displacement of the feature points of the cellular noise from the cell centers, in [0, 1]
+};
+
+//! Evaluate a noise for a range of pixels of a row of a texture.
+//! The pixels are processed in groups of 4, with SSE2 when available.
+//! The SSE2 and scalar paths use the same operations, so they give identical results
+//! \param settings Settings of the noise
+//! \param width Width of the texture in pixels (>= 1)
+//! \param height Height of the texture in pixels (>= 1)
+//! \param depth Depth of the texture in pixels (>= 1), the noise is 3D when > 1
+//! \param x First pixel of the range
+//! \param y Row of the range
+//! \param z Slice of the range
+//! \param numPixels Number of pixels of the range
+//! \param values Values of the noise in [0, 1] (output), numPixels entries
+void EvaluateNoise(const NoiseSettings & settings,
+                   unsigned int width,
+                   unsigned int height,
+                   unsigned int depth,
+                   unsigned int x,
+                   unsigned int y,
+                   unsigned int z,
+                   unsigned int numPixels,
+                   float * values);
+
+//! Fill every layer of a texture with a noise, interpolating two colors.
+//! The rows are generated by independent jobs of NOISE_ROWS_PER_JOB rows, running in parallel
+//! \param data Texture data to fill
+//! \param settings Settings of the noise
+//! \param color0 Color of the noise value 0
+//! \param color1 Color of the noise value 1
+//! \return False if the pixel format of the texture is not supported
+bool GenerateNoise(TextureData * data,
+                   const NoiseSettings & settings,
+                   const Math::ColorRGBA & color0,
+                   const Math::ColorRGBA & color1);
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_NOISE_H
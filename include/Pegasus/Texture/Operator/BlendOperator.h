@@ -0,0 +1,57 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BlendOperator.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Texture operator blending its second input texture over its first one
+
+#ifndef PEGASUS_TEXTURE_OPERATOR_BLENDOPERATOR_H
+#define PEGASUS_TEXTURE_OPERATOR_BLENDOPERATOR_H
+
+#include "Pegasus/Texture/TextureOperator.h"
+#include "Pegasus/Texture/ImageFilter.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture operator blending its second input texture over its first one
+//! The blend mode is one of the BlendMode constants (ImageFilter.h)
+class BlendOperator : public TextureOperator
+{
+    DECLARE_TEXTURE_OPERATOR_NODE(BlendOperator)
+
+    BEGIN_DECLARE_PROPERTIES(BlendOperator, TextureOperator)
+        DECLARE_PROPERTY(unsigned int, Mode, BLENDMODE_MULTIPLY)
+        DECLARE_PROPERTY(float, Opacity, 1.0f)
+    END_DECLARE_PROPERTIES()
+
+    //------------------------------------------------------------------------------------
+
+public:
+
+    //! Specifies the minimum number of input nodes accepted by the current node
+    //! \return 2
+    virtual unsigned int GetMinNumInputNodes() const { return 2; }
+
+    //! Specifies the maximum number of input nodes accepted by the current node
+    //! \return 2
+    virtual unsigned int GetMaxNumInputNodes() const { return 2; }
+
+    //------------------------------------------------------------------------------------
+    
+protected:
+
+    //! Generate the content of the data associated with the texture operator
+    virtual void GenerateData();
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_OPERATOR_BLENDOPERATOR_H
@@ -0,0 +1,57 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   BlurOperator.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Texture operator blurring its input texture
+
+#ifndef PEGASUS_TEXTURE_OPERATOR_BLUROPERATOR_H
+#define PEGASUS_TEXTURE_OPERATOR_BLUROPERATOR_H
+
+#include "Pegasus/Texture/TextureOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture operator blurring its input texture
+//! The blur is made of separable box passes, three of them approximating a Gaussian
+class BlurOperator : public TextureOperator
+{
+    DECLARE_TEXTURE_OPERATOR_NODE(BlurOperator)
+
+    BEGIN_DECLARE_PROPERTIES(BlurOperator, TextureOperator)
+        DECLARE_PROPERTY(float, Radius, 2.0f)
+        DECLARE_PROPERTY(bool, Gaussian, true)
+        DECLARE_PROPERTY(bool, Tile, true)
+    END_DECLARE_PROPERTIES()
+
+    //------------------------------------------------------------------------------------
+
+public:
+
+    //! Specifies the minimum number of input nodes accepted by the current node
+    //! \return 1
+    virtual unsigned int GetMinNumInputNodes() const { return 1; }
+
+    //! Specifies the maximum number of input nodes accepted by the current node
+    //! \return 1
+    virtual unsigned int GetMaxNumInputNodes() const { return 1; }
+
+    //------------------------------------------------------------------------------------
+    
+protected:
+
+    //! Generate the content of the data associated with the texture operator
+    virtual void GenerateData();
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_OPERATOR_BLUROPERATOR_H
@@ -0,0 +1,58 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   LevelsOperator.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Texture operator remapping the RGB channels of its input texture with levels and a gamma curve
+
+#ifndef PEGASUS_TEXTURE_OPERATOR_LEVELSOPERATOR_H
+#define PEGASUS_TEXTURE_OPERATOR_LEVELSOPERATOR_H
+
+#include "Pegasus/Texture/TextureOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture operator remapping the RGB channels of its input texture with levels and a gamma curve
+class LevelsOperator : public TextureOperator
+{
+    DECLARE_TEXTURE_OPERATOR_NODE(LevelsOperator)
+
+    BEGIN_DECLARE_PROPERTIES(LevelsOperator, TextureOperator)
+        DECLARE_PROPERTY(float, InputBlack, 0.0f)
+        DECLARE_PROPERTY(float, InputWhite, 1.0f)
+        DECLARE_PROPERTY(float, Gamma, 1.0f)
+        DECLARE_PROPERTY(float, OutputBlack, 0.0f)
+        DECLARE_PROPERTY(float, OutputWhite, 1.0f)
+    END_DECLARE_PROPERTIES()
+
+    //------------------------------------------------------------------------------------
+
+public:
+
+    //! Specifies the minimum number of input nodes accepted by the current node
+    //! \return 1
+    virtual unsigned int GetMinNumInputNodes() const { return 1; }
+
+    //! Specifies the maximum number of input nodes accepted by the current node
+    //! \return 1
+    virtual unsigned int GetMaxNumInputNodes() const { return 1; }
+
+    //------------------------------------------------------------------------------------
+    
+protected:
+
+    //! Generate the content of the data associated with the texture operator
+    virtual void GenerateData();
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_OPERATOR_LEVELSOPERATOR_H
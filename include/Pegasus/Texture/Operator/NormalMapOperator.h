@@ -0,0 +1,56 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   NormalMapOperator.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Texture operator converting the red channel of its input texture (height map) to a normal map
+
+#ifndef PEGASUS_TEXTURE_OPERATOR_NORMALMAPOPERATOR_H
+#define PEGASUS_TEXTURE_OPERATOR_NORMALMAPOPERATOR_H
+
+#include "Pegasus/Texture/TextureOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture operator converting the red channel of its input texture (height map) to a normal map
+//! The normals are encoded in RGB, the height is kept in alpha
+class NormalMapOperator : public TextureOperator
+{
+    DECLARE_TEXTURE_OPERATOR_NODE(NormalMapOperator)
+
+    BEGIN_DECLARE_PROPERTIES(NormalMapOperator, TextureOperator)
+        DECLARE_PROPERTY(float, Strength, 8.0f)
+        DECLARE_PROPERTY(bool, Tile, true)
+    END_DECLARE_PROPERTIES()
+
+    //------------------------------------------------------------------------------------
+
+public:
+
+    //! Specifies the minimum number of input nodes accepted by the current node
+    //! \return 1
+    virtual unsigned int GetMinNumInputNodes() const { return 1; }
+
+    //! Specifies the maximum number of input nodes accepted by the current node
+    //! \return 1
+    virtual unsigned int GetMaxNumInputNodes() const { return 1; }
+
+    //------------------------------------------------------------------------------------
+    
+protected:
+
+    //! Generate the content of the data associated with the texture operator
+    virtual void GenerateData();
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_OPERATOR_NORMALMAPOPERATOR_H
@@ -0,0 +1,55 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   WarpOperator.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Texture operator distorting its first input texture with the red and green channels of its second one
+
+#ifndef PEGASUS_TEXTURE_OPERATOR_WARPOPERATOR_H
+#define PEGASUS_TEXTURE_OPERATOR_WARPOPERATOR_H
+
+#include "Pegasus/Texture/TextureOperator.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Texture operator distorting its first input texture with the red and green channels of its second one
+class WarpOperator : public TextureOperator
+{
+    DECLARE_TEXTURE_OPERATOR_NODE(WarpOperator)
+
+    BEGIN_DECLARE_PROPERTIES(WarpOperator, TextureOperator)
+        DECLARE_PROPERTY(float, Strength, 0.05f)
+        DECLARE_PROPERTY(bool, Tile, true)
+    END_DECLARE_PROPERTIES()
+
+    //------------------------------------------------------------------------------------
+
+public:
+
+    //! Specifies the minimum number of input nodes accepted by the current node
+    //! \return 2
+    virtual unsigned int GetMinNumInputNodes() const { return 2; }
+
+    //! Specifies the maximum number of input nodes accepted by the current node
+    //! \return 2
+    virtual unsigned int GetMaxNumInputNodes() const { return 2; }
+
+    //------------------------------------------------------------------------------------
+    
+protected:
+
+    //! Generate the content of the data associated with the texture operator
+    virtual void GenerateData();
+};
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_OPERATOR_WARPOPERATOR_H
@@ -0,0 +1,230 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                       Pegasus                                        */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   PixelFormat.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Compile-time description of the pixel formats supported by the texture generators
+//!         and operators, and dispatch of the pixel kernels
+
+#ifndef PEGASUS_TEXTURE_PIXELFORMAT_H
+#define PEGASUS_TEXTURE_PIXELFORMAT_H
+
+#include "Pegasus/Core/Formats.h"
+#include "Pegasus/Math/Scalar.h"
+#include "Pegasus/Math/Color.h"
+#include "Pegasus/Math/Half.h"
+
+namespace Pegasus {
+namespace Texture {
+
+
+//! Normalized unsigned integer channel, storing [0, 1] in [0, MaxValue]
+template <typename Type, unsigned int MaxValue>
+struct UnormChannel
+{
+    typedef Type ChannelType;
+
+    //! Convert a value to the channel, clamped to [0, 1] and rounded down like Color8RGBA
+    static inline ChannelType FromFloat(float value)
+    {
+        return static_cast<ChannelType>(Math::Clamp(value, 0.0f, 1.0f) * static_cast<float>(MaxValue));
+    }
+
+    //! Convert an 8 bits value to the channel, exactly for 8 bits channels
+    static inline ChannelType FromByte(Math::PUInt8 value)
+    {
+        return static_cast<ChannelType>((static_cast<unsigned int>(value) * MaxValue + 127) / 255);
+    }
+
+    //! Convert the channel to a value in [0, 1]
+    static inline float ToFloat(ChannelType channel)
+    {
+        return static_cast<float>(channel) * (1.0f / static_cast<float>(MaxValue));
+    }
+
+    //! Add two channels, saturating or wrapping around
+    static inline ChannelType Add(ChannelType channel0, ChannelType channel1, bool clamp)
+    {
+        const unsigned int sum = static_cast<unsigned int>(channel0) + static_cast<unsigned int>(channel1);
+        if (clamp)
+        {
+            return static_cast<ChannelType>((sum > MaxValue) ? MaxValue : sum);
+        }
+        return static_cast<ChannelType>(sum & MaxValue);
+    }
+};
+
+//! 32 bits floating point channel, storing any value
+struct FloatChannel
+{
+    typedef Math::PFloat32 ChannelType;
+
+    static inline ChannelType FromFloat(float value) { return value; }
+    static inline ChannelType FromByte(Math::PUInt8 value) { return static_cast<float>(value) * (1.0f / 255.0f); }
+    static inline float ToFloat(ChannelType channel) { return channel; }
+
+    //! Add two channels, clamping the sum to [0, 1] when requested
+    static inline ChannelType Add(ChannelType channel0, ChannelType channel1, bool clamp)
+    {
+        const float sum = channel0 + channel1;
+        return clamp ? Math::Clamp(sum, 0.0f, 1.0f) : sum;
+    }
+};
+
+//! 16 bits floating point channel, storing any value with half precision
+struct HalfChannel
+{
+    typedef Math::PFloat16 ChannelType;
+
+    static inline ChannelType FromFloat(float value) { return Math::FloatToHalf(value); }
+    static inline ChannelType FromByte(Math::PUInt8 value) { return FromFloat(FloatChannel::FromByte(value)); }
+    static inline float ToFloat(ChannelType channel) { return Math::HalfToFloat(channel); }
+
+    //! Add two channels, clamping the sum to [0, 1] when requested
+    static inline ChannelType Add(ChannelType channel0, ChannelType channel1, bool clamp)
+    {
+        return FromFloat(FloatChannel::Add(ToFloat(channel0), ToFloat(channel1), clamp));
+    }
+};
+
+//----------------------------------------------------------------------------------------
+
+//! Pixel format with NumChannels channels of the same type, starting from red.
+//! The missing channels of a color are dropped when storing, and read as (0, 0, 0, 1)
+//! \param Channel Channel description (UnormChannel, FloatChannel or HalfChannel)
+//! \param NumChannels Number of channels of a pixel (1 to 4)
+template <typename Channel, unsigned int NumChannels>
+struct PixelFormat
+{
+    typedef Channel ChannelTraits;
+    typedef typename Channel::ChannelType ChannelType;
+    enum { NUM_CHANNELS = NumChannels };
+
+    //! Convert a color to a pixel
+    //! \param color Color to convert, in [0, 1] for the normalized formats
+    //! \param pixel Channels of the pixel (output)
+    static inline void FromColor(const Math::ColorRGBA & color, ChannelType * pixel)
+    {
+        for (unsigned int c = 0; c < NumChannels; ++c)
+        {
+            pixel[c] = Channel::FromFloat(color.v[c]);
+        }
+    }
+
+    //! Convert an 8 bits color to a pixel, exactly for the 8 bits formats
+    //! \param color Color to convert
+    //! \param pixel Channels of the pixel (output)
+    static inline void FromColor8(const Math::Color8RGBA & color, ChannelType * pixel)
+    {
+        for (unsigned int c = 0; c < NumChannels; ++c)
+        {
+            pixel[c] = Channel::FromByte(color.rgba[c]);
+        }
+    }
+
+    //! Convert a pixel to a color
+    //! \param pixel Channels of the pixel
+    //! \param color Converted color (output)
+    static inline void ToColor(const ChannelType * pixel, Math::ColorRGBA & color)
+    {
+        color = Math::ColorRGBA(0.0f, 0.0f, 0.0f, 1.0f);
+        for (unsigned int c = 0; c < NumChannels; ++c)
+        {
+            color.v[c] = Channel::ToFloat(pixel[c]);
+        }
+    }
+
+    //! Fill a range of pixels with the same value
+    //! \param pixels First pixel to fill
+    //! \param numPixels Number of pixels to fill
+    //! \param pixel Channels of the pixel to copy
+    static inline void Fill(ChannelType * pixels, unsigned int numPixels, const ChannelType * pixel)
+    {
+        for (unsigned int p = 0; p < numPixels; ++p, pixels += NumChannels)
+        {
+            for (unsigned int c = 0; c < NumChannels; ++c)
+            {
+                pixels[c] = pixel[c];
+            }
+        }
+    }
+};
+
+//! Pixel formats supported by the texture generators and operators
+typedef PixelFormat<UnormChannel<Math::PUInt8, 0xFF>, 4>        PixelRGBA8Unorm;
+typedef PixelFormat<UnormChannel<Math::PUInt16, 0xFFFF>, 4>     PixelRGBA16Unorm;
+typedef PixelFormat<HalfChannel, 4>                             PixelRGBA16Float;
+typedef PixelFormat<FloatChannel, 4>                            PixelRGBA32Float;
+typedef PixelFormat<FloatChannel, 3>                            PixelRGB32Float;
+typedef PixelFormat<FloatChannel, 2>                            PixelRG32Float;
+typedef PixelFormat<HalfChannel, 2>                             PixelRG16Float;
+typedef PixelFormat<FloatChannel, 1>                            PixelR32Float;
+typedef PixelFormat<HalfChannel, 1>                             PixelR16Float;
+typedef PixelFormat<UnormChannel<Math::PUInt16, 0xFFFF>, 1>     PixelR16Unorm;
+typedef PixelFormat<UnormChannel<Math::PUInt8, 0xFF>, 1>        PixelR8Unorm;
+
+//----------------------------------------------------------------------------------------
+
+//! Run a pixel kernel specialized for the pixel format of a texture.
+//! The format is resolved once, the kernel is compiled for each pixel format,
+//! so its inner loops have no per-pixel format test.
+//! The sRGB format uses the RGBA8 kernel, values are written as given
+//! \param Kernel Class template with a static Run(Parameters &) function,
+//!               instantiated with each PixelFormat typedef
+//! \param Parameters Type of the parameters given to the kernel
+//! \param format Pixel format of the texture
+//! \param parameters Parameters given to the kernel
+//! \return False if the format is not supported, in which case the kernel is not run
+template <template <typename> class Kernel, typename Parameters>
+bool RunPixelKernel(Core::Format format, Parameters & parameters)
+{
+    switch (format)
+    {
+        case Core::FORMAT_RGBA_8_UNORM:
+        case Core::FORMAT_RGBA_8_UNORM_SRGB:    Kernel<PixelRGBA8Unorm >::Run(parameters);  return true;
+        case Core::FORMAT_RGBA_16_UNORM:        Kernel<PixelRGBA16Unorm>::Run(parameters);  return true;
+        case Core::FORMAT_RGBA_16_FLOAT:        Kernel<PixelRGBA16Float>::Run(parameters);  return true;
+        case Core::FORMAT_RGBA_32_FLOAT:        Kernel<PixelRGBA32Float>::Run(parameters);  return true;
+        case Core::FORMAT_RGB_32_FLOAT:         Kernel<PixelRGB32Float >::Run(parameters);  return true;
+        case Core::FORMAT_RG_32_FLOAT:          Kernel<PixelRG32Float  >::Run(parameters);  return true;
+        case Core::FORMAT_RG16_FLOAT:           Kernel<PixelRG16Float  >::Run(parameters);  return true;
+        case Core::FORMAT_R32_FLOAT:            Kernel<PixelR32Float   >::Run(parameters);  return true;
+        case Core::FORMAT_R16_FLOAT:            Kernel<PixelR16Float   >::Run(parameters);  return true;
+        case Core::FORMAT_R16_UNORM:            Kernel<PixelR16Unorm   >::Run(parameters);  return true;
+        case Core::FORMAT_R8_UNORM:             Kernel<PixelR8Unorm    >::Run(parameters);  return true;
+
+        default:
+            return false;
+    }
+}
+
+//----------------------------------------------------------------------------------------
+
+//! Pixel kernel returning the size of a pixel
+template <typename Pixel>
+struct PixelSizeKernel
+{
+    static inline void Run(unsigned int & numBytesPerPixel)
+    {
+        numBytesPerPixel = sizeof(typename Pixel::ChannelType) * Pixel::NUM_CHANNELS;
+    }
+};
+
+//! Test if a pixel format is supported by the texture generators and operators
+//! \param format Pixel format to test
+//! \return True if \a RunPixelKernel() supports the format
+inline bool IsPixelKernelFormat(Core::Format format)
+{
+    unsigned int numBytesPerPixel = 0;
+    return RunPixelKernel<PixelSizeKernel>(format, numBytesPerPixel);
+}
+
+
+}   // namespace Texture
+}   // namespace Pegasus
+
+#endif  // PEGASUS_TEXTURE_PIXELFORMAT_H
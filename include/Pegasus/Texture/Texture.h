@@ -28,6 +28,7 @@ namespace Pegasus {
 
     namespace Graph {
         class NodeManager;
+        class NodeDataResidency;
     }
 }
 
@@ -68,10 +69,34 @@ public:
     //! \note Must be set in order to provide GPU data during GetUpdatedData callback
     void SetFactory(ITextureFactory * textureFactory) { mFactory = textureFactory; }
 
+    //! Set the policy discarding the CPU copy of the texture data once the GPU data is created
+    //! \param residency Residency policy, nullptr to always keep the CPU copy
+    void SetDataResidency(Graph::NodeDataResidency * residency) { mDataResidency = residency; }
+
     //! Get the configuration of the texture
     //! \return Configuration of the texture, such as the resolution and pixel format
     inline const TextureConfiguration & GetConfiguration() const { return mConfiguration; }
 
+    //! Enable the block compression of the texture, as the last stage before the upload.
+    //! The texture keeps its own compressed copy of the input data, uploaded instead of the input data,
+    //! until the input data is generated again. The input data is never modified, it can be shared with other graphs.
+    //! Textures with a width or height not multiple of 4, 3D textures and non-RGBA8 textures are uploaded uncompressed
+    //! \param format Block compressed format (see \a IsBlockCompressedFormat()),
+    //!               use the _SRGB formats for sRGB textures
+    //! \param quality Quality preset of the encoder
+    void SetCompression(Core::Format format, CompressionQuality quality);
+
+    //! Disable the block compression of the texture
+    void DisableCompression();
+
+    //! Get the block compressed format of the texture
+    //! \return Block compressed format, FORMAT_MAX_COUNT when the compression is disabled
+    inline Core::Format GetCompressionFormat() const { return mCompressionFormat; }
+
+    //! Get the quality preset of the block compression
+    //! \return Quality preset of the encoder
+    inline CompressionQuality GetCompressionQuality() const { return mCompressionQuality; }
+
 
     //! Set the input of the texture output node to a generator node
     //! \warning If an input was already set (generator or operator), it is replaced
@@ -144,11 +169,45 @@ private:
 
     void ReleaseGPUData();
 
+    //! Test if a texture can be block compressed
+    //! \param configuration Configuration of the texture data
+    //! \return True for 2D RGBA8 textures with a width and height multiple of 4
+    static bool CanCompress(const TextureConfiguration & configuration);
+
+    //! Create the compressed copy of the input data and its GPU data, if the input data changed since the last upload
+    //! \param sourceData Up-to-date data of the input node, left unchanged
+    void UpdateCompressedTextureData(TextureDataIn sourceData);
+
+    //! Destroy the compressed copy of the input data and its GPU data
+    void ReleaseCompressedTextureData();
+
     //! Configuration of the texture, such as the resolution and pixel format
     TextureConfiguration mConfiguration;
 
     //! Pointer to the GPU factory. Generates GPU data from CPU texture data
     ITextureFactory * mFactory;
+
+    //! Policy discarding the CPU copy of the texture data after the upload, nullptr to keep it
+    Graph::NodeDataResidency * mDataResidency;
+
+    //! Block compressed format of the uploaded texture, FORMAT_MAX_COUNT to upload the image data
+    Core::Format mCompressionFormat;
+
+    //! Quality preset of the block compression
+    CompressionQuality mCompressionQuality;
+
+    //! True when the compression settings changed since the last upload
+    bool mCompressionChanged;
+
+    //! Compressed copy of the input data, owned by the output node since the input data can be shared
+    //! with other graphs. Null reference when the compression is disabled
+    TextureDataRef mCompressedTextureData;
+
+    //! Input data the compressed copy has been created from, compared but never dereferenced
+    const TextureData * mCompressedSourceData;
+
+    //! Generation of the input node when the compressed copy has been created
+    unsigned int mCompressedSourceGeneration;
 };
 
 //----------------------------------------------------------------------------------------
@@ -16,6 +16,12 @@
 #include "Pegasus/Texture/Proxy/TextureConfigurationProxy.h"
 #include "Pegasus/Core/Formats.h"
 
+namespace Pegasus {
+    namespace Graph {
+        class NodeDataKey;
+    }
+}
+
 namespace Pegasus {
 namespace Texture {
 
@@ -39,6 +45,17 @@ public:
         NUM_TYPES
     };
 
+    //! Filters available to compute the mip levels
+    enum MipFilter
+    {
+        MIPFILTER_BOX = 0,  //!< Average of 2x2 pixels, the fastest
+        MIPFILTER_KAISER,   //!< Kaiser-windowed sinc over 6x6 pixels, sharper with less aliasing
+        NUM_MIPFILTERS
+    };
+
+    //! Maximum number of mip levels, for a 32768x32768 texture
+    enum { MAX_NUM_MIP_LEVELS = 16 };
+
     //! Default constructor, sets the resolution to 256x256 and the pixel format to RGB8
     TextureConfiguration();
 
@@ -49,12 +66,17 @@ public:
     //! \param height Vertical resolution of the texture in pixels (>= 1)
     //! \param depth Depth of the texture in pixels (>= 1)
     //! \param numLayers Number of layers for array textures, 6 for cube maps, 1 otherwise
+    //! \param numMipLevels Number of mip levels including the full resolution one,
+    //!                     0 for the complete chain down to 1x1, 1 for 3D textures and non-RGBA8 formats
+    //! \param mipFilter Filter used to compute the mip levels (MIPFILTER_xxx constant)
     TextureConfiguration(Type type,
                          Core::Format pixelFormat,
                          unsigned int width,
                          unsigned int height,
                          unsigned int depth,
-                         unsigned int numLayers);
+                         unsigned int numLayers,
+                         unsigned int numMipLevels = 1,
+                         MipFilter mipFilter = MIPFILTER_BOX);
 
     //! Copy constructor
     //! \param other Other configuration to copy from
@@ -89,6 +111,39 @@ public:
     //! \return Number of layers of the texture (>= 1)
     inline unsigned int GetNumLayers() const { return mNumLayers; }
 
+    //! Get the number of mip levels of the texture
+    //! \return Number of mip levels including the full resolution one (>= 1)
+    inline unsigned int GetNumMipLevels() const { return mNumMipLevels; }
+
+    //! Get the filter used to compute the mip levels
+    //! \return Filter used to compute the mip levels (MIPFILTER_xxx constant)
+    inline MipFilter GetMipFilter() const { return mMipFilter; }
+
+    //! Test if the color channels are stored in sRGB space, in which case the mip levels are filtered in linear space
+    //! \return True if the pixel format is sRGB
+    inline bool IsSRGB() const { return mPixelFormat == Core::FORMAT_RGBA_8_UNORM_SRGB; }
+
+    //! Test if the pixels have 4 channels of 8 bits, the format required by the mip chain generation
+    //! and the block compression
+    //! \return True for the RGBA8 formats, linear or sRGB
+    inline bool HasRGBA8Pixels() const { return (mPixelFormat == Core::FORMAT_RGBA_8_UNORM) || (mPixelFormat == Core::FORMAT_RGBA_8_UNORM_SRGB); }
+
+    //! Get the width of a mip level in pixels
+    //! \param level Index of the mip level (< GetNumMipLevels())
+    //! \return Horizontal resolution of the mip level in pixels (>= 1)
+    inline unsigned int GetMipWidth(unsigned int level) const { return ((mWidth >> level) > 1) ? (mWidth >> level) : 1; }
+
+    //! Get the height of a mip level in pixels
+    //! \param level Index of the mip level (< GetNumMipLevels())
+    //! \return Vertical resolution of the mip level in pixels (>= 1)
+    inline unsigned int GetMipHeight(unsigned int level) const { return ((mHeight >> level) > 1) ? (mHeight >> level) : 1; }
+
+    //! Get the maximum number of mip levels of a resolution
+    //! \param width Horizontal resolution in pixels (>= 1)
+    //! \param height Vertical resolution in pixels (>= 1)
+    //! \return Number of levels down to 1x1, including the full resolution one
+    static unsigned int GetMaxNumMipLevels(unsigned int width, unsigned int height);
+
 
     //! Get the number of bytes per pixel of the texture, computed from the pixel format
     //! \return Number of bytes per pixel of the texture (>= 1)
@@ -103,17 +158,37 @@ public:
     //! \return Number of bytes of the texture for one layer (>= 1)
     inline unsigned int GetNumBytesPerLayer() const { return GetNumPixelsPerLayer() * GetNumBytesPerPixel(); }
 
-    //! Get the total number of bytes of the texture
+    //! Get the number of bytes of a mip level for one layer
+    //! \param level Index of the mip level (< GetNumMipLevels())
+    //! \return Number of bytes of the mip level for one layer (>= 1)
+    inline unsigned int GetNumBytesPerMipLevel(unsigned int level) const { return GetMipWidth(level) * GetMipHeight(level) * mDepth * GetNumBytesPerPixel(); }
+
+    //! Get the offset of a mip level in the image data of a layer, the levels being stored one after the other
+    //! \param level Index of the mip level (<= GetNumMipLevels())
+    //! \return Offset in bytes, the size of the chain when level == GetNumMipLevels()
+    unsigned int GetMipLevelOffset(unsigned int level) const;
+
+    //! Get the number of bytes of the texture for one layer, including every mip level
+    //! \return Number of bytes of the mip chain for one layer (>= 1)
+    inline unsigned int GetNumBytesPerLayerMipChain() const { return GetMipLevelOffset(mNumMipLevels); }
+
+    //! Get the total number of bytes of the texture, including every mip level
     //! \return Number of bytes of the texture (>= 1)
-    inline unsigned int GetNumBytes() const { return mNumLayers * GetNumBytesPerLayer(); }
+    inline unsigned int GetNumBytes() const { return mNumLayers * GetNumBytesPerLayerMipChain(); }
 
 
     //! Test if an input texture configuration is considered as compatible with the current one
     //! \warning This is important to test when linking Texture, TextureGenerator and TextureOperator together
+    //! \note The mip levels are ignored, the nodes read the full resolution level of their inputs
+    //!       and the textures upload the mip levels computed by their input
     //! \param configuration Configuration to test with
     //! \return True if the configurations are compatible
     bool IsCompatible(const TextureConfiguration & configuration) const;
 
+    //! Append the configuration to the key of a node data, used to share identical node data
+    //! \param key Key being built by the node
+    void WriteDataKey(Graph::NodeDataKey & key) const;
+
 
 #if PEGASUS_ENABLE_PROXIES
 
@@ -153,6 +228,12 @@ private:
 
     // Number of layers for array textures, 6 for cube maps, 1 otherwise
     unsigned int mNumLayers;
+
+    //! Number of mip levels including the full resolution one (>= 1)
+    unsigned int mNumMipLevels;
+
+    //! Filter used to compute the mip levels (MIPFILTER_xxx constant)
+    MipFilter mMipFilter;
 };
 
 
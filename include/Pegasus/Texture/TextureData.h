@@ -14,6 +14,7 @@
 
 #include "Pegasus/Graph/NodeData.h"
 #include "Pegasus/Texture/TextureConfiguration.h"
+#include "Pegasus/Texture/BlockCompression.h"
 
 namespace Pegasus {
 namespace Texture {
@@ -34,7 +35,7 @@ public:
     //! \return Configuration of the texture data, such as the resolution and pixel format
     inline const TextureConfiguration & GetConfiguration() const { return mConfiguration; }
 
-    //! Get the image data for a layer
+    //! Get the image data for a layer, starting with the full resolution level
     //! \param layer Index of the layer (< mNumLayers)
     inline unsigned char * GetLayerImageData(unsigned int layer)
         {
@@ -42,7 +43,7 @@ public:
             return mImageData[layer];
         }
 
-    //! Get the image data for a layer (const version)
+    //! Get the image data for a layer, starting with the full resolution level (const version)
     //! \param layer Index of the layer (< mNumLayers)
     inline const unsigned char * GetLayerImageData(unsigned int layer) const
         {
@@ -50,6 +51,69 @@ public:
             return mImageData[layer];
         }
 
+    //! Get the image data of a mip level for a layer
+    //! \param layer Index of the layer (< mNumLayers)
+    //! \param level Index of the mip level (< mNumMipLevels)
+    inline unsigned char * GetLayerMipImageData(unsigned int layer, unsigned int level)
+        {
+            return GetLayerImageData(layer) + mConfiguration.GetMipLevelOffset(level);
+        }
+
+    //! Get the image data of a mip level for a layer (const version)
+    //! \param layer Index of the layer (< mNumLayers)
+    //! \param level Index of the mip level (< mNumMipLevels)
+    inline const unsigned char * GetLayerMipImageData(unsigned int layer, unsigned int level) const
+        {
+            return GetLayerImageData(layer) + mConfiguration.GetMipLevelOffset(level);
+        }
+
+    //! Get the size of the memory used by the image data of every layer, including the mip levels
+    //! and the block compressed copy
+    //! \return Size in bytes
+    virtual unsigned int GetMemorySize() const { return mConfiguration.GetNumBytes() + mCompressedDataSize; }
+
+    //! Create the block compressed copy of every layer and mip level from the image data.
+    //! The copy is kept until the data is generated again, so compressing again with the same
+    //! format and quality does nothing
+    //! \param format Block compressed format (see \a IsBlockCompressedFormat())
+    //! \param quality Quality preset of the encoder
+    //! \return True if the compressed copy is available, false for 3D textures, non-RGBA8 formats
+    //!         or when the CPU copy is discarded
+    bool Compress(Core::Format format, CompressionQuality quality);
+
+    //! Free the block compressed copy
+    void ReleaseCompressedData();
+
+    //! Test if the block compressed copy is available
+    //! \return True after a successful call to \a Compress(), until the data is generated again
+    inline bool IsCompressed() const { return mCompressedData != nullptr; }
+
+    //! Get the format of the block compressed copy
+    //! \return Block compressed format, FORMAT_MAX_COUNT when there is no compressed copy
+    inline Core::Format GetCompressedFormat() const { return mCompressedFormat; }
+
+    //! Get the compressed data of a mip level for a layer
+    //! \param layer Index of the layer (< mNumLayers)
+    //! \param level Index of the mip level (< mNumMipLevels)
+    //! \return Blocks of the level, rows of GetCompressedRowPitch(level) bytes
+    const unsigned char * GetLayerMipCompressedData(unsigned int layer, unsigned int level) const;
+
+    //! Get the size of a row of blocks of the compressed copy
+    //! \param level Index of the mip level (< mNumMipLevels)
+    //! \return Size in bytes of a row of 4x4 blocks
+    inline unsigned int GetCompressedRowPitch(unsigned int level) const
+        {
+            return GetNumCompressedBlocks(mConfiguration.GetMipWidth(level)) * GetCompressedBlockSize(mCompressedFormat);
+        }
+
+    //! Get the size of a mip level of the compressed copy
+    //! \param level Index of the mip level (< mNumMipLevels)
+    //! \return Size in bytes of the level
+    inline unsigned int GetCompressedLevelSize(unsigned int level) const
+        {
+            return GetCompressedImageSize(mCompressedFormat, mConfiguration.GetMipWidth(level), mConfiguration.GetMipHeight(level));
+        }
+
     //------------------------------------------------------------------------------------
     
 protected:
@@ -57,6 +121,17 @@ protected:
     //! Destructor
     virtual ~TextureData();
 
+    //! Free the image data of every layer and the compressed copy, once the GPU data is valid
+    //! \return Number of bytes freed
+    virtual unsigned int ReleaseCPUBuffers();
+
+    //! Allocate the image data of every layer again
+    virtual void AllocateCPUBuffers();
+
+    //! Compute the mip levels from the full resolution level generated by the node,
+    //! and free the compressed copy of the previous content
+    virtual void CompleteGeneration();
+
     //------------------------------------------------------------------------------------
     
 private:
@@ -68,9 +143,22 @@ private:
     TextureConfiguration mConfiguration;
 
 
-    //! Image data of the texture, never nullptr.
-    //! mImageData[layer][z*height*width + y*height + x]
+    //! Image data of the texture, never nullptr, the layers are nullptr while the CPU copy is discarded.
+    //! mImageData[layer][z*height*width + y*height + x], followed by the mip levels if any
     unsigned char ** mImageData;
+
+    //! Block compressed copy of every layer and mip level, nullptr when not compressed.
+    //! The layers follow each other, each one with its mip levels in order
+    unsigned char * mCompressedData;
+
+    //! Size in bytes of the block compressed copy, 0 when not compressed
+    unsigned int mCompressedDataSize;
+
+    //! Format of the block compressed copy, FORMAT_MAX_COUNT when not compressed
+    Core::Format mCompressedFormat;
+
+    //! Quality preset used for the block compressed copy
+    CompressionQuality mCompressionQuality;
 };
 
 //----------------------------------------------------------------------------------------
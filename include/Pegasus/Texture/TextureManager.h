@@ -13,6 +13,8 @@
 #define PEGASUS_TEXTURE_TEXTUREMANAGER_H
 
 #include "Pegasus/Graph/Node.h"
+#include "Pegasus/Graph/NodeDataInterner.h"
+#include "Pegasus/Graph/NodeDataResidency.h"
 #include "Pegasus/Texture/Texture.h"
 #include "Pegasus/Texture/TextureGenerator.h"
 #include "Pegasus/Texture/TextureOperator.h"
@@ -77,6 +79,34 @@ public:
     TextureOperatorReturn CreateTextureOperatorNode(const char * className,
                                                     const TextureConfiguration & configuration);
 
+    //! Get the table sharing the data of structurally identical texture generators and operators.
+    //! Sharing is disabled by default, enable it with \a NodeDataInterner::SetEnabled().
+    //! The statistics of the table report the memory saved
+    //! \return Table of shared texture data
+    //@{
+    inline Graph::NodeDataInterner & GetDataInterner() { return mDataInterner; }
+    inline const Graph::NodeDataInterner & GetDataInterner() const { return mDataInterner; }
+    //@}
+
+    //! Make the data of the texture generators and operators created from now on transient.
+    //! Their data is then allocated from the transient node data pool and released once the dependent
+    //! nodes have been generated, reducing the peak memory of long operator chains
+    //! at the cost of regenerating the released data when it is needed again. Disabled by default
+    //! \param transient True to create nodes with transient data
+    inline void SetTransientNodeData(bool transient) { mTransientNodeData = transient; }
+
+    //! Test if the texture generators and operators are created with transient data
+    //! \return True if the nodes created from now on have transient data
+    inline bool IsTransientNodeData() const { return mTransientNodeData; }
+
+    //! Get the residency policy of the texture data, discarding the CPU copies once uploaded to the GPU.
+    //! Disabled by default, enable it and set a budget to release the CPU copies of the least recently used textures
+    //! \return Residency policy shared by the texture nodes of the manager
+    //@{
+    inline Graph::NodeDataResidency & GetDataResidency() { return mDataResidency; }
+    inline const Graph::NodeDataResidency & GetDataResidency() const { return mDataResidency; }
+    //@}
+
 #if PEGASUS_ENABLE_PROXIES
 
     //! Get the proxy associated with the texture manager
@@ -117,6 +147,11 @@ private:
     //! Register all the texture nodes of the Texture project
     void RegisterAllTextureNodes();
 
+    //! Destroy the GPU data of a texture data released by the data interner
+    //! \param data Texture data about to be released
+    //! \param userData Pointer to the texture manager
+    static void ReleaseInternedData(Graph::NodeData * data, void * userData);
+
 
     //! Pointer to the node manager (!= nullptr)
     Graph::NodeManager * mNodeManager;
@@ -124,6 +159,15 @@ private:
     //! Pointer to the GPU factory. Generates GPU data from CPU texture data
     ITextureFactory * mFactory;
 
+    //! Table sharing the data of structurally identical generators and operators
+    Graph::NodeDataInterner mDataInterner;
+
+    //! True to create the generators and operators with transient data
+    bool mTransientNodeData;
+
+    //! Residency policy of the CPU copies of the texture data
+    Graph::NodeDataResidency mDataResidency;
+
 #if PEGASUS_ENABLE_PROXIES
 
     //! Proxy associated with the texture manager
@@ -131,6 +131,11 @@ protected:
     //! \note Called by \a GetUpdatedData()
     virtual void GenerateData() = 0;
 
+    //! Append the configuration to the key of the node data, used to share identical node data
+    //! \param key Key being built by the node
+    //! \return True, the data of texture operators depends only on their configuration, properties and inputs
+    virtual bool WriteDataKey(Graph::NodeDataKey & key) const;
+
     //------------------------------------------------------------------------------------
 
 private:
@@ -119,6 +119,11 @@ public:
     //! \param state - the vs vm state
     void CallWindowDestroyed(int windowIndex, BlockScript::BsVmState* state);
 
+    //! Continues the global scope or the function suspended by a yield statement (see BsVmState::SetYieldDeadline).
+    //! The state is Suspended again if it reaches a yield statement after its yield deadline.
+    //! \param state - the suspended vm state
+    void CallResume(BlockScript::BsVmState* state);
+
     //! Returns true of the script is active. False if it is not
     bool IsScriptActive() const { return mScriptActive; }
 
@@ -110,6 +110,20 @@ public:
     //! \param windowIndex - index of the window to destroy.
     void CallWindowDestroyed(int windowIndex);
 
+    //! Set the time budget of the script per frame. The global scope initialization and Update suspend at the first yield
+    //! statement reached once the budget is spent, and continue at the next update instead of calling Update again.
+    //! Render is not called until the global scope completes. While Update is suspended, Render runs on the state reached so far.
+    //! Window events and destruction complete the execution first.
+    //! \param milliseconds - the budget in milliseconds, 0 to suspend at every yield statement.
+    void SetYieldBudget(double milliseconds) { mYieldBudget = milliseconds; }
+
+    //! Get the time budget of the script per frame
+    //! \return the budget in milliseconds
+    double GetYieldBudget() const { return mYieldBudget; }
+
+    //! \return true if an execution of the script has been suspended by a yield statement, and continues at the next update
+    bool HasPendingExecution() const { return mPendingExecution != PENDING_NONE; }
+
 
     //Gets the property grid that this runner is using to dispatch externs
     PropertyGrid::PropertyGridObject* GetPropertyGrid() { return mPropertyGrid; }
@@ -125,6 +139,30 @@ protected:
 
 private:
 
+    //! Execution suspended by a yield statement
+    enum PendingExecution
+    {
+        PENDING_NONE,         //!< nothing is suspended
+        PENDING_GLOBAL_SCOPE, //!< the global scope initialization
+        PENDING_UPDATE        //!< the update function
+    };
+
+    //! Sets the yield deadline of the vm state at the end of the budget of the frame
+    void BeginYieldBudget();
+
+    //! Removes the yield deadline of the vm state, yield statements are ignored
+    void EndYieldBudget();
+
+    //! Sets the runtime listener, asset category and permissions of the global scope, before running or resuming it
+    void BeginGlobalScope();
+
+    //! Restores the asset category once the global scope is suspended, and removes the runtime listener once it completes
+    void EndGlobalScope();
+
+    //! Continues the execution suspended by a yield statement, if any
+    //! \param useYieldBudget - true to suspend it again once the budget of the frame is spent, false to complete it
+    void ResumePendingExecution(bool useYieldBudget);
+
     //! Allocator used for all timeline allocations
     Alloc::IAllocator * mAllocator;
 
@@ -152,6 +190,15 @@ private:
     //! The global cache of this runner
     Application::GlobalCache* mGlobalCache;
 
+    //! Time budget of the script per frame, in milliseconds
+    double mYieldBudget;
+
+    //! Execution suspended by a yield statement, continued by the next update
+    PendingExecution mPendingExecution;
+
+    //! True if the assets loaded by the global scope go to the asset category of the runner
+    bool mGlobalScopeUsesCategories;
+
 #if PEGASUS_ASSETLIB_ENABLE_CATEGORIES
     AssetLib::Category* mCategory;
 #endif
@@ -0,0 +1,38 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   MeshTests.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Pegasus Unit tests for the mesh processing functions of the Mesh package
+
+//! ADD HERE YOUR UNIT TEST NAMES
+//! make sure your unit test returns true if pass, false if fail
+
+#ifndef PEGASUS_MESH_TESTS_H
+#define PEGASUS_MESH_TESTS_H
+
+bool UNIT_TEST_VertexCache1();
+
+bool UNIT_TEST_VertexCache2();
+
+bool UNIT_TEST_Simplify1();
+
+bool UNIT_TEST_Simplify2();
+
+bool UNIT_TEST_Simplify3();
+
+bool UNIT_TEST_Weld1();
+
+bool UNIT_TEST_Quantize1();
+
+bool UNIT_TEST_Quantize2();
+
+bool UNIT_TEST_Bvh1();
+
+bool UNIT_TEST_Bvh2();
+
+#endif
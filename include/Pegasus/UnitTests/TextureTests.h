@@ -0,0 +1,28 @@
+/****************************************************************************************/
+/*                                                                                      */
+/*                                    Pegasus Unit Tests                                */
+/*                                                                                      */
+/****************************************************************************************/
+
+//! \file   TextureTests.h
+//! \author agent
+//! \date   19th October 2026
+//! \brief  Pegasus Unit tests for the pixel formats of the Texture package
+
+//! ADD HERE YOUR UNIT TEST NAMES
+//! make sure your unit test returns true if pass, false if fail
+
+#ifndef PEGASUS_TEXTURE_TESTS_H
+#define PEGASUS_TEXTURE_TESTS_H
+
+bool UNIT_TEST_HalfFloat1();
+
+bool UNIT_TEST_HalfFloat2();
+
+bool UNIT_TEST_PixelFormat1();
+
+bool UNIT_TEST_PixelFormat2();
+
+bool UNIT_TEST_PixelFormat3();
+
+#endif